@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -71,6 +71,9 @@ public class PlatformUtil {
     private static final boolean IOS = os.startsWith("iOS");
     private static final boolean STATIC_BUILD = "Substrate VM".equals(System.getProperty("java.vm.name"));
     private static final boolean HEADLESS = "headless".equals(embeddedType);
+    private static final boolean WAYLAND = LINUX && Boolean.getBoolean("jdk.gtk.wayland")
+            && System.getenv("WAYLAND_DISPLAY") != null
+            && !System.getenv("WAYLAND_DISPLAY").isBlank();
 
     /**
      * Utility method used to determine whether the version number as
@@ -132,6 +135,15 @@ public class PlatformUtil {
         return doEGLCompositing;
     }
 
+    /**
+     * Returns true if the GTK glass platform runs on the GDK Wayland backend
+     * rather than through XWayland. It is requested with the jdk.gtk.wayland
+     * system property and only used in a Wayland session.
+     */
+    public static boolean useWayland() {
+        return WAYLAND;
+    }
+
     public static boolean useGLES2() {
         String useGles2 = System.getProperty("use.gles2");
         if ("true".equals(useGles2))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,4 +37,5 @@ public class Logger {
     public void incrementCounter(String counter) {}
     public void newPhase(String name) {}
     public void newInput(String name) {}
+    public void gpuTime(String name, long nanos) {}
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -321,6 +321,19 @@ class PrintLogger extends Logger {
         curPhase.phaseStart = curTime;
     }
 
+    @Override
+    public void gpuTime(String name, long nanos) {
+        PulseData pulseData = Thread.currentThread() == fxThread ? fxData : renderData;
+        if (pulseData != null) {
+            pulseData.message
+                .append("T")
+                .append(Thread.currentThread().threadId())
+                .append(" GPU (").append(nanos/1000L).append("us): ")
+                .append(name)
+                .append("\n");
+        }
+    }
+
     /**
      *  A mutable integer to be used in the counter map
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -96,6 +96,20 @@ public class PulseLogger {
         }
     }
 
+    /**
+     * Reports the time the GPU spent executing the named work. GPU timings
+     * become available a few frames after the work was submitted, so they
+     * are attributed to the pulse that is being rendered when they arrive.
+     *
+     * @param name the name of the measured work, for example "Frame"
+     * @param nanos the elapsed GPU time in nanoseconds
+     */
+    public static void gpuTime(String name, long nanos) {
+        for (Logger logger: loggers) {
+            logger.gpuTime(name, nanos);
+        }
+    }
+
     /**
      * @return true if the user requested pulse logging by setting the system
      *         property javafx.pulseLogger to true, false otherwise.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,7 @@ public final class JFRPulseLogger extends Logger {
     private JFRPulseLogger() {
         FlightRecorder.register(JFRInputEvent.class);
         FlightRecorder.register(JFRPulsePhaseEvent.class);
+        FlightRecorder.register(JFRGPUTimeEvent.class);
         currentPulsePhaseEvent = new ThreadLocal<>() {
             @Override
             public JFRPulsePhaseEvent initialValue() {
@@ -148,4 +149,16 @@ public final class JFRPulseLogger extends Logger {
         event.setInput(input);
         currentInputEvent.set(event);
     }
+
+    @Override
+    public void gpuTime(String name, long nanos) {
+        JFRGPUTimeEvent event = new JFRGPUTimeEvent();
+        if (!event.isEnabled()) {
+            return;
+        }
+        event.setPulseId(Thread.currentThread() == fxThread ? fxPulseNumber : renderPulseNumber);
+        event.setName(name);
+        event.setGpuTime(nanos);
+        event.commit();
+    }
 }
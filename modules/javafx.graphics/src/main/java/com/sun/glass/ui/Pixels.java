@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,9 @@ public abstract class Pixels {
     private final float scalex;
     private final float scaley;
 
+    // The rectangles that changed since the previous upload, see setDamage()
+    private int[] damage;
+
     protected Pixels(final int width, final int height, final ByteBuffer pixels) {
         this(width, height, pixels, 1.0f, 1.0f);
     }
@@ -134,6 +137,23 @@ public abstract class Pixels {
         this.scaley = scaley;
     }
 
+    /**
+     * Records which pixels changed since the Pixels previously uploaded to
+     * the same view, as consecutive x, y, width and height values. A view
+     * may then present only these rectangles. The default, {@code null},
+     * means that the whole image changed.
+     *
+     * The damage is set by the thread that fills the pixels, before they
+     * are handed over for upload.
+     */
+    public final void setDamage(int[] damage) {
+        this.damage = damage;
+    }
+
+    public final int[] getDamage() {
+        return this.damage;
+    }
+
     public final float getScaleX() {
         Application.checkEventThread();
         return this.scalex;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,10 @@ public abstract class Timer {
     private long ptr;
     private double period = UNSET_PERIOD;
 
+    // See notifyVsync()
+    private volatile long lastFrameTime;
+    private volatile long lastPresentationTime;
+
     protected abstract long _start(Runnable runnable);
     protected abstract long _start(Runnable runnable, int period);
     protected abstract void _stop(long timer);
@@ -155,6 +159,42 @@ public abstract class Timer {
     }
 
 
+    /**
+     * Called by a vsync-based timer on each frame of the display, instead of
+     * running the runnable directly. Both times are on the
+     * {@code System.nanoTime()} clock, or 0 if the platform does not know them.
+     *
+     * @param frameTime the time of the frame the timer ticks for
+     * @param presentationTime the time the display presented the latest
+     *        frame it reported back on
+     */
+    protected void notifyVsync(long frameTime, long presentationTime) {
+        if (frameTime != 0L) {
+            lastFrameTime = frameTime;
+        }
+        if (presentationTime != 0L) {
+            lastPresentationTime = presentationTime;
+        }
+        runnable.run();
+    }
+
+    /**
+     * Returns the {@code System.nanoTime()} of the frame that a vsync-based
+     * timer last ticked for, or 0 if it is not known.
+     */
+    public long getLastFrameTime() {
+        return lastFrameTime;
+    }
+
+    /**
+     * Returns the {@code System.nanoTime()} at which the display last
+     * presented a frame, as reported to a vsync-based timer, or 0 if the
+     * platform does not report it.
+     */
+    public long getLastPresentationTime() {
+        return lastPresentationTime;
+    }
+
     /**
      * Returns true if the timer is currently running
      * (convenience API: might not need it)
@@ -415,6 +415,9 @@ public abstract class View {
     private boolean isVisible = false;
     private boolean inFullscreen = false;
 
+    private boolean coalescedPointsEnabled = false; // read by native code
+    private int[] coalescedPoints;
+
     static final public class Capability {
         // we need these for native code
         @Native static final public int k3dKeyValue                     = 0;
@@ -540,6 +543,31 @@ public abstract class View {
         this.eventHandler = eventHandler;
     }
 
+    /**
+     * Platforms may merge several pointer motions into a single MOVE or
+     * DRAG event. When enabled, the positions merged into such an event can
+     * be retrieved with {@link #getCoalescedPoints()} while it is handled.
+     */
+    public void setCoalescedPointsEnabled(boolean enabled) {
+        Application.checkEventThread();
+        this.coalescedPointsEnabled = enabled;
+    }
+
+    public boolean isCoalescedPointsEnabled() {
+        Application.checkEventThread();
+        return this.coalescedPointsEnabled;
+    }
+
+    /**
+     * Returns the positions merged into the mouse event being handled, oldest
+     * first and ending with the position of the event itself, as x, y, xAbs,
+     * yAbs quadruplets; or null if the event was not coalesced.
+     */
+    public int[] getCoalescedPoints() {
+        Application.checkEventThread();
+        return this.coalescedPoints;
+    }
+
     protected boolean shouldHandleEvent() {
         // Don't send any more events if the application has shutdown
         if (Application.GetApplication() == null) {
@@ -964,11 +992,16 @@ public abstract class View {
             && handleNonClientMouseEvent(now, type, button, x, y, xAbs, yAbs, modifiers, clickCount);
 
         if (handled) {
+            coalescedPoints = null;
             return;
         }
 
-        handleMouseEvent(now, type, button, x, y, xAbs, yAbs,
-                         modifiers, isPopupTrigger, isSynthesized);
+        try {
+            handleMouseEvent(now, type, button, x, y, xAbs, yAbs,
+                             modifiers, isPopupTrigger, isSynthesized);
+        } finally {
+            coalescedPoints = null;
+        }
 
         if (type == MouseEvent.DRAG) {
             // Send the handleDragStart() only once per a drag gesture
@@ -981,6 +1014,11 @@ public abstract class View {
         }
     }
 
+    // Called right before the notifyMouse() of the coalesced event
+    protected void notifyCoalescedPoints(int[] points) {
+        this.coalescedPoints = points;
+    }
+
     // ------------- END OF MOUSE EVENTS -----------------
 
     protected void notifyScroll(int x, int y, int xAbs, int yAbs,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,7 @@ import com.sun.glass.ui.Size;
 import com.sun.glass.ui.Timer;
 import com.sun.glass.ui.View;
 import com.sun.glass.ui.Window;
+import com.sun.javafx.PlatformUtil;
 import com.sun.javafx.application.preferences.PreferenceMapping;
 import com.sun.javafx.util.Logging;
 import com.sun.glass.utils.NativeLibLoader;
@@ -147,7 +148,8 @@ final class GtkApplication extends Application implements
             overrideUIScale = -1.0f;
         }
 
-        int libraryToLoad = _queryLibrary(gtkVersion, gtkVersionVerbose);
+        int libraryToLoad = _queryLibrary(gtkVersion, gtkVersionVerbose,
+                                          PlatformUtil.useWayland());
 
         if (libraryToLoad == QUERY_NO_DISPLAY) {
             throw new UnsupportedOperationException("Unable to open DISPLAY");
@@ -184,7 +186,7 @@ final class GtkApplication extends Application implements
      * check the system and return an indication of which library to load
      *  return values are the QUERY_ constants
      */
-    private static native int _queryLibrary(int version, boolean verbose);
+    private static native int _queryLibrary(int version, boolean verbose, boolean wayland);
 
     private static native void _initGTK(int version, boolean verbose, float overrideUIScale);
 
@@ -218,8 +220,12 @@ final class GtkApplication extends Application implements
 
         final boolean disableGrab = (Boolean.getBoolean("sun.awt.disablegrab") ||
                Boolean.getBoolean("glass.disableGrab"));
+        // Present uploaded frames through cairo instead of MIT-SHM
+        final boolean disableXShm = Boolean.getBoolean("glass.disableXShm");
+        // Report every pointer motion instead of at most one per frame
+        final boolean disableMotionCoalescing = Boolean.getBoolean("glass.disableMotionCoalescing");
 
-        _init(eventProc, disableGrab);
+        _init(eventProc, disableGrab, disableXShm, disableMotionCoalescing);
     }
 
     @Override
@@ -261,7 +267,8 @@ final class GtkApplication extends Application implements
 
     private native void _terminateLoop();
 
-    private native void _init(long eventProc, boolean disableGrab);
+    private native void _init(long eventProc, boolean disableGrab, boolean disableXShm,
+                              boolean disableMotionCoalescing);
 
     private native void _runLoop(Runnable launchable, boolean noErrorTrap);
 
@@ -400,6 +407,11 @@ final class GtkApplication extends Application implements
     protected native int staticTimer_getMaxPeriod();
 
     @Override protected double staticScreen_getVideoRefreshPeriod() {
+        if (GtkTimer.frameClockEnabled) {
+            // The vsync timer follows the frame clock, this is only the
+            // nominal period it ticks at while no window is mapped
+            return 1000.0 / 60.0;
+        }
         return 0.0;     // indicate millisecond resolution
     }
 
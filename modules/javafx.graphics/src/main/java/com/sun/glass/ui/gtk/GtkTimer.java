@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,21 +28,36 @@ import com.sun.glass.ui.Timer;
 
 final class GtkTimer extends Timer{
 
+    /**
+     * Whether the vsync timer is available, ticking on the frame clock of
+     * the windows rather than on a fixed timeout
+     */
+    static final boolean frameClockEnabled =
+            !"false".equals(System.getProperty("glass.gtk.frameClock"));
+
     public GtkTimer(Runnable runnable) {
         super(runnable);
     }
 
     @Override protected long _start(Runnable runnable) {
-        throw new RuntimeException("vsync timer not supported");
+        if (!frameClockEnabled) {
+            throw new RuntimeException("vsync timer not supported");
+        }
+        return _startVsync();
     }
 
+    private native long _startVsync();
+
     @Override
     protected native long _start(Runnable runnable, int period);
 
     @Override
     protected native void _stop(long timer);
 
-    @Override protected void _pause(long timer) {}
-    @Override protected void _resume(long timer) {}
+    @Override
+    protected native void _pause(long timer);
+
+    @Override
+    protected native void _resume(long timer);
 
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@ package com.sun.glass.ui.gtk.screencast;
 import com.sun.glass.ui.Screen;
 
 import com.sun.javafx.geom.Rectangle;
+import java.nio.ByteBuffer;
 import java.util.List;
 import java.util.Set;
 import java.util.Timer;
@@ -50,6 +51,7 @@ public final class ScreencastHelper {
     private static final int DENIED = -11;
     private static final int OUT_OF_BOUNDS = -12;
     private static final int NO_STREAMS = -13;
+    private static final int NO_FRAME = -14;
 
     private static final int XDG_METHOD_SCREENCAST = 0;
     private static final int XDG_METHOD_REMOTE_DESKTOP = 1;
@@ -57,6 +59,7 @@ public final class ScreencastHelper {
     private static final int DELAY_BEFORE_SESSION_CLOSE = 2000;
 
     private static volatile TimerTask timerTask = null;
+    private static volatile boolean isStreaming = false;
     private static final Timer timerCloseSession
             = new Timer("auto-close screencast session", true);
 
@@ -100,6 +103,16 @@ public final class ScreencastHelper {
             String token
     );
 
+    private static native int startStreamImpl(
+            int x, int y, int width, int height,
+            int[] affectedScreensBoundsArray,
+            String token
+    );
+
+    private static native int getStreamFrameImpl(ByteBuffer buffer, int[] damage);
+
+    private static native void stopStreamImpl();
+
     public static int clipRound(final double coordinate) {
         final double newv = coordinate - 0.5;
         if (newv < Integer.MIN_VALUE) {
@@ -129,6 +142,12 @@ public final class ScreencastHelper {
     private static void timerCloseSessionRestart() {
         if (timerTask != null) {
             timerTask.cancel();
+            timerTask = null;
+        }
+
+        if (isStreaming) {
+            // the session stays open until the stream is stopped
+            return;
         }
 
         timerTask = new TimerTask() {
@@ -150,10 +169,7 @@ public final class ScreencastHelper {
 
         Rectangle captureArea = new Rectangle(x, y, width, height);
 
-        List<Rectangle> affectedScreenBounds = getSystemScreensBounds()
-                .stream()
-                .filter(r -> !captureArea.intersection(r).isEmpty())
-                .toList();
+        List<Rectangle> affectedScreenBounds = getAffectedScreensBounds(captureArea);
 
         if (SCREENCAST_DEBUG) {
             System.out.printf("// getRGBPixels in %s, affectedScreenBounds %s\n",
@@ -172,14 +188,7 @@ public final class ScreencastHelper {
         Set<TokenItem> tokensForRectangle =
                 TokenStorage.getTokens(affectedScreenBounds);
 
-        int[] affectedScreenBoundsArray = affectedScreenBounds
-                .stream()
-                .filter(r -> !captureArea.intersection(r).isEmpty())
-                .flatMapToInt(bounds -> IntStream.of(
-                        bounds.x, bounds.y,
-                        bounds.width, bounds.height
-                ))
-                .toArray();
+        int[] affectedScreenBoundsArray = toBoundsArray(affectedScreenBounds);
 
         for (TokenItem tokenItem : tokensForRectangle) {
             retVal = getRGBPixelsImpl(
@@ -210,6 +219,115 @@ public final class ScreencastHelper {
         debugReturnValue(retVal);
     }
 
+    private static List<Rectangle> getAffectedScreensBounds(Rectangle captureArea) {
+        return getSystemScreensBounds()
+                .stream()
+                .filter(r -> !captureArea.intersection(r).isEmpty())
+                .toList();
+    }
+
+    private static int[] toBoundsArray(List<Rectangle> screensBounds) {
+        return screensBounds
+                .stream()
+                .flatMapToInt(bounds -> IntStream.of(
+                        bounds.x, bounds.y,
+                        bounds.width, bounds.height
+                ))
+                .toArray();
+    }
+
+    /**
+     * Starts a continuous capture of the given screen area. Unlike
+     * {@link #getRGBPixels}, the PipeWire streams and the portal session
+     * stay open until {@link #stopStream()} is called, and frames are
+     * fetched with {@link #getStreamFrame} as they arrive.
+     *
+     * @return {@code true} if the stream has been started
+     */
+    public static synchronized boolean startStream(int x, int y, int width, int height) {
+        if (!IS_NATIVE_LOADED || width <= 0 || height <= 0) return false;
+
+        if (isStreaming) {
+            stopStream();
+        }
+
+        Rectangle captureArea = new Rectangle(x, y, width, height);
+        List<Rectangle> affectedScreenBounds = getAffectedScreensBounds(captureArea);
+
+        if (SCREENCAST_DEBUG) {
+            System.out.printf("// startStream in %s, affectedScreenBounds %s\n",
+                    captureArea, affectedScreenBounds);
+        }
+
+        if (affectedScreenBounds.isEmpty()) {
+            return false;
+        }
+
+        int[] affectedScreenBoundsArray = toBoundsArray(affectedScreenBounds);
+
+        int retVal = NO_STREAMS;
+        for (TokenItem tokenItem : TokenStorage.getTokens(affectedScreenBounds)) {
+            retVal = startStreamImpl(x, y, width, height,
+                    affectedScreenBoundsArray, tokenItem.token);
+
+            debugReturnValue(retVal);
+
+            if (retVal >= 0 || retVal == ERROR || retVal == DENIED) {
+                break;
+            } // else, try other tokens
+        }
+
+        if (retVal < 0 && retVal != ERROR && retVal != DENIED) {
+            // no token worked, show the system's permission request window
+            retVal = startStreamImpl(x, y, width, height,
+                    affectedScreenBoundsArray, null);
+            debugReturnValue(retVal);
+        }
+
+        isStreaming = retVal >= 0;
+        timerCloseSessionRestart();
+        return isStreaming;
+    }
+
+    /**
+     * Copies the newest frame of the stream into {@code buffer}, a direct
+     * buffer of at least {@code width * height * 4} bytes. The pixels are
+     * stored in BGRx byte order, row by row, and the alpha byte is
+     * undefined. The areas that changed since the previous frame are
+     * stored in {@code damage} as x, y, width, height quadruplets, relative
+     * to the stream area. If they do not fit, a single rectangle covering
+     * the whole area is reported.
+     *
+     * @return the number of damage rectangles, 0 if the frame did not
+     *         change, or -1 if there is no new frame or the stream failed
+     */
+    public static synchronized int getStreamFrame(ByteBuffer buffer, int[] damage) {
+        if (!isStreaming || buffer == null || !buffer.isDirect()) return -1;
+
+        int retVal = getStreamFrameImpl(buffer, damage);
+        if (retVal == NO_FRAME) {
+            return -1;
+        }
+        if (retVal < 0) {
+            debugReturnValue(retVal);
+            stopStream();
+            return -1;
+        }
+        return retVal;
+    }
+
+    /**
+     * Stops the stream started with {@link #startStream}. The session is
+     * closed after a delay, as with single captures.
+     */
+    public static synchronized void stopStream() {
+        if (!isStreaming) return;
+
+        stopStreamImpl();
+        isStreaming = false;
+        timerCloseSessionRestart();
+    }
+
     private static boolean debugReturnValue(int retVal) {
         if (retVal == DENIED) {
             if (SCREENCAST_DEBUG) {
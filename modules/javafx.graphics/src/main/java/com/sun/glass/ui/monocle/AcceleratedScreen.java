@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -155,21 +155,28 @@ public class AcceleratedScreen {
      */
     boolean initPlatformLibraries() throws UnsatisfiedLinkError{
         if (!initialized) {
-            glesLibraryHandle = ls.dlopen("libGLESv2.so",
-                    LinuxSystem.RTLD_LAZY | LinuxSystem.RTLD_GLOBAL);
-            if (glesLibraryHandle == 0l) {
-                throw new UnsatisfiedLinkError("Error loading libGLESv2.so");
-            }
-            eglLibraryHandle = ls.dlopen("libEGL.so",
-                    LinuxSystem.RTLD_LAZY | LinuxSystem.RTLD_GLOBAL);
-            if (eglLibraryHandle == 0l) {
-                throw new UnsatisfiedLinkError("Error loading libEGL.so");
-            }
+            // Desktop distributions only ship the unversioned names with
+            // the development packages
+            glesLibraryHandle = dlopen("libGLESv2.so", "libGLESv2.so.2");
+            eglLibraryHandle = dlopen("libEGL.so", "libEGL.so.1");
             initialized = true;
         }
         return true;
     }
 
+    private static long dlopen(String name, String versionedName) {
+        long handle = ls.dlopen(name,
+                LinuxSystem.RTLD_LAZY | LinuxSystem.RTLD_GLOBAL);
+        if (handle == 0l) {
+            handle = ls.dlopen(versionedName,
+                    LinuxSystem.RTLD_LAZY | LinuxSystem.RTLD_GLOBAL);
+        }
+        if (handle == 0l) {
+            throw new UnsatisfiedLinkError("Error loading " + name);
+        }
+        return handle;
+    }
+
     /** Return the GL library handle - for use in looking up native symbols
      *
      */
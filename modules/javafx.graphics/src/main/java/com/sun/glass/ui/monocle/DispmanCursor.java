@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,8 @@ class DispmanCursor extends NativeCursor {
     private static final int CURSOR_WIDTH = 16;
     private static final int CURSOR_HEIGHT = 16;
 
+    private int hotspotX;
+    private int hotspotY;
 
     private native void _initDispmanCursor(int cursorWidth, int cursorHeight);
     private native void _setVisible(boolean visible);
@@ -67,11 +69,13 @@ class DispmanCursor extends NativeCursor {
 
     @Override
     void setLocation(int x, int y) {
-        _setLocation(x, y);
+        _setLocation(x - hotspotX, y - hotspotY);
     }
 
     @Override
     void setHotSpot(int hotspotX, int hotspotY) {
+        this.hotspotX = hotspotX;
+        this.hotspotY = hotspotY;
     }
 
     @Override
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import java.nio.ByteBuffer;
+
+/**
+ * A dispmanx element that shows images, such as decoded video frames, on a
+ * layer of its own. The display hardware composes the element with the
+ * accelerated screen during scan-out, so the GPU does not have to draw the
+ * images into the JavaFX scene every frame.
+ * <p>
+ * An overlay on a layer below the accelerated screen, which is on layer
+ * {@code dispman.layer} (1 by default), shows through wherever the scene is
+ * transparent. An overlay on a higher layer covers the scene.</p>
+ */
+class DispmanOverlay {
+
+    /** 16-bit RGB with 5 bits of red, 6 of green and 5 of blue. */
+    static final int FORMAT_RGB565 = 1;
+
+    /**
+     * Planar YUV 4:2:0: the Y plane followed by the U and V planes at half
+     * the stride. The height of each plane is rounded up to a multiple of 16
+     * rows.
+     */
+    static final int FORMAT_YUV420 = 7;
+
+    /** 32-bit ARGB with 8 bits per component, in native byte order. */
+    static final int FORMAT_ARGB8888 = 43;
+
+    private final int width;
+    private final int height;
+    private long nativeHandle;
+
+    private native long _create(int displayID, int layer, int width, int height, int format);
+    private native void _setBounds(long nativeHandle, int x, int y, int width, int height);
+    private native boolean _setFrame(long nativeHandle, ByteBuffer frame, int stride);
+    private native void _dispose(long nativeHandle);
+
+    /**
+     * Creates an overlay for images of the given size and format. The overlay
+     * is empty until the first call to {@link #setFrame} and covers the
+     * screen until {@link #setBounds} is called.
+     *
+     * @param layer the dispmanx layer of the overlay
+     * @param width the width of the images in pixels
+     * @param height the height of the images in pixels
+     * @param format one of {@link #FORMAT_RGB565}, {@link #FORMAT_YUV420} or
+     * {@link #FORMAT_ARGB8888}
+     * @throws IllegalStateException if the overlay cannot be created
+     */
+    DispmanOverlay(int layer, int width, int height, int format) {
+        int displayID = Integer.getInteger("dispman.display", 0 /* LCD */);
+        this.width = width;
+        this.height = height;
+        nativeHandle = _create(displayID, layer, width, height, format);
+        if (nativeHandle == 0L) {
+            throw new IllegalStateException("Cannot create dispman overlay");
+        }
+    }
+
+    int getWidth() {
+        return width;
+    }
+
+    int getHeight() {
+        return height;
+    }
+
+    /**
+     * Places the overlay on the screen, scaling the images to fill the given
+     * rectangle.
+     */
+    synchronized void setBounds(int x, int y, int width, int height) {
+        if (nativeHandle != 0L) {
+            _setBounds(nativeHandle, x, y, width, height);
+        }
+    }
+
+    /**
+     * Shows the next image. The image is copied into the back one of two
+     * buffers, which then replaces the front buffer at the next vertical
+     * sync. This method returns once it has, so it also paces the caller to
+     * the refresh rate of the display.
+     *
+     * @param frame a direct buffer with the pixels of the image
+     * @param stride the number of bytes between the starts of two rows
+     * @return {@code true} if the image was shown; otherwise {@code false}
+     */
+    synchronized boolean setFrame(ByteBuffer frame, int stride) {
+        if (nativeHandle == 0L || !frame.isDirect()) {
+            return false;
+        }
+        return _setFrame(nativeHandle, frame, stride);
+    }
+
+    /**
+     * Removes the overlay from the screen and releases its buffers.
+     */
+    synchronized void dispose() {
+        if (nativeHandle != 0L) {
+            _dispose(nativeHandle);
+            nativeHandle = 0L;
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -146,6 +146,7 @@ class EGL {
     static final int EGL_DRAW = 0x3059;
     static final int EGL_READ = 0x305A;
     static final int EGL_CORE_NATIVE_ENGINE = 0x305B;
+    static final int EGL_PLATFORM_SURFACELESS_MESA = 0x31DD;
 
     private static EGL instance = new EGL();
 
@@ -196,6 +197,11 @@ class EGL {
             long nativeWindow,
             int[] attribs);
 
+    native long eglCreatePbufferSurface(
+            long eglDisplay,
+            long eglConfig,
+            int[] attribs);
+
     native boolean eglDestroyContext(long eglDisplay, long eglContext);
 
     native boolean eglGetConfigAttrib(
@@ -206,6 +212,14 @@ class EGL {
 
     native long eglGetDisplay(long nativeDisplay);
 
+    /**
+     * Gets a display of the given platform through eglGetPlatformDisplayEXT.
+     *
+     * @return the display, or EGL_NO_DISPLAY if the EGL implementation does
+     * not support the EGL_EXT_platform_base extension or the platform.
+     */
+    native long eglGetPlatformDisplay(int platform, long nativeDisplay);
+
     native int eglGetError();
 
     native boolean eglInitialize(long eglDisplay, int[] major,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -74,6 +74,12 @@ class EPDFrameBuffer {
      */
     private static final int ENOTTY = 25;
 
+    /**
+     * The longest time in nanoseconds between two updates for the second one
+     * to be treated as part of an animation.
+     */
+    private static final long ANIMATION_INTERVAL = 250_000_000L;
+
     private final PlatformLogger logger = Logging.getJavaFXLogger();
     private final EPDSettings settings;
     private final LinuxSystem system;
@@ -94,6 +100,12 @@ class EPDFrameBuffer {
 
     private int updateMarker;
     private int lastMarker;
+    private long lastSyncTime;
+
+    private int animatedX0;
+    private int animatedY0;
+    private int animatedX1;
+    private int animatedY1;
 
     /**
      * Creates a new {@code EPDFrameBuffer} for the given frame buffer device.
@@ -550,18 +562,111 @@ class EPDFrameBuffer {
     }
 
     /**
-     * Sends the updated contents of the Linux frame buffer to the EPDC driver,
+     * Sends the changed regions of the Linux frame buffer to the EPDC driver,
+     * one update per region or the entire visible region in one update,
      * optionally synchronizing with the driver by first waiting for the
      * previous update to complete.
      * <p>
+     * When an animation waveform mode is configured, updates that follow the
+     * previous one within {@link #ANIMATION_INTERVAL} use that faster waveform
+     * mode, and their bounds are recorded so that {@link #syncAnimated} can
+     * redraw them later in full quality.</p>
+     * <p>
      * <strong>This method is not thread safe</strong>, but it is invoked only
      * from the JavaFX Application Thread.</p>
+     *
+     * @param regions the x, y, width and height of each changed region, in
+     * screen coordinates, or {@code null} to update the entire screen; ignored
+     * when {@link EPDSettings#FULL_SCREEN_UPDATES} is set
+     * @param count the number of regions
+     */
+    void sync(int[] regions, int count) {
+        long now = System.nanoTime();
+        boolean animating = settings.animationWaveformMode != EPDSettings.ANIMATION_WAVEFORM_MODE_NONE
+                && lastSyncTime != 0 && now - lastSyncTime < ANIMATION_INTERVAL;
+        lastSyncTime = now;
+        int waveformMode = animating ? settings.animationWaveformMode : settings.waveformMode;
+        if (!settings.noWait) {
+            waitForUpdateComplete(lastMarker);
+        }
+        if (regions == null || settings.fullScreenUpdates) {
+            lastMarker = sendUpdate(syncUpdate, waveformMode);
+            if (animating) {
+                addAnimated(0, 0, xres, yres);
+            }
+            return;
+        }
+        updateData.setUpdateMode(updateData.p, EPDSystem.UPDATE_MODE_PARTIAL);
+        updateData.setTemp(updateData.p, EPDSystem.TEMP_USE_AMBIENT);
+        updateData.setFlags(updateData.p, settings.flags);
+        for (int i = 0; i < count * 4; i += 4) {
+            int x0 = Math.max(regions[i], 0);
+            int y0 = Math.max(regions[i + 1], 0);
+            int x1 = Math.min(regions[i] + regions[i + 2], xres);
+            int y1 = Math.min(regions[i + 1] + regions[i + 3], yres);
+            if (x0 < x1 && y0 < y1) {
+                updateData.setUpdateRegion(updateData.p, y0, x0, x1 - x0, y1 - y0);
+                lastMarker = sendUpdate(updateData, waveformMode);
+                if (animating) {
+                    addAnimated(x0, y0, x1, y1);
+                }
+            }
+        }
+    }
+
+    /**
+     * Indicates whether any region was last updated with the animation
+     * waveform mode.
+     *
+     * @return {@code true} if {@link #syncAnimated} has a region to redraw;
+     * otherwise {@code false}
+     */
+    boolean hasAnimated() {
+        return animatedX0 < animatedX1;
+    }
+
+    /**
+     * Redraws the bounds of all regions updated with the animation waveform
+     * mode since the last call, using the configured waveform mode and a full
+     * update to clear the ghosting left behind by the faster waveform.
+     * <p>
+     * <strong>This method is not thread safe</strong>. It is invoked from a
+     * timer thread, but only while holding the lock of the screen that also
+     * guards the calls to {@link #sync}.</p>
      */
-    void sync() {
+    void syncAnimated() {
+        if (!hasAnimated()) {
+            return;
+        }
         if (!settings.noWait) {
             waitForUpdateComplete(lastMarker);
         }
-        lastMarker = sendUpdate(syncUpdate, settings.waveformMode);
+        updateData.setUpdateRegion(updateData.p, animatedY0, animatedX0,
+                animatedX1 - animatedX0, animatedY1 - animatedY0);
+        updateData.setUpdateMode(updateData.p, EPDSystem.UPDATE_MODE_FULL);
+        updateData.setTemp(updateData.p, EPDSystem.TEMP_USE_AMBIENT);
+        updateData.setFlags(updateData.p, settings.flags);
+        lastMarker = sendUpdate(updateData, settings.waveformMode);
+        animatedX0 = animatedY0 = animatedX1 = animatedY1 = 0;
+        lastSyncTime = 0;
+    }
+
+    /**
+     * Adds a region to the bounds of the regions updated with the animation
+     * waveform mode.
+     */
+    private void addAnimated(int x0, int y0, int x1, int y1) {
+        if (hasAnimated()) {
+            animatedX0 = Math.min(animatedX0, x0);
+            animatedY0 = Math.min(animatedY0, y0);
+            animatedX1 = Math.max(animatedX1, x1);
+            animatedY1 = Math.max(animatedY1, y1);
+        } else {
+            animatedX0 = x0;
+            animatedY0 = y0;
+            animatedX1 = x1;
+            animatedY1 = y1;
+        }
     }
 
     /**
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,10 @@ import java.nio.file.FileSystems;
 import java.nio.file.Path;
 import java.nio.file.StandardOpenOption;
 import java.text.MessageFormat;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Timer;
+import java.util.TimerTask;
 
 /**
  * A native screen for an electrophoretic display, also called an e-paper
@@ -69,6 +73,18 @@ class EPDScreen implements NativeScreen {
      */
     private static final float SCALE = 1.0f;
 
+    /**
+     * The maximum number of regions sent as separate updates for one frame.
+     * When more regions changed, a single update covers all of them.
+     */
+    private static final int MAX_UPDATE_REGIONS = 4;
+
+    /**
+     * The delay in milliseconds after the last update of an animation before
+     * its region is redrawn in full quality.
+     */
+    private static final long ANIMATION_CLEANUP_DELAY = 500;
+
     private final PlatformLogger logger = Logging.getJavaFXLogger();
 
     private final String fbPath;
@@ -80,6 +96,28 @@ class EPDScreen implements NativeScreen {
     private final int height;
     private final int bitDepth;
 
+    /**
+     * The position, size and alpha of each upload in the current and previous
+     * frames, in the order received.
+     */
+    private ArrayList<int[]> uploads = new ArrayList<>();
+    private ArrayList<int[]> lastUploads = new ArrayList<>();
+
+    /**
+     * The last upload of the current frame until its damage is reported.
+     */
+    private int[] pendingUpload;
+
+    /**
+     * The changed regions of the current frame in screen coordinates, as
+     * consecutive x, y, width and height values.
+     */
+    private int[] damage = new int[MAX_UPDATE_REGIONS * 4];
+    private int damageCount;
+
+    private Timer cleanupTimer;
+    private TimerTask cleanupTask;
+
     private boolean isShutdown;
 
     /**
@@ -221,8 +259,117 @@ class EPDScreen implements NativeScreen {
         return fbDevice.getNativeHandle();
     }
 
+    /**
+     * Adds a changed region of the current frame, clipped to the screen.
+     */
+    private void addDamage(int x, int y, int w, int h) {
+        int x0 = Math.max(x, 0);
+        int y0 = Math.max(y, 0);
+        int x1 = Math.min(x + w, width);
+        int y1 = Math.min(y + h, height);
+        if (x0 >= x1 || y0 >= y1) {
+            return;
+        }
+        if (damageCount * 4 == damage.length) {
+            damage = Arrays.copyOf(damage, damage.length * 2);
+        }
+        int i = damageCount++ * 4;
+        damage[i] = x0;
+        damage[i + 1] = y0;
+        damage[i + 2] = x1 - x0;
+        damage[i + 3] = y1 - y0;
+    }
+
+    /**
+     * Marks all of the pending upload as changed if its damage was not
+     * reported.
+     */
+    private void flushPendingUpload() {
+        if (pendingUpload != null) {
+            addDamage(pendingUpload[0], pendingUpload[1], pendingUpload[2], pendingUpload[3]);
+            pendingUpload = null;
+        }
+    }
+
+    /**
+     * Merges the changed regions of the current frame: overlapping regions
+     * are replaced by their bounds, and if there are still more than
+     * {@link #MAX_UPDATE_REGIONS}, all of them are. Each region becomes a
+     * separate update, so fewer and larger regions are cheaper to send than
+     * many small ones, and the controller serializes overlapping updates.
+     */
+    private void mergeDamage() {
+        boolean merged = true;
+        while (merged) {
+            merged = false;
+            for (int i = 0; i < damageCount * 4 && !merged; i += 4) {
+                for (int j = i + 4; j < damageCount * 4 && !merged; j += 4) {
+                    if (damage[i] < damage[j] + damage[j + 2] && damage[j] < damage[i] + damage[i + 2]
+                            && damage[i + 1] < damage[j + 1] + damage[j + 3]
+                            && damage[j + 1] < damage[i + 1] + damage[i + 3]) {
+                        unionDamage(i, j);
+                        merged = true;
+                    }
+                }
+            }
+        }
+        while (damageCount > MAX_UPDATE_REGIONS) {
+            unionDamage(0, 4);
+        }
+    }
+
+    /**
+     * Replaces the changed region at index {@code i} with the bounds of it
+     * and the region at index {@code j > i}, then removes the latter.
+     */
+    private void unionDamage(int i, int j) {
+        int x0 = Math.min(damage[i], damage[j]);
+        int y0 = Math.min(damage[i + 1], damage[j + 1]);
+        int x1 = Math.max(damage[i] + damage[i + 2], damage[j] + damage[j + 2]);
+        int y1 = Math.max(damage[i + 1] + damage[i + 3], damage[j + 1] + damage[j + 3]);
+        damage[i] = x0;
+        damage[i + 1] = y0;
+        damage[i + 2] = x1 - x0;
+        damage[i + 3] = y1 - y0;
+        damageCount--;
+        System.arraycopy(damage, j + 4, damage, j, damageCount * 4 - j);
+    }
+
+    /**
+     * Schedules the redraw of the regions last updated with the animation
+     * waveform mode, replacing any redraw already scheduled, so that it runs
+     * only once the updates stop.
+     */
+    private void scheduleCleanup() {
+        if (cleanupTask != null) {
+            cleanupTask.cancel();
+            cleanupTask = null;
+        }
+        if (!fbDevice.hasAnimated()) {
+            return;
+        }
+        if (cleanupTimer == null) {
+            cleanupTimer = new Timer("EPD Cleanup", true);
+        }
+        cleanupTask = new TimerTask() {
+            @Override
+            public void run() {
+                synchronized (EPDScreen.this) {
+                    if (!isShutdown && cleanupTask == this) {
+                        cleanupTask = null;
+                        fbDevice.syncAnimated();
+                    }
+                }
+            }
+        };
+        cleanupTimer.schedule(cleanupTask, ANIMATION_CLEANUP_DELAY);
+    }
+
     @Override
     public synchronized void shutdown() {
+        if (cleanupTimer != null) {
+            cleanupTimer.cancel();
+        }
         close();
         isShutdown = true;
     }
@@ -230,14 +377,55 @@ class EPDScreen implements NativeScreen {
     @Override
     public synchronized void uploadPixels(Buffer b, int x, int y, int width, int height, float alpha) {
         pixels.composePixels(b, x, y, width, height, alpha);
+        flushPendingUpload();
+        pendingUpload = new int[] {x, y, width, height, Float.floatToIntBits(alpha)};
+        uploads.add(pendingUpload);
+    }
+
+    /**
+     * {@inheritDoc}
+     * <p>
+     * The damage is used only if the upload has the same position, size,
+     * alpha and order in the frame as in the previous frame, because the
+     * pixels around it may otherwise have changed as well.</p>
+     */
+    @Override
+    public synchronized void uploadDamage(int[] damage) {
+        int index = uploads.size() - 1;
+        if (pendingUpload != null && damage != null && index < lastUploads.size()
+                && Arrays.equals(lastUploads.get(index), pendingUpload)) {
+            for (int i = 0; i + 3 < damage.length; i += 4) {
+                addDamage(pendingUpload[0] + damage[i], pendingUpload[1] + damage[i + 1],
+                        damage[i + 2], damage[i + 3]);
+            }
+            pendingUpload = null;
+        }
     }
 
     @Override
     public synchronized void swapBuffers() {
         if (!isShutdown && pixels.hasReceivedData()) {
+            flushPendingUpload();
+            // Uploads that moved or went away leave their previous area changed
+            for (int i = 0; i < lastUploads.size(); i++) {
+                int[] last = lastUploads.get(i);
+                if (i >= uploads.size() || !Arrays.equals(last, uploads.get(i))) {
+                    addDamage(last[0], last[1], last[2], last[3]);
+                }
+            }
+            mergeDamage();
             writeBuffer();
-            fbDevice.sync();
+            if (damageCount > 0) {
+                fbDevice.sync(damage, damageCount);
+            }
+            scheduleCleanup();
             pixels.reset();
+
+            ArrayList<int[]> tmp = lastUploads;
+            lastUploads = uploads;
+            uploads = tmp;
+            uploads.clear();
+            damageCount = 0;
         }
     }
 
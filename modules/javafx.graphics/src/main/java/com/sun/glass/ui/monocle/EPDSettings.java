@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -116,6 +116,30 @@ class EPDSettings {
      * @implNote Corresponds to the {@code EPDC_FLAG_ENABLE_INVERSION} constant
      * in <i>linux/mxcfb.h</i>.
      */
+    /**
+     * Sets the waveform mode used for updates that follow the previous update
+     * in quick succession, as in an animation: 0 to use the waveform mode set
+     * by {@code monocle.epd.waveformMode} for all updates, 1 for
+     * black-and-white direct update (DU), or 4 for pure black-and-white
+     * animation (A2). The default is 0.
+     * <p>
+     * Once the updates stop, the region they covered is redrawn with the
+     * waveform mode set by {@code monocle.epd.waveformMode} to restore its
+     * levels of gray and clear any ghosting.</p>
+     */
+    private static final String ANIMATION_WAVEFORM_MODE = "monocle.epd.animationWaveformMode";
+
+    /**
+     * Indicates whether to update the entire screen each time instead of only
+     * the regions that changed: {@code true} to update the entire screen;
+     * otherwise {@code false}. The default is {@code false}.
+     * <p>
+     * Updating only the changed regions lets the controller run several
+     * smaller updates concurrently and leaves the rest of the panel
+     * untouched.</p>
+     */
+    private static final String FULL_SCREEN_UPDATES = "monocle.epd.fullScreenUpdates";
+
     private static final String FLAG_ENABLE_INVERSION = "monocle.epd.enableInversion";
 
     /**
@@ -164,6 +188,8 @@ class EPDSettings {
         Y8_INVERTED,
         NO_WAIT,
         WAVEFORM_MODE,
+        ANIMATION_WAVEFORM_MODE,
+        FULL_SCREEN_UPDATES,
         FLAG_ENABLE_INVERSION,
         FLAG_FORCE_MONOCHROME,
         FLAG_USE_DITHERING_Y1,
@@ -175,6 +201,12 @@ class EPDSettings {
     private static final int ROTATE_DEFAULT = EPDSystem.FB_ROTATE_UR;
     private static final int WAVEFORM_MODE_DEFAULT = EPDSystem.WAVEFORM_MODE_AUTO;
 
+    /**
+     * The animation waveform mode that disables the separate handling of
+     * animations.
+     */
+    static final int ANIMATION_WAVEFORM_MODE_NONE = 0;
+
     private static final int[] BITS_PER_PIXEL_PERMITTED = {
         Byte.SIZE,
         Short.SIZE,
@@ -196,6 +228,12 @@ class EPDSettings {
         EPDSystem.WAVEFORM_MODE_AUTO
     };
 
+    private static final int[] ANIMATION_WAVEFORM_MODES_PERMITTED = {
+        ANIMATION_WAVEFORM_MODE_NONE,
+        EPDSystem.WAVEFORM_MODE_DU,
+        EPDSystem.WAVEFORM_MODE_A2
+    };
+
     /**
      * Obtains a new instance of this class with the current values of the EPD
      * system properties.
@@ -219,6 +257,8 @@ class EPDSettings {
     final int rotate;
     final boolean noWait;
     final int waveformMode;
+    final int animationWaveformMode;
+    final boolean fullScreenUpdates;
     final int grayscale;
     final int flags;
     final boolean getWidthVisible;
@@ -243,6 +283,9 @@ class EPDSettings {
         rotate = getInteger(ROTATE, ROTATE_DEFAULT, ROTATIONS_PERMITTED);
         noWait = Boolean.getBoolean(NO_WAIT);
         waveformMode = getInteger(WAVEFORM_MODE, WAVEFORM_MODE_DEFAULT, WAVEFORM_MODES_PERMITTED);
+        animationWaveformMode = getInteger(ANIMATION_WAVEFORM_MODE, ANIMATION_WAVEFORM_MODE_NONE,
+                ANIMATION_WAVEFORM_MODES_PERMITTED);
+        fullScreenUpdates = Boolean.getBoolean(FULL_SCREEN_UPDATES);
 
         y8inverted = Boolean.getBoolean(Y8_INVERTED);
         if (bitsPerPixel == Byte.SIZE) {
@@ -295,10 +338,12 @@ class EPDSettings {
     @Override
     public String toString() {
         return MessageFormat.format("{0}[bitsPerPixel={1} rotate={2} "
-                + "noWait={3} waveformMode={4} grayscale={5} flags=0x{6} "
-                + "getWidthVisible={7}]",
+                + "noWait={3} waveformMode={4} animationWaveformMode={5} "
+                + "fullScreenUpdates={6} grayscale={7} flags=0x{8} "
+                + "getWidthVisible={9}]",
                 getClass().getName(), bitsPerPixel, rotate,
-                noWait, waveformMode, grayscale, Integer.toHexString(flags),
+                noWait, waveformMode, animationWaveformMode,
+                fullScreenUpdates, grayscale, Integer.toHexString(flags),
                 getWidthVisible);
     }
 }
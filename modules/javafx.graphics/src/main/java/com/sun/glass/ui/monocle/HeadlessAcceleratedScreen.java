@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * An AcceleratedScreen for the headless platform. Prism renders with OpenGL
+ * ES into an EGL pbuffer the size of the HeadlessScreen, on the surfaceless
+ * Mesa platform when it is available (which works on GPUs and llvmpipe
+ * without a display server) and on the default EGL display otherwise. Each
+ * frame is read back into the framebuffer of the screen, so that screen
+ * captures see what was rendered.
+ */
+class HeadlessAcceleratedScreen extends AcceleratedScreen {
+
+    // Index of GLPixelFormat.Attributes.ONSCREEN
+    private static final int ONSCREEN = 6;
+
+    private final EGL egl = EGL.getEGL();
+    private final HeadlessScreen screen;
+    private final ByteBuffer pixels;
+
+    HeadlessAcceleratedScreen(int[] attributes, HeadlessScreen screen)
+            throws GLException, UnsatisfiedLinkError {
+        this.screen = screen;
+        initPlatformLibraries();
+
+        String extensions = egl.eglQueryString(EGL.EGL_NO_DISPLAY, EGL.EGL_EXTENSIONS);
+        if (extensions != null && extensions.contains("EGL_MESA_platform_surfaceless")) {
+            eglDisplay = egl.eglGetPlatformDisplay(EGL.EGL_PLATFORM_SURFACELESS_MESA,
+                                                   EGL.EGL_DEFAULT_DISPLAY);
+        }
+        if (eglDisplay == EGL.EGL_NO_DISPLAY) {
+            eglDisplay = egl.eglGetDisplay(EGL.EGL_DEFAULT_DISPLAY);
+        }
+        if (eglDisplay == EGL.EGL_NO_DISPLAY) {
+            throw new GLException(egl.eglGetError(),
+                                  "Could not get EGL display");
+        }
+
+        int major[] = {0}, minor[] = {0};
+        if (!egl.eglInitialize(eglDisplay, major, minor)) {
+            throw new GLException(egl.eglGetError(),
+                                  "Error initializing EGL");
+        }
+        if (!egl.eglBindAPI(EGL.EGL_OPENGL_ES_API)) {
+            throw new GLException(egl.eglGetError(),
+                                  "Error binding OPENGL API");
+        }
+
+        // Choose a configuration that supports pbuffers
+        int[] pbufferAttributes = attributes.clone();
+        pbufferAttributes[ONSCREEN] = 0;
+        int configCount[] = {0};
+        if (!egl.eglChooseConfig(eglDisplay, pbufferAttributes, eglConfigs,
+                                 1, configCount) || configCount[0] == 0) {
+            throw new GLException(egl.eglGetError(),
+                                  "Error choosing EGL config");
+        }
+
+        int width = screen.getWidth();
+        int height = screen.getHeight();
+        eglSurface = egl.eglCreatePbufferSurface(eglDisplay, eglConfigs[0],
+                new int[] { EGL.EGL_WIDTH, width, EGL.EGL_HEIGHT, height, EGL.EGL_NONE });
+        if (eglSurface == EGL.EGL_NO_SURFACE) {
+            throw new GLException(egl.eglGetError(),
+                                  "Could not get EGL pbuffer surface");
+        }
+
+        eglContext = egl.eglCreateContext(eglDisplay, eglConfigs[0], 0, new int[] {});
+        if (eglContext == EGL.EGL_NO_CONTEXT) {
+            throw new GLException(egl.eglGetError(),
+                                  "Could not get EGL context");
+        }
+
+        pixels = ByteBuffer.allocateDirect(width * height * 4);
+        pixels.order(ByteOrder.nativeOrder());
+    }
+
+    @Override
+    public void enableRendering(boolean flag) {
+        if (flag) {
+            egl.eglMakeCurrent(eglDisplay, eglSurface, eglSurface,
+                               eglContext);
+        } else {
+            egl.eglMakeCurrent(eglDisplay, 0, 0, eglContext);
+        }
+    }
+
+    @Override
+    public boolean swapBuffers() {
+        synchronized (NativeScreen.framebufferSwapLock) {
+            if (!nReadPixels(getGLHandle(), screen.getWidth(), screen.getHeight(), pixels)) {
+                return false;
+            }
+            ByteBuffer fb = screen.getScreenCapture();
+            fb.clear();
+            pixels.clear();
+            fb.put(pixels);
+            fb.clear();
+        }
+        // A pbuffer has no front buffer, so there is nothing to swap
+        return true;
+    }
+
+    /**
+     * Reads the pixels of the current surface into a buffer in the
+     * BYTE_BGRA_PRE format of the HeadlessScreen, top row first.
+     */
+    private static native boolean nReadPixels(long glesLibraryHandle,
+                                              int width, int height,
+                                              ByteBuffer pixels);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,10 @@ package com.sun.glass.ui.monocle;
 
 class HeadlessPlatform extends NativePlatform {
 
+    // Render with OpenGL ES into an offscreen EGL surface instead of
+    // failing over to the software pipeline
+    private static final boolean useEGL = Boolean.getBoolean("headless.egl");
+
     @Override
     protected InputDeviceRegistry createInputDeviceRegistry() {
         // use of a LinuxInputDeviceRegistry lets us simulate
@@ -44,4 +48,17 @@ class HeadlessPlatform extends NativePlatform {
         return new HeadlessScreen();
     }
 
+    @Override
+    public synchronized AcceleratedScreen getAcceleratedScreen(int[] attributes)
+            throws GLException, UnsatisfiedLinkError {
+        if (!useEGL) {
+            return super.getAcceleratedScreen(attributes);
+        }
+        if (accScreen == null) {
+            accScreen = new HeadlessAcceleratedScreen(attributes,
+                                                      (HeadlessScreen) getScreen());
+        }
+        return accScreen;
+    }
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -88,38 +88,48 @@ class LinuxEventBuffer {
     }
 
     /**
-     * Adds a raw Linux event to the buffer. Blocks if the buffer is full.
-     * Checks whether this is a SYN SYN_REPORT event terminator.
+     * Adds raw Linux events to the buffer, up to and including the next
+     * SYN SYN_REPORT event terminator. Blocks if the buffer is full.
      *
-     * @param event A ByteBuffer containing the event to be added.
-     * @return true if the event was "SYN SYN_REPORT", false otherwise
+     * @param events A ByteBuffer containing whole events between its position
+     *               and its limit. The position is advanced past the events
+     *               added.
+     * @return true if the last event added was "SYN SYN_REPORT", false otherwise
      * @throws InterruptedException if our thread was interrupted while waiting
      *                              for the buffer to empty.
      */
-    synchronized boolean put(ByteBuffer event) throws
+    synchronized boolean put(ByteBuffer events) throws
             InterruptedException {
-        boolean isSync = event.getShort(eventStruct.getTypeIndex()) == 0
-                && event.getInt(eventStruct.getValueIndex()) == 0;
-        while (bb.limit() - bb.position() < event.limit()) {
-            // Block if bb is full. This should be the
-            // only time this thread waits for anything
-            // except for more event lines.
+        final int eventSize = eventStruct.getSize();
+        final int limit = events.limit();
+        boolean isSync = false;
+        while (!isSync && limit - events.position() >= eventSize) {
+            int index = events.position();
+            isSync = events.getShort(index + eventStruct.getTypeIndex()) == 0
+                    && events.getInt(index + eventStruct.getValueIndex()) == 0;
+            while (bb.limit() - bb.position() < eventSize) {
+                // Block if bb is full. This should be the
+                // only time this thread waits for anything
+                // except for more event lines.
+                if (MonocleSettings.settings.traceEventsVerbose) {
+                    MonocleTrace.traceEvent(
+                            "Event buffer %s is full, waiting for some space to become available",
+                            bb);
+                    // wait for half the space to be available, to avoid excessive context switching?
+                }
+                wait();
+            }
+            if (isSync) {
+                positionOfLastSync = bb.position();
+            }
+            events.limit(index + eventSize);
+            bb.put(events);
+            events.limit(limit);
             if (MonocleSettings.settings.traceEventsVerbose) {
-                MonocleTrace.traceEvent(
-                        "Event buffer %s is full, waiting for some space to become available",
-                        bb);
-                // wait for half the space to be available, to avoid excessive context switching?
+                int bbIndex = bb.position() - eventSize;
+                MonocleTrace.traceEvent("Read %s [index=%d]",
+                                        getEventDescription(bbIndex), bbIndex);
             }
-            wait();
-        }
-        if (isSync) {
-            positionOfLastSync = bb.position();
-        }
-        bb.put(event);
-        if (MonocleSettings.settings.traceEventsVerbose) {
-            int index = bb.position() - eventStruct.getSize();
-            MonocleTrace.traceEvent("Read %s [index=%d]",
-                                    getEventDescription(index), index);
         }
         return isSync;
     }
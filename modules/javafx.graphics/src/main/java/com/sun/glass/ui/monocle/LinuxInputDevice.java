@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -62,6 +62,11 @@ class LinuxInputDevice implements Runnable, InputDevice {
     private RunnableProcessor runnableProcessor;
     private EventProcessor processor = new EventProcessor();
     private final LinuxEventBuffer buffer;
+    /**
+     * The number of event lines read from the device in one system call.
+     * A multi-touch frame with several contacts is typically tens of lines.
+     */
+    private static final int EVENTS_PER_READ = 64;
     private Map<String,String> uevent;
     private static LinuxSystem system = LinuxSystem.getLinuxSystem();
 
@@ -78,7 +83,7 @@ class LinuxInputDevice implements Runnable, InputDevice {
             File sysPath,
             Map<String, String> udevManifest) throws IOException {
         this.buffer = new LinuxEventBuffer(LinuxArch.getBits());
-        this.event = ByteBuffer.allocateDirect(buffer.getEventSize());
+        this.event = ByteBuffer.allocateDirect(buffer.getEventSize() * EVENTS_PER_READ);
         this.devNode = devNode;
         this.sysPath = sysPath;
         this.udevManifest = udevManifest;
@@ -112,7 +117,7 @@ class LinuxInputDevice implements Runnable, InputDevice {
             Map<String, String> udevManifest,
             Map<String, String> uevent) {
         this.buffer = new LinuxEventBuffer(32);
-        this.event = ByteBuffer.allocateDirect(buffer.getEventSize());
+        this.event = ByteBuffer.allocateDirect(buffer.getEventSize() * EVENTS_PER_READ);
         this.capabilities = capabilities;
         this.absCaps = absCaps;
         this.in = in;
@@ -146,18 +151,32 @@ class LinuxInputDevice implements Runnable, InputDevice {
             System.err.println("Error: no input processor set on " + devNode);
             return;
         }
+        final int eventSize = buffer.getEventSize();
         while (true) {
             try {
                 readToEventBuffer();
-                if (event.position() == event.limit()) {
-                    event.flip();
+                // A read from an input device returns as many whole event
+                // lines as are available, so that a complete frame is
+                // usually handed over at once. Only a simulated channel
+                // can leave a partial event line to be completed later.
+                int length = event.position();
+                int whole = length - length % eventSize;
+                if (whole > 0) {
+                    event.position(0);
+                    event.limit(whole);
                     synchronized (buffer) {
-                        if (buffer.put(event) && !processor.scheduled) {
-                            runnableProcessor.invokeLater(processor);
-                            processor.scheduled = true;
+                        // Schedule the processor as soon as a frame is
+                        // complete, so that it drains the buffer in case
+                        // the rest of the events have to wait for space.
+                        while (event.hasRemaining()) {
+                            if (buffer.put(event) && !processor.scheduled) {
+                                runnableProcessor.invokeLater(processor);
+                                processor.scheduled = true;
+                            }
                         }
                     }
-                    event.rewind();
+                    event.limit(length);
+                    event.compact();
                 }
             } catch (IOException | InterruptedException e) {
                 // the device is disconnected
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -96,6 +96,7 @@ final class MonocleView extends View {
                                 x + window.getX(), y + window.getY(),
                                 pixels.getWidth(), pixels.getHeight(),
                                 window.getAlpha());
+            screen.uploadDamage(pixels.getDamage());
         }
     }
 
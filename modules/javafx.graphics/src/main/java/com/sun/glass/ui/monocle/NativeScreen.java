@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -97,6 +97,18 @@ public interface NativeScreen {
     void uploadPixels(Buffer b,
                              int x, int y, int width, int height, float alpha);
 
+    /** Reports which parts of the pixel data passed to the preceding call to
+     * uploadPixels changed since the previous upload of the same view. Screens
+     * that can refresh part of the display use this to limit the refresh.
+     * Called on the JavaFX application thread.
+     *
+     * @param damage The X offset, Y offset, width and height of each changed
+     *               rectangle, relative to the pixel data, or null if all of
+     *               the pixel data may have changed
+     */
+    default void uploadDamage(int[] damage) {
+    }
+
     /**
      * Called on the JavaFX application thread when pixel data for all windows
      * has been uploaded.
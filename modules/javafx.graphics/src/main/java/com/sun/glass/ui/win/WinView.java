@@ -86,10 +86,15 @@ final class WinView extends View {
     @Override native protected void _scheduleRepaint(long ptr);
     @Override native protected void _begin(long ptr);
     @Override native protected void _end(long ptr);
-    @Override native protected void _uploadPixels(long ptr, Pixels pixels);
     @Override native protected boolean _enterFullscreen(long ptr, boolean animate, boolean keepRatio, boolean hideCursor);
     @Override native protected void _exitFullscreen(long ptr, boolean animate);
 
+    @Override
+    protected void _uploadPixels(long ptr, Pixels pixels) {
+        _uploadPixelsImpl(ptr, pixels, pixels.getDamage());
+    }
+    native private void _uploadPixelsImpl(long ptr, Pixels pixels, int[] damage);
+
     @Override
     protected void notifyResize(int width, int height) {
         super.notifyResize(width, height);
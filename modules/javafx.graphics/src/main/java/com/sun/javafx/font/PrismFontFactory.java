@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,6 +59,7 @@ public abstract class PrismFontFactory implements FontFactory {
     private static float fontSizeLimit = 80f;
 
     private static boolean lcdEnabled;
+    private static boolean prefetchFonts;
     private static float lcdContrast = -1;
     private static String jreFontDir;
     private static final String jreDefaultFont   = "Lucida Sans Regular";
@@ -143,6 +144,12 @@ public abstract class PrismFontFactory implements FontFactory {
         }
 
         cacheLayoutSize = tempCacheLayoutSize[0];
+
+        /* Enumerating the installed fonts can take seconds on systems
+         * with many fonts, so by default it is started in the background
+         * as soon as the factory exists rather than on the first lookup.
+         */
+        prefetchFonts = !"false".equals(System.getProperty("prism.prefetchfonts"));
     }
 
     private static String getJDKFontDir() {
@@ -187,6 +194,9 @@ public abstract class PrismFontFactory implements FontFactory {
         if (theFontFactory == null) {
             throw new InternalError("cannot load font factory: "+ factoryClass);
         }
+        if (prefetchFonts) {
+            theFontFactory.startFontPrefetch();
+        }
         return theFontFactory;
     }
 
@@ -1710,6 +1720,36 @@ public abstract class PrismFontFactory implements FontFactory {
         return fontToFileMap;
     }
 
+    /*
+     * Builds the font name maps, and on Linux the fontconfig logical font
+     * and fallback lists, on a daemon thread. getFullNameToFileMap() is
+     * synchronized, so a lookup made before the thread has finished just
+     * waits for it instead of enumerating the fonts a second time.
+     */
+    private void startFontPrefetch() {
+        Thread prefetch = new Thread(() -> {
+            long t0 = debugFonts ? System.nanoTime() : 0;
+            try {
+                getFullNameToFileMap();
+                if (isLinux) {
+                    FontConfigManager.getDefaultFontPath();
+                }
+            } catch (Throwable t) {
+                // The maps are built again on demand by the first lookup.
+                if (debugFonts) {
+                    System.err.println("Font prefetch failed: " + t);
+                }
+            }
+            if (debugFonts) {
+                System.err.println("Font prefetch took " +
+                                   ((System.nanoTime() - t0) / 1000000) + "ms.");
+            }
+        }, "Font Prefetch");
+        prefetch.setDaemon(true);
+        prefetch.setContextClassLoader(null);
+        prefetch.start();
+    }
+
     private static class TTFilter implements FilenameFilter {
         @Override
         public boolean accept(File dir,String name) {
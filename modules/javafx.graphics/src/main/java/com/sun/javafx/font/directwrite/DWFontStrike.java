@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,10 +78,12 @@ class DWFontStrike extends PrismFontStrike<DWFontFile> {
 
     @Override
     public int getQuantizedPosition(Point2D point) {
-        if (SUBPIXEL_ON && (matrix == null || SUBPIXEL_NATIVE)) {
+        if (SUBPIXEL_ON && (matrix == null || SUBPIXEL_NATIVE || isScale())) {
             /* Using DirectWrite to produce subpixel glyph masks for grayscale
              * text and (by default) let Prism produce subpixel glyphs for LCD
              * using shaders (thus, saving texture and memory).
+             * Text on a screen with a fractional scale has a scale matrix;
+             * the mask is offset in device space, so it is positioned too.
              */
             if (getAAMode() == FontResource.AA_GREYSCALE || SUBPIXEL_NATIVE) {
                 float subPixel = point.x;
@@ -111,6 +113,10 @@ class DWFontStrike extends PrismFontStrike<DWFontFile> {
         return super.getQuantizedPosition(point);
     }
 
+    private boolean isScale() {
+        return matrix != null && matrix.m12 == 0 && matrix.m21 == 0;
+    }
+
     IDWriteFontFace getFontFace() {
         DWFontFile fontResource = getFontResource();
         return fontResource.getFontFace();
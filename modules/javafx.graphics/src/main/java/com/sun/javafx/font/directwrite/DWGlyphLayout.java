@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -365,30 +365,50 @@ public class DWGlyphLayout extends GlyphLayout {
                 /* Use renderer to produce glyph information */
                 layout.Draw(0, renderer, 0, 0);
 
-                /* Read data from renderer */
+                /* Read data from renderer, all runs at once */
                 int glyphCount = renderer.GetTotalGlyphCount();
+                int runCount = renderer.GetRunCount();
                 int[] glyphs = new int[glyphCount];
                 float[] advances = new float[glyphCount];
                 float[] offsets = new float[glyphCount * 2];
                 short[] clusterMap = new short[length];
+                long[] faces = new long[runCount];
+                int[] runLengths = new int[runCount * 2];
+                if (renderer.GetRuns(faces, runLengths, glyphs, advances,
+                                     offsets, clusterMap) != runCount) {
+                    runCount = 0;
+                }
+                renderer.Release();
+
                 int glyphStart = 0;
-                int textStart = 0;
-                while (renderer.Next()) {
-                    IDWriteFontFace fallback = renderer.GetFontFace();
-                    int slot = getFontSlot(fallback, composite, fullName, baseSlot);
-                    if (slot >= 0) {
-                        renderer.GetGlyphIndices(glyphs, glyphStart, slot << 24);
-                        renderer.GetGlyphOffsets(offsets, glyphStart * 2);
+                long lastFace = 0;
+                int slot = -1;
+                for (int r = 0; r < runCount; r++) {
+                    int runGlyphCount = runLengths[r * 2];
+                    /* Consecutive runs usually share the same face */
+                    if (r == 0 || faces[r] != lastFace) {
+                        IDWriteFontFace fallback = faces[r] != 0 ? new IDWriteFontFace(faces[r]) : null;
+                        slot = getFontSlot(fallback, composite, fullName, baseSlot);
+                        lastFace = faces[r];
                     }
-                    if (size > 0) {
-                        /* Keep advances to zero if font size is zero */
-                        renderer.GetGlyphAdvances(advances, glyphStart);
+                    int glyphEnd = glyphStart + runGlyphCount;
+                    if (slot >= 0) {
+                        int slotMask = slot << 24;
+                        for (int i = glyphStart; i < glyphEnd; i++) {
+                            glyphs[i] |= slotMask;
+                        }
+                    } else {
+                        for (int i = glyphStart; i < glyphEnd; i++) {
+                            glyphs[i] = 0;
+                            offsets[i * 2] = offsets[i * 2 + 1] = 0;
+                        }
                     }
-                    renderer.GetClusterMap(clusterMap, textStart, glyphStart);
-                    glyphStart += renderer.GetGlyphCount();
-                    textStart += renderer.GetLength();
+                    glyphStart = glyphEnd;
+                }
+                if (size <= 0) {
+                    /* Keep advances to zero if font size is zero */
+                    Arrays.fill(advances, 0);
                 }
-                renderer.Release();
 
                 /* Converting data to be used by the JavaFX run */
                 boolean rtl = !run.isLeftToRight();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,6 +51,17 @@ class JFXTextRenderer extends IUnknown {
         return OS.JFXTextRendererGetTotalGlyphCount(ptr);
     }
 
+    int GetRunCount() {
+        return OS.JFXTextRendererGetRunCount(ptr);
+    }
+
+    /* Reads all the runs in one call, see JFXTextRenderer::CopyRuns() */
+    int GetRuns(long[] faces, int[] runLengths, int[] glyphs,
+                float[] advances, float[] offsets, short[] clusterMap) {
+        return OS.JFXTextRendererGetRuns(ptr, faces, runLengths, glyphs,
+                                         advances, offsets, clusterMap);
+    }
+
     IDWriteFontFace GetFontFace() {
         long result = OS.JFXTextRendererGetFontFace(ptr);
         return result != 0 ? new IDWriteFontFace(result) : null;
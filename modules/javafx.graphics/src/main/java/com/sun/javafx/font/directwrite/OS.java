@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -213,6 +213,10 @@ class OS {
     static final native int JFXTextRendererGetLength(long ptr);
     static final native int JFXTextRendererGetGlyphCount(long ptr);
     static final native int JFXTextRendererGetTotalGlyphCount(long ptr);
+    static final native int JFXTextRendererGetRunCount(long ptr);
+    static final native int JFXTextRendererGetRuns(long ptr, long[] faces, int[] runLengths,
+                                                   int[] glyphs, float[] advances,
+                                                   float[] offsets, short[] clusterMap);
     static final native long JFXTextRendererGetFontFace(long ptr);
     static final native int JFXTextRendererGetGlyphIndices(long ptr, int[] glyphs, int start, int slot);
     static final native int JFXTextRendererGetGlyphAdvances(long ptr, float[] advances, int start);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -132,8 +132,10 @@ class FTFontFile extends PrismFontFile {
 
         int flags = OSFreetype.FT_LOAD_RENDER | OSFreetype.FT_LOAD_NO_HINTING | OSFreetype.FT_LOAD_NO_BITMAP;
         FT_Matrix matrix = strike.matrix;
-        if (matrix != null) {
-            OSFreetype.FT_Set_Transform(face, matrix, 0, 0);
+        /* A subpixel position moves the outline right, in 26.6 device units */
+        int deltaX = glyph.subPixel * 64 / FTFontStrike.SUBPIXEL_POSITIONS;
+        if (matrix != null || deltaX != 0) {
+            OSFreetype.FT_Set_Transform(face, matrix, deltaX, 0);
         } else {
             flags |= OSFreetype.FT_LOAD_IGNORE_TRANSFORM;
         }
@@ -145,6 +147,10 @@ class FTFontFile extends PrismFontFile {
 
         int glyphCode = glyph.getGlyphCode();
         int error = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
+        if (deltaX != 0) {
+            /* Other loads from this face expect no delta */
+            OSFreetype.FT_Set_Transform(face, matrix, 0, 0);
+        }
         if (error != 0) {
             if (PrismFontFactory.debugFonts) {
                 System.err.println("FT_Load_Glyph failed " + error +
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,15 +26,26 @@
 package com.sun.javafx.font.freetype;
 
 import com.sun.javafx.font.DisposerRecord;
+import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrikeDesc;
 import com.sun.javafx.font.Glyph;
 import com.sun.javafx.font.PrismFontFactory;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
+import com.sun.javafx.geom.Point2D;
 import com.sun.javafx.geom.transform.BaseTransform;
 
 class FTFontStrike extends PrismFontStrike<FTFontFile> {
     FT_Matrix matrix;
+    /* Grayscale glyphs are rendered by Freetype at quarter pixel positions,
+     * LCD glyphs are positioned at a third of a pixel by Prism.
+     */
+    static final int SUBPIXEL_POSITIONS = 4;
+    private static final boolean SUBPIXEL;
+    static {
+        int mode = PrismFontFactory.getFontFactory().getSubPixelMode();
+        SUBPIXEL = (mode & PrismFontFactory.SUB_PIXEL_ON) != 0;
+    }
 
     protected FTFontStrike(FTFontFile fontResource, float size,
                               BaseTransform tx, int aaMode,
@@ -67,6 +78,26 @@ class FTFontStrike extends PrismFontStrike<FTFontFile> {
         return null;
     }
 
+    @Override
+    public int getQuantizedPosition(Point2D point) {
+        /* Positions are in device space, so text drawn at a fractional
+         * screen scale keeps its advances instead of snapping every glyph
+         * to a whole pixel.
+         */
+        if (SUBPIXEL && !drawShapes && getAAMode() == FontResource.AA_GREYSCALE) {
+            float x = (float)Math.floor(point.x);
+            int subPixel = Math.round((point.x - x) * SUBPIXEL_POSITIONS);
+            if (subPixel == SUBPIXEL_POSITIONS) {
+                x += 1;
+                subPixel = 0;
+            }
+            point.x = x;
+            point.y = Math.round(point.y);
+            return subPixel;
+        }
+        return super.getQuantizedPosition(point);
+    }
+
     @Override
     protected Glyph createGlyph(int glyphCode) {
         return new FTGlyph(this, glyphCode, drawShapes);
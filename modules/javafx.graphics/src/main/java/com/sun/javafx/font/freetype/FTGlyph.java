@@ -40,10 +40,24 @@ class FTGlyph implements Glyph {
     float advanceY;
     float userAdvance;
     boolean lcd;
+    /* The subpixel position this glyph is rendered at, see
+     * FTFontStrike.getQuantizedPosition() */
+    final int subPixel;
+
+    /* The glyphs rendered at the other subpixel positions, created on
+     * demand, and the one the mask and bounds are currently returned for.
+     */
+    private FTGlyph[] subPixelGlyphs;
+    private FTGlyph selected = this;
 
     FTGlyph(FTFontStrike strike, int glyphCode, boolean drawAsShape) {
+        this(strike, glyphCode, 0);
+    }
+
+    private FTGlyph(FTFontStrike strike, int glyphCode, int subPixel) {
         this.strike = strike;
         this.glyphCode = glyphCode;
+        this.subPixel = subPixel;
     }
 
     @Override
@@ -77,14 +91,27 @@ class FTGlyph implements Glyph {
 
     @Override
     public byte[] getPixelData() {
+        selected = this;
         init();
         return buffer;
     }
 
     @Override
     public byte[] getPixelData(int subPixel) {
-        init();
-        return buffer;
+        if (subPixel == 0) {
+            return getPixelData();
+        }
+        if (subPixelGlyphs == null) {
+            subPixelGlyphs = new FTGlyph[FTFontStrike.SUBPIXEL_POSITIONS];
+        }
+        FTGlyph glyph = subPixelGlyphs[subPixel];
+        if (glyph == null) {
+            glyph = new FTGlyph(strike, glyphCode, subPixel);
+            subPixelGlyphs[subPixel] = glyph;
+        }
+        selected = glyph;
+        glyph.init();
+        return glyph.buffer;
     }
 
     @Override
@@ -101,27 +128,31 @@ class FTGlyph implements Glyph {
 
     @Override
     public int getWidth() {
-        init();
+        FTGlyph glyph = selected;
+        glyph.init();
         /* Note: In Freetype the width is byte based */
-        return bitmap != null ? bitmap.width : 0;
+        return glyph.bitmap != null ? glyph.bitmap.width : 0;
     }
 
     @Override
     public int getHeight() {
-        init();
-        return bitmap != null ? bitmap.rows : 0;
+        FTGlyph glyph = selected;
+        glyph.init();
+        return glyph.bitmap != null ? glyph.bitmap.rows : 0;
     }
 
     @Override
     public int getOriginX() {
-        init();
-        return bitmap_left;
+        FTGlyph glyph = selected;
+        glyph.init();
+        return glyph.bitmap_left;
     }
 
     @Override
     public int getOriginY() {
-        init();
-        return -bitmap_top; /* Inverted coordinates system */
+        FTGlyph glyph = selected;
+        glyph.init();
+        return -glyph.bitmap_top; /* Inverted coordinates system */
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.javafx.iio;
 
 import java.io.IOException;
 import java.io.InputStream;
+import java.nio.ByteBuffer;
 
 /**
  * A factory which creates a loader for images stored in a given format.
@@ -50,4 +51,30 @@ public interface ImageLoaderFactory {
      * @throws <IOException> if there is an error creating the loader.
      */
     ImageLoader createImageLoader(InputStream input) throws IOException;
+
+    /**
+     * Returns whether this factory can create loaders that decode an image
+     * held in memory, see {@link #createImageLoader(ByteBuffer)}.
+     *
+     * @return true if this factory can load images from a buffer.
+     */
+    default boolean canLoadFromBuffer() {
+        return false;
+    }
+
+    /**
+     * Creates a loader for an image held in the remaining bytes of the
+     * specified direct buffer, which must start with the signature for the
+     * format handled by this factory. The loader reads the buffer directly
+     * instead of pulling the data through a stream.
+     *
+     * @param input a direct buffer containing an image in the supported format.
+     * @return a loader capable of decoding the supplied buffer into an image.
+     * @throws <IOException> if there is an error creating the loader.
+     * @throws UnsupportedOperationException if {@link #canLoadFromBuffer()}
+     * returns false.
+     */
+    default ImageLoader createImageLoader(ByteBuffer input) throws IOException {
+        throw new UnsupportedOperationException();
+    }
 }
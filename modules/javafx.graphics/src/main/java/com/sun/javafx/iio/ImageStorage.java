@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@ import com.sun.javafx.iio.gif.GIFImageLoaderFactory;
 import com.sun.javafx.iio.ios.IosImageLoaderFactory;
 import com.sun.javafx.iio.jpeg.JPEGImageLoaderFactory;
 import com.sun.javafx.iio.png.PNGImageLoaderFactory;
+import com.sun.javafx.iio.wic.WICImageLoaderFactory;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.util.DataURI;
 import com.sun.javafx.util.Logging;
@@ -40,9 +41,12 @@ import com.sun.javafx.util.Logging;
 import java.io.BufferedInputStream;
 import java.io.ByteArrayInputStream;
 import java.io.EOFException;
+import java.io.FileInputStream;
 import java.io.IOException;
 import java.io.InputStream;
 import java.io.SequenceInputStream;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.Map.Entry;
@@ -184,6 +188,19 @@ public class ImageStorage {
 
     private static final boolean isIOS = PlatformUtil.isIOS();
 
+    /**
+     * Whether JPEG and PNG images are decoded by the Windows Imaging
+     * Component, with the built-in loaders used for images it can't read.
+     */
+    private static final boolean useWIC =
+            PlatformUtil.isWindows() && Boolean.getBoolean("javafx.iio.wic");
+
+    /**
+     * Largest image file which is read into a direct buffer for loaders
+     * that can decode from memory. Larger files are streamed.
+     */
+    private static final long MAX_BUFFERED_FILE_SIZE = 32 * 1024 * 1024;
+
     private static class InstanceHolder {
         static final ImageStorage INSTANCE = new ImageStorage();
     }
@@ -202,8 +219,10 @@ public class ImageStorage {
         } else {
             loaderFactories = new ImageLoaderFactory[]{
                 GIFImageLoaderFactory.getInstance(),
-                JPEGImageLoaderFactory.getInstance(),
-                PNGImageLoaderFactory.getInstance(),
+                useWIC ? new WICImageLoaderFactory(JPEGImageLoaderFactory.getInstance())
+                       : JPEGImageLoaderFactory.getInstance(),
+                useWIC ? new WICImageLoaderFactory(PNGImageLoaderFactory.getInstance())
+                       : PNGImageLoaderFactory.getInstance(),
                 BMPImageLoaderFactory.getInstance()
                 // Note: append ImageLoadFactory for any new format here.
             };
@@ -563,6 +582,13 @@ public class ImageStorage {
             return IosImageLoaderFactory.getInstance().createImageLoader(stream);
         }
 
+        if (stream instanceof FileInputStream fileStream) {
+            ImageLoader loader = getLoaderForFile(fileStream, listener);
+            if (loader != null) {
+                return loader;
+            }
+        }
+
         // We need a stream that supports the mark and reset methods, since J2DImageLoader
         // is used as a fallback after our built-in loader selection has already consumed
         // part of the input stream.
@@ -630,6 +656,65 @@ public class ImageStorage {
         return null;
     }
 
+    /**
+     * Creates a loader that decodes the whole file from a direct buffer, if the
+     * file's format is handled by a factory that can load from memory. This
+     * avoids a round trip to Java for every chunk of input. The file is read
+     * rather than mapped, since a mapped file that is truncated while native
+     * code decodes it would crash the VM. Returns null, with the stream
+     * position unchanged, if the file should be streamed instead.
+     */
+    private ImageLoader getLoaderForFile(FileInputStream stream, ImageLoadListener listener) throws IOException {
+        FileChannel channel = stream.getChannel();
+        long position = channel.position();
+        long size = channel.size() - position;
+        int headerLength = getMaxSignatureLength();
+        if (size < headerLength || size > MAX_BUFFERED_FILE_SIZE) {
+            return null;
+        }
+
+        byte[] header = new byte[headerLength];
+        if (readFully(channel, ByteBuffer.wrap(header), position) < headerLength) {
+            return null;
+        }
+
+        for (final Entry<Signature, ImageLoaderFactory> factoryRegistration:
+                 loaderFactoriesBySignature.entrySet()) {
+            if (factoryRegistration.getKey().matches(header)) {
+                ImageLoaderFactory factory = factoryRegistration.getValue();
+                if (!factory.canLoadFromBuffer()) {
+                    return null;
+                }
+
+                ByteBuffer data = ByteBuffer.allocateDirect((int) size);
+                if (readFully(channel, data, position) < size) {
+                    return null;
+                }
+                data.flip();
+
+                ImageLoader loader = factory.createImageLoader(data);
+                if (listener != null) {
+                    loader.addListener(listener);
+                }
+                return loader;
+            }
+        }
+
+        return null;
+    }
+
+    private static int readFully(FileChannel channel, ByteBuffer dst, long position) throws IOException {
+        int total = 0;
+        while (dst.hasRemaining()) {
+            int n = channel.read(dst, position + total);
+            if (n < 0) {
+                break;
+            }
+            total += n;
+        }
+        return total;
+    }
+
     /**
      * Tries to create an {@link com.sun.javafx.iio.java2d.J2DImageLoader} for the specified input stream.
      * This might fail in the future if the {@code java.desktop} module is not present on the module path.
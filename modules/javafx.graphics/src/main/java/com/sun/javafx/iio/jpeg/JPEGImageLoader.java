@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -88,8 +88,12 @@ public class JPEGImageLoader extends ImageLoaderImpl {
 
     private static native void disposeNative(long structPointer);
 
-    /** Sets up per-reader C structure and returns a pointer to it. */
-    private native long initDecompressor(InputStream stream) throws IOException;
+    /**
+     * Sets up per-reader C structure and returns a pointer to it.
+     * If source is not null the image is read from that direct buffer
+     * and stream is ignored.
+     */
+    private native long initDecompressor(InputStream stream, ByteBuffer source) throws IOException;
 
     /** Sets output color space and scale factor.
      *  Returns number of components which native decoder
@@ -176,9 +180,24 @@ public class JPEGImageLoader extends ImageLoaderImpl {
         if (input == null) {
             throw new IllegalArgumentException("input == null!");
         }
+        init(input, null);
+    }
+
+    /**
+     * Creates a loader that decodes the image held in the remaining bytes
+     * of a direct buffer, without reading from a stream.
+     */
+    JPEGImageLoader(ByteBuffer input) throws IOException {
+        super(JPEGDescriptor.getInstance());
+        if (input == null || !input.isDirect()) {
+            throw new IllegalArgumentException("input is not a direct buffer!");
+        }
+        init(null, input.slice());
+    }
 
+    private void init(InputStream stream, ByteBuffer source) throws IOException {
         try {
-            this.structPointer = initDecompressor(input);
+            this.structPointer = initDecompressor(stream, source);
         } catch (IOException e) {
             dispose();
             throw e;
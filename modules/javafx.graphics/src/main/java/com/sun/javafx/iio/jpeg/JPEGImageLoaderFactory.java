@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@ import com.sun.javafx.iio.ImageLoader;
 import com.sun.javafx.iio.ImageLoaderFactory;
 import java.io.IOException;
 import java.io.InputStream;
+import java.nio.ByteBuffer;
 
 public class JPEGImageLoaderFactory implements ImageLoaderFactory {
     private static final JPEGImageLoaderFactory theInstance =
@@ -50,4 +51,14 @@ public class JPEGImageLoaderFactory implements ImageLoaderFactory {
     public ImageLoader createImageLoader(InputStream input) throws IOException {
         return new JPEGImageLoader(input);
     }
+
+    @Override
+    public boolean canLoadFromBuffer() {
+        return true;
+    }
+
+    @Override
+    public ImageLoader createImageLoader(ByteBuffer input) throws IOException {
+        return new JPEGImageLoader(input);
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -346,22 +346,22 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
         }
     }
 
-    private static int paethPr(int a, int b, int c) {
-        // int p = a + b - c
-        int pa = Math.abs(b - c);      // p-a
-        int pb = Math.abs(a - c);      // p-b
-        int pc = Math.abs(b - c + a - c);  // p-c
-        return (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
-    }
-
     private void doPaethFilter(byte line[], byte pline[], int bpp) {
         int l = line.length;
         for (int i = 0; i != bpp; ++i) {
             line[i] = (byte) (line[i] + pline[i]);
         }
         for (int i = bpp; i != l; ++i) {
-            line[i] = (byte) (line[i]
-                    + paethPr(line[i - bpp] & 0xFF, pline[i] & 0xFF, pline[i - bpp] & 0xFF));
+            int a = line[i - bpp] & 0xFF;
+            int b = pline[i] & 0xFF;
+            int c = pline[i - bpp] & 0xFF;
+            // p = a + b - c, pa = |p - a|, pb = |p - b|, pc = |p - c|
+            int pa = b - c;
+            int pb = a - c;
+            int pc = Math.abs(pa + pb);
+            pa = Math.abs(pa);
+            pb = Math.abs(pb);
+            line[i] = (byte) (line[i] + ((pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c));
         }
     }
 
@@ -534,7 +534,63 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
         return start[mip] + pos * increment[mip];
     }
 
-    private void loadMip(byte image[], InputStream data, int mip) throws IOException {
+    /**
+     * Inflates the IDAT data straight into the caller's scanline buffers,
+     * reading the compressed data in large blocks. This avoids the
+     * extra copies and small reads of an InflaterInputStream wrapped in
+     * a BufferedInputStream.
+     */
+    private static final class IDATInflater {
+        private static final int INPUT_SIZE = 64 * 1024;
+
+        private final Inflater inflater = new Inflater();
+        private final InputStream source;
+        private final byte input[];
+        private final byte single[] = new byte[1];
+
+        IDATInflater(InputStream source, int dataSize) {
+            this.source = source;
+            // the first IDAT chunk hints at the size of the data
+            this.input = new byte[Math.clamp(dataSize, 512, INPUT_SIZE)];
+        }
+
+        int read() throws IOException {
+            readFully(single, 0, 1);
+            return single[0] & 0xFF;
+        }
+
+        void readFully(byte b[], int off, int len) throws IOException {
+            while (len > 0) {
+                int n;
+                try {
+                    n = inflater.inflate(b, off, len);
+                } catch (DataFormatException e) {
+                    String s = e.getMessage();
+                    throw new ZipException(s != null ? s : "Invalid ZLIB data format");
+                }
+                if (n == 0) {
+                    if (inflater.finished() || inflater.needsDictionary()) {
+                        throw new EOFException();
+                    }
+                    if (inflater.needsInput()) {
+                        int r = source.read(input, 0, input.length);
+                        if (r < 0) {
+                            throw new EOFException();
+                        }
+                        inflater.setInput(input, 0, r);
+                    }
+                }
+                off += n;
+                len -= n;
+            }
+        }
+
+        void end() {
+            inflater.end();
+        }
+    }
+
+    private void loadMip(byte image[], IDATInflater data, int mip) throws IOException {
 
         int mipWidth = mipSize(width, mip, starting_x, increment_x);
         int mipHeight = mipSize(height, mip, starting_y, increment_y);
@@ -549,13 +605,7 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
 
         for (int y = 0; y != mipHeight; ++y) {
             int filterByte = data.read();
-            if (filterByte == -1) {
-                throw new EOFException();
-            }
-
-            if (data.read(scanLine0) != scanLineSize) {
-                throw new EOFException();
-            }
+            data.readFully(scanLine0, 0, scanLineSize);
 
             doFilter(scanLine0, scanLine1, filterByte, srcBpp);
 
@@ -573,10 +623,14 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
             byte scanLineSwp[] = scanLine0;
             scanLine0 = scanLine1;
             scanLine1 = scanLineSwp;
+
+            if (mip == 7) {
+                updateImageProgress(100.0F * (y + 1) / mipHeight);
+            }
         }
     }
 
-    private void load(byte image[], InputStream data) throws IOException {
+    private void load(byte image[], IDATInflater data) throws IOException {
         if (isInterlaced) {
             for (int mip = 0; mip != 7; ++mip) {
                 if (width > starting_x[mip] && height > starting_y[mip]) {
@@ -668,17 +722,12 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
         ByteBuffer bb = ByteBuffer.allocate(bpp * width * height);
 
         PNGIDATChunkInputStream iDat = new PNGIDATChunkInputStream(stream, dataSize);
-        Inflater inf = new Inflater();
-        InputStream data = new BufferedInputStream(new InflaterInputStream(iDat, inf));
+        IDATInflater data = new IDATInflater(iDat, dataSize);
 
         try {
             load(bb.array(), data);
-        } catch (IOException e) {
-            throw e;
         } finally {
-            if (inf != null) {
-                inf.end();
-            }
+            data.end();
         }
 
         ImageFrame imgPNG = colorType == PNG_COLOR_PALETTE
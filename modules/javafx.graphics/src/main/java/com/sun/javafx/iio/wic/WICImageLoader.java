@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.wic;
+
+import com.sun.glass.utils.NativeLibLoader;
+import com.sun.javafx.iio.ImageFormatDescription;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageMetadata;
+import com.sun.javafx.iio.ImageStorage.ImageType;
+import com.sun.javafx.iio.common.ImageLoaderImpl;
+import com.sun.javafx.iio.common.ImageTools;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+
+/**
+ * A loader which decodes images with the Windows Imaging Component.
+ * The image is read in place from a direct buffer and decoded, at the
+ * requested size, straight to premultiplied BGRA which Prism can upload
+ * without conversion.
+ */
+public class WICImageLoader extends ImageLoaderImpl {
+
+    /** Reads the image width and height into size, returns false if WIC can't decode the image. */
+    private static native boolean readHeader(ByteBuffer source, int[] size);
+
+    /** Decodes the first frame at the given size into pixels as premultiplied BGRA. */
+    private static native boolean decode(ByteBuffer source, int width, int height,
+                                         boolean smooth, byte[] pixels);
+
+    static {
+        NativeLibLoader.loadLibrary("javafx_iio");
+    }
+
+    private ByteBuffer source;
+    private final int inWidth;
+    private final int inHeight;
+
+    private WICImageLoader(ImageFormatDescription desc, ByteBuffer source, int width, int height) {
+        super(desc);
+        this.source = source;
+        this.inWidth = width;
+        this.inHeight = height;
+    }
+
+    /**
+     * Creates a loader for the image held in the remaining bytes of a direct
+     * buffer, or returns null if WIC can't decode it.
+     */
+    static WICImageLoader create(ImageFormatDescription desc, ByteBuffer input) {
+        if (input == null || !input.isDirect()) {
+            throw new IllegalArgumentException("input is not a direct buffer!");
+        }
+        ByteBuffer source = input.slice();
+        int[] size = new int[2];
+        if (!readHeader(source, size)) {
+            return null;
+        }
+        return new WICImageLoader(desc, source, size[0], size[1]);
+    }
+
+    @Override
+    public void dispose() {
+        source = null;
+    }
+
+    @Override
+    public ImageFrame load(int imageIndex, double w, double h, boolean preserveAspectRatio, boolean smooth,
+                           float screenPixelScale, float imagePixelScale) throws IOException {
+        ImageTools.validateMaxDimensions(w, h, imagePixelScale);
+
+        if (imageIndex != 0 || source == null) {
+            return null;
+        }
+
+        int[] widthHeight = ImageTools.computeDimensions(
+            inWidth, inHeight, (int)(w * imagePixelScale), (int)(h * imagePixelScale), preserveAspectRatio);
+        int width = widthHeight[0];
+        int height = widthHeight[1];
+        if (width > Integer.MAX_VALUE / 4 / height) {
+            throw new IOException("Bad image size!");
+        }
+
+        ImageMetadata md = new ImageMetadata(null, true,
+                null, null, null, null, null,
+                width, height, null, null, null);
+        updateImageMetadata(md);
+
+        byte[] pixels = new byte[width * height * 4];
+        try {
+            if (!decode(source, width, height, smooth, pixels)) {
+                throw new IOException("Error decoding image with WIC");
+            }
+        } finally {
+            dispose();
+        }
+        updateImageProgress(100.0F);
+
+        return new ImageFrame(ImageType.BGRA_PRE, ByteBuffer.wrap(pixels),
+                width, height, width * 4, imagePixelScale, md);
+    }
+}
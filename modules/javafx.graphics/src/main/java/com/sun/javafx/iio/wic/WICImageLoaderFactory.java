@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.wic;
+
+import com.sun.javafx.iio.ImageFormatDescription;
+import com.sun.javafx.iio.ImageLoader;
+import com.sun.javafx.iio.ImageLoaderFactory;
+import java.io.ByteArrayInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.ByteBuffer;
+
+/**
+ * A factory which creates loaders backed by the Windows Imaging Component
+ * for the format of another factory, and falls back to that factory for
+ * images that WIC can't decode.
+ */
+public class WICImageLoaderFactory implements ImageLoaderFactory {
+
+    private final ImageLoaderFactory fallback;
+
+    public WICImageLoaderFactory(ImageLoaderFactory fallback) {
+        this.fallback = fallback;
+    }
+
+    @Override
+    public ImageFormatDescription getFormatDescription() {
+        return fallback.getFormatDescription();
+    }
+
+    @Override
+    public ImageLoader createImageLoader(InputStream input) throws IOException {
+        byte[] data = input.readAllBytes();
+        ByteBuffer buffer = ByteBuffer.allocateDirect(data.length).put(data).flip();
+        ImageLoader loader = WICImageLoader.create(getFormatDescription(), buffer);
+        return loader != null ? loader
+                : fallback.createImageLoader(new ByteArrayInputStream(data));
+    }
+
+    @Override
+    public boolean canLoadFromBuffer() {
+        return true;
+    }
+
+    @Override
+    public ImageLoader createImageLoader(ByteBuffer input) throws IOException {
+        ImageLoader loader = WICImageLoader.create(getFormatDescription(), input);
+        if (loader != null) {
+            return loader;
+        }
+        if (fallback.canLoadFromBuffer()) {
+            return fallback.createImageLoader(input);
+        }
+        byte[] data = new byte[input.remaining()];
+        input.get(input.position(), data);
+        return fallback.createImageLoader(new ByteArrayInputStream(data));
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.javafx.sg.prism;
 
 import com.sun.javafx.geom.Vec3d;
 import com.sun.javafx.geom.transform.Affine3D;
+import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.util.Utils;
 import com.sun.prism.Graphics;
 import com.sun.prism.Material;
@@ -42,6 +43,9 @@ import javafx.scene.shape.DrawMode;
  * TODO: 3D - Need documentation
  */
 public abstract class NGShape3D extends NGNode {
+    // The number of lights the mesh view shaders support
+    private static final int MAX_LIGHTS = 3;
+
     private NGPhongMaterial material;
     private DrawMode drawMode;
     private CullFace cullFace;
@@ -50,6 +54,10 @@ public abstract class NGShape3D extends NGNode {
     NGTriangleMesh mesh;
     private MeshView meshView;
 
+    // Scratch space for picking the most relevant lights, render thread only
+    private final NGLightBase[] selectedLights = new NGLightBase[MAX_LIGHTS];
+    private final float[] selectedRelevance = new float[MAX_LIGHTS];
+
     public void setMaterial(NGPhongMaterial material) {
         this.material = material;
         materialDirty = true;
@@ -131,6 +139,8 @@ public abstract class NGShape3D extends NGNode {
             float ambientRed = 0.0f;
             float ambientBlue = 0.0f;
             float ambientGreen = 0.0f;
+            int numLights = 0;
+            BaseTransform shapeTx = g.getTransformNoClone();
 
             for (NGLightBase lightBase : lights) {
                 if (lightBase == null) {
@@ -153,25 +163,39 @@ public abstract class NGShape3D extends NGNode {
                     ambientRed   += rL;
                     ambientGreen += gL;
                     ambientBlue  += bL;
+                    continue;
+                }
+                /*
+                 * There is a limit on the number of lights that can affect
+                 * a 3D shape. The first MAX_LIGHTS lights are kept in order;
+                 * beyond that a light replaces the least relevant one kept
+                 * so far if it is more relevant to this shape.
+                 */
+                float relevance = getRelevance(lightBase, rL, gL, bL, shapeTx);
+                if (numLights < MAX_LIGHTS) {
+                    selectedLights[numLights] = lightBase;
+                    selectedRelevance[numLights] = relevance;
+                } else {
+                    int least = 0;
+                    for (int i = 1; i < MAX_LIGHTS; i++) {
+                        if (selectedRelevance[i] < selectedRelevance[least]) {
+                            least = i;
+                        }
+                    }
+                    if (relevance > selectedRelevance[least]) {
+                        selectedLights[least] = lightBase;
+                        selectedRelevance[least] = relevance;
+                    }
                 }
-                /* TODO: 3D
-                 * There is a limit on the number of point lights that can affect
-                 * a 3D shape. (Currently we simply select the first 3)
-                 * Thus it is important to select the most relevant lights.
-                 *
-                 * One such way would be to sort lights according to
-                 * intensity, which becomes especially relevant when lights
-                 * are attenuated. Only the most intense set of lights
-                 * would be set.
-                 * The approximate intensity a light will have on a given
-                 * shape, could be defined by:
-                 *
-                 * Where d is distance from point light
-                 * float attenuationFactor = 1/(c + cL * d + cQ * d * d);
-                 * float intensity = rL * 0.299f + gL * 0.587f + bL * 0.114f;
-                 * intensity *= attenuationFactor;
-                */
-                else if (lightBase instanceof NGSpotLight light) {
+                numLights++;
+            }
+            for (int i = 0; i < Math.min(numLights, MAX_LIGHTS); i++) {
+                NGLightBase lightBase = selectedLights[i];
+                selectedLights[i] = null;
+                float rL = lightBase.getColor().getRed();
+                float gL = lightBase.getColor().getGreen();
+                float bL = lightBase.getColor().getBlue();
+                if (lightBase instanceof NGSpotLight light) {
                     addSpotLight(light, lightIndex++, rL, gL, bL);
                 } else if (lightBase instanceof NGPointLight light) {
                     addPointLight(light, lightIndex++, rL, gL, bL);
@@ -184,13 +208,35 @@ public abstract class NGShape3D extends NGNode {
             ambientBlue = Utils.clamp(0, ambientBlue, 1);
             meshView.setAmbientLight(ambientRed, ambientGreen, ambientBlue);
         }
-        // TODO: 3D Required for D3D implementation of lights, which is limited to 3
-
-        while (lightIndex < 3) { // Reset any previously set lights
+        while (lightIndex < MAX_LIGHTS) { // Reset any previously set lights
             resetLight(lightIndex++);
         }
     }
 
+    /*
+     * Approximates how strongly a light illuminates this shape: the luminance
+     * of its color, attenuated over the distance from the light to the origin
+     * of the shape. The spot light cone is not taken into account.
+     */
+    private static float getRelevance(NGLightBase light, float r, float g, float b, BaseTransform shapeTx) {
+        float intensity = r * 0.299f + g * 0.587f + b * 0.114f;
+        if (light instanceof NGPointLight pointLight) {
+            Affine3D lightWT = pointLight.getWorldTransform();
+            double dx = lightWT.getMxt() - shapeTx.getMxt();
+            double dy = lightWT.getMyt() - shapeTx.getMyt();
+            double dz = lightWT.getMzt() - shapeTx.getMzt();
+            double d = Math.sqrt(dx * dx + dy * dy + dz * dz);
+            if (d > pointLight.getMaxRange()) {
+                return 0;
+            }
+            double attenuation = pointLight.getCa() + pointLight.getLa() * d + pointLight.getQa() * d * d;
+            if (attenuation > 0) {
+                intensity /= (float) attenuation;
+            }
+        }
+        return intensity;
+    }
+
     private boolean noLights(NGLightBase[] lights) {
         return lights == null || lights.length == 0 || lights[0] == null;
     }
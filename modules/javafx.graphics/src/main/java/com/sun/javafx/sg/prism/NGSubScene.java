@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,7 @@
  */
 package com.sun.javafx.sg.prism;
 
+import com.sun.javafx.geom.Rectangle;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.prism.CompositeMode;
 import com.sun.prism.Graphics;
@@ -48,6 +49,8 @@ public class NGSubScene extends NGNode {
     // into a normal color render target.
     // REMIND: resolveRTT could be a single shared scratch rtt
     private RTTexture resolveRTT = null;
+    // true if resolveRTT does not hold the current contents of rtt
+    private boolean resolveNeeded = true;
     private NGNode root = null;
     private boolean renderSG = true;
     // Depth and msaa are immutable states
@@ -229,6 +232,7 @@ public class NGSubScene extends NGNode {
 
             root.render(rttGraphics);
             renderSG = false;
+            resolveNeeded = true;
         }
         if (msaa) {
             int x0 = rtt.getContentX();
@@ -256,8 +260,33 @@ public class NGSubScene extends NGNode {
                 int dstH = target.getContentHeight();
                 int dX = dstX1 > dstW ? dstW - dstX1 : 0;
                 int dY = dstY1 > dstH ? dstH - dstY1 : 0;
-                g.blit(rtt, null, x0, y0, x1 + dX, y1 + dY,
-                            dstX0, dstY0, dstX1 + dX, dstY1 + dY);
+                // Only resolve the part inside the clip, the rest of the
+                // scene surface is not repainted this frame
+                Rectangle clip = g.getClipRectNoClone();
+                if (clip != null) {
+                    int clipX0 = target.getContentX() + clip.x;
+                    int clipY0 = target.getContentY() + clip.y;
+                    int clipX1 = clipX0 + clip.width;
+                    int clipY1 = clipY0 + clip.height;
+                    if (dstX0 < clipX0) {
+                        x0 += clipX0 - dstX0;
+                        dstX0 = clipX0;
+                    }
+                    if (dstY0 < clipY0) {
+                        y0 += clipY0 - dstY0;
+                        dstY0 = clipY0;
+                    }
+                    if (dstX1 + dX > clipX1) {
+                        dX = clipX1 - dstX1;
+                    }
+                    if (dstY1 + dY > clipY1) {
+                        dY = clipY1 - dstY1;
+                    }
+                }
+                if (dstX0 < dstX1 + dX && dstY0 < dstY1 + dY) {
+                    g.blit(rtt, null, x0, y0, x1 + dX, y1 + dY,
+                                dstX0, dstY0, dstX1 + dX, dstY1 + dY);
+                }
             } else {
                 if (resolveRTT != null &&
                         (resolveRTT.getContentWidth() < rtWidth ||
@@ -276,11 +305,16 @@ public class NGSubScene extends NGNode {
                 if (resolveRTT == null) {
                     resolveRTT = g.getResourceFactory().createRTTexture(rtWidth, rtHeight,
                             Texture.WrapMode.CLAMP_TO_ZERO, false);
+                    resolveNeeded = true;
+                }
+                // The resolved copy stays valid until the SubScene repaints
+                if (resolveNeeded) {
+                    // We could potentially reuse g, but any transform in g would
+                    // affect the blit...
+                    resolveRTT.createGraphics().blit(rtt, resolveRTT, x0, y0, x1, y1,
+                                                     x0, y0, x1, y1);
+                    resolveNeeded = false;
                 }
-                // We could potentially reuse g, but any transform in g would
-                // affect the blit...
-                resolveRTT.createGraphics().blit(rtt, resolveRTT, x0, y0, x1, y1,
-                                                 x0, y0, x1, y1);
                 g.drawTexture(resolveRTT, 0, 0, (float) (rtWidth / scaleX), (float) (rtHeight / scaleY),
                               0, 0, rtWidth, rtHeight);
                 resolveRTT.unlock();
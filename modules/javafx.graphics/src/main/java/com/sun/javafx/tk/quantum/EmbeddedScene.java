@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,12 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
     private volatile float      texScaleFactorX = 1.0f;
     private volatile float      texScaleFactorY = 1.0f;
 
+    // The buffer and logical size of the last getPixels() copy, reset when
+    // a new frame is uploaded. Accessed under renderLock.
+    private IntBuffer   copiedDest;
+    private int         copiedWidth;
+    private int         copiedHeight;
+
     private volatile PixelFormat<?> pixelFormat;
 
     public EmbeddedScene(HostInterface host, boolean depthBuffer, boolean msaa) {
@@ -107,6 +113,7 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
             painter = null;
             paintRenderJob = null;
             texBits = null;
+            copiedDest = null;
             return null;
         });
         super.dispose();
@@ -180,6 +187,7 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
         texLineStride = pixels.getWidthUnsafe();
         texScaleFactorX = pixels.getScaleXUnsafe();
         texScaleFactorY = pixels.getScaleYUnsafe();
+        copiedDest = null;
         if (host != null) {
             host.repaint();
         }
@@ -232,6 +240,11 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
             {
                 return false;
             }
+            // Swing repaints the host for many reasons other than a new
+            // frame; the dest buffer already holds this one then.
+            if (dest == copiedDest && width == copiedWidth && height == copiedHeight) {
+                return true;
+            }
             scaledWidth = (int) Math.ceil(scaledWidth * texScaleFactorX);
             scaledHeight = (int) Math.ceil(scaledHeight * texScaleFactorY);
 
@@ -242,19 +255,17 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
                 int w = Math.min(scaledWidth, texLineStride);
                 int h = Math.min(scaledHeight, texBits.capacity() / texLineStride);
 
-                // Copy the intersection to the dest.
-                // The backed array of the textureBits may not be available,
-                // so not relying on it.
-                int[] linebuf = new int[w];
+                // Copy the intersection to the dest, line by line and
+                // without an intermediate array.
                 for (int i = 0; i < h; i++) {
-                    texBits.position(i * texLineStride);
-                    texBits.get(linebuf, 0, w);
-                    dest.position(i * scaledWidth);
-                    dest.put(linebuf);
+                    dest.put(i * scaledWidth, texBits, i * texLineStride, w);
                 }
-                return true;
+            } else {
+                dest.put(texBits);
             }
-            dest.put(texBits);
+            copiedDest = dest;
+            copiedWidth = width;
+            copiedHeight = height;
             return true;
         });
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -92,6 +92,7 @@ final class PresentingPainter extends ViewPainter {
                     paintImpl(g);
                     freshBackBuffer = false;
                 }
+                presentable.setDamage(g != null ? getDamage() : null);
 
                 if (PULSE_LOGGING_ENABLED) {
                     PulseLogger.newPhase("Presenting");
@@ -107,6 +108,8 @@ final class PresentingPainter extends ViewPainter {
                     if (!presentable.present()) {
                         disposePresentable();
                         sceneState.getScene().entireSceneNeedsRepaint();
+                    } else {
+                        QuantumToolkit.framePresented(presentable.getLastPresentTime());
                     }
                 }
             }
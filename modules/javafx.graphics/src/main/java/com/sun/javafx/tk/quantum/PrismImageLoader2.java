@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,8 +38,8 @@ import com.sun.javafx.runtime.async.AsyncOperationListener;
 import com.sun.javafx.tk.PlatformImage;
 import com.sun.prism.Image;
 import com.sun.prism.impl.PrismSettings;
-import java.util.concurrent.ExecutorService;
-import java.util.concurrent.Executors;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.LinkedBlockingDeque;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
 import java.util.concurrent.TimeUnit;
@@ -56,17 +56,31 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
     private double height;
     private float pixelScale;
     private Exception exception;
+    private final boolean cancellable;
 
     public PrismImageLoader2(String url, double width, double height,
                              boolean preserveRatio, float pixelScale,
                              boolean smooth)
     {
+        this.cancellable = false;
         loadAll(url, width, height, preserveRatio, pixelScale, smooth);
     }
 
     public PrismImageLoader2(InputStream stream, double width, double height,
                              boolean preserveRatio, boolean smooth)
     {
+        this(stream, width, height, preserveRatio, smooth, false);
+    }
+
+    /**
+     * If cancellable is true, decoding is aborted as soon as the loading
+     * thread is interrupted, which is how a background load is cancelled.
+     */
+    private PrismImageLoader2(InputStream stream, double width, double height,
+                              boolean preserveRatio, boolean smooth,
+                              boolean cancellable)
+    {
+        this.cancellable = cancellable;
         loadAll(stream, width, height, preserveRatio, smooth);
     }
 
@@ -211,6 +225,12 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
         public void imageLoadProgress(ImageLoader loader,
                                       float percentageComplete)
         {
+            // Loaders report progress while decoding, which is where a
+            // cancelled background load stops rather than running to the end.
+            if (cancellable && Thread.currentThread().isInterrupted()) {
+                throw new CancellationException("Image loading cancelled");
+            }
+
             // progress only matters when backgroundLoading=true, but
             // currently we are relying on AbstractRemoteResource for tracking
             // progress of the InputStream, so there's no need to implement
@@ -228,7 +248,7 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
     static final class AsyncImageLoader
         extends AbstractRemoteResource<com.sun.javafx.tk.ImageLoader>
     {
-        private static final ExecutorService BG_LOADING_EXECUTOR =
+        private static final ThreadPoolExecutor BG_LOADING_EXECUTOR =
                 createExecutor();
 
         double width, height;
@@ -249,7 +269,7 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
 
         @Override
         protected PrismImageLoader2 processStream(InputStream stream) {
-            return new PrismImageLoader2(stream, width, height, preserveRatio, smooth);
+            return new PrismImageLoader2(stream, width, height, preserveRatio, smooth, true);
         }
 
         @Override
@@ -257,7 +277,14 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
             BG_LOADING_EXECUTOR.execute(future);
         }
 
-        private static ExecutorService createExecutor() {
+        @Override
+        public void cancel() {
+            super.cancel();
+            // don't let a load that hasn't started hold its place in the queue
+            BG_LOADING_EXECUTOR.remove(future);
+        }
+
+        private static ThreadPoolExecutor createExecutor() {
             final ThreadGroup bgLoadingThreadGroup =
                     new ThreadGroup(QuantumToolkit.getFxUserThread()
                             .getThreadGroup(),
@@ -273,10 +300,28 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
                 return newThread;
             };
 
-            final ExecutorService bgLoadingExecutor =
-                    Executors.newCachedThreadPool(bgLoadingThreadFactory);
-            ((ThreadPoolExecutor) bgLoadingExecutor).setKeepAliveTime(
-                                                         1, TimeUnit.SECONDS);
+            // An unbounded pool lets an image-heavy ListView start a decode
+            // for every cell at once, and they all compete for the CPU and
+            // memory. The pool is bounded, with room for loads that wait on
+            // the network, and queued loads run newest first: the images
+            // requested last are usually the ones on screen, while older
+            // requests were often scrolled past in the meantime.
+            final int nThreads =
+                    Math.max(4, 2 * Runtime.getRuntime().availableProcessors());
+            final LinkedBlockingDeque<Runnable> newestFirst =
+                    new LinkedBlockingDeque<>() {
+                        @Override
+                        public boolean offer(Runnable runnable) {
+                            return offerFirst(runnable);
+                        }
+                    };
+
+            final ThreadPoolExecutor bgLoadingExecutor =
+                    new ThreadPoolExecutor(nThreads, nThreads,
+                                           1, TimeUnit.SECONDS,
+                                           newestFirst,
+                                           bgLoadingThreadFactory);
+            bgLoadingExecutor.allowCoreThreadTimeOut(true);
 
             return bgLoadingExecutor;
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -119,6 +119,7 @@ import com.sun.prism.BasicStroke;
 import com.sun.prism.Graphics;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.prism.PixelFormat;
+import com.sun.prism.PixelReadback;
 import com.sun.prism.RTTexture;
 import com.sun.prism.ResourceFactory;
 import com.sun.prism.ResourceFactoryListener;
@@ -156,6 +157,9 @@ public final class QuantumToolkit extends Toolkit {
 
     private static boolean debug = Boolean.getBoolean("quantum.debug");
 
+    // Time of the latest present, see framePresented
+    private static volatile long lastPresentTime;
+
     private static Integer pulseHZ = Integer.getInteger("javafx.animation.pulse");
 
     static final boolean liveResize = ((Supplier<Boolean>) () -> {
@@ -351,6 +355,8 @@ public final class QuantumToolkit extends Toolkit {
             pulseRunnable = () -> QuantumToolkit.this.pulseFromQueue();
             timerRunnable = () -> {
                 try {
+                    // A vsync timer may know when the display presented
+                    framePresented(pulseTimer.getLastPresentationTime());
                     QuantumToolkit.this.postPulse();
                 } catch (Throwable th) {
                     th.printStackTrace(System.err);
@@ -471,6 +477,24 @@ public final class QuantumToolkit extends Toolkit {
         return nativeSystemVsync;
     }
 
+    /*
+     * Records the time of the latest present, on the System.nanoTime() clock.
+     */
+    static void framePresented(long presentTime) {
+        if (presentTime != 0L) {
+            lastPresentTime = presentTime;
+        }
+    }
+
+    /**
+     * Returns the System.nanoTime() of the latest frame presented by any
+     * window, or 0 if the pipeline does not report present times. Adding
+     * the refresh period gives the deadline of the next frame.
+     */
+    static long getLastPresentTime() {
+        return lastPresentTime;
+    }
+
     boolean isVsyncEnabled() {
         return (PrismSettings.isVsyncEnabled &&
                 pipeline.isVsyncSupported());
@@ -607,7 +631,8 @@ public final class QuantumToolkit extends Toolkit {
     void vsyncHint() {
         if (isVsyncEnabled()) {
             if (debug) {
-                System.err.println("QT.vsyncHint: postPulse: " + System.nanoTime());
+                System.err.println("QT.vsyncHint: postPulse: " + System.nanoTime()
+                                   + " lastPresent: " + lastPresentTime);
             }
             postPulse();
         }
@@ -1554,26 +1579,55 @@ public final class QuantumToolkit extends Toolkit {
 
             }
 
+            // The readback of the previous tile, finished once the next tile
+            // has been queued so that the CPU copy overlaps the GPU work
+            private PixelReadback pendingReadback;
+            private IntBuffer pendingBuffer;
+            private int pendingXOffset, pendingYOffset, pendingW, pendingH;
+
             private void renderTile(int x, int xOffset, int y, int yOffset, int w, int h,
-                                    IntBuffer buffer, ResourceFactory rf, QuantumImage tileImg, QuantumImage targetImg) {
+                                    IntBuffer[] buffers, ResourceFactory rf, QuantumImage tileImg, QuantumImage targetImg) {
                 RTTexture rt = tileImg.getRT(w, h, rf);
                 if (rt == null) {
                     return;
                 }
+                IntBuffer buffer = (pendingBuffer == buffers[0]) ? buffers[1] : buffers[0];
                 Graphics g = rt.createGraphics();
                 draw(g, x + xOffset, y + yOffset, w, h);
                 int[] pixels = rt.getPixels();
                 if (pixels != null) {
+                    finishPendingTile(targetImg);
                     buffer.put(pixels);
+                    //Copy tile's pixels into the target image
+                    targetImg.image.setPixels(xOffset, yOffset, w, h,
+                            javafx.scene.image.PixelFormat.getIntArgbPreInstance(), buffer, w);
                 } else {
-                    rt.readPixels(buffer, rt.getContentX(), rt.getContentY(), w, h);
+                    PixelReadback readback = rt.readPixelsAsync(buffer, rt.getContentX(), rt.getContentY(), w, h);
+                    finishPendingTile(targetImg);
+                    pendingReadback = readback;
+                    pendingBuffer = buffer;
+                    pendingXOffset = xOffset;
+                    pendingYOffset = yOffset;
+                    pendingW = w;
+                    pendingH = h;
                 }
-                //Copy tile's pixels into the target image
-                targetImg.image.setPixels(xOffset, yOffset, w, h,
-                        javafx.scene.image.PixelFormat.getIntArgbPreInstance(), buffer, w);
                 rt.unlock();
             }
 
+            private void finishPendingTile(QuantumImage targetImg) {
+                if (pendingReadback == null) {
+                    return;
+                }
+                PixelReadback readback = pendingReadback;
+                pendingReadback = null;
+                if (readback.finish() && targetImg != null) {
+                    //Copy tile's pixels into the target image
+                    targetImg.image.setPixels(pendingXOffset, pendingYOffset, pendingW, pendingH,
+                            javafx.scene.image.PixelFormat.getIntArgbPreInstance(), pendingBuffer, pendingW);
+                }
+                pendingBuffer = null;
+            }
+
             private void renderWholeImage(int x, int y, int w, int h, ResourceFactory rf, QuantumImage pImage) {
                 RTTexture rt = pImage.getRT(w, h, rf);
                 if (rt == null) {
@@ -1663,7 +1717,11 @@ public final class QuantumToolkit extends Toolkit {
                         // +-----------+-----------+  .  +-------+
                         final int mTileWidth = computeTileSize(w, maxTextureSize);
                         final int mTileHeight = computeTileSize(h, maxTextureSize);
-                        IntBuffer buffer = IntBuffer.allocate(mTileWidth * mTileHeight);
+                        // Two buffers, so that a tile can be read back while the next one renders
+                        IntBuffer[] buffer = {
+                            IntBuffer.allocate(mTileWidth * mTileHeight),
+                            IntBuffer.allocate(mTileWidth * mTileHeight)
+                        };
                         // Walk through all same-size "M" tiles
                         int mTileXOffset = 0;
                         int mTileYOffset = 0;
@@ -1696,6 +1754,7 @@ public final class QuantumToolkit extends Toolkit {
                             renderTile(x, rTileXOffset, y, bTileYOffset, rTileWidth, bTileHeight,
                                     buffer, rf, tileRttCache, pImage);
                         }
+                        finishPendingTile(pImage);
                     }
                     else {
                         // The requested size for the snapshot fits max texture size,
@@ -1707,6 +1766,8 @@ public final class QuantumToolkit extends Toolkit {
                     errored = true;
                     t.printStackTrace(System.err);
                 } finally {
+                    // Release a readback left behind by an exception
+                    finishPendingTile(null);
                     if (tileRttCache != null) {
                         tileRttCache.dispose();
                     }
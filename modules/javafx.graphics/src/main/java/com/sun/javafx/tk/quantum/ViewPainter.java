@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.javafx.tk.quantum;
 
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 import java.util.concurrent.locks.ReentrantLock;
 import com.sun.javafx.geom.DirtyRegionContainer;
@@ -123,6 +124,14 @@ abstract class ViewPainter implements Runnable {
      */
     private RTTexture sceneBuffer;
 
+    /**
+     * The device pixel rectangles of the back buffer that the last paintImpl()
+     * drew into, as consecutive x, y, width and height values, or null if it
+     * may have drawn anywhere. Presentables that copy the back buffer use it
+     * to copy and present only the pixels that changed.
+     */
+    private int[] damage;
+
     protected ViewPainter(GlassScene gs) {
         sceneState = gs.getSceneState();
         if (sceneState == null) {
@@ -162,7 +171,16 @@ abstract class ViewPainter implements Runnable {
         }
     }
 
+    /**
+     * Returns the damage of the last paint, see {@link #damage}.
+     */
+    protected final int[] getDamage() {
+        return damage;
+    }
+
     protected void paintImpl(final Graphics backBufferGraphics) {
+        damage = null;
+
         // We should not be painting anything with a width / height
         // that is <= 0, so we might as well bail right off.
         if (width <= 0 || height <= 0 || backBufferGraphics == null) {
@@ -303,7 +321,11 @@ abstract class ViewPainter implements Runnable {
                 PulseLogger.addMessage(s.toString());
             }
 
-            // Paint each dirty region
+            // Paint each dirty region, recording the device pixels it covers
+            final int bufferWidth = (int) Math.ceil(width * pixelScaleX);
+            final int bufferHeight = (int) Math.ceil(height * pixelScaleY);
+            final int[] rects = new int[dirtyRegionSize * 4];
+            int numRects = 0;
             for (int i = 0; i < dirtyRegionSize; ++i) {
                 final RectBounds dirtyRegion = dirtyRegionContainer.getDirtyRegion(i);
                 // TODO it should be impossible to have ever created a dirty region that was empty...
@@ -320,8 +342,23 @@ abstract class ViewPainter implements Runnable {
                     g.setClipRectIndex(i);
                     doPaint(g, getRootPath(i));
                     getRootPath(i).clear();
+
+                    int x1 = Math.min(x0 + dirtyRect.width, bufferWidth);
+                    int y1 = Math.min(y0 + dirtyRect.height, bufferHeight);
+                    x0 = Math.max(x0, 0);
+                    y0 = Math.max(y0, 0);
+                    if (x1 > x0 && y1 > y0) {
+                        rects[numRects++] = x0;
+                        rects[numRects++] = y0;
+                        rects[numRects++] = x1 - x0;
+                        rects[numRects++] = y1 - y0;
+                    }
                 }
             }
+            // Showing the dirty regions or the overdraw repaints the whole buffer
+            if (numRects > 0 && !showDirtyOpts) {
+                damage = Arrays.copyOf(rects, numRects);
+            }
         } else {
             // There are no dirty regions, so just paint everything
             g.setHasPreCullingBits(false);
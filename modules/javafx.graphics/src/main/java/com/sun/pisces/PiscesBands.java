@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.sun.pisces;
+
+import com.sun.prism.impl.PrismSettings;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Splits the pixel rows of a large fill into horizontal bands that are
+ * rendered at the same time by a pool of worker threads.
+ * <p>
+ * Each band is a separate native call that renders with its own copy of
+ * the renderer state and touches only its own rows, so the output does not
+ * depend on the number of bands. Fills below about 64K pixels are not worth
+ * the hand-off and are rendered on the calling thread as before.
+ * <p>
+ * The number of threads is set with the {@code prism.sw.threads} system
+ * property and defaults to the number of processors, up to 8.
+ */
+final class PiscesBands {
+
+    /**
+     * Renders the rows from {@code start} inclusive to {@code end} exclusive.
+     */
+    interface Band {
+        void render(int start, int end);
+    }
+
+    // The least number of pixels that is worth a band of its own
+    private static final long MIN_BAND_PIXELS = 1L << 16;
+
+    private static ExecutorService pool;
+
+    private PiscesBands() {
+    }
+
+    private static synchronized ExecutorService getPool() {
+        if (pool == null) {
+            AtomicInteger count = new AtomicInteger();
+            pool = Executors.newFixedThreadPool(PrismSettings.swThreads - 1, r -> {
+                Thread t = new Thread(r, "Prism SW Worker-" + count.incrementAndGet());
+                t.setDaemon(true);
+                return t;
+            });
+        }
+        return pool;
+    }
+
+    /**
+     * Returns the number of bands worth rendering {@code rows} rows of
+     * {@code width} pixels in, 1 if the fill should not be split.
+     */
+    static int bandCount(int rows, int width) {
+        long maxBands = Math.max((long) rows * width / MIN_BAND_PIXELS, 1);
+        return (int) Math.min(Math.min(maxBands, PrismSettings.swThreads), rows);
+    }
+
+    /**
+     * Renders {@code rows} rows in {@code nbands} bands and returns when
+     * all of them are done.
+     */
+    static void run(int rows, int nbands, Band band) {
+        ExecutorService executor = getPool();
+        Future<?>[] futures = new Future<?>[nbands - 1];
+        for (int i = 0; i < nbands - 1; i++) {
+            int start = (int) ((long) rows * i / nbands);
+            int end = (int) ((long) rows * (i + 1) / nbands);
+            futures[i] = executor.submit(() -> band.render(start, end));
+        }
+        // The calling thread renders the last band itself
+        band.render((int) ((long) rows * (nbands - 1) / nbands), rows);
+
+        boolean interrupted = false;
+        try {
+            for (Future<?> f : futures) {
+                while (true) {
+                    try {
+                        f.get();
+                        break;
+                    } catch (InterruptedException e) {
+                        // The other bands still write into the surface
+                        interrupted = true;
+                    } catch (ExecutionException e) {
+                        Throwable cause = e.getCause();
+                        if (cause instanceof RuntimeException re) {
+                            throw re;
+                        } else if (cause instanceof Error err) {
+                            throw err;
+                        }
+                        throw new RuntimeException(cause);
+                    }
+                }
+            }
+        } finally {
+            if (interrupted) {
+                Thread.currentThread().interrupt();
+            }
+        }
+    }
+}
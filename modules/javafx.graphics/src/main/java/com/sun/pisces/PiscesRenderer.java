@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -77,6 +77,15 @@ public final class PiscesRenderer {
     public static final int ARC_CHORD = 1;
     public static final int ARC_PIE = 2;
 
+    /**
+     * Selects the instruction set of the span blenders: the widest one
+     * the processor supports, or the requested one if it is lower.
+     *
+     * @param requested "scalar", "sse2", "avx2", "neon" or null
+     * @return the name of the instruction set in use
+     */
+    public static native String selectInstructionSet(String requested);
+
     private long nativePtr = 0L;
     private AbstractSurface surface;
 
@@ -324,11 +333,19 @@ public final class PiscesRenderer {
         final int y1 = Math.max(y, 0);
         final int x2 = Math.min(x + w, surface.getWidth());
         final int y2 = Math.min(y + h, surface.getHeight());
-        this.clearRectImpl(x1, y1, x2 - x1, y2 - y1);
+        final int nbands = PiscesBands.bandCount(y2 - y1, x2 - x1);
+        if (nbands > 1) {
+            PiscesBands.run(y2 - y1, nbands, (start, end) ->
+                this.clearRectBandImpl(x1, y1, x2 - x1, y2 - y1, y1 + start, y1 + end - 1));
+        } else {
+            this.clearRectImpl(x1, y1, x2 - x1, y2 - y1);
+        }
     }
 
     private native void clearRectImpl(int x, int y, int w, int h);
 
+    private native void clearRectBandImpl(int x, int y, int w, int h, int bandMinY, int bandMaxY);
+
     public void fillRect(int x, int y, int w, int h) {
         final int x1 = Math.max(x, 0);
         final int y1 = Math.max(y, 0);
@@ -337,12 +354,23 @@ public final class PiscesRenderer {
         final int w2 = x2 - x1;
         final int h2 = y2 - y1;
         if (w2 > 0 && h2 > 0) {
-            this.fillRectImpl(x1, y1, w2, h2);
+            // Split the pixel rows the rectangle touches, including its fractional ones
+            final int minRow = y1 >> 16;
+            final int rows = ((y2 - 1) >> 16) - minRow + 1;
+            final int nbands = PiscesBands.bandCount(rows, (w2 >> 16) + 1);
+            if (nbands > 1) {
+                PiscesBands.run(rows, nbands, (start, end) ->
+                    this.fillRectBandImpl(x1, y1, w2, h2, minRow + start, minRow + end - 1));
+            } else {
+                this.fillRectImpl(x1, y1, w2, h2);
+            }
         }
     }
 
     private native void fillRectImpl(int x, int y, int w, int h);
 
+    private native void fillRectBandImpl(int x, int y, int w, int h, int bandMinY, int bandMaxY);
+
     public void emitAndClearAlphaRow(byte[] alphaMap, int[] alphaDeltas, int pix_y, int pix_x_from, int pix_x_to,
         int rowNum)
     {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -102,6 +102,15 @@ public interface MediaFrame {
      */
     public MediaFrame convertToFormat(PixelFormat fmt);
 
+    /**
+     * Returns the platform object holding the decoded image, so a pipeline
+     * that can share memory with the decoder may use it without reading the
+     * plane buffers. On macOS this is the frame's {@code CVPixelBufferRef}.
+     * The handle is only valid while the frame is held.
+     * @return the native frame handle, or zero if there is none
+     */
+    public long getNativeFrameHandle();
+
     /**
      * This method will prevent the frame from being deallocated or recycled. It
      * is very important to balance the use of this method by calling releaseFrame
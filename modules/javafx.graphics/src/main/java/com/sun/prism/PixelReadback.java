@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,32 +23,26 @@
  * questions.
  */
 
-#include "config.h"
+package com.sun.prism;
 
-#include "BitmapTextureJava.h"
-#include "GraphicsLayer.h"
-#include "NotImplemented.h"
-#include "PlatformContextJava.h"
-#include "TextureMapperJava.h"
-#include <stdio.h>
-namespace WebCore {
-
-
-void BitmapTextureJava::updateContents(const void*, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine)
-{
-    notImplemented();
-}
+/**
+ * A readback of render target pixels that completes asynchronously.
+ * <p>
+ * The pixels are copied into the destination buffer by {@link #finish()},
+ * which must be called exactly once, on the render thread, to release the
+ * readback. Calling it before {@link #isDone()} returns true blocks until
+ * the pixels are available.
+ */
+public interface PixelReadback {
 
-void BitmapTextureJava::didReset()
-{
-    float devicePixelRatio = 1.0;
-    m_image = ImageBuffer::create(contentSize(), RenderingMode::Unaccelerated, RenderingPurpose::Unspecified, devicePixelRatio,
-                         DestinationColorSpace::SRGB(), ImageBufferPixelFormat::BGRA8);
-}
+    /**
+     * Returns true if {@link #finish()} would not block.
+     */
+    public boolean isDone();
 
-void BitmapTextureJava::updateContents(NativeImage* image, const IntRect& targetRect, const IntPoint& offset)
-{
-    //m_image->context().drawImage(*image, targetRect, IntRect(offset, targetRect.size()));
+    /**
+     * Copies the pixels into the destination buffer and releases the
+     * readback. Returns false if the pixels could not be read.
+     */
+    public boolean finish();
 }
-
-} // namespace WebCore
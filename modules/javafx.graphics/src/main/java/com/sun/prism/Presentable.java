@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,6 +44,18 @@ public interface Presentable extends RenderTarget {
      */
     public boolean lockResources(PresentableState pState);
 
+    /**
+     * Sets the rectangles of the back buffer that changed since the previous
+     * {@link #prepare(Rectangle)}, as consecutive x, y, width and height
+     * values in physical pixels, or null if the whole buffer may have changed.
+     * Presentables that copy their back buffer for presentation may use it to
+     * copy and present less; the others ignore it.
+     *
+     * @param damage the changed rectangles, or null for the full area
+     */
+    public default void setDamage(int[] damage) {
+    }
+
     /**
      * display the indicated region to the user.
      * @param dirtyregion display region or null for full area
@@ -57,6 +69,15 @@ public interface Presentable extends RenderTarget {
      */
     public boolean present();
 
+    /**
+     * Returns the time of the last {@link #present()} on the
+     * {@code System.nanoTime()} clock, taken from the display's vertical
+     * blank where the platform reports it, or 0 if nothing was presented.
+     */
+    public default long getLastPresentTime() {
+        return 0L;
+    }
+
     public float getPixelScaleFactorX();
     public float getPixelScaleFactorY();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,4 +32,25 @@ public interface RTTexture extends Texture, RenderTarget {
     public boolean readPixels(Buffer pixels);
     public boolean readPixels(Buffer pixels, int x, int y, int width, int height);
     public boolean isVolatile();
+
+    /**
+     * Starts reading the given region into the buffer without waiting for
+     * the GPU. The buffer must not be touched until the returned readback
+     * is finished. The default implementation reads the pixels right away.
+     */
+    public default PixelReadback readPixelsAsync(Buffer pixels, int x, int y,
+                                                 int width, int height) {
+        boolean result = readPixels(pixels, x, y, width, height);
+        return new PixelReadback() {
+            @Override
+            public boolean isDone() {
+                return true;
+            }
+
+            @Override
+            public boolean finish() {
+                return result;
+            }
+        };
+    }
 }
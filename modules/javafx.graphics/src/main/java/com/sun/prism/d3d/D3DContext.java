@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.prism.d3d;
 
 import com.sun.glass.ui.Screen;
+import com.sun.javafx.geom.BaseBounds;
 import com.sun.javafx.geom.Rectangle;
 import com.sun.javafx.geom.Vec3d;
 import com.sun.javafx.geom.transform.Affine3D;
@@ -95,7 +96,9 @@ class D3DContext extends BaseShaderContext {
 
     private final D3DResourceFactory factory;
 
-    public static final int NUM_QUADS = PrismSettings.superShader ? 4096 : 256;
+    // must not exceed MAX_BATCH_QUADS in D3DContext.h so that a full buffer
+    // is drawn with a single call
+    public static final int NUM_QUADS = 4096;
 
     D3DContext(long pContext, Screen screen, D3DResourceFactory factory) {
         super(screen, factory, NUM_QUADS);
@@ -113,6 +116,9 @@ class D3DContext extends BaseShaderContext {
         state = new State();
         validate(nSetBlendEnabled(pContext, D3DCOMPMODE_SRCOVER));
         validate(nSetDeviceParametersFor2D(pContext));
+        if (PrismSettings.d3dPrewarm3D) {
+            validate(nPrewarm3D(pContext));
+        }
     }
 
     long getContextHandle() {
@@ -192,9 +198,18 @@ class D3DContext extends BaseShaderContext {
             setLost();
             // disposing the lcd buffer because the device is about to be lost
             disposeLCDBuffer();
-            factory.notifyReset();
 
-            hr = D3DResourceFactory.nResetDevice(pContext);
+            // Try to keep the default pool resources first so that nothing
+            // has to be uploaded again; only if that fails are they released
+            hr = D3DResourceFactory.nResetDevice(pContext, true);
+            if (FAILED(hr)) {
+                if (PrismSettings.verbose) {
+                    System.err.println("D3DContext::testLostStateAndReset : "
+                            + "reset keeping resources failed, releasing them");
+                }
+                factory.notifyReset();
+                hr = D3DResourceFactory.nResetDevice(pContext, false);
+            }
 
             if (hr == D3D_OK) {
                 isLost = false;
@@ -453,6 +468,7 @@ class D3DContext extends BaseShaderContext {
     private static native int nSetBlendEnabled(long pContext, int mode);
     private static native int nSetDeviceParametersFor2D(long pContext);
     private static native int nSetDeviceParametersFor3D(long pContext);
+    private static native int nPrewarm3D(long pContext);
 
     private static native long nCreateD3DMesh(long pContext);
     private static native void nReleaseD3DMesh(long pContext, long nativeHandle);
@@ -623,7 +639,13 @@ class D3DContext extends BaseShaderContext {
         D3DContext.validate(res);
     }
 
-    void renderMeshView(long nativeMeshView, Graphics g) {
+    void renderMeshView(long nativeMeshView, Graphics g, BaseBounds bounds) {
+
+        // The pixel scale applied to projViewTx below is undone in the world
+        // transform, so the mesh is seen through projViewTx and the transform
+        if (isOutsideFrustum(projViewTx, g.getTransformNoClone(), bounds, true)) {
+            return;
+        }
 
         // Support retina display by scaling the projViewTx and pass it to the shader.
         scratchTx = scratchTx.set(projViewTx);
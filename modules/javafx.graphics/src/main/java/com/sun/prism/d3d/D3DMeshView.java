@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -95,7 +95,7 @@ class D3DMeshView extends BaseMeshView {
     @Override
     public void render(Graphics g) {
         material.lockTextureMaps();
-        context.renderMeshView(nativeHandle, g);
+        context.renderMeshView(nativeHandle, g, mesh.getBounds());
         material.unlockTextureMaps();
     }
 
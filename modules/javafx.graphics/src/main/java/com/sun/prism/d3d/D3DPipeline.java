@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -94,6 +94,16 @@ public final class D3DPipeline extends GraphicsPipeline {
         printDriverWarning(nGetDriverInformation(adapter, new D3DDriverInformation()));
     }
 
+    private static void printAdapters() {
+        System.out.println("D3D adapters:");
+        for (int adapter = 0, n = nGetAdapterCount(); adapter != n; ++adapter) {
+            D3DDriverInformation di = nGetDriverInformation(adapter, new D3DDriverInformation());
+            if (di != null) {
+                System.out.println("\t" + adapter + ": " + di.deviceDescription + " (" + di.deviceName + ")");
+            }
+        }
+    }
+
     private static void printDriverInformation(int adapter) {
         D3DDriverInformation di = nGetDriverInformation(adapter, new D3DDriverInformation());
         if (di != null) {
@@ -142,6 +152,7 @@ public final class D3DPipeline extends GraphicsPipeline {
 
     private static native int nGetAdapterOrdinal(long hMonitor);
     private static native int nGetAdapterCount();
+    private static native int nGetPreferredAdapter();
 
     /*
      * This method fill object with data and return an argument
@@ -248,7 +259,14 @@ public final class D3DPipeline extends GraphicsPipeline {
             }
         }
 
-        for (int adapter = 0, n = nGetAdapterCount(); adapter != n; ++adapter) {
+        if (PrismSettings.verbose) {
+            printAdapters();
+        }
+
+        // Try the adapter of the GPU preference first, then the others in order
+        int preferred = nGetPreferredAdapter();
+        for (int i = 0, n = nGetAdapterCount(); i != n; ++i) {
+            int adapter = (i == 0) ? preferred : (i <= preferred ? i - 1 : i);
             D3DResourceFactory rf =
                     getD3DResourceFactory(adapter, getScreenForAdapter(screens, adapter));
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -371,7 +371,8 @@ class D3DResourceFactory extends BaseShaderFactory {
 
         long pResource = nCreateSwapChain(context.getContextHandle(),
                                           pState.getNativeView(),
-                                          PrismSettings.isVsyncEnabled);
+                                          PrismSettings.isVsyncEnabled,
+                                          PrismSettings.d3dFlipEx);
 
         if (pResource != 0L) {
             int width = pState.getRenderWidth();
@@ -549,14 +550,15 @@ class D3DResourceFactory extends BaseShaderFactory {
     static native long nGetContext(int adapterOrdinal);
     static native boolean nIsDefaultPool(long pResource);
     static native int nTestCooperativeLevel(long pContext);
-    static native int nResetDevice(long pContext);
+    static native int nResetDevice(long pContext, boolean keepDefaultPool);
     static native long nCreateTexture(long pContext,
                                       int format, int hint,
                                       boolean isRTT,
                                       int width, int height, int samples,
                                       boolean useMipmap);
     static native long nCreateSwapChain(long pContext, long hwnd,
-                                        boolean isVsyncEnabled);
+                                        boolean isVsyncEnabled,
+                                        boolean isFlipEx);
     static native int nReleaseResource(long pContext, long resource);
     static native int nGetMaximumTextureSize(long pContext);
     static native int nGetTextureWidth(long pResource);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,6 +69,16 @@ class ES2Context extends BaseShaderContext {
     private int indexBuffer = 0;
     private int shaderProgram;
 
+    // The mesh view, and the parts of its material and graphics state read
+    // by renderMeshView, whose instances are pending in the glContext
+    private static final boolean INSTANCING = PrismSettings.instancedES2Meshes;
+    private ES2MeshView instancedMeshView;
+    private long instancedMeshViewHandle;
+    private final Object[] instancedMaterialState =
+            new Object[2 + ES2PhongMaterial.MAX_MAP_TYPE];
+    private boolean instancedSpecularColorSet;
+    private float instancedScaleX, instancedScaleY;
+
     public static final int NUM_QUADS = PrismSettings.superShader ? 4096 : 256;
 
     ES2Context(Screen screen, ShaderFactory factory) {
@@ -120,6 +130,7 @@ class ES2Context extends BaseShaderContext {
 
     final void clearContext() {
         if (currentDrawable != null) {
+            glContext.flushBatch();
             currentDrawable.swapBuffers(glContext);
         }
     }
@@ -138,8 +149,8 @@ class ES2Context extends BaseShaderContext {
         return pixelFormat;
     }
 
-    ES2Shader getPhongShader(ES2MeshView meshView) {
-        return ES2PhongShader.getShader(meshView, this);
+    ES2Shader getPhongShader(ES2MeshView meshView, boolean instanced) {
+        return ES2PhongShader.getShader(meshView, this, instanced);
     }
 
     void makeCurrent(GLDrawable drawable) {
@@ -147,6 +158,7 @@ class ES2Context extends BaseShaderContext {
             drawable = dummyGLDrawable;
         }
         if (drawable != currentDrawable) {
+            glContext.flushBatch();
             glContext.makeCurrent(drawable);
             // Need to restore FBO to on screen framebuffer
             glContext.bindFBO(0);
@@ -154,6 +166,16 @@ class ES2Context extends BaseShaderContext {
         }
     }
 
+    /**
+     * Switches to the dummy drawable if the given drawable is current, so
+     * that it can be destroyed.
+     */
+    void releaseDrawable(GLDrawable drawable) {
+        if (drawable == currentDrawable) {
+            makeCurrent(null);
+        }
+    }
+
     /**
      * Called from ES2Graphics.updateRenderTarget() in response to a window
      * resize event.  This method ensures that the context is made current
@@ -403,6 +425,12 @@ class ES2Context extends BaseShaderContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeGeometry(long nativeHandle, float[] vertexBuffer,
+            int from, int to) {
+        return glContext.updateNativeGeometry(nativeHandle, vertexBuffer,
+                from, to);
+    }
+
     long createES2PhongMaterial() {
         return glContext.createES2PhongMaterial();
     }
@@ -426,6 +454,10 @@ class ES2Context extends BaseShaderContext {
 
     // TODO: 3D - Should this be called dispose?
     void releaseES2MeshView(long nativeHandle) {
+        if (nativeHandle == instancedMeshViewHandle) {
+            instancedMeshView = null;
+            instancedMeshViewHandle = 0L;
+        }
         glContext.releaseES2MeshView(nativeHandle);
     }
 
@@ -471,7 +503,23 @@ class ES2Context extends BaseShaderContext {
 
     void renderMeshView(long nativeHandle, Graphics g, ES2MeshView meshView) {
 
-        ES2Shader shader = getPhongShader(meshView);
+        // The pixel scale applied to projViewTx below is undone in the world
+        // transform, so the mesh is seen through projViewTx and the transform
+        if (isOutsideFrustum(projViewTx, g.getTransformNoClone(),
+                meshView.getMesh().getBounds(), false)) {
+            return;
+        }
+
+        boolean instanced = INSTANCING && glContext.isInstancingSupported();
+        if (instanced && canAddInstance(g, meshView)) {
+            // Same state as the pending instances: only the transform differs
+            updateMeshViewWorldTransform(g);
+            updateRawMatrix(worldTx);
+            glContext.addMeshViewInstance(instancedMeshViewHandle, rawMatrix);
+            return;
+        }
+
+        ES2Shader shader = getPhongShader(meshView, instanced);
         setShaderProgram(shader.getProgramObject());
 
         // Support retina display by scaling the projViewTx and pass it to the shader.
@@ -488,8 +536,29 @@ class ES2Context extends BaseShaderContext {
         shader.setConstant("camPos", (float) cameraPos.x,
                 (float) cameraPos.y, (float)cameraPos.z);
 
+        updateMeshViewWorldTransform(g);
+        updateRawMatrix(worldTx);
+
+        if (!instanced) {
+            shader.setMatrix("worldMatrix", rawMatrix);
+        }
+//        printRawMatrix("worldMatrix");
+
+        ES2PhongShader.setShaderParamaters(shader, meshView, this);
+
+        if (instanced) {
+            rememberInstancedState(g, meshView, nativeHandle);
+            glContext.addMeshViewInstance(nativeHandle, rawMatrix);
+        } else {
+            glContext.renderMeshView(nativeHandle);
+        }
+    }
+
+    private void updateMeshViewWorldTransform(Graphics g) {
         // Undo the SwapChain scaling done in createGraphics() because 3D needs
         // this information in the shader (via projViewTx)
+        float pixelScaleFactorX = g.getPixelScaleFactorX();
+        float pixelScaleFactorY = g.getPixelScaleFactorY();
         BaseTransform xform = g.getTransformNoClone();
         if (pixelScaleFactorX != 1.0 || pixelScaleFactorY != 1.0) {
             scratchAffine3DTx.setToIdentity();
@@ -499,14 +568,48 @@ class ES2Context extends BaseShaderContext {
         } else {
             updateWorldTransform(xform);
         }
-        updateRawMatrix(worldTx);
-
-        shader.setMatrix("worldMatrix", rawMatrix);
-//        printRawMatrix("worldMatrix");
+    }
 
-        ES2PhongShader.setShaderParamaters(shader, meshView, this);
+    private void rememberInstancedState(Graphics g, ES2MeshView meshView,
+            long nativeHandle) {
+        ES2PhongMaterial material = meshView.getMaterial();
+        instancedMeshView = meshView;
+        instancedMeshViewHandle = nativeHandle;
+        instancedMaterialState[0] = material.diffuseColor;
+        instancedMaterialState[1] = material.specularColor;
+        for (int i = 0; i < ES2PhongMaterial.MAX_MAP_TYPE; i++) {
+            instancedMaterialState[2 + i] = material.maps[i].getTexture();
+        }
+        instancedSpecularColorSet = material.specularColorSet;
+        instancedScaleX = g.getPixelScaleFactorX();
+        instancedScaleY = g.getPixelScaleFactorY();
+    }
 
-        glContext.renderMeshView(nativeHandle);
+    /*
+     * Anything that changes the GL state flushes the pending instances in
+     * the glContext, and so does a change to the native state of the pending
+     * mesh view. What is left to compare is the Java state that is read by
+     * setShaderParamaters and the other mesh view.
+     */
+    private boolean canAddInstance(Graphics g, ES2MeshView meshView) {
+        if (!glContext.hasPendingInstances(instancedMeshViewHandle)
+                || !meshView.hasSameState(instancedMeshView)
+                || g.getPixelScaleFactorX() != instancedScaleX
+                || g.getPixelScaleFactorY() != instancedScaleY) {
+            return false;
+        }
+        ES2PhongMaterial material = meshView.getMaterial();
+        if (material.diffuseColor != instancedMaterialState[0]
+                || material.specularColor != instancedMaterialState[1]
+                || material.specularColorSet != instancedSpecularColorSet) {
+            return false;
+        }
+        for (int i = 0; i < ES2PhongMaterial.MAX_MAP_TYPE; i++) {
+            if (material.maps[i].getTexture() != instancedMaterialState[2 + i]) {
+                return false;
+            }
+        }
+        return true;
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -60,6 +60,19 @@ class ES2Light {
         this.falloff = falloff;
     }
 
+    static boolean isSame(ES2Light a, ES2Light b) {
+        if (a == null || b == null) {
+            return a == b;
+        }
+        return a.x == b.x && a.y == b.y && a.z == b.z
+                && a.r == b.r && a.g == b.g && a.b == b.b && a.w == b.w
+                && a.ca == b.ca && a.la == b.la && a.qa == b.qa
+                && a.isAttenuated == b.isAttenuated && a.maxRange == b.maxRange
+                && a.dirX == b.dirX && a.dirY == b.dirY && a.dirZ == b.dirZ
+                && a.innerAngle == b.innerAngle && a.outerAngle == b.outerAngle
+                && a.falloff == b.falloff;
+    }
+
     boolean isPointLight() {
         return falloff == 0 && outerAngle == 180 && isAttenuated > 0.5;
     }
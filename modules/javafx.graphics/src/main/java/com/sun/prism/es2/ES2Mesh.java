@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,6 +78,11 @@ class ES2Mesh extends BaseMesh {
                 vertexBufferLength, indexBufferShort, indexBufferLength);
     }
 
+    @Override
+    public boolean updateNativeGeometry(float[] vertexBuffer, int from, int to) {
+        return context.updateNativeGeometry(nativeHandle, vertexBuffer, from, to);
+    }
+
     static class ES2MeshDisposerRecord implements Disposer.Record {
 
         private final ES2Context context;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,8 @@ class ES2MeshView extends BaseMeshView {
     private float ambientLightRed = 0;
     private float ambientLightBlue = 0;
     private float ambientLightGreen = 0;
+    private int cullingMode;
+    private boolean wireframe;
 
     // NOTE: We only support up to 3 point lights at the present
     private ES2Light[] lights = new ES2Light[3];
@@ -66,6 +68,7 @@ class ES2MeshView extends BaseMeshView {
 
     @Override
     public void setCullingMode(int cullingMode) {
+        this.cullingMode = cullingMode;
         context.setCullingMode(nativeHandle, cullingMode);
     }
 
@@ -77,6 +80,7 @@ class ES2MeshView extends BaseMeshView {
 
     @Override
     public void setWireframe(boolean wireframe) {
+        this.wireframe = wireframe;
         context.setWireframe(nativeHandle, wireframe);
     }
 
@@ -128,6 +132,31 @@ class ES2MeshView extends BaseMeshView {
         return material;
     }
 
+    ES2Mesh getMesh() {
+        return mesh;
+    }
+
+    /**
+     * Returns true if this mesh view renders exactly like the given one
+     * apart from its transform.
+     */
+    boolean hasSameState(ES2MeshView other) {
+        if (mesh != other.mesh || material != other.material
+                || cullingMode != other.cullingMode
+                || wireframe != other.wireframe
+                || ambientLightRed != other.ambientLightRed
+                || ambientLightGreen != other.ambientLightGreen
+                || ambientLightBlue != other.ambientLightBlue) {
+            return false;
+        }
+        for (int i = 0; i < lights.length; i++) {
+            if (!ES2Light.isSame(lights[i], other.lights[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     @Override
     public void dispose() {
         // TODO: 3D - Need a mechanism to "decRefCount" Mesh and Material
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,7 +35,9 @@ class ES2PhongShader {
 
     //dimensions:
     static ES2Shader shaders[][][][][] = null;
+    static ES2Shader instancedShaders[][][][][] = null;
     static String vertexShaderSource;
+    static String instancedVertexShaderSource;
     static String mainFragShaderSource;
 
     enum DiffuseState {
@@ -74,6 +76,8 @@ class ES2PhongShader {
     static {
         shaders = new ES2Shader[DiffuseState.values().length][SpecularState.values().length]
                 [SelfIllumState.values().length][BumpMapState.values().length][lightStateCount];
+        instancedShaders = new ES2Shader[DiffuseState.values().length][SpecularState.values().length]
+                [SelfIllumState.values().length][BumpMapState.values().length][lightStateCount];
 
         //NOTE: When creating new shaders, underscore denotes a "shader part"
         diffuseShaderParts[DiffuseState.NONE.ordinal()] =
@@ -112,6 +116,9 @@ class ES2PhongShader {
                 ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/main3Lights.frag"));
 
         vertexShaderSource = ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/main.vert"));
+        // The instanced variant reads the world matrix from a per-instance attribute
+        instancedVertexShaderSource = vertexShaderSource.replace(
+                "uniform mat4 worldMatrix;", "attribute mat4 worldMatrix;");
 
     }
 
@@ -124,7 +131,8 @@ class ES2PhongShader {
                 SpecularState.COLOR : SpecularState.NONE;
     }
 
-    static ES2Shader getShader(ES2MeshView meshView, ES2Context context) {
+    static ES2Shader getShader(ES2MeshView meshView, ES2Context context,
+            boolean instanced) {
 
         ES2PhongMaterial material = meshView.getMaterial();
 
@@ -150,7 +158,8 @@ class ES2PhongShader {
             if (light != null && light.w > 0) { numLights++; }
         }
 
-        ES2Shader shader = shaders[diffuseState.ordinal()][specularState.ordinal()]
+        ES2Shader[][][][][] cache = instanced ? instancedShaders : shaders;
+        ES2Shader shader = cache[diffuseState.ordinal()][specularState.ordinal()]
                 [selfIllumState.ordinal()][bumpState.ordinal()][numLights];
         if (shader == null) {
             String fragShader = lightingShaderParts[numLights].replace("vec4 apply_diffuse();", diffuseShaderParts[diffuseState.ordinal()]);
@@ -167,6 +176,10 @@ class ES2PhongShader {
             attributes.put("pos", 0);
             attributes.put("texCoords", 1);
             attributes.put("tangent", 2);
+            if (instanced) {
+                // takes the locations 3 to 6, one per column
+                attributes.put("worldMatrix", 3);
+            }
 
             Map<String, Integer> samplers = new HashMap<>();
             samplers.put("diffuseTexture", 0);
@@ -174,10 +187,12 @@ class ES2PhongShader {
             samplers.put("normalMap", 2);
             samplers.put("selfIllumTexture", 3);
 
-            shader = ES2Shader.createFromSource(context, vertexShaderSource, pixelShaders, samplers, attributes, 1, false);
+            shader = ES2Shader.createFromSource(context,
+                    instanced ? instancedVertexShaderSource : vertexShaderSource,
+                    pixelShaders, samplers, attributes, 1, false);
 
 
-            shaders[diffuseState.ordinal()][specularState.ordinal()][selfIllumState.ordinal()]
+            cache[diffuseState.ordinal()][specularState.ordinal()][selfIllumState.ordinal()]
                     [bumpState.ordinal()][numLights] = shader;
         }
         return shader;
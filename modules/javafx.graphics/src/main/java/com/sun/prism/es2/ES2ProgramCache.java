@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.es2;
+
+import com.sun.prism.impl.PrismSettings;
+import java.io.ByteArrayOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.DirectoryStream;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.HexFormat;
+
+/**
+ * On-disk cache of linked shader program binaries.
+ * <p>
+ * Programs are looked up by a digest of their shader sources and attribute
+ * bindings. Entries are kept in a directory named after the driver identity
+ * and the JavaFX version, so a driver update or a new JavaFX release starts
+ * with an empty cache and the directories of other drivers are removed.
+ * A binary that the driver refuses to load is deleted and the program is
+ * compiled from source again.
+ */
+final class ES2ProgramCache {
+
+    private static final int MAGIC = 0x4A465842; // "JFXB"
+
+    private static ES2ProgramCache instance;
+    private static boolean initialized;
+
+    private final Path dir;
+
+    private ES2ProgramCache(Path dir) {
+        this.dir = dir;
+    }
+
+    /**
+     * Returns the program cache for the given context, or null if program
+     * binaries are unsupported or the cache is disabled.
+     */
+    static synchronized ES2ProgramCache get(GLContext glCtx) {
+        if (!initialized) {
+            initialized = true;
+            instance = create();
+        }
+        return (instance != null && glCtx.isProgramBinarySupported()) ? instance : null;
+    }
+
+    private static ES2ProgramCache create() {
+        if (PrismSettings.shaderCacheDir == null) {
+            return null;
+        }
+        try {
+            String identity = GLFactory.getFactory().getDriverIdentity() + "|"
+                    + System.getProperty("javafx.runtime.version", "versionless");
+            Path base = Path.of(PrismSettings.shaderCacheDir);
+            Path dir = base.resolve(digest(identity));
+            Files.createDirectories(dir);
+            removeStaleEntries(base, dir);
+            if (PrismSettings.verbose) {
+                System.out.println("ES2 shader cache: " + dir);
+            }
+            return new ES2ProgramCache(dir);
+        } catch (IOException | RuntimeException e) {
+            if (PrismSettings.verbose) {
+                System.err.println("ES2 shader cache disabled: " + e);
+            }
+            return null;
+        }
+    }
+
+    private static void removeStaleEntries(Path base, Path current) {
+        try (DirectoryStream<Path> dirs = Files.newDirectoryStream(base)) {
+            for (Path stale : dirs) {
+                if (!stale.equals(current) && Files.isDirectory(stale)) {
+                    try (DirectoryStream<Path> files = Files.newDirectoryStream(stale)) {
+                        for (Path file : files) {
+                            Files.deleteIfExists(file);
+                        }
+                    }
+                    Files.deleteIfExists(stale);
+                }
+            }
+        } catch (IOException e) {
+            // stale entries are only a waste of disk space
+        }
+    }
+
+    /**
+     * Returns the cache key of a program built from the given sources and
+     * attribute bindings.
+     */
+    static String key(String vert, String[] frag, String[] attrs, int[] indexs) {
+        StringBuilder sb = new StringBuilder(vert);
+        for (String f : frag) {
+            sb.append('\u0000').append(f);
+        }
+        for (int i = 0; i < attrs.length; i++) {
+            sb.append('\u0000').append(attrs[i]).append('=').append(indexs[i]);
+        }
+        return digest(sb.toString());
+    }
+
+    /**
+     * Creates the program stored under the given key. Returns 0 if there is
+     * no usable entry.
+     */
+    int load(GLContext glCtx, String key) {
+        Path file = dir.resolve(key);
+        if (!Files.isRegularFile(file)) {
+            return 0;
+        }
+        int format;
+        byte[] binary;
+        try (InputStream in = Files.newInputStream(file);
+             DataInputStream data = new DataInputStream(in)) {
+            if (data.readInt() != MAGIC) {
+                throw new IOException("bad magic");
+            }
+            format = data.readInt();
+            binary = data.readAllBytes();
+        } catch (IOException e) {
+            delete(file);
+            return 0;
+        }
+        int programID = glCtx.createProgramFromBinary(format, binary);
+        if (programID == 0) {
+            delete(file);
+        }
+        return programID;
+    }
+
+    /**
+     * Stores the binary of the given linked program under the given key.
+     */
+    void store(GLContext glCtx, String key, int programID) {
+        int[] format = new int[1];
+        byte[] binary = glCtx.getProgramBinary(programID, format);
+        if (binary == null) {
+            return;
+        }
+        Path file = dir.resolve(key);
+        Path tmp = null;
+        try {
+            ByteArrayOutputStream bytes = new ByteArrayOutputStream(binary.length + 8);
+            DataOutputStream data = new DataOutputStream(bytes);
+            data.writeInt(MAGIC);
+            data.writeInt(format[0]);
+            data.write(binary);
+            // Write to a temporary file first so a concurrently starting
+            // application never reads a partial entry
+            tmp = Files.createTempFile(dir, key, ".tmp");
+            try (OutputStream out = Files.newOutputStream(tmp)) {
+                bytes.writeTo(out);
+            }
+            Files.move(tmp, file, StandardCopyOption.REPLACE_EXISTING,
+                    StandardCopyOption.ATOMIC_MOVE);
+        } catch (IOException e) {
+            if (tmp != null) {
+                delete(tmp);
+            }
+        }
+    }
+
+    private static void delete(Path file) {
+        try {
+            Files.deleteIfExists(file);
+        } catch (IOException e) {
+            // ignore, the entry is rewritten on the next store
+        }
+    }
+
+    private static String digest(String s) {
+        try {
+            MessageDigest md = MessageDigest.getInstance("SHA-256");
+            return HexFormat.of().formatHex(md.digest(s.getBytes(StandardCharsets.UTF_8)));
+        } catch (NoSuchAlgorithmException e) {
+            throw new RuntimeException(e);
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import com.sun.glass.ui.Screen;
 import com.sun.prism.Graphics;
 import com.sun.prism.Image;
 import com.sun.prism.PixelFormat;
+import com.sun.prism.PixelReadback;
 import com.sun.prism.RTTexture;
 import com.sun.prism.ReadbackRenderTarget;
 import com.sun.prism.Texture;
@@ -36,6 +37,8 @@ import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.impl.PrismTrace;
 
 import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.IntBuffer;
 
 class ES2RTTexture extends ES2Texture<ES2RTTextureData>
         implements ES2RenderTarget, RTTexture, ReadbackRenderTarget
@@ -336,6 +339,47 @@ class ES2RTTexture extends ES2Texture<ES2RTTextureData>
         return result;
     }
 
+    @Override
+    public PixelReadback readPixelsAsync(Buffer pixels, int x, int y,
+                                         int width, int height) {
+        if (!(pixels instanceof ByteBuffer || pixels instanceof IntBuffer)) {
+            throw new IllegalArgumentException("readPixel: pixel's buffer type is not supported: "
+                    + pixels);
+        }
+        context.flushVertexBuffer();
+        GLContext glContext = context.getGLContext();
+        int id = glContext.getBoundFBO();
+        int fboID = getFboID();
+        boolean changeBoundFBO = id != fboID;
+        if (changeBoundFBO) {
+            glContext.bindFBO(fboID);
+        }
+        long handle = glContext.startReadPixels(x, y, width, height);
+        if (changeBoundFBO) {
+            glContext.bindFBO(id);
+        }
+        if (handle == 0) {
+            return RTTexture.super.readPixelsAsync(pixels, x, y, width, height);
+        }
+        return new PixelReadback() {
+            private boolean finished;
+
+            @Override
+            public boolean isDone() {
+                return finished || glContext.isReadPixelsDone(handle);
+            }
+
+            @Override
+            public boolean finish() {
+                if (finished) {
+                    throw new IllegalStateException("readback already finished");
+                }
+                finished = true;
+                return glContext.finishReadPixels(handle, pixels);
+            }
+        };
+    }
+
     @Override
     public boolean readPixels(Buffer pixels) {
         return readPixels(pixels, getContentX(), getContentY(),
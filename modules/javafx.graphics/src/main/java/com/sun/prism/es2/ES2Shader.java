@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -127,13 +127,35 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
                     + "must be specified");
         }
 
+        String[] attrs = new String[attributes.size()];
+        int[] indexs = new int[attrs.length];
+        int i = 0;
+        for (String attr : attributes.keySet()) {
+            attrs[i] = attr;
+            indexs[i] = attributes.get(attr);
+            i++;
+        }
+
+        // A program loaded from its cached binary owns no shader objects
+        ES2ProgramCache cache = ES2ProgramCache.get(glCtx);
+        String cacheKey = null;
+        if (cache != null) {
+            cacheKey = ES2ProgramCache.key(vert, frag, attrs, indexs);
+            int programID = cache.load(glCtx, cacheKey);
+            if (programID != 0) {
+                return new ES2Shader(context,
+                        programID, 0, new int[0],
+                        samplers, maxTexCoordIndex, isPixcoordUsed);
+            }
+        }
+
         int vertexShaderID = glCtx.compileShader(vert, true);
         if (vertexShaderID == 0) {
             throw new RuntimeException("Error creating vertex shader");
         }
 
         int[] fragmentShaderID = new int[frag.length];
-        for (int i = 0; i < frag.length; i++) {
+        for (i = 0; i < frag.length; i++) {
             fragmentShaderID[i] = glCtx.compileShader(frag[i], false);
             if (fragmentShaderID[i] == 0) {
                 glCtx.deleteShader(vertexShaderID);
@@ -142,14 +164,6 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             }
         }
 
-        String[] attrs = new String[attributes.size()];
-        int[] indexs = new int[attrs.length];
-        int i = 0;
-        for (String attr : attributes.keySet()) {
-            attrs[i] = attr;
-            indexs[i] = attributes.get(attr);
-            i++;
-        }
         int programID = glCtx.createProgram(vertexShaderID, fragmentShaderID,
                 attrs, indexs);
         if (programID == 0) {
@@ -157,6 +171,9 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             // vertexShader and fragmentShader resources
             throw new RuntimeException("Error creating shader program");
         }
+        if (cache != null) {
+            cache.store(glCtx, cacheKey, programID);
+        }
 
         return new ES2Shader(context,
                 programID, vertexShaderID, fragmentShaderID,
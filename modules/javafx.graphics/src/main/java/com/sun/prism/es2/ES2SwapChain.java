@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.prism.es2;
 
 import com.sun.glass.ui.Screen;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.prism.GraphicsResource;
 import com.sun.prism.Presentable;
 import com.sun.prism.PresentableState;
@@ -68,6 +69,7 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
      */
     private RTTexture stableBackbuffer;
     private boolean copyFullBuffer;
+    private long lastPresentTime;
 
     @Override
     public boolean isOpaque() {
@@ -183,18 +185,47 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
 
     @Override
     public boolean present() {
-        boolean presented = drawable.swapBuffers(context.getGLContext());
-        context.makeCurrent(null);
+        GLContext glContext = context.getGLContext();
+        glContext.flushBatch();
+        if (PulseLogger.PULSE_LOGGING_ENABLED) {
+            glContext.endGPUTimer();
+        }
+        boolean presented = drawable.swapBuffers(glContext);
+        long now = System.nanoTime();
+        long vblank = drawable.getLastVBlankTime() * 1000L;
+        // Only trust the vblank time if it is on the same clock
+        lastPresentTime = (vblank > 0L && Math.abs(now - vblank) < 1_000_000_000L)
+                ? vblank : now;
+        glContext.updateFrameStats();
+        if (PulseLogger.PULSE_LOGGING_ENABLED) {
+            // Results trail the frames they measure, so report whatever
+            // has finished without waiting for the GPU
+            for (long gpuTime; (gpuTime = glContext.getGPUTime()) >= 0;) {
+                PulseLogger.gpuTime("Frame", gpuTime);
+            }
+        }
+        if (!PrismSettings.retainES2Drawable) {
+            context.makeCurrent(null);
+        }
         return presented;
     }
 
+    @Override
+    public long getLastPresentTime() {
+        return lastPresentTime;
+    }
+
     @Override
     public ES2Graphics createGraphics() {
         if (drawable.getNativeWindow() != pState.getNativeWindow()) {
+            context.releaseDrawable(drawable);
             drawable = ES2Pipeline.glFactory.createGLDrawable(
                     pState.getNativeWindow(), context.getPixelFormat());
         }
         context.makeCurrent(drawable);
+        if (PulseLogger.PULSE_LOGGING_ENABLED) {
+            context.getGLContext().beginGPUTimer();
+        }
 
         nativeDestHandle = pState.getNativeFrameBuffer();
         if (nativeDestHandle == 0) {
@@ -308,6 +339,7 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
         }
 
         if (drawable != null) {
+            context.releaseDrawable(drawable);
             drawable.dispose();
             drawable = null;
         }
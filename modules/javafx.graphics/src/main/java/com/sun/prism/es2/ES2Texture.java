@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -521,9 +521,13 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
             int elementsInPixel = format.getBytesPerPixelUnit() >> bufferElementSizeLog;
             pixels.position(srcx * elementsInPixel + srcy * (srcscan >> bufferElementSizeLog));
 
+            // Rows are tightly packed unless ROW_LENGTH is used on desktop
+            int bytesPerPixel = format.getBytesPerPixelUnit();
+            int rowBytes = isGL2 ? srcscan : srcw * bytesPerPixel;
             glCtx.texSubImage2D(target, 0,
                     dstx, dsty, srcw, srch,
-                    pixelFormat, pixelType, pixels);
+                    pixelFormat, pixelType, pixels,
+                    rowBytes * (srch - 1) + srcw * bytesPerPixel);
             pixels.position(pos);
         }
         return result;
@@ -584,9 +588,11 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
             glCtx.pixelStorei(GLContext.GL_UNPACK_ALIGNMENT, alignment);
             glCtx.pixelStorei(GLContext.GL_UNPACK_ROW_LENGTH,
                     frame.strideForPlane(0) / alignment);
+            int rows = frame.getHeight();
             glCtx.texSubImage2D(target, 0,
-                    0, 0, srcw, frame.getHeight(),
-                    pixelFormat, pixelType, pixels);
+                    0, 0, srcw, rows,
+                    pixelFormat, pixelType, pixels,
+                    frame.strideForPlane(0) * (rows - 1) + srcw * alignment);
         }
         frame.releaseFrame();
         return result;
@@ -638,7 +644,7 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
             if (savedTex != texID) {
                 glCtx.setBoundTexture(texID);
             }
-            glCtx.updateFilterState(texID, cLFM);
+            glCtx.updateFilterState(texID, cLFM, getUseMipmap());
             if (savedTex != texID) {
                 glCtx.setBoundTexture(savedTex);
             }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.prism.es2;
 
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.nio.IntBuffer;
 import com.sun.javafx.PlatformUtil;
 import com.sun.prism.MeshView;
@@ -115,10 +116,27 @@ abstract class GLContext {
     // Use by Uniform Matrix
     final static int NUM_MATRIX_ELEMENTS          = 16;
 
+    // Opcodes of the state changes recorded for nExecuteBatch
+    final static int BATCH_ACTIVE_TEXTURE         = 1;
+    final static int BATCH_BIND_TEXTURE           = 2;
+    final static int BATCH_BLEND_FUNC             = 3;
+    final static int BATCH_SCISSOR_TEST           = 4;
+    final static int BATCH_USE_PROGRAM            = 5;
+    final static int BATCH_FILTER_STATE           = 6;
+    final static int BATCH_UNIFORM1F              = 7;
+    final static int BATCH_UNIFORM2F              = 8;
+    final static int BATCH_UNIFORM3F              = 9;
+    final static int BATCH_UNIFORM4F              = 10;
+    final static int BATCH_UNIFORM1I              = 11;
+    final static int BATCH_UNIFORM2I              = 12;
+    final static int BATCH_UNIFORM3I              = 13;
+    final static int BATCH_UNIFORM4I              = 14;
+
     long nativeCtxInfo;
     private int maxTextureSize = -1;
     private Boolean nonPowTwoExtAvailable;
     private Boolean clampToZeroAvailable;
+    private Boolean programBinarySupported;
 
     // TODO : Consider moving these cached values to ES2Context.
     // track some other state here to avoid redundant state changes
@@ -130,11 +148,36 @@ abstract class GLContext {
     private boolean msaa = false;
     private int maxSampleSize = -1;
 
+    // State changes and uniform updates are recorded into [batch] and
+    // executed by a single nExecuteBatch call before the next native call
+    // that depends on them (a draw, a query, a resource update or a swap)
+    private static final boolean BATCH_STATE = PrismSettings.batchES2State;
+    private static final int BATCH_WORDS = 1024;
+    private ByteBuffer batch;
+
+    // Consecutive draws of one mesh view whose state only differs by the
+    // world transform are kept here and issued as a single instanced draw
+    // when the batch is flushed, see ES2Context.renderMeshView
+    private static final int MAX_INSTANCES = 256;
+    private long instancedMeshView;
+    private int numInstances;
+    private float[] instanceMatrices;
+    private Boolean instancingSupported;
+
+    // Texture upload statistics, see prism.printStats
+    private static final int STATS_FREQUENCY = PrismSettings.prismStatFrequency;
+    private int nFrame;
+    private int numTextureUploads;
+    private int numStreamedUploads;
+    private long uploadBytes;
+    private long uploadNanos;
+
     private static final int FBO_ID_UNSET = -1;
     private static final int FBO_ID_NOCACHE = -2;
     private int nativeFBOID = PlatformUtil.isMac() || PlatformUtil.isIOS() ? FBO_ID_NOCACHE : FBO_ID_UNSET;
 
     private static native void nActiveTexture(long nativeCtxInfo, int texUnit);
+    private static native boolean nBeginGPUTimer(long nativeCtxInfo);
     private static native void nBindFBO(long nativeCtxInfo, int nativeFBOID);
     private static native void nBindTexture(long nativeCtxInfo, int texID);
     private static native void nBlendFunc(int sFactor, int dFactor);
@@ -151,6 +194,8 @@ abstract class GLContext {
     private static native int nCreateProgram(long nativeCtxInfo,
             int vertexShaderID, int[] fragmentShaderID,
             int numAttrs, String[] attrs, int[] indexs);
+    private static native int nCreateProgramFromBinary(long nativeCtxInfo,
+            int format, byte[] binary);
     private static native int nCreateTexture(long nativeCtxInfo, int width,
             int height);
     private static native void nDeleteRenderBuffer(long nativeCtxInfo, int rbID);
@@ -159,13 +204,24 @@ abstract class GLContext {
     private static native void nDeleteTexture(long nativeCtxInfo, int tID);
     private static native void nDisposeShaders(long nativeCtxInfo,
             int pID, int vID, int[] fID);
+    private static native void nEndGPUTimer(long nativeCtxInfo);
     private static native void nFinish();
+    private static native boolean nFinishReadPixelsByte(long nativeCtxInfo,
+            long nativeReadback, int length, Buffer buffer, byte[] pixelArr);
+    private static native boolean nFinishReadPixelsInt(long nativeCtxInfo,
+            long nativeReadback, int length, Buffer buffer, int[] pixelArr);
     private static native int nGenAndBindTexture();
     private static native int nGetFBO();
+    private static native long nGetGPUTime(long nativeCtxInfo);
     private static native int nGetIntParam(int pname);
     private static native int nGetMaxSampleSize();
+    private static native byte[] nGetProgramBinary(long nativeCtxInfo,
+            int programID, int[] format);
     private static native int nGetUniformLocation(long nativeCtxInfo,
             int programID, String name);
+    private static native boolean nIsProgramBinarySupported(long nativeCtxInfo);
+    private static native boolean nIsReadPixelsDone(long nativeCtxInfo,
+            long nativeReadback);
     private static native void nPixelStorei(int pname, int param);
     private static native boolean nReadPixelsByte(long nativeCtxInfo, int length,
             Buffer buffer, byte[] pixelArr, int x, int y, int w, int h);
@@ -173,6 +229,8 @@ abstract class GLContext {
             Buffer buffer, int[] pixelArr, int x, int y, int w, int h);
     private static native void nScissorTest(long nativeCtxInfo, boolean enable,
             int x, int y, int w, int h);
+    private static native long nStartReadPixels(long nativeCtxInfo,
+            int x, int y, int w, int h);
     private static native void nSetDepthTest(long nativeCtxInfo, boolean depthTest);
     private static native void nSetMSAA(long nativeCtxInfo, boolean msaa);
     private static native void nTexParamsMinMax(int min, int max);
@@ -182,12 +240,12 @@ abstract class GLContext {
     private static native boolean nTexImage2D1(int target, int level, int internalFormat,
             int width, int height, int border, int format,
             int type, Object pixels, int pixelsByteOffset, boolean useMipmap);
-    private static native void nTexSubImage2D0(int target, int level,
+    private static native boolean nTexSubImage2D0(long nativeCtxInfo, int target, int level,
             int xoffset, int yoffset, int width, int height, int format,
-            int type, Object pixels, int pixelsByteOffset);
-    private static native void nTexSubImage2D1(int target, int level,
+            int type, Object pixels, int pixelsByteOffset, int pixelsByteCount);
+    private static native boolean nTexSubImage2D1(long nativeCtxInfo, int target, int level,
             int xoffset, int yoffset, int width, int height, int format,
-            int type, Object pixels, int pixelsByteOffset);
+            int type, Object pixels, int pixelsByteOffset, int pixelsByteCount);
     private static native void nUpdateViewport(long nativeCtxInfo, int x, int y,
             int w, int h);
     private static native void nUniform1f(long nativeCtxInfo, int location, float v0);
@@ -215,7 +273,7 @@ abstract class GLContext {
     private static native void nUniformMatrix4fv(long nativeCtxInfo, int location,
             boolean transpose, float values[]);
     private static native void nUpdateFilterState(long nativeCtxInfo, int texID,
-            boolean linearFilter);
+            boolean linearFilter, boolean useMipmap);
     private static native void nUpdateWrapState(long nativeCtxInfo, int texID,
             int wrapMode);
     private static native void nUseProgram(long nativeCtxInfo, int pID);
@@ -235,6 +293,8 @@ abstract class GLContext {
             float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength);
     private static native boolean nBuildNativeGeometryInt(long nativeCtxInfo, long nativeHandle,
             float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength);
+    private static native boolean nUpdateNativeGeometry(long nativeCtxInfo, long nativeHandle,
+            float[] vertexBuffer, int from, int to);
     private static native long nCreateES2PhongMaterial(long nativeCtxInfo);
     private static native void nReleaseES2PhongMaterial(long nativeCtxInfo, long nativeHandle);
     private static native void nSetSolidColor(long nativeCtxInfo, long nativePhongMaterial,
@@ -256,15 +316,58 @@ abstract class GLContext {
             float isAttenuated, float maxRange, float dirX, float dirY, float dirZ,
             float innerAngle, float outerAngle, float falloff);
     private static native void nRenderMeshView(long nativeCtxInfo, long nativeMeshViewInfo);
+    private static native boolean nIsInstancingSupported(long nativeCtxInfo);
+    private static native void nRenderMeshViewInstanced(long nativeCtxInfo,
+            long nativeMeshViewInfo, float[] worldMatrices, int numInstances);
+    private static native void nExecuteBatch(long nativeCtxInfo, ByteBuffer batch,
+            int numWords);
     private static native void nBlit(long nativeCtxInfo, int srcFBO, int dstFBO,
             int srcX0, int srcY0, int srcX1, int srcY1,
             int dstX0, int dstY0, int dstX1, int dstY1);
 
+    private ByteBuffer batch(int opcode, int numArgs) {
+        if (numInstances > 0) {
+            // the pending instances must be drawn with the current state
+            flushBatch();
+        }
+        if (batch == null) {
+            batch = ByteBuffer.allocateDirect(BATCH_WORDS * 4)
+                    .order(ByteOrder.nativeOrder());
+        } else if (batch.remaining() < (numArgs + 1) * 4) {
+            flushBatch();
+        }
+        return batch.putInt(opcode);
+    }
+
+    /*
+     * Executes the recorded state changes and draws the pending mesh
+     * instances. Must be called before anything that reaches the GL outside
+     * of this class, such as making another context current or swapping
+     * buffers.
+     */
+    void flushBatch() {
+        if (batch != null && batch.position() > 0) {
+            nExecuteBatch(nativeCtxInfo, batch, batch.position() >> 2);
+            batch.clear();
+        }
+        if (numInstances > 0) {
+            int n = numInstances;
+            numInstances = 0;
+            nRenderMeshViewInstanced(nativeCtxInfo, instancedMeshView,
+                    instanceMatrices, n);
+        }
+    }
+
     void activeTexture(int texUnit) {
-        nActiveTexture(nativeCtxInfo, texUnit);
+        if (BATCH_STATE) {
+            batch(BATCH_ACTIVE_TEXTURE, 1).putInt(texUnit);
+        } else {
+            nActiveTexture(nativeCtxInfo, texUnit);
+        }
     }
 
     void bindFBO(int nativeFBOID) {
+        flushBatch();
         switch (this.nativeFBOID) {
             case FBO_ID_UNSET:
                 this.nativeFBOID = nativeFBOID;
@@ -283,11 +386,19 @@ abstract class GLContext {
     }
 
     void bindTexture(int texID) {
-        nBindTexture(nativeCtxInfo, texID);
+        if (BATCH_STATE) {
+            batch(BATCH_BIND_TEXTURE, 1).putInt(texID);
+        } else {
+            nBindTexture(nativeCtxInfo, texID);
+        }
     }
 
     void blendFunc(int sFactor, int dFactor) {
-        nBlendFunc(sFactor, dFactor);
+        if (BATCH_STATE) {
+            batch(BATCH_BLEND_FUNC, 2).putInt(sFactor).putInt(dFactor);
+        } else {
+            nBlendFunc(sFactor, dFactor);
+        }
     }
 
     boolean canCreateNonPowTwoTextures() {
@@ -317,6 +428,7 @@ abstract class GLContext {
 
     void clearBuffers(Color color, boolean clearColor,
             boolean clearDepth, boolean ignoreScissor) {
+        flushBatch();
         float r = color.getRedPremult();
         float g = color.getGreenPremult();
         float b = color.getBluePremult();
@@ -330,14 +442,17 @@ abstract class GLContext {
      * a handle to the newly created shader object; otherwise returns 0.
      */
     int compileShader(String shaderSource, boolean vertex) {
+        flushBatch();
         return nCompileShader(nativeCtxInfo, shaderSource, vertex);
     }
 
     int createDepthBuffer(int width, int height, int msaaSamples) {
+        flushBatch();
         return nCreateDepthBuffer(nativeCtxInfo, width, height, msaaSamples);
     }
 
     int createRenderBuffer(int width, int height, int msaaSamples) {
+        flushBatch();
         return nCreateRenderBuffer(nativeCtxInfo, width, height, msaaSamples);
     }
 
@@ -348,6 +463,7 @@ abstract class GLContext {
      * @return FBO id
      */
     int createFBO(int texID) {
+        flushBatch();
         if (nativeFBOID != FBO_ID_NOCACHE) {
             nativeFBOID = FBO_ID_UNSET; // invalidate FBO ID cache
         }
@@ -361,6 +477,7 @@ abstract class GLContext {
      */
     int createProgram(int vertexShaderID, int[] fragmentShaderIDArr,
             String[] attrs, int[] indexs) {
+        flushBatch();
 
         if (fragmentShaderIDArr == null) {
             System.err.println("Error: fragmentShaderIDArr is null");
@@ -386,19 +503,49 @@ abstract class GLContext {
                 attrs.length, attrs, indexs);
     }
 
+    /**
+     * Creates a shader program from a binary previously returned by
+     * getProgramBinary. Returns 0 if the driver rejects the binary.
+     */
+    int createProgramFromBinary(int format, byte[] binary) {
+        flushBatch();
+        return nCreateProgramFromBinary(nativeCtxInfo, format, binary);
+    }
+
+    /**
+     * Returns the driver specific binary of a linked shader program, or null
+     * if it cannot be retrieved. The binary format is stored in format[0].
+     */
+    byte[] getProgramBinary(int programID, int[] format) {
+        flushBatch();
+        return nGetProgramBinary(nativeCtxInfo, programID, format);
+    }
+
+    boolean isProgramBinarySupported() {
+        if (programBinarySupported == null) {
+            flushBatch();
+            programBinarySupported = nIsProgramBinarySupported(nativeCtxInfo);
+        }
+        return programBinarySupported;
+    }
+
     int createTexture(int width, int height) {
+        flushBatch();
         return nCreateTexture(nativeCtxInfo, width, height);
     }
 
     void deleteRenderBuffer(int dbID) {
+        flushBatch();
         nDeleteRenderBuffer(nativeCtxInfo, dbID);
     }
 
     void deleteFBO(int fboID) {
+        flushBatch();
         nDeleteFBO(nativeCtxInfo, fboID);
     }
 
     void deleteShader(int shadeID) {
+        flushBatch();
         nDeleteShader(nativeCtxInfo, shadeID);
     }
 
@@ -406,30 +553,36 @@ abstract class GLContext {
                  int srcX0, int srcY0, int srcX1, int srcY1,
                  int dstX0, int dstY0, int dstX1, int dstY1)
     {
+        flushBatch();
         nBlit(nativeCtxInfo, msaaFboID, dstFboID,
               srcX0, srcY0, srcX1, srcY1,
               dstX0, dstY0, dstX1, dstY1);
     }
 
     void deleteTexture(int tID) {
+        flushBatch();
         nDeleteTexture(nativeCtxInfo, tID);
     }
 
     void disposeShaders(int pID, int vID, int[] fID) {
+        flushBatch();
         nDisposeShaders(nativeCtxInfo, pID, vID, fID);
     }
 
     void finish() {
+        flushBatch();
         nFinish();
     }
 
     int genAndBindTexture() {
+        flushBatch();
         int texID = nGenAndBindTexture();
         boundTextures[activeTexUnit] = texID;
         return texID;
     }
 
     int getBoundFBO() {
+        flushBatch();
         switch (nativeFBOID) {
             case FBO_ID_UNSET:
                 nativeFBOID = nGetFBO();
@@ -494,6 +647,7 @@ abstract class GLContext {
     /***********************************************************/
 
     int getIntParam(int param) {
+        flushBatch();
         return nGetIntParam(param);
     }
 
@@ -503,6 +657,7 @@ abstract class GLContext {
     }
 
     int getMaxSampleSize() {
+        flushBatch();
         if (maxSampleSize > -1) {
             return maxSampleSize;
         }
@@ -518,6 +673,7 @@ abstract class GLContext {
     }
 
     int getUniformLocation(int programID, String name) {
+        flushBatch();
         return nGetUniformLocation(nativeCtxInfo, programID, name);
     }
 
@@ -530,10 +686,12 @@ abstract class GLContext {
     abstract void makeCurrent(GLDrawable drawable);
 
     void pixelStorei(int pname, int param) {
+        flushBatch();
         nPixelStorei(pname, param);
     }
 
     boolean readPixels(Buffer buffer, int x, int y, int w, int h) {
+        flushBatch();
         boolean res = false;
         if (buffer instanceof ByteBuffer) {
             ByteBuffer buf = (ByteBuffer) buffer;
@@ -556,15 +714,85 @@ abstract class GLContext {
         return res;
     }
 
+    /**
+     * Queues a read of the given region of the bound framebuffer into a
+     * pixel pack buffer. Returns a handle to pass to finishReadPixels, or 0
+     * if asynchronous readback is unsupported.
+     */
+    long startReadPixels(int x, int y, int w, int h) {
+        flushBatch();
+        return nStartReadPixels(nativeCtxInfo, x, y, w, h);
+    }
+
+    boolean isReadPixelsDone(long nativeReadback) {
+        return nIsReadPixelsDone(nativeCtxInfo, nativeReadback);
+    }
+
+    /**
+     * Copies the pixels of a started readback into the buffer and releases
+     * the readback. A null buffer discards the pixels.
+     */
+    boolean finishReadPixels(long nativeReadback, Buffer buffer) {
+        flushBatch();
+        if (buffer == null) {
+            return nFinishReadPixelsByte(nativeCtxInfo, nativeReadback, 0, null, null);
+        } else if (buffer instanceof ByteBuffer) {
+            ByteBuffer buf = (ByteBuffer) buffer;
+            byte[] arr = buf.hasArray() ? buf.array() : null;
+            return nFinishReadPixelsByte(nativeCtxInfo, nativeReadback,
+                    buf.capacity(), buffer, arr);
+        } else if (buffer instanceof IntBuffer) {
+            IntBuffer buf = (IntBuffer) buffer;
+            int[] arr = buf.hasArray() ? buf.array() : null;
+            return nFinishReadPixelsInt(nativeCtxInfo, nativeReadback,
+                    buf.capacity() * 4, buffer, arr);
+        }
+        nFinishReadPixelsByte(nativeCtxInfo, nativeReadback, 0, null, null);
+        throw new IllegalArgumentException("readPixel: pixel's buffer type is not supported: "
+                + buffer);
+    }
+
+    /**
+     * Starts measuring the GPU time of the commands that follow. Returns
+     * false if timer queries are unsupported or too many are in flight.
+     */
+    boolean beginGPUTimer() {
+        flushBatch();
+        return nBeginGPUTimer(nativeCtxInfo);
+    }
+
+    void endGPUTimer() {
+        flushBatch();
+        nEndGPUTimer(nativeCtxInfo);
+    }
+
+    /**
+     * Returns the GPU time in nanoseconds of the oldest finished
+     * measurement, or -1 if none has finished yet.
+     */
+    long getGPUTime() {
+        return nGetGPUTime(nativeCtxInfo);
+    }
+
     void scissorTest(boolean enable, int x, int y, int w, int h) {
-        nScissorTest(nativeCtxInfo, enable, x, y, w, h);
+        if (BATCH_STATE) {
+            batch(BATCH_SCISSOR_TEST, 5).putInt(enable ? 1 : 0)
+                    .putInt(x).putInt(y).putInt(w).putInt(h);
+        } else {
+            nScissorTest(nativeCtxInfo, enable, x, y, w, h);
+        }
     }
 
     void setShaderProgram(int progid) {
-        nUseProgram(nativeCtxInfo, progid);
+        if (BATCH_STATE) {
+            batch(BATCH_USE_PROGRAM, 1).putInt(progid);
+        } else {
+            nUseProgram(nativeCtxInfo, progid);
+        }
     }
 
     void texParamsMinMax(int pname, boolean useMipmap) {
+        flushBatch();
         int min = pname;
         int max = pname;
         if (useMipmap) {
@@ -577,6 +805,7 @@ abstract class GLContext {
     boolean texImage2D(int target, int level, int internalFormat,
             int width, int height, int border, int format, int type,
             java.nio.Buffer pixels, boolean useMipmap) {
+        flushBatch();
         boolean result;
         boolean direct = BufferFactory.isDirect(pixels);
         if (direct) {
@@ -591,22 +820,66 @@ abstract class GLContext {
 
     }
 
+    /*
+     * The pixels are streamed through a native upload buffer when the
+     * driver supports it. byteCount is the size of the region of pixels,
+     * starting at its current position, that the upload reads.
+     */
     void texSubImage2D(int target, int level, int xoffset, int yoffset,
-            int width, int height, int format, int type, java.nio.Buffer pixels) {
+            int width, int height, int format, int type, java.nio.Buffer pixels,
+            int byteCount) {
+        flushBatch();
+        long start = STATS_FREQUENCY > 0 ? System.nanoTime() : 0L;
+        boolean streamed;
         boolean direct = BufferFactory.isDirect(pixels);
+        if (pixels != null) {
+            int remaining = pixels.remaining() << ES2Texture.getBufferElementSizeLog(pixels);
+            byteCount = Math.min(byteCount, remaining);
+        }
         if (direct) {
-            nTexSubImage2D0(target, level, xoffset, yoffset, width, height,
+            streamed = nTexSubImage2D0(nativeCtxInfo, target, level,
+                    xoffset, yoffset, width, height,
                     format, type, pixels,
-                    BufferFactory.getDirectBufferByteOffset(pixels));
+                    BufferFactory.getDirectBufferByteOffset(pixels), byteCount);
         } else {
-            nTexSubImage2D1(target, level, xoffset, yoffset, width, height,
+            streamed = nTexSubImage2D1(nativeCtxInfo, target, level,
+                    xoffset, yoffset, width, height,
                     format, type, BufferFactory.getArray(pixels),
-                    BufferFactory.getIndirectBufferByteOffset(pixels));
+                    BufferFactory.getIndirectBufferByteOffset(pixels), byteCount);
+        }
+        if (STATS_FREQUENCY > 0) {
+            uploadNanos += System.nanoTime() - start;
+            numTextureUploads++;
+            if (streamed) {
+                numStreamedUploads++;
+            }
+            if (pixels != null) {
+                uploadBytes += byteCount;
+            }
+        }
+    }
+
+    /*
+     * Prints the texture upload statistics every prism.printStats frames.
+     */
+    void updateFrameStats() {
+        if (STATS_FREQUENCY > 0 && ++nFrame == STATS_FREQUENCY) {
+            nFrame = 0;
+            System.err.println("ES2 Statistics per last " + STATS_FREQUENCY + " frame(s) :\n"
+                    + "\tnumTextureUploads=" + numTextureUploads / STATS_FREQUENCY
+                    + ", numStreamedUploads=" + numStreamedUploads / STATS_FREQUENCY
+                    + ", textureUploadKBytes=" + uploadBytes / 1024 / STATS_FREQUENCY
+                    + ", textureUploadMicros=" + uploadNanos / 1000 / STATS_FREQUENCY);
+            numTextureUploads = 0;
+            numStreamedUploads = 0;
+            uploadBytes = 0L;
+            uploadNanos = 0L;
         }
     }
 
     void updateViewportAndDepthTest(int x, int y, int w, int h,
             boolean depthTest) {
+        flushBatch();
         if (viewportX != x || viewportY != y || viewportWidth != w || viewportHeight != h) {
             viewportX = x;
             viewportY = y;
@@ -621,17 +894,24 @@ abstract class GLContext {
     }
 
     void updateMSAAState(boolean msaa) {
+        flushBatch();
         if (this.msaa != msaa) {
             nSetMSAA(nativeCtxInfo, msaa);
             this.msaa = msaa;
         }
     }
 
-    void updateFilterState(int texID, boolean linearFilter) {
-        nUpdateFilterState(nativeCtxInfo, texID, linearFilter);
+    void updateFilterState(int texID, boolean linearFilter, boolean useMipmap) {
+        if (BATCH_STATE) {
+            batch(BATCH_FILTER_STATE, 2).putInt(texID)
+                    .putInt((linearFilter ? 1 : 0) | (useMipmap ? 2 : 0));
+        } else {
+            nUpdateFilterState(nativeCtxInfo, texID, linearFilter, useMipmap);
+        }
     }
 
     void updateWrapState(int texID, WrapMode wrapMode) {
+        flushBatch();
         int wm;
         switch (wrapMode) {
             case REPEAT_SIMULATED:  // mode should not matter for this case
@@ -655,22 +935,39 @@ abstract class GLContext {
     }
 
     void uniform1f(int location, float v0) {
-        nUniform1f(nativeCtxInfo, location, v0);
+        if (BATCH_STATE) {
+            batch(BATCH_UNIFORM1F, 2).putInt(location).putFloat(v0);
+        } else {
+            nUniform1f(nativeCtxInfo, location, v0);
+        }
     }
 
     void uniform2f(int location, float v0, float v1) {
-        nUniform2f(nativeCtxInfo, location, v0, v1);
+        if (BATCH_STATE) {
+            batch(BATCH_UNIFORM2F, 3).putInt(location).putFloat(v0).putFloat(v1);
+        } else {
+            nUniform2f(nativeCtxInfo, location, v0, v1);
+        }
     }
 
     void uniform3f(int location, float v0, float v1, float v2) {
-        nUniform3f(nativeCtxInfo, location, v0, v1, v2);
+        if (BATCH_STATE) {
+            batch(BATCH_UNIFORM3F, 4).putInt(location).putFloat(v0).putFloat(v1).putFloat(v2);
+        } else {
+            nUniform3f(nativeCtxInfo, location, v0, v1, v2);
+        }
     }
 
     void uniform4f(int location, float v0, float v1, float v2, float v3) {
-        nUniform4f(nativeCtxInfo, location, v0, v1, v2, v3);
+        if (BATCH_STATE) {
+            batch(BATCH_UNIFORM4F, 5).putInt(location).putFloat(v0).putFloat(v1).putFloat(v2).putFloat(v3);
+        } else {
+            nUniform4f(nativeCtxInfo, location, v0, v1, v2, v3);
+        }
     }
 
     void uniform4fv(int location, int count, java.nio.FloatBuffer value) {
+        flushBatch();
         boolean direct = BufferFactory.isDirect(value);
         if (direct) {
             nUniform4fv0(nativeCtxInfo, location, count, value,
@@ -682,22 +979,39 @@ abstract class GLContext {
     }
 
     void uniform1i(int location, int v0) {
-        nUniform1i(nativeCtxInfo, location, v0);
+        if (BATCH_STATE) {
+            batch(BATCH_UNIFORM1I, 2).putInt(location).putInt(v0);
+        } else {
+            nUniform1i(nativeCtxInfo, location, v0);
+        }
     }
 
     void uniform2i(int location, int v0, int v1) {
-        nUniform2i(nativeCtxInfo, location, v0, v1);
+        if (BATCH_STATE) {
+            batch(BATCH_UNIFORM2I, 3).putInt(location).putInt(v0).putInt(v1);
+        } else {
+            nUniform2i(nativeCtxInfo, location, v0, v1);
+        }
     }
 
     void uniform3i(int location, int v0, int v1, int v2) {
-        nUniform3i(nativeCtxInfo, location, v0, v1, v2);
+        if (BATCH_STATE) {
+            batch(BATCH_UNIFORM3I, 4).putInt(location).putInt(v0).putInt(v1).putInt(v2);
+        } else {
+            nUniform3i(nativeCtxInfo, location, v0, v1, v2);
+        }
     }
 
     void uniform4i(int location, int v0, int v1, int v2, int v3) {
-        nUniform4i(nativeCtxInfo, location, v0, v1, v2, v3);
+        if (BATCH_STATE) {
+            batch(BATCH_UNIFORM4I, 5).putInt(location).putInt(v0).putInt(v1).putInt(v2).putInt(v3);
+        } else {
+            nUniform4i(nativeCtxInfo, location, v0, v1, v2, v3);
+        }
     }
 
     void uniform4iv(int location, int count, java.nio.IntBuffer value) {
+        flushBatch();
         boolean direct = BufferFactory.isDirect(value);
         if (direct) {
             nUniform4iv0(nativeCtxInfo, location, count, value,
@@ -709,82 +1023,108 @@ abstract class GLContext {
     }
 
     void uniformMatrix4fv(int location, boolean transpose, float values[]) {
+        flushBatch();
         nUniformMatrix4fv(nativeCtxInfo, location, transpose, values);
     }
 
     void enableVertexAttributes() {
+        flushBatch();
         nEnableVertexAttributes(nativeCtxInfo);
     }
 
     void disableVertexAttributes() {
+        flushBatch();
         nDisableVertexAttributes(nativeCtxInfo);
     }
 
     void drawIndexedQuads(float coords[], byte colors[], int numVertices) {
+        flushBatch();
         nDrawIndexedQuads(nativeCtxInfo, numVertices, coords, colors);
     }
 
     int createIndexBuffer16(short data[]) {
+        flushBatch();
         return nCreateIndexBuffer16(nativeCtxInfo, data, data.length);
     }
 
     void setIndexBuffer(int ib) {
+        flushBatch();
         nSetIndexBuffer(nativeCtxInfo, ib);
     }
 
     void setDeviceParametersFor2D() {
+        flushBatch();
         nSetDeviceParametersFor2D(nativeCtxInfo);
     }
 
     void setDeviceParametersFor3D() {
+        flushBatch();
         nSetDeviceParametersFor3D(nativeCtxInfo);
     }
 
     long createES2Mesh() {
+        flushBatch();
         return nCreateES2Mesh(nativeCtxInfo);
     }
 
     void releaseES2Mesh(long nativeHandle) {
+        flushBatch();
         nReleaseES2Mesh(nativeCtxInfo, nativeHandle);
     }
 
     boolean buildNativeGeometry(long nativeHandle, float[] vertexBuffer,
             int vertexBufferLength, short[] indexBuffer, int indexBufferLength) {
+        flushBatch();
         return nBuildNativeGeometryShort(nativeCtxInfo, nativeHandle,
                 vertexBuffer, vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
     boolean buildNativeGeometry(long nativeHandle, float[] vertexBuffer,
             int vertexBufferLength, int[] indexBuffer, int indexBufferLength) {
+        flushBatch();
         return nBuildNativeGeometryInt(nativeCtxInfo, nativeHandle, vertexBuffer,
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeGeometry(long nativeHandle, float[] vertexBuffer,
+            int from, int to) {
+        flushBatch();
+        return nUpdateNativeGeometry(nativeCtxInfo, nativeHandle, vertexBuffer,
+                from, to);
+    }
+
     long createES2PhongMaterial() {
+        flushBatch();
         return nCreateES2PhongMaterial(nativeCtxInfo);
     }
 
     void releaseES2PhongMaterial(long nativeHandle) {
+        flushBatch();
         nReleaseES2PhongMaterial(nativeCtxInfo, nativeHandle);
     }
 
     void setSolidColor(long nativePhongMaterial, float r, float g, float b, float a) {
+        flushBatch();
         nSetSolidColor(nativeCtxInfo, nativePhongMaterial, r, g, b, a);
     }
 
     void setMap(long nativePhongMaterial, int mapType, int texID) {
+        flushBatch();
         nSetMap(nativeCtxInfo, nativePhongMaterial, mapType, texID);
     }
 
     long createES2MeshView(long nativeMeshInfo) {
+        flushBatch();
         return nCreateES2MeshView(nativeCtxInfo, nativeMeshInfo);
     }
 
     void releaseES2MeshView(long nativeHandle) {
+        flushBatch();
         nReleaseES2MeshView(nativeCtxInfo, nativeHandle);
     }
 
     void setCullingMode(long nativeMeshViewInfo, int cullMode) {
+        flushInstances(nativeMeshViewInfo);
         int cm;
         if (cullMode == MeshView.CULL_NONE) {
             cm = GL_NONE;
@@ -799,25 +1139,71 @@ abstract class GLContext {
     }
 
     void setMaterial(long nativeMeshViewInfo, long nativePhongMaterialInfo) {
+        flushInstances(nativeMeshViewInfo);
         nSetMaterial(nativeCtxInfo, nativeMeshViewInfo, nativePhongMaterialInfo);
     }
 
     void setWireframe(long nativeMeshViewInfo, boolean wireframe) {
+        flushInstances(nativeMeshViewInfo);
         nSetWireframe(nativeCtxInfo, nativeMeshViewInfo, wireframe);
     }
 
     void setAmbientLight(long nativeMeshViewInfo, float r, float g, float b) {
+        flushInstances(nativeMeshViewInfo);
         nSetAmbientLight(nativeCtxInfo, nativeMeshViewInfo, r, g, b);
     }
 
     void setLight(long nativeMeshViewInfo, int index, float x, float y, float z, float r, float g, float b, float w,
             float ca, float la, float qa, float isAttenuated, float maxRange, float dirX, float dirY, float dirZ,
             float innerAngle, float outerAngle, float falloff) {
+        flushInstances(nativeMeshViewInfo);
         nSetLight(nativeCtxInfo, nativeMeshViewInfo, index, x, y, z, r, g, b, w, ca, la, qa, isAttenuated,
                 maxRange, dirX, dirY, dirZ, innerAngle, outerAngle, falloff);
     }
 
     void renderMeshView(long nativeMeshViewInfo) {
+        flushBatch();
         nRenderMeshView(nativeCtxInfo, nativeMeshViewInfo);
     }
+
+    boolean isInstancingSupported() {
+        if (instancingSupported == null) {
+            flushBatch();
+            instancingSupported = nIsInstancingSupported(nativeCtxInfo);
+        }
+        return instancingSupported;
+    }
+
+    /**
+     * Returns true if draws of the given mesh view are pending, so that
+     * another instance can be added without setting up any state.
+     */
+    boolean hasPendingInstances(long nativeMeshViewInfo) {
+        return numInstances > 0 && instancedMeshView == nativeMeshViewInfo;
+    }
+
+    /**
+     * Adds an instance of the given mesh view, drawn with the given world
+     * matrix in column major order and the state current at this point.
+     */
+    void addMeshViewInstance(long nativeMeshViewInfo, float[] worldMatrix) {
+        if (numInstances > 0 && (instancedMeshView != nativeMeshViewInfo
+                || numInstances == MAX_INSTANCES)) {
+            flushBatch();
+        }
+        if (instanceMatrices == null) {
+            instanceMatrices = new float[MAX_INSTANCES * 16];
+        }
+        instancedMeshView = nativeMeshViewInfo;
+        System.arraycopy(worldMatrix, 0, instanceMatrices, numInstances * 16, 16);
+        numInstances++;
+    }
+
+    // The native mesh view state is only read when the instances are drawn,
+    // so changes to other mesh views do not need to flush them
+    private void flushInstances(long nativeMeshViewInfo) {
+        if (hasPendingInstances(nativeMeshViewInfo)) {
+            flushBatch();
+        }
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,4 +54,12 @@ abstract class GLDrawable implements GraphicsResource {
         return nativeDrawableInfo;
     }
     abstract boolean swapBuffers(GLContext glCtx);
+
+    /**
+     * Returns the time of the most recent vertical blank in microseconds of
+     * the system's monotonic clock, or 0 if the platform does not report it.
+     */
+    long getLastVBlankTime() {
+        return 0L;
+    }
 }
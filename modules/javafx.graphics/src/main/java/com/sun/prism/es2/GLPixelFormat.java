@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.prism.es2;
 
 import java.lang.annotation.Native;
+import com.sun.prism.impl.PrismSettings;
 
 class GLPixelFormat {
     final private Attributes attributes;
@@ -64,8 +65,9 @@ class GLPixelFormat {
         @Native final static int DEPTH_SIZE    = 4;
         @Native final static int DOUBLEBUFFER  = 5;
         @Native final static int ONSCREEN      = 6;
+        @Native final static int GPU_PREFERENCE = 7;
 
-        @Native final static int NUM_ITEMS     = 7;
+        @Native final static int NUM_ITEMS     = 8;
 
         private boolean onScreen;
         private boolean doubleBuffer;
@@ -126,6 +128,10 @@ class GLPixelFormat {
             return redSize;
         }
 
+        int getGPUPreference() {
+            return PrismSettings.gpuPreference;
+        }
+
         void setOnScreen(boolean os) {
             onScreen = os;
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -102,6 +102,7 @@ class MacGLFactory extends GLFactory {
         attrArr[GLPixelFormat.Attributes.DEPTH_SIZE] = attrs.getDepthSize();
         attrArr[GLPixelFormat.Attributes.DOUBLEBUFFER] = attrs.isDoubleBuffer() ? 1 : 0;
         attrArr[GLPixelFormat.Attributes.ONSCREEN] = attrs.isOnScreen() ? 1 : 0;
+        attrArr[GLPixelFormat.Attributes.GPU_PREFERENCE] = attrs.getGPUPreference();
 
         // return the context info object create on the default screen
         nativeCtxInfo = nInitialize(attrArr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,7 @@ class MacGLPixelFormat extends GLPixelFormat {
         attrArr[GLPixelFormat.Attributes.DEPTH_SIZE] = attrs.getDepthSize();
         attrArr[GLPixelFormat.Attributes.DOUBLEBUFFER] = attrs.isDoubleBuffer() ? 1 : 0;
         attrArr[GLPixelFormat.Attributes.ONSCREEN] = attrs.isOnScreen() ? 1 : 0;
+        attrArr[GLPixelFormat.Attributes.GPU_PREFERENCE] = attrs.getGPUPreference();
         long nativePF = nCreatePixelFormat(nativeScreen, attrArr);
         setNativePFInfo(nativePF);
 
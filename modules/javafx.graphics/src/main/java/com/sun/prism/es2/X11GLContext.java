@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,7 @@
 
 package com.sun.prism.es2;
 
-
+import com.sun.prism.impl.PrismSettings;
 
 class X11GLContext extends GLContext {
 
@@ -33,6 +33,7 @@ class X11GLContext extends GLContext {
             boolean vSyncRequest);
     private static native long nGetNativeHandle(long nativeCtxInfo);
     private static native void nMakeCurrent(long nativeCtxInfo, long nativeDInfo);
+    private static native boolean nSetAdaptiveVSync(long nativeCtxInfo, boolean adaptive);
 
     X11GLContext(long nativeCtxInfo) {
         this.nativeCtxInfo = nativeCtxInfo;
@@ -57,6 +58,11 @@ class X11GLContext extends GLContext {
         // return the context info object created on the default screen
         nativeCtxInfo = nInitialize(drawable.getNativeDrawableInfo(),
                 pixelFormat.getNativePFInfo(), vSyncRequest);
+        if (vSyncRequest && PrismSettings.isAdaptiveVsyncEnabled
+                && !nSetAdaptiveVSync(nativeCtxInfo, true)
+                && PrismSettings.verbose) {
+            System.err.println("Adaptive vsync is not supported, using vsync");
+        }
     }
 
     @Override
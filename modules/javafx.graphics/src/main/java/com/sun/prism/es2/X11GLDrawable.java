@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@ class X11GLDrawable extends GLDrawable {
     private static native void nReleaseDrawable(long nativeCtxInfo);
     private static native long nGetDummyDrawable(long nativeCtxInfo);
     private static native boolean nSwapBuffers(long nativeDInfo);
+    private static native long nGetLastVBlankTime(long nativeDInfo);
 
     X11GLDrawable(GLPixelFormat pixelFormat) {
 
@@ -51,6 +52,11 @@ class X11GLDrawable extends GLDrawable {
         return nSwapBuffers(getNativeDrawableInfo());
     }
 
+    @Override
+    long getLastVBlankTime() {
+        return nGetLastVBlankTime(getNativeDrawableInfo());
+    }
+
     @Override
     public void dispose() {
         nReleaseDrawable(nativeDrawableInfo);
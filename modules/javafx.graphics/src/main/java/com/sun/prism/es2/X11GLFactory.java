@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,9 @@
 
 package com.sun.prism.es2;
 
+import com.sun.javafx.PlatformUtil;
 import com.sun.prism.es2.GLPixelFormat.Attributes;
+import com.sun.prism.impl.PrismSettings;
 import java.util.HashMap;
 
 class X11GLFactory extends GLFactory {
@@ -132,6 +134,15 @@ class X11GLFactory extends GLFactory {
     @Override
     boolean initialize(Class psClass, Attributes attrs) {
 
+        // Glass windows on the GDK Wayland backend have no X window to
+        // render to with GLX, so they are painted by the software pipeline
+        if (PlatformUtil.useWayland()) {
+            if (PrismSettings.verbose) {
+                System.out.println("GLX is not available with the GDK Wayland backend");
+            }
+            return false;
+        }
+
         // holds the list of attributes to be translated for native call
         int attrArr[] = new int[GLPixelFormat.Attributes.NUM_ITEMS];
 
@@ -142,6 +153,7 @@ class X11GLFactory extends GLFactory {
         attrArr[GLPixelFormat.Attributes.DEPTH_SIZE] = attrs.getDepthSize();
         attrArr[GLPixelFormat.Attributes.DOUBLEBUFFER] = attrs.isDoubleBuffer() ? 1 : 0;
         attrArr[GLPixelFormat.Attributes.ONSCREEN] = attrs.isOnScreen() ? 1 : 0;
+        attrArr[GLPixelFormat.Attributes.GPU_PREFERENCE] = attrs.getGPUPreference();
 
         // return the context info object create on the default screen
         nativeCtxInfo = nInitialize(attrArr);
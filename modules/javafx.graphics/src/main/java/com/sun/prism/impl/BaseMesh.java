@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.prism.impl;
 
+import com.sun.javafx.geom.BaseBounds;
+import com.sun.javafx.geom.BoxBounds;
 import com.sun.javafx.geom.Quat4f;
 import com.sun.javafx.geom.Vec2f;
 import com.sun.javafx.geom.Vec3f;
@@ -48,6 +50,7 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
     private int[] smoothing;
     private boolean allSameSmoothing;
     private boolean allHardEdges;
+    private final BoxBounds bounds = new BoxBounds();
 
     protected static final int POINT_SIZE = 3;
     protected static final int NORMAL_SIZE = 3;
@@ -72,12 +75,46 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
         super(disposerRecord);
     }
 
+    /**
+     * Returns the bounds of all the points of this mesh, computed when its
+     * geometry was last built.
+     */
+    public BaseBounds getBounds() {
+        return bounds;
+    }
+
+    private void updateBounds(float[] points) {
+        if (points.length < POINT_SIZE) {
+            bounds.makeEmpty();
+            return;
+        }
+        float minX = points[0], minY = points[1], minZ = points[2];
+        float maxX = minX, maxY = minY, maxZ = minZ;
+        for (int i = POINT_SIZE; i + 2 < points.length; i += POINT_SIZE) {
+            float x = points[i], y = points[i + 1], z = points[i + 2];
+            if (x < minX) minX = x; else if (x > maxX) maxX = x;
+            if (y < minY) minY = y; else if (y > maxY) maxY = y;
+            if (z < minZ) minZ = z; else if (z > maxZ) maxZ = z;
+        }
+        bounds.setBounds(minX, minY, minZ, maxX, maxY, maxZ);
+    }
+
     public abstract boolean buildNativeGeometry(float[] vertexBuffer,
             int vertexBufferLength, int[] indexBufferInt, int indexBufferLength);
 
     public abstract boolean buildNativeGeometry(float[] vertexBuffer,
             int vertexBufferLength, short[] indexBufferShort, int indexBufferLength);
 
+    /**
+     * Sends the elements [from, to) of the vertex buffer of geometry that was
+     * previously built, leaving the index buffer unchanged. Returns false if
+     * the pipeline cannot update a part of its buffers, in which case the
+     * whole geometry is built again.
+     */
+    public boolean updateNativeGeometry(float[] vertexBuffer, int from, int to) {
+        return false;
+    }
+
     private boolean[] dirtyVertices;
     private float[] cachedNormals;
     private float[] cachedTangents;
@@ -490,6 +527,22 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
         convertNormalsToQuats(instance, numberOfVertices,
                 cachedNormals, cachedTangents, cachedBitangents, vertexBuffer, dirtyVertices);
 
+        int firstDirty = 0;
+        while (firstDirty < numberOfVertices && !dirtyVertices[firstDirty]) {
+            firstDirty++;
+        }
+        if (firstDirty == numberOfVertices) {
+            return true;
+        }
+        int lastDirty = numberOfVertices - 1;
+        while (!dirtyVertices[lastDirty]) {
+            lastDirty--;
+        }
+        if (updateNativeGeometry(vertexBuffer, firstDirty * VERTEX_SIZE_VB,
+                (lastDirty + 1) * VERTEX_SIZE_VB)) {
+            return true;
+        }
+
         if (indexBuffer != null) {
             return buildNativeGeometry(vertexBuffer,
                     numberOfVertices * VERTEX_SIZE_VB, indexBuffer, indexBufferSize);
@@ -507,6 +560,7 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
             float[] texCoords, int[] texCoordsFromAndLengthIndices,
             int[] faces, int[] facesFromAndLengthIndices,
             int[] faceSmoothingGroups, int[] faceSmoothingGroupsFromAndLengthIndices) {
+        updateBounds(points);
         if (userDefinedNormals) {
             return buildPNTGeometry(points, pointsFromAndLengthIndices,
                     normals, normalsFromAndLengthIndices,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -185,6 +185,7 @@ public abstract class BaseResourceFactory implements ResourceFactory {
                         + useMipmap + ", wrapMode = " + wrapMode);
             }
             texCache = clampTexCache;
+            useMipmap = PrismSettings.mipmapImages;
         } else if (wrapMode == WrapMode.REPEAT) {
             texCache = useMipmap ? mipmapTexCache : repeatTexCache;
         } else {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.prism.impl;
 
 import java.lang.ref.WeakReference;
+import java.util.ArrayList;
 
 /**
  * The base implementation of the {@link ResourcePool} interface, providing
@@ -74,6 +75,14 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
     private final Thread managerThread;
     private WeakLinkedList<T> resourceHead;
 
+    // Statistics, see getStatistics()
+    private long peakManaged;
+    private long numAllocations;
+    private long numEvictions;
+    private long evictedSize;
+    private long numTargetGrowths;
+    private long numFailedAllocations;
+
     protected BaseResourcePool(long target, long max) {
         this(null, target, max);
     }
@@ -106,6 +115,8 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
      *      limits for the maximum age of the resource.
      * <li> Go through more passes cleaning out even interesting resources that
      *      have not been used in a fairly long time with decreasing age limits.
+     *      Within a pass the least recently used resources go first and the
+     *      pass stops as soon as enough room has been reclaimed.
      * <li> Attempt to grow the target to accommodate the new request.
      * <li> Finally, prune any resources that are not currently in the process
      *      of being used (i.e. locked or permanent).
@@ -142,7 +153,7 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
                 if (PrismSettings.poolDebug) {
                     System.err.println(stageReasons[stage]+" in pool: "+this);
                 }
-                cleanup(stageTesters[stage]);
+                cleanupLeastRecentlyUsed(stageTesters[stage], wanted);
                 if (used() + wanted <= target()) return true;
             }
 
@@ -160,6 +171,7 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
                     grow = rem;
                 }
                 setTarget(used() + grow);
+                numTargetGrowths++;
                 if (PrismSettings.poolDebug || PrismSettings.verbose) {
                     System.err.printf("Growing pool %s target to %,d\n", this, target());
                 }
@@ -175,6 +187,7 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
                 if (used() + needed <= max()) {
                     if (used() + needed > target()) {
                         setTarget(used() + needed);
+                        numTargetGrowths++;
                         if (PrismSettings.poolDebug || PrismSettings.verbose) {
                             System.err.printf("Growing pool %s target to %,d\n", this, target());
                         }
@@ -185,6 +198,7 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
 
             // That was our last gasp, we either succeeded in making room under
             // the max() amount or we failed and need to return false.
+            numFailedAllocations++;
             return false;
         } finally {
             if (PrismSettings.poolDebug) {
@@ -217,6 +231,40 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
         cleanup((mr) -> { return true; });
     }
 
+    /*
+     * Frees the unlocked resources accepted by the predicate, least recently
+     * used first, until the wanted amount fits under the target.
+     */
+    private void cleanupLeastRecentlyUsed(Predicate predicate, long wanted) {
+        ArrayList<ManagedResource<T>> candidates = new ArrayList<>();
+        for (WeakLinkedList<T> cur = resourceHead.next; cur != null; cur = cur.next) {
+            ManagedResource<T> mr = cur.getResource();
+            if (mr != null && mr.isValid() && !mr.isPermanent() &&
+                !mr.isLocked() && predicate.test(mr))
+            {
+                candidates.add(mr);
+            }
+        }
+        candidates.sort((a, b) -> Integer.compare(b.getAge(), a.getAge()));
+        long freed = 0;
+        for (ManagedResource<T> mr : candidates) {
+            if (used() - freed + wanted <= target()) {
+                break;
+            }
+            long size = size(mr.resource);
+            if (PrismSettings.poolDebug) {
+                System.err.printf("pruning: %s (size=%,d) (age=%d)\n", mr, size, mr.getAge());
+            }
+            mr.free();
+            mr.resource = null;
+            freed += size;
+            numEvictions++;
+            evictedSize += size;
+        }
+        // Unlink the freed resources and account for their space
+        cleanup((mr) -> { return false; });
+    }
+
     private void cleanup(Predicate predicate) {
         WeakLinkedList<T> prev = resourceHead;
         WeakLinkedList<T> cur = prev.next;
@@ -234,6 +282,8 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
                 if (PrismSettings.poolDebug) showLink("pruning", cur, true);
                 mr.free();
                 mr.resource = null;
+                numEvictions++;
+                evictedSize += cur.size;
                 recordFree(cur.size);
                 cur = cur.next;
                 prev.next = cur;
@@ -372,6 +422,10 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
         printpoolpercent(numlocked, total, "locked");
         printpoolpercent(numinteresting, total, "contain interesting data");
         printpoolpercent(numgone, total, "disappeared");
+        System.err.printf("%,d allocated, %,d evicted (%,d), %,d target growths, " +
+                          "%,d failed, %,d peak managed\n",
+                          numAllocations, numEvictions, evictedSize,
+                          numTargetGrowths, numFailedAllocations, peakManaged);
     }
 
     private static void printpoolpercent(int stat, int total, String desc) {
@@ -433,6 +487,9 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
     @Override
     public final void recordAllocated(long size) {
         managedSize += size;
+        if (managedSize > peakManaged) {
+            peakManaged = managedSize;
+        }
     }
 
     @Override
@@ -440,6 +497,14 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
         long size = size(mr.resource);
         resourceHead.insert(mr, size);
         recordAllocated(size);
+        numAllocations++;
+    }
+
+    @Override
+    public Statistics getStatistics() {
+        return new Statistics(managedSize, peakManaged, curTarget, maxSize,
+                              numAllocations, numEvictions, evictedSize,
+                              numTargetGrowths, numFailedAllocations);
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,9 +35,8 @@ import com.sun.javafx.geom.Rectangle;
 import com.sun.javafx.geom.Point2D;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.scene.text.GlyphList;
-import com.sun.prism.impl.packrect.RectanglePacker;
+import com.sun.prism.impl.packrect.SkylinePacker;
 import com.sun.prism.Texture;
-import com.sun.prism.impl.shape.MaskData;
 import com.sun.prism.paint.Color;
 
 import java.nio.ByteBuffer;
@@ -61,7 +60,9 @@ public class GlyphCache {
     // to 1/4 of the strikes.
     private static final int WIDTH = PrismSettings.glyphCacheWidth; // in pixels
     private static final int HEIGHT = PrismSettings.glyphCacheHeight; // in pixels
-    private static ByteBuffer emptyMask;
+    // Staging buffer for a glyph and its blank boundary
+    private static ByteBuffer glyphMask;
+    private static byte[] zeroRow;
 
     private final BaseContext context;
     private final FontStrike strike;
@@ -77,17 +78,17 @@ public class GlyphCache {
     // Using them for subpixel
     private static final int SUBPIXEL_SHIFT = 27;
 
-    private RectanglePacker packer;
+    private SkylinePacker packer;
 
     private boolean isLCDCache;
 
-    /* Share a RectanglePacker and its associated texture cache
+    /* Share a SkylinePacker and its associated texture cache
      * for all uses on a particular screen.
      */
-    static WeakHashMap<BaseContext, RectanglePacker> greyPackerMap =
+    static WeakHashMap<BaseContext, SkylinePacker> greyPackerMap =
         new WeakHashMap<>();
 
-    static WeakHashMap<BaseContext, RectanglePacker> lcdPackerMap =
+    static WeakHashMap<BaseContext, SkylinePacker> lcdPackerMap =
         new WeakHashMap<>();
 
     public GlyphCache(BaseContext context, FontStrike strike) {
@@ -97,7 +98,7 @@ public class GlyphCache {
         //int numSegments = (numGlyphs + SEGSIZE-1)/SEGSIZE;
         //this.glyphs = new GlyphData[numSegments][];
         isLCDCache = strike.getAAMode() == FontResource.AA_LCD;
-        WeakHashMap<BaseContext, RectanglePacker>
+        WeakHashMap<BaseContext, SkylinePacker>
             packerMap = isLCDCache ? lcdPackerMap : greyPackerMap;
         packer = packerMap.get(context);
         if (packer == null) {
@@ -110,7 +111,7 @@ public class GlyphCache {
                 factory.setGlyphTexture(tex);
             }
             tex.setLinearFiltering(false);
-            packer = new RectanglePacker(tex, WIDTH, HEIGHT);
+            packer = new SkylinePacker(tex, WIDTH, HEIGHT);
             packerMap.put(context, packer);
         }
     }
@@ -257,28 +258,25 @@ public class GlyphCache {
         Glyph glyph = strike.getGlyph(glyphCode);
         if (glyph != null) {
             byte[] glyphImage = glyph.getPixelData(subPixel);
-            if (glyphImage == null || glyphImage.length == 0) {
+            if (glyphImage == null || glyphImage.length == 0
+                    || glyph.getWidth() <= 0 || glyph.getHeight() <= 0) {
                 data = new GlyphData(0, 0, 0,
                                      glyph.getPixelXAdvance(),
                                      glyph.getPixelYAdvance(),
                                      null);
             } else {
-                // Rasterize the glyph
-                // NOTE : if the MaskData can be stored back directly
-                // in the glyph, even as an opaque type, it should save
-                // repeated work next time the glyph is used.
-                MaskData maskData = MaskData.create(glyphImage,
-                                                    glyph.getOriginX(),
-                                                    glyph.getOriginY(),
-                                                    glyph.getWidth(),
-                                                    glyph.getHeight());
-
                 // Make room for the rectangle on the backing store
                 int border = 1;
-                int rectW = maskData.getWidth()  + (2 * border);
-                int rectH = maskData.getHeight() + (2 * border);
-                int originX = maskData.getOriginX();
-                int originY = maskData.getOriginY();
+                int glyphW = glyph.getWidth();
+                int glyphH = glyph.getHeight();
+                int rectW = glyphW + (2 * border);
+                int rectH = glyphH + (2 * border);
+                int originX = glyph.getOriginX();
+                int originY = glyph.getOriginY();
+                if (glyphImage.length < glyphW * glyphH *
+                        getBackingStore().getPixelFormat().getBytesPerPixelUnit()) {
+                    return null;
+                }
                 Rectangle rect = new Rectangle(0, 0, rectW, rectH);
                 data = new GlyphData(originX, originY, border,
                                      glyph.getPixelXAdvance(),
@@ -305,24 +303,40 @@ public class GlyphCache {
                 // it is truly needed.
                 boolean skipFlush = true;
 
-                // Upload the an empty byte array to ensure the boundary
-                // area is filled with zeros. Note that the rectangle
-                // is already padded on each edge.
+                // Upload the glyph surrounded by its blank boundary with a
+                // single update from a reused staging buffer, so that the
+                // boundary area is filled with zeros.
                 Texture backingStore = getBackingStore();
-                int emw = rect.width;
-                int emh = rect.height;
                 int bpp = backingStore.getPixelFormat().getBytesPerPixelUnit();
-                int stride = emw * bpp;
-                int size = stride * emh;
-                if (emptyMask == null || size > emptyMask.capacity()) {
-                    emptyMask = BufferUtil.newByteBuffer(size);
+                int stride = rectW * bpp;
+                int size = stride * rectH;
+                if (glyphMask == null || size > glyphMask.capacity()) {
+                    glyphMask = BufferUtil.newByteBuffer(size);
+                }
+                if (zeroRow == null || stride > zeroRow.length) {
+                    zeroRow = new byte[stride];
+                }
+                int glyphStride = glyphW * bpp;
+                int borderBytes = border * bpp;
+                int offset = 0;
+                for (int row = 0; row < rectH; row++, offset += stride) {
+                    int glyphRow = row - border;
+                    if (glyphRow < 0 || glyphRow >= glyphH) {
+                        glyphMask.put(offset, zeroRow, 0, stride);
+                    } else {
+                        glyphMask.put(offset, zeroRow, 0, borderBytes);
+                        glyphMask.put(offset + borderBytes, glyphImage,
+                                      glyphRow * glyphStride, glyphStride);
+                        glyphMask.put(offset + borderBytes + glyphStride,
+                                      zeroRow, 0, borderBytes);
+                    }
                 }
                 // try/catch is a precaution against not fitting into the store.
                 try {
-                    backingStore.update(emptyMask,
+                    backingStore.update(glyphMask,
                                         backingStore.getPixelFormat(),
                                         rect.x, rect.y,
-                                        0, 0, emw, emh, stride,
+                                        0, 0, rectW, rectH, stride,
                                         skipFlush);
                 } catch (Exception e) {
                     if (PrismSettings.verbose) {
@@ -330,12 +344,6 @@ public class GlyphCache {
                     }
                     return null;
                 }
-                // Upload the glyph
-                maskData.uploadToTexture(backingStore,
-                                         border + rect.x,
-                                         border + rect.y,
-                                         skipFlush);
-
             }
             segment[subIndex] = data;
         }
@@ -399,9 +407,9 @@ public class GlyphCache {
     }
 
     private static void disposePackerForContext(BaseContext ctx,
-            WeakHashMap<BaseContext, RectanglePacker> packerMap) {
+            WeakHashMap<BaseContext, SkylinePacker> packerMap) {
 
-        RectanglePacker packer = packerMap.remove(ctx);
+        SkylinePacker packer = packerMap.remove(ctx);
         if (packer != null) {
             packer.dispose();
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,6 +42,7 @@ public final class PrismSettings {
     public static final boolean metalDebug;
     public static final boolean printAllocs;
     public static final boolean isVsyncEnabled;
+    public static final boolean isAdaptiveVsyncEnabled;
     public static final boolean dirtyOptsEnabled;
     public static final boolean occlusionCullingEnabled;
     public static final boolean scrollCacheOpt;
@@ -63,6 +64,13 @@ public final class PrismSettings {
     public static final int dirtyRegionCount;
     public static final boolean disableBadDriverWarning;
     public static final boolean forceGPU;
+    public static final int gpuPreference;
+    public static final int d3dMaxFrameLatency;
+    public static final boolean d3dFlipEx;
+    public static final boolean d3dPrewarm3D;
+    public static final boolean mtlComputeConvolve;
+    public static final String mtlPipelineCacheDir;
+    public static final boolean mtlPrewarm;
     public static final int maxTextureSize;
     public static final int primTextureSize;
     public static final boolean disableRegionCaching;
@@ -73,6 +81,13 @@ public final class PrismSettings {
     public static final long targetVram;
     public static final boolean poolStats;
     public static final boolean poolDebug;
+    public static final boolean mipmapImages;
+    public static final boolean batchES2State;
+    public static final boolean instancedES2Meshes;
+    public static final boolean retainES2Drawable;
+    public static final String shaderCacheDir;
+    public static final String swInstructionSet;
+    public static final int swThreads;
     public static final boolean disableEffects;
     public static final int glyphCacheWidth;
     public static final int glyphCacheHeight;
@@ -98,6 +113,11 @@ public final class PrismSettings {
         }
     }
 
+    /* Values of gpuPreference, numbered like DXGI_GPU_PREFERENCE */
+    public static final int GPU_PREFERENCE_DEFAULT = 0;
+    public static final int GPU_PREFERENCE_LOW_POWER = 1;
+    public static final int GPU_PREFERENCE_HIGH_PERFORMANCE = 2;
+
     private PrismSettings() {
     }
 
@@ -115,10 +135,15 @@ public final class PrismSettings {
         final Properties systemProperties = System.getProperties();
 
         /* Vsync */
+        String swapMode = systemProperties.getProperty("prism.swapmode", "vsync");
         isVsyncEnabled  = getBoolean(systemProperties, "prism.vsync", true)
+                              && !"immediate".equalsIgnoreCase(swapMode)
                               && !getBoolean(systemProperties,
                                              "javafx.animation.fullspeed",
                                              false);
+        /* Adaptive vsync, late frames are swapped without waiting */
+        isAdaptiveVsyncEnabled = isVsyncEnabled
+                              && "adaptive".equalsIgnoreCase(swapMode);
 
         /* Dirty region optimizations */
         dirtyOptsEnabled = getBoolean(systemProperties, "prism.dirtyopts",
@@ -201,6 +226,53 @@ public final class PrismSettings {
         /* Force GPU, if GPU is PS 3 capable, disable GPU qualification check. */
         forceGPU = getBoolean(systemProperties, "prism.forceGPU", false);
 
+        /*
+         * GPU to render with on systems that have more than one:
+         * "high-performance" for the discrete GPU, "low-power" for the
+         * integrated one, or "default" to leave the choice to the system.
+         */
+        String gpu = systemProperties.getProperty("prism.gpupreference", "default");
+        switch (gpu.toLowerCase()) {
+            case "high-performance":
+                gpuPreference = GPU_PREFERENCE_HIGH_PERFORMANCE;
+                break;
+            case "low-power":
+                gpuPreference = GPU_PREFERENCE_LOW_POWER;
+                break;
+            default:
+                if (!gpu.equalsIgnoreCase("default")) {
+                    System.err.println("Unknown GPU preference: " + gpu
+                            + ". Try -Dprism.gpupreference=high-performance|low-power|default");
+                }
+                gpuPreference = GPU_PREFERENCE_DEFAULT;
+                break;
+        }
+
+        /* Frames the D3D device may queue ahead of the GPU, 0 for the driver default */
+        d3dMaxFrameLatency = Utils.clamp(0, getInt(systemProperties, "prism.d3d.maxframelatency", 0,
+                "Try -Dprism.d3d.maxframelatency=<number>"), 16);
+
+        /* Present D3D windows through flip-model swap chains */
+        d3dFlipEx = getBoolean(systemProperties, "prism.d3d.flipex", false);
+
+        /* Create the D3D 3D shaders when the context is initialized rather than on the first 3D draw */
+        d3dPrewarm3D = getBoolean(systemProperties, "prism.d3d.prewarm3d", false);
+
+        /* Run the axis aligned blur and shadow passes of Decora as Metal compute kernels */
+        mtlComputeConvolve = getBoolean(systemProperties, "prism.mtl.computeconvolve", true);
+
+        /* Metal pipeline states are kept in a binary archive on disk unless this is set to "none" */
+        String pipelineCacheDir = systemProperties.getProperty("prism.mtl.pipelinecache");
+        if (pipelineCacheDir == null) {
+            pipelineCacheDir = System.getProperty("user.home") + "/.openjfx/cache/mtl";
+        } else if (pipelineCacheDir.equals("none")) {
+            pipelineCacheDir = null;
+        }
+        mtlPipelineCacheDir = pipelineCacheDir;
+
+        /* Build the Metal pipeline states recorded in the cache on a background thread at startup */
+        mtlPrewarm = getBoolean(systemProperties, "prism.mtl.prewarm", false);
+
         String[] tryOrderArr;
         if (PlatformUtil.isWindows()) {
             tryOrderArr = new String[] { "d3d", "sw" };
@@ -273,6 +345,35 @@ public final class PrismSettings {
         poolStats = getBoolean(systemProperties, "prism.poolstats", false);
         poolDebug = getBoolean(systemProperties, "prism.pooldebug", false);
 
+        /* Cached image textures get a mip chain, used when they are drawn downscaled */
+        mipmapImages = getBoolean(systemProperties, "prism.mipmap.images", false);
+
+        /* ES2 state changes are sent down in batches instead of one JNI call each */
+        batchES2State = getBoolean(systemProperties, "prism.es2.batch", true);
+
+        /* Consecutive ES2 mesh views with the same mesh and state are drawn with one instanced call */
+        instancedES2Meshes = getBoolean(systemProperties, "prism.es2.instancing", true);
+
+        /* A presented ES2 window stays current instead of switching back to the dummy drawable */
+        retainES2Drawable = getBoolean(systemProperties, "prism.es2.retaindrawable", false);
+
+        /* Linked ES2 shader programs are cached on disk unless this is set to "none" */
+        String cacheDir = systemProperties.getProperty("prism.es2.shadercache");
+        if (cacheDir == null) {
+            cacheDir = System.getProperty("user.home") + "/.openjfx/cache/es2";
+        } else if (cacheDir.equals("none")) {
+            cacheDir = null;
+        }
+        shaderCacheDir = cacheDir;
+
+        /* Lower instruction set for the SW span blenders ("scalar", "sse2", "avx2", "neon") */
+        swInstructionSet = systemProperties.getProperty("prism.sw.isa");
+
+        /* Number of threads the SW renderer fills large rectangles with, 1 for the render thread only */
+        int ncpus = Math.min(Runtime.getRuntime().availableProcessors(), 8);
+        swThreads = Math.max(getInt(systemProperties, "prism.sw.threads", ncpus,
+                                    "Try -Dprism.sw.threads=<number>"), 1);
+
         if (verbose) {
             System.out.print("Prism pipeline init order: ");
             for (String s : tryOrder) {
@@ -294,6 +395,11 @@ public final class PrismSettings {
             printBooleanOption(forcePow2, "Forcing power of 2 sizes for textures");
             printBooleanOption(!noClampToZero, "Using hardware CLAMP_TO_ZERO mode");
             printBooleanOption(allowHiDPIScaling, "Opting in for HiDPI pixel scaling");
+            if (gpuPreference != GPU_PREFERENCE_DEFAULT) {
+                System.out.println("Preferring the "
+                        + (gpuPreference == GPU_PREFERENCE_HIGH_PERFORMANCE ? "high performance" : "low power")
+                        + " GPU");
+            }
         }
 
         /*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -64,6 +64,9 @@ public class QueuedPixelSource implements PixelSource {
     private final List<WeakReference<Pixels>> saved =
          new ArrayList<>(3);
     private final boolean useDirectBuffers;
+    // Set when enqueued pixels were skipped, so the damage of the next
+    // pixels no longer describes what changed on the screen
+    private boolean damageLost;
 
     public QueuedPixelSource(boolean useDirectBuffers) {
         this.useDirectBuffers = useDirectBuffers;
@@ -95,6 +98,7 @@ public class QueuedPixelSource implements PixelSource {
             throw new IllegalStateException("cannot skip while processing: "+beingConsumed);
         }
         enqueued = null;
+        damageLost = true;
     }
 
     private boolean usesSameBuffer(Pixels p1, Pixels p2) {
@@ -166,10 +170,46 @@ public class QueuedPixelSource implements PixelSource {
      * Place the indicated {@code Pixels} object into the enqueued state,
      * replacing any other objects that are currently enqueued but not yet
      * being used by the consumer.
+     * The damage of a replaced object is added to that of the new one,
+     * since the screen never showed its changes.
      *
      * @param pixels the {@code Pixels} object to be enqueued
      */
     public synchronized void enqueuePixels(Pixels pixels) {
+        if (damageLost) {
+            pixels.setDamage(null);
+            damageLost = false;
+        } else if (enqueued != null && enqueued != pixels) {
+            pixels.setDamage(unionDamage(enqueued.getDamage(), pixels.getDamage()));
+        }
         enqueued = pixels;
     }
+
+    private static final int MAX_DAMAGE_RECTS = 16;
+
+    /**
+     * Returns the rectangles of both damage arrays, or their bounds if
+     * there would be more than {@code MAX_DAMAGE_RECTS} of them, or null
+     * if either covers the whole image.
+     */
+    private static int[] unionDamage(int[] d1, int[] d2) {
+        if (d1 == null || d2 == null) {
+            return null;
+        }
+        int[] rects = new int[d1.length + d2.length];
+        System.arraycopy(d1, 0, rects, 0, d1.length);
+        System.arraycopy(d2, 0, rects, d1.length, d2.length);
+        if (rects.length <= MAX_DAMAGE_RECTS * 4) {
+            return rects;
+        }
+        int x0 = Integer.MAX_VALUE, y0 = Integer.MAX_VALUE;
+        int x1 = Integer.MIN_VALUE, y1 = Integer.MIN_VALUE;
+        for (int i = 0; i < rects.length; i += 4) {
+            x0 = Math.min(x0, rects[i]);
+            y0 = Math.min(y0, rects[i + 1]);
+            x1 = Math.max(x1, rects[i] + rects[i + 2]);
+            y1 = Math.max(y1, rects[i + 1] + rects[i + 3]);
+        }
+        return new int[] { x0, y0, x1 - x0, y1 - y0 };
+    }
 }
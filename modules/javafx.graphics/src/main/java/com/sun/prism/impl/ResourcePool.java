@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -183,4 +183,31 @@ public interface ResourcePool<T> {
      * @return true if there is room for the indicated resource
      */
     public boolean prepareForAllocation(long size);
+
+    /**
+     * Returns a snapshot of the allocation statistics of this pool.
+     *
+     * @return the current statistics of this pool
+     */
+    public Statistics getStatistics();
+
+    /**
+     * Allocation statistics of a resource pool. Sizes are in the units of
+     * the pool, the counts are totals since the pool was created.
+     *
+     * @param managed the amount currently held in managed resources
+     * @param peakManaged the largest amount ever held in managed resources
+     * @param target the current target of the pool
+     * @param max the maximum size of the pool
+     * @param allocations the number of resources allocated
+     * @param evictions the number of live resources freed to make room
+     * @param evictedSize the amount freed by evicting live resources
+     * @param targetGrowths the number of times the target was raised
+     * @param failedAllocations the number of allocations that did not fit
+     */
+    public record Statistics(long managed, long peakManaged, long target,
+                             long max, long allocations, long evictions,
+                             long evictedSize, long targetGrowths,
+                             long failedAllocations) {
+    }
 }
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.impl.packrect;
+
+import com.sun.javafx.geom.Rectangle;
+import com.sun.prism.Texture;
+import java.util.Arrays;
+
+/**
+ * Packs rectangles into a backing store using a bottom-left skyline.
+ * The skyline is the upper edge of the used space, kept as a list of
+ * horizontal segments. Each rectangle is placed where its bottom edge
+ * ends up lowest, so rectangles of mixed heights leave much less unused
+ * space than with fixed height levels as in {@link RectanglePacker}.
+ * Rectangles cannot be removed individually, only all at once with
+ * {@link #clear()}.
+ */
+public class SkylinePacker {
+    private Texture backingStore;
+    private final int width;
+    private final int height;
+
+    // The skyline segments, sorted by x and covering [0, width)
+    private int[] segX = new int[64];
+    private int[] segY = new int[64];
+    private int[] segW = new int[64];
+    private int segCount;
+
+    /**
+     * Creates a new SkylinePacker.
+     *
+     * @param backingStore The backing store texture, must not be null
+     * @param width The width of the backing store, must be > 0
+     * @param height The height of the backing store, must be > 0
+     */
+    public SkylinePacker(Texture backingStore, int width, int height) {
+        this.backingStore = backingStore;
+        this.width = width;
+        this.height = height;
+        clear();
+    }
+
+    /**
+     * Gets a reference to the backing store.
+     * @return A reference to the backing store.
+     */
+    public final Texture getBackingStore() {
+        return backingStore;
+    }
+
+    /**
+     * Decides upon an (x, y) position for the given rectangle (leaving
+     * its width and height unchanged) and places it on the backing
+     * store.
+     *
+     * @return false if there is no room left for the rectangle
+     */
+    public final boolean add(Rectangle rect) {
+        final int w = rect.width;
+        final int h = rect.height;
+        if (w > width || h > height) return false;
+
+        int bestIndex = -1;
+        int bestY = 0;
+        int bestBottom = Integer.MAX_VALUE;
+        int bestSegW = Integer.MAX_VALUE;
+        for (int i = 0; i < segCount; i++) {
+            int y = fit(i, w, h);
+            if (y < 0) continue;
+            int bottom = y + h;
+            if (bottom < bestBottom ||
+                (bottom == bestBottom && segW[i] < bestSegW)) {
+                bestIndex = i;
+                bestY = y;
+                bestBottom = bottom;
+                bestSegW = segW[i];
+            }
+        }
+        if (bestIndex < 0) return false;
+
+        rect.x = segX[bestIndex];
+        rect.y = bestY;
+        place(bestIndex, rect.x, bestBottom, w);
+        return true;
+    }
+
+    /**
+     * Returns the y position of a w x h rectangle whose left edge is at
+     * the start of segment i, or -1 if it does not fit there.
+     */
+    private int fit(int i, int w, int h) {
+        if (segX[i] + w > width) return -1;
+        int y = 0;
+        int remaining = w;
+        for (int j = i; remaining > 0; j++) {
+            y = Math.max(y, segY[j]);
+            if (y + h > height) return -1;
+            remaining -= segW[j];
+        }
+        return y;
+    }
+
+    /**
+     * Raises the skyline to y over [x, x + w), where x is the start of
+     * segment i.
+     */
+    private void place(int i, int x, int y, int w) {
+        insert(i, x, y, w);
+
+        // Shrink or drop the segments now covered by the new one
+        int end = x + w;
+        int j = i + 1;
+        while (j < segCount && segX[j] < end) {
+            int segEnd = segX[j] + segW[j];
+            if (segEnd <= end) {
+                remove(j);
+            } else {
+                segW[j] = segEnd - end;
+                segX[j] = end;
+                break;
+            }
+        }
+
+        // Merge neighbours at the same height
+        if (i + 1 < segCount && segY[i + 1] == y) {
+            segW[i] += segW[i + 1];
+            remove(i + 1);
+        }
+        if (i > 0 && segY[i - 1] == y) {
+            segW[i - 1] += segW[i];
+            remove(i);
+        }
+    }
+
+    private void insert(int i, int x, int y, int w) {
+        if (segCount == segX.length) {
+            int newLength = segCount * 2;
+            segX = Arrays.copyOf(segX, newLength);
+            segY = Arrays.copyOf(segY, newLength);
+            segW = Arrays.copyOf(segW, newLength);
+        }
+        int moved = segCount - i;
+        System.arraycopy(segX, i, segX, i + 1, moved);
+        System.arraycopy(segY, i, segY, i + 1, moved);
+        System.arraycopy(segW, i, segW, i + 1, moved);
+        segX[i] = x;
+        segY[i] = y;
+        segW[i] = w;
+        segCount++;
+    }
+
+    private void remove(int i) {
+        int moved = segCount - i - 1;
+        System.arraycopy(segX, i + 1, segX, i, moved);
+        System.arraycopy(segY, i + 1, segY, i, moved);
+        System.arraycopy(segW, i + 1, segW, i, moved);
+        segCount--;
+    }
+
+    /**
+     * Clears all Rectangles contained in this SkylinePacker.
+     */
+    public void clear() {
+        segX[0] = 0;
+        segY[0] = 0;
+        segW[0] = width;
+        segCount = 1;
+    }
+
+    /**
+     * Disposes the backing store. This SkylinePacker may no longer be
+     * used after calling this method.
+     */
+    public void dispose() {
+        if (backingStore != null) {
+            backingStore.dispose();
+        }
+
+        backingStore = null;
+    }
+}
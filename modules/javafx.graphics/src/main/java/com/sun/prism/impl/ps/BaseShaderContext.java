@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,7 +26,9 @@
 package com.sun.prism.impl.ps;
 
 import com.sun.glass.ui.Screen;
+import com.sun.javafx.geom.BaseBounds;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.geom.Vec3d;
 import com.sun.javafx.geom.transform.Affine3D;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.geom.transform.GeneralTransform3D;
@@ -220,6 +222,52 @@ public abstract class BaseShaderContext extends BaseContext {
 
     protected abstract void updateWorldTransform(BaseTransform xform);
 
+    private final Vec3d frustumTestPoint = new Vec3d();
+
+    /**
+     * Returns true if the given mesh bounds, transformed by {@code worldTx}
+     * and then by {@code projViewTx}, lie entirely outside one of the
+     * planes of the view volume. The test is conservative: bounds that
+     * straddle a corner of the view volume are reported as visible.
+     *
+     * @param projViewTx the projection view transform of the mesh
+     * @param worldTx the transform from mesh to world coordinates
+     * @param bounds the bounds of the mesh in mesh coordinates
+     * @param zeroNearZ true if the near plane is at z == 0 in clip space,
+     * as in D3D, false if it is at z == -w, as in OpenGL
+     */
+    protected boolean isOutsideFrustum(GeneralTransform3D projViewTx,
+            BaseTransform worldTx, BaseBounds bounds, boolean zeroNearZ) {
+        if (bounds.isEmpty()) {
+            return false;
+        }
+        int outside = 0x3f;
+        Vec3d p = frustumTestPoint;
+        for (int i = 0; i < 8 && outside != 0; i++) {
+            p.set((i & 1) == 0 ? bounds.getMinX() : bounds.getMaxX(),
+                  (i & 2) == 0 ? bounds.getMinY() : bounds.getMaxY(),
+                  (i & 4) == 0 ? bounds.getMinZ() : bounds.getMaxZ());
+            worldTx.transform(p, p);
+            double x = projViewTx.get(0) * p.x + projViewTx.get(1) * p.y
+                    + projViewTx.get(2) * p.z + projViewTx.get(3);
+            double y = projViewTx.get(4) * p.x + projViewTx.get(5) * p.y
+                    + projViewTx.get(6) * p.z + projViewTx.get(7);
+            double z = projViewTx.get(8) * p.x + projViewTx.get(9) * p.y
+                    + projViewTx.get(10) * p.z + projViewTx.get(11);
+            double w = projViewTx.get(12) * p.x + projViewTx.get(13) * p.y
+                    + projViewTx.get(14) * p.z + projViewTx.get(15);
+            int code = 0;
+            if (x < -w) code |= 0x01;
+            if (x >  w) code |= 0x02;
+            if (y < -w) code |= 0x04;
+            if (y >  w) code |= 0x08;
+            if (z < (zeroNearZ ? 0 : -w)) code |= 0x10;
+            if (z >  w) code |= 0x20;
+            outside &= code;
+        }
+        return outside != 0;
+    }
+
     protected abstract void updateClipRect(Rectangle clipRect);
 
     protected abstract void updateCompositeMode(CompositeMode mode);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.prism.impl.ps;
 
 import com.sun.prism.Image;
+import com.sun.prism.RTTexture;
 import com.sun.prism.Texture;
 import com.sun.prism.impl.BaseResourceFactory;
 import com.sun.prism.impl.shape.BasicEllipseRep;
@@ -50,6 +51,20 @@ public abstract class BaseShaderFactory extends BaseResourceFactory
         super(clampTexCache, repeatTexCache, mipmapTexCache);
     }
 
+    @Override
+    public boolean isConvolveSupported() {
+        return false;
+    }
+
+    @Override
+    public boolean convolve(Texture src, int srcw, int srch,
+                            RTTexture dst, int dstw, int dsth,
+                            float[] weights, int kernelSize,
+                            boolean vertical, float[] shadowColor)
+    {
+        return false;
+    }
+
     @Override
     public ShapeRep createPathRep() {
         return PrismSettings.cacheComplexShapes ?
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -125,7 +125,17 @@ public final class PrismPrintGraphics
 
     public PrismPrintGraphics(java.awt.Graphics2D g2d, int width, int height) {
         super(new PagePresentable(width, height), g2d);
-        setClipRect(new Rectangle(0,0,width,height));
+        Rectangle clip = new Rectangle(0, 0, width, height);
+        // When the printer job rasterizes a page it calls print() once per
+        // band, with the band as the clip. Keep the FX clip within it, so
+        // that the intermediate images for effects and opacity are sized to
+        // the band rather than to the whole page at printer resolution.
+        java.awt.Rectangle band = g2d.getClipBounds();
+        if (band != null) {
+            clip.intersectWith(new Rectangle(band.x, band.y,
+                                             band.width, band.height));
+        }
+        setClipRect(clip);
     }
 
     PrismPrintGraphics(J2DPresentable target, java.awt.Graphics2D g2d) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,6 +46,9 @@ import com.sun.prism.ps.Shader;
 import java.io.BufferedInputStream;
 import java.io.IOException;
 import java.nio.ByteBuffer;
+import java.nio.file.DirectoryStream;
+import java.nio.file.Files;
+import java.nio.file.Path;
 
 class MTLContext extends BaseShaderContext {
 
@@ -121,7 +124,43 @@ class MTLContext extends BaseShaderContext {
     MTLContext(Screen screen, MTLResourceFactory factory) {
         super(screen, factory, NUM_QUADS);
         resourceFactory = factory;
-        pContext = nInitialize(shaderLibBuffer);
+        pContext = nInitialize(shaderLibBuffer, getPipelineArchivePrefix(), PrismSettings.mtlPrewarm,
+                PrismSettings.gpuPreference);
+    }
+
+    /**
+     * Returns the path prefix of the pipeline state archive, or null if the
+     * archive is disabled. The native side appends the device identity, so
+     * a new JavaFX release or a different GPU starts with an empty archive.
+     * The archives of earlier releases are removed.
+     */
+    private static String getPipelineArchivePrefix() {
+        if (PrismSettings.mtlPipelineCacheDir == null) {
+            return null;
+        }
+        try {
+            Path dir = Path.of(PrismSettings.mtlPipelineCacheDir);
+            Files.createDirectories(dir);
+            String prefix = "pipelines-"
+                    + System.getProperty("javafx.runtime.version", "versionless")
+                    + "-" + System.getProperty("os.version", "");
+            try (DirectoryStream<Path> files = Files.newDirectoryStream(dir, "pipelines-*")) {
+                for (Path file : files) {
+                    if (!file.getFileName().toString().startsWith(prefix)) {
+                        Files.deleteIfExists(file);
+                    }
+                }
+            }
+            if (PrismSettings.verbose) {
+                System.out.println("MTL pipeline cache: " + dir);
+            }
+            return dir.resolve(prefix).toString();
+        } catch (IOException | RuntimeException e) {
+            if (PrismSettings.verbose) {
+                System.err.println("MTL pipeline cache disabled: " + e);
+            }
+            return null;
+        }
     }
 
     @Override
@@ -293,6 +332,21 @@ class MTLContext extends BaseShaderContext {
             dstX0, dstY0, dstX1, dstY1);
     }
 
+    boolean convolve(Texture src, int srcw, int srch,
+                     RTTexture dst, int dstw, int dsth,
+                     float[] weights, int kernelSize,
+                     boolean vertical, float[] shadowColor) {
+        if (!(src instanceof MTLTexture srcTex) || !(dst instanceof MTLRTTexture dstRTT) || dstRTT.isMSAA()) {
+            return false;
+        }
+        // The source may still have quads waiting in the vertex buffer
+        flushVertexBuffer();
+        return nConvolve(pContext,
+                srcTex.getNativeHandle(), src.getContentX(), src.getContentY(), srcw, srch,
+                dstRTT.getNativeHandle(), dst.getContentX(), dst.getContentY(), dstw, dsth,
+                weights, kernelSize, vertical, shadowColor);
+    }
+
     @Override
     protected void renderQuads(float[] coordArray, byte[] colorArray, int numVertices) {
         nDrawIndexedQuads(getContextHandle(), coordArray, colorArray, numVertices);
@@ -486,6 +540,14 @@ class MTLContext extends BaseShaderContext {
     @Override
     public void dispose() {
         disposeLCDBuffer();
+        if (PrismSettings.verbose) {
+            int[] stats = new int[6];
+            nGetRingBufferStats(pContext, stats);
+            System.err.println("MTLContext: args ring buffer " + stats[0]
+                    + " bytes, high water mark " + stats[1] + " bytes, " + stats[2] + " spills");
+            System.err.println("MTLContext: data ring buffer " + stats[3]
+                    + " bytes, high water mark " + stats[4] + " bytes, " + stats[5] + " spills");
+        }
         nRelease(pContext);
         state = null;
         super.dispose();
@@ -493,8 +555,10 @@ class MTLContext extends BaseShaderContext {
 
     // Native methods
 
-    private static native long nInitialize(ByteBuffer shaderLibPathStr);
+    private static native long nInitialize(ByteBuffer shaderLibPathStr, String pipelineArchivePrefix,
+                                           boolean prewarm, int gpuPreference);
     private static native void nCommitCurrentCommandBuffer(long context);
+    private static native void nGetRingBufferStats(long context, int[] stats);
     private static native long nGetCommandQueue(long context);
     private static native void nDrawIndexedQuads(long context, float coords[], byte volors[], int numVertices);
     private static native int  nUpdateRenderTarget(long context, long texPtr, boolean depthTest);
@@ -557,6 +621,11 @@ class MTLContext extends BaseShaderContext {
     private static native void nBlit(long pContext, long nSrcRTT, long nDstRTT,
                                      int srcX0, int srcY0, int srcX1, int srcY1,
                                      int dstX0, int dstY0, int dstX1, int dstY1);
+    private static native boolean nConvolve(long pContext,
+                                            long nSrcTex, int srcX, int srcY, int srcW, int srcH,
+                                            long nDstRTT, int dstX, int dstY, int dstW, int dstH,
+                                            float[] weights, int kernelSize,
+                                            boolean vertical, float[] shadowColor);
 
     private static native void nRelease(long pContext);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -115,6 +115,21 @@ class MTLResourceFactory extends BaseShaderFactory {
                 params, maxTexCoordIndex, isPixcoordUsed, isPerVertexColorUsed);
     }
 
+    @Override
+    public boolean isConvolveSupported() {
+        return PrismSettings.mtlComputeConvolve;
+    }
+
+    @Override
+    public boolean convolve(Texture src, int srcw, int srch,
+                            RTTexture dst, int dstw, int dsth,
+                            float[] weights, int kernelSize,
+                            boolean vertical, float[] shadowColor) {
+        if (checkDisposed() || !PrismSettings.mtlComputeConvolve) return false;
+        return context.convolve(src, srcw, srch, dst, dstw, dsth,
+                                weights, kernelSize, vertical, shadowColor);
+    }
+
     @Override
     public Shader createStockShader(String shaderName) {
         Objects.requireNonNull(shaderName, "Shader name not be null");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -233,6 +233,15 @@ class MTLTexture<T extends MTLTextureData> extends BaseTexture<MTLTextureResourc
 
         frame.holdFrame();
 
+        // Frames backed by an IOSurface are converted by the GPU in place
+        long pixelBuffer = frame.getNativeFrameHandle();
+        if (pixelBuffer != 0L &&
+            nUpdateYUV422FromPixelBuffer(getNativeHandle(), pixelBuffer,
+                                         frame.getEncodedWidth(), frame.getEncodedHeight())) {
+            frame.releaseFrame();
+            return;
+        }
+
         ByteBuffer pixels = frame.getBufferForPlane(0);
         byte[] arr = pixels.hasArray() ? pixels.array() : null;
         if (arr == null) {
@@ -263,6 +272,8 @@ class MTLTexture<T extends MTLTextureData> extends BaseTexture<MTLTextureResourc
                                           int dstx, int dsty, int srcx, int srcy,
                                           int w, int h, int stride);
 
+    private static native boolean nUpdateYUV422FromPixelBuffer(long pResource, long pPixelBuffer,
+                                                               int w, int h);
     private static native void nUpdateYUV422(long pResource, byte[] pixels,
                                              int dstx, int dsty, int srcx, int srcy,
                                              int w, int h, int stride);
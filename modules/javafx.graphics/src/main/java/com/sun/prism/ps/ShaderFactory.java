@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,9 @@
 
 package com.sun.prism.ps;
 
+import com.sun.prism.RTTexture;
 import com.sun.prism.ResourceFactory;
+import com.sun.prism.Texture;
 import java.io.InputStream;
 import java.util.Map;
 
@@ -48,4 +50,23 @@ public interface ShaderFactory extends ResourceFactory {
                                boolean isPerVertexColorUsed);
 
     public Shader createStockShader(String name);
+
+    // These methods are added only for MTL pipeline.
+    public boolean isConvolveSupported();
+
+    /**
+     * Performs one horizontal or vertical pass of a linear convolution
+     * with a kernel centered on each pixel: destination pixel {@code i}
+     * along the pass direction is the weighted sum of the source pixels
+     * {@code i-(kernelSize-1)} through {@code i}. Source pixels outside of
+     * {@code srcw x srch} are treated as transparent. If {@code shadowColor}
+     * is non-null the weighted alpha values are multiplied by that color.
+     *
+     * @return false if the convolution could not be performed, in which
+     *         case the caller must use a convolution shader instead
+     */
+    public boolean convolve(Texture src, int srcw, int srch,
+                            RTTexture dst, int dstw, int dsth,
+                            float[] weights, int kernelSize,
+                            boolean vertical, float[] shadowColor);
 }
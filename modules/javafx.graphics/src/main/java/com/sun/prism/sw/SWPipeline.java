@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import com.sun.prism.GraphicsPipeline;
 import com.sun.prism.ResourceFactory;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.javafx.PlatformUtil;
+import com.sun.pisces.PiscesRenderer;
 
 import java.util.HashMap;
 import java.util.List;
@@ -40,6 +41,11 @@ public final class SWPipeline extends GraphicsPipeline {
 
     static {
         NativeLibLoader.loadLibrary("prism_sw");
+        String isa = PiscesRenderer.selectInstructionSet(PrismSettings.swInstructionSet);
+        if (PrismSettings.verbose) {
+            System.out.println("Prism SW span blenders use " + isa);
+            System.out.println("Prism SW large fills use " + PrismSettings.swThreads + " thread(s)");
+        }
     }
 
     @Override public boolean init() {
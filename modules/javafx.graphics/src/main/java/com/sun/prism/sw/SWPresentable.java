@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,10 @@ final class SWPresentable extends SWRTTexture implements Presentable {
     private final PresentableState pState;
     private Pixels pixels;
     private QueuedPixelSource pixelSource = new QueuedPixelSource(false);
+    // The Pixels filled by the previous prepare(), which then hold the
+    // whole surface as it was before the current damage was painted
+    private Pixels lastPixels;
+    private int[] damage;
 
     public SWPresentable(PresentableState pState, SWResourceFactory factory) {
         super(factory, pState.getRenderWidth(), pState.getRenderHeight());
@@ -49,13 +53,17 @@ final class SWPresentable extends SWRTTexture implements Presentable {
                 getPhysicalHeight() != pState.getRenderHeight());
     }
 
+    @Override
+    public void setDamage(int[] damage) {
+        this.damage = damage;
+    }
+
     @Override
     public boolean prepare(Rectangle dirtyregion) {
         if (!pState.isViewClosed()) {
             /*
              * JDK-8092310
              * TODO: make sure the imgrep matches the Pixels.getNativeFormat()
-             * TODO: dirty region support
              */
             int w = getPhysicalWidth();
             int h = getPhysicalHeight();
@@ -63,7 +71,29 @@ final class SWPresentable extends SWRTTexture implements Presentable {
             IntBuffer pixBuf = (IntBuffer) pixels.getPixels();
             IntBuffer buf = getSurface().getDataIntBuffer();
             assert buf.hasArray();
-            System.arraycopy(buf.array(), 0, pixBuf.array(), 0, w*h);
+            int[] src = buf.array();
+            int[] dst = pixBuf.array();
+            int[] rects = damage;
+            // Only the Pixels we filled last time can be brought up to date
+            // by copying the damage, any other may hold an older frame
+            if (rects != null && pixels == lastPixels) {
+                for (int i = 0; i < rects.length; i += 4) {
+                    int x0 = Math.max(rects[i], 0);
+                    int y0 = Math.max(rects[i + 1], 0);
+                    int x1 = Math.min(rects[i] + rects[i + 2], w);
+                    int y1 = Math.min(rects[i + 1] + rects[i + 3], h);
+                    if (x1 > x0) {
+                        for (int y = y0; y < y1; y++) {
+                            System.arraycopy(src, y * w + x0, dst, y * w + x0, x1 - x0);
+                        }
+                    }
+                }
+            } else {
+                System.arraycopy(src, 0, dst, 0, w*h);
+            }
+            pixels.setDamage(rects);
+            lastPixels = pixels;
+            damage = null;
             return true;
         } else {
             return false;
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.scenario.effect.impl.prism.ps;
+
+import java.nio.FloatBuffer;
+import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.geom.transform.BaseTransform;
+import com.sun.prism.Texture;
+import com.sun.scenario.effect.Effect;
+import com.sun.scenario.effect.FilterContext;
+import com.sun.scenario.effect.ImageData;
+import com.sun.scenario.effect.impl.EffectPeer;
+import com.sun.scenario.effect.impl.Renderer;
+import com.sun.scenario.effect.impl.prism.PrTexture;
+import com.sun.scenario.effect.impl.state.LinearConvolveRenderState;
+import com.sun.scenario.effect.impl.state.LinearConvolveRenderState.PassType;
+
+/**
+ * A LinearConvolve (or LinearConvolveShadow) peer for pipelines that can
+ * convolve without a shader, see {@link com.sun.prism.ps.ShaderFactory#convolve}.
+ * Only the centered horizontal and vertical passes are done that way, all
+ * other passes are handed to the shader peer of the same effect.
+ */
+public class PPSLinearConvolveComputePeer extends EffectPeer<LinearConvolveRenderState> {
+    private final EffectPeer<LinearConvolveRenderState> shaderPeer;
+
+    public PPSLinearConvolveComputePeer(FilterContext fctx, Renderer r,
+                                        EffectPeer<LinearConvolveRenderState> shaderPeer)
+    {
+        super(fctx, r, shaderPeer.getUniqueName());
+        this.shaderPeer = shaderPeer;
+    }
+
+    @Override
+    public ImageData filter(Effect effect,
+                            LinearConvolveRenderState lcrstate,
+                            BaseTransform transform,
+                            Rectangle outputClip,
+                            ImageData... inputs)
+    {
+        ImageData input = inputs[0];
+        Rectangle inputBounds = input.getTransformedBounds(null);
+        Rectangle dstRawBounds = lcrstate.getPassResultBounds(inputBounds, null);
+        Rectangle dstBounds = lcrstate.getPassResultBounds(inputBounds, outputClip);
+        int ksize = lcrstate.getPassKernelSize();
+
+        // Same restrictions as the HV loops of SSELinearConvolvePeer
+        PassType type = lcrstate.getPassType();
+        if ((type != PassType.HORIZONTAL_CENTERED && type != PassType.VERTICAL_CENTERED) ||
+            !input.getTransform().isIdentity() ||
+            !dstBounds.contains(dstRawBounds.x, dstRawBounds.y) ||
+            ksize > LinearConvolveRenderState.MAX_COMPILED_KERNEL_SIZE)
+        {
+            return shaderPeer.filter(effect, lcrstate, transform, outputClip, inputs);
+        }
+
+        Texture srcTex = ((PrTexture) input.getUntransformedImage()).getTextureObject();
+        Rectangle srcBounds = input.getUntransformedBounds();
+        PPSRenderer renderer = (PPSRenderer) getRenderer();
+        if (srcTex == null) {
+            return shaderPeer.filter(effect, lcrstate, transform, outputClip, inputs);
+        }
+        PPSDrawable dst = renderer.getCompatibleImage(dstBounds.width, dstBounds.height);
+        if (dst == null) {
+            // the renderer has already been marked as lost
+            return new ImageData(getFilterContext(), dst, dstBounds);
+        }
+
+        float[] weights = new float[ksize];
+        FloatBuffer weightsBuf = lcrstate.getPassWeights();
+        weightsBuf.get(weights, 0, ksize);
+        float[] shadowColor = lcrstate.isShadow()
+            ? lcrstate.getPassShadowColorComponents()
+            : null;
+
+        if (!renderer.convolve(srcTex, srcBounds.width, srcBounds.height,
+                               dst.getTextureObject(), dstBounds.width, dstBounds.height,
+                               weights, ksize,
+                               type == PassType.VERTICAL_CENTERED, shadowColor))
+        {
+            renderer.releaseCompatibleImage(dst);
+            return shaderPeer.filter(effect, lcrstate, transform, outputClip, inputs);
+        }
+        return new ImageData(getFilterContext(), dst, dstBounds);
+    }
+
+    @Override
+    public void dispose() {
+        shaderPeer.dispose();
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -272,6 +272,24 @@ public class PPSRenderer extends PrRenderer {
                                     isPixcoordUsed, false);
     }
 
+    /**
+     * Performs one centered horizontal or vertical convolution pass
+     * without a shader, see {@link ShaderFactory#convolve}.
+     * Returns false if the pass must be rendered with the shader peer.
+     */
+    boolean convolve(Texture src, int srcw, int srch,
+                     RTTexture dst, int dstw, int dsth,
+                     float[] weights, int kernelSize,
+                     boolean vertical, float[] shadowColor)
+    {
+        if (!validate()) {
+            return false;
+        }
+        ShaderFactory factory = (ShaderFactory)rf;
+        return factory.convolve(src, srcw, srch, dst, dstw, dsth,
+                                weights, kernelSize, vertical, shadowColor);
+    }
+
     /**
      * Creates a new {@code EffectPeer} instance that can be used by
      * any of the Prism-based backend implementations.  For example,
@@ -340,6 +358,16 @@ public class PPSRenderer extends PrRenderer {
         } else if (needsSWDispMap && name.equals("DisplacementMap")) {
             PrFilterContext swctx = ((PrFilterContext) fctx).getSoftwareInstance();
             return new PPStoPSWDisplacementMapPeer(swctx, this, name);
+        } else if ((name.equals("LinearConvolve") || name.equals("LinearConvolveShadow")) &&
+                   ((ShaderFactory)rf).isConvolveSupported())
+        {
+            // the shader peer is still needed for the passes that are
+            // not axis aligned
+            EffectPeer shaderPeer = createPlatformPeer(fctx, name, unrollCount);
+            if (shaderPeer == null) {
+                return null;
+            }
+            return new PPSLinearConvolveComputePeer(fctx, this, shaderPeer);
         } else {
             // try creating a platform-specific peer
             return createPlatformPeer(fctx, name, unrollCount);
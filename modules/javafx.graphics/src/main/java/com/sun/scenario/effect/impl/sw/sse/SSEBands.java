@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.scenario.effect.impl.sw.sse;
+
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Splits the rows (or columns) of a native filter pass into bands that are
+ * filtered at the same time by a pool of worker threads.
+ * <p>
+ * Each band is a separate native call, so the pixel arrays are only held
+ * in a critical region for the duration of one band rather than for the
+ * whole pass. Small passes are not worth the hand-off and are filtered on
+ * the calling thread in a single band.
+ * <p>
+ * The number of threads is the number of processors, up to 8, and can be
+ * set with the {@code decora.sse.threads} system property; a value of 1
+ * filters every pass on the calling thread.
+ */
+final class SSEBands {
+
+    /**
+     * Filters the rows (or columns) from {@code start} inclusive to
+     * {@code end} exclusive.
+     */
+    interface Band {
+        void filter(int start, int end);
+    }
+
+    // The least amount of work, in pixels times kernel taps, that is
+    // worth a band of its own
+    private static final long MIN_BAND_WORK = 1L << 16;
+
+    private static final int threads;
+    private static ExecutorService pool;
+
+    static {
+        int ncpus = Math.min(Runtime.getRuntime().availableProcessors(), 8);
+        threads = Math.max(Integer.getInteger("decora.sse.threads", ncpus), 1);
+    }
+
+    private SSEBands() {
+    }
+
+    private static synchronized ExecutorService getPool() {
+        if (pool == null) {
+            AtomicInteger count = new AtomicInteger();
+            pool = Executors.newFixedThreadPool(threads - 1, r -> {
+                Thread t = new Thread(r, "Decora SSE Worker-" + count.incrementAndGet());
+                t.setDaemon(true);
+                return t;
+            });
+        }
+        return pool;
+    }
+
+    /**
+     * Filters {@code count} rows (or columns) that each take
+     * {@code workPerItem} units of work in as many bands as is useful.
+     * Returns when all bands are done.
+     */
+    static void run(int count, long workPerItem, Band band) {
+        long maxBands = Math.max(count * workPerItem / MIN_BAND_WORK, 1);
+        int nbands = (int) Math.min(Math.min(maxBands, threads), count);
+        if (nbands <= 1) {
+            band.filter(0, count);
+            return;
+        }
+
+        ExecutorService executor = getPool();
+        Future<?>[] futures = new Future<?>[nbands - 1];
+        for (int i = 0; i < nbands - 1; i++) {
+            int start = (int) ((long) count * i / nbands);
+            int end = (int) ((long) count * (i + 1) / nbands);
+            futures[i] = executor.submit(() -> band.filter(start, end));
+        }
+        // The calling thread filters the last band itself
+        band.filter((int) ((long) count * (nbands - 1) / nbands), count);
+
+        boolean interrupted = false;
+        try {
+            for (Future<?> f : futures) {
+                while (true) {
+                    try {
+                        f.get();
+                        break;
+                    } catch (InterruptedException e) {
+                        // The other bands still write into the destination
+                        interrupted = true;
+                    } catch (ExecutionException e) {
+                        Throwable cause = e.getCause();
+                        if (cause instanceof RuntimeException re) {
+                            throw re;
+                        } else if (cause instanceof Error err) {
+                            throw err;
+                        }
+                        throw new RuntimeException(cause);
+                    }
+                }
+            }
+        } finally {
+            if (interrupted) {
+                Thread.currentThread().interrupt();
+            }
+        }
+    }
+}
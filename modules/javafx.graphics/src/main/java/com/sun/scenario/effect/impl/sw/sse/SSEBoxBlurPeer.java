@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -75,49 +75,49 @@ public class SSEBoxBlurPeer extends SSEEffectPeer<BoxRenderState> {
         HeapImage src = (HeapImage)inputs[0].getUntransformedImage();
         Rectangle srcr = inputs[0].getUntransformedBounds();
 
-        HeapImage cur = src;
-        int curw = srcr.width;
-        int curh = srcr.height;
-        int curscan = cur.getScanlineStride();
-        int[] curPixels = cur.getPixelArray();
+        int srcw = srcr.width;
+        int srch = srcr.height;
+        int srcscan = src.getScanlineStride();
+        int[] srcPixels = src.getPixelArray();
 
-        int finalw = curw + growx;
-        int finalh = curh + growy;
-        while (curw < finalw || curh < finalh) {
-            int neww = curw + hinc;
-            int newh = curh + vinc;
-            if (neww > finalw) neww = finalw;
-            if (newh > finalh) newh = finalh;
-            HeapImage dst = (HeapImage)getRenderer().getCompatibleImage(neww, newh);
-            int newscan = dst.getScanlineStride();
-            int[] newPixels = dst.getPixelArray();
-            if (horizontal) {
-                filterHorizontal(newPixels, neww, newh, newscan,
-                                 curPixels, curw, curh, curscan);
-            } else {
-                filterVertical(newPixels, neww, newh, newscan,
-                               curPixels, curw, curh, curscan);
-            }
-            if (cur != src) {
-                getRenderer().releaseCompatibleImage(cur);
-            }
-            cur = dst;
-            curw = neww;
-            curh = newh;
-            curPixels = newPixels;
-            curscan = newscan;
+        // All passes are done in one native call, see filterHorizontalBand
+        int dstw = srcw + growx;
+        int dsth = srch + growy;
+        HeapImage dst = (HeapImage)getRenderer().getCompatibleImage(dstw, dsth);
+        int dstscan = dst.getScanlineStride();
+        int[] dstPixels = dst.getPixelArray();
+        if (horizontal) {
+            int passes = (growx + hinc - 1) / hinc;
+            SSEBands.run(dsth, (long) dstw * passes, (y0, y1) ->
+                filterHorizontalBand(dstPixels, dstw, dsth, dstscan,
+                                     srcPixels, srcw, srch, srcscan,
+                                     hinc, y0, y1));
+        } else {
+            int passes = (growy + vinc - 1) / vinc;
+            SSEBands.run(dstw, (long) dsth * passes, (x0, x1) ->
+                filterVerticalBand(dstPixels, dstw, dsth, dstscan,
+                                   srcPixels, srcw, srch, srcscan,
+                                   vinc, x0, x1));
         }
 
         Rectangle dstBounds =
-            new Rectangle(srcr.x - growx/2, srcr.y - growy/2, curw, curh);
-        return new ImageData(getFilterContext(), cur, dstBounds);
+            new Rectangle(srcr.x - growx/2, srcr.y - growy/2, dstw, dsth);
+        return new ImageData(getFilterContext(), dst, dstBounds);
     }
 
+    /*
+     * The band methods do all passes that grow the source to the size of
+     * the destination by up to hinc (or vinc) pixels each, for the rows
+     * from y0 to y1 (or the columns from x0 to x1) of the destination,
+     * see SSEBands.
+     */
     private static native void
-        filterHorizontal(int dstPixels[], int dstw, int dsth, int dstscan,
-                         int srcPixels[], int srcw, int srch, int srcscan);
+        filterHorizontalBand(int dstPixels[], int dstw, int dsth, int dstscan,
+                             int srcPixels[], int srcw, int srch, int srcscan,
+                             int hinc, int y0, int y1);
 
     private static native void
-        filterVertical(int dstPixels[], int dstw, int dsth, int dstscan,
-                       int srcPixels[], int srcw, int srch, int srcscan);
+        filterVerticalBand(int dstPixels[], int dstw, int dsth, int dstscan,
+                           int srcPixels[], int srcw, int srch, int srcscan,
+                           int vinc, int x0, int x1);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,10 +57,8 @@ public class SSEBoxShadowPeer extends SSEEffectPeer<BoxRenderState> {
 
         // Calculate the amount the image grows on each iteration (size-1)
         boolean horizontal = (getPass() == 0);
-        int hinc = horizontal ? brstate.getBoxPixelSize(0) - 1 : 0;
-        int vinc = horizontal ? 0 : brstate.getBoxPixelSize(1) - 1;
-        if (hinc < 0) hinc = 0;
-        if (vinc < 0) vinc = 0;
+        int hinc = horizontal ? Math.max(brstate.getBoxPixelSize(0) - 1, 0) : 0;
+        int vinc = horizontal ? 0 : Math.max(brstate.getBoxPixelSize(1) - 1, 0);
         int iterations = brstate.getBlurPasses();
         float spread = brstate.getSpread();
         if (horizontal && (iterations < 1 || (hinc < 1 && vinc < 1))) {
@@ -77,82 +75,60 @@ public class SSEBoxShadowPeer extends SSEEffectPeer<BoxRenderState> {
         HeapImage src = (HeapImage)inputs[0].getUntransformedImage();
         Rectangle srcr = inputs[0].getUntransformedBounds();
 
-        HeapImage cur = src;
-        int curw = srcr.width;
-        int curh = srcr.height;
-        int curscan = cur.getScanlineStride();
-        int[] curPixels = cur.getPixelArray();
+        int srcw = srcr.width;
+        int srch = srcr.height;
+        int srcscan = src.getScanlineStride();
+        int[] srcPixels = src.getPixelArray();
 
-        int finalw = curw + growx;
-        int finalh = curh + growy;
-        boolean force = !horizontal;
-        while (force || curw < finalw || curh < finalh) {
-            int neww = curw + hinc;
-            int newh = curh + vinc;
-            if (neww > finalw) neww = finalw;
-            if (newh > finalh) newh = finalh;
-            HeapImage dst = (HeapImage)getRenderer().getCompatibleImage(neww, newh);
-            int newscan = dst.getScanlineStride();
-            int[] newPixels = dst.getPixelArray();
-            if (iterations == 0) {
-                // The last "fixup" iteration of 2 should have no spread.
-                spread = 0f;
-            }
-            if (horizontal) {
-                filterHorizontalBlack(newPixels, neww, newh, newscan,
-                                      curPixels, curw, curh, curscan,
-                                      spread);
-            } else if (neww < finalw || newh < finalh) {
-                // Use BLACK for shadow color until very last pass
-                filterVerticalBlack(newPixels, neww, newh, newscan,
-                                    curPixels, curw, curh, curscan,
-                                    spread);
-            } else {
-                float shadowColor[] =
-                     brstate.getShadowColor().getPremultipliedRGBComponents();
-                if (shadowColor[3] == 1f &&
-                    shadowColor[0] == 0f &&
-                    shadowColor[1] == 0f &&
-                    shadowColor[2] == 0f)
-                {
-                    filterVerticalBlack(newPixels, neww, newh, newscan,
-                                        curPixels, curw, curh, curscan,
-                                        spread);
-                } else {
-                    filterVertical(newPixels, neww, newh, newscan,
-                                   curPixels, curw, curh, curscan,
-                                   spread, shadowColor);
-                }
-            }
-            if (cur != src) {
-                getRenderer().releaseCompatibleImage(cur);
-            }
-            iterations--;
-            force = false;
-            cur = dst;
-            curw = neww;
-            curh = newh;
-            curPixels = newPixels;
-            curscan = newscan;
+        // All passes are done in one native call, see filterHorizontalBand
+        int dstw = srcw + growx;
+        int dsth = srch + growy;
+        HeapImage dst = (HeapImage)getRenderer().getCompatibleImage(dstw, dsth);
+        int dstscan = dst.getScanlineStride();
+        int[] dstPixels = dst.getPixelArray();
+        if (horizontal) {
+            int passes = (growx + hinc - 1) / hinc;
+            SSEBands.run(dsth, (long) dstw * passes, (y0, y1) ->
+                filterHorizontalBand(dstPixels, dstw, dsth, dstscan,
+                                     srcPixels, srcw, srch, srcscan,
+                                     hinc, iterations, spread, y0, y1));
+        } else {
+            float rgba[] =
+                 brstate.getShadowColor().getPremultipliedRGBComponents();
+            // Use BLACK for shadow color until very last pass, and for
+            // that one too if it is the shadow color
+            float shadowColor[] =
+                (rgba[3] == 1f && rgba[0] == 0f && rgba[1] == 0f && rgba[2] == 0f)
+                ? null : rgba;
+            int passes = (vinc > 0) ? Math.max((growy + vinc - 1) / vinc, 1) : 1;
+            SSEBands.run(dstw, (long) dsth * passes, (x0, x1) ->
+                filterVerticalBand(dstPixels, dstw, dsth, dstscan,
+                                   srcPixels, srcw, srch, srcscan,
+                                   vinc, iterations, spread, shadowColor, x0, x1));
         }
 
         Rectangle dstBounds =
-            new Rectangle(srcr.x - growx/2, srcr.y - growy/2, curw, curh);
-        return new ImageData(getFilterContext(), cur, dstBounds, inputs[0].getTransform());
+            new Rectangle(srcr.x - growx/2, srcr.y - growy/2, dstw, dsth);
+        return new ImageData(getFilterContext(), dst, dstBounds, inputs[0].getTransform());
     }
 
+    /*
+     * The band methods do all passes that grow the source to the size of
+     * the destination by up to hinc (or vinc) pixels each, for the rows
+     * from y0 to y1 (or the columns from x0 to x1) of the destination,
+     * see SSEBands. The first iterations passes use the spread, and the
+     * last vertical pass converts to the shadow color unless it is null
+     * for black.
+     */
     private static native void
-        filterHorizontalBlack(int dstPixels[], int dstw, int dsth, int dstscan,
-                              int srcPixels[], int srcw, int srch, int srcscan,
-                              float spread);
+        filterHorizontalBand(int dstPixels[], int dstw, int dsth, int dstscan,
+                             int srcPixels[], int srcw, int srch, int srcscan,
+                             int hinc, int iterations, float spread,
+                             int y0, int y1);
 
     private static native void
-        filterVerticalBlack(int dstPixels[], int dstw, int dsth, int dstscan,
-                            int srcPixels[], int srcw, int srch, int srcscan,
-                            float spread);
-
-    private static native void
-        filterVertical(int dstPixels[], int dstw, int dsth, int dstscan,
-                       int srcPixels[], int srcw, int srch, int srcscan,
-                       float spread, float shadowColor[]);
+        filterVerticalBand(int dstPixels[], int dstw, int dsth, int dstscan,
+                           int srcPixels[], int srcw, int srch, int srcscan,
+                           int vinc, int iterations, float spread,
+                           float shadowColor[], int x0, int x1);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -96,26 +96,17 @@ public class SSELinearConvolvePeer extends SSEEffectPeer<LinearConvolveRenderSta
             // and transforms...
             type = PassType.GENERAL_VECTOR;
         }
+        // The weights are read natively from the direct buffer into
+        // per-thread scratch memory, so no arrays are allocated per pass
         if (type == PassType.HORIZONTAL_CENTERED) {
-            float[] weights_arr = new float[count * 2];
-            weights_buf.get(weights_arr, 0, count);
-            weights_buf.rewind();
-            weights_buf.get(weights_arr, count, count);
             filterHV(dstPixels, dstw, dsth, 1, dstscan,
                      srcPixels, srcw, srch, 1, srcscan,
-                     weights_arr);
+                     weights_buf, count);
         } else if (type == PassType.VERTICAL_CENTERED) {
-            float[] weights_arr = new float[count * 2];
-            weights_buf.get(weights_arr, 0, count);
-            weights_buf.rewind();
-            weights_buf.get(weights_arr, count, count);
             filterHV(dstPixels, dsth, dstw, dstscan, 1,
                      srcPixels, srch, srcw, srcscan, 1,
-                     weights_arr);
+                     weights_buf, count);
         } else {
-            float[] weights_arr = new float[count];
-            weights_buf.get(weights_arr, 0, count);
-
             float[] srcRect = new float[8];
             int nCoords = getTextureCoordinates(0, srcRect,
                                                 src0Bounds.x, src0Bounds.y,
@@ -145,7 +136,7 @@ public class SSELinearConvolvePeer extends SSEEffectPeer<LinearConvolveRenderSta
 
             filterVector(dstPixels, dstw, dsth, dstscan,
                          srcPixels, srcw, srch, srcscan,
-                         weights_arr, count,
+                         weights_buf, count,
                          srcx0, srcy0,
                          offsetx, offsety,
                          deltax, deltay,
@@ -158,7 +149,7 @@ public class SSELinearConvolvePeer extends SSEEffectPeer<LinearConvolveRenderSta
     native void
         filterVector(int dstPixels[], int dstw, int dsth, int dstscan,
                      int srcPixels[], int srcw, int srch, int srcscan,
-                     float weights[], int count,
+                     FloatBuffer weights, int count,
                      float srcx0, float srcy0,
                      float offsetx, float offsety,
                      float deltax, float deltay,
@@ -172,8 +163,22 @@ public class SSELinearConvolvePeer extends SSEEffectPeer<LinearConvolveRenderSta
      * Rows are horizontal in the first pass and vertical in the second pass.
      * Cols are vice versa.
      */
-    native void
+    void
         filterHV(int dstPixels[], int dstcols, int dstrows, int dcolinc, int drowinc,
                  int srcPixels[], int srccols, int srcrows, int scolinc, int srowinc,
-                 float weights[]);
+                 FloatBuffer weights, int count)
+    {
+        SSEBands.run(dstrows, (long) dstcols * count, (r0, r1) ->
+            filterHVBand(dstPixels, dstcols, dstrows, dcolinc, drowinc,
+                         srcPixels, srccols, srcrows, scolinc, srowinc,
+                         weights, count, r0, r1));
+    }
+
+    /*
+     * Filters the rows from r0 to r1 of the destination, see SSEBands.
+     */
+    native void
+        filterHVBand(int dstPixels[], int dstcols, int dstrows, int dcolinc, int drowinc,
+                     int srcPixels[], int srccols, int srcrows, int scolinc, int srowinc,
+                     FloatBuffer weights, int count, int r0, int r1);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 
 package com.sun.scenario.effect.impl.sw.sse;
 
+import java.nio.FloatBuffer;
 import com.sun.scenario.effect.FilterContext;
 import com.sun.scenario.effect.impl.Renderer;
 
@@ -45,7 +46,7 @@ public class SSELinearConvolveShadowPeer extends SSELinearConvolvePeer {
     private static native void
         filterVector(int dstPixels[], int dstw, int dsth, int dstscan,
                      int srcPixels[], int srcw, int srch, int srcscan,
-                     float weights[], int count,
+                     FloatBuffer weights, int count,
                      float srcx0, float srcy0,
                      float offsetx, float offsety,
                      float deltax, float deltay,
@@ -56,7 +57,7 @@ public class SSELinearConvolveShadowPeer extends SSELinearConvolvePeer {
     void
         filterVector(int dstPixels[], int dstw, int dsth, int dstscan,
                      int srcPixels[], int srcw, int srch, int srcscan,
-                     float weights[], int count,
+                     FloatBuffer weights, int count,
                      float srcx0, float srcy0,
                      float offsetx, float offsety,
                      float deltax, float deltay,
@@ -82,16 +83,16 @@ public class SSELinearConvolveShadowPeer extends SSELinearConvolvePeer {
     private static native void
         filterHV(int dstPixels[], int dstcols, int dstrows, int dcolinc, int drowinc,
                  int srcPixels[], int srccols, int srcrows, int scolinc, int srowinc,
-                 float weights[], float shadowColor[]);
+                 FloatBuffer weights, int count, float shadowColor[]);
 
     @Override
     void
         filterHV(int dstPixels[], int dstcols, int dstrows, int dcolinc, int drowinc,
                  int srcPixels[], int srccols, int srcrows, int scolinc, int srowinc,
-                 float weights[])
+                 FloatBuffer weights, int count)
     {
         filterHV(dstPixels, dstcols, dstrows, dcolinc, drowinc,
                  srcPixels, srccols, srcrows, scolinc, srowinc,
-                 weights, getShadowColor());
+                 weights, count, getShadowColor());
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,8 +34,19 @@ public class SSERendererDelegate implements RendererDelegate {
 
     public static native boolean isSupported();
 
+    /**
+     * Selects the instruction set of the native filter loops and returns
+     * its name. This is the best one the processor supports unless the
+     * requested one is lower, which is useful to compare them.
+     */
+    private static native String selectInstructionSet(String requested);
+
     static {
         NativeLibLoader.loadLibrary("decora_sse");
+        String isa = selectInstructionSet(System.getProperty("decora.sse.isa"));
+        if (Boolean.getBoolean("decora.verbose")) {
+            System.out.println("Decora SSE peers use " + isa);
+        }
     }
 
     public SSERendererDelegate() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,34 +30,27 @@
 
 #include <jni.h>
 #include "SSEUtils.h"
+#include "SSESimd.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer.h"
 
-JNIEXPORT void JNICALL
-Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
-    (JNIEnv *env, jclass klass,
-     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan)
-{
-    if ((checkRange(env,
-                    dstPixels_arr, dstw, dsth,
-                    srcPixels_arr, srcw, srch)) ||
-        dsth > srch) { // We should not move out of source vertical bounds
-        return;
-    }
-
-    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
-    if (srcPixels == NULL) return;
-    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
-    if (dstPixels == NULL) {
-        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
-        return;
-    }
+// The passes of a band are done on blocks of this many rows or columns
+// so that their intermediate results stay in the cache.
+#define PASS_ROWS 16
+#define PASS_COLS 32
 
+/*
+ * One horizontal pass: each of the dsth rows grows from srcw to dstw.
+ */
+static void blurHorizontal(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                           jint *srcPixels, jint srcw, jint srcscan)
+{
     jint hsize = dstw - srcw + 1;
     jint kscale = 0x7fffffff / (hsize * 255);
-    jint srcoff = 0;
-    jint dstoff = 0;
-    for (jint y = 0; y < dsth; y++) {
+    jint y0 = simdBoxBlurHorizontal(dstPixels, dstw, dsth, dstscan,
+                                    srcPixels, srcw, srcscan, hsize, kscale);
+    jint srcoff = y0 * srcscan;
+    jint dstoff = y0 * dstscan;
+    for (jint y = y0; y < dsth; y++) {
         jint suma = 0;
         jint sumr = 0;
         jint sumg = 0;
@@ -85,36 +78,20 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
         srcoff += srcscan;
         dstoff += dstscan;
     }
-
-    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
-    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
 }
 
-JNIEXPORT void JNICALL
-Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
-    (JNIEnv *env, jclass klass,
-     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan)
+/*
+ * One vertical pass: each of the dstw columns grows from srch to dsth.
+ */
+static void blurVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                         jint *srcPixels, jint srch, jint srcscan)
 {
-    if ((checkRange(env,
-                    dstPixels_arr, dstw, dsth,
-                    srcPixels_arr, srcw, srch)) ||
-        dstw > srcw) { // We should not move out of source horizontal bounds
-        return;
-    }
-
-    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
-    if (srcPixels == NULL) return;
-    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
-    if (dstPixels == NULL) {
-        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
-        return;
-    }
-
     jint vsize = dsth - srch + 1;
     jint kscale = 0x7fffffff / (vsize * 255);
     jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
+    jint x0 = simdBoxBlurVertical(dstPixels, dstw, dsth, dstscan,
+                                  srcPixels, srch, srcscan, vsize, kscale);
+    for (jint x = x0; x < dstw; x++) {
         jint suma = 0;
         jint sumr = 0;
         jint sumg = 0;
@@ -144,6 +121,117 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
             dstoff += dstscan;
         }
     }
+}
+
+/*
+ * Does all of the horizontal passes that grow the rows from srcw to dstw
+ * by up to hinc pixels each. The rows of a block go through all passes
+ * before the next block, with the intermediate rows in scratch buffers.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontalBand
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint hinc, jint start, jint end)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstw, dsth,
+                    srcPixels_arr, srcw, srch)) ||
+        dsth > srch || // We should not move out of source vertical bounds
+        dstw <= srcw || hinc < 1 ||
+        start < 0 || end > dsth || start >= end) {
+        return;
+    }
+
+    jint *scratch[2];
+    scratch[0] = (jint *)getScratch(0, PASS_ROWS * dstw * sizeof(jint));
+    scratch[1] = (jint *)getScratch(1, PASS_ROWS * dstw * sizeof(jint));
+    if (scratch[0] == NULL || scratch[1] == NULL) return;
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) return;
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        return;
+    }
+
+    // Only filter the band from start to end, see SSEBands.java
+    for (jint y = start; y < end; y += PASS_ROWS) {
+        jint rows = (end - y < PASS_ROWS) ? end - y : PASS_ROWS;
+        jint *cur = srcPixels + y * srcscan;
+        jint curw = srcw;
+        jint curscan = srcscan;
+        for (jint pass = 0; curw < dstw; pass++) {
+            jint neww = curw + hinc;
+            if (neww > dstw) neww = dstw;
+            // The last pass writes into the destination
+            jint *next = (neww < dstw) ? scratch[pass & 1] : dstPixels + y * dstscan;
+            jint nextscan = (neww < dstw) ? dstw : dstscan;
+            blurHorizontal(next, neww, rows, nextscan, cur, curw, curscan);
+            cur = next;
+            curw = neww;
+            curscan = nextscan;
+        }
+    }
+
+    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
+    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+}
+
+/*
+ * Does all of the vertical passes that grow the columns from srch to dsth
+ * by up to vinc pixels each. The columns of a block go through all passes
+ * before the next block, with the intermediate columns in scratch buffers.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVerticalBand
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint vinc, jint start, jint end)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstw, dsth,
+                    srcPixels_arr, srcw, srch)) ||
+        dstw > srcw || // We should not move out of source horizontal bounds
+        dsth <= srch || vinc < 1 ||
+        start < 0 || end > dstw || start >= end) {
+        return;
+    }
+
+    jint *scratch[2];
+    scratch[0] = (jint *)getScratch(0, PASS_COLS * dsth * sizeof(jint));
+    scratch[1] = (jint *)getScratch(1, PASS_COLS * dsth * sizeof(jint));
+    if (scratch[0] == NULL || scratch[1] == NULL) return;
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) return;
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        return;
+    }
+
+    // Only filter the band from start to end, see SSEBands.java
+    for (jint x = start; x < end; x += PASS_COLS) {
+        jint cols = (end - x < PASS_COLS) ? end - x : PASS_COLS;
+        jint *cur = srcPixels + x;
+        jint curh = srch;
+        jint curscan = srcscan;
+        for (jint pass = 0; curh < dsth; pass++) {
+            jint newh = curh + vinc;
+            if (newh > dsth) newh = dsth;
+            // The last pass writes into the destination
+            jint *next = (newh < dsth) ? scratch[pass & 1] : dstPixels + x;
+            jint nextscan = (newh < dsth) ? PASS_COLS : dstscan;
+            blurVertical(next, cols, newh, nextscan, cur, curh, curscan);
+            cur = next;
+            curh = newh;
+            curscan = nextscan;
+        }
+    }
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
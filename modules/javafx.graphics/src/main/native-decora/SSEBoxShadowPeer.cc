@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,39 +30,34 @@
 
 #include <jni.h>
 #include "SSEUtils.h"
+#include "SSESimd.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer.h"
 
-JNIEXPORT void JNICALL
-Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBlack
-    (JNIEnv *env, jclass klass,
-     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
-     jfloat spread)
-{
-    if ((checkRange(env,
-                    dstPixels_arr, dstw, dsth,
-                    srcPixels_arr, srcw, srch)) ||
-        dsth > srch) { // We should not move out of source vertical bounds
-        return;
-    }
-
-    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
-    if (srcPixels == NULL) return;
-    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
-    if (dstPixels == NULL) {
-        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
-        return;
-    }
+// The passes of a band are done on blocks of this many rows or columns
+// so that their intermediate results stay in the cache.
+#define PASS_ROWS 16
+#define PASS_COLS 32
 
+/*
+ * One horizontal pass: each of the dsth rows grows from srcw to dstw and
+ * only keeps the alpha.
+ */
+static void shadowHorizontalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srcw, jint srcscan,
+                                  jfloat spread)
+{
     jint hsize = dstw - srcw + 1;
     // amax goes from hsize*255 to 255 as spread goes from 0 to 1
     jint amax = hsize * 255;
     amax += (jint) ((255 - amax) * spread);
     jint kscale = 0x7fffffff / amax;
     jint amin = (amax / 255);
-    jint srcoff = 0;
-    jint dstoff = 0;
-    for (jint y = 0; y < dsth; y++) {
+    jint y0 = simdBoxShadowHorizontalBlack(dstPixels, dstw, dsth, dstscan,
+                                           srcPixels, srcw, srcscan,
+                                           hsize, amin, amax, kscale);
+    jint srcoff = y0 * srcscan;
+    jint dstoff = y0 * dstscan;
+    for (jint y = y0; y < dsth; y++) {
         jint suma = 0;
         for (jint x = 0; x < dstw; x++) {
             jint rgb;
@@ -81,33 +76,16 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBlack
         srcoff += srcscan;
         dstoff += dstscan;
     }
-
-    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
-    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
 }
 
-JNIEXPORT void JNICALL
-Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBlack
-    (JNIEnv *env, jclass klass,
-     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
-     jfloat spread)
+/*
+ * One vertical pass: each of the dstw columns grows from srch to dsth and
+ * only keeps the alpha.
+ */
+static void shadowVerticalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                jint *srcPixels, jint srch, jint srcscan,
+                                jfloat spread)
 {
-    if ((checkRange(env,
-                    dstPixels_arr, dstw, dsth,
-                    srcPixels_arr, srcw, srch)) ||
-        dstw > srcw) { // We should not move out of source horizontal bounds
-        return;
-    }
-
-    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
-    if (srcPixels == NULL) return;
-    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
-    if (dstPixels == NULL) {
-        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
-        return;
-    }
-
     jint vsize = dsth - srch + 1;
     // amax goes from hsize*255 to 255 as spread goes from 0 to 1
     jint amax = vsize * 255;
@@ -115,7 +93,10 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBlack
     jint kscale = 0x7fffffff / amax;
     jint amin = (amax / 255);
     jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
+    jint x0 = simdBoxShadowVerticalBlack(dstPixels, dstw, dsth, dstscan,
+                                         srcPixels, srch, srcscan,
+                                         vsize, amin, amax, kscale);
+    for (jint x = x0; x < dstw; x++) {
         jint suma = 0;
         jint srcoff = x;
         jint dstoff = x;
@@ -136,36 +117,16 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBlack
             dstoff += dstscan;
         }
     }
-
-    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
-    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
 }
 
-JNIEXPORT void JNICALL
-Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVertical
-    (JNIEnv *env, jclass klass,
-     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
-     jfloat spread, jfloatArray shadowColor_arr)
+/*
+ * One vertical pass: each of the dstw columns grows from srch to dsth and
+ * is converted to the shadow color.
+ */
+static void shadowVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                           jint *srcPixels, jint srch, jint srcscan,
+                           jfloat spread, jfloat *shadowColor)
 {
-    if ((checkRange(env,
-                    dstPixels_arr, dstw, dsth,
-                    srcPixels_arr, srcw, srch)) ||
-        dstw > srcw) { // We should not move out of source horizontal bounds
-        return;
-    }
-
-    jfloat shadowColor[4];
-    env->GetFloatArrayRegion(shadowColor_arr, 0, 4, shadowColor);
-
-    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
-    if (srcPixels == NULL) return;
-    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
-    if (dstPixels == NULL) {
-        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
-        return;
-    }
-
     jint vsize = dsth - srch + 1;
     // amax goes from hsize*255 to 255 as spread goes from 0 to 1
     jint amax = vsize * 255;
@@ -182,7 +143,11 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVertical
         (((jint) (shadowColor[1] * 255)) <<  8) |
         (((jint) (shadowColor[2] * 255))      ) |
         (((jint) (shadowColor[3] * 255)) << 24);
-    for (jint x = 0; x < dstw; x++) {
+    jint kscales[4] = { kscalea, kscaler, kscaleg, kscaleb };
+    jint x0 = simdBoxShadowVertical(dstPixels, dstw, dsth, dstscan,
+                                    srcPixels, srch, srcscan,
+                                    vsize, amin, amax, kscales, shadowRGB);
+    for (jint x = x0; x < dstw; x++) {
         jint suma = 0;
         jint srcoff = x;
         jint dstoff = x;
@@ -206,6 +171,141 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVertical
             dstoff += dstscan;
         }
     }
+}
+
+/*
+ * Does all of the horizontal passes that grow the rows from srcw to dstw
+ * by up to hinc pixels each. The first iterations passes use the spread,
+ * the remaining fixup pass does not. The rows of a block go through all
+ * passes before the next block, with the intermediate rows in scratch
+ * buffers.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBand
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint hinc, jint iterations, jfloat spread, jint start, jint end)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstw, dsth,
+                    srcPixels_arr, srcw, srch)) ||
+        dsth > srch || // We should not move out of source vertical bounds
+        dstw <= srcw || hinc < 1 ||
+        start < 0 || end > dsth || start >= end) {
+        return;
+    }
+
+    jint *scratch[2];
+    scratch[0] = (jint *)getScratch(0, PASS_ROWS * dstw * sizeof(jint));
+    scratch[1] = (jint *)getScratch(1, PASS_ROWS * dstw * sizeof(jint));
+    if (scratch[0] == NULL || scratch[1] == NULL) return;
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) return;
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        return;
+    }
+
+    // Only filter the band from start to end, see SSEBands.java
+    for (jint y = start; y < end; y += PASS_ROWS) {
+        jint rows = (end - y < PASS_ROWS) ? end - y : PASS_ROWS;
+        jint *cur = srcPixels + y * srcscan;
+        jint curw = srcw;
+        jint curscan = srcscan;
+        for (jint pass = 0; curw < dstw; pass++) {
+            jint neww = curw + hinc;
+            if (neww > dstw) neww = dstw;
+            // The last pass writes into the destination
+            jint *next = (neww < dstw) ? scratch[pass & 1] : dstPixels + y * dstscan;
+            jint nextscan = (neww < dstw) ? dstw : dstscan;
+            shadowHorizontalBlack(next, neww, rows, nextscan, cur, curw, curscan,
+                                  (pass < iterations) ? spread : 0.0f);
+            cur = next;
+            curw = neww;
+            curscan = nextscan;
+        }
+    }
+
+    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
+    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+}
+
+/*
+ * Does all of the vertical passes that grow the columns from srch to dsth
+ * by up to vinc pixels each, with at least one pass even if they do not
+ * grow. The first iterations passes use the spread, the remaining fixup
+ * pass does not. The last pass converts to the shadow color, unless
+ * shadowColor_arr is null for black. The columns of a block go through all
+ * passes before the next block, with the intermediate columns in scratch
+ * buffers.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBand
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint vinc, jint iterations, jfloat spread, jfloatArray shadowColor_arr,
+     jint start, jint end)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstw, dsth,
+                    srcPixels_arr, srcw, srch)) ||
+        dstw > srcw || // We should not move out of source horizontal bounds
+        dsth < srch || (dsth > srch && vinc < 1) ||
+        start < 0 || end > dstw || start >= end) {
+        return;
+    }
+
+    jfloat shadowColor[4];
+    if (shadowColor_arr != NULL) {
+        env->GetFloatArrayRegion(shadowColor_arr, 0, 4, shadowColor);
+    }
+
+    jint *scratch[2];
+    scratch[0] = (jint *)getScratch(0, PASS_COLS * dsth * sizeof(jint));
+    scratch[1] = (jint *)getScratch(1, PASS_COLS * dsth * sizeof(jint));
+    if (scratch[0] == NULL || scratch[1] == NULL) return;
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) return;
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        return;
+    }
+
+    // Only filter the band from start to end, see SSEBands.java
+    for (jint x = start; x < end; x += PASS_COLS) {
+        jint cols = (end - x < PASS_COLS) ? end - x : PASS_COLS;
+        jint *cur = srcPixels + x;
+        jint curh = srch;
+        jint curscan = srcscan;
+        jint pass = 0;
+        do {
+            jint newh = curh + vinc;
+            if (newh > dsth) newh = dsth;
+            jfloat passSpread = (pass < iterations) ? spread : 0.0f;
+            if (newh < dsth) {
+                // Use BLACK for shadow color until very last pass
+                jint *next = scratch[pass & 1];
+                shadowVerticalBlack(next, cols, newh, PASS_COLS,
+                                    cur, curh, curscan, passSpread);
+                cur = next;
+                curscan = PASS_COLS;
+            } else if (shadowColor_arr == NULL) {
+                shadowVerticalBlack(dstPixels + x, cols, newh, dstscan,
+                                    cur, curh, curscan, passSpread);
+            } else {
+                shadowVertical(dstPixels + x, cols, newh, dstscan,
+                               cur, curh, curscan, passSpread, shadowColor);
+            }
+            curh = newh;
+            pass++;
+        } while (curh < dsth);
+    }
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include <jni.h>
 #include <math.h>
 #include "SSEUtils.h"
+#include "SSESimd.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer.h"
 
 #define cmin 1.0f
@@ -43,15 +44,14 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterVector
     (JNIEnv *env, jobject lcpthis,
      jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
      jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
-     jfloatArray weights_arr, jint count,
+     jobject weights_buf, jint count,
      jfloat srcx0, jfloat srcy0,
      jfloat offsetx, jfloat offsety,
      jfloat deltax, jfloat deltay,
      jfloat dxcol, jfloat dycol, jfloat dxrow, jfloat dyrow)
 {
-    if (count > 128) return;
-    jfloat weights[128];
-    env->GetFloatArrayRegion(weights_arr, 0, count, weights);
+    jfloat *weights = getWeights(env, weights_buf, count, false, 0);
+    if (weights == NULL) return;
 
     jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
     if (srcPixels == NULL) return;
@@ -104,38 +104,47 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterVector
  * Cols are vice versa.
  */
 JNIEXPORT void JNICALL
-Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterHV
+Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterHVBand
     (JNIEnv *env, jobject lcpthis,
      jintArray dstPixels_arr, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
      jintArray srcPixels_arr, jint srccols, jint srcrows, jint scolinc, jint srowinc,
-     jfloatArray kvals_arr)
+     jobject weights_buf, jint kernelSize,
+     jint start, jint end)
 {
     if ((checkRange(env,
                     dstPixels_arr, dstcols, dstrows,
                     srcPixels_arr, srccols, srcrows)) ||
-        dstrows > srcrows) { // We should not move out of source vertical bounds
+        dstrows > srcrows || // We should not move out of source vertical bounds
+        start < 0 || end > dstrows || start >= end) {
         return;
     }
 
-    jint kernelSize = env->GetArrayLength(kvals_arr) / 2;
     if (kernelSize > 128) return;
-    jfloat kvals[256];
-    env->GetFloatArrayRegion(kvals_arr, 0, kernelSize * 2, kvals);
+    jfloat *kvals = getWeights(env, weights_buf, kernelSize, true, 0);
+    if (kvals == NULL) return;
 
-    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
-    if (srcPixels == NULL) return;
-    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
-    if (dstPixels == NULL) {
-        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+    jint *srcBase = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcBase == NULL) return;
+    jint *dstBase = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstBase == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcBase, JNI_ABORT);
         return;
     }
 
+    // Only filter the band from start to end, see SSEBands.java
+    jint *srcPixels = srcBase + start * srowinc;
+    jint *dstPixels = dstBase + start * drowinc;
+    dstrows = end - start;
+
     // cvals stores the component values from the surrounding K pixels
     // from x-r to x+r
     jfloat cvals[128*4];
-    jint dstrow = 0;
-    jint srcrow = 0;
-    for (jint r = 0; r < dstrows; r++) {
+    jint r0 = simdLinearConvolveHV(dstPixels, dstcols, dstrows, dcolinc, drowinc,
+                                   srcPixels, srccols, scolinc, srowinc,
+                                   kvals, kernelSize);
+    jint dstrow = r0 * drowinc;
+    jint srcrow = r0 * srowinc;
+    for (jint r = r0; r < dstrows; r++) {
         jint dstoff = dstrow;
         jint srcoff = srcrow;
         // Must clear out the array at the start of every line
@@ -180,6 +189,6 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterHV
         srcrow += srowinc;
     }
 
-    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
-    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstBase, 0);
+    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcBase, JNI_ABORT);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,16 +41,15 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer_filterVecto
     (JNIEnv *env, jclass klass,
      jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
      jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
-     jfloatArray weights_arr, jint count,
+     jobject weights_buf, jint count,
      jfloat srcx0, jfloat srcy0,
      jfloat offsetx, jfloat offsety,
      jfloat deltax, jfloat deltay,
      jfloatArray shadowColor_arr,
      jfloat dxcol, jfloat dycol, jfloat dxrow, jfloat dyrow)
 {
-    if (count > 128) return;
-    jfloat weights[128];
-    env->GetFloatArrayRegion(weights_arr, 0, count, weights);
+    jfloat *weights = getWeights(env, weights_buf, count, false, 0);
+    if (weights == NULL) return;
     jfloat shadowColor[4];
     env->GetFloatArrayRegion(shadowColor_arr, 0, 4, shadowColor);
 
@@ -116,7 +115,7 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer_filterHV
     (JNIEnv *env, jclass klass,
      jintArray dstPixels_arr, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
      jintArray srcPixels_arr, jint srccols, jint srcrows, jint scolinc, jint srowinc,
-     jfloatArray kvals_arr, jfloatArray shadowColor_arr)
+     jobject weights_buf, jint kernelSize, jfloatArray shadowColor_arr)
 {
     if ((checkRange(env,
                     dstPixels_arr, dstcols, dstrows,
@@ -125,10 +124,9 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer_filterHV
         return;
     }
 
-    jint kernelSize = env->GetArrayLength(kvals_arr) / 2;
     if (kernelSize > 128) return;
-    jfloat kvals[256];
-    env->GetFloatArrayRegion(kvals_arr, 0, kernelSize * 2, kvals);
+    jfloat *kvals = getWeights(env, weights_buf, kernelSize, true, 0);
+    if (kvals == NULL) return;
     jfloat shadowColor[4];
     env->GetFloatArrayRegion(shadowColor_arr, 0, 4, shadowColor);
     jint shadowRGBs[256];
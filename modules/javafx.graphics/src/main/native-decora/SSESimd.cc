@@ -0,0 +1,1037 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "SSESimd.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SIMD_ARM64
+#include <arm_neon.h>
+#endif
+
+/*
+ * The library is built for the baseline instruction set of the platform,
+ * so the SSE4.1 and AVX2 loops enable their instruction set per function
+ * and are only called when the processor has it. MSVC needs no option to
+ * use the intrinsics.
+ */
+#ifdef _MSC_VER
+#define SIMD_TARGET(isa)
+#else
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// Same clamping limits as the scalar loops in SSELinearConvolvePeer.cc
+#define cmin 1.0f
+#define cmax (255.0f - 1.0f/32.0f)
+
+static const char *simdNames[] = { "scalar", "sse4.1", "avx2", "neon" };
+
+static int simdLevel = SIMD_SCALAR;
+
+static int detectSIMDLevel()
+{
+#if defined(SIMD_ARM64)
+    // Advanced SIMD is part of the aarch64 baseline
+    return SIMD_NEON;
+#elif defined(SIMD_X86)
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse41 = (info[2] & (1 << 19)) != 0;
+    // AVX2 also needs the OS to save the YMM registers
+    bool osAVX = (info[2] & (1 << 27)) != 0 &&
+                 (info[2] & (1 << 28)) != 0 &&
+                 (_xgetbv(0) & 0x6) == 0x6;
+    bool avx2 = false;
+    if (osAVX && maxLeaf >= 7) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    bool sse41 = __builtin_cpu_supports("sse4.1");
+    bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+    if (avx2) {
+        return SIMD_AVX2;
+    }
+    if (sse41) {
+        return SIMD_SSE41;
+    }
+#endif
+    return SIMD_SCALAR;
+}
+
+const char* selectSIMDLevel(const char *requested)
+{
+    int level = detectSIMDLevel();
+    if (requested != NULL) {
+        for (int i = SIMD_SCALAR; i <= SIMD_NEON; i++) {
+            if (strcmp(requested, simdNames[i]) == 0) {
+                // Only step down within the same family
+                if (i == SIMD_SCALAR ||
+                    (i != SIMD_NEON && level != SIMD_NEON && i < level))
+                {
+                    level = i;
+                }
+                break;
+            }
+        }
+    }
+    simdLevel = level;
+    return simdNames[level];
+}
+
+#ifdef SIMD_X86
+
+/*
+ * Pixel channels are kept in 32-bit lanes in memory order, that is
+ * blue, green, red and alpha.
+ */
+
+SIMD_TARGET("sse4.1")
+static inline __m128i unpackPixelSSE41(jint pixel)
+{
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(pixel));
+}
+
+// Inverse of unpackPixelSSE41 for lanes that hold 0 to 255
+SIMD_TARGET("sse4.1")
+static inline jint packPixelSSE41(__m128i v)
+{
+    v = _mm_packus_epi32(v, v);
+    return _mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+}
+
+// (sum * kscale) >> 23 for sums that cannot overflow the product
+SIMD_TARGET("sse4.1")
+static inline __m128i scaleSSE41(__m128i sum, __m128i vkscale)
+{
+    return _mm_srli_epi32(_mm_mullo_epi32(sum, vkscale), 23);
+}
+
+// The clamp of the box shadow loops, with the scaled pixel as the
+// result of the sums in [amin, amax)
+SIMD_TARGET("sse4.1")
+static inline __m128i clampShadowSSE41(__m128i suma, __m128i scaled,
+                                       __m128i vamin, __m128i vamax,
+                                       __m128i vmaxRGB)
+{
+    __m128i v = _mm_blendv_epi8(vmaxRGB, scaled, _mm_cmpgt_epi32(vamax, suma));
+    return _mm_andnot_si128(_mm_cmpgt_epi32(vamin, suma), v);
+}
+
+// The clamp of the linear convolve loops followed by the conversion
+SIMD_TARGET("sse4.1")
+static inline jint packClampedSSE41(__m128 sum)
+{
+    __m128 over = _mm_cmpgt_ps(sum, _mm_set1_ps(cmax));
+    sum = _mm_max_ps(sum, _mm_setzero_ps());
+    sum = _mm_blendv_ps(sum, _mm_set1_ps(255.0f), over);
+    return packPixelSSE41(_mm_cvttps_epi32(sum));
+}
+
+SIMD_TARGET("sse4.1")
+static jint boxBlurHorizontalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                   jint *srcPixels, jint srcw, jint srcscan,
+                                   jint hsize, jint kscale)
+{
+    __m128i vkscale = _mm_set1_epi32(kscale);
+    for (jint y = 0; y < dsth; y++) {
+        jint *src = srcPixels + y * srcscan;
+        jint *dst = dstPixels + y * dstscan;
+        __m128i sum = _mm_setzero_si128();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = _mm_sub_epi32(sum, unpackPixelSSE41(src[x - hsize]));
+            }
+            if (x < srcw) {
+                sum = _mm_add_epi32(sum, unpackPixelSSE41(src[x]));
+            }
+            dst[x] = packPixelSSE41(scaleSSE41(sum, vkscale));
+        }
+    }
+    return dsth;
+}
+
+// Two rows at a time, one in each 128-bit half
+SIMD_TARGET("avx2")
+static jint boxBlurHorizontalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srcw, jint srcscan,
+                                  jint hsize, jint kscale)
+{
+    __m256i vkscale = _mm256_set1_epi32(kscale);
+    jint y = 0;
+    for (; y + 2 <= dsth; y += 2) {
+        jint *src0 = srcPixels + y * srcscan;
+        jint *src1 = src0 + srcscan;
+        jint *dst0 = dstPixels + y * dstscan;
+        jint *dst1 = dst0 + dstscan;
+        __m256i sum = _mm256_setzero_si256();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                __m128i p = _mm_insert_epi32(_mm_cvtsi32_si128(src0[x - hsize]),
+                                             src1[x - hsize], 1);
+                sum = _mm256_sub_epi32(sum, _mm256_cvtepu8_epi32(p));
+            }
+            if (x < srcw) {
+                __m128i p = _mm_insert_epi32(_mm_cvtsi32_si128(src0[x]), src1[x], 1);
+                sum = _mm256_add_epi32(sum, _mm256_cvtepu8_epi32(p));
+            }
+            __m256i v = _mm256_srli_epi32(_mm256_mullo_epi32(sum, vkscale), 23);
+            __m128i w = _mm_packus_epi32(_mm256_castsi256_si128(v),
+                                         _mm256_extracti128_si256(v, 1));
+            w = _mm_packus_epi16(w, w);
+            dst0[x] = _mm_cvtsi128_si32(w);
+            dst1[x] = _mm_extract_epi32(w, 1);
+        }
+    }
+    if (y < dsth) {
+        boxBlurHorizontalSSE41(dstPixels + y * dstscan, dstw, 1, dstscan,
+                               srcPixels + y * srcscan, srcw, srcscan,
+                               hsize, kscale);
+    }
+    return dsth;
+}
+
+// Four columns at a time
+SIMD_TARGET("sse4.1")
+static jint boxBlurVerticalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                 jint *srcPixels, jint srch, jint srcscan,
+                                 jint vsize, jint kscale)
+{
+    __m128i vkscale = _mm_set1_epi32(kscale);
+    jint voff = vsize * srcscan;
+    jint x = 0;
+    for (; x + 4 <= dstw; x += 4) {
+        __m128i sum0 = _mm_setzero_si128();
+        __m128i sum1 = _mm_setzero_si128();
+        __m128i sum2 = _mm_setzero_si128();
+        __m128i sum3 = _mm_setzero_si128();
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            if (y >= vsize) {
+                __m128i p = _mm_loadu_si128((__m128i *) (srcPixels + srcoff - voff));
+                sum0 = _mm_sub_epi32(sum0, _mm_cvtepu8_epi32(p));
+                sum1 = _mm_sub_epi32(sum1, _mm_cvtepu8_epi32(_mm_srli_si128(p, 4)));
+                sum2 = _mm_sub_epi32(sum2, _mm_cvtepu8_epi32(_mm_srli_si128(p, 8)));
+                sum3 = _mm_sub_epi32(sum3, _mm_cvtepu8_epi32(_mm_srli_si128(p, 12)));
+            }
+            if (y < srch) {
+                __m128i p = _mm_loadu_si128((__m128i *) (srcPixels + srcoff));
+                sum0 = _mm_add_epi32(sum0, _mm_cvtepu8_epi32(p));
+                sum1 = _mm_add_epi32(sum1, _mm_cvtepu8_epi32(_mm_srli_si128(p, 4)));
+                sum2 = _mm_add_epi32(sum2, _mm_cvtepu8_epi32(_mm_srli_si128(p, 8)));
+                sum3 = _mm_add_epi32(sum3, _mm_cvtepu8_epi32(_mm_srli_si128(p, 12)));
+            }
+            __m128i lo = _mm_packus_epi32(scaleSSE41(sum0, vkscale), scaleSSE41(sum1, vkscale));
+            __m128i hi = _mm_packus_epi32(scaleSSE41(sum2, vkscale), scaleSSE41(sum3, vkscale));
+            _mm_storeu_si128((__m128i *) (dstPixels + dstoff), _mm_packus_epi16(lo, hi));
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+    return x;
+}
+
+// Eight columns at a time, the sums hold two pixels each
+SIMD_TARGET("avx2")
+static jint boxBlurVerticalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                jint *srcPixels, jint srch, jint srcscan,
+                                jint vsize, jint kscale)
+{
+    __m256i vkscale = _mm256_set1_epi32(kscale);
+    // Undoes the lane interleaving of the in-lane packs below
+    __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    jint voff = vsize * srcscan;
+    jint x = 0;
+    for (; x + 8 <= dstw; x += 8) {
+        __m256i sum[4];
+        for (int i = 0; i < 4; i++) {
+            sum[i] = _mm256_setzero_si256();
+        }
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            if (y >= vsize) {
+                jint *p = srcPixels + srcoff - voff;
+                for (int i = 0; i < 4; i++) {
+                    __m128i pp = _mm_loadl_epi64((__m128i *) (p + 2 * i));
+                    sum[i] = _mm256_sub_epi32(sum[i], _mm256_cvtepu8_epi32(pp));
+                }
+            }
+            if (y < srch) {
+                jint *p = srcPixels + srcoff;
+                for (int i = 0; i < 4; i++) {
+                    __m128i pp = _mm_loadl_epi64((__m128i *) (p + 2 * i));
+                    sum[i] = _mm256_add_epi32(sum[i], _mm256_cvtepu8_epi32(pp));
+                }
+            }
+            __m256i m0 = _mm256_srli_epi32(_mm256_mullo_epi32(sum[0], vkscale), 23);
+            __m256i m1 = _mm256_srli_epi32(_mm256_mullo_epi32(sum[1], vkscale), 23);
+            __m256i m2 = _mm256_srli_epi32(_mm256_mullo_epi32(sum[2], vkscale), 23);
+            __m256i m3 = _mm256_srli_epi32(_mm256_mullo_epi32(sum[3], vkscale), 23);
+            __m256i v = _mm256_packus_epi16(_mm256_packus_epi32(m0, m1),
+                                            _mm256_packus_epi32(m2, m3));
+            v = _mm256_permutevar8x32_epi32(v, order);
+            _mm256_storeu_si256((__m256i *) (dstPixels + dstoff), v);
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+    if (x + 4 <= dstw) {
+        x += boxBlurVerticalSSE41(dstPixels + x, dstw - x, dsth, dstscan,
+                                  srcPixels + x, srch, srcscan, vsize, kscale);
+    }
+    return x;
+}
+
+// Four rows at a time, the running sums of a row are sequential
+SIMD_TARGET("sse4.1")
+static jint boxShadowHorizontalBlackSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                          jint *srcPixels, jint srcw, jint srcscan,
+                                          jint hsize, jint amin, jint amax, jint kscale)
+{
+    __m128i vkscale = _mm_set1_epi32(kscale);
+    __m128i vamin = _mm_set1_epi32(amin);
+    __m128i vamax = _mm_set1_epi32(amax);
+    __m128i vblack = _mm_set1_epi32((jint) 0xff000000);
+    jint y = 0;
+    for (; y + 4 <= dsth; y += 4) {
+        jint *src0 = srcPixels + y * srcscan;
+        jint *src1 = src0 + srcscan;
+        jint *src2 = src1 + srcscan;
+        jint *src3 = src2 + srcscan;
+        jint *dst0 = dstPixels + y * dstscan;
+        jint *dst1 = dst0 + dstscan;
+        jint *dst2 = dst1 + dstscan;
+        jint *dst3 = dst2 + dstscan;
+        __m128i suma = _mm_setzero_si128();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                jint o = x - hsize;
+                __m128i p = _mm_setr_epi32(src0[o], src1[o], src2[o], src3[o]);
+                suma = _mm_sub_epi32(suma, _mm_srli_epi32(p, 24));
+            }
+            if (x < srcw) {
+                __m128i p = _mm_setr_epi32(src0[x], src1[x], src2[x], src3[x]);
+                suma = _mm_add_epi32(suma, _mm_srli_epi32(p, 24));
+            }
+            __m128i a = _mm_slli_epi32(scaleSSE41(suma, vkscale), 24);
+            a = clampShadowSSE41(suma, a, vamin, vamax, vblack);
+            dst0[x] = _mm_cvtsi128_si32(a);
+            dst1[x] = _mm_extract_epi32(a, 1);
+            dst2[x] = _mm_extract_epi32(a, 2);
+            dst3[x] = _mm_extract_epi32(a, 3);
+        }
+    }
+    return y;
+}
+
+// Eight rows at a time, the source alphas are gathered
+SIMD_TARGET("avx2")
+static jint boxShadowHorizontalBlackAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                         jint *srcPixels, jint srcw, jint srcscan,
+                                         jint hsize, jint amin, jint amax, jint kscale)
+{
+    __m256i vkscale = _mm256_set1_epi32(kscale);
+    __m256i vamin = _mm256_set1_epi32(amin);
+    __m256i vamax = _mm256_set1_epi32(amax);
+    __m256i vblack = _mm256_set1_epi32((jint) 0xff000000);
+    __m256i rows = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                      _mm256_set1_epi32(srcscan));
+    jint y = 0;
+    for (; y + 8 <= dsth; y += 8) {
+        jint *src = srcPixels + y * srcscan;
+        jint *dst = dstPixels + y * dstscan;
+        __m256i suma = _mm256_setzero_si256();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                __m256i p = _mm256_i32gather_epi32((const int *) (src + x - hsize), rows, 4);
+                suma = _mm256_sub_epi32(suma, _mm256_srli_epi32(p, 24));
+            }
+            if (x < srcw) {
+                __m256i p = _mm256_i32gather_epi32((const int *) (src + x), rows, 4);
+                suma = _mm256_add_epi32(suma, _mm256_srli_epi32(p, 24));
+            }
+            __m256i a = _mm256_slli_epi32(
+                    _mm256_srli_epi32(_mm256_mullo_epi32(suma, vkscale), 23), 24);
+            a = _mm256_blendv_epi8(vblack, a, _mm256_cmpgt_epi32(vamax, suma));
+            a = _mm256_andnot_si256(_mm256_cmpgt_epi32(vamin, suma), a);
+            jint out[8];
+            _mm256_storeu_si256((__m256i *) out, a);
+            for (int i = 0; i < 8; i++) {
+                dst[i * dstscan + x] = out[i];
+            }
+        }
+    }
+    if (y + 4 <= dsth) {
+        y += boxShadowHorizontalBlackSSE41(dstPixels + y * dstscan, dstw, dsth - y, dstscan,
+                                           srcPixels + y * srcscan, srcw, srcscan,
+                                           hsize, amin, amax, kscale);
+    }
+    return y;
+}
+
+// Four columns at a time. With a null kscales the shadow is black and
+// kscale is the alpha scale, otherwise the color is scaled per channel.
+SIMD_TARGET("sse4.1")
+static jint boxShadowVerticalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                   jint *srcPixels, jint srch, jint srcscan,
+                                   jint vsize, jint amin, jint amax, jint kscale,
+                                   const jint *kscales, jint shadowRGB)
+{
+    __m128i vamin = _mm_set1_epi32(amin);
+    __m128i vamax = _mm_set1_epi32(amax);
+    __m128i vshadow = _mm_set1_epi32(shadowRGB);
+    __m128i vka = _mm_set1_epi32(kscales != NULL ? kscales[0] : kscale);
+    __m128i vkr = _mm_set1_epi32(kscales != NULL ? kscales[1] : 0);
+    __m128i vkg = _mm_set1_epi32(kscales != NULL ? kscales[2] : 0);
+    __m128i vkb = _mm_set1_epi32(kscales != NULL ? kscales[3] : 0);
+    jint voff = vsize * srcscan;
+    jint x = 0;
+    for (; x + 4 <= dstw; x += 4) {
+        __m128i suma = _mm_setzero_si128();
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            if (y >= vsize) {
+                __m128i p = _mm_loadu_si128((__m128i *) (srcPixels + srcoff - voff));
+                suma = _mm_sub_epi32(suma, _mm_srli_epi32(p, 24));
+            }
+            if (y < srch) {
+                __m128i p = _mm_loadu_si128((__m128i *) (srcPixels + srcoff));
+                suma = _mm_add_epi32(suma, _mm_srli_epi32(p, 24));
+            }
+            __m128i v = _mm_slli_epi32(scaleSSE41(suma, vka), 24);
+            if (kscales != NULL) {
+                v = _mm_or_si128(v, _mm_slli_epi32(scaleSSE41(suma, vkr), 16));
+                v = _mm_or_si128(v, _mm_slli_epi32(scaleSSE41(suma, vkg), 8));
+                v = _mm_or_si128(v, scaleSSE41(suma, vkb));
+            }
+            v = clampShadowSSE41(suma, v, vamin, vamax, vshadow);
+            _mm_storeu_si128((__m128i *) (dstPixels + dstoff), v);
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+    return x;
+}
+
+// Eight columns at a time, see boxShadowVerticalSSE41
+SIMD_TARGET("avx2")
+static jint boxShadowVerticalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srch, jint srcscan,
+                                  jint vsize, jint amin, jint amax, jint kscale,
+                                  const jint *kscales, jint shadowRGB)
+{
+    __m256i vamin = _mm256_set1_epi32(amin);
+    __m256i vamax = _mm256_set1_epi32(amax);
+    __m256i vshadow = _mm256_set1_epi32(shadowRGB);
+    __m256i vka = _mm256_set1_epi32(kscales != NULL ? kscales[0] : kscale);
+    __m256i vkr = _mm256_set1_epi32(kscales != NULL ? kscales[1] : 0);
+    __m256i vkg = _mm256_set1_epi32(kscales != NULL ? kscales[2] : 0);
+    __m256i vkb = _mm256_set1_epi32(kscales != NULL ? kscales[3] : 0);
+    jint voff = vsize * srcscan;
+    jint x = 0;
+    for (; x + 8 <= dstw; x += 8) {
+        __m256i suma = _mm256_setzero_si256();
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            if (y >= vsize) {
+                __m256i p = _mm256_loadu_si256((__m256i *) (srcPixels + srcoff - voff));
+                suma = _mm256_sub_epi32(suma, _mm256_srli_epi32(p, 24));
+            }
+            if (y < srch) {
+                __m256i p = _mm256_loadu_si256((__m256i *) (srcPixels + srcoff));
+                suma = _mm256_add_epi32(suma, _mm256_srli_epi32(p, 24));
+            }
+            __m256i v = _mm256_slli_epi32(
+                    _mm256_srli_epi32(_mm256_mullo_epi32(suma, vka), 23), 24);
+            if (kscales != NULL) {
+                v = _mm256_or_si256(v, _mm256_slli_epi32(
+                        _mm256_srli_epi32(_mm256_mullo_epi32(suma, vkr), 23), 16));
+                v = _mm256_or_si256(v, _mm256_slli_epi32(
+                        _mm256_srli_epi32(_mm256_mullo_epi32(suma, vkg), 23), 8));
+                v = _mm256_or_si256(v,
+                        _mm256_srli_epi32(_mm256_mullo_epi32(suma, vkb), 23));
+            }
+            v = _mm256_blendv_epi8(vshadow, v, _mm256_cmpgt_epi32(vamax, suma));
+            v = _mm256_andnot_si256(_mm256_cmpgt_epi32(vamin, suma), v);
+            _mm256_storeu_si256((__m256i *) (dstPixels + dstoff), v);
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+    if (x + 4 <= dstw) {
+        x += boxShadowVerticalSSE41(dstPixels + x, dstw - x, dsth, dstscan,
+                                    srcPixels + x, srch, srcscan,
+                                    vsize, amin, amax, kscale, kscales, shadowRGB);
+    }
+    return x;
+}
+
+/*
+ * The linear convolve loops do not keep a ring of the last kernelSize
+ * source pixels like the scalar loop. Each line is first converted into
+ * a float buffer that starts with kernelSize - 1 empty pixels, so that
+ * destination pixel c is the sum of buffer pixels c to c + kernelSize - 1
+ * weighted by the kernel, and several destination pixels are summed up
+ * at once. The products are added in a different order than in the
+ * scalar loop, which can change a channel by one.
+ */
+
+// Four pixels at a time
+SIMD_TARGET("sse4.1")
+static jint linearConvolveHVSSE41(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                                  jint *srcPixels, jint srccols, jint scolinc, jint srowinc,
+                                  const jfloat *kvals, jint kernelSize)
+{
+    jint linelen = kernelSize - 1 + dstcols;
+    jfloat *line = (jfloat *) malloc(linelen * 4 * sizeof(jfloat));
+    if (line == NULL) {
+        return 0;
+    }
+    // The kernel is stored twice in kvals, the weight of buffer pixel
+    // c + j is kvals[j]
+    jint srcend = (srccols < dstcols) ? srccols : dstcols;
+    for (jint r = 0; r < dstrows; r++) {
+        jint srcoff = r * srowinc;
+        jint dstoff = r * drowinc;
+        memset(line, 0, linelen * 4 * sizeof(jfloat));
+        jfloat *p = line + (kernelSize - 1) * 4;
+        for (jint c = 0; c < srcend; c++) {
+            _mm_storeu_ps(p + c * 4, _mm_cvtepi32_ps(unpackPixelSSE41(srcPixels[srcoff])));
+            srcoff += scolinc;
+        }
+        jint c = 0;
+        for (; c + 4 <= dstcols; c += 4) {
+            const jfloat *q = line + c * 4;
+            __m128 sum0 = _mm_setzero_ps();
+            __m128 sum1 = _mm_setzero_ps();
+            __m128 sum2 = _mm_setzero_ps();
+            __m128 sum3 = _mm_setzero_ps();
+            for (jint j = 0; j < kernelSize; j++) {
+                __m128 k = _mm_set1_ps(kvals[j]);
+                sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(q + j * 4), k));
+                sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(q + j * 4 + 4), k));
+                sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_loadu_ps(q + j * 4 + 8), k));
+                sum3 = _mm_add_ps(sum3, _mm_mul_ps(_mm_loadu_ps(q + j * 4 + 12), k));
+            }
+            dstPixels[dstoff] = packClampedSSE41(sum0);
+            dstoff += dcolinc;
+            dstPixels[dstoff] = packClampedSSE41(sum1);
+            dstoff += dcolinc;
+            dstPixels[dstoff] = packClampedSSE41(sum2);
+            dstoff += dcolinc;
+            dstPixels[dstoff] = packClampedSSE41(sum3);
+            dstoff += dcolinc;
+        }
+        for (; c < dstcols; c++) {
+            const jfloat *q = line + c * 4;
+            __m128 sum = _mm_setzero_ps();
+            for (jint j = 0; j < kernelSize; j++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(q + j * 4), _mm_set1_ps(kvals[j])));
+            }
+            dstPixels[dstoff] = packClampedSSE41(sum);
+            dstoff += dcolinc;
+        }
+    }
+    free(line);
+    return dstrows;
+}
+
+// Eight pixels at a time, two in each vector
+SIMD_TARGET("avx2")
+static jint linearConvolveHVAVX2(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                                 jint *srcPixels, jint srccols, jint scolinc, jint srowinc,
+                                 const jfloat *kvals, jint kernelSize)
+{
+    jint linelen = kernelSize - 1 + dstcols;
+    jfloat *line = (jfloat *) malloc(linelen * 4 * sizeof(jfloat));
+    if (line == NULL) {
+        return 0;
+    }
+    jint srcend = (srccols < dstcols) ? srccols : dstcols;
+    for (jint r = 0; r < dstrows; r++) {
+        jint srcoff = r * srowinc;
+        jint dstoff = r * drowinc;
+        memset(line, 0, linelen * 4 * sizeof(jfloat));
+        jfloat *p = line + (kernelSize - 1) * 4;
+        for (jint c = 0; c < srcend; c++) {
+            _mm_storeu_ps(p + c * 4, _mm_cvtepi32_ps(unpackPixelSSE41(srcPixels[srcoff])));
+            srcoff += scolinc;
+        }
+        jint c = 0;
+        for (; c + 8 <= dstcols; c += 8) {
+            const jfloat *q = line + c * 4;
+            __m256 sum01 = _mm256_setzero_ps();
+            __m256 sum23 = _mm256_setzero_ps();
+            __m256 sum45 = _mm256_setzero_ps();
+            __m256 sum67 = _mm256_setzero_ps();
+            for (jint j = 0; j < kernelSize; j++) {
+                const jfloat *qj = q + j * 4;
+                __m256 k = _mm256_set1_ps(kvals[j]);
+                sum01 = _mm256_add_ps(sum01, _mm256_mul_ps(_mm256_loadu_ps(qj), k));
+                sum23 = _mm256_add_ps(sum23, _mm256_mul_ps(_mm256_loadu_ps(qj + 8), k));
+                sum45 = _mm256_add_ps(sum45, _mm256_mul_ps(_mm256_loadu_ps(qj + 16), k));
+                sum67 = _mm256_add_ps(sum67, _mm256_mul_ps(_mm256_loadu_ps(qj + 24), k));
+            }
+            __m256 sums[4] = { sum01, sum23, sum45, sum67 };
+            for (int i = 0; i < 4; i++) {
+                dstPixels[dstoff] = packClampedSSE41(_mm256_castps256_ps128(sums[i]));
+                dstoff += dcolinc;
+                dstPixels[dstoff] = packClampedSSE41(_mm256_extractf128_ps(sums[i], 1));
+                dstoff += dcolinc;
+            }
+        }
+        for (; c < dstcols; c++) {
+            const jfloat *q = line + c * 4;
+            __m128 sum = _mm_setzero_ps();
+            for (jint j = 0; j < kernelSize; j++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(q + j * 4), _mm_set1_ps(kvals[j])));
+            }
+            dstPixels[dstoff] = packClampedSSE41(sum);
+            dstoff += dcolinc;
+        }
+    }
+    free(line);
+    return dstrows;
+}
+
+#endif /* SIMD_X86 */
+
+#ifdef SIMD_ARM64
+
+/*
+ * Same loops as the SSE4.1 ones, the channels are kept in 32-bit lanes
+ * in memory order.
+ */
+
+static inline uint32x4_t unpackPixelNEON(jint pixel)
+{
+    uint8x8_t b = vreinterpret_u8_u32(vdup_n_u32((uint32_t) pixel));
+    return vmovl_u16(vget_low_u16(vmovl_u8(b)));
+}
+
+static inline jint packPixelNEON(uint32x4_t v)
+{
+    uint16x4_t w = vqmovn_u32(v);
+    uint8x8_t b = vqmovn_u16(vcombine_u16(w, w));
+    return (jint) vget_lane_u32(vreinterpret_u32_u8(b), 0);
+}
+
+static inline uint32x4_t scaleNEON(uint32x4_t sum, uint32x4_t vkscale)
+{
+    return vshrq_n_u32(vmulq_u32(sum, vkscale), 23);
+}
+
+static inline uint32x4_t clampShadowNEON(uint32x4_t suma, uint32x4_t scaled,
+                                         uint32x4_t vamin, uint32x4_t vamax,
+                                         uint32x4_t vmaxRGB)
+{
+    uint32x4_t v = vbslq_u32(vcltq_u32(suma, vamax), scaled, vmaxRGB);
+    return vbicq_u32(v, vcltq_u32(suma, vamin));
+}
+
+static inline jint packClampedNEON(float32x4_t sum)
+{
+    uint32x4_t over = vcgtq_f32(sum, vdupq_n_f32(cmax));
+    sum = vmaxq_f32(sum, vdupq_n_f32(0.0f));
+    sum = vbslq_f32(over, vdupq_n_f32(255.0f), sum);
+    return packPixelNEON(vcvtq_u32_f32(sum));
+}
+
+static jint boxBlurHorizontalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srcw, jint srcscan,
+                                  jint hsize, jint kscale)
+{
+    uint32x4_t vkscale = vdupq_n_u32((uint32_t) kscale);
+    for (jint y = 0; y < dsth; y++) {
+        jint *src = srcPixels + y * srcscan;
+        jint *dst = dstPixels + y * dstscan;
+        uint32x4_t sum = vdupq_n_u32(0);
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = vsubq_u32(sum, unpackPixelNEON(src[x - hsize]));
+            }
+            if (x < srcw) {
+                sum = vaddq_u32(sum, unpackPixelNEON(src[x]));
+            }
+            dst[x] = packPixelNEON(scaleNEON(sum, vkscale));
+        }
+    }
+    return dsth;
+}
+
+static jint boxBlurVerticalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                jint *srcPixels, jint srch, jint srcscan,
+                                jint vsize, jint kscale)
+{
+    uint32x4_t vkscale = vdupq_n_u32((uint32_t) kscale);
+    jint voff = vsize * srcscan;
+    jint x = 0;
+    for (; x + 4 <= dstw; x += 4) {
+        uint32x4_t sum[4];
+        for (int i = 0; i < 4; i++) {
+            sum[i] = vdupq_n_u32(0);
+        }
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            if (y >= vsize) {
+                uint8x16_t p = vld1q_u8((const uint8_t *) (srcPixels + srcoff - voff));
+                uint16x8_t lo = vmovl_u8(vget_low_u8(p));
+                uint16x8_t hi = vmovl_u8(vget_high_u8(p));
+                sum[0] = vsubq_u32(sum[0], vmovl_u16(vget_low_u16(lo)));
+                sum[1] = vsubq_u32(sum[1], vmovl_u16(vget_high_u16(lo)));
+                sum[2] = vsubq_u32(sum[2], vmovl_u16(vget_low_u16(hi)));
+                sum[3] = vsubq_u32(sum[3], vmovl_u16(vget_high_u16(hi)));
+            }
+            if (y < srch) {
+                uint8x16_t p = vld1q_u8((const uint8_t *) (srcPixels + srcoff));
+                uint16x8_t lo = vmovl_u8(vget_low_u8(p));
+                uint16x8_t hi = vmovl_u8(vget_high_u8(p));
+                sum[0] = vaddq_u32(sum[0], vmovl_u16(vget_low_u16(lo)));
+                sum[1] = vaddq_u32(sum[1], vmovl_u16(vget_high_u16(lo)));
+                sum[2] = vaddq_u32(sum[2], vmovl_u16(vget_low_u16(hi)));
+                sum[3] = vaddq_u32(sum[3], vmovl_u16(vget_high_u16(hi)));
+            }
+            uint16x8_t lo = vcombine_u16(vqmovn_u32(scaleNEON(sum[0], vkscale)),
+                                         vqmovn_u32(scaleNEON(sum[1], vkscale)));
+            uint16x8_t hi = vcombine_u16(vqmovn_u32(scaleNEON(sum[2], vkscale)),
+                                         vqmovn_u32(scaleNEON(sum[3], vkscale)));
+            vst1q_u8((uint8_t *) (dstPixels + dstoff),
+                     vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)));
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+    return x;
+}
+
+static jint boxShadowHorizontalBlackNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                         jint *srcPixels, jint srcw, jint srcscan,
+                                         jint hsize, jint amin, jint amax, jint kscale)
+{
+    uint32x4_t vkscale = vdupq_n_u32((uint32_t) kscale);
+    uint32x4_t vamin = vdupq_n_u32((uint32_t) amin);
+    uint32x4_t vamax = vdupq_n_u32((uint32_t) amax);
+    uint32x4_t vblack = vdupq_n_u32(0xff000000);
+    jint y = 0;
+    for (; y + 4 <= dsth; y += 4) {
+        jint *src = srcPixels + y * srcscan;
+        jint *dst = dstPixels + y * dstscan;
+        uint32x4_t suma = vdupq_n_u32(0);
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                jint o = x - hsize;
+                uint32_t p[4] = {
+                    (uint32_t) src[o], (uint32_t) src[srcscan + o],
+                    (uint32_t) src[2 * srcscan + o], (uint32_t) src[3 * srcscan + o]
+                };
+                suma = vsubq_u32(suma, vshrq_n_u32(vld1q_u32(p), 24));
+            }
+            if (x < srcw) {
+                uint32_t p[4] = {
+                    (uint32_t) src[x], (uint32_t) src[srcscan + x],
+                    (uint32_t) src[2 * srcscan + x], (uint32_t) src[3 * srcscan + x]
+                };
+                suma = vaddq_u32(suma, vshrq_n_u32(vld1q_u32(p), 24));
+            }
+            uint32x4_t a = vshlq_n_u32(scaleNEON(suma, vkscale), 24);
+            a = clampShadowNEON(suma, a, vamin, vamax, vblack);
+            dst[x] = (jint) vgetq_lane_u32(a, 0);
+            dst[dstscan + x] = (jint) vgetq_lane_u32(a, 1);
+            dst[2 * dstscan + x] = (jint) vgetq_lane_u32(a, 2);
+            dst[3 * dstscan + x] = (jint) vgetq_lane_u32(a, 3);
+        }
+    }
+    return y;
+}
+
+static jint boxShadowVerticalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srch, jint srcscan,
+                                  jint vsize, jint amin, jint amax, jint kscale,
+                                  const jint *kscales, jint shadowRGB)
+{
+    uint32x4_t vamin = vdupq_n_u32((uint32_t) amin);
+    uint32x4_t vamax = vdupq_n_u32((uint32_t) amax);
+    uint32x4_t vshadow = vdupq_n_u32((uint32_t) shadowRGB);
+    uint32x4_t vka = vdupq_n_u32((uint32_t) (kscales != NULL ? kscales[0] : kscale));
+    uint32x4_t vkr = vdupq_n_u32((uint32_t) (kscales != NULL ? kscales[1] : 0));
+    uint32x4_t vkg = vdupq_n_u32((uint32_t) (kscales != NULL ? kscales[2] : 0));
+    uint32x4_t vkb = vdupq_n_u32((uint32_t) (kscales != NULL ? kscales[3] : 0));
+    jint voff = vsize * srcscan;
+    jint x = 0;
+    for (; x + 4 <= dstw; x += 4) {
+        uint32x4_t suma = vdupq_n_u32(0);
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            if (y >= vsize) {
+                uint32x4_t p = vld1q_u32((const uint32_t *) (srcPixels + srcoff - voff));
+                suma = vsubq_u32(suma, vshrq_n_u32(p, 24));
+            }
+            if (y < srch) {
+                uint32x4_t p = vld1q_u32((const uint32_t *) (srcPixels + srcoff));
+                suma = vaddq_u32(suma, vshrq_n_u32(p, 24));
+            }
+            uint32x4_t v = vshlq_n_u32(scaleNEON(suma, vka), 24);
+            if (kscales != NULL) {
+                v = vorrq_u32(v, vshlq_n_u32(scaleNEON(suma, vkr), 16));
+                v = vorrq_u32(v, vshlq_n_u32(scaleNEON(suma, vkg), 8));
+                v = vorrq_u32(v, scaleNEON(suma, vkb));
+            }
+            v = clampShadowNEON(suma, v, vamin, vamax, vshadow);
+            vst1q_u32((uint32_t *) (dstPixels + dstoff), v);
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+    return x;
+}
+
+// Four pixels at a time, see linearConvolveHVSSE41
+static jint linearConvolveHVNEON(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                                 jint *srcPixels, jint srccols, jint scolinc, jint srowinc,
+                                 const jfloat *kvals, jint kernelSize)
+{
+    jint linelen = kernelSize - 1 + dstcols;
+    jfloat *line = (jfloat *) malloc(linelen * 4 * sizeof(jfloat));
+    if (line == NULL) {
+        return 0;
+    }
+    jint srcend = (srccols < dstcols) ? srccols : dstcols;
+    for (jint r = 0; r < dstrows; r++) {
+        jint srcoff = r * srowinc;
+        jint dstoff = r * drowinc;
+        memset(line, 0, linelen * 4 * sizeof(jfloat));
+        jfloat *p = line + (kernelSize - 1) * 4;
+        for (jint c = 0; c < srcend; c++) {
+            vst1q_f32(p + c * 4, vcvtq_f32_u32(unpackPixelNEON(srcPixels[srcoff])));
+            srcoff += scolinc;
+        }
+        jint c = 0;
+        for (; c + 4 <= dstcols; c += 4) {
+            const jfloat *q = line + c * 4;
+            float32x4_t sum0 = vdupq_n_f32(0.0f);
+            float32x4_t sum1 = vdupq_n_f32(0.0f);
+            float32x4_t sum2 = vdupq_n_f32(0.0f);
+            float32x4_t sum3 = vdupq_n_f32(0.0f);
+            for (jint j = 0; j < kernelSize; j++) {
+                const jfloat *qj = q + j * 4;
+                sum0 = vaddq_f32(sum0, vmulq_n_f32(vld1q_f32(qj), kvals[j]));
+                sum1 = vaddq_f32(sum1, vmulq_n_f32(vld1q_f32(qj + 4), kvals[j]));
+                sum2 = vaddq_f32(sum2, vmulq_n_f32(vld1q_f32(qj + 8), kvals[j]));
+                sum3 = vaddq_f32(sum3, vmulq_n_f32(vld1q_f32(qj + 12), kvals[j]));
+            }
+            dstPixels[dstoff] = packClampedNEON(sum0);
+            dstoff += dcolinc;
+            dstPixels[dstoff] = packClampedNEON(sum1);
+            dstoff += dcolinc;
+            dstPixels[dstoff] = packClampedNEON(sum2);
+            dstoff += dcolinc;
+            dstPixels[dstoff] = packClampedNEON(sum3);
+            dstoff += dcolinc;
+        }
+        for (; c < dstcols; c++) {
+            const jfloat *q = line + c * 4;
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (jint j = 0; j < kernelSize; j++) {
+                sum = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(q + j * 4), kvals[j]));
+            }
+            dstPixels[dstoff] = packClampedNEON(sum);
+            dstoff += dcolinc;
+        }
+    }
+    free(line);
+    return dstrows;
+}
+
+#endif /* SIMD_ARM64 */
+
+jint simdBoxBlurHorizontal(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                           jint *srcPixels, jint srcw, jint srcscan,
+                           jint hsize, jint kscale)
+{
+    switch (simdLevel) {
+#ifdef SIMD_X86
+        case SIMD_AVX2:
+            return boxBlurHorizontalAVX2(dstPixels, dstw, dsth, dstscan,
+                                         srcPixels, srcw, srcscan, hsize, kscale);
+        case SIMD_SSE41:
+            return boxBlurHorizontalSSE41(dstPixels, dstw, dsth, dstscan,
+                                          srcPixels, srcw, srcscan, hsize, kscale);
+#endif
+#ifdef SIMD_ARM64
+        case SIMD_NEON:
+            return boxBlurHorizontalNEON(dstPixels, dstw, dsth, dstscan,
+                                         srcPixels, srcw, srcscan, hsize, kscale);
+#endif
+        default:
+            return 0;
+    }
+}
+
+jint simdBoxBlurVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                         jint *srcPixels, jint srch, jint srcscan,
+                         jint vsize, jint kscale)
+{
+    switch (simdLevel) {
+#ifdef SIMD_X86
+        case SIMD_AVX2:
+            return boxBlurVerticalAVX2(dstPixels, dstw, dsth, dstscan,
+                                       srcPixels, srch, srcscan, vsize, kscale);
+        case SIMD_SSE41:
+            return boxBlurVerticalSSE41(dstPixels, dstw, dsth, dstscan,
+                                        srcPixels, srch, srcscan, vsize, kscale);
+#endif
+#ifdef SIMD_ARM64
+        case SIMD_NEON:
+            return boxBlurVerticalNEON(dstPixels, dstw, dsth, dstscan,
+                                       srcPixels, srch, srcscan, vsize, kscale);
+#endif
+        default:
+            return 0;
+    }
+}
+
+jint simdBoxShadowHorizontalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srcw, jint srcscan,
+                                  jint hsize, jint amin, jint amax, jint kscale)
+{
+    switch (simdLevel) {
+#ifdef SIMD_X86
+        case SIMD_AVX2:
+            return boxShadowHorizontalBlackAVX2(dstPixels, dstw, dsth, dstscan,
+                                                srcPixels, srcw, srcscan,
+                                                hsize, amin, amax, kscale);
+        case SIMD_SSE41:
+            return boxShadowHorizontalBlackSSE41(dstPixels, dstw, dsth, dstscan,
+                                                 srcPixels, srcw, srcscan,
+                                                 hsize, amin, amax, kscale);
+#endif
+#ifdef SIMD_ARM64
+        case SIMD_NEON:
+            return boxShadowHorizontalBlackNEON(dstPixels, dstw, dsth, dstscan,
+                                                srcPixels, srcw, srcscan,
+                                                hsize, amin, amax, kscale);
+#endif
+        default:
+            return 0;
+    }
+}
+
+jint simdBoxShadowVerticalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                jint *srcPixels, jint srch, jint srcscan,
+                                jint vsize, jint amin, jint amax, jint kscale)
+{
+    switch (simdLevel) {
+#ifdef SIMD_X86
+        case SIMD_AVX2:
+            return boxShadowVerticalAVX2(dstPixels, dstw, dsth, dstscan,
+                                         srcPixels, srch, srcscan,
+                                         vsize, amin, amax, kscale, NULL, (jint) 0xff000000);
+        case SIMD_SSE41:
+            return boxShadowVerticalSSE41(dstPixels, dstw, dsth, dstscan,
+                                          srcPixels, srch, srcscan,
+                                          vsize, amin, amax, kscale, NULL, (jint) 0xff000000);
+#endif
+#ifdef SIMD_ARM64
+        case SIMD_NEON:
+            return boxShadowVerticalNEON(dstPixels, dstw, dsth, dstscan,
+                                         srcPixels, srch, srcscan,
+                                         vsize, amin, amax, kscale, NULL, (jint) 0xff000000);
+#endif
+        default:
+            return 0;
+    }
+}
+
+jint simdBoxShadowVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                           jint *srcPixels, jint srch, jint srcscan,
+                           jint vsize, jint amin, jint amax,
+                           const jint *kscales, jint shadowRGB)
+{
+    switch (simdLevel) {
+#ifdef SIMD_X86
+        case SIMD_AVX2:
+            return boxShadowVerticalAVX2(dstPixels, dstw, dsth, dstscan,
+                                         srcPixels, srch, srcscan,
+                                         vsize, amin, amax, 0, kscales, shadowRGB);
+        case SIMD_SSE41:
+            return boxShadowVerticalSSE41(dstPixels, dstw, dsth, dstscan,
+                                          srcPixels, srch, srcscan,
+                                          vsize, amin, amax, 0, kscales, shadowRGB);
+#endif
+#ifdef SIMD_ARM64
+        case SIMD_NEON:
+            return boxShadowVerticalNEON(dstPixels, dstw, dsth, dstscan,
+                                         srcPixels, srch, srcscan,
+                                         vsize, amin, amax, 0, kscales, shadowRGB);
+#endif
+        default:
+            return 0;
+    }
+}
+
+jint simdLinearConvolveHV(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                          jint *srcPixels, jint srccols, jint scolinc, jint srowinc,
+                          const jfloat *kvals, jint kernelSize)
+{
+    switch (simdLevel) {
+#ifdef SIMD_X86
+        case SIMD_AVX2:
+            return linearConvolveHVAVX2(dstPixels, dstcols, dstrows, dcolinc, drowinc,
+                                        srcPixels, srccols, scolinc, srowinc,
+                                        kvals, kernelSize);
+        case SIMD_SSE41:
+            return linearConvolveHVSSE41(dstPixels, dstcols, dstrows, dcolinc, drowinc,
+                                         srcPixels, srccols, scolinc, srowinc,
+                                         kvals, kernelSize);
+#endif
+#ifdef SIMD_ARM64
+        case SIMD_NEON:
+            return linearConvolveHVNEON(dstPixels, dstcols, dstrows, dcolinc, drowinc,
+                                        srcPixels, srccols, scolinc, srowinc,
+                                        kvals, kernelSize);
+#endif
+        default:
+            return 0;
+    }
+}
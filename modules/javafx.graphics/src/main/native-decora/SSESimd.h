@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _Included_SSESimd
+#define _Included_SSESimd
+
+#include <jni.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Vector versions of the box blur, box shadow and linear convolve loops.
+ *
+ * Each function filters as many rows or columns as its instruction set
+ * allows and returns how many it did, counted from the first one. The
+ * caller runs its scalar loop over the remaining ones, so 0 means that
+ * the scalar loop does all of the work. The box blur and box shadow
+ * functions produce the same pixels as the scalar loops, the linear
+ * convolve sums are added up in a different order and can differ by one.
+ */
+
+#define SIMD_SCALAR 0
+#define SIMD_SSE41  1
+#define SIMD_AVX2   2
+#define SIMD_NEON   3
+
+/*
+ * Selects the instruction set used by the functions below and returns its
+ * name. This is the best one the processor supports, unless requested
+ * names a lower one ("scalar", "sse4.1" or "avx2").
+ */
+const char* selectSIMDLevel(const char *requested);
+
+jint simdBoxBlurHorizontal(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                           jint *srcPixels, jint srcw, jint srcscan,
+                           jint hsize, jint kscale);
+
+jint simdBoxBlurVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                         jint *srcPixels, jint srch, jint srcscan,
+                         jint vsize, jint kscale);
+
+jint simdBoxShadowHorizontalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srcw, jint srcscan,
+                                  jint hsize, jint amin, jint amax, jint kscale);
+
+jint simdBoxShadowVerticalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                jint *srcPixels, jint srch, jint srcscan,
+                                jint vsize, jint amin, jint amax, jint kscale);
+
+/* kscales holds the alpha, red, green and blue scales in that order */
+jint simdBoxShadowVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                           jint *srcPixels, jint srch, jint srcscan,
+                           jint vsize, jint amin, jint amax,
+                           const jint *kscales, jint shadowRGB);
+
+jint simdLinearConvolveHV(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                          jint *srcPixels, jint srccols, jint scolinc, jint srowinc,
+                          const jfloat *kvals, jint kernelSize);
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif /* _Included_SSESimd */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,10 +24,15 @@
  */
 
 #include "SSEUtils.h"
+#include "SSESimd.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 #ifdef WIN32 /* WIN32 */
 #include <windows.h>
+#include <malloc.h>
 #endif
 
 JNIEXPORT jboolean JNICALL
@@ -43,6 +48,22 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_isSupported
 #endif
 }
 
+JNIEXPORT jstring JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_selectInstructionSet
+    (JNIEnv *env, jclass klass, jstring requested_str)
+{
+    const char *requested = NULL;
+    if (requested_str != NULL) {
+        requested = env->GetStringUTFChars(requested_str, NULL);
+        if (requested == NULL) return NULL;
+    }
+    const char *selected = selectSIMDLevel(requested);
+    if (requested != NULL) {
+        env->ReleaseStringUTFChars(requested_str, requested);
+    }
+    return env->NewStringUTF(selected);
+}
+
 static void laccum(jint pixel, jfloat mul, jfloat *fvals) {
     mul /= 255.f;
     fvals[FVAL_R] += ((pixel >> 16) & 0xff) * mul;
@@ -204,3 +225,77 @@ bool checkRange(JNIEnv *env,
             (srcw * srch) > env->GetArrayLength(srcPixels_arr) ||
             (dstw * dsth) > env->GetArrayLength(dstPixels_arr));
 }
+
+#ifdef WIN32 /* WIN32 */
+#define alignedFree(p) _aligned_free(p)
+#else
+#define alignedFree(p) free(p)
+#endif
+
+static void *alignedAlloc(size_t size)
+{
+#ifdef WIN32 /* WIN32 */
+    return _aligned_malloc(size, 64);
+#else
+    void *p;
+    return (posix_memalign(&p, 64, size) == 0) ? p : NULL;
+#endif
+}
+
+/*
+ * The scratch buffers of a thread, freed when the thread exits.
+ */
+struct ScratchArena {
+    void *buffers[SCRATCH_SLOTS];
+    size_t sizes[SCRATCH_SLOTS];
+
+    ScratchArena() {
+        for (int i = 0; i < SCRATCH_SLOTS; i++) {
+            buffers[i] = NULL;
+            sizes[i] = 0;
+        }
+    }
+
+    ~ScratchArena() {
+        for (int i = 0; i < SCRATCH_SLOTS; i++) {
+            alignedFree(buffers[i]);
+        }
+    }
+};
+
+static thread_local ScratchArena scratchArena;
+
+void *getScratch(jint slot, size_t size)
+{
+    if (slot < 0 || slot >= SCRATCH_SLOTS) return NULL;
+    if (scratchArena.sizes[slot] < size) {
+        // Grow in steps of 64K so that an animated effect with a slowly
+        // growing size does not reallocate on every frame
+        size_t newSize = (size + 0xffff) & ~((size_t) 0xffff);
+        void *buffer = alignedAlloc(newSize);
+        if (buffer == NULL) return NULL;
+        alignedFree(scratchArena.buffers[slot]);
+        scratchArena.buffers[slot] = buffer;
+        scratchArena.sizes[slot] = newSize;
+    }
+    return scratchArena.buffers[slot];
+}
+
+jfloat *getWeights(JNIEnv *env, jobject weights_buf, jint count,
+                   bool doubled, jint slot)
+{
+    if (weights_buf == NULL || count <= 0 ||
+        env->GetDirectBufferCapacity(weights_buf) < count)
+    {
+        return NULL;
+    }
+    jfloat *src = (jfloat *)env->GetDirectBufferAddress(weights_buf);
+    if (src == NULL) return NULL;
+    jint copies = doubled ? 2 : 1;
+    jfloat *weights = (jfloat *)getScratch(slot, copies * count * sizeof(jfloat));
+    if (weights == NULL) return NULL;
+    for (jint i = 0; i < copies; i++) {
+        memcpy(weights + i * count, src, count * sizeof(jfloat));
+    }
+    return weights;
+}
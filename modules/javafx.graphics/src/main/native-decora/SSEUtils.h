@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,6 +61,27 @@ bool checkRange(JNIEnv *env,
                 jintArray dstPixels_arr, jint dstw, jint dsth,
                 jintArray srcPixels_arr, jint srcw, jint srch);
 
+#define SCRATCH_SLOTS 4
+
+/*
+ * Returns a scratch buffer of at least size bytes, aligned on 64 bytes,
+ * that belongs to the calling thread. Each of the SCRATCH_SLOTS slots is
+ * a separate buffer that is kept for the next call with the same slot,
+ * so the contents are only valid until then. Returns NULL if the memory
+ * cannot be allocated.
+ */
+void *getScratch(jint slot, size_t size);
+
+/*
+ * Returns the first count weights of the direct FloatBuffer weights_buf,
+ * copied into the scratch buffer of the given slot. The centered convolve
+ * loops index a kernel that is repeated twice in a row, which is what
+ * doubled produces. Returns NULL if the buffer is not direct, holds fewer
+ * than count weights or the scratch buffer cannot be allocated.
+ */
+jfloat *getWeights(JNIEnv *env, jobject weights_buf, jint count,
+                   bool doubled, jint slot);
+
 #ifdef __cplusplus
 };
 #endif /* __cplusplus */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1296,6 +1296,10 @@ public:
     UINT32 GetLength();
     UINT32 GetGlyphCount();
     UINT32 GetTotalGlyphCount();
+    UINT32 GetRunCount();
+    UINT32 GetTotalLength();
+    void CopyRuns(jlong* faces, jint* runLengths, jint* glyphs,
+                  jfloat* advances, jfloat* offsets, jshort* clusterMap);
     IDWriteFontFace* GetFontFace();
     const UINT16* GetClusterMap();
     const UINT16* GetGlyphIndices();
@@ -1451,6 +1455,58 @@ UINT32 JFXTextRenderer::GetTotalGlyphCount() {
     return totalGlyphCount_;
 }
 
+UINT32 JFXTextRenderer::GetRunCount() {
+    return (UINT32)runs_.size();
+}
+
+UINT32 JFXTextRenderer::GetTotalLength() {
+    UINT32 length = 0;
+    for (size_t r = 0; r < runs_.size(); r++) {
+        length += runs_[r].glyphRunDescription.stringLength;
+    }
+    return length;
+}
+
+/* Copies all the runs at once. The arrays are sized by the caller
+ * using GetRunCount(), GetTotalGlyphCount() and GetTotalLength().
+ * For each run, runLengths gets the glyph count and the text length.
+ * As in GetClusterMap, the cluster map is relative to the start of
+ * the glyphs of all the runs.
+ */
+void JFXTextRenderer::CopyRuns(jlong* faces, jint* runLengths, jint* glyphs,
+                               jfloat* advances, jfloat* offsets, jshort* clusterMap) {
+    UINT32 glyphStart = 0;
+    UINT32 textStart = 0;
+    for (size_t r = 0; r < runs_.size(); r++) {
+        const DWRITE_GLYPH_RUN& glyphRun = runs_[r].glyphRun;
+        const DWRITE_GLYPH_RUN_DESCRIPTION& desc = runs_[r].glyphRunDescription;
+        UINT32 glyphCount = glyphRun.glyphCount;
+        UINT32 textLength = desc.stringLength;
+
+        faces[r] = (jlong)glyphRun.fontFace;
+        runLengths[r * 2] = (jint)glyphCount;
+        runLengths[r * 2 + 1] = (jint)textLength;
+
+        UINT32 i;
+        for (i = 0; i < glyphCount; i++) {
+            glyphs[glyphStart + i] = glyphRun.glyphIndices[i];
+            advances[glyphStart + i] = glyphRun.glyphAdvances[i];
+            if (glyphRun.glyphOffsets) {
+                offsets[(glyphStart + i) * 2] = glyphRun.glyphOffsets[i].advanceOffset;
+                offsets[(glyphStart + i) * 2 + 1] = glyphRun.glyphOffsets[i].ascenderOffset;
+            } else {
+                offsets[(glyphStart + i) * 2] = 0;
+                offsets[(glyphStart + i) * 2 + 1] = 0;
+            }
+        }
+        for (i = 0; i < textLength; i++) {
+            clusterMap[textStart + i] = desc.clusterMap[i] + (jshort)glyphStart;
+        }
+        glyphStart += glyphCount;
+        textStart += textLength;
+    }
+}
+
 IDWriteFontFace* JFXTextRenderer::GetFontFace() {
     if (((UINT32)position_) >= runs_.size()) return NULL;
     return runs_[position_].glyphRun.fontFace;
@@ -1507,6 +1563,50 @@ JNIEXPORT jint JNICALL OS_NATIVE(JFXTextRendererGetTotalGlyphCount)
     return ((JFXTextRenderer*)arg0)->GetTotalGlyphCount();
 }
 
+JNIEXPORT jint JNICALL OS_NATIVE(JFXTextRendererGetRunCount)
+(JNIEnv *env, jclass that, jlong arg0) {
+    return ((JFXTextRenderer*)arg0)->GetRunCount();
+}
+
+JNIEXPORT jint JNICALL OS_NATIVE(JFXTextRendererGetRuns)
+(JNIEnv *env, jclass that, jlong arg0, jlongArray arg1, jintArray arg2,
+ jintArray arg3, jfloatArray arg4, jfloatArray arg5, jshortArray arg6) {
+    if (!arg1 || !arg2 || !arg3 || !arg4 || !arg5 || !arg6) return 0;
+
+    JFXTextRenderer* renderer = (JFXTextRenderer*)arg0;
+    // Type cast unsigned int to int. It is safe to assume the counts will never exceed max of jint
+    jint runCount = (jint) renderer->GetRunCount();
+    jint glyphCount = (jint) renderer->GetTotalGlyphCount();
+    jint textLength = (jint) renderer->GetTotalLength();
+    if (env->GetArrayLength(arg1) < runCount) return 0;
+    if (env->GetArrayLength(arg2) < runCount * 2) return 0;
+    if (env->GetArrayLength(arg3) < glyphCount) return 0;
+    if (env->GetArrayLength(arg4) < glyphCount) return 0;
+    if (env->GetArrayLength(arg5) < glyphCount * 2) return 0;
+    if (env->GetArrayLength(arg6) < textLength) return 0;
+
+    jlong* faces = env->GetLongArrayElements(arg1, NULL);
+    jint* runLengths = env->GetIntArrayElements(arg2, NULL);
+    jint* glyphs = env->GetIntArrayElements(arg3, NULL);
+    jfloat* advances = env->GetFloatArrayElements(arg4, NULL);
+    jfloat* offsets = env->GetFloatArrayElements(arg5, NULL);
+    jshort* clusterMap = env->GetShortArrayElements(arg6, NULL);
+
+    jint result = 0;
+    if (faces && runLengths && glyphs && advances && offsets && clusterMap) {
+        renderer->CopyRuns(faces, runLengths, glyphs, advances, offsets, clusterMap);
+        result = runCount;
+    }
+
+    if (faces) env->ReleaseLongArrayElements(arg1, faces, result ? 0 : JNI_ABORT);
+    if (runLengths) env->ReleaseIntArrayElements(arg2, runLengths, result ? 0 : JNI_ABORT);
+    if (glyphs) env->ReleaseIntArrayElements(arg3, glyphs, result ? 0 : JNI_ABORT);
+    if (advances) env->ReleaseFloatArrayElements(arg4, advances, result ? 0 : JNI_ABORT);
+    if (offsets) env->ReleaseFloatArrayElements(arg5, offsets, result ? 0 : JNI_ABORT);
+    if (clusterMap) env->ReleaseShortArrayElements(arg6, clusterMap, result ? 0 : JNI_ABORT);
+    return result;
+}
+
 JNIEXPORT jlong JNICALL OS_NATIVE(JFXTextRendererGetFontFace)
 (JNIEnv *env, jclass that, jlong arg0) {
     return (jlong)((JFXTextRenderer*)arg0)->GetFontFace();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -400,18 +400,19 @@ JNIEXPORT jbyteArray JNICALL OS_NATIVE(getBitmapData)(JNIEnv *env, jclass that,
 JNIEXPORT void JNICALL OS_NATIVE(FT_1Set_1Transform)
     (JNIEnv *env, jclass that, jlong arg0, jobject arg1, jlong arg2, jlong arg3)
 {
-    FT_Vector *lpDelta = NULL;
-    if (arg2 || arg3) {
-        FT_Vector vec = {arg2, arg3};
-        lpDelta = &vec;
-    }
+    /* A null matrix is the identity, a zero delta none */
+    FT_Matrix matrix, *lpMatrix = NULL;
+    FT_Vector delta, *lpDelta = NULL;
     if (arg1) {
-        FT_Matrix matrix, *lpMatrix = NULL;
         lpMatrix = getFT_MatrixFields(env, arg1, &matrix);
-        if (lpMatrix) {
-            FT_Set_Transform((FT_Face)arg0, lpMatrix, lpDelta);
-        }
+        if (!lpMatrix) return;
     }
+    if (arg2 || arg3) {
+        delta.x = (FT_Pos)arg2;
+        delta.y = (FT_Pos)arg3;
+        lpDelta = &delta;
+    }
+    FT_Set_Transform((FT_Face)arg0, lpMatrix, lpDelta);
 }
 
 JNIEXPORT jint JNICALL OS_NATIVE(FT_1Library_1SetLcdFilter)
@@ -507,9 +508,10 @@ static PathData* checkSize(void* user, int coordCount)
 {
     PathData* info = (PathData *)user;
 
+    /* Grow geometrically, the initial size is only an estimate */
     if (info->numTypes == info->lenTypes) {
-        if (info->lenTypes > SIZE_MAX - DEFAULT_LEN_TYPES) goto fail;
-        info->lenTypes += DEFAULT_LEN_TYPES;
+        if (info->lenTypes > SIZE_MAX / 2) goto fail;
+        info->lenTypes *= 2;
 
         jbyte* newPointTypes = (jbyte*)realloc(info->pointTypes, info->lenTypes * sizeof(jbyte));
         if (newPointTypes == NULL) goto fail;
@@ -517,8 +519,8 @@ static PathData* checkSize(void* user, int coordCount)
     }
 
     if (info->numCoords + (coordCount * 2) > info->lenCoords) {
-        if (info->lenCoords > SIZE_MAX - DEFAULT_LEN_COORDS) goto fail;
-        info->lenCoords += DEFAULT_LEN_COORDS;
+        if (info->lenCoords > SIZE_MAX / 2 / sizeof(jfloat)) goto fail;
+        info->lenCoords *= 2;
 
         jfloat* newPointCoords = (jfloat*)realloc(info->pointCoords, info->lenCoords * sizeof(jfloat));
         if (newPointCoords == NULL) goto fail;
@@ -615,17 +617,30 @@ JNIEXPORT jobject JNICALL OS_NATIVE(FT_1Outline_1Decompose)
 
     jobject path2D = NULL;
     PathData data;
-    data.pointTypes = (jbyte*)malloc(sizeof(jbyte) * DEFAULT_LEN_TYPES);
+
+    /* Size the buffers from the outline so that they rarely need to grow.
+     * Every segment consumes at least one point, except that a conic
+     * between two off points adds an implied on point, and every contour
+     * starts with a move.
+     */
+    size_t numPoints = outline->n_points > 0 ? outline->n_points : 0;
+    size_t numContours = outline->n_contours > 0 ? outline->n_contours : 0;
+    size_t lenTypes = numPoints + numContours;
+    size_t lenCoords = (numPoints * 2 + numContours) * 2;
+    if (lenTypes < DEFAULT_LEN_TYPES) lenTypes = DEFAULT_LEN_TYPES;
+    if (lenCoords < DEFAULT_LEN_COORDS) lenCoords = DEFAULT_LEN_COORDS;
+
+    data.pointTypes = (jbyte*)malloc(sizeof(jbyte) * lenTypes);
     data.numTypes = 0;
-    data.lenTypes = DEFAULT_LEN_TYPES;
+    data.lenTypes = lenTypes;
     if (data.pointTypes == NULL) {
         data.pointCoords = NULL;
         goto fail;
     }
 
-    data.pointCoords = (jfloat*)malloc(sizeof(jfloat) * DEFAULT_LEN_COORDS);
+    data.pointCoords = (jfloat*)malloc(sizeof(jfloat) * lenCoords);
     data.numCoords = 0;
-    data.lenCoords = DEFAULT_LEN_COORDS;
+    data.lenCoords = lenCoords;
     if (data.pointCoords == NULL) goto fail;
 
     /* Decompose outline */
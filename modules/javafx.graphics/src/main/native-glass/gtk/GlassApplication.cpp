@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,6 +52,8 @@ JNIEnv* mainEnv; // Use only with main loop thread!!!
 PlatformSupport* platformSupport = NULL;
 
 extern gboolean disableGrab;
+extern gboolean disableXShm;
+extern gboolean disableMotionCoalescing;
 
 void checkGtkVersion(JNIEnv* env, jint reqMajor) {
     // Major version is checked before loading
@@ -139,11 +141,11 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1initGTK
 /*
  * Class:     com_sun_glass_ui_gtk_GtkApplication
  * Method:    _queryLibrary
- * Signature: Signature: (IZ)I
+ * Signature: Signature: (IZZ)I
  */
 #ifndef STATIC_BUILD
 JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1queryLibrary
-  (JNIEnv *env, jclass clazz, jint suggestedVersion, jboolean verbose)
+  (JNIEnv *env, jclass clazz, jint suggestedVersion, jboolean verbose, jboolean wayland)
 {
     // If we are being called, then the launcher is
     // not in use, and we are in the proper glass library already.
@@ -157,6 +159,11 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1queryLibrary
     (void)suggestedVersion;
     (void)verbose;
 
+    if (wayland) {
+        putenv((char *) "GDK_BACKEND=wayland");
+        return com_sun_glass_ui_gtk_GtkApplication_QUERY_USE_CURRENT;
+    }
+
     Display *display = XOpenDisplay(NULL);
     if (display == NULL) {
         return com_sun_glass_ui_gtk_GtkApplication_QUERY_NO_DISPLAY;
@@ -173,15 +180,20 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1queryLibrary
  * Signature: ()V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1init
-  (JNIEnv * env, jobject obj, jlong handler, jboolean _disableGrab)
+  (JNIEnv * env, jobject obj, jlong handler, jboolean _disableGrab, jboolean _disableXShm,
+   jboolean _disableMotionCoalescing)
 {
     (void)obj;
 
     mainEnv = env;
     process_events_prev = (GdkEventFunc) handler;
     disableGrab = (gboolean) _disableGrab;
+    disableXShm = (gboolean) _disableXShm;
+    disableMotionCoalescing = (gboolean) _disableMotionCoalescing;
 
-    glass_gdk_x11_display_set_window_scale(gdk_display_get_default(), 1);
+    if (GDK_IS_X11_DISPLAY(gdk_display_get_default())) {
+        glass_gdk_x11_display_set_window_scale(gdk_display_get_default(), 1);
+    }
     gdk_event_handler_set(process_events, NULL, NULL);
 
     GdkScreen *default_gdk_screen = gdk_screen_get_default();
@@ -478,6 +490,11 @@ static void process_events(GdkEvent* event, gpointer data)
 
     EventsCounterHelper helper(ctx);
 
+    if (event->type != GDK_MOTION_NOTIFY) {
+        // Report coalesced motion before anything that happened after it
+        WindowContextBase::flush_pending_motion();
+    }
+
     if ((event->type == GDK_KEY_PRESS || event->type == GDK_KEY_RELEASE) && ctx != NULL && ctx->filterIME(event)) {
         return;
     }
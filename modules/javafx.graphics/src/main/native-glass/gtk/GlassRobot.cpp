@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,11 +41,19 @@
 #define MOUSE_BACK_BTN 8
 #define MOUSE_FORWARD_BTN 9
 
-static void checkXTest(JNIEnv* env) {
+static gboolean checkXTest(JNIEnv* env) {
     int32_t major_opcode, first_event, first_error;
     int32_t  event_basep, error_basep, majorp, minorp;
     static int32_t isXTestAvailable;
     static gboolean checkDone = FALSE;
+    if (!GDK_IS_X11_DISPLAY(gdk_display_get_default())) {
+        // On the GDK Wayland backend the robot only works through the
+        // remote desktop portal
+        jclass cls = env->FindClass("java/lang/UnsupportedOperationException");
+        if (env->ExceptionCheck()) return FALSE;
+        env->ThrowNew(cls, "Glass Robot needs the remote desktop portal to work on Wayland");
+        return FALSE;
+    }
     if (!checkDone) {
         /* check if XTest is available */
         isXTestAvailable = XQueryExtension(gdk_x11_get_default_xdisplay(), XTestExtensionName, &major_opcode, &first_event, &first_error);
@@ -62,9 +70,11 @@ static void checkXTest(JNIEnv* env) {
     }
     if (!isXTestAvailable) {
         jclass cls = env->FindClass("java/lang/UnsupportedOperationException");
-        if (env->ExceptionCheck()) return;
+        if (env->ExceptionCheck()) return FALSE;
         env->ThrowNew(cls, "Glass Robot needs XTest extension to work");
+        return FALSE;
     }
+    return TRUE;
 }
 
 static void keyButton(jint code, gboolean press)
@@ -97,8 +107,9 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1keyPress
 {
     (void)obj;
 
-    checkXTest(env);
-    keyButton(code, TRUE);
+    if (checkXTest(env)) {
+        keyButton(code, TRUE);
+    }
 }
 
 /*
@@ -111,8 +122,9 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1keyRelease
 {
     (void)obj;
 
-    checkXTest(env);
-    keyButton(code, FALSE);
+    if (checkXTest(env)) {
+        keyButton(code, FALSE);
+    }
 }
 
 /*
@@ -125,8 +137,10 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1mouseMove
 {
     (void)obj;
 
+    if (!checkXTest(env)) {
+        return;
+    }
     Display *xdisplay = gdk_x11_get_default_xdisplay();
-    checkXTest(env);
     jfloat uiScale = getUIScale(gdk_screen_get_default());
     x = rint(x * uiScale);
     y = rint(y * uiScale);
@@ -169,8 +183,9 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1mousePress
 {
     (void)obj;
 
-    checkXTest(env);
-    mouseButtons(buttons, TRUE);
+    if (checkXTest(env)) {
+        mouseButtons(buttons, TRUE);
+    }
 }
 
 /*
@@ -183,8 +198,9 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1mouseRelease
 {
     (void)obj;
 
-    checkXTest(env);
-    mouseButtons(buttons, FALSE);
+    if (checkXTest(env)) {
+        mouseButtons(buttons, FALSE);
+    }
 }
 
 /*
@@ -197,12 +213,14 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1mouseWheel
 {
     (void)obj;
 
+    if (!checkXTest(env)) {
+        return;
+    }
     Display *xdisplay = gdk_x11_get_default_xdisplay();
     int repeat = abs(amt);
     int button = amt < 0 ? 4 : 5;
     int i;
 
-    checkXTest(env);
     for (i = 0; i < repeat; i++) {
         XTestFakeButtonEvent(xdisplay, button, True, CurrentTime);
         XTestFakeButtonEvent(xdisplay, button, False, CurrentTime);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -172,15 +172,8 @@ static void set_jstring_data(GtkSelectionData *selection_data, GdkAtom target, j
 
 static void set_bytebuffer_data(GtkSelectionData *selection_data, GdkAtom target, jobject data)
 {
-    jbyteArray byteArray = (jbyteArray) mainEnv->CallObjectMethod(data, jByteBufferArray);
-    CHECK_JNI_EXCEPTION(mainEnv)
-    jbyte* raw = mainEnv->GetByteArrayElements(byteArray, NULL);
-    jsize nraw = mainEnv->GetArrayLength(byteArray);
-
     //XXX is target == type ??
-    gtk_selection_data_set(selection_data, target, 8, (guchar *)raw, (gint)nraw);
-
-    mainEnv->ReleaseByteArrayElements(byteArray, raw, JNI_ABORT);
+    glass_gtk_selection_data_set_bytebuffer(mainEnv, selection_data, target, data);
 }
 
 static void set_uri_data(GtkSelectionData *selection_data, jobject data) {
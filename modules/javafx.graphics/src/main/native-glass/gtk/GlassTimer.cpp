@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,11 +27,36 @@
 
 #include <glib.h>
 #include <gdk/gdk.h>
+#include <gtk/gtk.h>
 #include <stdlib.h>
 
 static gboolean call_runnable_in_timer
   (gpointer);
 
+/*
+ * The vsync timer ticks on the frame clock of a mapped window, so that
+ * pulses follow the frames of the compositor rather than drift against
+ * them. While no window is mapped it ticks on a timeout at the nominal
+ * refresh period, looking for one to attach to.
+ */
+#define VSYNC_FALLBACK_PERIOD 16
+
+// How many earlier frames to look through for a presentation time
+#define VSYNC_TIMINGS_HISTORY 4
+
+static struct {
+    jobject timer;
+    GtkWidget* widget;
+    GdkFrameClock* clock;
+    gulong update_handler;
+    gulong unmap_handler;
+    guint timeout;
+    gboolean paused;
+} vsync;
+
+static void vsync_attach();
+static void vsync_detach();
+
 extern "C" {
 
 /*
@@ -67,14 +92,220 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1stop
 {
     (void)obj;
 
+    if (JLONG_TO_PTR(ptr) == &vsync) {
+        vsync_detach();
+        if (vsync.timeout) {
+            g_source_remove(vsync.timeout);
+            vsync.timeout = 0;
+        }
+        env->DeleteGlobalRef(vsync.timer);
+        vsync.timer = NULL;
+        return;
+    }
+
     RunnableContext* context = (RunnableContext*) JLONG_TO_PTR(ptr);
     context->flag = 1;
     env->DeleteGlobalRef(context->runnable);
     context->runnable = NULL;
 }
 
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkTimer
+ * Method:    _startVsync
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1startVsync
+  (JNIEnv * env, jobject obj)
+{
+    if (vsync.timer) {
+        // There is one frame clock timer, for the pulse
+        return 0L;
+    }
+    vsync.timer = env->NewGlobalRef(obj);
+    vsync.paused = FALSE;
+    vsync_attach();
+    return PTR_TO_JLONG(&vsync);
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkTimer
+ * Method:    _pause
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1pause
+  (JNIEnv * env, jobject obj, jlong ptr)
+{
+    (void)env;
+    (void)obj;
+
+    // Only the vsync timer pauses, which is always done on its own thread
+    if (JLONG_TO_PTR(ptr) != &vsync || vsync.paused) {
+        return;
+    }
+    vsync.paused = TRUE;
+    if (vsync.clock) {
+        gdk_frame_clock_end_updating(vsync.clock);
+    }
+}
+
+static gboolean vsync_resume(gpointer data)
+{
+    (void)data;
+
+    if (vsync.timer && vsync.paused) {
+        vsync.paused = FALSE;
+        if (vsync.clock) {
+            gdk_frame_clock_begin_updating(vsync.clock);
+        }
+    }
+    return FALSE;
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkTimer
+ * Method:    _resume
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1resume
+  (JNIEnv * env, jobject obj, jlong ptr)
+{
+    (void)env;
+    (void)obj;
+
+    if (JLONG_TO_PTR(ptr) != &vsync) {
+        return;
+    }
+    // The timer may be resumed from any thread, but the frame clock
+    // belongs to the GTK thread
+    if (g_main_context_is_owner(g_main_context_default())) {
+        vsync_resume(NULL);
+    } else {
+        gdk_threads_add_idle(vsync_resume, NULL);
+    }
+}
+
 } // extern "C"
 
+static void vsync_notify(jlong frameTime, jlong presentationTime)
+{
+    JNIEnv *env;
+    int envStatus = javaVM->GetEnv((void **)&env, JNI_VERSION_1_6);
+    if (envStatus == JNI_EDETACHED) {
+        javaVM->AttachCurrentThread((void **)&env, NULL);
+    }
+
+    env->CallVoidMethod(vsync.timer, jTimerNotifyVsync, frameTime, presentationTime);
+    LOG_EXCEPTION(env);
+
+    if (envStatus == JNI_EDETACHED) {
+        javaVM->DetachCurrentThread();
+    }
+}
+
+static void vsync_on_update(GdkFrameClock* clock, gpointer data)
+{
+    (void)data;
+
+    // Frame clock times are in microseconds of g_get_monotonic_time(),
+    // which reads CLOCK_MONOTONIC just like System.nanoTime()
+    jlong frameTime = (jlong) gdk_frame_clock_get_frame_time(clock) * 1000;
+
+    // Presentation times arrive from the compositor some frames later
+    jlong presentationTime = 0;
+    gint64 counter = gdk_frame_clock_get_frame_counter(clock);
+    gint64 start = MAX(gdk_frame_clock_get_history_start(clock),
+                       counter - VSYNC_TIMINGS_HISTORY);
+    for (gint64 i = counter - 1; i >= start; i--) {
+        GdkFrameTimings* timings = gdk_frame_clock_get_timings(clock, i);
+        if (timings && gdk_frame_timings_get_complete(timings)
+                && gdk_frame_timings_get_presentation_time(timings) != 0) {
+            presentationTime = (jlong) gdk_frame_timings_get_presentation_time(timings) * 1000;
+            break;
+        }
+    }
+
+    vsync_notify(frameTime, presentationTime);
+}
+
+static gboolean vsync_on_timeout(gpointer data)
+{
+    (void)data;
+
+    if (!vsync.timer) {
+        return FALSE;
+    }
+    vsync_attach();
+    if (vsync.clock) {
+        vsync.timeout = 0;
+        return FALSE;
+    }
+    if (!vsync.paused) {
+        vsync_notify((jlong) g_get_monotonic_time() * 1000, 0);
+    }
+    return TRUE;
+}
+
+static void vsync_on_unmap(GtkWidget* widget, gpointer data)
+{
+    (void)widget;
+    (void)data;
+
+    vsync_detach();
+    vsync_attach();
+}
+
+/*
+ * Attaches the vsync timer to the frame clock of the first mapped window,
+ * or starts the fallback timeout if there is none.
+ */
+static void vsync_attach()
+{
+    if (vsync.clock) {
+        return;
+    }
+
+    GList* toplevels = gtk_window_list_toplevels();
+    for (GList* l = toplevels; l != NULL; l = l->next) {
+        GtkWidget* widget = GTK_WIDGET(l->data);
+        GdkFrameClock* clock = gtk_widget_get_mapped(widget)
+                ? gtk_widget_get_frame_clock(widget) : NULL;
+        if (clock) {
+            vsync.widget = GTK_WIDGET(g_object_ref(widget));
+            vsync.clock = GDK_FRAME_CLOCK(g_object_ref(clock));
+            vsync.update_handler = g_signal_connect(clock, "update",
+                    G_CALLBACK(vsync_on_update), NULL);
+            vsync.unmap_handler = g_signal_connect(widget, "unmap",
+                    G_CALLBACK(vsync_on_unmap), NULL);
+            if (!vsync.paused) {
+                gdk_frame_clock_begin_updating(clock);
+            }
+            break;
+        }
+    }
+    g_list_free(toplevels);
+
+    if (!vsync.clock && !vsync.timeout) {
+        vsync.timeout = gdk_threads_add_timeout_full(G_PRIORITY_HIGH_IDLE,
+                VSYNC_FALLBACK_PERIOD, vsync_on_timeout, NULL, NULL);
+    }
+}
+
+static void vsync_detach()
+{
+    if (!vsync.clock) {
+        return;
+    }
+    if (!vsync.paused) {
+        gdk_frame_clock_end_updating(vsync.clock);
+    }
+    g_signal_handler_disconnect(vsync.clock, vsync.update_handler);
+    g_signal_handler_disconnect(vsync.widget, vsync.unmap_handler);
+    g_object_unref(vsync.clock);
+    g_object_unref(vsync.widget);
+    vsync.clock = NULL;
+    vsync.widget = NULL;
+}
+
 
 static gboolean call_runnable_in_timer
   (gpointer data)
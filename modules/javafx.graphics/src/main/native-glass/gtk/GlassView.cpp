@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,28 @@
 
 #define JLONG_TO_GLASSVIEW(value) ((GlassView *) JLONG_TO_PTR(value))
 
+#define MAX_DAMAGE_RECTS 16
+
+/*
+ * Copies the damage rectangles of an upload and returns their count,
+ * or -1 if the whole view has to be painted.
+ */
+static jint get_damage(JNIEnv *env, jintArray damage, jint *rects)
+{
+    if (!damage) return -1;
+
+    jsize length = env->GetArrayLength(damage);
+    if (length % 4 != 0 || length > MAX_DAMAGE_RECTS * 4) {
+        return -1;
+    }
+    env->GetIntArrayRegion(damage, 0, length, rects);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return -1;
+    }
+    return length / 4;
+}
+
 extern "C" {
 
 /*
@@ -178,10 +200,10 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1scheduleRepaint
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsDirect
- * Signature: (JLjava/nio/Buffer;II)V
+ * Signature: (JLjava/nio/Buffer;II[I)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
-(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height)
+(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height, jintArray damage)
 {
     (void)jView;
 
@@ -190,19 +212,21 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
 
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
+        jint rects[MAX_DAMAGE_RECTS * 4];
+        jint nrects = get_damage(env, damage, rects);
         void *data = env->GetDirectBufferAddress(buffer);
 
-        view->current_window->paint(data, width, height);
+        view->current_window->paint(data, width, height, rects, nrects);
     }
 }
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsIntArray
- * Signature:  (J[IIII)V
+ * Signature:  (J[IIII[I)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
-  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height, jintArray damage)
 {
     (void)obj;
 
@@ -223,10 +247,12 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
 
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
+        jint rects[MAX_DAMAGE_RECTS * 4];
+        jint nrects = get_damage(env, damage, rects);
         int *data = NULL;
         data = (int*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height, rects, nrects);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -235,10 +261,10 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsByteArray
- * Signature:  (J[BIII)V
+ * Signature:  (J[BIII[I)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
-  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height, jintArray damage)
 {
     (void)obj;
 
@@ -259,11 +285,13 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
 
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
+        jint rects[MAX_DAMAGE_RECTS * 4];
+        jint nrects = get_damage(env, damage, rects);
         unsigned char *data = NULL;
 
         data = (unsigned char*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height, rects, nrects);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -538,7 +538,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkWindow__1getNativeWindowImp
     WindowContext* ctx = JLONG_TO_WINDOW_CTX(ptr);
     GdkWindow *win = ctx->get_gdk_window();
 
-    if (win == NULL) {
+    // Only X11 windows have a handle that Prism can render to
+    if (win == NULL || !GDK_IS_X11_WINDOW(win)) {
         return 0;
     }
 
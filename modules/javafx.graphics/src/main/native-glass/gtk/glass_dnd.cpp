@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -748,16 +748,7 @@ static gboolean dnd_source_set_raw(GtkWidget *widget, GtkSelectionData *sel_data
                 mainEnv->ReleaseStringUTFChars((jstring)data, cstring);
             }
         } else if (mainEnv->IsInstanceOf(data, jByteBufferCls)) {
-            jbyteArray byteArray = (jbyteArray)mainEnv->CallObjectMethod(data, jByteBufferArray);
-            if (!EXCEPTION_OCCURED(mainEnv)) {
-                jbyte* raw = mainEnv->GetByteArrayElements(byteArray, NULL);
-                if (raw) {
-                    jsize nraw = mainEnv->GetArrayLength(byteArray);
-                    gtk_selection_data_set(sel_data, atom, 8, (guchar *) raw, nraw);
-                    mainEnv->ReleaseByteArrayElements(byteArray, raw, JNI_ABORT);
-                    is_data_set = TRUE;
-                }
-            }
+            is_data_set = glass_gtk_selection_data_set_bytebuffer(mainEnv, sel_data, atom, data);
         }
     }
 
@@ -44,6 +44,8 @@ jmethodID jArrayListGetIdx;
 
 jmethodID jPixelsAttachData;
 
+jmethodID jTimerNotifyVsync;
+
 jclass jGtkPixelsCls;
 jmethodID jGtkPixelsInit;
 
@@ -64,6 +66,8 @@ jmethodID jViewNotifyScroll;
 jmethodID jViewNotifyInputMethodLinux;
 jmethodID jViewNotifyInputMethodCandidateRelativePosRequest;
 jmethodID jViewNotifyMenu;
+jmethodID jViewNotifyCoalescedPoints;
+jfieldID  jViewCoalescedPointsEnabled;
 jfieldID  jViewPtr;
 
 jmethodID jWindowNotifyResize;
@@ -191,6 +195,11 @@ JNI_OnLoad(JavaVM *jvm, void *reserved)
     jPixelsAttachData = env->GetMethodID(clazz, "attachData", "(J)V");
     if (env->ExceptionCheck()) return JNI_ERR;
 
+    clazz = env->FindClass("com/sun/glass/ui/Timer");
+    if (env->ExceptionCheck()) return JNI_ERR;
+    jTimerNotifyVsync = env->GetMethodID(clazz, "notifyVsync", "(JJ)V");
+    if (env->ExceptionCheck()) return JNI_ERR;
+
     clazz = env->FindClass("com/sun/glass/ui/gtk/GtkPixels");
     if (env->ExceptionCheck()) return JNI_ERR;
 
@@ -230,6 +239,10 @@ JNI_OnLoad(JavaVM *jvm, void *reserved)
     if (env->ExceptionCheck()) return JNI_ERR;
     jViewNotifyMenu = env->GetMethodID(clazz, "notifyMenu", "(IIIIZ)V");
     if (env->ExceptionCheck()) return JNI_ERR;
+    jViewNotifyCoalescedPoints = env->GetMethodID(clazz, "notifyCoalescedPoints", "([I)V");
+    if (env->ExceptionCheck()) return JNI_ERR;
+    jViewCoalescedPointsEnabled = env->GetFieldID(clazz, "coalescedPointsEnabled", "Z");
+    if (env->ExceptionCheck()) return JNI_ERR;
     jViewPtr = env->GetFieldID(clazz, "ptr", "J");
     if (env->ExceptionCheck()) return JNI_ERR;
 
@@ -732,6 +745,39 @@ glass_gtk_selection_data_get_data_with_length(
     return gtk_selection_data_get_data(selectionData);
 }
 
+// Sets the contents of a java.nio.ByteBuffer as selection data. GTK copies
+// the bytes, so they are read in place: from the native memory of a direct
+// buffer, or pinned from the backing array of a heap buffer.
+gboolean
+glass_gtk_selection_data_set_bytebuffer(
+        JNIEnv *env,
+        GtkSelectionData * selectionData,
+        GdkAtom target,
+        jobject buffer) {
+    void *address = env->GetDirectBufferAddress(buffer);
+    if (address != NULL) {
+        jlong capacity = env->GetDirectBufferCapacity(buffer);
+        if (capacity < 0 || capacity > G_MAXINT) {
+            return FALSE;
+        }
+        gtk_selection_data_set(selectionData, target, 8, (const guchar *) address, (gint) capacity);
+        return TRUE;
+    }
+
+    jbyteArray byteArray = (jbyteArray) env->CallObjectMethod(buffer, jByteBufferArray);
+    if (EXCEPTION_OCCURED(env) || byteArray == NULL) {
+        return FALSE;
+    }
+    jsize nraw = env->GetArrayLength(byteArray);
+    void *raw = env->GetPrimitiveArrayCritical(byteArray, NULL);
+    if (raw == NULL) {
+        return FALSE;
+    }
+    gtk_selection_data_set(selectionData, target, 8, (const guchar *) raw, (gint) nraw);
+    env->ReleasePrimitiveArrayCritical(byteArray, raw, JNI_ABORT);
+    return TRUE;
+}
+
 static void
 configure_opaque_window(GtkWidget *window) {
     (void) window;
@@ -146,6 +146,7 @@ private:
     extern jmethodID jArrayListGetIdx; //java.util.ArryList#get (I)Ljava/lang/Object;
 
     extern jmethodID jPixelsAttachData; // com.sun.class.ui.Pixels#attachData (J)V
+    extern jmethodID jTimerNotifyVsync; // com.sun.glass.ui.Timer#notifyVsync (JJ)V
     extern jclass jGtkPixelsCls; // com.sun.class.ui.gtk.GtkPixels
     extern jmethodID jGtkPixelsInit; // com.sun.class.ui.gtk.GtkPixels#<init> (IILjava/nio/ByteBuffer;)V
 
@@ -169,6 +170,8 @@ private:
     extern jmethodID jViewNotifyInputMethodCandidateRelativePosRequest; //com.sun.glass.ui.gtk.GtkView#notifyInputMethodCandidateRelativePosRequest (I)[D
 
     extern jmethodID jViewNotifyMenu; //com.sun.glass.ui.View#notifyMenu (IIIIZ)V
+    extern jmethodID jViewNotifyCoalescedPoints; //com.sun.glass.ui.View#notifyCoalescedPoints ([I)V
+    extern jfieldID  jViewCoalescedPointsEnabled; //com.sun.glass.ui.View.coalescedPointsEnabled
     extern jfieldID  jViewPtr; //com.sun.glass.ui.View.ptr
 
     extern jmethodID jWindowNotifyResize; // com.sun.glass.ui.Window#notifyResize (III)V
@@ -339,6 +342,13 @@ glass_gtk_selection_data_get_data_with_length(
         GtkSelectionData * selectionData,
         gint * length);
 
+gboolean
+glass_gtk_selection_data_set_bytebuffer(
+        JNIEnv *env,
+        GtkSelectionData * selectionData,
+        GdkAtom target,
+        jobject buffer);
+
 void
 glass_gtk_window_configure_from_visual(GtkWidget *widget, GdkVisual *visual);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -655,6 +655,9 @@ static Bool isXkbAvailable(Display *display) {
   * in Gdk.
   */
  static gint get_current_keyboard_group() {
+     if (!GDK_IS_X11_DISPLAY(gdk_display_get_default())) {
+         return -1;
+     }
      Display* display = gdk_x11_display_get_xdisplay(gdk_display_get_default());
      if (isXkbAvailable(display)) {
          XkbStateRec xkbState;
@@ -672,7 +675,23 @@ static Bool isXkbAvailable(Display *display) {
 JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1isKeyLocked
   (JNIEnv * env, jobject obj, jint keyCode)
 {
-    Display* display = gdk_x11_display_get_xdisplay(gdk_display_get_default());
+    GdkDisplay* gdk_display = gdk_display_get_default();
+    if (!GDK_IS_X11_DISPLAY(gdk_display)) {
+        GdkKeymap* keymap = gdk_keymap_get_for_display(gdk_display);
+        switch (keyCode) {
+            case com_sun_glass_events_KeyEvent_VK_CAPS_LOCK:
+                return gdk_keymap_get_caps_lock_state(keymap)
+                        ? com_sun_glass_events_KeyEvent_KEY_LOCK_ON
+                        : com_sun_glass_events_KeyEvent_KEY_LOCK_OFF;
+            case com_sun_glass_events_KeyEvent_VK_NUM_LOCK:
+                return gdk_keymap_get_num_lock_state(keymap)
+                        ? com_sun_glass_events_KeyEvent_KEY_LOCK_ON
+                        : com_sun_glass_events_KeyEvent_KEY_LOCK_OFF;
+        }
+        return com_sun_glass_events_KeyEvent_KEY_LOCK_UNKNOWN;
+    }
+
+    Display* display = gdk_x11_display_get_xdisplay(gdk_display);
     if (!isXkbAvailable(display)) {
         return com_sun_glass_events_KeyEvent_KEY_LOCK_UNKNOWN;
     }
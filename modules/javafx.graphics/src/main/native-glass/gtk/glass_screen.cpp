@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -66,8 +66,12 @@ static guint get_current_desktop(GdkScreen *screen) {
 }
 
 static GdkRectangle get_screen_workarea(GdkScreen *screen) {
-    Display* display = gdk_x11_display_get_xdisplay(gdk_display_get_default());
     GdkRectangle ret = { 0, 0, gdk_screen_get_width(screen), gdk_screen_get_height(screen)};
+    if (!GDK_IS_X11_SCREEN(screen)) {
+        // Wayland does not tell clients about panels
+        return ret;
+    }
+    Display* display = gdk_x11_display_get_xdisplay(gdk_display_get_default());
 
     Atom workareaAtom = XInternAtom(display, "_NET_WORKAREA", True);
 
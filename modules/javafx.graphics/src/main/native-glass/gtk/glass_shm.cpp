@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#include "glass_shm.h"
+
+#include <gdk/gdkx.h>
+#include <X11/Xutil.h>
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <string.h>
+
+gboolean disableXShm = FALSE;
+
+ShmPresenter* ShmPresenter::create(GdkWindow* window) {
+    if (disableXShm || !window || !GDK_IS_X11_WINDOW(window)) {
+        return NULL;
+    }
+#if G_BYTE_ORDER != G_LITTLE_ENDIAN
+    // The uploaded pixels are only in the byte order of a 32 bit TrueColor
+    // image on little endian machines
+    return NULL;
+#else
+    Display* display = GDK_WINDOW_XDISPLAY(window);
+    if (!XShmQueryExtension(display)) {
+        return NULL;
+    }
+
+    GdkVisual* gdk_visual = gdk_window_get_visual(window);
+    int depth = gdk_visual_get_depth(gdk_visual);
+    Visual* visual = gdk_x11_visual_get_xvisual(gdk_visual);
+    if ((depth != 24 && depth != 32) ||
+        visual->red_mask != 0xff0000 ||
+        visual->green_mask != 0xff00 ||
+        visual->blue_mask != 0xff)
+    {
+        return NULL;
+    }
+    return new ShmPresenter(display, GDK_WINDOW_XID(window), visual, depth);
+#endif
+}
+
+ShmPresenter::ShmPresenter(Display* display, Window xwindow, Visual* visual, int depth) :
+    display(display), xwindow(xwindow), visual(visual), depth(depth),
+    current(0), width(0), height(0)
+{
+    gc = XCreateGC(display, xwindow, 0, NULL);
+    memset(segments, 0, sizeof(segments));
+}
+
+ShmPresenter::~ShmPresenter() {
+    detach(&segments[0]);
+    detach(&segments[1]);
+    XFreeGC(display, gc);
+}
+
+bool ShmPresenter::is_for(GdkWindow* window) {
+    return window && GDK_WINDOW_XID(window) == xwindow;
+}
+
+bool ShmPresenter::attach(Segment* segment, jint w, jint h) {
+    XImage* image = XShmCreateImage(display, visual, depth, ZPixmap, NULL,
+            &segment->info, w, h);
+    if (!image) {
+        return false;
+    }
+    segment->image = image;
+    if (image->bits_per_pixel != 32 || image->bytes_per_line != w * 4 ||
+            image->byte_order != LSBFirst) {
+        return false;
+    }
+
+    segment->info.shmid = shmget(IPC_PRIVATE, (size_t) image->bytes_per_line * h,
+            IPC_CREAT | 0600);
+    if (segment->info.shmid < 0) {
+        return false;
+    }
+    segment->info.shmaddr = (char*) shmat(segment->info.shmid, NULL, 0);
+    if (segment->info.shmaddr == (char*) -1) {
+        segment->info.shmaddr = NULL;
+        shmctl(segment->info.shmid, IPC_RMID, NULL);
+        return false;
+    }
+    image->data = segment->info.shmaddr;
+    segment->info.readOnly = False;
+
+    // Attaching fails on a display that does not share our memory,
+    // such as a remote one
+    gdk_error_trap_push();
+    Bool attached = XShmAttach(display, &segment->info);
+    XSync(display, False);
+    bool failed = gdk_error_trap_pop() != 0 || !attached;
+
+    // The segment goes away once both we and the server detach from it
+    shmctl(segment->info.shmid, IPC_RMID, NULL);
+    if (failed) {
+        shmdt(segment->info.shmaddr);
+        segment->info.shmaddr = NULL;
+        return false;
+    }
+    segment->serial = 0;
+    return true;
+}
+
+void ShmPresenter::detach(Segment* segment) {
+    if (segment->info.shmaddr) {
+        XShmDetach(display, &segment->info);
+        shmdt(segment->info.shmaddr);
+    }
+    if (segment->image) {
+        // The data is the segment, not memory for XDestroyImage to free
+        segment->image->data = NULL;
+        XDestroyImage(segment->image);
+    }
+    memset(segment, 0, sizeof(Segment));
+}
+
+bool ShmPresenter::resize(jint w, jint h) {
+    detach(&segments[0]);
+    detach(&segments[1]);
+    width = height = 0;
+    if (!attach(&segments[0], w, h) || !attach(&segments[1], w, h)) {
+        detach(&segments[0]);
+        detach(&segments[1]);
+        return false;
+    }
+    width = w;
+    height = h;
+    current = 0;
+    return true;
+}
+
+bool ShmPresenter::present(void* data, jint w, jint h, const jint* damage, jint ndamage) {
+    if ((w != width || h != height) && !resize(w, h)) {
+        return false;
+    }
+
+    Segment* segment = &segments[current];
+    current ^= 1;
+
+    // Wait for the server to finish reading the segment from two frames ago,
+    // which has usually happened long before
+    if (segment->serial && LastKnownRequestProcessed(display) < segment->serial) {
+        XSync(display, False);
+    }
+
+    jint full[4] = {0, 0, w, h};
+    if (ndamage < 0) {
+        damage = full;
+        ndamage = 1;
+    }
+
+    // Only the damage has to be brought up to date, since nothing else
+    // of the segment is put on the window
+    char* src = (char*) data;
+    char* dst = segment->info.shmaddr;
+    jint stride = w * 4;
+    for (jint i = 0; i < ndamage; i++) {
+        const jint* r = damage + 4 * i;
+        jint x0 = MAX(r[0], 0);
+        jint y0 = MAX(r[1], 0);
+        jint x1 = MIN(r[0] + r[2], w);
+        jint y1 = MIN(r[1] + r[3], h);
+        if (x1 <= x0 || y1 <= y0) {
+            continue;
+        }
+        for (jint y = y0; y < y1; y++) {
+            memcpy(dst + y * stride + x0 * 4, src + y * stride + x0 * 4, (x1 - x0) * 4);
+        }
+        segment->serial = NextRequest(display);
+        XShmPutImage(display, xwindow, gc, segment->image,
+                x0, y0, x0, y0, x1 - x0, y1 - y0, False);
+    }
+    XFlush(display);
+    return true;
+}
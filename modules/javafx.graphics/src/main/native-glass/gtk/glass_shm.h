@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#ifndef GLASS_SHM_H
+#define        GLASS_SHM_H
+
+#include <jni.h>
+
+#include <gdk/gdk.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/XShm.h>
+
+/*
+ * Presents the frames uploaded to a window through MIT-SHM shared memory,
+ * so that the pixels reach the X server without going through the display
+ * connection. Two segments are filled in turn, so that a frame can be
+ * copied in while the server may still be reading the previous one.
+ */
+class ShmPresenter {
+public:
+    // Returns NULL if the window cannot be presented to through MIT-SHM
+    static ShmPresenter* create(GdkWindow*);
+    ~ShmPresenter();
+
+    bool is_for(GdkWindow*);
+
+    // Presents the first ndamage x, y, width, height rectangles of damage
+    // from data, or all of it if ndamage < 0. Returns false if the frame
+    // could not be presented and the presenter should not be used again.
+    bool present(void* data, jint width, jint height, const jint* damage, jint ndamage);
+
+private:
+    struct Segment {
+        XShmSegmentInfo info;
+        XImage* image;
+        // The serial of the last request reading the segment
+        unsigned long serial;
+    };
+
+    Display* display;
+    Window xwindow;
+    Visual* visual;
+    int depth;
+    GC gc;
+    Segment segments[2];
+    int current;
+    jint width;
+    jint height;
+
+    ShmPresenter(Display*, Window, Visual*, int);
+    bool resize(jint, jint);
+    bool attach(Segment*, jint, jint);
+    void detach(Segment*);
+};
+
+// Set from the glass.disableXShm property
+extern gboolean disableXShm;
+
+#endif        /* GLASS_SHM_H */
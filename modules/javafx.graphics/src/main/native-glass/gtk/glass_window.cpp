@@ -27,6 +27,7 @@
 #include "glass_key.h"
 #include "glass_screen.h"
 #include "glass_dnd.h"
+#include "glass_shm.h"
 
 #include <com_sun_glass_events_WindowEvent.h>
 #include <com_sun_glass_events_ViewEvent.h>
@@ -57,6 +58,12 @@
 
 WindowContext * WindowContextBase::sm_grab_window = NULL;
 WindowContext * WindowContextBase::sm_mouse_drag_window = NULL;
+WindowContextBase * WindowContextBase::sm_motion_window = NULL;
+
+// Upper bound of the positions remembered for a single coalesced motion
+#define MAX_MOTION_HISTORY 256
+
+gboolean disableMotionCoalescing = FALSE;
 
 GdkWindow* WindowContextBase::get_gdk_window(){
     return gdk_window;
@@ -193,6 +200,15 @@ void destroy_and_delete_ctx(WindowContext* ctx) {
 }
 
 void WindowContextBase::process_destroy() {
+    if (WindowContextBase::sm_motion_window == this) {
+        WindowContextBase::sm_motion_window = NULL;
+    }
+    if (motion_tick_id) {
+        gtk_widget_remove_tick_callback(gtk_widget, motion_tick_id);
+        motion_tick_id = 0;
+    }
+    motion_history.clear();
+
     if (WindowContextBase::sm_mouse_drag_window == this) {
         ungrab_mouse_drag_focus();
     }
@@ -245,6 +261,13 @@ void WindowContextBase::process_expose(GdkEventExpose* event) {
     }
 }
 
+static gboolean motion_tick(GtkWidget* widget, GdkFrameClock* clock, gpointer data) {
+    (void)widget;
+    (void)clock;
+
+    return ((WindowContextBase*) data)->process_motion_tick();
+}
+
 static inline jint gtk_button_number_to_mouse_button(guint button) {
     switch (button) {
         case 1:
@@ -376,19 +399,102 @@ void WindowContextBase::process_mouse_motion(GdkEventMotion* event) {
         button = com_sun_glass_events_MouseEvent_BUTTON_FORWARD;
     }
 
+    if (!jview) {
+        return;
+    }
+
+    jint type = isDrag ? com_sun_glass_events_MouseEvent_DRAG : com_sun_glass_events_MouseEvent_MOVE;
+
+    if (WindowContextBase::sm_motion_window != NULL
+            && (WindowContextBase::sm_motion_window != this
+                || pending_motion.type != type
+                || pending_motion.button != button
+                || pending_motion.modifiers != glass_modifier)) {
+        flush_pending_motion();
+        if (!jview) {
+            return;
+        }
+    }
+
+    pending_motion = {type, button,
+            (jint) event->x, (jint) event->y,
+            (jint) event->x_root, (jint) event->y_root,
+            glass_modifier};
+
+    if (motion_history.size() >= MAX_MOTION_HISTORY * 4) {
+        motion_history.erase(motion_history.begin(), motion_history.begin() + 4);
+    }
+    motion_history.push_back(pending_motion.x);
+    motion_history.push_back(pending_motion.y);
+    motion_history.push_back(pending_motion.x_root);
+    motion_history.push_back(pending_motion.y_root);
+    WindowContextBase::sm_motion_window = this;
+
+    // High rate pointing devices report far more motion than can be painted.
+    // The first motion of a frame is reported right away; any further motion
+    // is merged into a single event reported when the frame clock ticks.
+    if (!disableMotionCoalescing && gtk_widget_get_frame_clock(gtk_widget) != NULL) {
+        if (motion_tick_id) {
+            return;
+        }
+        motion_tick_id = gtk_widget_add_tick_callback(gtk_widget, motion_tick, this, NULL);
+    }
+    flush_pending_motion();
+}
+
+void WindowContextBase::flush_pending_motion() {
+    WindowContextBase* ctx = WindowContextBase::sm_motion_window;
+    if (ctx == NULL) {
+        return;
+    }
+    WindowContextBase::sm_motion_window = NULL;
+
+    // Reporting may close the window
+    EventsCounterHelper helper(ctx);
+    ctx->report_motion();
+}
+
+void WindowContextBase::report_motion() {
+    jintArray points = NULL;
+    if (jview && motion_history.size() > 4
+            && mainEnv->GetBooleanField(jview, jViewCoalescedPointsEnabled)) {
+        points = mainEnv->NewIntArray(motion_history.size());
+        if (points) {
+            mainEnv->SetIntArrayRegion(points, 0, motion_history.size(), motion_history.data());
+        }
+    }
+    motion_history.clear();
+    CHECK_JNI_EXCEPTION(mainEnv)
+
+    if (points) {
+        mainEnv->CallVoidMethod(jview, jViewNotifyCoalescedPoints, points);
+        mainEnv->DeleteLocalRef(points);
+        CHECK_JNI_EXCEPTION(mainEnv)
+    }
+
     if (jview) {
         mainEnv->CallVoidMethod(jview, jViewNotifyMouse,
-                isDrag ? com_sun_glass_events_MouseEvent_DRAG : com_sun_glass_events_MouseEvent_MOVE,
-                button,
-                (jint) event->x, (jint) event->y,
-                (jint) event->x_root, (jint) event->y_root,
-                glass_modifier,
+                pending_motion.type,
+                pending_motion.button,
+                pending_motion.x, pending_motion.y,
+                pending_motion.x_root, pending_motion.y_root,
+                pending_motion.modifiers,
                 JNI_FALSE,
                 JNI_FALSE);
         CHECK_JNI_EXCEPTION(mainEnv)
     }
 }
 
+gboolean WindowContextBase::process_motion_tick() {
+    if (WindowContextBase::sm_motion_window != this) {
+        // No motion since the previous frame, stop ticking
+        motion_tick_id = 0;
+        return G_SOURCE_REMOVE;
+    }
+    flush_pending_motion();
+    return G_SOURCE_CONTINUE;
+}
+
 void WindowContextBase::process_mouse_scroll(GdkEventScroll* event) {
     jdouble dx = 0;
     jdouble dy = 0;
@@ -503,10 +609,46 @@ void WindowContextBase::process_key(GdkEventKey* event) {
     }
 }
 
-void WindowContextBase::paint(void* data, jint width, jint height) {
+void WindowContextBase::paint(void* data, jint width, jint height, const jint* damage, jint ndamage) {
+    if (!shm_unsupported && gdk_window) {
+        if (shm_presenter && !shm_presenter->is_for(gdk_window)) {
+            delete shm_presenter;
+            shm_presenter = NULL;
+        }
+        if (!shm_presenter) {
+            shm_presenter = ShmPresenter::create(gdk_window);
+        }
+        if (shm_presenter) {
+            applyShapeMask(data, width, height);
+            if (shm_presenter->present(data, width, height, damage, ndamage)) {
+                return;
+            }
+            delete shm_presenter;
+            shm_presenter = NULL;
+        }
+        // Keep painting through cairo from now on
+        shm_unsupported = true;
+    }
+
+    cairo_rectangle_int_t bounds = {0, 0, width, height};
+    cairo_region_t *region;
+    if (ndamage < 0) {
+        region = cairo_region_create_rectangle(&bounds);
+    } else {
+        // Only the damaged rectangles changed since the previous upload
+        region = cairo_region_create();
+        for (jint i = 0; i < ndamage; i++) {
+            const jint* r = damage + 4 * i;
+            cairo_rectangle_int_t rect = {r[0], r[1], r[2], r[3]};
+            cairo_region_union_rectangle(region, &rect);
+        }
+        cairo_region_intersect_rectangle(region, &bounds);
+        if (cairo_region_is_empty(region)) {
+            cairo_region_destroy(region);
+            return;
+        }
+    }
 #ifdef GLASS_GTK3
-    cairo_rectangle_int_t rect = {0, 0, width, height};
-    cairo_region_t *region = cairo_region_create_rectangle(&rect);
     gdk_window_begin_paint_region(gdk_window, region);
 #endif
     cairo_t* context = gdk_cairo_create(gdk_window);
@@ -519,14 +661,24 @@ void WindowContextBase::paint(void* data, jint width, jint height) {
 
     applyShapeMask(data, width, height);
 
+    if (ndamage >= 0) {
+        int count = cairo_region_num_rectangles(region);
+        for (int i = 0; i < count; i++) {
+            cairo_rectangle_int_t rect;
+            cairo_region_get_rectangle(region, i, &rect);
+            cairo_rectangle(context, rect.x, rect.y, rect.width, rect.height);
+        }
+        cairo_clip(context);
+    }
+
     cairo_set_source_surface(context, cairo_surface, 0, 0);
     cairo_set_operator(context, CAIRO_OPERATOR_SOURCE);
     cairo_paint(context);
 
 #ifdef GLASS_GTK3
     gdk_window_end_paint(gdk_window);
-    cairo_region_destroy(region);
 #endif
+    cairo_region_destroy(region);
 
     cairo_destroy(context);
     cairo_surface_destroy(cairo_surface);
@@ -571,6 +723,10 @@ bool WindowContextBase::is_resizable() {
 }
 
 bool WindowContextBase::set_view(jobject view) {
+    if (WindowContextBase::sm_motion_window == this) {
+        flush_pending_motion();
+    }
+
     if (jview) {
         mainEnv->CallVoidMethod(jview, jViewNotifyMouse,
                 com_sun_glass_events_MouseEvent_EXIT,
@@ -673,6 +829,7 @@ bool WindowContextBase::get_window_edge(int x, int y, GdkWindowEdge* window_edge
 }
 
 WindowContextBase::~WindowContextBase() {
+    delete shm_presenter;
     disableIME();
     gtk_widget_destroy(gtk_widget);
 }
@@ -762,15 +919,17 @@ WindowContextTop::WindowContextTop(jobject _jwindow, WindowContext* _owner, long
         gtk_window_set_type_hint(GTK_WINDOW(gtk_widget), GDK_WINDOW_TYPE_HINT_UTILITY);
     }
 
-    const char* wm_name = gdk_x11_screen_get_window_manager_name(gdk_screen_get_default());
+    GdkScreen* default_screen = gdk_screen_get_default();
+    bool is_x11 = GDK_IS_X11_SCREEN(default_screen);
+    const char* wm_name = is_x11 ? gdk_x11_screen_get_window_manager_name(default_screen) : NULL;
     wmanager = (g_strcmp0("Compiz", wm_name) == 0) ? COMPIZ : UNKNOWN;
 
 //    glong xdisplay = (glong)mainEnv->GetStaticLongField(jApplicationCls, jApplicationDisplay);
 //    gint  xscreenID = (gint)mainEnv->GetStaticIntField(jApplicationCls, jApplicationScreen);
     glong xvisualID = (glong)mainEnv->GetStaticLongField(jApplicationCls, jApplicationVisualID);
 
-    if (xvisualID != 0) {
-        GdkVisual *visual = gdk_x11_screen_lookup_visual(gdk_screen_get_default(), xvisualID);
+    if (xvisualID != 0 && is_x11) {
+        GdkVisual *visual = gdk_x11_screen_lookup_visual(default_screen, xvisualID);
         glass_gtk_window_configure_from_visual(gtk_widget, visual);
     }
 
@@ -800,6 +959,11 @@ void WindowContextTop::detach_from_java() {
 }
 
 void WindowContextTop::request_frame_extents() {
+    // Wayland windows are decorated by GTK, which knows their extents
+    if (!GDK_IS_X11_WINDOW(gdk_window)) {
+        return;
+    }
+
     Display *display = GDK_DISPLAY_XDISPLAY(gdk_window_get_display(gdk_window));
     static Atom rfeAtom = XInternAtom(display, "_NET_REQUEST_FRAME_EXTENTS", False);
 
@@ -1588,6 +1752,10 @@ void WindowContextTop::process_mouse_motion(GdkEventMotion* event) {
     // since from the perspective of FX, resize borders are not a part of client area.
     if (is_mouse_entered && jview) {
         is_mouse_entered = false;
+        flush_pending_motion();
+        if (!jview) {
+            return;
+        }
         mainEnv->CallVoidMethod(jview, jViewNotifyMouse,
             com_sun_glass_events_MouseEvent_EXIT,
             com_sun_glass_events_MouseEvent_BUTTON_NONE,
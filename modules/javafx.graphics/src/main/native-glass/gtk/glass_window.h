@@ -97,6 +97,7 @@ struct WindowGeometry {
 };
 
 class WindowContextTop;
+class ShmPresenter;
 
 class WindowContext : public DeletedMemDebug<0xCC> {
 public:
@@ -107,9 +108,12 @@ public:
     virtual void updateCaretPos() = 0;
     virtual void disableIME() = 0;
     virtual void setOnPreEdit(bool) = 0;
+    virtual bool setPreedit(const gchar *, int, jbyte) = 0;
     virtual void commitIME(gchar *) = 0;
 
-    virtual void paint(void* data, jint width, jint height) = 0;
+    // Paints the first ndamage x, y, width, height rectangles of damage
+    // from data, or all of it if ndamage < 0
+    virtual void paint(void* data, jint width, jint height, const jint* damage, jint ndamage) = 0;
     virtual WindowGeometry get_geometry() = 0;
 
     virtual void show_system_menu(int x, int y) = 0;
@@ -187,6 +191,10 @@ class WindowContextBase: public WindowContext {
         bool send_keypress;
         bool on_key_event;
         bool in_preedit_window;
+        // The last preedit state sent to Java
+        gchar *preedit_text;
+        int preedit_cursor_pos;
+        jbyte preedit_attr;
     } im_ctx;
 
     size_t events_processing_cnt;
@@ -201,6 +209,22 @@ protected:
     GdkCursor* gdk_cursor_override = NULL;
     GdkWMFunction gdk_windowManagerFunctions;
 
+    // Presents uploaded frames through shared memory, see paint()
+    ShmPresenter* shm_presenter = NULL;
+    bool shm_unsupported = false;
+
+    // Motion held back until the next frame, see process_mouse_motion()
+    struct PendingMotion {
+        jint type;
+        jint button;
+        jint x, y;
+        jint x_root, y_root;
+        jint modifiers;
+    } pending_motion = {};
+    // x, y, x_root, y_root of every position coalesced into pending_motion
+    std::vector<jint> motion_history;
+    guint motion_tick_id = 0;
+
     bool is_iconified;
     bool is_maximized;
     bool is_mouse_entered;
@@ -224,16 +248,29 @@ protected:
      * should be reported during this drag.
      */
     static WindowContext* sm_mouse_drag_window;
+
+    /*
+     * sm_motion_window points to a WindowContext holding a motion event
+     * which has been coalesced and not reported yet. There is at most one
+     * such event, so that events of different windows are never reordered.
+     */
+    static WindowContextBase* sm_motion_window;
+
+    void report_motion();
 public:
+    static void flush_pending_motion();
+    gboolean process_motion_tick();
+
     bool isEnabled();
     bool hasIME();
     bool filterIME(GdkEvent *);
     void enableOrResetIME();
     void setOnPreEdit(bool);
+    bool setPreedit(const gchar *, int, jbyte);
     void commitIME(gchar *);
     void updateCaretPos();
     void disableIME();
-    void paint(void*, jint, jint);
+    void paint(void*, jint, jint, const jint*, jint);
     GdkWindow *get_gdk_window();
     jobject get_jwindow();
     jobject get_jview();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,14 +42,8 @@ static void on_preedit_changed(GtkIMContext *im_context, gpointer user_data) {
     int cursor_pos;
 
     gtk_im_context_get_preedit_string(im_context, &preedit_text, &attrList, &cursor_pos);
-    ctx->updateCaretPos();
     ctx->setOnPreEdit(true);
 
-    jstring jstr = mainEnv->NewStringUTF(preedit_text);
-    EXCEPTION_OCCURED(mainEnv);
-
-    jsize slen = mainEnv->GetStringLength(jstr);
-
     PangoAttrIterator *iter = pango_attr_list_get_iterator(attrList);
     PangoAttribute *pangoAttr;
 
@@ -67,6 +61,17 @@ static void on_preedit_changed(GtkIMContext *im_context, gpointer user_data) {
 
     pango_attr_list_unref(attrList);
     pango_attr_iterator_destroy(iter);
+
+    // Input methods emit "preedit-changed" for cursor moves and redraws
+    // too; skip the upcalls when nothing Java sees has changed.
+    if (!ctx->setPreedit(preedit_text, cursor_pos, attr)) {
+        g_free(preedit_text);
+        return;
+    }
+    ctx->updateCaretPos();
+
+    jstring jstr = mainEnv->NewStringUTF(preedit_text);
+    EXCEPTION_OCCURED(mainEnv);
     g_free(preedit_text);
 
     mainEnv->CallVoidMethod(ctx->get_jview(),
@@ -81,6 +86,7 @@ static void on_preedit_changed(GtkIMContext *im_context, gpointer user_data) {
 static void on_preedit_end(GtkIMContext *im_context, gpointer user_data) {
     WindowContext *ctx = (WindowContext *) user_data;
     ctx->setOnPreEdit(false);
+    ctx->setPreedit(NULL, 0, 0);
 }
 
 static void on_commit(GtkIMContext *im_context, gchar* str, gpointer user_data) {
@@ -98,6 +104,7 @@ static gboolean on_retrieve_surrounding(GtkIMContext* self, gpointer user_data)
 }
 
 void WindowContextBase::commitIME(gchar *str) {
+    setPreedit(NULL, 0, 0);
     if (im_ctx.in_preedit_window || !im_ctx.on_key_event) {
         jstring jstr = mainEnv->NewStringUTF(str);
         EXCEPTION_OCCURED(mainEnv);
@@ -149,6 +156,20 @@ void WindowContextBase::setOnPreEdit(bool preedit) {
     im_ctx.on_preedit = preedit;
 }
 
+// Records the preedit state, returns false if it is the one last sent
+bool WindowContextBase::setPreedit(const gchar *text, int cursor_pos, jbyte attr) {
+    if (g_strcmp0(text, im_ctx.preedit_text) == 0
+            && cursor_pos == im_ctx.preedit_cursor_pos
+            && attr == im_ctx.preedit_attr) {
+        return false;
+    }
+    g_free(im_ctx.preedit_text);
+    im_ctx.preedit_text = g_strdup(text);
+    im_ctx.preedit_cursor_pos = cursor_pos;
+    im_ctx.preedit_attr = attr;
+    return true;
+}
+
 void WindowContextBase::updateCaretPos() {
     double *nativePos;
 
@@ -190,6 +211,7 @@ void WindowContextBase::enableOrResetIME() {
     gtk_im_context_reset(im_ctx.ctx);
     gtk_im_context_focus_in(im_ctx.ctx);
 
+    setPreedit(NULL, 0, 0);
     im_ctx.on_preedit = false;
     im_ctx.enabled = true;
     im_ctx.on_key_event = false;
@@ -201,6 +223,7 @@ void WindowContextBase::disableIME() {
         g_object_unref(im_ctx.ctx);
         im_ctx.ctx = NULL;
     }
+    setPreedit(NULL, 0, 0);
 
     im_ctx.enabled = false;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -186,25 +186,31 @@ static int sniffLibs(int wantVersion) {
 /*
  * Class:     com_sun_glass_ui_gtk_GtkApplication
  * Method:    _queryLibrary
- * Signature: Signature: (IZ)I
+ * Signature: Signature: (IZZ)I
  */
 JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1queryLibrary
-  (JNIEnv *env, jclass clazz, jint suggestedVersion, jboolean verbose)
+  (JNIEnv *env, jclass clazz, jint suggestedVersion, jboolean verbose, jboolean wayland)
 {
     (void) env;
     (void) clazz;
 
     gtk_versionDebug = verbose;
 
-    //Set the gtk backend to x11 on all the systems
-    putenv("GDK_BACKEND=x11");
-
-    // Before doing anything with GTK we validate that the DISPLAY can be opened
-    Display *display = XOpenDisplay(NULL);
-    if (display == NULL) {
-        return com_sun_glass_ui_gtk_GtkApplication_QUERY_NO_DISPLAY;
+    if (wayland) {
+        // Requested with jdk.gtk.wayland in a Wayland session, GTK reports
+        // a failure to connect to the compositor when it is initialized
+        putenv("GDK_BACKEND=wayland");
+    } else {
+        //Set the gtk backend to x11 on all the systems
+        putenv("GDK_BACKEND=x11");
+
+        // Before doing anything with GTK we validate that the DISPLAY can be opened
+        Display *display = XOpenDisplay(NULL);
+        if (display == NULL) {
+            return com_sun_glass_ui_gtk_GtkApplication_QUERY_NO_DISPLAY;
+        }
+        XCloseDisplay(display);
     }
-    XCloseDisplay(display);
 
     // now check the the presence of the libraries
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,6 +44,9 @@ const char * (*fp_pw_stream_state_as_string)(enum pw_stream_state state);
 int (*fp_pw_stream_queue_buffer)(struct pw_stream *stream,
                                  struct pw_buffer *buffer);
 int (*fp_pw_stream_set_active)(struct pw_stream *stream, bool active);
+int (*fp_pw_stream_update_params)(struct pw_stream *stream,
+                                  const struct spa_pod **params,
+                                  uint32_t n_params);
 
 int (*fp_pw_stream_connect)(
         struct pw_stream *stream,
@@ -111,6 +114,7 @@ static GString *activeSessionToken;
 
 struct ScreenSpace screenSpace = {0};
 static struct PwLoopData pw = {0};
+static GdkRectangle streamArea = {0};
 gboolean isRemoteDesktop = FALSE;
 
 jclass tokenStorageClass = NULL;
@@ -192,6 +196,7 @@ static void doCleanup() {
 
     g_string_set_size(activeSessionToken, 0);
     sessionClosed = TRUE;
+    streamArea = (GdkRectangle) {0};
 }
 
 /**
@@ -276,77 +281,54 @@ static void onStreamParamChanged(
                      data->rawFormat.size.width,
                      data->rawFormat.size.height);
 
+    if (fp_pw_stream_update_params) {
+        // ask for the damaged regions, so that continuous captures
+        // can tell which parts of a frame have changed
+        char buffer[256];
+        struct spa_pod_builder builder =
+                SPA_POD_BUILDER_INIT(buffer, sizeof(buffer));
+        const struct spa_pod *metaParam = spa_pod_builder_add_object(
+                &builder,
+                SPA_TYPE_OBJECT_ParamMeta,
+                SPA_PARAM_Meta,
+                SPA_PARAM_META_type,
+                SPA_POD_Id(SPA_META_VideoDamage),
+                SPA_PARAM_META_size,
+                SPA_POD_CHOICE_RANGE_Int(
+                        (int) sizeof(struct spa_meta_region) * MAX_STREAM_DAMAGE,
+                        (int) sizeof(struct spa_meta_region),
+                        (int) sizeof(struct spa_meta_region) * MAX_STREAM_DAMAGE
+                )
+        );
+        fp_pw_stream_update_params(data->stream, &metaParam, 1);
+    }
+
     data->hasFormat = TRUE;
     fp_pw_thread_loop_signal(pw.loop, TRUE);
 }
 
-static void onStreamProcess(void *userdata) {
-    struct PwStreamData *data = userdata;
-
+/**
+ * Creates the pixbuf of the capture area from a frame of the stream.
+ * The returned pixbuf does not reference the frame memory if copy is TRUE.
+ */
+static GdkPixbuf *createCapturePixbuf(struct PwStreamData *data,
+                                      struct spa_data *spaData,
+                                      gboolean copy) {
     struct ScreenProps *screen = data->screenProps;
 
-    DEBUG_SCREEN_PREFIX(screen,
-                        "hasFormat %i "
-                        "captureDataReady %i shouldCapture %i\n",
-                        data->hasFormat,
-                        screen->captureDataReady,
-                        screen->shouldCapture
-    );
-    if (
-            !data->hasFormat
-            || !screen->shouldCapture
-            || screen->captureDataReady
-    ) {
-        return;
-    }
-
-    struct pw_buffer *pwBuffer;
-    struct spa_buffer *spaBuffer;
-
-    if (!data->stream
-        || (pwBuffer = fp_pw_stream_dequeue_buffer(data->stream)) == NULL) {
-        DEBUG_SCREEN_PREFIX(screen, "!!! out of buffers\n", NULL);
-        return;
-    }
-
-    spaBuffer = pwBuffer->buffer;
-    if (!spaBuffer
-        || spaBuffer->n_datas < 1
-        || spaBuffer->datas[0].data == NULL) {
-        DEBUG_SCREEN_PREFIX(screen, "!!! no data, n_datas %d\n",
-                            spaBuffer->n_datas);
-        return;
-    }
-
-    struct spa_data spaData = spaBuffer->datas[0];
-
     gint streamWidth = data->rawFormat.size.width;
     gint streamHeight = data->rawFormat.size.height;
 
-    DEBUG_SCREEN(screen);
-    DEBUG_SCREEN_PREFIX(screen,
-                        "got a frame of size %d offset %d stride %d "
-                        "flags %d FD %li captureDataReady %i of stream %dx%d\n",
-                        spaBuffer->datas[0].chunk->size,
-                        spaData.chunk->offset,
-                        spaData.chunk->stride,
-                        spaData.chunk->flags,
-                        spaData.fd,
-                        screen->captureDataReady,
-                        streamWidth,
-                        streamHeight
-    );
-
     GdkRectangle captureArea = screen->captureArea;
     GdkRectangle screenBounds = screen->bounds;
 
-    GdkPixbuf *pixbuf = gdk_pixbuf_new_from_data(spaData.data,
+    GdkPixbuf *pixbuf = gdk_pixbuf_new_from_data(spaData->data,
                                                       GDK_COLORSPACE_RGB,
                                                       TRUE,
                                                       8,
                                                       streamWidth,
                                                       streamHeight,
-                                                      spaData.chunk->stride,
+                                                      spaData->chunk->stride,
                                                       NULL,
                                                       NULL);
 
@@ -365,13 +347,13 @@ static void onStreamProcess(void *userdata) {
 
         g_object_unref(pixbuf);
         pixbuf = scaled;
+        copy = FALSE;
     }
 
-    GdkPixbuf *cropped = NULL;
     if (captureArea.width != screenBounds.width
         || captureArea.height != screenBounds.height) {
 
-        cropped = gdk_pixbuf_new(GDK_COLORSPACE_RGB,
+        GdkPixbuf *cropped = gdk_pixbuf_new(GDK_COLORSPACE_RGB,
                                       TRUE,
                                       8,
                                       captureArea.width,
@@ -389,13 +371,169 @@ static void onStreamProcess(void *userdata) {
         }
 
         g_object_unref(pixbuf);
-        pixbuf = NULL;
+        return cropped;
+    }
+
+    if (copy) {
+        GdkPixbuf *copied = gdk_pixbuf_copy(pixbuf);
+        g_object_unref(pixbuf);
+        pixbuf = copied;
+    }
+    return pixbuf;
+}
 
-        data->screenProps->captureDataPixbuf = cropped;
-    } else {
-        data->screenProps->captureDataPixbuf = pixbuf;
+static void addStreamDamage(struct ScreenProps *screen,
+                            struct spa_buffer *spaBuffer) {
+    if (screen->streamDamageCount < 0) {
+        return;
     }
 
+    struct spa_meta *meta =
+            spa_buffer_find_meta(spaBuffer, SPA_META_VideoDamage);
+    if (!meta) {
+        screen->streamDamageCount = -1;
+        return;
+    }
+
+    struct spa_meta_region *region;
+    spa_meta_for_each(region, meta) {
+        if (!spa_meta_region_is_valid(region)) {
+            break;
+        }
+        if (screen->streamDamageCount == MAX_STREAM_DAMAGE) {
+            screen->streamDamageCount = -1;
+            return;
+        }
+        GdkRectangle *damage =
+                &screen->streamDamage[screen->streamDamageCount++];
+        damage->x = region->region.position.x;
+        damage->y = region->region.position.y;
+        damage->width = region->region.size.width;
+        damage->height = region->region.size.height;
+    }
+}
+
+static gboolean hasFrameData(struct spa_buffer *spaBuffer) {
+    return spaBuffer
+           && spaBuffer->n_datas > 0
+           && spaBuffer->datas[0].data != NULL
+           && spaBuffer->datas[0].chunk->size > 0
+           && (spaBuffer->datas[0].chunk->flags
+               & SPA_CHUNK_FLAG_CORRUPTED) == 0;
+}
+
+/**
+ * Continuous capture: keeps the newest frame of the stream mapped until
+ * it is fetched or replaced, instead of converting every frame.
+ */
+static void onStreamFrame(struct PwStreamData *data) {
+    struct ScreenProps *screen = data->screenProps;
+    struct pw_buffer *pwBuffer = NULL;
+    struct pw_buffer *next;
+
+    // only the newest frame is of interest,
+    // the damage of the skipped ones is added to it
+    while ((next = fp_pw_stream_dequeue_buffer(data->stream)) != NULL) {
+        if (pwBuffer) {
+            if (hasFrameData(pwBuffer->buffer)) {
+                addStreamDamage(screen, pwBuffer->buffer);
+            }
+            fp_pw_stream_queue_buffer(data->stream, pwBuffer);
+        }
+        pwBuffer = next;
+    }
+
+    if (!pwBuffer) {
+        return;
+    }
+
+    struct spa_buffer *spaBuffer = pwBuffer->buffer;
+    if (!hasFrameData(spaBuffer)) {
+        // e.g. a cursor only update
+        fp_pw_stream_queue_buffer(data->stream, pwBuffer);
+        return;
+    }
+
+    addStreamDamage(screen, spaBuffer);
+
+    if (screen->streamBuffer) {
+        fp_pw_stream_queue_buffer(data->stream, screen->streamBuffer);
+    }
+    screen->streamBuffer = pwBuffer;
+    screen->streamFrameReady = TRUE;
+
+    if (screen->shouldCapture && !screen->captureDataReady) {
+        screen->captureDataPixbuf =
+                createCapturePixbuf(data, &spaBuffer->datas[0], TRUE);
+        screen->captureDataReady = TRUE;
+    }
+
+    fp_pw_thread_loop_signal(pw.loop, FALSE);
+}
+
+static void onStreamProcess(void *userdata) {
+    struct PwStreamData *data = userdata;
+
+    struct ScreenProps *screen = data->screenProps;
+
+    DEBUG_SCREEN_PREFIX(screen,
+                        "hasFormat %i streaming %i "
+                        "captureDataReady %i shouldCapture %i\n",
+                        data->hasFormat,
+                        screen->streaming,
+                        screen->captureDataReady,
+                        screen->shouldCapture
+    );
+    if (!data->hasFormat) {
+        return;
+    }
+
+    if (screen->streaming) {
+        if (data->stream) {
+            onStreamFrame(data);
+        }
+        return;
+    }
+
+    if (!screen->shouldCapture || screen->captureDataReady) {
+        return;
+    }
+
+    struct pw_buffer *pwBuffer;
+    struct spa_buffer *spaBuffer;
+
+    if (!data->stream
+        || (pwBuffer = fp_pw_stream_dequeue_buffer(data->stream)) == NULL) {
+        DEBUG_SCREEN_PREFIX(screen, "!!! out of buffers\n", NULL);
+        return;
+    }
+
+    spaBuffer = pwBuffer->buffer;
+    if (!spaBuffer
+        || spaBuffer->n_datas < 1
+        || spaBuffer->datas[0].data == NULL) {
+        DEBUG_SCREEN_PREFIX(screen, "!!! no data, n_datas %d\n",
+                            spaBuffer->n_datas);
+        return;
+    }
+
+    struct spa_data spaData = spaBuffer->datas[0];
+
+    DEBUG_SCREEN(screen);
+    DEBUG_SCREEN_PREFIX(screen,
+                        "got a frame of size %d offset %d stride %d "
+                        "flags %d FD %li captureDataReady %i of stream %dx%d\n",
+                        spaBuffer->datas[0].chunk->size,
+                        spaData.chunk->offset,
+                        spaData.chunk->stride,
+                        spaData.chunk->flags,
+                        spaData.fd,
+                        screen->captureDataReady,
+                        data->rawFormat.size.width,
+                        data->rawFormat.size.height
+    );
+
+    screen->captureDataPixbuf = createCapturePixbuf(data, &spaData, FALSE);
     screen->captureDataReady = TRUE;
 
     DEBUG_SCREEN_PREFIX(screen, "data ready\n", NULL);
@@ -404,6 +542,15 @@ static void onStreamProcess(void *userdata) {
     fp_pw_thread_loop_signal(pw.loop, FALSE);
 }
 
+static void onStreamRemoveBuffer(void *userdata, struct pw_buffer *buffer) {
+    struct PwStreamData *data = userdata;
+
+    if (data->screenProps && data->screenProps->streamBuffer == buffer) {
+        data->screenProps->streamBuffer = NULL;
+        data->screenProps->streamFrameReady = FALSE;
+    }
+}
+
 static void onStreamStateChanged(
         void *userdata,
         enum pw_stream_state old,
@@ -428,6 +575,7 @@ static const struct pw_stream_events streamEvents = {
         .param_changed = onStreamParamChanged,
         .process = onStreamProcess,
         .state_changed = onStreamStateChanged,
+        .remove_buffer = onStreamRemoveBuffer,
 };
 
 
@@ -781,6 +929,10 @@ static gboolean loadSymbols() {
     LOAD_SYMBOL(fp_pw_thread_loop_unlock, "pw_thread_loop_unlock");
     LOAD_SYMBOL(fp_pw_properties_new, "pw_properties_new");
 
+    // optional, without it the damage of streamed frames is not known
+    fp_pw_stream_update_params = dlsym(pipewire_libhandle,
+                                       "pw_stream_update_params");
+
     return TRUE;
 
     fail:
@@ -1089,7 +1241,9 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_screencast_ScreencastHelper_get
             screenProps->shouldCapture = FALSE;
 
             fp_pw_thread_loop_lock(pw.loop);
-            fp_pw_stream_set_active(screenProps->data->stream, FALSE);
+            if (!screenProps->streaming) {
+                fp_pw_stream_set_active(screenProps->data->stream, FALSE);
+            }
             fp_pw_thread_loop_unlock(pw.loop);
 
             screenProps->captureDataReady = FALSE;
@@ -1100,6 +1254,310 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_screencast_ScreencastHelper_get
     return 0;
 }
 
+static int makeStream(
+        const gchar *token,
+        GdkRectangle *requestedArea,
+        GdkRectangle *affectedScreenBounds,
+        gint affectedBoundsLength
+) {
+    if (!initPortal(token, affectedScreenBounds, affectedBoundsLength)) {
+        return pw.pwFd;
+    }
+
+    if (!doLoop(*requestedArea)) {
+        return RESULT_ERROR;
+    }
+
+    gboolean hasStreams = FALSE;
+
+    fp_pw_thread_loop_lock(pw.loop);
+    streamArea = *requestedArea;
+    for (int i = 0; i < screenSpace.screenCount; ++i) {
+        struct ScreenProps *screenProps = &screenSpace.screens[i];
+        if (!screenProps->shouldCapture) {
+            continue;
+        }
+
+        // the one-shot capture state is left alone from here on,
+        // so that getRGBPixelsImpl keeps working while streaming
+        if (screenProps->captureDataPixbuf) {
+            g_object_unref(screenProps->captureDataPixbuf);
+            screenProps->captureDataPixbuf = NULL;
+        }
+        screenProps->shouldCapture = FALSE;
+        screenProps->captureDataReady = FALSE;
+
+        screenProps->streamCaptureArea = screenProps->captureArea;
+        screenProps->streamDamageCount = -1;
+        screenProps->streamFrameReady = FALSE;
+        screenProps->streaming = TRUE;
+        hasStreams = TRUE;
+
+        DEBUG_SCREEN_PREFIX(screenProps, "streaming started\n", NULL);
+    }
+    fp_pw_thread_loop_unlock(pw.loop);
+
+    if (hasPipewireFailed) {
+        doCleanup();
+        return RESULT_ERROR;
+    }
+
+    return hasStreams ? RESULT_OK : RESULT_NO_STREAMS;
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_screencast_ScreencastHelper
+ * Method:    startStreamImpl
+ * Signature: (IIII[ILjava/lang/String;)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_screencast_ScreencastHelper_startStreamImpl(
+        JNIEnv *env,
+        jclass cls,
+        jint jx,
+        jint jy,
+        jint jwidth,
+        jint jheight,
+        jintArray affectedScreensBoundsArray,
+        jstring jtoken
+) {
+    jsize boundsLen = 0;
+    gint affectedBoundsLength = 0;
+    if (affectedScreensBoundsArray) {
+        boundsLen = (*env)->GetArrayLength(env, affectedScreensBoundsArray);
+        EXCEPTION_CHECK_DESCRIBE();
+        if (boundsLen % 4 != 0) {
+            DEBUG_SCREENCAST("incorrect array length\n", NULL);
+            return RESULT_ERROR;
+        }
+        affectedBoundsLength = boundsLen / 4;
+    }
+
+    GdkRectangle affectedScreenBounds[affectedBoundsLength];
+    arrayToRectangles(env,
+                     affectedScreensBoundsArray,
+                     boundsLen,
+                     (GdkRectangle *) &affectedScreenBounds);
+
+    GdkRectangle requestedArea = { jx, jy, jwidth, jheight};
+
+    const gchar *token = jtoken
+                         ? (*env)->GetStringUTFChars(env, jtoken, NULL)
+                         : NULL;
+    JNU_CHECK_EXCEPTION_RETURN(env, RESULT_ERROR);
+
+    DEBUG_SCREENCAST(
+            "starting stream at \n\tx: %5i y %5i w %5i h %5i\n\twith token |%s|\n",
+            jx, jy, jwidth, jheight, token
+    );
+
+    int result = makeStream(
+        token, &requestedArea, affectedScreenBounds, affectedBoundsLength);
+
+    releaseToken(env, jtoken, token);
+    return result;
+}
+
+/**
+ * Copies the held frame of a streamed screen into its part of the stream
+ * area and adds the damaged regions, in stream area coordinates.
+ */
+static void copyStreamFrame(struct ScreenProps *screenProps,
+                            guint8 *dst,
+                            GdkRectangle *damage,
+                            int *damageCount) {
+    struct PwStreamData *data = screenProps->data;
+    struct spa_data *spaData = &screenProps->streamBuffer->buffer->datas[0];
+    GdkRectangle bounds = screenProps->bounds;
+    GdkRectangle captureArea = screenProps->streamCaptureArea;
+
+    gint streamWidth = data->rawFormat.size.width;
+    gint streamHeight = data->rawFormat.size.height;
+
+    jsize preY = (streamArea.y > bounds.y) ? 0 : bounds.y - streamArea.y;
+    jsize preX = (streamArea.x > bounds.x) ? 0 : bounds.x - streamArea.x;
+    gint dstStride = streamArea.width * 4;
+
+    gboolean isScaled = bounds.width != streamWidth
+                        || bounds.height != streamHeight;
+
+    if (!isScaled) {
+        guint8 *src = (guint8 *) spaData->data + spaData->chunk->offset;
+        gint srcStride = spaData->chunk->stride;
+
+        for (int y = 0; y < captureArea.height; y++) {
+            memcpy(dst + dstStride * (preY + y) + preX * 4,
+                   src + srcStride * (captureArea.y + y) + captureArea.x * 4,
+                   captureArea.width * 4);
+        }
+    } else {
+        // not the common case, the frame has to be resampled first
+        GdkPixbuf *pixbuf = gdk_pixbuf_new_from_data(spaData->data,
+                                                     GDK_COLORSPACE_RGB,
+                                                     TRUE,
+                                                     8,
+                                                     streamWidth,
+                                                     streamHeight,
+                                                     spaData->chunk->stride,
+                                                     NULL,
+                                                     NULL);
+        GdkPixbuf *scaled = gdk_pixbuf_scale_simple(pixbuf,
+                                                    bounds.width,
+                                                    bounds.height,
+                                                    GDK_INTERP_BILINEAR);
+        g_object_unref(pixbuf);
+        if (!scaled) {
+            ERR("Cannot scale the stream frame.\n");
+            return;
+        }
+
+        guint8 *src = gdk_pixbuf_get_pixels(scaled);
+        gint srcStride = gdk_pixbuf_get_rowstride(scaled);
+
+        for (int y = 0; y < captureArea.height; y++) {
+            memcpy(dst + dstStride * (preY + y) + preX * 4,
+                   src + srcStride * (captureArea.y + y) + captureArea.x * 4,
+                   captureArea.width * 4);
+        }
+        g_object_unref(scaled);
+    }
+
+    if (isScaled || screenProps->streamDamageCount < 0) {
+        if (*damageCount < MAX_STREAM_DAMAGE) {
+            damage[(*damageCount)++] = (GdkRectangle) {
+                    preX, preY, captureArea.width, captureArea.height
+            };
+        } else {
+            *damageCount = -1;
+        }
+        return;
+    }
+
+    for (int i = 0; i < screenProps->streamDamageCount && *damageCount >= 0; i++) {
+        GdkRectangle area;
+        if (gdk_rectangle_intersect(&screenProps->streamDamage[i],
+                                    &captureArea, &area)) {
+            if (*damageCount == MAX_STREAM_DAMAGE) {
+                *damageCount = -1;
+                break;
+            }
+            area.x += preX - captureArea.x;
+            area.y += preY - captureArea.y;
+            damage[(*damageCount)++] = area;
+        }
+    }
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_screencast_ScreencastHelper
+ * Method:    getStreamFrameImpl
+ * Signature: (Ljava/nio/ByteBuffer;[I)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_screencast_ScreencastHelper_getStreamFrameImpl(
+        JNIEnv *env,
+        jclass cls,
+        jobject buffer,
+        jintArray damageArray
+) {
+    if (sessionClosed || !pw.loop || streamArea.width <= 0 || streamArea.height <= 0) {
+        return RESULT_ERROR;
+    }
+
+    if (hasPipewireFailed) {
+        doCleanup();
+        return RESULT_ERROR;
+    }
+
+    guint8 *dst = (*env)->GetDirectBufferAddress(env, buffer);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, buffer);
+    if (!dst || capacity < (jlong) streamArea.width * streamArea.height * 4) {
+        DEBUG_SCREENCAST("!!! stream buffer is too small\n", NULL);
+        return RESULT_ERROR;
+    }
+
+    GdkRectangle damage[MAX_STREAM_DAMAGE];
+    int damageCount = 0;
+    gboolean hasFrame = FALSE;
+
+    fp_pw_thread_loop_lock(pw.loop);
+    for (int i = 0; i < screenSpace.screenCount; ++i) {
+        struct ScreenProps *screenProps = &screenSpace.screens[i];
+        if (!screenProps->streaming
+            || !screenProps->streamFrameReady
+            || !screenProps->streamBuffer) {
+            continue;
+        }
+
+        copyStreamFrame(screenProps, dst, damage, &damageCount);
+
+        screenProps->streamFrameReady = FALSE;
+        screenProps->streamDamageCount = 0;
+        hasFrame = TRUE;
+    }
+    fp_pw_thread_loop_unlock(pw.loop);
+
+    if (!hasFrame) {
+        return RESULT_NO_FRAME;
+    }
+
+    jsize damageLength = damageArray
+                         ? (*env)->GetArrayLength(env, damageArray)
+                         : 0;
+    if (damageCount < 0 || damageCount * 4 > damageLength) {
+        // too many regions, report the whole area instead
+        damage[0] = (GdkRectangle) {
+                0, 0, streamArea.width, streamArea.height
+        };
+        damageCount = damageLength >= 4 ? 1 : 0;
+    }
+
+    for (int i = 0; i < damageCount; i++) {
+        jint rect[4] = {
+                damage[i].x, damage[i].y, damage[i].width, damage[i].height
+        };
+        (*env)->SetIntArrayRegion(env, damageArray, i * 4, 4, rect);
+    }
+    JNU_CHECK_EXCEPTION_RETURN(env, RESULT_ERROR);
+
+    return damageCount;
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_screencast_ScreencastHelper
+ * Method:    stopStreamImpl
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_screencast_ScreencastHelper_stopStreamImpl(
+        JNIEnv *env,
+        jclass cls
+) {
+    DEBUG_SCREENCAST("stopping stream\n", NULL);
+
+    if (!pw.loop) {
+        return;
+    }
+
+    fp_pw_thread_loop_lock(pw.loop);
+    for (int i = 0; i < screenSpace.screenCount; ++i) {
+        struct ScreenProps *screenProps = &screenSpace.screens[i];
+        if (!screenProps->streaming) {
+            continue;
+        }
+
+        screenProps->streaming = FALSE;
+        screenProps->streamFrameReady = FALSE;
+        if (screenProps->data && screenProps->data->stream) {
+            if (screenProps->streamBuffer) {
+                fp_pw_stream_queue_buffer(screenProps->data->stream,
+                                          screenProps->streamBuffer);
+            }
+            fp_pw_stream_set_active(screenProps->data->stream, FALSE);
+        }
+        screenProps->streamBuffer = NULL;
+    }
+    streamArea = (GdkRectangle) {0};
+    fp_pw_thread_loop_unlock(pw.loop);
+}
+
 /*
  * Class:     com_sun_glass_ui_gtk_screencast_ScreencastHelper
  * Method:    remoteDesktopMouseMove
@@ -1195,13 +1653,17 @@ static int getLettersScancode(gint gdk_keyval) {
     }
 
     // Gdk keyval and Xlib keysym shares the same value for variables
-    // This find_gdk_keycode_for_keyval > XKeycodeToKeysym trick
+    // This find_gdk_keycode_for_keyval > keysym of level 0 trick
     // allows us to map the actual keyboard layout to QWERTY
     // and get its scancode later on.
     // (e.g. QWERTZ Z-Y swap)
-    KeySym ks = XKeycodeToKeysym(gdk_x11_get_default_xdisplay(), keycode, 0);
-
-    if (ks == NoSymbol) {
+    // gdk_keymap_translate_keyboard_state does the same on the Wayland
+    // backend, where there is no X display.
+    guint ks = 0;
+    if (!gdk_keymap_translate_keyboard_state(
+            gdk_keymap_get_for_display(gdk_display_get_default()),
+            keycode, (GdkModifierType) 0, 0, &ks, NULL, NULL, NULL)
+        || ks == GDK_KEY_VoidSymbol) {
         return -1;
     }
 
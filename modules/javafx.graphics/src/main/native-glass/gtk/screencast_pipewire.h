@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,8 @@
 #include <pipewire/stream.h>
 #include <pipewire/keys.h>
 
+#include <spa/buffer/meta.h>
+#include <spa/param/buffers.h>
 #include <spa/param/video/format-utils.h>
 #include <spa/debug/types.h>
 
@@ -44,6 +46,8 @@ void storeRestoreToken(const gchar* oldToken, const gchar* newToken);
 
 void print_gvariant_content(gchar *caption, GVariant *response);
 
+#define MAX_STREAM_DAMAGE 16
+
 struct ScreenProps {
     guint32 id;
     GdkRectangle bounds;
@@ -54,6 +58,14 @@ struct ScreenProps {
     GdkPixbuf *captureDataPixbuf;
     volatile gboolean shouldCapture;
     volatile gboolean captureDataReady;
+
+    // continuous capture, guarded by the pipewire loop lock
+    gboolean streaming;
+    GdkRectangle streamCaptureArea;
+    struct pw_buffer *streamBuffer; // newest frame, held until replaced
+    gboolean streamFrameReady;
+    GdkRectangle streamDamage[MAX_STREAM_DAMAGE];
+    int streamDamageCount; // -1 if the whole screen is damaged
 };
 
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,7 @@ typedef enum {
     RESULT_DENIED = -11,
     RESULT_OUT_OF_BOUNDS = -12,
     RESULT_NO_STREAMS = -13,
+    RESULT_NO_FRAME = -14,
 } ScreenCastResult;
 
 typedef enum {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,18 +44,20 @@
     [self setNeedsDisplayOnBoundsChange:YES];
     [self setAnchorPoint:CGPointMake(0.0f, 0.0f)];
 
-    self.device = MTLCreateSystemDefaultDevice();
-
-    self.pixelFormat = MTLPixelFormatBGRA8Unorm;
-    self.framebufferOnly = NO;
-    self.displaySyncEnabled = isVsyncEnabled;
-    self.opaque = NO; //to support shaped window
-
+    // Prism may render on another GPU than the default one, so the layer
+    // uses the device of its command queue
     if (!isSwPipe) {
         self->_blitCommandQueue = (id<MTLCommandQueue>)(jlong_to_ptr(mtlCommandQueuePtr));
+        self.device = self->_blitCommandQueue.device;
     } else {
+        self.device = MTLCreateSystemDefaultDevice();
         self->_blitCommandQueue = [self.device newCommandQueue];
     }
+
+    self.pixelFormat = MTLPixelFormatBGRA8Unorm;
+    self.framebufferOnly = NO;
+    self.displaySyncEnabled = isVsyncEnabled;
+    self.opaque = NO; //to support shaped window
     self->_painterOffscreen = (GlassOffscreen*)[[GlassMTLOffscreen alloc] initWithContext:self.device
                                                                              commandQueue:self->_blitCommandQueue
                                                                               andIsSwPipe:isSwPipe];
@@ -136,7 +138,20 @@ volatile static int nextDrawableCount = 0;
                                    toTexture:dstTexture];
 
                 [blitEncoder endEncoding];
-                [commandBuf presentDrawable:mtlDrawable];
+
+                // The pulse is driven by the display link, so keep every frame
+                // on screen for at least one refresh of the current display.
+                // Frames that were queued up behind a stall are then spread
+                // over consecutive refreshes instead of replacing each other.
+                double refreshPeriod = 0.0;
+                if (self.displaySyncEnabled && GlassDisplayLink != NULL) {
+                    refreshPeriod = CVDisplayLinkGetActualOutputVideoRefreshPeriod(GlassDisplayLink);
+                }
+                if (refreshPeriod > 0.0) {
+                    [commandBuf presentDrawable:mtlDrawable afterMinimumDuration:refreshPeriod];
+                } else {
+                    [commandBuf presentDrawable:mtlDrawable];
+                }
                 [commandBuf addCompletedHandler:^(id <MTLCommandBuffer> commandBuf) {
                     nextDrawableCount--;
                 }];
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
     unsigned int _height;
 
     volatile id<MTLTexture> _texture;
+    id<MTLDevice> _device;
     BOOL   _isSwPipe;
 
     NSLock* lock;
@@ -39,6 +40,7 @@
 - (void)blitFromFBO:(GlassMTLFrameBufferObject*)other_fbo;
 - (id<MTLTexture>)texture;
 - (void)setIsSwPipe:(BOOL)isSwPipe;
+- (void)setDevice:(id<MTLDevice>)device;
 - (unsigned int)width;
 - (unsigned int)height;
 - (void)bindForWidth:(unsigned int)width
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,8 +57,6 @@
 
     if (self->_texture == nil) {
         // Create a texture
-        id<MTLDevice> device = MTLCreateSystemDefaultDevice();
-
         MTLTextureDescriptor *texDescriptor =
                 [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
                                                                    width:width
@@ -68,7 +66,7 @@
         texDescriptor.usage = MTLTextureUsageRenderTarget;
 
         [lock lock];
-        self->_texture = [device newTextureWithDescriptor:texDescriptor];
+        self->_texture = [self->_device newTextureWithDescriptor:texDescriptor];
         [lock unlock];
     }
 
@@ -154,4 +152,9 @@
     self->_isSwPipe = isSwPipe;
 }
 
+- (void)setDevice:(id<MTLDevice>)device
+{
+    self->_device = device;
+}
+
 @end
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -50,6 +50,7 @@ static NSArray *allModes = nil;
         //     self->_fbo = [[GlassPBuffer alloc] init];
         // }
         [(GlassMTLFrameBufferObject*)self->_fbo setIsSwPipe:(BOOL)isSwPipe];
+        [(GlassMTLFrameBufferObject*)self->_fbo setDevice:device];
         if (allModes == nil) {
             allModes = [[NSArray arrayWithObjects:NSDefaultRunLoopMode,
                                               NSEventTrackingRunLoopMode,
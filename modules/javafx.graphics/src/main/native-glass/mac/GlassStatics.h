@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,6 +46,7 @@ extern jclass jMapClass;
 extern jclass jBooleanClass;
 
 extern jmethodID jRunnableRun;
+extern jmethodID jTimerNotifyVsync;
 
 extern jmethodID jWindowNotifyMove;
 extern jmethodID jWindowNotifyResize;
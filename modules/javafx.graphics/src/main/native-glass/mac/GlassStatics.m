@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,7 @@ jclass jMapClass = NULL;
 jclass jBooleanClass = NULL;
 
 jmethodID jRunnableRun = NULL;
+jmethodID jTimerNotifyVsync = NULL;
 
 jmethodID jWindowNotifyMove = NULL;
 jmethodID jWindowNotifyResize = NULL;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@
     int64_t     _period;
     JNIEnv*     _env;
     jobject     _runnable;
+    jobject     _timer;
 }
 
 @end
@@ -48,3 +49,5 @@ CVReturn CVOutputCallback(CVDisplayLinkRef displayLink,
                           const CVTimeStamp *inNow, const CVTimeStamp *inOutputTime,
                           CVOptionFlags flagsIn, CVOptionFlags *flagsOut,
                           void *displayLinkContext);
+
+void GlassDisplayLinkSetScreen(NSScreen *screen);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,7 @@
 #import "GlassTimer.h"
 
 #include <sys/time.h>
+#include <mach/mach_time.h>
 
 //#define VERBOSE
 #ifndef VERBOSE
@@ -111,6 +112,20 @@ static void *_GlassTimerTask(void *data)
 
 JavaVMAttachArgs attachArgs = {JNI_VERSION_1_2, "PulseTimer-CVDisplayLink thread", NULL};
 
+static mach_timebase_info_data_t timebaseInfo;
+
+// Converts a CVTimeStamp host time to the System.nanoTime() time base,
+// which is mach_absolute_time() in nanoseconds on macOS
+static jlong hostTimeToNanos(const CVTimeStamp *timeStamp)
+{
+    if (timeStamp == NULL || (timeStamp->flags & kCVTimeStampHostTimeValid) == 0
+            || timebaseInfo.denom == 0)
+    {
+        return 0L;
+    }
+    return (jlong)(timeStamp->hostTime * timebaseInfo.numer / timebaseInfo.denom);
+}
+
 CVReturn CVOutputCallback(CVDisplayLinkRef displayLink,
                           const CVTimeStamp *inNow, const CVTimeStamp *inOutputTime,
                           CVOptionFlags flagsIn, CVOptionFlags *flagsOut,
@@ -131,7 +146,14 @@ CVReturn CVOutputCallback(CVDisplayLinkRef displayLink,
         jint ret = (*MAIN_JVM)->AttachCurrentThreadAsDaemon(MAIN_JVM, (void **)&timer->_env, (void*)&attachArgs);
         if (ret == 0)
         {
-            if (timer->_runnable != NULL)
+            if (timer->_timer != NULL && jTimerNotifyVsync != NULL)
+            {
+                // inOutputTime is the vsync the upcoming frame will be shown at,
+                // inNow the one that has just passed
+                (*timer->_env)->CallVoidMethod(timer->_env, timer->_timer, jTimerNotifyVsync,
+                                               hostTimeToNanos(inOutputTime), hostTimeToNanos(inNow));
+            }
+            else if (timer->_runnable != NULL)
             {
                 (*timer->_env)->CallVoidMethod(timer->_env, timer->_runnable, jRunnableRun);
             }
@@ -159,12 +181,13 @@ CVReturn CVOutputCallback(CVDisplayLinkRef displayLink,
 
 @implementation GlassTimer
 
-- (id)initWithRunnable:(jobject)runnable withEnv:(JNIEnv*)env
+- (id)initWithRunnable:(jobject)runnable withTimer:(jobject)timer withEnv:(JNIEnv*)env
 {
     self = [super init];
     if (self != nil)
     {
         self->_paused = NO;
+        self->_timer = NULL;
         CVReturn err = CVDisplayLinkSetOutputCallback(GlassDisplayLink, &CVOutputCallback, self);
         if (err != kCVReturnSuccess)
         {
@@ -173,6 +196,7 @@ CVReturn CVOutputCallback(CVDisplayLinkRef displayLink,
         else
         {
             self->_runnable = (*env)->NewGlobalRef(env, runnable);
+            self->_timer = (*env)->NewGlobalRef(env, timer);
         }
     }
     return self;
@@ -187,6 +211,7 @@ CVReturn CVOutputCallback(CVDisplayLinkRef displayLink,
         self->_running = NO;
         self->_paused = NO;
         self->_runnable = NULL;
+        self->_timer = NULL;
         self->_period = (1000 * period); // ms --> us
 
         pthread_attr_t attr;
@@ -221,6 +246,35 @@ CVReturn CVOutputCallback(CVDisplayLinkRef displayLink,
 
 @end
 
+/*
+ * Moves the display link to the display the given screen is on, so that the
+ * pulse follows the refresh rate of the display the key window is shown on
+ * (e.g. 120 Hz on ProMotion displays) rather than that of the main display.
+ */
+void GlassDisplayLinkSetScreen(NSScreen *screen)
+{
+    if (GlassDisplayLink == NULL || screen == nil)
+    {
+        return;
+    }
+
+    NSNumber *screenNumber = [[screen deviceDescription] objectForKey:@"NSScreenNumber"];
+    if (screenNumber == nil)
+    {
+        return;
+    }
+
+    CGDirectDisplayID displayID = (CGDirectDisplayID)[screenNumber unsignedIntValue];
+    if (CVDisplayLinkGetCurrentCGDisplay(GlassDisplayLink) != displayID)
+    {
+        CVReturn err = CVDisplayLinkSetCurrentCGDisplay(GlassDisplayLink, displayID);
+        if (err != kCVReturnSuccess)
+        {
+            NSLog(@"CVDisplayLinkSetCurrentCGDisplay error: %d", err);
+        }
+    }
+}
+
 /*
  * Class:     com_sun_glass_ui_mac_MacTimer
  * Method:    _start
@@ -260,7 +314,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_mac_MacTimer__1start__Ljava_lang_R
     GLASS_ASSERT_MAIN_JAVA_THREAD(env);
     GLASS_POOL_ENTER;
     {
-        jTimerPtr = ptr_to_jlong([[GlassTimer alloc] initWithRunnable:jRunnable withEnv:env]);
+        jTimerPtr = ptr_to_jlong([[GlassTimer alloc] initWithRunnable:jRunnable withTimer:jThis withEnv:env]);
     }
     GLASS_POOL_EXIT;
     GLASS_CHECK_EXCEPTION(env);
@@ -441,6 +495,17 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_mac_MacTimer__1initIDs
 
     initJavaIDsList(env);
 
+    if (timebaseInfo.denom == 0)
+    {
+        mach_timebase_info(&timebaseInfo);
+    }
+
+    if (jTimerNotifyVsync == NULL)
+    {
+        jTimerNotifyVsync = (*env)->GetMethodID(env, jClass, "notifyVsync", "(JJ)V");
+        if ((*env)->ExceptionCheck(env)) return;
+    }
+
     if (GlassDisplayLink == NULL)
     {
         CVReturn err = CVDisplayLinkCreateWithActiveCGDisplays(&GlassDisplayLink);
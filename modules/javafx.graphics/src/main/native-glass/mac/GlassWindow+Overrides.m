@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,7 @@
 #import "GlassViewDelegate.h"
 #import "GlassApplication.h"
 #import "GlassScreen.h"
+#import "GlassTimer.h"
 
 #import <AppKit/NSGraphics.h> // NSBeep();
 
@@ -63,6 +64,11 @@
 {
     //NSLog(@"windowDidChangeScreen: %p  screen: %p", self, [self->nsWindow screen]);
 
+    if ([self->nsWindow isKeyWindow])
+    {
+        GlassDisplayLinkSetScreen([self->nsWindow screen]);
+    }
+
     // Fix up window stacking order
     [self reorderChildWindows];
 }
@@ -91,6 +97,8 @@
     }
     [[NSApp mainMenu] update];
 
+    GlassDisplayLinkSetScreen([self->nsWindow screen]);
+
     // Fix up window stacking order
     [self reorderChildWindows];
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,7 @@
  */
 
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
 #include "com_sun_glass_ui_monocle_EGL.h"
 #include "Monocle.h"
@@ -92,6 +93,16 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL_eglGetDisplay
     return asJLong(dpy);
 }
 
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL_eglGetPlatformDisplay
+    (JNIEnv *UNUSED(env), jclass UNUSED(clazz), jint platform, jlong display) {
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay == NULL) {
+        return asJLong(EGL_NO_DISPLAY);
+    }
+    return asJLong(getPlatformDisplay((EGLenum) platform, asPtr(display), NULL));
+}
+
 JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_EGL_eglInitialize
     (JNIEnv *env, jclass UNUSED(clazz), jlong eglDisplay, jintArray majorArray,
      jintArray minorArray){
@@ -169,6 +180,24 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL__1eglCreateWindowSurfa
     return asJLong(eglSurface);
 }
 
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL_eglCreatePbufferSurface
+    (JNIEnv *env, jclass UNUSED(clazz), jlong eglDisplay, jlong config,
+     jintArray attribs) {
+
+    EGLSurface eglSurface;
+    EGLint *attrArray = NULL;
+
+    if (attribs != NULL)
+        attrArray = (*env)->GetIntArrayElements(env, attribs, JNI_FALSE);
+
+    eglSurface = eglCreatePbufferSurface(asPtr(eglDisplay), asPtr(config),
+                                         (EGLint *) attrArray);
+    if (attrArray != NULL) {
+        (*env)->ReleaseIntArrayElements(env, attribs, attrArray, JNI_ABORT);
+    }
+    return asJLong(eglSurface);
+}
+
 JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_EGL_eglCreateContext
     (JNIEnv *UNUSED(env), jclass UNUSED(clazz), jlong eglDisplay, jlong config,
       jlong UNUSED(shareContext), jintArray UNUSED(attribs)){
@@ -202,6 +231,18 @@ JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_EGL_eglSwapBuffers
     }
 }
 
+JNIEXPORT jstring JNICALL Java_com_sun_glass_ui_monocle_EGL_eglQueryString
+    (JNIEnv *env, jclass UNUSED(clazz), jlong eglDisplay, jint name) {
+    // The client extensions are queried with EGL_NO_DISPLAY, which fails
+    // on EGL implementations without EGL_EXT_client_extensions
+    const char *value = eglQueryString(asPtr(eglDisplay), name);
+    if (value == NULL) {
+        eglGetError();
+        return NULL;
+    }
+    return (*env)->NewStringUTF(env, value);
+}
+
 JNIEXPORT jint  JNICALL Java_com_sun_glass_ui_monocle_EGL_eglGetError
     (JNIEnv *UNUSED(env), jclass UNUSED(clazz)) {
     return (jint)eglGetError();
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <dlfcn.h>
+#include <stdint.h>
+
+#include "com_sun_glass_ui_monocle_HeadlessAcceleratedScreen.h"
+#include "Monocle.h"
+
+#define GL_RGBA          0x1908
+#define GL_UNSIGNED_BYTE 0x1401
+
+typedef void (*ReadPixelsFunc)(int x, int y, int width, int height,
+                               unsigned int format, unsigned int type,
+                               void *pixels);
+
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_HeadlessAcceleratedScreen_nReadPixels
+    (JNIEnv *env, jclass UNUSED(clazz), jlong glesLibraryHandle,
+     jint width, jint height, jobject pixelBuffer) {
+
+    static ReadPixelsFunc readPixels;
+    if (readPixels == NULL) {
+        readPixels = (ReadPixelsFunc) dlsym(asPtr(glesLibraryHandle), "glReadPixels");
+        if (readPixels == NULL) {
+            return JNI_FALSE;
+        }
+    }
+    uint8_t *pixels = (*env)->GetDirectBufferAddress(env, pixelBuffer);
+    if (pixels == NULL) {
+        return JNI_FALSE;
+    }
+
+    readPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    // GL returns the bottom row first, in RGBA order
+    int stride = width * 4;
+    for (int y = 0; y < (height + 1) / 2; y++) {
+        uint8_t *top = pixels + y * stride;
+        uint8_t *bottom = pixels + (height - 1 - y) * stride;
+        for (int x = 0; x < stride; x += 4) {
+            uint8_t tr = top[x], tg = top[x + 1], tb = top[x + 2], ta = top[x + 3];
+            uint8_t br = bottom[x], bg = bottom[x + 1], bb = bottom[x + 2], ba = bottom[x + 3];
+            top[x] = bb;
+            top[x + 1] = bg;
+            top[x + 2] = br;
+            top[x + 3] = ba;
+            bottom[x] = tb;
+            bottom[x + 1] = tg;
+            bottom[x + 2] = tr;
+            bottom[x + 3] = ta;
+        }
+    }
+    return JNI_TRUE;
+}
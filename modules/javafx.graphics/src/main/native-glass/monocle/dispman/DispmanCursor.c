@@ -1,4 +1,4 @@
-/* Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+/* Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,7 @@ typedef struct {
     DISPMANX_ELEMENT_HANDLE_T element;
     int screenWidth, screenHeight;
     pthread_t thread;
+    jboolean hasThread;
     pthread_mutex_t mutex;
     sem_t semaphore;
     int x, y;
@@ -69,6 +70,7 @@ static void setNativeCursor(jlong nativeCursorHandle);
 static void addDispmanxElement();
 static void removeDispmanxElement();
 static void updateCursor();
+static void *cursorUpdateThread(void *arg);
 
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanCursor__1initDispmanCursor
   (JNIEnv *env, jobject obj, jint width, jint height) {
@@ -80,6 +82,18 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanCursor__1initDispman
     cursor.isVisible = 0;
     addDispmanxElement();
     updateCursor();
+
+    // Moves are submitted from a separate thread, because a synchronous
+    // dispmanx update waits for the next vertical sync and would otherwise
+    // hold up the input thread for each event.
+    pthread_mutex_init(&cursor.mutex, NULL);
+    sem_init(&cursor.semaphore, 0, 0);
+    if (pthread_create(&cursor.thread, NULL, cursorUpdateThread, NULL) == 0) {
+        pthread_detach(cursor.thread);
+        cursor.hasThread = JNI_TRUE;
+    } else {
+        fprintf(stderr, "Cannot create cursor thread\n");
+    }
 }
 
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanCursor__1setVisible
@@ -106,9 +120,17 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanCursor__1setVisible
 
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanCursor__1setLocation
   (JNIEnv *env, jobject obj, jint x, jint y) {
+    if (!cursor.hasThread) {
+        cursor.x = x;
+        cursor.y = y;
+        updateCursor();
+        return;
+    }
+    pthread_mutex_lock(&cursor.mutex);
     cursor.x = x;
     cursor.y = y;
-    updateCursor();
+    pthread_mutex_unlock(&cursor.mutex);
+    sem_post(&cursor.semaphore);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanCursor__1setImage
@@ -156,12 +178,19 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanCursor__1setImage
          free(cursorImage);
          return;
      }
+     DispmanCursorImage *previousImage = (DispmanCursorImage *)asPtr(cursor.currentCursor);
      cursor.currentCursor = asJLong(cursorImage);
      if (cursor.isVisible) {
          update = vc_dispmanx_update_start(0);
          vc_dispmanx_element_change_source(update, cursor.element, cursorImage->resource);
          vc_dispmanx_update_submit_sync(update);
      }
+     // The element no longer shows the previous image once the update
+     // above has been applied
+     if (previousImage != NULL) {
+         vc_dispmanx_resource_delete(previousImage->resource);
+         free(previousImage);
+     }
 }
 
 static void setNativeCursor(jlong nativeCursorHandle) {
@@ -242,16 +271,45 @@ static void removeDispmanxElement() {
     }
 }
 
+/*
+ * Moves the cursor element to the latest location. Locations set while an
+ * update is waiting for the vertical sync are coalesced into the next one.
+ */
+static void *cursorUpdateThread(void *arg) {
+    (void)arg;
+    for (;;) {
+        if (sem_wait(&cursor.semaphore) != 0) {
+            continue;
+        }
+        while (sem_trywait(&cursor.semaphore) == 0) {
+            // skip the locations already superseded
+        }
+        updateCursor();
+    }
+    return NULL;
+}
+
 static void updateCursor() {
     DISPMANX_UPDATE_HANDLE_T update;
+    DISPMANX_ELEMENT_HANDLE_T element;
     VC_RECT_T dst;
+    if (cursor.hasThread) {
+        pthread_mutex_lock(&cursor.mutex);
+    }
+    element = cursor.element;
     dst.x = cursor.x;
     dst.y = cursor.y;
     dst.width = cursor.cursorWidth;
     dst.height = cursor.cursorHeight;
+    if (cursor.hasThread) {
+        pthread_mutex_unlock(&cursor.mutex);
+    }
+    if (element == 0) {
+        return;
+    }
     update = vc_dispmanx_update_start(0);
     vc_dispmanx_element_change_attributes(update,
-                                          cursor.element,
+                                          element,
                                           0x4 ,
                                           0 , 0,
                                           &dst,
@@ -0,0 +1,220 @@
+/* Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "com_sun_glass_ui_monocle_DispmanOverlay.h"
+#include "Monocle.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef USE_DISPMAN
+#include "wrapped_bcm.h"
+
+#define ALIGN_UP(value, alignment) (((value) + (alignment) - 1) & ~((alignment) - 1))
+
+typedef struct {
+    DISPMANX_DISPLAY_HANDLE_T display;
+    DISPMANX_ELEMENT_HANDLE_T element;
+    DISPMANX_RESOURCE_HANDLE_T resources[2];
+    int back;
+    VC_IMAGE_TYPE_T format;
+    jint width;
+    jint height;
+} DispmanOverlay;
+
+/*
+ * Returns the number of bytes of an image of the overlay with the given
+ * stride, or 0 if the stride is too small.
+ */
+static jlong getFrameSize(DispmanOverlay *overlay, jint stride) {
+    jlong height = overlay->height;
+    switch (overlay->format) {
+        case VC_IMAGE_RGB565:
+            return stride < overlay->width * 2 ? 0 : stride * height;
+        case VC_IMAGE_YUV420:
+            return stride < overlay->width ? 0
+                    : stride * ALIGN_UP(height, 16)
+                    + 2 * (stride / 2) * ALIGN_UP((height + 1) / 2, 16);
+        default:
+            return stride < overlay->width * 4 ? 0 : stride * height;
+    }
+}
+
+static void removeOverlay(DispmanOverlay *overlay) {
+    int i;
+    if (overlay->element) {
+        DISPMANX_UPDATE_HANDLE_T update = vc_dispmanx_update_start(0);
+        vc_dispmanx_element_remove(update, overlay->element);
+        vc_dispmanx_update_submit_sync(update);
+    }
+    for (i = 0; i < 2; i++) {
+        if (overlay->resources[i]) {
+            vc_dispmanx_resource_delete(overlay->resources[i]);
+        }
+    }
+    if (overlay->display) {
+        vc_dispmanx_display_close(overlay->display);
+    }
+    free(overlay);
+}
+#endif /* USE_DISPMAN */
+
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_DispmanOverlay__1create
+    (JNIEnv *env, jobject obj, jint displayID, jint layer, jint width, jint height, jint format) {
+#ifdef USE_DISPMAN
+    DispmanOverlay *overlay;
+    DISPMANX_UPDATE_HANDLE_T update;
+    DISPMANX_MODEINFO_T info;
+    VC_DISPMANX_ALPHA_T alpha;
+    VC_RECT_T src = { 0, 0, width << 16, height << 16 };
+    VC_RECT_T dst = { 0, 0, 0, 0 };
+    uint32_t imagePtr;
+    int i;
+
+    if (width <= 0 || height <= 0) {
+        return 0l;
+    }
+    if (format != VC_IMAGE_RGB565 && format != VC_IMAGE_YUV420
+            && format != VC_IMAGE_ARGB8888) {
+        fprintf(stderr, "Dispman: Unsupported overlay format %d\n", format);
+        return 0l;
+    }
+
+    load_bcm_symbols();
+
+    overlay = (DispmanOverlay *)calloc(1, sizeof(DispmanOverlay));
+    if (overlay == NULL) {
+        return 0l;
+    }
+    overlay->format = (VC_IMAGE_TYPE_T)format;
+    overlay->width = width;
+    overlay->height = height;
+
+    overlay->display = vc_dispmanx_display_open(displayID);
+    if (overlay->display == 0) {
+        fprintf(stderr, "Dispman: Cannot open display\n");
+        removeOverlay(overlay);
+        return 0l;
+    }
+    if ((*wr_vc_dispmanx_display_get_info)(overlay->display, &info) == 0) {
+        dst.width = info.width;
+        dst.height = info.height;
+    }
+
+    for (i = 0; i < 2; i++) {
+        overlay->resources[i] = vc_dispmanx_resource_create(overlay->format,
+                width, height, &imagePtr);
+        if (overlay->resources[i] == 0) {
+            fprintf(stderr, "Dispman: Cannot create overlay resource\n");
+            removeOverlay(overlay);
+            return 0l;
+        }
+    }
+
+    alpha.flags = format == VC_IMAGE_ARGB8888
+            ? DISPMANX_FLAGS_ALPHA_FROM_SOURCE
+            : DISPMANX_FLAGS_ALPHA_FIXED_ALL_PIXELS;
+    alpha.opacity = 0xff;
+    alpha.mask = (DISPMANX_RESOURCE_HANDLE_T) 0;
+    update = vc_dispmanx_update_start(0);
+    // The element has no source until the first frame is written
+    overlay->element = vc_dispmanx_element_add(
+                           update,
+                           overlay->display,
+                           layer,
+                           &dst,
+                           0 /*src*/,
+                           &src,
+                           DISPMANX_PROTECTION_NONE,
+                           &alpha,
+                           0 /*clamp*/,
+                           0 /*transform*/);
+    vc_dispmanx_update_submit_sync(update);
+    if (overlay->element == 0) {
+        fprintf(stderr, "Dispman: Cannot add overlay element\n");
+        removeOverlay(overlay);
+        return 0l;
+    }
+    return asJLong(overlay);
+#else
+    return 0l;
+#endif /* USE_DISPMAN */
+}
+
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanOverlay__1setBounds
+    (JNIEnv *env, jobject obj, jlong handle, jint x, jint y, jint width, jint height) {
+#ifdef USE_DISPMAN
+    DispmanOverlay *overlay = (DispmanOverlay *)asPtr(handle);
+    DISPMANX_UPDATE_HANDLE_T update;
+    VC_RECT_T dst = { x, y, width, height };
+
+    update = vc_dispmanx_update_start(0);
+    vc_dispmanx_element_change_attributes(update,
+                                          overlay->element,
+                                          0x4 /*dest rect*/,
+                                          0, 0,
+                                          &dst,
+                                          0,
+                                          0, 0);
+    vc_dispmanx_update_submit_sync(update);
+#endif /* USE_DISPMAN */
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_DispmanOverlay__1setFrame
+    (JNIEnv *env, jobject obj, jlong handle, jobject frame, jint stride) {
+#ifdef USE_DISPMAN
+    DispmanOverlay *overlay = (DispmanOverlay *)asPtr(handle);
+    DISPMANX_RESOURCE_HANDLE_T resource = overlay->resources[overlay->back];
+    DISPMANX_UPDATE_HANDLE_T update;
+    VC_RECT_T rect = { 0, 0, overlay->width, overlay->height };
+    void *pixels = (*env)->GetDirectBufferAddress(env, frame);
+    jlong size = getFrameSize(overlay, stride);
+
+    if (pixels == NULL || size == 0
+            || (*env)->GetDirectBufferCapacity(env, frame) < size) {
+        return JNI_FALSE;
+    }
+    if (vc_dispmanx_resource_write_data(resource, overlay->format,
+                                        stride, pixels, &rect) != 0) {
+        fprintf(stderr, "Dispman: Cannot write overlay frame\n");
+        return JNI_FALSE;
+    }
+    update = vc_dispmanx_update_start(0);
+    vc_dispmanx_element_change_source(update, overlay->element, resource);
+    vc_dispmanx_update_submit_sync(update);
+    // The other resource is no longer on screen and takes the next frame
+    overlay->back ^= 1;
+    return JNI_TRUE;
+#else
+    return JNI_FALSE;
+#endif /* USE_DISPMAN */
+}
+
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanOverlay__1dispose
+    (JNIEnv *env, jobject obj, jlong handle) {
+#ifdef USE_DISPMAN
+    removeOverlay((DispmanOverlay *)asPtr(handle));
+#endif /* USE_DISPMAN */
+}
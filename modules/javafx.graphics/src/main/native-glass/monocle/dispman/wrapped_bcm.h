@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,6 +38,8 @@
 #if !defined(_VC_DISPMANX_H_)
 /* for Debian 6.0 libraries */
 typedef enum {
+   VC_IMAGE_RGB565 = 1,     /* 16bpp with 5 bits red, 6 bits green and 5 bits blue */
+   VC_IMAGE_YUV420 = 7,     /* planar Y, U and V with U and V at half resolution */
    VC_IMAGE_ARGB8888 = 43,  /* 32bpp with 8bit alpha at MS byte, with R, G, B (LS byte) */
 } VC_IMAGE_TYPE_T;
 #endif
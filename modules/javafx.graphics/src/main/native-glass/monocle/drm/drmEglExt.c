@@ -0,0 +1,714 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * DRM/KMS implementation of the low-level functions declared in egl_ext.h,
+ * to be built as a separate library and loaded by the EGL platform through
+ * the monocle.egl.lib system property.
+ *
+ * Prism renders with EGL into a GBM surface. After each eglSwapBuffers the
+ * new front buffer is shown on the primary plane of the CRTC with an atomic
+ * commit, or a legacy page flip on drivers without atomic support. Only one
+ * flip is queued at a time, so rendering is paced by vertical blank while
+ * the next frame is drawn into a third buffer. The cursor is shown on the
+ * cursor plane of the CRTC, so moving it never needs a repaint.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+#include <gbm.h>
+#include <EGL/egl.h>
+
+#include "com_sun_glass_ui_Pixels_Format.h"
+#include "egl_ext.h"
+#include "Monocle.h"
+
+#define DRM_DEFAULT_CARD "/dev/dri/card1"
+#define DRM_MAX_CARDS 8
+#define DRM_FLIP_TIMEOUT_MS 1000
+
+typedef struct {
+    uint32_t id;
+    uint32_t fb_id;
+    uint32_t crtc_id;
+    uint32_t src_x, src_y, src_w, src_h;
+    uint32_t crtc_x, crtc_y, crtc_w, crtc_h;
+} DrmPlane;
+
+static struct {
+    int fd;
+    char card[64];
+    int atomic;
+
+    uint32_t connector_id;
+    uint32_t connector_crtc_prop;
+    uint32_t crtc_id;
+    uint32_t crtc_mode_prop;
+    uint32_t crtc_active_prop;
+    drmModeModeInfo mode;
+    uint32_t mode_blob;
+    uint32_t mm_width;
+    DrmPlane primary;
+    DrmPlane cursor;
+
+    struct gbm_device *gbm;
+    struct gbm_surface *surface;
+    uint32_t format;
+    struct gbm_bo *scanout_bo;  // shown on the screen
+    struct gbm_bo *pending_bo;  // queued to be shown at the next vblank
+    int mode_set;
+
+    pthread_mutex_t lock;       // guards the cursor state and commits
+    struct gbm_bo *cursor_bo;
+    uint64_t cursor_width, cursor_height;
+    int cursor_image_width, cursor_image_height;
+    int cursor_x, cursor_y;
+    int cursor_visible;
+    int cursor_dirty;
+} drm = {
+    .fd = -1,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static uint32_t get_property(uint32_t object_id, uint32_t object_type,
+                             const char *name, uint64_t *value) {
+    uint32_t id = 0;
+    drmModeObjectProperties *props =
+            drmModeObjectGetProperties(drm.fd, object_id, object_type);
+    if (props == NULL) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < props->count_props && id == 0; i++) {
+        drmModePropertyRes *prop = drmModeGetProperty(drm.fd, props->props[i]);
+        if (prop != NULL) {
+            if (strcmp(prop->name, name) == 0) {
+                id = prop->prop_id;
+                if (value != NULL) {
+                    *value = props->prop_values[i];
+                }
+            }
+            drmModeFreeProperty(prop);
+        }
+    }
+    drmModeFreeObjectProperties(props);
+    return id;
+}
+
+static int plane_init(DrmPlane *plane, uint32_t id) {
+    plane->id = id;
+    plane->fb_id = get_property(id, DRM_MODE_OBJECT_PLANE, "FB_ID", NULL);
+    plane->crtc_id = get_property(id, DRM_MODE_OBJECT_PLANE, "CRTC_ID", NULL);
+    plane->src_x = get_property(id, DRM_MODE_OBJECT_PLANE, "SRC_X", NULL);
+    plane->src_y = get_property(id, DRM_MODE_OBJECT_PLANE, "SRC_Y", NULL);
+    plane->src_w = get_property(id, DRM_MODE_OBJECT_PLANE, "SRC_W", NULL);
+    plane->src_h = get_property(id, DRM_MODE_OBJECT_PLANE, "SRC_H", NULL);
+    plane->crtc_x = get_property(id, DRM_MODE_OBJECT_PLANE, "CRTC_X", NULL);
+    plane->crtc_y = get_property(id, DRM_MODE_OBJECT_PLANE, "CRTC_Y", NULL);
+    plane->crtc_w = get_property(id, DRM_MODE_OBJECT_PLANE, "CRTC_W", NULL);
+    plane->crtc_h = get_property(id, DRM_MODE_OBJECT_PLANE, "CRTC_H", NULL);
+    return plane->fb_id && plane->crtc_id
+            && plane->src_x && plane->src_y && plane->src_w && plane->src_h
+            && plane->crtc_x && plane->crtc_y && plane->crtc_w && plane->crtc_h;
+}
+
+// Shows fb at x, y on the plane, or disables the plane if fb is 0
+static void plane_add(drmModeAtomicReq *req, DrmPlane *plane, uint32_t fb,
+                      int x, int y, uint32_t width, uint32_t height) {
+    drmModeAtomicAddProperty(req, plane->id, plane->fb_id, fb);
+    drmModeAtomicAddProperty(req, plane->id, plane->crtc_id, fb ? drm.crtc_id : 0);
+    drmModeAtomicAddProperty(req, plane->id, plane->src_x, 0);
+    drmModeAtomicAddProperty(req, plane->id, plane->src_y, 0);
+    drmModeAtomicAddProperty(req, plane->id, plane->src_w, ((uint64_t) width) << 16);
+    drmModeAtomicAddProperty(req, plane->id, plane->src_h, ((uint64_t) height) << 16);
+    drmModeAtomicAddProperty(req, plane->id, plane->crtc_x, (uint64_t) (int64_t) x);
+    drmModeAtomicAddProperty(req, plane->id, plane->crtc_y, (uint64_t) (int64_t) y);
+    drmModeAtomicAddProperty(req, plane->id, plane->crtc_w, width);
+    drmModeAtomicAddProperty(req, plane->id, plane->crtc_h, height);
+}
+
+static void find_planes(int crtc_index) {
+    drmModePlaneRes *planes = drmModeGetPlaneResources(drm.fd);
+    if (planes == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < planes->count_planes; i++) {
+        drmModePlane *plane = drmModeGetPlane(drm.fd, planes->planes[i]);
+        if (plane == NULL) {
+            continue;
+        }
+        uint64_t type;
+        if ((plane->possible_crtcs & (1u << crtc_index))
+                && get_property(plane->plane_id, DRM_MODE_OBJECT_PLANE, "type", &type)) {
+            if (type == DRM_PLANE_TYPE_PRIMARY && drm.primary.id == 0) {
+                if (!plane_init(&drm.primary, plane->plane_id)) {
+                    drm.primary.id = 0;
+                }
+            } else if (type == DRM_PLANE_TYPE_CURSOR && drm.cursor.id == 0) {
+                if (!plane_init(&drm.cursor, plane->plane_id)) {
+                    drm.cursor.id = 0;
+                }
+            }
+        }
+        drmModeFreePlane(plane);
+    }
+    drmModeFreePlaneResources(planes);
+}
+
+static int find_crtc(drmModeRes *res, drmModeConnector *connector, int *crtc_index) {
+    uint32_t crtc_id = 0;
+    if (connector->encoder_id) {
+        drmModeEncoder *encoder = drmModeGetEncoder(drm.fd, connector->encoder_id);
+        if (encoder != NULL) {
+            crtc_id = encoder->crtc_id;
+            drmModeFreeEncoder(encoder);
+        }
+    }
+    for (int i = 0; i < connector->count_encoders && crtc_id == 0; i++) {
+        drmModeEncoder *encoder = drmModeGetEncoder(drm.fd, connector->encoders[i]);
+        if (encoder == NULL) {
+            continue;
+        }
+        for (int j = 0; j < res->count_crtcs; j++) {
+            if (encoder->possible_crtcs & (1u << j)) {
+                crtc_id = res->crtcs[j];
+                break;
+            }
+        }
+        drmModeFreeEncoder(encoder);
+    }
+    for (int j = 0; j < res->count_crtcs; j++) {
+        if (res->crtcs[j] == crtc_id) {
+            drm.crtc_id = crtc_id;
+            *crtc_index = j;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int find_output() {
+    drmModeRes *res = drmModeGetResources(drm.fd);
+    if (res == NULL) {
+        return 0;
+    }
+    int found = 0;
+    for (int i = 0; i < res->count_connectors && !found; i++) {
+        drmModeConnector *connector = drmModeGetConnector(drm.fd, res->connectors[i]);
+        if (connector == NULL) {
+            continue;
+        }
+        int crtc_index;
+        if (connector->connection == DRM_MODE_CONNECTED
+                && connector->count_modes > 0
+                && find_crtc(res, connector, &crtc_index)) {
+            drm.connector_id = connector->connector_id;
+            drm.mm_width = connector->mmWidth;
+            drm.mode = connector->modes[0];
+            for (int m = 0; m < connector->count_modes; m++) {
+                if (connector->modes[m].type & DRM_MODE_TYPE_PREFERRED) {
+                    drm.mode = connector->modes[m];
+                    break;
+                }
+            }
+            if (drm.atomic) {
+                find_planes(crtc_index);
+            }
+            found = 1;
+        }
+        drmModeFreeConnector(connector);
+    }
+    drmModeFreeResources(res);
+    return found;
+}
+
+static void close_device() {
+    if (drm.mode_blob != 0) {
+        drmModeDestroyPropertyBlob(drm.fd, drm.mode_blob);
+        drm.mode_blob = 0;
+    }
+    if (drm.gbm != NULL) {
+        gbm_device_destroy(drm.gbm);
+        drm.gbm = NULL;
+    }
+    if (drm.fd >= 0) {
+        close(drm.fd);
+        drm.fd = -1;
+    }
+    memset(&drm.primary, 0, sizeof(drm.primary));
+    memset(&drm.cursor, 0, sizeof(drm.cursor));
+    drm.card[0] = '\0';
+}
+
+static int open_card(const char *card) {
+    drm.fd = open(card, O_RDWR | O_CLOEXEC);
+    if (drm.fd < 0) {
+        return 0;
+    }
+    drm.atomic = 0;
+    if (getenv("MONOCLE_DRM_LEGACY") == NULL
+            && drmSetClientCap(drm.fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) == 0
+            && drmSetClientCap(drm.fd, DRM_CLIENT_CAP_ATOMIC, 1) == 0) {
+        drm.atomic = 1;
+    }
+    if (!find_output()) {
+        close_device();
+        return 0;
+    }
+    if (drm.atomic) {
+        drm.connector_crtc_prop = get_property(drm.connector_id,
+                DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID", NULL);
+        drm.crtc_mode_prop = get_property(drm.crtc_id,
+                DRM_MODE_OBJECT_CRTC, "MODE_ID", NULL);
+        drm.crtc_active_prop = get_property(drm.crtc_id,
+                DRM_MODE_OBJECT_CRTC, "ACTIVE", NULL);
+        if (drm.primary.id == 0 || !drm.connector_crtc_prop
+                || !drm.crtc_mode_prop || !drm.crtc_active_prop
+                || drmModeCreatePropertyBlob(drm.fd, &drm.mode,
+                        sizeof(drm.mode), &drm.mode_blob) != 0) {
+            // Fall back to the legacy interface on this device
+            drm.atomic = 0;
+        }
+    }
+    drm.gbm = gbm_create_device(drm.fd);
+    if (drm.gbm == NULL) {
+        close_device();
+        return 0;
+    }
+    if (drmGetCap(drm.fd, DRM_CAP_CURSOR_WIDTH, &drm.cursor_width) != 0) {
+        drm.cursor_width = 64;
+    }
+    if (drmGetCap(drm.fd, DRM_CAP_CURSOR_HEIGHT, &drm.cursor_height) != 0) {
+        drm.cursor_height = 64;
+    }
+    strncpy(drm.card, card, sizeof(drm.card) - 1);
+    return 1;
+}
+
+/*
+ * Opens the given card, or the default one, or else the first card with
+ * a connected output.
+ */
+static int open_device(const char *card) {
+    if (drm.fd >= 0) {
+        if (card == NULL || strcmp(card, drm.card) == 0 || drm.surface != NULL) {
+            return 1;
+        }
+        close_device();
+    }
+    if (open_card(card != NULL ? card : DRM_DEFAULT_CARD)) {
+        return 1;
+    }
+    for (int i = 0; i < DRM_MAX_CARDS; i++) {
+        char path[64];
+        snprintf(path, sizeof(path), "/dev/dri/card%d", i);
+        if (open_card(path)) {
+            return 1;
+        }
+    }
+    fprintf(stderr, "DRM: no connected output found\n");
+    return 0;
+}
+
+static void fb_destroy(struct gbm_bo *bo, void *data) {
+    uint32_t fb = (uint32_t) (uintptr_t) data;
+    drmModeRmFB(gbm_device_get_fd(gbm_bo_get_device(bo)), fb);
+}
+
+// Returns the framebuffer of a buffer object, created on first use
+static uint32_t get_fb(struct gbm_bo *bo) {
+    uint32_t fb = (uint32_t) (uintptr_t) gbm_bo_get_user_data(bo);
+    if (fb != 0) {
+        return fb;
+    }
+    uint32_t handles[4] = { gbm_bo_get_handle(bo).u32 };
+    uint32_t pitches[4] = { gbm_bo_get_stride(bo) };
+    uint32_t offsets[4] = { 0 };
+    if (drmModeAddFB2(drm.fd, gbm_bo_get_width(bo), gbm_bo_get_height(bo),
+                      gbm_bo_get_format(bo), handles, pitches, offsets, &fb, 0) != 0) {
+        fprintf(stderr, "DRM: cannot create framebuffer: %s\n", strerror(errno));
+        return 0;
+    }
+    gbm_bo_set_user_data(bo, (void *) (uintptr_t) fb, fb_destroy);
+    return fb;
+}
+
+static void add_cursor(drmModeAtomicReq *req) {
+    if (drm.cursor_visible && drm.cursor_bo != NULL) {
+        plane_add(req, &drm.cursor, get_fb(drm.cursor_bo),
+                  drm.cursor_x, drm.cursor_y,
+                  (uint32_t) drm.cursor_width, (uint32_t) drm.cursor_height);
+    } else {
+        plane_add(req, &drm.cursor, 0, 0, 0, 0, 0);
+    }
+    drm.cursor_dirty = 0;
+}
+
+static void update_legacy_cursor() {
+    if (drm.cursor_visible && drm.cursor_bo != NULL) {
+        drmModeSetCursor(drm.fd, drm.crtc_id, gbm_bo_get_handle(drm.cursor_bo).u32,
+                         (uint32_t) drm.cursor_width, (uint32_t) drm.cursor_height);
+        drmModeMoveCursor(drm.fd, drm.crtc_id, drm.cursor_x, drm.cursor_y);
+    } else {
+        drmModeSetCursor(drm.fd, drm.crtc_id, 0, 0, 0);
+    }
+    drm.cursor_dirty = 0;
+}
+
+static void page_flip_handler(int UNUSED(fd), unsigned int UNUSED(sequence),
+                              unsigned int UNUSED(sec), unsigned int UNUSED(usec),
+                              void *UNUSED(data)) {
+    if (drm.scanout_bo != NULL) {
+        gbm_surface_release_buffer(drm.surface, drm.scanout_bo);
+    }
+    drm.scanout_bo = drm.pending_bo;
+    drm.pending_bo = NULL;
+}
+
+// Waits until the queued frame is on the screen
+static void wait_for_flip() {
+    drmEventContext context = {
+        .version = 2,
+        .page_flip_handler = page_flip_handler,
+    };
+    while (drm.pending_bo != NULL) {
+        struct pollfd pfd = { .fd = drm.fd, .events = POLLIN };
+        int ready = poll(&pfd, 1, DRM_FLIP_TIMEOUT_MS);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            fprintf(stderr, "DRM: page flip did not complete\n");
+            page_flip_handler(drm.fd, 0, 0, 0, NULL);
+            break;
+        }
+        drmHandleEvent(drm.fd, &context);
+    }
+}
+
+static int present(struct gbm_bo *bo, uint32_t fb) {
+    int result;
+    pthread_mutex_lock(&drm.lock);
+    if (drm.atomic) {
+        drmModeAtomicReq *req = drmModeAtomicAlloc();
+        uint32_t flags;
+        if (!drm.mode_set) {
+            drmModeAtomicAddProperty(req, drm.connector_id, drm.connector_crtc_prop, drm.crtc_id);
+            drmModeAtomicAddProperty(req, drm.crtc_id, drm.crtc_mode_prop, drm.mode_blob);
+            drmModeAtomicAddProperty(req, drm.crtc_id, drm.crtc_active_prop, 1);
+            flags = DRM_MODE_ATOMIC_ALLOW_MODESET;
+        } else {
+            flags = DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK;
+        }
+        plane_add(req, &drm.primary, fb, 0, 0, drm.mode.hdisplay, drm.mode.vdisplay);
+        if (drm.cursor.id && (drm.cursor_dirty || !drm.mode_set)) {
+            add_cursor(req);
+        }
+        result = drmModeAtomicCommit(drm.fd, req, flags, NULL);
+        drmModeAtomicFree(req);
+    } else if (!drm.mode_set) {
+        result = drmModeSetCrtc(drm.fd, drm.crtc_id, fb, 0, 0,
+                                &drm.connector_id, 1, &drm.mode);
+        update_legacy_cursor();
+    } else {
+        result = drmModePageFlip(drm.fd, drm.crtc_id, fb, DRM_MODE_PAGE_FLIP_EVENT, NULL);
+    }
+    pthread_mutex_unlock(&drm.lock);
+
+    if (result != 0) {
+        fprintf(stderr, "DRM: cannot show frame: %s\n", strerror(errno));
+        return 0;
+    }
+    if (!drm.mode_set) {
+        // The mode was set synchronously, the frame is on the screen
+        drm.mode_set = 1;
+        drm.scanout_bo = bo;
+    } else {
+        drm.pending_bo = bo;
+    }
+    return 1;
+}
+
+jlong getNativeWindowHandle(const char *v) {
+    if (!open_device(v)) {
+        return 0;
+    }
+    if (drm.surface == NULL) {
+        drm.format = GBM_FORMAT_XRGB8888;
+        drm.surface = gbm_surface_create(drm.gbm,
+                drm.mode.hdisplay, drm.mode.vdisplay, drm.format,
+                GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+        if (drm.surface == NULL) {
+            fprintf(stderr, "DRM: cannot create GBM surface\n");
+            return 0;
+        }
+    }
+    return asJLong(drm.surface);
+}
+
+jlong getEglDisplayHandle() {
+    if (!open_device(NULL)) {
+        return 0;
+    }
+    return asJLong(eglGetDisplay((EGLNativeDisplayType) drm.gbm));
+}
+
+jboolean doEglInitialize(void *handle) {
+    return eglInitialize((EGLDisplay) handle, NULL, NULL) ? JNI_TRUE : JNI_FALSE;
+}
+
+jboolean doEglBindApi(int api) {
+    return eglBindAPI((EGLenum) api) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Chooses a configuration whose native visual matches the format of the
+ * GBM surface. If only configurations with alpha match the attributes,
+ * the surface is created again in that format.
+ */
+jlong doEglChooseConfig(jlong eglDisplay, int *attribs) {
+    EGLDisplay display = (EGLDisplay) asPtr(eglDisplay);
+    EGLint count = 0;
+    if (!eglChooseConfig(display, attribs, NULL, 0, &count) || count == 0) {
+        return -1;
+    }
+    EGLConfig *configs = malloc(count * sizeof(EGLConfig));
+    if (configs == NULL) {
+        return -1;
+    }
+    jlong answer = -1;
+    uint32_t format = 0;
+    if (eglChooseConfig(display, attribs, configs, count, &count)) {
+        for (EGLint i = 0; i < count; i++) {
+            EGLint visual;
+            if (!eglGetConfigAttrib(display, configs[i], EGL_NATIVE_VISUAL_ID, &visual)) {
+                continue;
+            }
+            if ((uint32_t) visual == drm.format) {
+                answer = asJLong(configs[i]);
+                format = drm.format;
+                break;
+            }
+            if (answer == -1 && (uint32_t) visual == GBM_FORMAT_ARGB8888) {
+                answer = asJLong(configs[i]);
+                format = GBM_FORMAT_ARGB8888;
+            }
+        }
+    }
+    free(configs);
+
+    if (answer != -1 && format != drm.format && drm.surface != NULL) {
+        gbm_surface_destroy(drm.surface);
+        drm.format = format;
+        drm.surface = gbm_surface_create(drm.gbm,
+                drm.mode.hdisplay, drm.mode.vdisplay, drm.format,
+                GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+        if (drm.surface == NULL) {
+            fprintf(stderr, "DRM: cannot create GBM surface\n");
+            return -1;
+        }
+    }
+    return answer;
+}
+
+jlong doEglCreateWindowSurface(jlong eglDisplay, jlong config, jlong UNUSED(nativeWindow)) {
+    // The surface may have been replaced by doEglChooseConfig
+    EGLSurface surface = eglCreateWindowSurface((EGLDisplay) asPtr(eglDisplay),
+            (EGLConfig) asPtr(config), (EGLNativeWindowType) drm.surface, NULL);
+    if (surface == EGL_NO_SURFACE) {
+        fprintf(stderr, "DRM: cannot create EGL surface: 0x%x\n", eglGetError());
+    }
+    return asJLong(surface);
+}
+
+jlong doEglCreateContext(jlong eglDisplay, jlong config) {
+    EGLint attribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+    EGLContext context = eglCreateContext((EGLDisplay) asPtr(eglDisplay),
+            (EGLConfig) asPtr(config), EGL_NO_CONTEXT, attribs);
+    return asJLong(context);
+}
+
+jboolean doEglMakeCurrent(jlong eglDisplay, jlong drawSurface,
+                          jlong readSurface, jlong eglContext) {
+    return eglMakeCurrent((EGLDisplay) asPtr(eglDisplay),
+            (EGLSurface) asPtr(drawSurface), (EGLSurface) asPtr(readSurface),
+            (EGLContext) asPtr(eglContext)) ? JNI_TRUE : JNI_FALSE;
+}
+
+jboolean doEglSwapBuffers(jlong eglDisplay, jlong eglSurface) {
+    if (!eglSwapBuffers((EGLDisplay) asPtr(eglDisplay), (EGLSurface) asPtr(eglSurface))) {
+        return JNI_FALSE;
+    }
+    // Keep at most one frame queued; its predecessor is then released
+    // back to the surface, so that the next frame can be rendered.
+    wait_for_flip();
+    struct gbm_bo *bo = gbm_surface_lock_front_buffer(drm.surface);
+    if (bo == NULL) {
+        return JNI_FALSE;
+    }
+    uint32_t fb = get_fb(bo);
+    if (fb == 0 || !present(bo, fb)) {
+        gbm_surface_release_buffer(drm.surface, bo);
+        return JNI_FALSE;
+    }
+    return JNI_TRUE;
+}
+
+jint doGetNumberOfScreens() {
+    return open_device(NULL) ? 1 : 0;
+}
+
+jlong doGetHandle(jint UNUSED(idx)) {
+    return open_device(NULL) ? drm.connector_id : 0;
+}
+
+jint doGetDepth(jint UNUSED(idx)) {
+    return 32;
+}
+
+jint doGetWidth(jint UNUSED(idx)) {
+    return open_device(NULL) ? drm.mode.hdisplay : 0;
+}
+
+jint doGetHeight(jint UNUSED(idx)) {
+    return open_device(NULL) ? drm.mode.vdisplay : 0;
+}
+
+jint doGetOffsetX(jint UNUSED(idx)) {
+    return 0;
+}
+
+jint doGetOffsetY(jint UNUSED(idx)) {
+    return 0;
+}
+
+jint doGetDpi(jint UNUSED(idx)) {
+    if (!open_device(NULL) || drm.mm_width == 0) {
+        return 96;
+    }
+    return (jint) (drm.mode.hdisplay * 25.4f / drm.mm_width + 0.5f);
+}
+
+jint doGetNativeFormat(jint UNUSED(idx)) {
+    return com_sun_glass_ui_Pixels_Format_BYTE_BGRA_PRE;
+}
+
+jfloat doGetScale(jint UNUSED(idx)) {
+    return 1.0f;
+}
+
+/*
+ * Shows the cursor changes right away if the CRTC is idle, otherwise they
+ * are committed together with the next frame.
+ */
+static void commit_cursor() {
+    drm.cursor_dirty = 1;
+    if (!drm.mode_set) {
+        return;
+    }
+    if (drm.atomic) {
+        if (drm.cursor.id == 0) {
+            return;
+        }
+        drmModeAtomicReq *req = drmModeAtomicAlloc();
+        add_cursor(req);
+        if (drmModeAtomicCommit(drm.fd, req, DRM_MODE_ATOMIC_NONBLOCK, NULL) != 0) {
+            drm.cursor_dirty = 1;
+        }
+        drmModeAtomicFree(req);
+    } else {
+        update_legacy_cursor();
+    }
+}
+
+void doInitCursor(jint width, jint height) {
+    pthread_mutex_lock(&drm.lock);
+    drm.cursor_image_width = width;
+    drm.cursor_image_height = height;
+    pthread_mutex_unlock(&drm.lock);
+}
+
+void doSetCursorVisibility(jboolean val) {
+    pthread_mutex_lock(&drm.lock);
+    if (drm.cursor_visible != (val ? 1 : 0)) {
+        drm.cursor_visible = val ? 1 : 0;
+        commit_cursor();
+    }
+    pthread_mutex_unlock(&drm.lock);
+}
+
+void doSetLocation(jint x, jint y) {
+    pthread_mutex_lock(&drm.lock);
+    if (drm.cursor_x != x || drm.cursor_y != y) {
+        drm.cursor_x = x;
+        drm.cursor_y = y;
+        if (drm.cursor_visible) {
+            commit_cursor();
+        }
+    }
+    pthread_mutex_unlock(&drm.lock);
+}
+
+/*
+ * The image is in BYTE_BGRA_PRE format, which is ARGB8888 in memory,
+ * and is copied to the top left corner of a cursor sized buffer.
+ */
+void doSetCursorImage(jbyte *img, int length) {
+    pthread_mutex_lock(&drm.lock);
+    int width = drm.cursor_image_width;
+    int height = drm.cursor_image_height;
+    if (width <= 0 || height <= 0 || length < width * height * 4
+            || !open_device(NULL)) {
+        pthread_mutex_unlock(&drm.lock);
+        return;
+    }
+    if (drm.cursor_bo == NULL) {
+        drm.cursor_bo = gbm_bo_create(drm.gbm,
+                (uint32_t) drm.cursor_width, (uint32_t) drm.cursor_height,
+                GBM_FORMAT_ARGB8888, GBM_BO_USE_CURSOR | GBM_BO_USE_WRITE);
+    }
+    uint32_t *pixels = calloc(drm.cursor_width * drm.cursor_height, sizeof(uint32_t));
+    if (drm.cursor_bo != NULL && pixels != NULL) {
+        int rows = height < (int) drm.cursor_height ? height : (int) drm.cursor_height;
+        int cols = width < (int) drm.cursor_width ? width : (int) drm.cursor_width;
+        for (int y = 0; y < rows; y++) {
+            memcpy(pixels + y * drm.cursor_width, img + y * width * 4, cols * 4);
+        }
+        gbm_bo_write(drm.cursor_bo, pixels,
+                     drm.cursor_width * drm.cursor_height * sizeof(uint32_t));
+        commit_cursor();
+    }
+    free(pixels);
+    pthread_mutex_unlock(&drm.lock);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -250,10 +250,28 @@ HRESULT GlassAccessible::callArrayMethod(jmethodID mid, VARTYPE vt, SAFEARRAY **
     return GlassAccessible::copyList(env, list, pRetVal, vt);
 }
 
+/*
+ * Returns the index in m_staticProperties of a property that never changes
+ * for an element, or -1. JavaFX never raises a property changed event for
+ * these, so UIA clients already treat them as constant.
+ */
+static int staticPropertyIndex(PROPERTYID propertyId)
+{
+    switch (propertyId) {
+        case UIA_ControlTypePropertyId: return 0;
+        case UIA_AutomationIdPropertyId: return 1;
+        case UIA_ProviderDescriptionPropertyId: return 2;
+    }
+    return -1;
+}
+
 GlassAccessible::GlassAccessible(JNIEnv* env, jobject jAccessible)
-: m_refCount(1)
+: m_refCount(1), m_runtimeId(NULL)
 {
     m_jAccessible = env->NewGlobalRef(jAccessible);
+    for (int i = 0; i < ARRAYSIZE(m_staticProperties); i++) {
+        VariantInit(&m_staticProperties[i]);
+    }
     GlassApplication::IncrementAccessibility();
 }
 
@@ -261,6 +279,10 @@ GlassAccessible::~GlassAccessible()
 {
     JNIEnv* env = GetEnv();
     if (env) env->DeleteGlobalRef(m_jAccessible);
+    for (int i = 0; i < ARRAYSIZE(m_staticProperties); i++) {
+        VariantClear(&m_staticProperties[i]);
+    }
+    if (m_runtimeId) SafeArrayDestroy(m_runtimeId);
     GlassApplication::DecrementAccessibility();
 }
 
@@ -375,12 +397,21 @@ IFACEMETHODIMP GlassAccessible::GetPatternProvider(PATTERNID patternId, IUnknown
 IFACEMETHODIMP GlassAccessible::GetPropertyValue(PROPERTYID propertyId, VARIANT* pRetVal)
 {
     if (pRetVal == NULL) return E_INVALIDARG;
+    int index = staticPropertyIndex(propertyId);
+    if (index != -1 && m_staticProperties[index].vt != VT_EMPTY) {
+        VariantInit(pRetVal);
+        return VariantCopy(pRetVal, &m_staticProperties[index]);
+    }
     JNIEnv* env = GetEnv();
     if (env == NULL) return E_FAIL;
     jobject jVariant = env->CallObjectMethod(m_jAccessible, mid_GetPropertyValue, propertyId);
     if (CheckAndClearException(env)) return E_FAIL;
 
-    return copyVariant(env, jVariant, pRetVal);
+    HRESULT hr = copyVariant(env, jVariant, pRetVal);
+    if (SUCCEEDED(hr) && index != -1) {
+        VariantCopy(&m_staticProperties[index], pRetVal);
+    }
+    return hr;
 }
 
 /***********************************************/
@@ -423,7 +454,13 @@ IFACEMETHODIMP GlassAccessible::GetEmbeddedFragmentRoots(SAFEARRAY **pRetVal)
 IFACEMETHODIMP GlassAccessible::GetRuntimeId(SAFEARRAY **pRetVal)
 {
     if (pRetVal == NULL) return E_INVALIDARG;
-    return callArrayMethod(mid_GetRuntimeId, VT_I4, pRetVal);
+    /* The runtime id is requested for nearly every UIA call and never changes */
+    if (m_runtimeId) return SafeArrayCopy(m_runtimeId, pRetVal);
+    HRESULT hr = callArrayMethod(mid_GetRuntimeId, VT_I4, pRetVal);
+    if (SUCCEEDED(hr)) {
+        SafeArrayCopy(*pRetVal, &m_runtimeId);
+    }
+    return hr;
 }
 
 IFACEMETHODIMP GlassAccessible::Navigate(NavigateDirection direction, IRawElementProviderFragment **pRetVal)
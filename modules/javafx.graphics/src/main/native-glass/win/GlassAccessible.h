@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -183,6 +183,10 @@ private:
     ULONG m_refCount;
     jobject m_jAccessible;  // The GlobalRef Java side object
 
+    /* Values that never change for an element, kept after the first upcall */
+    VARIANT m_staticProperties[3];
+    SAFEARRAY* m_runtimeId;
+
 };
 
 #endif //_GLASSACCESSIBLE_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,9 @@
 #include "com_sun_glass_ui_win_WinView.h"
 
 
+// Uploads with more damage rectangles than this present the whole view
+#define MAX_DAMAGE_RECTS 16
+
 // Helper LEAVE_MAIN_THREAD for GlassView
 #define LEAVE_MAIN_THREAD_WITH_view  \
     GlassView * view;  \
@@ -179,6 +182,10 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1initIDs
      ASSERT(javaIDs.View.notifyMouse);
      if (env->ExceptionCheck()) return;
 
+     javaIDs.View.notifyCoalescedPoints = env->GetMethodID(cls, "notifyCoalescedPoints", "([I)V");
+     ASSERT(javaIDs.View.notifyCoalescedPoints);
+     if (env->ExceptionCheck()) return;
+
      javaIDs.View.notifyMenu = env->GetMethodID(cls, "notifyMenu", "(IIIIZ)V");
      ASSERT(javaIDs.View.notifyMenu);
      if (env->ExceptionCheck()) return;
@@ -230,6 +237,10 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1initIDs
      javaIDs.View.ptr = env->GetFieldID(cls, "ptr", "J");
      ASSERT(javaIDs.View.ptr);
      if (env->ExceptionCheck()) return;
+
+     javaIDs.View.coalescedPointsEnabled = env->GetFieldID(cls, "coalescedPointsEnabled", "Z");
+     ASSERT(javaIDs.View.coalescedPointsEnabled);
+     if (env->ExceptionCheck()) return;
 }
 
 /*
@@ -409,11 +420,11 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1end
 
 /*
  * Class:     com_sun_glass_ui_win_WinView
- * Method:    _uploadPixels
- * Signature: (JLcom/sun/glass/ui/Pixels;)V
+ * Method:    _uploadPixelsImpl
+ * Signature: (JLcom/sun/glass/ui/Pixels;[I)V
  */
-JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
-    (JNIEnv *env, jobject jThis, jlong ptr, jobject jPixels)
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixelsImpl
+    (JNIEnv *env, jobject jThis, jlong ptr, jobject jPixels, jintArray jDamage)
 {
     ENTER_MAIN_THREAD()
     {
@@ -429,6 +440,18 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
         GlassWindow *pWindow = GlassWindow::FromHandle(hWnd);
         Pixels pixels(GetEnv(), jPixels);
 
+        // Only the damaged rectangles changed since the previous upload
+        HRGN hDamage = NULL;
+        if (ndamage >= 0) {
+            hDamage = ::CreateRectRgn(0, 0, 0, 0);
+            for (jint i = 0; i < ndamage; i++) {
+                const jint *r = damage + 4 * i;
+                HRGN hRect = ::CreateRectRgn(r[0], r[1], r[0] + r[2], r[1] + r[3]);
+                ::CombineRgn(hDamage, hDamage, hRect, RGN_OR);
+                ::DeleteObject(hRect);
+            }
+        }
+
         if (!pWindow || !pWindow->IsTransparent()) {
             // Either a non-glass window (FullScreenWindow), or not transparent
             BITMAPINFOHEADER bmi;
@@ -442,6 +465,9 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
             bmi.biCompression = BI_RGB;
 
             HDC hdcDst = ::GetDC(hWnd);
+            if (hDamage) {
+                ::SelectClipRgn(hdcDst, hDamage);
+            }
             ::SetDIBitsToDevice(
                     hdcDst,
                     0, 0, pixels.GetWidth(), pixels.GetHeight(),
@@ -449,6 +475,9 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
                     0, pixels.GetHeight(),
                     pixels.GetBits(),
                     (BITMAPINFO*)&bmi, DIB_RGB_COLORS);
+            if (hDamage) {
+                ::SelectClipRgn(hdcDst, NULL);
+            }
             ::ReleaseDC(hWnd, hdcDst);
         } else { // IsTransparent() == TRUE
             // http://msdn.microsoft.com/en-us/library/ms997507.aspx
@@ -459,6 +488,9 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
             if (size.cx != pixels.GetWidth() || size.cy != pixels.GetHeight()) {
                 //XXX: should report a error? OTOH, we could proceed, but
                 //this will cause the window to resize to the size of the bitmap
+                if (hDamage) {
+                    ::DeleteObject(hDamage);
+                }
                 return;
             }
 
@@ -477,18 +509,50 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
             HDC hdcSrc = ::CreateCompatibleDC(NULL);
             HBITMAP oldBitmap = (HBITMAP)::SelectObject(hdcSrc, bitmap);
 
-            ::UpdateLayeredWindow(hWnd, hdcDst, &ptDst, &size, hdcSrc, &ptSrc,
-                    RGB(0, 0, 0), &bf, ULW_ALPHA);
+            UPDATELAYEREDWINDOWINFO info;
+            ZeroMemory(&info, sizeof(info));
+            info.cbSize = sizeof(info);
+            info.hdcDst = hdcDst;
+            info.pptDst = &ptDst;
+            info.psize = &size;
+            info.hdcSrc = hdcSrc;
+            info.pptSrc = &ptSrc;
+            info.crKey = RGB(0, 0, 0);
+            info.pblend = &bf;
+            info.dwFlags = ULW_ALPHA;
+
+            // The window still has to take the whole bitmap, but the
+            // compositor only needs to refresh the bounds of the damage
+            RECT dirty;
+            if (hDamage && ::GetRgnBox(hDamage, &dirty) != NULLREGION) {
+                info.prcDirty = &dirty;
+            }
+            ::UpdateLayeredWindowIndirect(hWnd, &info);
 
             ::SelectObject(hdcSrc, oldBitmap);
             ::DeleteDC(hdcSrc);
             ::ReleaseDC(NULL, hdcDst);
         }
+        if (hDamage) {
+            ::DeleteObject(hDamage);
+        }
     }
     DECL_jobject(jPixels);
+    jint damage[MAX_DAMAGE_RECTS * 4];
+    jint ndamage;
     LEAVE_MAIN_THREAD_WITH_view;
 
     ARG(jPixels) = jPixels;
+    ARG(ndamage) = -1;
+    if (jDamage) {
+        jsize length = env->GetArrayLength(jDamage);
+        if (length % 4 == 0 && length <= MAX_DAMAGE_RECTS * 4) {
+            env->GetIntArrayRegion(jDamage, 0, length, ARG(damage));
+            if (!CheckAndClearException(env)) {
+                ARG(ndamage) = length / 4;
+            }
+        }
+    }
     PERFORM();
 }
 
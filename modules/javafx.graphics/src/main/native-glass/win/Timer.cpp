@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,11 @@ class RunnableTimer : public Timer {
             }
         }
 
+        virtual ~RunnableTimer()
+        {
+            stop();
+        }
+
         virtual void TimerCallback()
         {
             GetEnv()->CallVoidMethod(runnable, javaIDs.Runnable.run);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,10 @@
 #ifndef _TIMER_H
 #define _TIMER_H
 
+// Available since Windows 10 1803; older systems fail the create call
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 class Timer {
     public:
@@ -43,28 +47,26 @@ class Timer {
 
         class Exception {};
 
-        Timer() : id(0)
+        Timer() : id(0), periodBegun(false), hTimer(NULL), hStop(NULL), hThread(NULL)
         {
-            if (++timersCount == 1) {
-                if (!InitTC()) {
-                    throw Exception();
-                }
-
-                ::timeBeginPeriod(wTimerRes);
-            }
         }
 
         virtual ~Timer()
         {
-            if (id) {
-                ::timeKillEvent(id);
-            }
-            if (--timersCount == 0 && wTimerRes != 0) {
-                ::timeEndPeriod(wTimerRes);
-            }
+            stop();
         }
 
         bool start(UINT period) {
+            // A high resolution waitable timer needs no global timer
+            // resolution change. Its signaled state also coalesces ticks
+            // while the callback is behind, instead of queueing them.
+            if (startWaitableTimer(period)) {
+                return true;
+            }
+
+            if (!beginPeriod()) {
+                return false;
+            }
             // MSDN suggests to use CreateTimerQueueTimer instead, but people
             // on the internets say is provides less accurate timers, so
             // let's use timeSetEvent.
@@ -74,6 +76,38 @@ class Timer {
             return id != 0;
         }
 
+        // Waits for a running callback to return. Subclasses call it from
+        // their destructor, before the state used by TimerCallback() goes.
+        void stop()
+        {
+            if (hThread) {
+                ::SetEvent(hStop);
+                if (::GetThreadId(hThread) != ::GetCurrentThreadId()) {
+                    ::WaitForSingleObject(hThread, INFINITE);
+                }
+                ::CloseHandle(hThread);
+                hThread = NULL;
+            }
+            if (hTimer) {
+                ::CloseHandle(hTimer);
+                hTimer = NULL;
+            }
+            if (hStop) {
+                ::CloseHandle(hStop);
+                hStop = NULL;
+            }
+            if (id) {
+                ::timeKillEvent(id);
+                id = 0;
+            }
+            if (periodBegun) {
+                periodBegun = false;
+                if (--timersCount == 0 && wTimerRes != 0) {
+                    ::timeEndPeriod(wTimerRes);
+                }
+            }
+        }
+
         virtual void TimerCallback() = 0;
 
     private:
@@ -93,6 +127,51 @@ class Timer {
             return true;
         }
 
+        bool beginPeriod()
+        {
+            if (timersCount == 0) {
+                if (!InitTC()) {
+                    return false;
+                }
+                ::timeBeginPeriod(wTimerRes);
+            }
+            timersCount++;
+            periodBegun = true;
+            return true;
+        }
+
+        bool startWaitableTimer(UINT period)
+        {
+            hTimer = ::CreateWaitableTimerExW(NULL, NULL,
+                    CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+            if (!hTimer) {
+                return false;
+            }
+            hStop = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -(LONGLONG)period * 10000; // relative, in 100ns
+            if (hStop && ::SetWaitableTimer(hTimer, &dueTime, period, NULL, NULL, FALSE)) {
+                hThread = ::CreateThread(NULL, 0, StaticThreadProc, this, 0, NULL);
+            }
+            if (!hThread) {
+                stop();
+                return false;
+            }
+            // Same priority as the multimedia timer callback thread
+            ::SetThreadPriority(hThread, THREAD_PRIORITY_TIME_CRITICAL);
+            return true;
+        }
+
+        static DWORD WINAPI StaticThreadProc(LPVOID param)
+        {
+            Timer *timer = (Timer*)param;
+            HANDLE handles[] = { timer->hStop, timer->hTimer };
+            while (::WaitForMultipleObjects(2, handles, FALSE, INFINITE) == WAIT_OBJECT_0 + 1) {
+                timer->TimerCallback();
+            }
+            return 0;
+        }
 
         static void CALLBACK StaticTimeCallback(UINT uTimerID, UINT uMsg, DWORD_PTR dwUser, DWORD_PTR dw1, DWORD_PTR dw2)
         {
@@ -104,7 +183,10 @@ class Timer {
         static TIMECAPS tc;
 
         UINT id;
+        bool periodBegun;
+        HANDLE hTimer;
+        HANDLE hStop;
+        HANDLE hThread;
 };
 
 #endif //_TIMER_H
-
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -498,6 +498,7 @@ typedef struct _tagJavaIDs {
         jmethodID notifyRepaint;
         jmethodID notifyKey;
         jmethodID notifyMouse;
+        jmethodID notifyCoalescedPoints;
         jmethodID notifyMenu;
         jmethodID notifyScroll;
         jmethodID notifyInputMethod;
@@ -515,6 +516,7 @@ typedef struct _tagJavaIDs {
         jmethodID getAccessible;
 
         jfieldID  ptr;
+        jfieldID  coalescedPointsEnabled;
     } View;
     struct {
         jmethodID init;
@@ -86,6 +86,7 @@ ViewContainer::ViewContainer() :
     m_manipEventSink(NULL),
     m_gestureSupportCls(NULL),
     m_lastMouseMovePosition(-1),
+    m_lastMouseMoveTime(0),
     m_mouseButtonDownCounter(0),
     m_deadKeyWParam(0)
 {
@@ -93,6 +94,7 @@ ViewContainer::ViewContainer() :
     m_idLang = LOWORD(m_kbLayout);
     m_codePage = LangToCodePage(m_idLang);
     m_lastTouchInputCount = 0;
+    m_lastMouseMovePoint.x = m_lastMouseMovePoint.y = 0;
 }
 
 jobject ViewContainer::GetView()
@@ -690,6 +692,93 @@ void ViewContainer::HandleViewTypedEvent(HWND hwnd, UINT msg, WPARAM wParam, LPA
     SendViewTypedEvent(repCount, wChar);
 }
 
+// The most mouse positions retrieved for one WM_MOUSEMOVE; the system keeps
+// the last 64 only
+#define MAX_COALESCED_POINTS 64
+
+// Windows posts at most one WM_MOUSEMOVE at a time and merges the motion
+// that happens until it is retrieved. When the view asks for them, this
+// passes the positions merged into the current WM_MOUSEMOVE to the view
+// in one call, in the format of View.notifyCoalescedPoints().
+void ViewContainer::NotifyCoalescedPoints(HWND hwnd, POINT ptAbs)
+{
+    const DWORD time = ::GetMessageTime();
+    const POINT lastPoint = m_lastMouseMovePoint;
+    const DWORD lastTime = m_lastMouseMoveTime;
+
+    m_lastMouseMovePoint = ptAbs;
+    m_lastMouseMoveTime = time;
+
+    JNIEnv *env = GetEnv();
+    if (lastTime == 0 ||
+        !env->GetBooleanField(GetView(), javaIDs.View.coalescedPointsEnabled))
+    {
+        return;
+    }
+
+    MOUSEMOVEPOINT current = {};
+    current.x = ptAbs.x & 0x0000FFFF;
+    current.y = ptAbs.y & 0x0000FFFF;
+    current.time = time;
+
+    MOUSEMOVEPOINT history[MAX_COALESCED_POINTS];
+    int count = ::GetMouseMovePointsEx(sizeof(MOUSEMOVEPOINT), &current,
+            history, MAX_COALESCED_POINTS, GMMP_USE_DISPLAY_POINTS);
+
+    // The history starts with the current position and goes back in time.
+    // Display points to the left of or above the primary monitor wrap
+    // around to large positive values.
+    if (count > 0) {
+        history[0].x = ptAbs.x;
+        history[0].y = ptAbs.y;
+    }
+    int n = 1;
+    for (; n < count; n++) {
+        MOUSEMOVEPOINT &p = history[n];
+        if (p.x > 32767) p.x -= 65536;
+        if (p.y > 32767) p.y -= 65536;
+        if ((LONG)(p.time - lastTime) < 0 ||
+            (p.time == lastTime && p.x == lastPoint.x && p.y == lastPoint.y))
+        {
+            break;
+        }
+    }
+    if (n <= 1) {
+        return;
+    }
+
+    LONG rtlWidth = -1;
+    if (::GetWindowLong(hwnd, GWL_EXSTYLE) & WS_EX_LAYOUTRTL) {
+        RECT rect = {0};
+        ::GetClientRect(hwnd, &rect);
+        rtlWidth = max(0, rect.right - rect.left);
+    }
+
+    jint points[MAX_COALESCED_POINTS * 4];
+    jint *q = points;
+    for (int i = n - 1; i >= 0; i--) {
+        POINT abs = { history[i].x, history[i].y };
+        POINT client = abs;
+        ::ScreenToClient(hwnd, &client);
+        if (rtlWidth >= 0) {
+            client.x = rtlWidth - client.x;
+        }
+        *q++ = client.x;
+        *q++ = client.y;
+        *q++ = abs.x;
+        *q++ = abs.y;
+    }
+
+    jintArray jPoints = env->NewIntArray(n * 4);
+    if (CheckAndClearException(env) || !jPoints) {
+        return;
+    }
+    env->SetIntArrayRegion(jPoints, 0, n * 4, points);
+    env->CallVoidMethod(GetView(), javaIDs.View.notifyCoalescedPoints, jPoints);
+    CheckAndClearException(env);
+    env->DeleteLocalRef(jPoints);
+}
+
 BOOL ViewContainer::HandleViewMouseEvent(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam, BOOL extendedWindow)
 {
     if (!GetGlassView()) {
@@ -720,6 +809,7 @@ BOOL ViewContainer::HandleViewMouseEvent(HWND hwnd, UINT msg, WPARAM wParam, LPA
             type = com_sun_glass_events_MouseEvent_EXIT;
             m_bTrackingMouse = FALSE;
             m_lastMouseMovePosition = -1;
+            m_lastMouseMoveTime = 0;
         } else {
             // If the cursor is still on our window, we need to detect whether it has moved from the client area
             // to the title bar, and suppress the EXIT event in this case.
@@ -738,6 +828,7 @@ BOOL ViewContainer::HandleViewMouseEvent(HWND hwnd, UINT msg, WPARAM wParam, LPA
                 type = com_sun_glass_events_MouseEvent_EXIT;
                 m_bTrackingMouse = FALSE;
                 m_lastMouseMovePosition = -1;
+                m_lastMouseMoveTime = 0;
             } else {
                 // In this branch, we know that the cursor is on the non-client area of our window, and we need
                 // to enable non-client mouse tracking to get a WM_NCMOUSELEAVE message when the cursor leaves
@@ -769,6 +860,8 @@ BOOL ViewContainer::HandleViewMouseEvent(HWND hwnd, UINT msg, WPARAM wParam, LPA
         m_bTrackingMouse = FALSE;
 
         m_lastMouseMovePosition = -1;
+
+        m_lastMouseMoveTime = 0;
     } else {
         // for all other messages lParam contains cursor coords
         pt.x = GET_X_LPARAM(lParam);
@@ -978,6 +1071,12 @@ BOOL ViewContainer::HandleViewMouseEvent(HWND hwnd, UINT msg, WPARAM wParam, LPA
                 pt.x, pt.y, ptAbs.x, ptAbs.y,
                 dx, dy, jModifiers, ls, cs, 3, 3, (jdouble)40.0, (jdouble)40.0);
     } else {
+        if (msg == WM_MOUSEMOVE) {
+            NotifyCoalescedPoints(hwnd, ptAbs);
+            if (!GetGlassView()) {
+                return TRUE;
+            }
+        }
         env->CallVoidMethod(GetView(), javaIDs.View.notifyMouse,
                 type, button, pt.x, pt.y, ptAbs.x, ptAbs.y,
                 jModifiers,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,8 @@ class ViewContainer {
         jclass                              m_gestureSupportCls;
 
         LPARAM m_lastMouseMovePosition; // or -1
+        POINT m_lastMouseMovePoint;     // screen coords
+        DWORD m_lastMouseMoveTime;      // or 0
         unsigned int m_mouseButtonDownCounter;
 
         UINT m_lastTouchInputCount;
@@ -58,6 +60,7 @@ class ViewContainer {
             int cAttrBlock, int* rgAttrBoundary, BYTE *rgAttrValue,
             int commitedTextLength, int caretPos, int visiblePos);
         void GetCandidatePos(LPPOINT curPos);
+        void NotifyCoalescedPoints(HWND hwnd, POINT ptAbs);
 
         void SendViewTypedEvent(int repCount, jchar wChar);
 
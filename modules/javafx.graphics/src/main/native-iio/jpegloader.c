@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -161,6 +161,9 @@ typedef struct streamBufferStruct {
     int bufferLength; // Allocated, nut just used
     int suspendable; // Set to true to suspend input
     long remaining_skip; // Used only on input
+    jobject hdirectBuffer; // Direct ByteBuffer holding the whole stream
+    JOCTET *directBuf; // Address of hdirectBuffer, NULL if reading a stream
+    size_t directLength; // Capacity of hdirectBuffer
 } streamBuffer, *streamBufferPtr;
 
 /*
@@ -205,6 +208,8 @@ static int initStreamBuffer(JNIEnv *env, streamBufferPtr sb) {
 
     sb->buf = NULL;
 
+    sb->hdirectBuffer = NULL;
+
     resetStreamBuffer(env, sb);
 
     return OK;
@@ -238,6 +243,12 @@ static void resetStreamBuffer(JNIEnv *env, streamBufferPtr sb) {
         (*env)->DeleteGlobalRef(env, sb->stream);
         sb->stream = NULL;
     }
+    if (sb->hdirectBuffer != NULL) {
+        (*env)->DeleteGlobalRef(env, sb->hdirectBuffer);
+        sb->hdirectBuffer = NULL;
+    }
+    sb->directBuf = NULL;
+    sb->directLength = 0;
     unpinStreamBuffer(env, sb, NULL);
     sb->bufferOffset = NO_DATA;
     sb->suspendable = FALSE;
@@ -247,11 +258,12 @@ static void resetStreamBuffer(JNIEnv *env, streamBufferPtr sb) {
 /*
  * Pins the data buffer associated with this stream.  Returns OK on
  * success, NOT_OK on failure, as GetPrimitiveArrayCritical may fail.
+ * Nothing needs pinning when reading from a direct buffer.
  */
 static int pinStreamBuffer(JNIEnv *env,
         streamBufferPtr sb,
         const JOCTET **next_byte) {
-    if (sb->hstreamBuffer != NULL) {
+    if (sb->hstreamBuffer != NULL && sb->directBuf == NULL) {
         assert(sb->buf == NULL);
         sb->buf =
                 (JOCTET *) (*env)->GetPrimitiveArrayCritical(env,
@@ -654,6 +666,37 @@ static void imageio_set_stream(JNIEnv *env,
 
 }
 
+/*
+ * Makes the whole compressed stream available from a direct ByteBuffer,
+ * to be used instead of the InputStream.  Returns OK on success, NOT_OK
+ * with an exception pending on failure.
+ */
+static int imageio_set_direct_source(JNIEnv *env,
+        imageIODataPtr data,
+        jobject source) {
+    streamBufferPtr sb = &data->streamBuf;
+    JOCTET *address = (JOCTET *) (*env)->GetDirectBufferAddress(env, source);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, source);
+
+    if (address == NULL || capacity <= 0) {
+        ThrowByName(env,
+                "java/lang/IllegalArgumentException",
+                "Source is not a direct buffer");
+        return NOT_OK;
+    }
+
+    sb->hdirectBuffer = (*env)->NewGlobalRef(env, source);
+    if (sb->hdirectBuffer == NULL) {
+        ThrowByName(env,
+                "java/lang/OutOfMemoryError",
+                "Setting Source");
+        return NOT_OK;
+    }
+    sb->directBuf = address;
+    sb->directLength = (size_t) capacity;
+    return OK;
+}
+
 static void imageio_dispose(j_common_ptr info) {
 
     if (info != NULL) {
@@ -1015,6 +1058,59 @@ imageio_term_source(j_decompress_ptr cinfo) {
     }
 }
 
+/*
+ * Source manager for a stream held entirely in a direct buffer.  All of
+ * the data is handed to the library up front, so there is nothing to
+ * fill or pin and no call back into Java while decoding.  Running out of
+ * data means the EOI marker is missing, which is handled like the stream
+ * case: a warning and a fake EOI.
+ */
+
+static const JOCTET imageio_fake_eoi[2] = { (JOCTET) 0xFF, (JOCTET) JPEG_EOI };
+
+GLOBAL(void)
+imageio_init_direct_source(j_decompress_ptr cinfo) {
+    struct jpeg_source_mgr *src = cinfo->src;
+    imageIODataPtr data = (imageIODataPtr) cinfo->client_data;
+    src->next_input_byte = data->streamBuf.directBuf;
+    src->bytes_in_buffer = data->streamBuf.directLength;
+}
+
+GLOBAL(boolean)
+imageio_fill_direct_buffer(j_decompress_ptr cinfo) {
+    struct jpeg_source_mgr *src = cinfo->src;
+    imageIODataPtr data = (imageIODataPtr) cinfo->client_data;
+    JNIEnv *env = (JNIEnv *) GetEnv(jvm, JNI_VERSION_1_2);
+
+    RELEASE_ARRAYS(env, data, src->next_input_byte);
+    (*env)->CallVoidMethod(env, data->imageIOobj,
+            JPEGImageLoader_emitWarningID,
+            READ_NO_EOI);
+    if ((*env)->ExceptionOccurred(env)
+            || !GET_ARRAYS(env, data, &(src->next_input_byte))) {
+        cinfo->err->error_exit((j_common_ptr) cinfo);
+    }
+
+    src->next_input_byte = imageio_fake_eoi;
+    src->bytes_in_buffer = 2;
+    return TRUE;
+}
+
+GLOBAL(void)
+imageio_skip_direct_data(j_decompress_ptr cinfo, long num_bytes) {
+    struct jpeg_source_mgr *src = cinfo->src;
+
+    if (num_bytes <= 0) {
+        return;
+    }
+    if ((size_t) num_bytes > src->bytes_in_buffer) {
+        imageio_fill_direct_buffer(cinfo);
+        return;
+    }
+    src->next_input_byte += num_bytes;
+    src->bytes_in_buffer -= num_bytes;
+}
+
 /********************* end of source manager ******************/
 
 /********************* ICC profile support ********************/
@@ -1286,7 +1382,7 @@ JNIEXPORT void JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_disposeNativ
     (((c)->marker_list != NULL) && ((c)->marker_list->marker == JPEG_APP1))
 
 JNIEXPORT jlong JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_initDecompressor
-(JNIEnv *env, jobject this, jobject stream) {
+(JNIEnv *env, jobject this, jobject stream, jobject source) {
     imageIODataPtr data;
     struct sun_jpeg_error_mgr *jerr_mgr;
 
@@ -1360,9 +1456,15 @@ JNIEXPORT jlong JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_initDecompr
     }
     cinfo->src->bytes_in_buffer = 0;
     cinfo->src->next_input_byte = NULL;
-    cinfo->src->init_source = imageio_init_source;
-    cinfo->src->fill_input_buffer = imageio_fill_input_buffer;
-    cinfo->src->skip_input_data = imageio_skip_input_data;
+    if (source != NULL) {
+        cinfo->src->init_source = imageio_init_direct_source;
+        cinfo->src->fill_input_buffer = imageio_fill_direct_buffer;
+        cinfo->src->skip_input_data = imageio_skip_direct_data;
+    } else {
+        cinfo->src->init_source = imageio_init_source;
+        cinfo->src->fill_input_buffer = imageio_fill_input_buffer;
+        cinfo->src->skip_input_data = imageio_skip_input_data;
+    }
     cinfo->src->resync_to_restart = jpeg_resync_to_restart; // use default
     cinfo->src->term_source = imageio_term_source;
 
@@ -1383,7 +1485,13 @@ JNIEXPORT jlong JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_initDecompr
         return 0;
     }
 
-    imageio_init_source((j_decompress_ptr) cinfo);
+    if (source != NULL &&
+            imageio_set_direct_source(env, data, source) == NOT_OK) {
+        disposeIIO(env, data);
+        return 0;
+    }
+
+    cinfo->src->init_source((j_decompress_ptr) cinfo);
 
     src = cinfo->src;
     jerr = (sun_jpeg_error_ptr) cinfo->err;
@@ -1564,32 +1672,24 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
     cinfo->out_color_space = outCS;
 
     /* decide how much we want to sub-sample the incoming jpeg image.
-     * The libjpeg docs say:
-     *
-     *     unsigned int scale_num, scale_denom
-     *
-     *     Scale the image by the fraction scale_num/scale_denom.  Default is
-     *     1/1, or no scaling.  Currently, the only supported scaling ratios
-     *     are 1/1, 1/2, 1/4, and 1/8.  (The library design allows for arbitrary
-     *     scaling ratios but this is not likely to be implemented any time soon.)
-     *     Smaller scaling ratios permit significantly faster decoding since
-     *     fewer pixels need be processed and a simpler IDCT method can be used.
+     * The bundled libjpeg (v9) performs the scaling inside the IDCT and
+     * accepts any ratio N/8 with 1 <= N <= 16, not just the 1/2, 1/4 and
+     * 1/8 of older versions. Use the smallest N/8 that still covers the
+     * requested size, so that only a small downscale is left for the
+     * Java side and a thumbnail is never decoded at full resolution.
+     * Smaller scaling ratios permit significantly faster decoding since
+     * fewer pixels need be processed.
      */
 
-    cinfo->scale_num = 1;
-
     x_scale = (jfloat) dest_width / (jfloat) cinfo->image_width;
     y_scale = (jfloat) dest_height / (jfloat) cinfo->image_height;
     max_scale = x_scale > y_scale ? x_scale : y_scale;
 
-    if (max_scale > 0.5) {
-        cinfo->scale_denom = 1;
-    } else if (max_scale > 0.25) {
-        cinfo->scale_denom = 2;
-    } else if (max_scale > 0.125) {
-        cinfo->scale_denom = 4;
-    } else {
-        cinfo->scale_denom = 8;
+    cinfo->scale_denom = 8;
+    cinfo->scale_num = 1;
+    while (cinfo->scale_num < 8 &&
+           (jfloat) cinfo->scale_num / 8.0f < max_scale) {
+        cinfo->scale_num++;
     }
 
     jpeg_start_decompress(cinfo);
@@ -1604,6 +1704,13 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
 }
 
 #define SAFE_TO_MULT(a, b) (((a) > 0) && ((b) >= 0) && ((0x7fffffff / (a)) > (b)))
+
+/*
+ * Scanlines are decoded into a native strip of this many rows, which is
+ * then copied into the Java array with a single pin, rather than pinning
+ * the array and reporting progress once per scanline.
+ */
+#define STRIP_ROWS 16
 #define SAFE_FREE(PTR)  \
     if ((PTR) != NULL) {  \
         free(PTR);     \
@@ -1619,6 +1726,8 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
     int bytes_per_row = cinfo->output_width * cinfo->output_components;
     int offset = 0;
     JSAMPROW scanline_ptr = NULL;
+    JSAMPROW rows[STRIP_ROWS];
+    int i;
 
     if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
         !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
@@ -1655,7 +1764,15 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
-    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * sizeof(JSAMPLE));
+    if (!SAFE_TO_MULT(bytes_per_row, STRIP_ROWS)) {
+        RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
+        ThrowByName(env,
+                "java/lang/OutOfMemoryError",
+                "Reading JPEG Stream");
+        return JNI_FALSE;
+    }
+
+    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * STRIP_ROWS * sizeof(JSAMPLE));
     if (scanline_ptr == NULL) {
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
         ThrowByName(env,
@@ -1664,8 +1781,12 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
+    for (i = 0; i < STRIP_ROWS; i++) {
+        rows[i] = scanline_ptr + i * bytes_per_row;
+    }
+
     while (cinfo->output_scanline < cinfo->output_height) {
-        int num_scanlines;
+        int num_scanlines = 0;
         if (report_progress == JNI_TRUE) {
             RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
             (*env)->CallVoidMethod(env, this,
@@ -1684,8 +1805,19 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
             }
         }
 
-        num_scanlines = jpeg_read_scanlines(cinfo, &scanline_ptr, 1);
-        if (num_scanlines == 1) {
+        /* jpeg_read_scanlines returns at most one row group per call */
+        while (num_scanlines < STRIP_ROWS &&
+               cinfo->output_scanline < cinfo->output_height) {
+            int n = jpeg_read_scanlines(cinfo, rows + num_scanlines,
+                                        STRIP_ROWS - num_scanlines);
+            if (n == 0) {
+                break;
+            }
+            num_scanlines += n;
+        }
+        if (num_scanlines == 0) {
+            break;
+        } else {
             jbyte *body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
             if (body == NULL) {
                 RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
@@ -1693,9 +1825,9 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                 SAFE_FREE(scanline_ptr);
                 return JNI_FALSE;
             }
-            memcpy(body+offset,scanline_ptr, bytes_per_row);
+            memcpy(body+offset,scanline_ptr, bytes_per_row * num_scanlines);
             (*env)->ReleasePrimitiveArrayCritical(env, barray, body, JNI_ABORT);
-            offset += bytes_per_row;
+            offset += bytes_per_row * num_scanlines;
         }
     }
     SAFE_FREE(scanline_ptr);
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <windows.h>
+#include <wincodec.h>
+#include <limits.h>
+
+#include <jni.h>
+#include <com_sun_javafx_iio_wic_WICImageLoader.h>
+
+#define WIC_NATIVE(func) Java_com_sun_javafx_iio_wic_WICImageLoader_##func
+
+template <class T> static void SafeRelease(T **ppT)
+{
+    if (*ppT) {
+        (*ppT)->Release();
+        *ppT = NULL;
+    }
+}
+
+/*
+ * Image loading runs on arbitrary threads. Join the multithreaded
+ * apartment for the duration of a call, unless the thread already
+ * belongs to an apartment, in which case WIC, being free-threaded,
+ * works from there as well.
+ */
+class ComScope {
+public:
+    ComScope() : hr(CoInitializeEx(NULL, COINIT_MULTITHREADED)) {}
+    ~ComScope() {
+        if (SUCCEEDED(hr)) CoUninitialize();
+    }
+private:
+    HRESULT hr;
+};
+
+/*
+ * The first frame of an image held in a direct buffer. The buffer is
+ * read in place, WIC never copies it.
+ */
+class Decoder {
+public:
+    Decoder() : factory(NULL), stream(NULL), decoder(NULL), frame(NULL) {}
+    ~Decoder() {
+        SafeRelease(&frame);
+        SafeRelease(&decoder);
+        SafeRelease(&stream);
+        SafeRelease(&factory);
+    }
+
+    HRESULT Open(JNIEnv *env, jobject source) {
+        BYTE *data = (BYTE *)env->GetDirectBufferAddress(source);
+        jlong length = env->GetDirectBufferCapacity(source);
+        if (data == NULL || length <= 0 || length > MAXDWORD) {
+            return E_INVALIDARG;
+        }
+
+        HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory, NULL,
+                                      CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&factory));
+        if (SUCCEEDED(hr)) {
+            hr = factory->CreateStream(&stream);
+        }
+        if (SUCCEEDED(hr)) {
+            hr = stream->InitializeFromMemory(data, (DWORD)length);
+        }
+        if (SUCCEEDED(hr)) {
+            hr = factory->CreateDecoderFromStream(stream, NULL,
+                                                  WICDecodeMetadataCacheOnDemand,
+                                                  &decoder);
+        }
+        if (SUCCEEDED(hr)) {
+            hr = decoder->GetFrame(0, &frame);
+        }
+        return hr;
+    }
+
+    IWICImagingFactory *factory;
+    IWICStream *stream;
+    IWICBitmapDecoder *decoder;
+    IWICBitmapFrameDecode *frame;
+};
+
+extern "C" {
+
+/*
+ * Class:     com_sun_javafx_iio_wic_WICImageLoader
+ * Method:    readHeader
+ * Signature: (Ljava/nio/ByteBuffer;[I)Z
+ */
+JNIEXPORT jboolean JNICALL WIC_NATIVE(readHeader)
+    (JNIEnv *env, jclass that, jobject source, jintArray size)
+{
+    if (!source || !size || env->GetArrayLength(size) < 2) return JNI_FALSE;
+
+    ComScope com;
+    Decoder d;
+    UINT width = 0, height = 0;
+    HRESULT hr = d.Open(env, source);
+    if (SUCCEEDED(hr)) {
+        hr = d.frame->GetSize(&width, &height);
+    }
+    if (FAILED(hr) || width == 0 || height == 0 ||
+        width > INT_MAX || height > INT_MAX) {
+        return JNI_FALSE;
+    }
+
+    jint result[2] = { (jint)width, (jint)height };
+    env->SetIntArrayRegion(size, 0, 2, result);
+    return env->ExceptionCheck() ? JNI_FALSE : JNI_TRUE;
+}
+
+/*
+ * Decodes the image at the given size into premultiplied BGRA. Scaling
+ * is done by WIC ahead of the format conversion, which lets the JPEG
+ * decoder skip straight to a reduced resolution.
+ *
+ * Class:     com_sun_javafx_iio_wic_WICImageLoader
+ * Method:    decode
+ * Signature: (Ljava/nio/ByteBuffer;IIZ[B)Z
+ */
+JNIEXPORT jboolean JNICALL WIC_NATIVE(decode)
+    (JNIEnv *env, jclass that, jobject source, jint width, jint height,
+     jboolean smooth, jbyteArray pixels)
+{
+    if (!source || !pixels || width <= 0 || height <= 0) return JNI_FALSE;
+    if (width > INT_MAX / 4 / height) return JNI_FALSE;
+    UINT stride = (UINT)width * 4;
+    UINT size = stride * (UINT)height;
+    if ((jsize)size > env->GetArrayLength(pixels)) return JNI_FALSE;
+
+    ComScope com;
+    Decoder d;
+    IWICBitmapScaler *scaler = NULL;
+    IWICFormatConverter *converter = NULL;
+    IWICBitmapSource *bitmap = NULL;
+    UINT srcWidth = 0, srcHeight = 0;
+
+    HRESULT hr = d.Open(env, source);
+    if (SUCCEEDED(hr)) {
+        hr = d.frame->GetSize(&srcWidth, &srcHeight);
+    }
+    if (SUCCEEDED(hr)) {
+        bitmap = d.frame;
+        bitmap->AddRef();
+        if (srcWidth != (UINT)width || srcHeight != (UINT)height) {
+            hr = d.factory->CreateBitmapScaler(&scaler);
+            if (SUCCEEDED(hr)) {
+                WICBitmapInterpolationMode mode = smooth
+                        ? WICBitmapInterpolationModeFant
+                        : WICBitmapInterpolationModeNearestNeighbor;
+                hr = scaler->Initialize(bitmap, width, height, mode);
+            }
+            if (SUCCEEDED(hr)) {
+                SafeRelease(&bitmap);
+                bitmap = scaler;
+                bitmap->AddRef();
+            }
+        }
+    }
+    if (SUCCEEDED(hr)) {
+        hr = d.factory->CreateFormatConverter(&converter);
+    }
+    if (SUCCEEDED(hr)) {
+        hr = converter->Initialize(bitmap, GUID_WICPixelFormat32bppPBGRA,
+                                   WICBitmapDitherTypeNone, NULL, 0.0,
+                                   WICBitmapPaletteTypeCustom);
+    }
+    if (SUCCEEDED(hr)) {
+        BYTE *data = (BYTE *)env->GetPrimitiveArrayCritical(pixels, NULL);
+        if (data) {
+            hr = converter->CopyPixels(NULL, stride, size, data);
+            env->ReleasePrimitiveArrayCritical(pixels, data, 0);
+        } else {
+            hr = E_OUTOFMEMORY;
+        }
+    }
+
+    SafeRelease(&converter);
+    SafeRelease(&bitmap);
+    SafeRelease(&scaler);
+    return SUCCEEDED(hr) ? JNI_TRUE : JNI_FALSE;
+}
+
+} // extern "C"
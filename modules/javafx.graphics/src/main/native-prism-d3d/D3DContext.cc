@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2007, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,10 +69,12 @@ inline void D3DUtils_SetIdentityMatrix(D3DMATRIX *m) {
 
 // static
 HRESULT
-D3DContext::CreateInstance(IDirect3D9Ex *pd3d9, UINT adapter, bool isVsyncEnabled, D3DContext **ppCtx)
+D3DContext::CreateInstance(IDirect3D9Ex *pd3d9, UINT adapter, bool isVsyncEnabled,
+                           UINT maxFrameLatency, D3DContext **ppCtx)
 {
     HRESULT res;
     *ppCtx = new D3DContext(pd3d9, adapter);
+    (*ppCtx)->maxFrameLatency = maxFrameLatency;
     if (FAILED(res = (*ppCtx)->InitContext(isVsyncEnabled))) {
         delete *ppCtx;
         *ppCtx = NULL;
@@ -88,6 +90,7 @@ D3DContext::D3DContext(IDirect3D9Ex *pd3d9, UINT adapter)
     pd3dDevice = NULL;
     adapterOrdinal = adapter;
     defaulResourcePool = D3DPOOL_SYSTEMMEM;
+    maxFrameLatency = 0;
 
     pResourceMgr = NULL;
 
@@ -157,8 +160,7 @@ int D3DContext::release() {
                 pd3dDevice, pd3dObject);
     ReleaseContextResources(RELEASE_ALL);
     for (int i = 0; i < NUM_TEXTURE_CACHE; i++) {
-        SAFE_RELEASE(textureCache[i].surface);
-        SAFE_RELEASE(textureCache[i].texture);
+        textureCache[i].release();
     }
     SAFE_RELEASE(pd3dDevice);
 
@@ -592,15 +594,38 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetDeviceParametersFor
     return pCtx->setDeviceParametersFor3D();
 }
 
-HRESULT D3DContext::setDeviceParametersFor3D() {
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nPrewarm3D
+ */
 
-    RETURN_STATUS_IF_NULL(pd3dDevice, S_FALSE);
+JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nPrewarm3D
+  (JNIEnv *, jclass, jlong ctx)
+{
+    TraceLn(NWT_TRACE_INFO, "D3DContext_nPrewarm3D");
+    D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
+    RETURN_STATUS_IF_NULL(pCtx, S_FALSE);
 
-    HRESULT res = S_OK;
+    return pCtx->createPhongShader();
+}
+
+HRESULT D3DContext::createPhongShader() {
 
+    RETURN_STATUS_IF_NULL(pd3dDevice, S_FALSE);
+
+    // all the shader variants are created at once, the first 3D draw
+    // would otherwise pay for creating them
     if (!phongShader) {
         phongShader = new D3DPhongShader(pd3dDevice);
     }
+    return S_OK;
+}
+
+HRESULT D3DContext::setDeviceParametersFor3D() {
+
+    RETURN_STATUS_IF_NULL(pd3dDevice, S_FALSE);
+
+    HRESULT res = createPhongShader();
 
     // Reset 3D states
     state.wireframe = false;
@@ -628,14 +653,14 @@ HRESULT D3DContext::setDeviceParametersFor3D() {
 
 HRESULT D3DContext::createIndexBuffer() {
     RETURN_STATUS_IF_NULL(pd3dDevice, S_FALSE);
-    HRESULT hr = pd3dDevice->CreateIndexBuffer(sizeof(short) * 6 * MAX_BATCH_QUADS,
+    HRESULT hr = pd3dDevice->CreateIndexBuffer(sizeof(short) * 6 * MAX_RING_QUADS,
         D3DUSAGE_WRITEONLY, D3DFMT_INDEX16, getResourcePool(), &pIndices, 0);
     // fill index buffer
     if (hr == D3D_OK && pIndices) {
-        short* data = 0;
+        unsigned short* data = 0;
         hr = pIndices->Lock(0, 0, (void **)&data, 0);
         if (SUCCEEDED(hr) && data) {
-            for (int i = 0; i < MAX_BATCH_QUADS; i++) {
+            for (int i = 0; i < MAX_RING_QUADS; i++) {
                 int vtx = i * 4;
                 int idx = i * 6;
                 data[idx + 0] = vtx + 0;
@@ -666,6 +691,11 @@ HRESULT D3DContext::InitDevice(IDirect3DDevice9Ex *pd3dDevice)
     RlsTraceLn1(NWT_TRACE_INFO,
                    "D3DContext::InitDevice: device %d", adapterOrdinal);
 
+    // Fewer queued frames means input shows up on screen sooner
+    if (maxFrameLatency > 0) {
+        pd3dDevice->SetMaximumFrameLatency(maxFrameLatency);
+    }
+
     // disable some of the unneeded and costly d3d functionality
     pd3dDevice->SetRenderState(D3DRS_SPECULARENABLE, FALSE);
     pd3dDevice->SetRenderState(D3DRS_LIGHTING,  FALSE);
@@ -1294,7 +1324,7 @@ IDirect3DTexture9 *createTexture(D3DFORMAT format, int w, int h, IDirect3DSurfac
     return texture;
 }
 
-IDirect3DTexture9 *D3DContext::TextureUpdateCache::getTexture(
+IDirect3DTexture9 *D3DContext::TextureUpdateBuffer::getTexture(
     D3DFORMAT format, int w, int h, IDirect3DSurface9 **pSurface, IDirect3DDevice9Ex *dev)
 {
     if (w <= width && h <= height && texture != NULL) {
@@ -1317,6 +1347,32 @@ IDirect3DTexture9 *D3DContext::TextureUpdateCache::getTexture(
     return texture;
 }
 
+void D3DContext::TextureUpdateBuffer::release() {
+    SAFE_RELEASE(surface);
+    SAFE_RELEASE(texture);
+    width = height = 0;
+}
+
+IDirect3DTexture9 *D3DContext::TextureUpdateCache::getTexture(
+    D3DFORMAT format, int w, int h, IDirect3DSurface9 **pSurface, IDirect3DDevice9Ex *dev)
+{
+    // large updates always go through the first buffer so that at most
+    // one large system memory texture is kept per format
+    if (w * h > MAX_TEXTURE_CACHE_BUFFER_PIXELS) {
+        return buffers[0].getTexture(format, w, h, pSurface, dev);
+    }
+    TextureUpdateBuffer &buffer = buffers[next];
+    next = (next + 1) % NUM_TEXTURE_CACHE_BUFFERS;
+    return buffer.getTexture(format, w, h, pSurface, dev);
+}
+
+void D3DContext::TextureUpdateCache::release() {
+    for (int i = 0; i < NUM_TEXTURE_CACHE_BUFFERS; i++) {
+        buffers[i].release();
+    }
+    next = 0;
+}
+
 IDirect3DTexture9 *D3DContext::getTextureCache(int formatIndex, D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface) {
     if (formatIndex < 0 || formatIndex >= NUM_TEXTURE_CACHE) {
         return createTexture(format, width, height, pSurface, pd3dDevice);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2007, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,11 +35,19 @@
 
 //see com.sun.prism.PixelFormat enum
 #define NUM_TEXTURE_CACHE 8
+// number of system memory textures cycled through per pixel format
+#define NUM_TEXTURE_CACHE_BUFFERS 3
+#define MAX_TEXTURE_CACHE_BUFFER_PIXELS (1024*1024)
 
-// allow for 256 quads to match the size of the D3DVertexBuffer's nio buffer
+// allow for 4096 quads to match the size of the D3DContext's VertexBuffer,
+// so a full Java batch is drawn with a single DrawIndexedPrimitive call
+#define MAX_BATCH_QUADS 4096
 
-#define MAX_BATCH_QUADS 256
-#define MAX_VERTICES (MAX_BATCH_QUADS*4)
+// the dynamic vertex buffer holds several batches which are filled with
+// D3DLOCK_NOOVERWRITE before it is discarded; 16384 quads is the most
+// that can be addressed with 16 bit indices
+#define MAX_RING_QUADS (MAX_BATCH_QUADS*4)
+#define MAX_VERTICES (MAX_RING_QUADS*4)
 
 struct PRISM_VERTEX_2D {
     float x, y, z;
@@ -105,7 +113,8 @@ public:
      * to initialize and test the device last time, it doesn't attempt
      * to create/init/test the device.
      */
-    static HRESULT CreateInstance(IDirect3D9Ex *pd3d9, UINT adapter, bool isVsyncEnabled, D3DContext **ppCtx);
+    static HRESULT CreateInstance(IDirect3D9Ex *pd3d9, UINT adapter, bool isVsyncEnabled,
+                                  UINT maxFrameLatency, D3DContext **ppCtx);
 
     // desrtoys this instance
     /* virtual */ int release();
@@ -115,7 +124,7 @@ public:
     HRESULT InitContext(bool isVsyncEnabled);
 
     // resets existing D3D device with the current presentation parameters
-    HRESULT ResetContext();
+    HRESULT ResetContext(bool keepDefaultPool);
 
     HRESULT TestCooperativeLevel();
 
@@ -182,6 +191,7 @@ public:
     HRESULT setDeviceParametersFor2D();
 
     HRESULT setDeviceParametersFor3D();
+    HRESULT createPhongShader();
 
     void setWorldTransformIndentity();
 
@@ -276,6 +286,9 @@ private:
     D3DPRESENT_PARAMETERS   curParams;
     D3DCAPS9                devCaps;
 
+    // number of frames the CPU may queue ahead of the GPU, 0 for the default
+    UINT maxFrameLatency;
+
     /**
      * Used to implement simple primitive batching.
      * See BeginScene/EndScene/ForceEndScene.
@@ -287,11 +300,24 @@ private:
      */
     D3DPhongShader *phongShader;
 
-    struct TextureUpdateCache {
+    struct TextureUpdateBuffer {
         IDirect3DTexture9 *texture;
         IDirect3DSurface9 *surface;
         int width, height;
         IDirect3DTexture9 *getTexture(D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface, IDirect3DDevice9Ex *dev);
+        void release();
+    };
+
+    /**
+     * System memory textures used as the source of UpdateSurface, used in
+     * turn so that locking one does not wait for the GPU to finish copying
+     * from the texture used by the previous update.
+     */
+    struct TextureUpdateCache {
+        TextureUpdateBuffer buffers[NUM_TEXTURE_CACHE_BUFFERS];
+        int next;
+        IDirect3DTexture9 *getTexture(D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface, IDirect3DDevice9Ex *dev);
+        void release();
     } textureCache[NUM_TEXTURE_CACHE];
 
 public:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -83,12 +83,18 @@ HRESULT D3DContext::InitContext(bool isVsyncEnabled) {
     return S_OK;
 }
 
-HRESULT D3DContext::ResetContext() {
-    TraceLn(NWT_TRACE_VERBOSE, "  resetting the device");
+HRESULT D3DContext::ResetContext(bool keepDefaultPool) {
+    TraceLn1(NWT_TRACE_VERBOSE, "  resetting the device, keepDefaultPool=%d", keepDefaultPool);
 
-    ReleaseContextResources(RELEASE_DEFAULT);
+    // A D3D9Ex device keeps its default pool resources across ResetEx, so
+    // they only need to be released when resetting with them in place fails
+    if (keepDefaultPool) {
+        EndScene();
+    } else {
+        ReleaseContextResources(RELEASE_DEFAULT);
+    }
 
-    HRESULT res = pd3dDevice->Reset(&curParams);
+    HRESULT res = pd3dDevice->ResetEx(&curParams, NULL);
 
     FAILED(res)
         ? TraceImpl(NWT_TRACE_INFO, 1, "D3DContext::ResetContext: cound not reset the device: hr=%08X", res)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,8 +51,17 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DSwapChain_nPresent
 
     pCtx->EndScene();
 
+    IDirect3DSwapChain9 *pSwapChain = pSwapChainRes->GetSwapChain();
+    D3DPRESENT_PARAMETERS params;
+    if (SUCCEEDED(pSwapChain->GetPresentParameters(&params)) &&
+        params.SwapEffect == D3DSWAPEFFECT_FLIPEX)
+    {
+        // flip model swap chains present whole buffers and take no rectangles
+        return pSwapChain->Present(0, 0, 0, 0, 0);
+    }
+
     RECT r = { 0, 0, pSwapChainRes->GetDesc()->Width, pSwapChainRes->GetDesc()->Height };
-    return pSwapChainRes->GetSwapChain()->Present(0, &r, 0, 0, 0);
+    return pSwapChain->Present(0, &r, 0, 0, 0);
 }
 
 void setIntField(JNIEnv *env, jobject object, jclass clazz, const char *name, int value);
@@ -223,7 +232,7 @@ HRESULT D3DContext::drawIndexedQuads(PrismSourceVertex const *pSrcFloats, BYTE c
 #endif
 
             res = pd3dDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0,
-                firstIndex, numQuads * 4,
+                firstIndex, vertsInBatch,
                 (firstIndex / 4) * 6, quadsInBatch * 2);
 
             firstIndex += vertsInBatch;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,14 +44,14 @@ IDirect3DPixelShader9 *createPixelShader(IDirect3DDevice9Ex *d, ShaderFunction p
 // Destructor definition
 D3DPhongShader::~D3DPhongShader() {
     // Freeing of native resources
-    vertexShader->Release();
-    pixelShader0->Release();
-    pixelShader0_si->Release();
+    SAFE_RELEASE(vertexShader);
+    SAFE_RELEASE(pixelShader0);
+    SAFE_RELEASE(pixelShader0_si);
     for (int siType = 0; siType != SelfIlllumTotal; ++siType) {
         for (int bType = 0; bType != BumpTotal; ++bType) {
             for (int sType = 0; sType != SpecTotal; ++sType) {
                 for (int i = 0; i != maxLights; ++i) {
-                    pixelShaders[siType][bType][sType][i]->Release();
+                    SAFE_RELEASE(pixelShaders[siType][bType][sType][i]);
                 }
             }
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2007, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,7 @@
  */
 
 #include <stdio.h>
+#include <dxgi1_6.h>
 #include "D3DBadHardware.h"
 #include "D3DPipelineManager.h"
 
@@ -69,7 +70,10 @@ D3DPipelineManager::D3DPipelineManager(IConfig &cfg)
     pd3d9 = NULL;
     pAdapters = NULL;
     adapterCount = 0;
+    preferredAdapter = D3DADAPTER_DEFAULT;
     isVsyncEnabled = cfg.getBool("isVsyncEnabled");
+    int latency = cfg.getInt("d3dMaxFrameLatency");
+    maxFrameLatency = (latency > 0) ? min(latency, 16) : 0;
 
     devType = SelectDeviceType();
 
@@ -156,11 +160,71 @@ HRESULT D3DPipelineManager::InitAdapters(IConfig &cfg)
 
     if (FAILED(res)) {
         SetErrorMessage("Adapter validation failed for all adapters");
+    } else {
+        preferredAdapter = SelectPreferredAdapter(cfg.getInt("gpuPreference"));
     }
 
     return res;
 }
 
+// D3D9 only has the adapters that drive a display, so a GPU without outputs,
+// like the discrete GPU of most hybrid laptops, can not be selected here. The
+// preference still picks between the GPUs of a multi-GPU workstation.
+UINT D3DPipelineManager::SelectPreferredAdapter(int gpuPreference)
+{
+    typedef HRESULT WINAPI FnCreateDXGIFactory1(REFIID riid, void **ppFactory);
+
+    if (gpuPreference == DXGI_GPU_PREFERENCE_UNSPECIFIED) {
+        return D3DADAPTER_DEFAULT;
+    }
+
+    // IDXGIFactory6 needs Windows 10 version 1803
+    HMODULE hLibDXGI = ::LoadLibraryEx(L"dxgi.dll", NULL, LOAD_LIBRARY_SEARCH_SYSTEM32);
+    if (hLibDXGI == NULL) {
+        return D3DADAPTER_DEFAULT;
+    }
+    FnCreateDXGIFactory1 *pCreateFactory =
+        (FnCreateDXGIFactory1 *)::GetProcAddress(hLibDXGI, "CreateDXGIFactory1");
+    IDXGIFactory6 *pFactory = NULL;
+    UINT selected = D3DADAPTER_DEFAULT;
+    bool found = false;
+
+    if (pCreateFactory != NULL &&
+        SUCCEEDED(pCreateFactory(__uuidof(IDXGIFactory6), (void **)&pFactory)))
+    {
+        IDXGIAdapter1 *pDXGIAdapter = NULL;
+        for (UINT i = 0; !found &&
+                SUCCEEDED(pFactory->EnumAdapterByGpuPreference(i,
+                    (DXGI_GPU_PREFERENCE)gpuPreference,
+                    __uuidof(IDXGIAdapter1), (void **)&pDXGIAdapter)); i++)
+        {
+            DXGI_ADAPTER_DESC1 desc;
+            if (SUCCEEDED(pDXGIAdapter->GetDesc1(&desc))) {
+                for (UINT adapter = 0; adapter < adapterCount; adapter++) {
+                    LUID luid;
+                    if (pAdapters[adapter].state != CONTEXT_INIT_FAILED &&
+                        SUCCEEDED(pd3d9->GetAdapterLUID(adapter, &luid)) &&
+                        luid.LowPart == desc.AdapterLuid.LowPart &&
+                        luid.HighPart == desc.AdapterLuid.HighPart)
+                    {
+                        RlsTraceLn2(NWT_TRACE_INFO,
+                            "D3DPPLM::SelectPreferredAdapter: adapter %d (%S)",
+                            adapter, desc.Description);
+                        selected = adapter;
+                        found = true;
+                        break;
+                    }
+                }
+            }
+            pDXGIAdapter->Release();
+        }
+        pFactory->Release();
+    }
+
+    ::FreeLibrary(hLibDXGI);
+    return selected;
+}
+
 // static
 HRESULT
 D3DPipelineManager::CheckOSVersion()
@@ -601,7 +665,8 @@ HRESULT D3DPipelineManager::GetD3DContext(UINT adapterOrdinal,
                         "  initializing context for adapter %d",adapterOrdinal);
 
             if (SUCCEEDED(res = D3DEnabledOnAdapter(adapterOrdinal))) {
-                res = D3DContext::CreateInstance(pd3d9, adapterOrdinal, isVsyncEnabled, &pCtx);
+                res = D3DContext::CreateInstance(pd3d9, adapterOrdinal, isVsyncEnabled,
+                                                 maxFrameLatency, &pCtx);
                 if (FAILED(res)) {
                     RlsTraceLn1(NWT_TRACE_ERROR,
                         "D3DPPLM::GetD3DContext: failed to create context "\
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2007, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -87,6 +87,9 @@ public:
 
     UINT GetAdapterCount() const { return adapterCount; }
 
+    // returns the adapter to create the default context on
+    UINT GetPreferredAdapter() const { return preferredAdapter; }
+
     // returns warning message if warning is true during driver check.
     static char const * GetErrorMessage();
     static void SetErrorMessage(char const *msg);
@@ -114,6 +117,9 @@ private:
     HRESULT D3DEnabledOnAdapter(UINT Adapter);
     HRESULT CheckAdaptersInfo(IConfig &);
     HRESULT CheckDeviceCaps(UINT Adapter);
+    // returns the first usable adapter in the order DXGI ranks the GPUs
+    // for the given DXGI_GPU_PREFERENCE
+    UINT SelectPreferredAdapter(int gpuPreference);
 
 public:
     // Check the OS, succeeds if the OS is XP or newer client-class OS
@@ -133,6 +139,7 @@ private:
 
     // current adapter count
     UINT adapterCount;
+    UINT preferredAdapter;
     // Pointer to Direct3D9 Object mainained by the pipeline manager
     IDirect3D9Ex * pd3d9;
 
@@ -141,6 +148,7 @@ private:
     D3DAdapter *pAdapters;
 
     bool isVsyncEnabled;
+    UINT maxFrameLatency;
 
     // instance of this object
     static D3DPipelineManager* pMgr;
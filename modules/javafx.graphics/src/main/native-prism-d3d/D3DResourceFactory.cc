@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -134,10 +134,10 @@ Java_com_sun_prism_d3d_D3DResourceFactory_nCreateTexture
 /*
  * Class:     com_sun_prism_d3d_D3DResourceFactory
  * Method:    nCreateSwapChain
- * Signature: (JJ)J
+ * Signature: (JJZZ)J
  */
 JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nCreateSwapChain
-  (JNIEnv *jEnv, jclass, jlong ctx, jlong hwnd, jboolean isVsyncEnabled)
+  (JNIEnv *jEnv, jclass, jlong ctx, jlong hwnd, jboolean isVsyncEnabled, jboolean isFlipEx)
 {
     D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
     RETURN_STATUS_IF_NULL(pCtx, 0L);
@@ -148,17 +148,38 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nCreateSwapCha
         return 0L;
     }
 
-    D3DResource *pSwapChainRes = NULL;
-    HRESULT res = pCtx->GetResourceManager()->
-            CreateSwapChain(hWnd, 1,
-            0, 0,
-            // have to use COPY since we don't re-render the scene
-            // if it didn't change
-            D3DSWAPEFFECT_COPY,
-            isVsyncEnabled ?
+    UINT presentationInterval = isVsyncEnabled ?
             D3DPRESENT_INTERVAL_ONE :
-            D3DPRESENT_INTERVAL_IMMEDIATE,
-            &pSwapChainRes);
+            D3DPRESENT_INTERVAL_IMMEDIATE;
+    D3DResource *pSwapChainRes = NULL;
+    HRESULT res = E_FAIL;
+
+    if (isFlipEx) {
+        // The flip model hands the back buffer to DWM instead of copying it.
+        // Its contents are undefined after Present, which is fine since
+        // D3DSwapChain.prepare() redraws the whole back buffer every frame.
+        res = pCtx->GetResourceManager()->
+                CreateSwapChain(hWnd, 2,
+                0, 0,
+                D3DSWAPEFFECT_FLIPEX,
+                presentationInterval,
+                &pSwapChainRes);
+        if (FAILED(res)) {
+            RlsTraceLn1(NWT_TRACE_WARNING,
+                        "nCreateSwapChain: flip model unavailable (hr=%08X), using copy", res);
+        }
+    }
+
+    if (FAILED(res)) {
+        res = pCtx->GetResourceManager()->
+                CreateSwapChain(hWnd, 1,
+                0, 0,
+                // have to use COPY since we don't re-render the scene
+                // if it didn't change
+                D3DSWAPEFFECT_COPY,
+                presentationInterval,
+                &pSwapChainRes);
+    }
 
     if (SUCCEEDED(res)) {
         return ptr_to_jlong(pSwapChainRes);
@@ -552,12 +573,12 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nTestCooperativ
 }
 
 JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nResetDevice
-  (JNIEnv *env, jclass, jlong context)
+  (JNIEnv *env, jclass, jlong context, jboolean keepDefaultPool)
 {
     D3DContext *pCtx = (D3DContext*)jlong_to_ptr(context);
     RETURN_STATUS_IF_NULL(pCtx, E_FAIL);
 
-    return pCtx->ResetContext();
+    return pCtx->ResetContext(keepDefaultPool == JNI_TRUE);
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nGetDevice
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2007, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -305,7 +305,7 @@ D3DResourceManager::CreateVertexBuffer(D3DVertexBufferResource** ppVBRes)
     D3DPOOL pool = (pCtx->GetDeviceCaps()->DeviceType == D3DDEVTYPE_HAL) ?
         D3DPOOL_DEFAULT : D3DPOOL_SYSTEMMEM;
     // usage depends on whether we use hw or sw vertex processing
-    res = pd3dDevice->CreateVertexBuffer(MAX_BATCH_QUADS * 4 * sizeof(PRISM_VERTEX_2D),
+    res = pd3dDevice->CreateVertexBuffer(MAX_VERTICES * sizeof(PRISM_VERTEX_2D),
                                          D3DUSAGE_DYNAMIC|D3DUSAGE_WRITEONLY, 0,
                                          pool, &pVertexBuffer, NULL);
     if (SUCCEEDED(res)) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,13 @@
 #include "D3DPipelineManager.h"
 #include "TextureUploader.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#include <immintrin.h>
+#elif defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
 void TextureUpdater::transferBytes( BYTE const *pSrcPixels, int srcStride, BYTE *pDstPixels, int dstStride, int w, int h) {
     for (int i = 0; i < h; ++i) {
         memcpy(pDstPixels, pSrcPixels, w);
@@ -34,25 +41,182 @@ void TextureUpdater::transferBytes( BYTE const *pSrcPixels, int srcStride, BYTE
     }
 }
 
+/*
+ * Row conversion kernels.
+ *
+ * A8R8G8B8 is stored as B, G, R, A bytes in memory. The vector kernels
+ * convert as many pixels of a row as they can and finish the row with the
+ * scalar kernel; they never read past the last source pixel of the row.
+ */
+
+typedef void (*TransferRowFunc)(BYTE const *pSrcPixels, DWORD *pDstPixels, int w);
+
+static void transferRowA8toA8R8G8B8(BYTE const *pSrcPixels, DWORD *pDstPixels, int w) {
+    for (int x = 0; x < w; x++) {
+        // only need to set the alpha channel
+        pDstPixels[x] = DWORD(pSrcPixels[x]) << 24;
+    }
+}
+
+static void transferRowRGBtoA8R8G8B8(BYTE const *pSrcPixels, DWORD *pDstPixels, int w) {
+    for (int dx = 0, sx = 0; dx < w; dx++, sx+=3) {
+        BYTE r = pSrcPixels[sx+0];
+        BYTE g = pSrcPixels[sx+1];
+        BYTE b = pSrcPixels[sx+2];
+        pDstPixels[dx] = 0xff000000 | (r << 16) | (g << 8) | b;
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64)
+
+static void transferRowA8toA8R8G8B8_SSE2(BYTE const *pSrcPixels, DWORD *pDstPixels, int w) {
+    __m128i const zero = _mm_setzero_si128();
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        __m128i a = _mm_loadu_si128((__m128i const *)(pSrcPixels + x));
+        __m128i lo = _mm_unpacklo_epi8(zero, a);   // a << 8
+        __m128i hi = _mm_unpackhi_epi8(zero, a);
+        __m128i *pDst = (__m128i *)(pDstPixels + x);
+        _mm_storeu_si128(pDst + 0, _mm_unpacklo_epi16(zero, lo));  // a << 24
+        _mm_storeu_si128(pDst + 1, _mm_unpackhi_epi16(zero, lo));
+        _mm_storeu_si128(pDst + 2, _mm_unpacklo_epi16(zero, hi));
+        _mm_storeu_si128(pDst + 3, _mm_unpackhi_epi16(zero, hi));
+    }
+    transferRowA8toA8R8G8B8(pSrcPixels + x, pDstPixels + x, w - x);
+}
+
+static void transferRowA8toA8R8G8B8_AVX2(BYTE const *pSrcPixels, DWORD *pDstPixels, int w) {
+    int x = 0;
+    for (; x + 8 <= w; x += 8) {
+        __m256i a = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const *)(pSrcPixels + x)));
+        _mm256_storeu_si256((__m256i *)(pDstPixels + x), _mm256_slli_epi32(a, 24));
+    }
+    transferRowA8toA8R8G8B8(pSrcPixels + x, pDstPixels + x, w - x);
+}
+
+// swaps R and B of 4 packed RGB pixels and zeroes the alpha byte
+#define RGB_SHUFFLE_MASK 2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1
+
+static void transferRowRGBtoA8R8G8B8_SSSE3(BYTE const *pSrcPixels, DWORD *pDstPixels, int w) {
+    __m128i const mask = _mm_setr_epi8(RGB_SHUFFLE_MASK);
+    __m128i const alpha = _mm_set1_epi32((int)0xff000000);
+    int x = 0;
+    // a 16 byte load covers 4 pixels and 4 bytes of the next 2 pixels
+    for (; x + 6 <= w; x += 4) {
+        __m128i rgb = _mm_loadu_si128((__m128i const *)(pSrcPixels + x * 3));
+        __m128i argb = _mm_or_si128(_mm_shuffle_epi8(rgb, mask), alpha);
+        _mm_storeu_si128((__m128i *)(pDstPixels + x), argb);
+    }
+    transferRowRGBtoA8R8G8B8(pSrcPixels + x * 3, pDstPixels + x, w - x);
+}
+
+static void transferRowRGBtoA8R8G8B8_AVX2(BYTE const *pSrcPixels, DWORD *pDstPixels, int w) {
+    __m256i const mask = _mm256_setr_epi8(RGB_SHUFFLE_MASK, RGB_SHUFFLE_MASK);
+    __m256i const alpha = _mm256_set1_epi32((int)0xff000000);
+    int x = 0;
+    // each lane converts 4 pixels, the upper lane is loaded 12 bytes in
+    for (; x + 10 <= w; x += 8) {
+        BYTE const *pSrc = pSrcPixels + x * 3;
+        __m256i rgb = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((__m128i const *)pSrc)),
+            _mm_loadu_si128((__m128i const *)(pSrc + 12)), 1);
+        __m256i argb = _mm256_or_si256(_mm256_shuffle_epi8(rgb, mask), alpha);
+        _mm256_storeu_si256((__m256i *)(pDstPixels + x), argb);
+    }
+    transferRowRGBtoA8R8G8B8(pSrcPixels + x * 3, pDstPixels + x, w - x);
+}
+
+#undef RGB_SHUFFLE_MASK
+
+#elif defined(_M_ARM64)
+
+static void transferRowA8toA8R8G8B8_NEON(BYTE const *pSrcPixels, DWORD *pDstPixels, int w) {
+    uint8x16x4_t bgra;
+    bgra.val[0] = bgra.val[1] = bgra.val[2] = vdupq_n_u8(0);
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        bgra.val[3] = vld1q_u8(pSrcPixels + x);
+        vst4q_u8((uint8_t *)(pDstPixels + x), bgra);
+    }
+    transferRowA8toA8R8G8B8(pSrcPixels + x, pDstPixels + x, w - x);
+}
+
+static void transferRowRGBtoA8R8G8B8_NEON(BYTE const *pSrcPixels, DWORD *pDstPixels, int w) {
+    uint8x16x4_t bgra;
+    bgra.val[3] = vdupq_n_u8(0xff);
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        uint8x16x3_t rgb = vld3q_u8(pSrcPixels + x * 3);
+        bgra.val[0] = rgb.val[2];
+        bgra.val[1] = rgb.val[1];
+        bgra.val[2] = rgb.val[0];
+        vst4q_u8((uint8_t *)(pDstPixels + x), bgra);
+    }
+    transferRowRGBtoA8R8G8B8(pSrcPixels + x * 3, pDstPixels + x, w - x);
+}
+
+#endif
+
+struct TransferKernels {
+    TransferRowFunc a8toA8R8G8B8;
+    TransferRowFunc rgbToA8R8G8B8;
+};
+
+static TransferKernels selectTransferKernels() {
+    TransferKernels kernels = { transferRowA8toA8R8G8B8, transferRowRGBtoA8R8G8B8 };
+#if defined(_M_IX86) || defined(_M_X64)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    bool ssse3 = (info[2] & (1 << 9)) != 0;
+    // AVX state must also be enabled by the OS
+    bool avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 &&
+        (_xgetbv(0) & 0x6) == 0x6;
+    bool avx2 = false;
+    if (avx && maxLeaf >= 7) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+    if (avx2) {
+        kernels.a8toA8R8G8B8 = transferRowA8toA8R8G8B8_AVX2;
+        kernels.rgbToA8R8G8B8 = transferRowRGBtoA8R8G8B8_AVX2;
+    } else {
+        if (sse2) {
+            kernels.a8toA8R8G8B8 = transferRowA8toA8R8G8B8_SSE2;
+        }
+        if (ssse3) {
+            kernels.rgbToA8R8G8B8 = transferRowRGBtoA8R8G8B8_SSSE3;
+        }
+    }
+    TraceLn3(NWT_TRACE_INFO, "TextureUpdater: SSE2 %d, SSSE3 %d, AVX2 %d", sse2, ssse3, avx2);
+#elif defined(_M_ARM64)
+    // Advanced SIMD is mandatory on ARM64
+    kernels.a8toA8R8G8B8 = transferRowA8toA8R8G8B8_NEON;
+    kernels.rgbToA8R8G8B8 = transferRowRGBtoA8R8G8B8_NEON;
+#endif
+    return kernels;
+}
+
+static TransferKernels const &getTransferKernels() {
+    static TransferKernels const kernels = selectTransferKernels();
+    return kernels;
+}
+
 void TextureUpdater::transferA8toA8R8G8B8( BYTE const *pSrcPixels, int srcStride, DWORD *pDstPixels, int dstStride, int w, int h) {
+    TransferRowFunc transferRow = getTransferKernels().a8toA8R8G8B8;
     for (int y = 0; y < h; y++) {
-        for (int x = 0; x < w; x++) {
-            // only need to set the alpha channel
-            pDstPixels[x] = DWORD(pSrcPixels[x]) << 24;
-        }
+        transferRow(pSrcPixels, pDstPixels, w);
         pSrcPixels += srcStride;
         pDstPixels = PDWORD(PBYTE(pDstPixels) + dstStride);
     }
 }
 
 void TextureUpdater::transferRGBtoA8R8G8B8( BYTE const *pSrcPixels, int srcStride, DWORD *pDstPixels, int dstStride, int w, int h) {
+    TransferRowFunc transferRow = getTransferKernels().rgbToA8R8G8B8;
     for (int y = 0; y < h; y++) {
-        for (int dx = 0, sx = 0; dx < w; dx++, sx+=3) {
-            BYTE r = pSrcPixels[sx+0];
-            BYTE g = pSrcPixels[sx+1];
-            BYTE b = pSrcPixels[sx+2];
-            pDstPixels[dx] = 0xff000000 | (r << 16) | (g << 8) | b;
-        }
+        transferRow(pSrcPixels, pDstPixels, w);
         pSrcPixels += srcStride;
         pDstPixels = PDWORD(PBYTE(pDstPixels) + dstStride);
     }
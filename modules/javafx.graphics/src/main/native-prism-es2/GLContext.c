@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -116,6 +116,184 @@ void deleteCtxInfo(ContextInfo *ctxInfo) {
     memset(ctxInfo, 0, sizeof (ContextInfo));
 }
 
+/*
+ * Texture uploads are streamed through pixel unpack buffers when
+ * glMapBufferRange is available (OpenGL 3.0, GL_ARB_map_buffer_range or
+ * OpenGL ES 3.0). With buffer storage and sync objects the buffers stay
+ * mapped; otherwise they are orphaned and mapped again for every upload.
+ */
+static void initUploadBuffers(ContextInfo *ctxInfo) {
+    jboolean supported = JNI_FALSE;
+    const char *extensions = ctxInfo->glExtensionStr;
+
+    memset(ctxInfo->uploadBuffers, 0, sizeof (ctxInfo->uploadBuffers));
+    ctxInfo->uploadBufferIndex = 0;
+
+    if (ctxInfo->glGenBuffers != NULL && ctxInfo->glDeleteBuffers != NULL
+            && ctxInfo->glBindBuffer != NULL && ctxInfo->glBufferData != NULL
+            && ctxInfo->glMapBufferRange != NULL
+            && ctxInfo->glUnmapBuffer != NULL) {
+#ifdef IS_EGL
+        const char *es = (ctxInfo->versionStr != NULL)
+                ? strstr(ctxInfo->versionStr, "OpenGL ES ") : NULL;
+        supported = (es != NULL) && (atoi(es + strlen("OpenGL ES ")) >= 3);
+#else
+        supported = (ctxInfo->versionNumbers[0] >= 3)
+                || ((extensions != NULL)
+                    && isExtensionSupported(extensions, "GL_ARB_map_buffer_range"));
+#endif
+    }
+    ctxInfo->uploadBuffersSupported = supported;
+    ctxInfo->persistentUploadBuffers = supported
+            && (ctxInfo->glBufferStorage != NULL)
+            && (ctxInfo->glFenceSync != NULL)
+            && (ctxInfo->glClientWaitSync != NULL)
+            && (ctxInfo->glDeleteSync != NULL)
+            && (extensions != NULL)
+            && (isExtensionSupported(extensions, "GL_ARB_buffer_storage")
+                || isExtensionSupported(extensions, "GL_EXT_buffer_storage"));
+
+    // Asynchronous readbacks use the same buffer mapping and need fences
+    memset(ctxInfo->readbackBuffers, 0, sizeof (ctxInfo->readbackBuffers));
+    ctxInfo->readbackSupported = supported
+            && (ctxInfo->glFenceSync != NULL)
+            && (ctxInfo->glClientWaitSync != NULL)
+            && (ctxInfo->glDeleteSync != NULL);
+}
+
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+#endif
+
+/*
+ * GPU frame times are measured with GL_TIME_ELAPSED queries, which are
+ * core in OpenGL 3.3 and otherwise come with GL_ARB_timer_query,
+ * GL_EXT_timer_query or, on OpenGL ES, GL_EXT_disjoint_timer_query.
+ */
+static void initTimerQueries(ContextInfo *ctxInfo) {
+    jboolean supported = JNI_FALSE;
+    const char *extensions = ctxInfo->glExtensionStr;
+
+    memset(ctxInfo->timerQueries, 0, sizeof (ctxInfo->timerQueries));
+    ctxInfo->timerQueryActive = JNI_FALSE;
+    ctxInfo->timerQueryHead = 0;
+    ctxInfo->timerQueryCount = 0;
+
+    if (ctxInfo->glGenQueries != NULL && ctxInfo->glDeleteQueries != NULL
+            && ctxInfo->glBeginQuery != NULL && ctxInfo->glEndQuery != NULL
+            && ctxInfo->glGetQueryObjectuiv != NULL
+            && ctxInfo->glGetQueryObjectui64v != NULL) {
+#ifdef IS_EGL
+        supported = (extensions != NULL)
+                && isExtensionSupported(extensions, "GL_EXT_disjoint_timer_query");
+#else
+        supported = (ctxInfo->versionNumbers[0] > 3)
+                || ((ctxInfo->versionNumbers[0] == 3) && (ctxInfo->versionNumbers[1] >= 3))
+                || ((extensions != NULL)
+                    && (isExtensionSupported(extensions, "GL_ARB_timer_query")
+                        || isExtensionSupported(extensions, "GL_EXT_timer_query")));
+#endif
+    }
+    ctxInfo->timerQuerySupported = supported;
+}
+
+/*
+ * Copies the pixels into the next buffer of the upload ring and updates
+ * the texture from there, so that the caller's memory can be released as
+ * soon as the copy is done. Returns JNI_FALSE if the pixels have to be
+ * uploaded from client memory instead.
+ */
+static jboolean texSubImage2DFromUploadBuffer(ContextInfo *ctxInfo,
+        GLenum target, GLint level, GLint xoffset, GLint yoffset,
+        GLsizei width, GLsizei height, GLenum format, GLenum type,
+        const char *pixels, GLsizeiptr size) {
+    const GLbitfield persistentFlags =
+            GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    UploadBuffer *buf;
+    void *dst;
+
+    if ((ctxInfo == NULL) || !ctxInfo->uploadBuffersSupported
+            || (pixels == NULL) || (size <= 0)) {
+        return JNI_FALSE;
+    }
+
+    buf = &ctxInfo->uploadBuffers[ctxInfo->uploadBufferIndex];
+    ctxInfo->uploadBufferIndex =
+            (ctxInfo->uploadBufferIndex + 1) % NUM_UPLOAD_BUFFERS;
+
+    if (ctxInfo->persistentUploadBuffers) {
+        if (buf->size < size) {
+            // Buffer storage is immutable, replace it with a larger buffer
+            if (buf->fence != NULL) {
+                ctxInfo->glDeleteSync(buf->fence);
+                buf->fence = NULL;
+            }
+            if (buf->id != 0) {
+                ctxInfo->glDeleteBuffers(1, &buf->id);
+                buf->id = 0;
+            }
+            buf->size = 0;
+            buf->mapped = NULL;
+            ctxInfo->glGenBuffers(1, &buf->id);
+            if (buf->id == 0) {
+                return JNI_FALSE;
+            }
+            ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buf->id);
+            ctxInfo->glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, NULL,
+                    persistentFlags);
+            buf->mapped = ctxInfo->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER,
+                    0, size, persistentFlags);
+            if (buf->mapped != NULL) {
+                buf->size = size;
+            }
+        } else {
+            ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buf->id);
+            if (buf->fence != NULL) {
+                // Wait until the GPU is done with the previous upload
+                ctxInfo->glClientWaitSync(buf->fence,
+                        GL_SYNC_FLUSH_COMMANDS_BIT, (GLuint64) 1000000000);
+                ctxInfo->glDeleteSync(buf->fence);
+                buf->fence = NULL;
+            }
+        }
+        dst = buf->mapped;
+    } else {
+        if (buf->id == 0) {
+            ctxInfo->glGenBuffers(1, &buf->id);
+            if (buf->id == 0) {
+                return JNI_FALSE;
+            }
+        }
+        if (buf->size < size) {
+            buf->size = size;
+        }
+        ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buf->id);
+        // Orphan the previous storage so that mapping does not stall
+        ctxInfo->glBufferData(GL_PIXEL_UNPACK_BUFFER, buf->size, NULL,
+                GL_STREAM_DRAW);
+        dst = ctxInfo->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    }
+
+    if (dst == NULL) {
+        ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return JNI_FALSE;
+    }
+    memcpy(dst, pixels, (size_t) size);
+    if (!ctxInfo->persistentUploadBuffers) {
+        ctxInfo->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    glTexSubImage2D(target, level, xoffset, yoffset, width, height,
+            format, type, (GLvoid *) 0);
+
+    if (ctxInfo->persistentUploadBuffers) {
+        buf->fence = ctxInfo->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return JNI_TRUE;
+}
+
 void initState(ContextInfo *ctxInfo) {
     if (ctxInfo == NULL) {
         return;
@@ -123,6 +301,8 @@ void initState(ContextInfo *ctxInfo) {
 
     glEnable(GL_BLEND);
     glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    ctxInfo->state.blendSrcFactor = GL_ONE;
+    ctxInfo->state.blendDstFactor = GL_ONE_MINUS_SRC_ALPHA;
 
     // initialize states and properties to
     // match cached states and properties
@@ -151,6 +331,15 @@ void initState(ContextInfo *ctxInfo) {
     ctxInfo->state.cullEnable = JNI_FALSE;
     ctxInfo->state.cullMode = GL_BACK;
     ctxInfo->state.fbo = 0;
+    // unknown until the first scissorTest call
+    ctxInfo->state.scissorBox[0] = ctxInfo->state.scissorBox[1] = -1;
+    ctxInfo->state.scissorBox[2] = ctxInfo->state.scissorBox[3] = -1;
+
+    initUploadBuffers(ctxInfo);
+    initTimerQueries(ctxInfo);
+
+    ctxInfo->instanceBufferID = 0;
+    ctxInfo->instanceBufferCapacity = 0;
 }
 
 void clearBuffers(ContextInfo *ctxInfo,
@@ -607,6 +796,112 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgram
     return shaderProgram;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nIsProgramBinarySupported
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nIsProgramBinarySupported
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    GLint numFormats = 0;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glGetProgramBinary == NULL)
+            || (ctxInfo->glProgramBinary == NULL)) {
+        return JNI_FALSE;
+    }
+
+    // Drivers may expose the entry points but support no binary formats
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    return numFormats > 0 ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetProgramBinary
+ * Signature: (JI[I)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_sun_prism_es2_GLContext_nGetProgramBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint programID,
+        jintArray formatArr) {
+    GLint length = 0;
+    GLsizei written = 0;
+    GLenum format = 0;
+    jbyteArray binaryArr;
+    jbyte *binary;
+    jint formatValue;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (formatArr == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)
+            || (ctxInfo->glGetProgramBinary == NULL)) {
+        return NULL;
+    }
+
+    ctxInfo->glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return NULL;
+    }
+
+    binaryArr = (*env)->NewByteArray(env, length);
+    if (binaryArr == NULL) {
+        return NULL;
+    }
+    binary = (*env)->GetPrimitiveArrayCritical(env, binaryArr, NULL);
+    if (binary == NULL) {
+        return NULL;
+    }
+    ctxInfo->glGetProgramBinary(programID, length, &written, &format, binary);
+    (*env)->ReleasePrimitiveArrayCritical(env, binaryArr, binary, 0);
+
+    if (glGetError() != GL_NO_ERROR || written != length) {
+        return NULL;
+    }
+
+    formatValue = (jint) format;
+    (*env)->SetIntArrayRegion(env, formatArr, 0, 1, &formatValue);
+    return binaryArr;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCreateProgramFromBinary
+ * Signature: (JI[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgramFromBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint format,
+        jbyteArray binaryArr) {
+    GLuint shaderProgram;
+    GLint success = GL_FALSE;
+    jsize length;
+    jbyte *binary;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (binaryArr == NULL)
+            || (ctxInfo->glCreateProgram == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)
+            || (ctxInfo->glDeleteProgram == NULL)
+            || (ctxInfo->glProgramBinary == NULL)) {
+        return 0;
+    }
+
+    length = (*env)->GetArrayLength(env, binaryArr);
+    binary = (*env)->GetPrimitiveArrayCritical(env, binaryArr, NULL);
+    if (binary == NULL) {
+        return 0;
+    }
+    shaderProgram = ctxInfo->glCreateProgram();
+    ctxInfo->glProgramBinary(shaderProgram, (GLenum) format, binary, length);
+    (*env)->ReleasePrimitiveArrayCritical(env, binaryArr, binary, JNI_ABORT);
+
+    // A binary from another driver version is rejected at this point and
+    // leaves the program unlinked; the caller then compiles from source
+    ctxInfo->glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (glGetError() != GL_NO_ERROR || success == GL_FALSE) {
+        ctxInfo->glDeleteProgram(shaderProgram);
+        return 0;
+    }
+
+    return shaderProgram;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCompileShader
@@ -1079,6 +1374,230 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nReadPixelsInt
     return doReadPixels(env, nativeCtxInfo, length, buffer, pixelArr, x, y, w, h);
 }
 
+/*
+ * Takes an idle pixel pack buffer of at least the given size from the
+ * readback pool, or returns 0 if a new buffer has to be allocated.
+ */
+static GLuint acquireReadbackBuffer(ContextInfo *ctxInfo, GLsizeiptr size,
+        GLsizeiptr *bufSize) {
+    int i;
+    for (i = 0; i < NUM_READBACK_BUFFERS; i++) {
+        UploadBuffer *buf = &ctxInfo->readbackBuffers[i];
+        if (buf->id != 0 && buf->size >= size) {
+            GLuint id = buf->id;
+            *bufSize = buf->size;
+            buf->id = 0;
+            buf->size = 0;
+            return id;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Returns a pixel pack buffer to the readback pool, replacing the smallest
+ * idle buffer if the pool is full.
+ */
+static void releaseReadbackBuffer(ContextInfo *ctxInfo, GLuint id,
+        GLsizeiptr size) {
+    UploadBuffer *victim = NULL;
+    int i;
+    for (i = 0; i < NUM_READBACK_BUFFERS; i++) {
+        UploadBuffer *buf = &ctxInfo->readbackBuffers[i];
+        if (buf->id == 0) {
+            victim = buf;
+            break;
+        }
+        if (victim == NULL || buf->size < victim->size) {
+            victim = buf;
+        }
+    }
+    if (victim->id != 0) {
+        if (victim->size >= size) {
+            ctxInfo->glDeleteBuffers(1, &id);
+            return;
+        }
+        ctxInfo->glDeleteBuffers(1, &victim->id);
+    }
+    victim->id = id;
+    victim->size = size;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nStartReadPixels
+ * Signature: (JIIII)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nStartReadPixels
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint x, jint y,
+        jint width, jint height) {
+    PixelReadback *readback;
+    GLsizeiptr size;
+    GLsizeiptr bufSize = 0;
+    GLuint id;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || !ctxInfo->readbackSupported
+            || (width <= 0) || (height <= 0)) {
+        return 0;
+    }
+
+    size = (GLsizeiptr) width * height * 4;
+    readback = (PixelReadback *) malloc(sizeof (PixelReadback));
+    if (readback == NULL) {
+        return 0;
+    }
+
+    id = acquireReadbackBuffer(ctxInfo, size, &bufSize);
+    if (id == 0) {
+        ctxInfo->glGenBuffers(1, &id);
+        if (id == 0) {
+            free(readback);
+            return 0;
+        }
+        ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+        ctxInfo->glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        bufSize = size;
+    } else {
+        ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    }
+
+    // The copy into the pack buffer is queued; it does not wait for the GPU
+    if (ctxInfo->gl2) {
+        glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
+                GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, (GLvoid *) 0);
+    } else {
+        glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
+                GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid *) 0);
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    readback->id = id;
+    readback->size = bufSize;
+    readback->width = width;
+    readback->height = height;
+    readback->fence = ctxInfo->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    // Make sure the fence is submitted even if nothing else is drawn
+    glFlush();
+    return ptr_to_jlong(readback);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nIsReadPixelsDone
+ * Signature: (JJ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nIsReadPixelsDone
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeReadback) {
+    GLenum status;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    PixelReadback *readback = (PixelReadback *) jlong_to_ptr(nativeReadback);
+    if ((ctxInfo == NULL) || (readback == NULL)) {
+        return JNI_TRUE;
+    }
+    if (readback->fence == NULL) {
+        return JNI_TRUE;
+    }
+    status = ctxInfo->glClientWaitSync(readback->fence, 0, (GLuint64) 0);
+    return (status == GL_ALREADY_SIGNALED) || (status == GL_CONDITION_SATISFIED);
+}
+
+/*
+ * Copies the pixels of a readback into the given buffer, waiting for the
+ * GPU if they are not there yet, and releases the readback. The readback
+ * is only released if both the buffer and the array are NULL.
+ */
+static jboolean doFinishReadPixels(JNIEnv *env, jlong nativeCtxInfo,
+        jlong nativeReadback, jint length, jobject buffer, jarray pixelArr) {
+    jboolean result = JNI_FALSE;
+    GLvoid *ptr = NULL;
+    GLsizeiptr size;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    PixelReadback *readback = (PixelReadback *) jlong_to_ptr(nativeReadback);
+    if ((ctxInfo == NULL) || (readback == NULL)) {
+        return JNI_FALSE;
+    }
+
+    if (readback->fence != NULL) {
+        if (buffer != NULL || pixelArr != NULL) {
+            ctxInfo->glClientWaitSync(readback->fence,
+                    GL_SYNC_FLUSH_COMMANDS_BIT, (GLuint64) 1000000000);
+        }
+        ctxInfo->glDeleteSync(readback->fence);
+        readback->fence = NULL;
+    }
+
+    size = (GLsizeiptr) readback->width * readback->height * 4;
+    if (buffer == NULL && pixelArr == NULL) {
+        result = JNI_TRUE;
+    } else if ((length / 4 / readback->width) < readback->height) {
+        fprintf(stderr, "doFinishReadPixels: pixel buffer too small - length = %d\n",
+                (int) length);
+    } else {
+        ptr = (GLvoid *) (pixelArr ?
+                ((char *) (*env)->GetPrimitiveArrayCritical(env, pixelArr, NULL)) :
+                ((char *) (*env)->GetDirectBufferAddress(env, buffer)));
+    }
+
+    if (ptr != NULL) {
+        GLubyte *src;
+        ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->id);
+        src = (GLubyte *) ctxInfo->glMapBufferRange(GL_PIXEL_PACK_BUFFER,
+                0, size, GL_MAP_READ_BIT);
+        if (src != NULL) {
+            if (ctxInfo->gl2) {
+                memcpy(ptr, src, (size_t) size);
+            } else {
+                jint i;
+                GLubyte *c = (GLubyte *) ptr;
+                for (i = 0; i < readback->width * readback->height; i++) {
+                    c[0] = src[2];
+                    c[1] = src[1];
+                    c[2] = src[0];
+                    c[3] = src[3];
+                    c += 4;
+                    src += 4;
+                }
+            }
+            ctxInfo->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            result = JNI_TRUE;
+        }
+        ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        if (pixelArr != NULL) {
+            (*env)->ReleasePrimitiveArrayCritical(env, pixelArr, ptr, 0);
+        }
+    }
+
+    releaseReadbackBuffer(ctxInfo, readback->id, readback->size);
+    free(readback);
+    return result;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nFinishReadPixelsByte
+ * Signature: (JJILjava/nio/Buffer;[B)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nFinishReadPixelsByte
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeReadback,
+        jint length, jobject buffer, jbyteArray pixelArr) {
+    return doFinishReadPixels(env, nativeCtxInfo, nativeReadback, length,
+            buffer, pixelArr);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nFinishReadPixelsInt
+ * Signature: (JJILjava/nio/Buffer;[I)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nFinishReadPixelsInt
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeReadback,
+        jint length, jobject buffer, jintArray pixelArr) {
+    return doFinishReadPixels(env, nativeCtxInfo, nativeReadback, length,
+            buffer, pixelArr);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nScissorTest
@@ -1098,6 +1617,10 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nScissorTest
             ctxInfo->state.scissorEnabled = JNI_TRUE;
         }
         glScissor(x, y, w, h);
+        ctxInfo->state.scissorBox[0] = x;
+        ctxInfo->state.scissorBox[1] = y;
+        ctxInfo->state.scissorBox[2] = w;
+        ctxInfo->state.scissorBox[3] = h;
     } else if (ctxInfo->state.scissorEnabled) {
         glDisable(GL_SCISSOR_TEST);
         ctxInfo->state.scissorEnabled = JNI_FALSE;
@@ -1198,49 +1721,72 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nTexImage2D1
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nTexSubImage2D0
- * Signature: (IIIIIIIILjava/lang/Object;I)V
+ * Signature: (JIIIIIIIILjava/lang/Object;II)Z
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D0
-(JNIEnv *env, jclass class, jint target, jint level,
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D0
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint target, jint level,
         jint xoffset, jint yoffset, jint width, jint height, jint format,
-        jint type, jobject pixels, jint pixelsByteOffset) {
+        jint type, jobject pixels, jint pixelsByteOffset, jint pixelsByteCount) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     GLvoid *ptr = NULL;
     if (pixels != NULL) {
         ptr = (GLvoid *) (((char *) (*env)->GetDirectBufferAddress(env, pixels))
                 + pixelsByteOffset);
     }
+    if (texSubImage2DFromUploadBuffer(ctxInfo,
+            (GLenum) translatePrismToGL(target), (GLint) level,
+            (GLint) xoffset, (GLint) yoffset,
+            (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
+            (GLenum) translatePrismToGL(type), (const char *) ptr,
+            (GLsizeiptr) pixelsByteCount)) {
+        return JNI_TRUE;
+    }
     glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
             (GLint) xoffset, (GLint) yoffset,
             (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
             (GLenum) translatePrismToGL(type), (GLvoid *) ptr);
+    return JNI_FALSE;
 }
 
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nTexSubImage2D1
- * Signature: (IIIIIIIILjava/lang/Object;I)V
+ * Signature: (JIIIIIIIILjava/lang/Object;II)Z
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D1
-(JNIEnv *env, jclass class, jint target, jint level,
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D1
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint target, jint level,
         jint xoffset, jint yoffset, jint width, jint height, jint format,
-        jint type, jobject pixels, jint pixelsByteOffset) {
+        jint type, jobject pixels, jint pixelsByteOffset, jint pixelsByteCount) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     char *ptr = NULL;
     char *ptrPlusOffset = NULL;
+    jboolean streamed;
     if (pixels != NULL) {
         ptr = (char *) (*env)->GetPrimitiveArrayCritical(env, pixels, NULL);
         if (ptr == NULL) {
             fprintf(stderr, "nTexSubImage2D1: GetPrimitiveArrayCritical returns NULL: out of memory\n");
-            return;
+            return JNI_FALSE;
         }
         ptrPlusOffset = ptr + pixelsByteOffset;
     }
-    glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
+    // When the pixels go through an upload buffer the array is only held
+    // for the copy, not for the upload itself
+    streamed = texSubImage2DFromUploadBuffer(ctxInfo,
+            (GLenum) translatePrismToGL(target), (GLint) level,
             (GLint) xoffset, (GLint) yoffset,
             (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
-            (GLenum) translatePrismToGL(type), (GLvoid *) ptrPlusOffset);
+            (GLenum) translatePrismToGL(type), ptrPlusOffset,
+            (GLsizeiptr) pixelsByteCount);
+    if (!streamed) {
+        glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
+                (GLint) xoffset, (GLint) yoffset,
+                (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
+                (GLenum) translatePrismToGL(type), (GLvoid *) ptrPlusOffset);
+    }
     if (pixels != NULL) {
-        (*env)->ReleasePrimitiveArrayCritical(env, pixels, ptr, 0);
+        (*env)->ReleasePrimitiveArrayCritical(env, pixels, ptr, JNI_ABORT);
     }
+    return streamed;
 }
 
 /*
@@ -1546,18 +2092,30 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniformMatrix4fv
     if (_ptr) (*env)->ReleasePrimitiveArrayCritical(env, values, _ptr, JNI_ABORT);
 }
 
+/*
+ * Sets the filters of the bound texture. A texture with a mip chain keeps
+ * sampling it when minified.
+ */
+static void setFilterState(jboolean linear, jboolean useMipmap) {
+    GLint minFilter;
+    if (useMipmap) {
+        minFilter = linear ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+    } else {
+        minFilter = linear ? GL_LINEAR : GL_NEAREST;
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, linear ? GL_LINEAR : GL_NEAREST);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nUpdateFilterState
- * Signature: (JIZ)V
+ * Signature: (JIZZ)V
  */
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUpdateFilterState
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID, jboolean linearFiler) {
-    int glFilter;
-
-    glFilter = linearFiler ? GL_LINEAR : GL_NEAREST;
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, glFilter);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, glFilter);
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID, jboolean linearFiler,
+        jboolean useMipmap) {
+    setFilterState(linearFiler, useMipmap);
 }
 
 /*
@@ -1587,6 +2145,134 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUseProgram
     ctxInfo->glUseProgram(pID);
 }
 
+static void batchScissorTest(ContextInfo *ctxInfo, jboolean enable,
+        GLint x, GLint y, GLsizei w, GLsizei h) {
+    GLint *box = ctxInfo->state.scissorBox;
+    if (enable) {
+        if (!ctxInfo->state.scissorEnabled) {
+            glEnable(GL_SCISSOR_TEST);
+            ctxInfo->state.scissorEnabled = JNI_TRUE;
+        }
+        if (box[0] != x || box[1] != y || box[2] != w || box[3] != h) {
+            glScissor(x, y, w, h);
+            box[0] = x;
+            box[1] = y;
+            box[2] = w;
+            box[3] = h;
+        }
+    } else if (ctxInfo->state.scissorEnabled) {
+        glDisable(GL_SCISSOR_TEST);
+        ctxInfo->state.scissorEnabled = JNI_FALSE;
+    }
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nExecuteBatch
+ * Signature: (JLjava/nio/ByteBuffer;I)V
+ *
+ * Executes the state changes and uniform updates recorded by GLContext.java.
+ * The batch is a sequence of 32-bit words: an opcode followed by its int or
+ * float arguments. Blend function and scissor box changes that match the
+ * cached state are skipped.
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nExecuteBatch
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jobject batch, jint numWords) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    jint *words;
+    jint i = 0;
+    if ((ctxInfo == NULL) || (batch == NULL)) {
+        return;
+    }
+    words = (jint *) (*env)->GetDirectBufferAddress(env, batch);
+    if (words == NULL) {
+        return;
+    }
+
+#define BATCH_INT(n) (words[i + (n)])
+#define BATCH_FLOAT(n) (*((jfloat *) &words[i + (n)]))
+    while (i < numWords) {
+        switch (words[i++]) {
+            case com_sun_prism_es2_GLContext_BATCH_ACTIVE_TEXTURE:
+                ctxInfo->glActiveTexture(GL_TEXTURE0 + BATCH_INT(0));
+                i += 1;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_BIND_TEXTURE:
+                glBindTexture(GL_TEXTURE_2D, (GLuint) BATCH_INT(0));
+                i += 1;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_BLEND_FUNC: {
+                GLenum src = translateScaleFactor(BATCH_INT(0));
+                GLenum dst = translateScaleFactor(BATCH_INT(1));
+                if (src != ctxInfo->state.blendSrcFactor
+                        || dst != ctxInfo->state.blendDstFactor) {
+                    glBlendFunc(src, dst);
+                    ctxInfo->state.blendSrcFactor = src;
+                    ctxInfo->state.blendDstFactor = dst;
+                }
+                i += 2;
+                break;
+            }
+            case com_sun_prism_es2_GLContext_BATCH_SCISSOR_TEST:
+                batchScissorTest(ctxInfo, (jboolean) BATCH_INT(0),
+                        BATCH_INT(1), BATCH_INT(2), BATCH_INT(3), BATCH_INT(4));
+                i += 5;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_USE_PROGRAM:
+                ctxInfo->glUseProgram((GLuint) BATCH_INT(0));
+                i += 1;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_FILTER_STATE: {
+                // The texture is bound by a preceding BIND_TEXTURE
+                setFilterState(BATCH_INT(1) & 1, BATCH_INT(1) & 2);
+                i += 2;
+                break;
+            }
+            case com_sun_prism_es2_GLContext_BATCH_UNIFORM1F:
+                ctxInfo->glUniform1f(BATCH_INT(0), BATCH_FLOAT(1));
+                i += 2;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_UNIFORM2F:
+                ctxInfo->glUniform2f(BATCH_INT(0), BATCH_FLOAT(1), BATCH_FLOAT(2));
+                i += 3;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_UNIFORM3F:
+                ctxInfo->glUniform3f(BATCH_INT(0), BATCH_FLOAT(1), BATCH_FLOAT(2),
+                        BATCH_FLOAT(3));
+                i += 4;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_UNIFORM4F:
+                ctxInfo->glUniform4f(BATCH_INT(0), BATCH_FLOAT(1), BATCH_FLOAT(2),
+                        BATCH_FLOAT(3), BATCH_FLOAT(4));
+                i += 5;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_UNIFORM1I:
+                ctxInfo->glUniform1i(BATCH_INT(0), BATCH_INT(1));
+                i += 2;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_UNIFORM2I:
+                ctxInfo->glUniform2i(BATCH_INT(0), BATCH_INT(1), BATCH_INT(2));
+                i += 3;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_UNIFORM3I:
+                ctxInfo->glUniform3i(BATCH_INT(0), BATCH_INT(1), BATCH_INT(2),
+                        BATCH_INT(3));
+                i += 4;
+                break;
+            case com_sun_prism_es2_GLContext_BATCH_UNIFORM4I:
+                ctxInfo->glUniform4i(BATCH_INT(0), BATCH_INT(1), BATCH_INT(2),
+                        BATCH_INT(3), BATCH_INT(4));
+                i += 5;
+                break;
+            default:
+                fprintf(stderr, "nExecuteBatch: unknown opcode %d\n", words[i - 1]);
+                return;
+        }
+    }
+#undef BATCH_INT
+#undef BATCH_FLOAT
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nDisableVertexAttributes
@@ -1746,6 +2432,8 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDeviceParametersFor2
 
     glEnable(GL_BLEND);
     glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    ctxInfo->state.blendSrcFactor = GL_ONE;
+    ctxInfo->state.blendDstFactor = GL_ONE_MINUS_SRC_ALPHA;
 
     if (ctxInfo->state.scissorEnabled) {
         ctxInfo->state.scissorEnabled = JNI_FALSE;
@@ -1780,6 +2468,8 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDeviceParametersFor3
     // Will need to evaluate when support proper 3D blending (alpha,1-alpha).
     glEnable(GL_BLEND);
     glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    ctxInfo->state.blendSrcFactor = GL_ONE;
+    ctxInfo->state.blendDstFactor = GL_ONE_MINUS_SRC_ALPHA;
 
     if (ctxInfo->state.scissorEnabled) {
         ctxInfo->state.scissorEnabled = JNI_FALSE;
@@ -1824,6 +2514,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nCreateES2Mesh
     meshInfo->vboIDArray[MESH_INDEXBUFFER] = 0;
     meshInfo->indexBufferSize = 0;
     meshInfo->indexBufferType = 0;
+    meshInfo->vboCapacity[MESH_VERTEXBUFFER] = 0;
+    meshInfo->vboCapacity[MESH_INDEXBUFFER] = 0;
+    meshInfo->indexBufferHash = 0;
+    meshInfo->dynamic = JNI_FALSE;
 
     /* create vbo ids */
     ctxInfo->glGenBuffers(MESH_MAX_BUFFERS, (meshInfo->vboIDArray));
@@ -1852,6 +2546,76 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nReleaseES2Mesh
     free(meshInfo);
 }
 
+/*
+ * Uploads data into one of the buffer objects of a mesh. The first upload
+ * creates a static buffer. A mesh whose geometry is rebuilt afterwards is
+ * treated as animated: its buffers are orphaned before each upload so the
+ * driver hands out fresh storage instead of waiting for draws still in
+ * flight to finish with the old contents.
+ */
+static void uploadMeshBuffer(ContextInfo *ctxInfo, MeshInfo *meshInfo,
+        int buffer, GLenum target, const void *data, GLsizeiptr size)
+{
+    ctxInfo->glBindBuffer(target, meshInfo->vboIDArray[buffer]);
+    if (!meshInfo->dynamic || (ctxInfo->glBufferSubData == NULL)) {
+        ctxInfo->glBufferData(target, size, data, GL_STATIC_DRAW);
+        meshInfo->vboCapacity[buffer] = size;
+    } else if (size > meshInfo->vboCapacity[buffer]) {
+        ctxInfo->glBufferData(target, size, data, GL_DYNAMIC_DRAW);
+        meshInfo->vboCapacity[buffer] = size;
+    } else {
+        ctxInfo->glBufferData(target, meshInfo->vboCapacity[buffer], NULL,
+                GL_DYNAMIC_DRAW);
+        ctxInfo->glBufferSubData(target, 0, size, data);
+    }
+}
+
+static GLuint hashIndexBuffer(const GLubyte *data, GLsizeiptr size)
+{
+    // FNV-1a
+    GLuint hash = 2166136261u;
+    GLsizeiptr i;
+    for (i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void uploadMeshGeometry(ContextInfo *ctxInfo, MeshInfo *meshInfo,
+        GLfloat *vertexBuffer, GLuint vbSize,
+        void *indexBuffer, GLuint ibSize, GLenum indexType)
+{
+    GLsizeiptr ibBytes = ibSize * (indexType == GL_UNSIGNED_INT
+            ? sizeof (GLuint) : sizeof (GLushort));
+    GLuint indexHash;
+
+    // Geometry that is built again after the first time is animated
+    if (meshInfo->vboCapacity[MESH_VERTEXBUFFER] != 0) {
+        meshInfo->dynamic = JNI_TRUE;
+    }
+
+    // Initialize vertex buffer
+    uploadMeshBuffer(ctxInfo, meshInfo, MESH_VERTEXBUFFER, GL_ARRAY_BUFFER,
+            vertexBuffer, vbSize * sizeof (GLfloat));
+
+    // Initialize index buffer, unless the faces are unchanged which is the
+    // common case for meshes whose points are animated
+    indexHash = hashIndexBuffer((const GLubyte *) indexBuffer, ibBytes);
+    if (!meshInfo->dynamic || meshInfo->indexBufferType != indexType
+            || meshInfo->indexBufferSize != ibSize
+            || meshInfo->indexBufferHash != indexHash) {
+        uploadMeshBuffer(ctxInfo, meshInfo, MESH_INDEXBUFFER,
+                GL_ELEMENT_ARRAY_BUFFER, indexBuffer, ibBytes);
+    }
+    meshInfo->indexBufferSize = ibSize;
+    meshInfo->indexBufferType = indexType;
+    meshInfo->indexBufferHash = indexHash;
+
+    // Unbind VBOs
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+    ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nBuildNativeGeometryShort
@@ -1894,21 +2658,8 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     }
 
     if (status) {
-        // Initialize vertex buffer
-        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
-        ctxInfo->glBufferData(GL_ARRAY_BUFFER, uvbSize * sizeof (GLfloat),
-                vertexBuffer, GL_STATIC_DRAW);
-
-        // Initialize index buffer
-        ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
-        ctxInfo->glBufferData(GL_ELEMENT_ARRAY_BUFFER, uibSize * sizeof (GLushort),
-                indexBuffer, GL_STATIC_DRAW);
-        meshInfo->indexBufferSize = uibSize;
-        meshInfo->indexBufferType = GL_UNSIGNED_SHORT;
-
-        // Unbind VBOs
-        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
-        ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        uploadMeshGeometry(ctxInfo, meshInfo, vertexBuffer, uvbSize,
+                indexBuffer, uibSize, GL_UNSIGNED_SHORT);
     }
 
     if (indexBuffer) {
@@ -1963,21 +2714,8 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     }
 
     if (status) {
-        // Initialize vertex buffer
-        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
-        ctxInfo->glBufferData(GL_ARRAY_BUFFER, uvbSize * sizeof (GLfloat),
-                vertexBuffer, GL_STATIC_DRAW);
-
-        // Initialize index buffer
-        ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
-        ctxInfo->glBufferData(GL_ELEMENT_ARRAY_BUFFER, uibSize * sizeof (GLuint),
-                indexBuffer, GL_STATIC_DRAW);
-        meshInfo->indexBufferSize = uibSize;
-        meshInfo->indexBufferType = GL_UNSIGNED_INT;
-
-        // Unbind VBOs
-        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
-        ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        uploadMeshGeometry(ctxInfo, meshInfo, vertexBuffer, uvbSize,
+                indexBuffer, uibSize, GL_UNSIGNED_INT);
     }
 
     if (indexBuffer) {
@@ -1990,6 +2728,50 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     return status;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nUpdateNativeGeometry
+ * Signature: (JJ[FII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nUpdateNativeGeometry
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshInfo,
+        jfloatArray vbArray, jint from, jint to)
+{
+    GLuint vertexBufferSize;
+    GLfloat *vertexBuffer;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshInfo *meshInfo = (MeshInfo *) jlong_to_ptr(nativeMeshInfo);
+    if ((ctxInfo == NULL) || (meshInfo == NULL) || (vbArray == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferSubData == NULL) ||
+            (meshInfo->vboIDArray[MESH_VERTEXBUFFER] == 0) ||
+            from < 0 || to <= from ||
+            (GLsizeiptr) to * (GLsizeiptr) sizeof (GLfloat)
+                    > meshInfo->vboCapacity[MESH_VERTEXBUFFER]) {
+        return JNI_FALSE;
+    }
+
+    vertexBufferSize = (*env)->GetArrayLength(env, vbArray);
+    if ((GLuint) to > vertexBufferSize) {
+        return JNI_FALSE;
+    }
+    vertexBuffer = (GLfloat *) ((*env)->GetPrimitiveArrayCritical(env, vbArray, NULL));
+    if (vertexBuffer == NULL) {
+        return JNI_FALSE;
+    }
+
+    // Only the modified vertices are sent, the rest of the buffer and the
+    // index buffer are kept as they are
+    meshInfo->dynamic = JNI_TRUE;
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
+    ctxInfo->glBufferSubData(GL_ARRAY_BUFFER, from * sizeof (GLfloat),
+            (to - from) * sizeof (GLfloat), vertexBuffer + from);
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    (*env)->ReleasePrimitiveArrayCritical(env, vbArray, vertexBuffer, JNI_ABORT);
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCreateES2PhongMaterial
@@ -2313,29 +3095,15 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetLight
 }
 
 /*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nRenderMeshView
- * Signature: (JJ)V
+ * Draws the mesh of a mesh view, either once or numInstances times with
+ * the per-instance world matrices read from the instance buffer.
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
-  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshViewInfo)
+static void drawMeshView(ContextInfo *ctxInfo, MeshViewInfo *mvInfo,
+        GLsizei numInstances)
 {
     GLuint offset = 0;
+    int i;
     MeshInfo *mInfo;
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    MeshViewInfo *mvInfo = (MeshViewInfo *) jlong_to_ptr(nativeMeshViewInfo);
-    if ((ctxInfo == NULL) || (mvInfo == NULL) ||
-            (ctxInfo->glBindBuffer == NULL) ||
-            (ctxInfo->glBufferData == NULL) ||
-            (ctxInfo->glDisableVertexAttribArray == NULL) ||
-            (ctxInfo->glEnableVertexAttribArray == NULL) ||
-            (ctxInfo->glVertexAttribPointer == NULL)) {
-        return;
-    }
-
-    if ((mvInfo->phongMaterialInfo == NULL) || (mvInfo->meshInfo == NULL)) {
-        return;
-    }
 
     setCullMode(ctxInfo, mvInfo);
     setPolyonMode(ctxInfo, mvInfo);
@@ -2358,8 +3126,29 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
     ctxInfo->glVertexAttribPointer(NC_3D_INDEX, NC_3D_SIZE, GL_FLOAT, GL_FALSE,
             VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
 
-    glDrawElements(GL_TRIANGLES, mvInfo->meshInfo->indexBufferSize,
-            mvInfo->meshInfo->indexBufferType, 0);
+    if (numInstances > 0) {
+        // One world matrix per instance, a column per attribute slot
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, ctxInfo->instanceBufferID);
+        for (i = 0; i < 4; i++) {
+            ctxInfo->glEnableVertexAttribArray(WM_3D_INDEX + i);
+            ctxInfo->glVertexAttribPointer(WM_3D_INDEX + i, 4, GL_FLOAT, GL_FALSE,
+                    WM_3D_SIZE * sizeof(GLfloat),
+                    (const GLvoid *) jlong_to_ptr((jlong) (i * 4 * sizeof(GLfloat))));
+            ctxInfo->glVertexAttribDivisor(WM_3D_INDEX + i, 1);
+        }
+
+        ctxInfo->glDrawElementsInstanced(GL_TRIANGLES,
+                mvInfo->meshInfo->indexBufferSize,
+                mvInfo->meshInfo->indexBufferType, 0, numInstances);
+
+        for (i = 0; i < 4; i++) {
+            ctxInfo->glVertexAttribDivisor(WM_3D_INDEX + i, 0);
+            ctxInfo->glDisableVertexAttribArray(WM_3D_INDEX + i);
+        }
+    } else {
+        glDrawElements(GL_TRIANGLES, mvInfo->meshInfo->indexBufferSize,
+                mvInfo->meshInfo->indexBufferType, 0);
+    }
 
     // Reset states
     ctxInfo->glDisableVertexAttribArray(VC_3D_INDEX);
@@ -2369,3 +3158,189 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
     ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nRenderMeshView
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshViewInfo)
+{
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshViewInfo *mvInfo = (MeshViewInfo *) jlong_to_ptr(nativeMeshViewInfo);
+    if ((ctxInfo == NULL) || (mvInfo == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferData == NULL) ||
+            (ctxInfo->glDisableVertexAttribArray == NULL) ||
+            (ctxInfo->glEnableVertexAttribArray == NULL) ||
+            (ctxInfo->glVertexAttribPointer == NULL)) {
+        return;
+    }
+
+    if ((mvInfo->phongMaterialInfo == NULL) || (mvInfo->meshInfo == NULL)) {
+        return;
+    }
+
+    drawMeshView(ctxInfo, mvInfo, 0);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nIsInstancingSupported
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nIsInstancingSupported
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo)
+{
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glGenBuffers == NULL) ||
+            (ctxInfo->glBufferSubData == NULL) ||
+            (ctxInfo->glDrawElementsInstanced == NULL) ||
+            (ctxInfo->glVertexAttribDivisor == NULL)) {
+        return JNI_FALSE;
+    }
+    return JNI_TRUE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nRenderMeshViewInstanced
+ * Signature: (JJ[FI)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshViewInstanced
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshViewInfo,
+        jfloatArray worldMatrices, jint numInstances)
+{
+    GLsizeiptr size;
+    GLfloat *matrices;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshViewInfo *mvInfo = (MeshViewInfo *) jlong_to_ptr(nativeMeshViewInfo);
+    if ((ctxInfo == NULL) || (mvInfo == NULL) || (worldMatrices == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferData == NULL) ||
+            (ctxInfo->glBufferSubData == NULL) ||
+            (ctxInfo->glGenBuffers == NULL) ||
+            (ctxInfo->glDisableVertexAttribArray == NULL) ||
+            (ctxInfo->glEnableVertexAttribArray == NULL) ||
+            (ctxInfo->glVertexAttribPointer == NULL) ||
+            (ctxInfo->glDrawElementsInstanced == NULL) ||
+            (ctxInfo->glVertexAttribDivisor == NULL) ||
+            numInstances <= 0 ||
+            (*env)->GetArrayLength(env, worldMatrices) < numInstances * WM_3D_SIZE) {
+        return;
+    }
+
+    if ((mvInfo->phongMaterialInfo == NULL) || (mvInfo->meshInfo == NULL)) {
+        return;
+    }
+
+    if (ctxInfo->instanceBufferID == 0) {
+        ctxInfo->glGenBuffers(1, &ctxInfo->instanceBufferID);
+    }
+
+    matrices = (GLfloat *) (*env)->GetPrimitiveArrayCritical(env, worldMatrices, NULL);
+    if (matrices == NULL) {
+        return;
+    }
+
+    // The instance buffer is orphaned on every batch so that it does not
+    // wait for the previous batch to be drawn
+    size = numInstances * WM_3D_SIZE * sizeof(GLfloat);
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, ctxInfo->instanceBufferID);
+    if (size > ctxInfo->instanceBufferCapacity) {
+        ctxInfo->instanceBufferCapacity = size;
+    }
+    ctxInfo->glBufferData(GL_ARRAY_BUFFER, ctxInfo->instanceBufferCapacity,
+            NULL, GL_STREAM_DRAW);
+    ctxInfo->glBufferSubData(GL_ARRAY_BUFFER, 0, size, matrices);
+    (*env)->ReleasePrimitiveArrayCritical(env, worldMatrices, matrices, JNI_ABORT);
+
+    drawMeshView(ctxInfo, mvInfo, numInstances);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nBeginGPUTimer
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBeginGPUTimer
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    GLuint *query;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || !ctxInfo->timerQuerySupported
+            || ctxInfo->timerQueryActive
+            || (ctxInfo->timerQueryCount == NUM_TIMER_QUERIES)) {
+        // Skip the frame rather than wait for the GPU to catch up
+        return JNI_FALSE;
+    }
+
+    query = &ctxInfo->timerQueries[(ctxInfo->timerQueryHead
+            + ctxInfo->timerQueryCount) % NUM_TIMER_QUERIES];
+    if (*query == 0) {
+        ctxInfo->glGenQueries(1, query);
+        if (*query == 0) {
+            return JNI_FALSE;
+        }
+    }
+    ctxInfo->glBeginQuery(GL_TIME_ELAPSED, *query);
+    ctxInfo->timerQueryActive = JNI_TRUE;
+    ctxInfo->timerQueryCount++;
+    return JNI_TRUE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nEndGPUTimer
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nEndGPUTimer
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || !ctxInfo->timerQueryActive) {
+        return;
+    }
+    ctxInfo->glEndQuery(GL_TIME_ELAPSED);
+    ctxInfo->timerQueryActive = JNI_FALSE;
+}
+
+/*
+ * Returns the GPU time in nanoseconds of the oldest finished timer query
+ * and releases it, or -1 if no result is available yet.
+ *
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetGPUTime
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nGetGPUTime
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    GLuint query;
+    GLuint available = GL_FALSE;
+    GLuint64 elapsed = 0;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->timerQueryCount == 0)
+            || (ctxInfo->timerQueryActive && (ctxInfo->timerQueryCount == 1))) {
+        return -1;
+    }
+
+    query = ctxInfo->timerQueries[ctxInfo->timerQueryHead];
+    ctxInfo->glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE) {
+        return -1;
+    }
+    ctxInfo->glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+    ctxInfo->timerQueryHead = (ctxInfo->timerQueryHead + 1) % NUM_TIMER_QUERIES;
+    ctxInfo->timerQueryCount--;
+
+#ifdef IS_EGL
+    {
+        // A disjoint operation, such as a frequency change, makes the
+        // results of the queries in flight meaningless
+        GLint disjoint = GL_FALSE;
+        glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+        if (disjoint) {
+            return -1;
+        }
+    }
+#endif
+    return (jlong) elapsed;
+}
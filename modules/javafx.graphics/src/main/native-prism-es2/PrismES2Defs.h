@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -123,8 +123,14 @@ typedef int intptr_t;
 #define DEPTH_SIZE      com_sun_prism_es2_GLPixelFormat_Attributes_DEPTH_SIZE
 #define DOUBLEBUFFER    com_sun_prism_es2_GLPixelFormat_Attributes_DOUBLEBUFFER
 #define ONSCREEN        com_sun_prism_es2_GLPixelFormat_Attributes_ONSCREEN
+#define GPU_PREFERENCE  com_sun_prism_es2_GLPixelFormat_Attributes_GPU_PREFERENCE
 #define NUM_ITEMS       com_sun_prism_es2_GLPixelFormat_Attributes_NUM_ITEMS
 
+/* The GPU_PREFERENCE values of PrismSettings.gpuPreference */
+#define GPU_PREFERENCE_DEFAULT          0
+#define GPU_PREFERENCE_LOW_POWER        1
+#define GPU_PREFERENCE_HIGH_PERFORMANCE 2
+
 #ifdef ANDROID_NDK
 
 #include "com_sun_prism_es2_GLPixelFormat_Attributes.h"
@@ -134,6 +140,7 @@ typedef EGLNativeWindowType  Window;
 typedef EGLConfig            GLXFBConfig;
 typedef unsigned long        Colormap;
 typedef unsigned long        PFNGLXSWAPINTERVALSGIPROC;
+typedef unsigned long        PFNGLXSWAPINTERVALEXTPROC;
 
 #include <android/log.h>
 #include <string.h>
@@ -202,6 +209,9 @@ struct StateInfoRec {
     /* For state caching */
     jboolean depthWritesEnabled;
     jboolean scissorEnabled;
+    GLint scissorBox[4];
+    GLenum blendSrcFactor;
+    GLenum blendDstFactor;
     GLclampf clearColor[4];
     jboolean vSyncEnabled;
 
@@ -214,6 +224,41 @@ struct StateInfoRec {
     GLuint fbo;
 };
 
+/* Number of pixel unpack buffers that texture uploads are streamed through */
+#define NUM_UPLOAD_BUFFERS 3
+
+/* Typedef for upload buffer struct */
+typedef struct UploadBufferRec UploadBuffer;
+
+/* define the structure to hold a pixel unpack buffer of the upload ring */
+struct UploadBufferRec {
+    GLuint id;
+    GLsizeiptr size;
+    /* persistent mapping of the buffer, or NULL if it is mapped per upload */
+    void *mapped;
+    /* signaled once the GPU is done reading the last upload */
+    GLsync fence;
+};
+
+/* Number of idle pixel pack buffers kept around for asynchronous readbacks */
+#define NUM_READBACK_BUFFERS 2
+
+/* Typedef for pixel readback struct */
+typedef struct PixelReadbackRec PixelReadback;
+
+/* define the structure to hold an asynchronous readback in flight */
+struct PixelReadbackRec {
+    GLuint id;
+    GLsizeiptr size;
+    /* signaled once the pixels have landed in the pack buffer */
+    GLsync fence;
+    jint width;
+    jint height;
+};
+
+/* Number of GPU timer queries that can be in flight at once */
+#define NUM_TIMER_QUERIES 4
+
 /* Typedef for context properties struct */
 typedef struct ContextInfoRec ContextInfo;
 
@@ -263,6 +308,14 @@ struct ContextInfoRec {
 #ifdef UNIX /* LINUX || SOLARIS */
     char *glxExtensionStr;
     PFNGLXSWAPINTERVALSGIPROC glXSwapIntervalSGI;
+    PFNGLXSWAPINTERVALEXTPROC glXSwapIntervalEXT;
+    /* GLX_EXT_swap_control_tear, negative intervals give adaptive vsync */
+    jboolean swapControlTear;
+    /* swap interval used while vsync is enabled, 1 or -1 */
+    int vSyncInterval;
+    /* drawable and interval last passed to glXSwapIntervalEXT */
+    Window swapIntervalWin;
+    int swapInterval;
 #endif /* LINUX || SOLARIS */
 
     /* gl function pointers */
@@ -317,6 +370,22 @@ struct ContextInfoRec {
     PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
     PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
     PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+    PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+    PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+    PFNGLBUFFERSTORAGEPROC glBufferStorage;
+    PFNGLFENCESYNCPROC glFenceSync;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+    PFNGLDELETESYNCPROC glDeleteSync;
+    PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    PFNGLPROGRAMBINARYPROC glProgramBinary;
+    PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
+    PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+    PFNGLGENQUERIESPROC glGenQueries;
+    PFNGLDELETEQUERIESPROC glDeleteQueries;
+    PFNGLBEGINQUERYPROC glBeginQuery;
+    PFNGLENDQUERYPROC glEndQuery;
+    PFNGLGETQUERYOBJECTUIVPROC glGetQueryObjectuiv;
+    PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
 
     /* For state caching */
     StateInfo state;
@@ -328,6 +397,27 @@ struct ContextInfoRec {
     char  *vbByteData;
     jboolean gl2;
 
+    /* Ring of pixel unpack buffers used to stream texture uploads */
+    jboolean uploadBuffersSupported;
+    jboolean persistentUploadBuffers;
+    int uploadBufferIndex;
+    UploadBuffer uploadBuffers[NUM_UPLOAD_BUFFERS];
+
+    /* Idle pixel pack buffers of asynchronous readbacks, id 0 if empty */
+    jboolean readbackSupported;
+    UploadBuffer readbackBuffers[NUM_READBACK_BUFFERS];
+
+    /* Ring of GL_TIME_ELAPSED queries, oldest pending one at timerQueryHead */
+    jboolean timerQuerySupported;
+    jboolean timerQueryActive;
+    int timerQueryHead;
+    int timerQueryCount;
+    GLuint timerQueries[NUM_TIMER_QUERIES];
+
+    /* Per-instance world matrices of instanced mesh draws */
+    GLuint instanceBufferID;
+    GLsizeiptr instanceBufferCapacity;
+
     /* Caching properties passed down from Java */
     jboolean vSyncRequested;
 };
@@ -351,6 +441,9 @@ extern void deletePixelFormatInfo(PixelFormatInfo *pfInfo);
 #define NC_3D_SIZE 4  /* nx, ny, nz, nw */
 #define VERT_3D_SIZE (VC_3D_SIZE + TC_3D_SIZE + NC_3D_SIZE)
 #define VERT_3D_STRIDE (sizeof(GLfloat) * VERT_3D_SIZE)
+/* the per-instance world matrix takes 4 attribute slots, one per column */
+#define WM_3D_INDEX 3
+#define WM_3D_SIZE 16
 
 #define MESH_VERTEXBUFFER 0
 #define MESH_INDEXBUFFER 1
@@ -363,6 +456,12 @@ struct MeshInfoRec {
     GLuint vboIDArray[MESH_MAX_BUFFERS];
     GLuint indexBufferSize;
     GLenum indexBufferType;
+    // allocated size in bytes of each buffer object
+    GLsizeiptr vboCapacity[MESH_MAX_BUFFERS];
+    // hash of the uploaded indices, used to skip unchanged index buffers
+    GLuint indexBufferHash;
+    // set once the geometry is rebuilt, after which the buffers are streamed
+    jboolean dynamic;
 };
 
 typedef struct PhongMaterialInfoRec PhongMaterialInfo;
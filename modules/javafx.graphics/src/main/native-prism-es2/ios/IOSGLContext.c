@@ -255,6 +255,67 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_IOSGLContext_nInitialize
             getProcAddress("glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             getProcAddress("glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            getProcAddress("glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            getProcAddress("glUnmapBuffer");
+    ctxInfo->glBufferStorage = (PFNGLBUFFERSTORAGEPROC)
+            getProcAddress("glBufferStorage");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            getProcAddress("glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            getProcAddress("glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            getProcAddress("glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            getProcAddress("glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            getProcAddress("glProgramBinary");
+    if (ctxInfo->glGetProgramBinary == NULL
+            || ctxInfo->glProgramBinary == NULL) {
+        ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                getProcAddress("glGetProgramBinaryOES");
+        ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                getProcAddress("glProgramBinaryOES");
+    }
+    ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+            getProcAddress("glDrawElementsInstanced");
+    ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+            getProcAddress("glVertexAttribDivisor");
+    if (ctxInfo->glDrawElementsInstanced == NULL
+            || ctxInfo->glVertexAttribDivisor == NULL) {
+        ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+                getProcAddress("glDrawElementsInstancedEXT");
+        ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+                getProcAddress("glVertexAttribDivisorEXT");
+    }
+    ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+            getProcAddress("glGenQueries");
+    ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+            getProcAddress("glDeleteQueries");
+    ctxInfo->glBeginQuery = (PFNGLBEGINQUERYPROC)
+            getProcAddress("glBeginQuery");
+    ctxInfo->glEndQuery = (PFNGLENDQUERYPROC)
+            getProcAddress("glEndQuery");
+    ctxInfo->glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)
+            getProcAddress("glGetQueryObjectuiv");
+    ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+            getProcAddress("glGetQueryObjectui64v");
+    if (ctxInfo->glGenQueries == NULL
+            || ctxInfo->glGetQueryObjectui64v == NULL) {
+        ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+                getProcAddress("glGenQueriesEXT");
+        ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+                getProcAddress("glDeleteQueriesEXT");
+        ctxInfo->glBeginQuery = (PFNGLBEGINQUERYPROC)
+                getProcAddress("glBeginQueryEXT");
+        ctxInfo->glEndQuery = (PFNGLENDQUERYPROC)
+                getProcAddress("glEndQueryEXT");
+        ctxInfo->glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)
+                getProcAddress("glGetQueryObjectuivEXT");
+        ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+                getProcAddress("glGetQueryObjectui64vEXT");
+    }
 
     // initialize platform states and properties to match
     // cached states and properties
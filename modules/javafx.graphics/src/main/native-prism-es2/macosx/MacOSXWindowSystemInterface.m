@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -58,8 +58,12 @@ void *createPixelFormat(jint *ivalues) {
     attribs[index++] = ivalues[com_sun_prism_es2_GLPixelFormat_Attributes_DEPTH_SIZE];
 
 
-    // Lets OpenGL know this context is offline renderer aware.
-    attribs[index++] = NSOpenGLPFAAllowOfflineRenderers;
+    // Lets OpenGL know this context is offline renderer aware, so that it
+    // may stay on the integrated GPU. Without it the system switches to the
+    // discrete GPU, which is what the high performance preference (2) asks for.
+    if (ivalues[com_sun_prism_es2_GLPixelFormat_Attributes_GPU_PREFERENCE] != 2) {
+        attribs[index++] = NSOpenGLPFAAllowOfflineRenderers;
+    }
 
     // Zero-terminate
     attribs[index++] = 0;
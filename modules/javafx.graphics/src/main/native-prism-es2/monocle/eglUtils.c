@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -291,6 +291,67 @@ ContextInfo *eglContextFromConfig(EGLDisplay *dpy, EGLConfig config) {
                             GET_DLSYM(handle, "glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
                             GET_DLSYM(handle, "glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+                            GET_DLSYM(handle, "glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+                            GET_DLSYM(handle, "glUnmapBuffer");
+    ctxInfo->glBufferStorage = (PFNGLBUFFERSTORAGEPROC)
+                            GET_DLSYM(handle, "glBufferStorage");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+                            GET_DLSYM(handle, "glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+                            GET_DLSYM(handle, "glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+                            GET_DLSYM(handle, "glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                            GET_DLSYM(handle, "glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                            GET_DLSYM(handle, "glProgramBinary");
+    if (ctxInfo->glGetProgramBinary == NULL
+            || ctxInfo->glProgramBinary == NULL) {
+        ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                                GET_DLSYM(handle, "glGetProgramBinaryOES");
+        ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                                GET_DLSYM(handle, "glProgramBinaryOES");
+    }
+    ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+                            GET_DLSYM(handle, "glDrawElementsInstanced");
+    ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+                            GET_DLSYM(handle, "glVertexAttribDivisor");
+    if (ctxInfo->glDrawElementsInstanced == NULL
+            || ctxInfo->glVertexAttribDivisor == NULL) {
+        ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+                                GET_DLSYM(handle, "glDrawElementsInstancedEXT");
+        ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+                                GET_DLSYM(handle, "glVertexAttribDivisorEXT");
+    }
+    ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+                            GET_DLSYM(handle, "glGenQueries");
+    ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+                            GET_DLSYM(handle, "glDeleteQueries");
+    ctxInfo->glBeginQuery = (PFNGLBEGINQUERYPROC)
+                            GET_DLSYM(handle, "glBeginQuery");
+    ctxInfo->glEndQuery = (PFNGLENDQUERYPROC)
+                            GET_DLSYM(handle, "glEndQuery");
+    ctxInfo->glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)
+                            GET_DLSYM(handle, "glGetQueryObjectuiv");
+    ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+                            GET_DLSYM(handle, "glGetQueryObjectui64v");
+    if (ctxInfo->glGenQueries == NULL
+            || ctxInfo->glGetQueryObjectui64v == NULL) {
+        ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+                                GET_DLSYM(handle, "glGenQueriesEXT");
+        ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+                                GET_DLSYM(handle, "glDeleteQueriesEXT");
+        ctxInfo->glBeginQuery = (PFNGLBEGINQUERYPROC)
+                                GET_DLSYM(handle, "glBeginQueryEXT");
+        ctxInfo->glEndQuery = (PFNGLENDQUERYPROC)
+                                GET_DLSYM(handle, "glEndQueryEXT");
+        ctxInfo->glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)
+                                GET_DLSYM(handle, "glGetQueryObjectuivEXT");
+        ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+                                GET_DLSYM(handle, "glGetQueryObjectui64vEXT");
+    }
 
     initState(ctxInfo);
     /* Releasing native resources */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -280,6 +280,49 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_WinGLContext_nInitialize
             wglGetProcAddress("glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             wglGetProcAddress("glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            wglGetProcAddress("glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            wglGetProcAddress("glUnmapBuffer");
+    ctxInfo->glBufferStorage = (PFNGLBUFFERSTORAGEPROC)
+            wglGetProcAddress("glBufferStorage");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            wglGetProcAddress("glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            wglGetProcAddress("glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            wglGetProcAddress("glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            wglGetProcAddress("glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            wglGetProcAddress("glProgramBinary");
+    ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+            wglGetProcAddress("glDrawElementsInstanced");
+    ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+            wglGetProcAddress("glVertexAttribDivisor");
+    if (ctxInfo->glDrawElementsInstanced == NULL
+            || ctxInfo->glVertexAttribDivisor == NULL) {
+        ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+                wglGetProcAddress("glDrawElementsInstancedARB");
+        ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+                wglGetProcAddress("glVertexAttribDivisorARB");
+    }
+    ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+            wglGetProcAddress("glGenQueries");
+    ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+            wglGetProcAddress("glDeleteQueries");
+    ctxInfo->glBeginQuery = (PFNGLBEGINQUERYPROC)
+            wglGetProcAddress("glBeginQuery");
+    ctxInfo->glEndQuery = (PFNGLENDQUERYPROC)
+            wglGetProcAddress("glEndQuery");
+    ctxInfo->glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)
+            wglGetProcAddress("glGetQueryObjectuiv");
+    ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+            wglGetProcAddress("glGetQueryObjectui64v");
+    if (ctxInfo->glGetQueryObjectui64v == NULL) {
+        ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+                wglGetProcAddress("glGetQueryObjectui64vEXT");
+    }
 
     if (isExtensionSupported(ctxInfo->wglExtensionStr,
             "WGL_EXT_swap_control")) {
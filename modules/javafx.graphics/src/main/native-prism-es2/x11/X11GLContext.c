@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -268,6 +268,49 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
             dlsym(RTLD_DEFAULT,"glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             dlsym(RTLD_DEFAULT,"glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            dlsym(RTLD_DEFAULT,"glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            dlsym(RTLD_DEFAULT,"glUnmapBuffer");
+    ctxInfo->glBufferStorage = (PFNGLBUFFERSTORAGEPROC)
+            dlsym(RTLD_DEFAULT,"glBufferStorage");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            dlsym(RTLD_DEFAULT,"glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            dlsym(RTLD_DEFAULT,"glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            dlsym(RTLD_DEFAULT,"glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT,"glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT,"glProgramBinary");
+    ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+            dlsym(RTLD_DEFAULT,"glDrawElementsInstanced");
+    ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+            dlsym(RTLD_DEFAULT,"glVertexAttribDivisor");
+    if (ctxInfo->glDrawElementsInstanced == NULL
+            || ctxInfo->glVertexAttribDivisor == NULL) {
+        ctxInfo->glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)
+                dlsym(RTLD_DEFAULT,"glDrawElementsInstancedARB");
+        ctxInfo->glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)
+                dlsym(RTLD_DEFAULT,"glVertexAttribDivisorARB");
+    }
+    ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+            dlsym(RTLD_DEFAULT,"glGenQueries");
+    ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+            dlsym(RTLD_DEFAULT,"glDeleteQueries");
+    ctxInfo->glBeginQuery = (PFNGLBEGINQUERYPROC)
+            dlsym(RTLD_DEFAULT,"glBeginQuery");
+    ctxInfo->glEndQuery = (PFNGLENDQUERYPROC)
+            dlsym(RTLD_DEFAULT,"glEndQuery");
+    ctxInfo->glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)
+            dlsym(RTLD_DEFAULT,"glGetQueryObjectuiv");
+    ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+            dlsym(RTLD_DEFAULT,"glGetQueryObjectui64v");
+    if (ctxInfo->glGetQueryObjectui64v == NULL) {
+        ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+                dlsym(RTLD_DEFAULT,"glGetQueryObjectui64vEXT");
+    }
 
     if (isExtensionSupported(ctxInfo->glxExtensionStr,
             "GLX_SGI_swap_control")) {
@@ -281,6 +324,17 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
 
     }
 
+    // GLX_EXT_swap_control sets the interval per drawable and, with
+    // GLX_EXT_swap_control_tear, accepts the negative adaptive intervals
+    if (isExtensionSupported(ctxInfo->glxExtensionStr,
+            "GLX_EXT_swap_control")) {
+        ctxInfo->glXSwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)
+                glXGetProcAddress((const GLubyte *)"glXSwapIntervalEXT");
+        ctxInfo->swapControlTear = (ctxInfo->glXSwapIntervalEXT != NULL)
+                && isExtensionSupported(ctxInfo->glxExtensionStr,
+                    "GLX_EXT_swap_control_tear");
+    }
+
     // initialize platform states and properties to match
     // cached states and properties
     if (ctxInfo->glXSwapIntervalSGI != NULL) {
@@ -288,6 +342,9 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
     }
     ctxInfo->state.vSyncEnabled = JNI_FALSE;
     ctxInfo->vSyncRequested = vSyncRequested;
+    ctxInfo->vSyncInterval = 1;
+    ctxInfo->swapIntervalWin = None;
+    ctxInfo->swapInterval = 0;
 
     initState(ctxInfo);
 
@@ -328,6 +385,18 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_X11GLContext_nMakeCurrent
     }
 
     vSyncNeeded = ctxInfo->vSyncRequested && dInfo->onScreen;
+    if (ctxInfo->vSyncInterval != 1 && ctxInfo->glXSwapIntervalEXT != NULL) {
+        // Adaptive vsync is set on the drawable, not on the context
+        interval = (vSyncNeeded) ? ctxInfo->vSyncInterval : 0;
+        ctxInfo->state.vSyncEnabled = vSyncNeeded;
+        if (dInfo->onScreen && (dInfo->win != ctxInfo->swapIntervalWin
+                || interval != ctxInfo->swapInterval)) {
+            ctxInfo->glXSwapIntervalEXT(ctxInfo->display, dInfo->win, interval);
+            ctxInfo->swapIntervalWin = dInfo->win;
+            ctxInfo->swapInterval = interval;
+        }
+        return;
+    }
     if (vSyncNeeded == ctxInfo->state.vSyncEnabled) {
         return;
     }
@@ -337,3 +406,23 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_X11GLContext_nMakeCurrent
         ctxInfo->glXSwapIntervalSGI(interval);
     }
 }
+
+/*
+ * Class:     com_sun_prism_es2_X11GLContext
+ * Method:    nSetAdaptiveVSync
+ * Signature: (JZ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_X11GLContext_nSetAdaptiveVSync
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jboolean adaptive) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if (ctxInfo == NULL) {
+        return JNI_FALSE;
+    }
+    if (adaptive && !ctxInfo->swapControlTear) {
+        return JNI_FALSE;
+    }
+    ctxInfo->vSyncInterval = adaptive ? -1 : 1;
+    // Force the interval to be set again on the next nMakeCurrent
+    ctxInfo->swapIntervalWin = None;
+    return JNI_TRUE;
+}
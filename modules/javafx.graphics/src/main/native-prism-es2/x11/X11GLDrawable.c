@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -112,6 +112,39 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_X11GLDrawable_nSwapBuffers
     return JNI_TRUE;
 }
 
+/*
+ * Class:     com_sun_prism_es2_X11GLDrawable
+ * Method:    nGetLastVBlankTime
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLDrawable_nGetLastVBlankTime
+(JNIEnv *env, jclass class, jlong nativeDInfo) {
+    static jboolean initialized = JNI_FALSE;
+    static PFNGLXGETSYNCVALUESOMLPROC getSyncValues = NULL;
+    int64_t ust, msc, sbc;
+
+    DrawableInfo *dInfo = (DrawableInfo *) jlong_to_ptr(nativeDInfo);
+    if ((dInfo == NULL) || !dInfo->onScreen) {
+        return 0;
+    }
+    if (!initialized) {
+        const char *glxExtensions = glXQueryExtensionsString(dInfo->display,
+                DefaultScreen(dInfo->display));
+        initialized = JNI_TRUE;
+        if ((glxExtensions != NULL) && isExtensionSupported(glxExtensions,
+                "GLX_OML_sync_control")) {
+            getSyncValues = (PFNGLXGETSYNCVALUESOMLPROC)
+                    glXGetProcAddress((const GLubyte *)"glXGetSyncValuesOML");
+        }
+    }
+    if ((getSyncValues == NULL)
+            || !getSyncValues(dInfo->display, dInfo->win, &ust, &msc, &sbc)) {
+        return 0;
+    }
+    // The unadjusted system time is in microseconds
+    return (jlong) ust;
+}
+
 /*
  * Class:     com_sun_prism_es2_X11GLDrawable
  * Method:    nReleaseDrawable
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <unistd.h>
 #include <X11/Xutil.h>
 
 #include "../PrismES2Defs.h"
@@ -151,6 +152,20 @@ jboolean queryGLX13(Display *display) {
     return JNI_TRUE;
 }
 
+/*
+ * Asks for the discrete GPU of a PRIME laptop. This has to happen before
+ * the first GLX call loads the driver: Mesa reads DRI_PRIME, and the NVIDIA
+ * driver renders offloaded when its GLX vendor library is selected, which is
+ * only done when its kernel module is loaded. Variables the user set are kept.
+ */
+static void preferHighPerformanceGPU() {
+    setenv("DRI_PRIME", "1", 0);
+    if (access("/proc/driver/nvidia/version", F_OK) == 0) {
+        setenv("__NV_PRIME_RENDER_OFFLOAD", "1", 0);
+        setenv("__GLX_VENDOR_LIBRARY_NAME", "nvidia", 0);
+    }
+}
+
 static int x11errorhit = 0;
 
 static int x11errorDetector (Display *dpy, XErrorEvent *error)
@@ -195,6 +210,9 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLFactory_nInitialize
     }
     attrs = (*env)->GetIntArrayElements(env, attrArr, NULL);
     setGLXAttrs(attrs, glxAttrs);
+    if (attrs[GPU_PREFERENCE] == GPU_PREFERENCE_HIGH_PERFORMANCE) {
+        preferHighPerformanceGPU();
+    }
     (*env)->ReleaseIntArrayElements(env, attrArr, attrs, JNI_ABORT);
 
     display = XOpenDisplay(0);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,6 +42,20 @@
 #define INDICES_PER_IB  (MAX_NUM_QUADS * 6) // (4096 * 6 * 2 ) = 48 kb IndexBuffer
 #define VERTICES_PER_IB (MAX_NUM_QUADS * 4)
 
+#define CONVOLVE_TILE_SIZE (256) // refer linear_convolve in ComputeKernels.metal
+#define CONVOLVE_MAX_KERNEL_SIZE (128)
+
+typedef struct ConvolveParams {
+    vector_int2 srcOrigin;
+    vector_int2 srcSize;
+    vector_int2 dstOrigin;
+    vector_int2 dstSize;
+    vector_int2 dir;
+    int kernelSize;
+    int isShadow;
+    vector_float4 shadowColor;
+} ConvolveParams;
+
 typedef struct PrismSourceVertex {
     float x, y, z;
     float tu1, tv1;
@@ -107,6 +121,7 @@ typedef enum VertexInputIndex {
     int cullMode;
 
     id<MTLBuffer> pixelBuffer;
+    CVMetalTextureCacheRef videoTextureCache;
 }
 
 - (void) setCompositeMode:(int)mode;
@@ -184,6 +199,7 @@ typedef enum VertexInputIndex {
 - (id<MTLSamplerState>) getSampler:(bool)isLinear wrapMode:(int)wrapMode;
 - (id<MTLSamplerState>) createSampler:(bool)isLinear wrapMode:(int)wrapMode;
 - (id<MTLCommandQueue>) getCommandQueue;
+- (CVMetalTextureCacheRef) getVideoTextureCache;
 
 - (void) validatePixelBuffer:(NSUInteger)length;
 - (id<MTLBuffer>) getPixelBuffer;
@@ -192,6 +208,10 @@ typedef enum VertexInputIndex {
 
 - (void) blit:(id<MTLTexture>)src srcX0:(int)srcX0 srcY0:(int)srcY0 srcX1:(int)srcX1 srcY1:(int)srcY1
        dstTex:(id<MTLTexture>)dst dstX0:(int)dstX0 dstY0:(int)dstY0 dstX1:(int)dstX1 dstY1:(int)dstY1;
+- (bool) convolve:(id<MTLTexture>)src srcX:(int)srcX srcY:(int)srcY srcW:(int)srcW srcH:(int)srcH
+           dstTex:(id<MTLTexture>)dst dstX:(int)dstX dstY:(int)dstY dstW:(int)dstW dstH:(int)dstH
+          weights:(const float*)weights kernelSize:(int)kernelSize
+         vertical:(bool)vertical shadowColor:(const float*)shadowColor;
 
 @end
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,13 +41,50 @@
 #import "com_sun_prism_mtl_MTLContext.h"
 #import "com_sun_prism_mtl_MTLPipeline.h"
 
+// The values of PrismSettings.gpuPreference
+#define GPU_PREFERENCE_LOW_POWER        1
+#define GPU_PREFERENCE_HIGH_PERFORMANCE 2
+
+/*
+ * Returns the GPU of the given preference, or the system default device if
+ * there is no such GPU. A high performance GPU is a discrete one, preferably
+ * built in rather than an eGPU, and a low power GPU is an integrated one.
+ */
+static id<MTLDevice> selectDevice(int gpuPreference)
+{
+    id<MTLDevice> selected = nil;
+    if (gpuPreference == GPU_PREFERENCE_HIGH_PERFORMANCE
+            || gpuPreference == GPU_PREFERENCE_LOW_POWER) {
+        NSArray<id<MTLDevice>> *devices = MTLCopyAllDevices();
+        for (id<MTLDevice> candidate in devices) {
+            if (![candidate supportsFamily:MTLGPUFamilyMac2] || candidate.isHeadless) {
+                continue;
+            }
+            if (gpuPreference == GPU_PREFERENCE_LOW_POWER) {
+                if (candidate.isLowPower) {
+                    selected = candidate;
+                    break;
+                }
+            } else if (!candidate.isLowPower && (selected == nil || selected.isRemovable)) {
+                selected = candidate;
+            }
+        }
+        [selected retain];
+        [devices release];
+    }
+    return selected != nil ? selected : MTLCreateSystemDefaultDevice();
+}
+
 @implementation MetalContext
 
 - (id) createContext:(dispatch_data_t)shaderLibData
+       archivePrefix:(NSString*)archivePrefix
+             prewarm:(bool)prewarm
+       gpuPreference:(int)gpuPreference
 {
     self = [super init];
     if (self) {
-        device = MTLCreateSystemDefaultDevice();
+        device = selectDevice(gpuPreference);
 
         currentRingBufferIndex = 0;
         ringBufferSemaphore = dispatch_semaphore_create(0);
@@ -72,7 +109,10 @@
         commandQueue = [device newCommandQueue];
         commandQueue.label = @"The only MTLCommandQueue";
         pipelineManager = [MetalPipelineManager alloc];
-        [pipelineManager init:self libData:shaderLibData];
+        [pipelineManager init:self
+                      libData:shaderLibData
+                archivePrefix:archivePrefix
+                      prewarm:prewarm];
 
         rttPassDesc = [MTLRenderPassDescriptor new];
         rttPassDesc.colorAttachments[0].clearColor  = MTLClearColorMake(1, 1, 1, 1); // make this programmable
@@ -789,6 +829,11 @@
         rttPassDesc = nil;
     }
 
+    if (videoTextureCache != NULL) {
+        CFRelease(videoTextureCache);
+        videoTextureCache = NULL;
+    }
+
     if (phongRPD != nil) {
         [phongRPD release];
         phongRPD = nil;
@@ -848,6 +893,19 @@
     return commandQueue;
 }
 
+- (CVMetalTextureCacheRef) getVideoTextureCache
+{
+    if (videoTextureCache == NULL) {
+        CVReturn cr = CVMetalTextureCacheCreate(kCFAllocatorDefault, NULL, device,
+                                                NULL, &videoTextureCache);
+        if (cr != kCVReturnSuccess) {
+            NSLog(@"MetalContext: Unable to create video texture cache: %d", cr);
+            videoTextureCache = NULL;
+        }
+    }
+    return videoTextureCache;
+}
+
 - (void) blit:(id<MTLTexture>)src srcX0:(int)srcX0 srcY0:(int)srcY0 srcX1:(int)srcX1 srcY1:(int)srcY1
        dstTex:(id<MTLTexture>)dst dstX0:(int)dstX0 dstY0:(int)dstY0 dstX1:(int)dstX1 dstY1:(int)dstY1
 {
@@ -856,10 +914,10 @@
     id<MTLCommandBuffer> commandBuffer = [self getCurrentCommandBuffer];
     @autoreleasepool {
         id<MTLBlitCommandEncoder> blitEncoder = [commandBuffer blitCommandEncoder];
-        if (src.usage == MTLTextureUsageRenderTarget) {
+        if ((src.usage & MTLTextureUsageRenderTarget) != 0) {
             [blitEncoder synchronizeTexture:src slice:0 level:0];
         }
-        if (dst.usage == MTLTextureUsageRenderTarget) {
+        if ((dst.usage & MTLTextureUsageRenderTarget) != 0) {
             [blitEncoder synchronizeTexture:dst slice:0 level:0];
         }
         [blitEncoder copyFromTexture:src
@@ -875,6 +933,57 @@
     }
 }
 
+- (bool) convolve:(id<MTLTexture>)src srcX:(int)srcX srcY:(int)srcY srcW:(int)srcW srcH:(int)srcH
+           dstTex:(id<MTLTexture>)dst dstX:(int)dstX dstY:(int)dstY dstW:(int)dstW dstH:(int)dstH
+          weights:(const float*)weights kernelSize:(int)kernelSize
+         vertical:(bool)vertical shadowColor:(const float*)shadowColor
+{
+    if (kernelSize <= 0 || kernelSize > CONVOLVE_MAX_KERNEL_SIZE ||
+        (dst.usage & MTLTextureUsageShaderWrite) == 0) {
+        return false;
+    }
+    id<MTLComputePipelineState> computePipelineState =
+        [pipelineManager getComputePipelineStateWithFunc:@"linear_convolve"];
+    if (computePipelineState.maxTotalThreadsPerThreadgroup < CONVOLVE_TILE_SIZE) {
+        return false;
+    }
+
+    ConvolveParams params;
+    params.srcOrigin = (vector_int2){ srcX, srcY };
+    params.srcSize = (vector_int2){ srcW, srcH };
+    params.dstOrigin = (vector_int2){ dstX, dstY };
+    params.dstSize = (vector_int2){ dstW, dstH };
+    params.dir = vertical ? (vector_int2){ 0, 1 } : (vector_int2){ 1, 0 };
+    params.kernelSize = kernelSize;
+    params.isShadow = (shadowColor != NULL);
+    params.shadowColor = (shadowColor != NULL)
+        ? (vector_float4){ shadowColor[0], shadowColor[1], shadowColor[2], shadowColor[3] }
+        : (vector_float4){ 0, 0, 0, 0 };
+
+    // One threadgroup per CONVOLVE_TILE_SIZE pixels of each row (or column)
+    int dstLen  = vertical ? dstH : dstW;
+    int dstRows = vertical ? dstW : dstH;
+    MTLSize threadgroupSize = MTLSizeMake(CONVOLVE_TILE_SIZE, 1, 1);
+    MTLSize threadgroupCount = MTLSizeMake((dstLen + CONVOLVE_TILE_SIZE - 1) / CONVOLVE_TILE_SIZE,
+                                           dstRows, 1);
+
+    [self endCurrentRenderEncoder];
+
+    id<MTLCommandBuffer> commandBuffer = [self getCurrentCommandBuffer];
+    @autoreleasepool {
+        id<MTLComputeCommandEncoder> computeEncoder = [commandBuffer computeCommandEncoder];
+        [computeEncoder setComputePipelineState:computePipelineState];
+        [computeEncoder setTexture:src atIndex:0];
+        [computeEncoder setTexture:dst atIndex:1];
+        [computeEncoder setBytes:&params length:sizeof(params) atIndex:0];
+        [computeEncoder setBytes:weights length:kernelSize * sizeof(float) atIndex:1];
+        [computeEncoder dispatchThreadgroups:threadgroupCount
+                       threadsPerThreadgroup:threadgroupSize];
+        [computeEncoder endEncoding];
+    }
+    return true;
+}
+
 @end // MetalContext
 
 
@@ -883,10 +992,11 @@
 /*
  * Class:     com_sun_prism_mtl_MTLContext
  * Method:    nInitialize
- * Signature: (Ljava/nio/ByteBuffer;)J
+ * Signature: (Ljava/nio/ByteBuffer;Ljava/lang/String;ZI)J
  */
 JNIEXPORT jlong JNICALL Java_com_sun_prism_mtl_MTLContext_nInitialize
-    (JNIEnv *env, jclass jClass, jobject shaderLibBuffer)
+    (JNIEnv *env, jclass jClass, jobject shaderLibBuffer,
+     jstring pipelineArchivePrefix, jboolean prewarm, jint gpuPreference)
 {
     jlong jContextPtr = 0L;
 
@@ -915,7 +1025,11 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_mtl_MTLContext_nInitialize
         return 0L;
     }
 
-    jContextPtr = ptr_to_jlong([[MetalContext alloc] createContext:shaderLibData]);
+    NSString *archivePrefix = jStringToNSString(env, pipelineArchivePrefix);
+    jContextPtr = ptr_to_jlong([[MetalContext alloc] createContext:shaderLibData
+                                                     archivePrefix:archivePrefix
+                                                           prewarm:(prewarm == JNI_TRUE)
+                                                     gpuPreference:gpuPreference]);
     return jContextPtr;
 }
 
@@ -950,6 +1064,27 @@ JNIEXPORT void JNICALL Java_com_sun_prism_mtl_MTLContext_nRelease
     contextPtr = nil;
 }
 
+/*
+ * Class:     com_sun_prism_mtl_MTLContext
+ * Method:    nGetRingBufferStats
+ * Signature: (J[I)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_mtl_MTLContext_nGetRingBufferStats
+    (JNIEnv *env, jclass jClass, jlong context, jintArray jStats)
+{
+    MetalContext *mtlContext = (MetalContext *)jlong_to_ptr(context);
+    if (mtlContext == nil || (*env)->GetArrayLength(env, jStats) < 6) {
+        return;
+    }
+    MetalRingBuffer *args = [mtlContext getArgsRingBuffer];
+    MetalRingBuffer *data = [mtlContext getDataRingBuffer];
+    jint stats[6] = {
+        [args getBufferSize], [args getHighWaterMark], [args getNumSpills],
+        [data getBufferSize], [data getHighWaterMark], [data getNumSpills]
+    };
+    (*env)->SetIntArrayRegion(env, jStats, 0, 6, stats);
+}
+
 /*
  * Class:     com_sun_prism_mtl_MTLContext
  * Method:    nCommitCurrentCommandBuffer
@@ -1464,6 +1599,43 @@ JNIEXPORT void JNICALL Java_com_sun_prism_mtl_MTLContext_nBlit
         dstTex:dst dstX0:dstX0 dstY0:dstY0 dstX1:dstX1 dstY1:dstY1];
 }
 
+/*
+ * Class:     com_sun_prism_mtl_MTLContext
+ * Method:    nConvolve
+ * Signature: (JJIIIIJIIII[FIZ[F)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_mtl_MTLContext_nConvolve
+    (JNIEnv *env, jclass jClass, jlong ctx,
+    jlong nSrcTex, jint srcX, jint srcY, jint srcW, jint srcH,
+    jlong nDstRTT, jint dstX, jint dstY, jint dstW, jint dstH,
+    jfloatArray jWeights, jint kernelSize, jboolean vertical, jfloatArray jShadowColor)
+{
+    MetalContext *pCtx = (MetalContext*)jlong_to_ptr(ctx);
+    MetalTexture *srcTex = (MetalTexture *)jlong_to_ptr(nSrcTex);
+    MetalRTTexture *dstRTT = (MetalRTTexture *)jlong_to_ptr(nDstRTT);
+    if (pCtx == nil || srcTex == nil || dstRTT == nil ||
+        kernelSize <= 0 || kernelSize > CONVOLVE_MAX_KERNEL_SIZE ||
+        (*env)->GetArrayLength(env, jWeights) < kernelSize) {
+        return JNI_FALSE;
+    }
+
+    float weights[CONVOLVE_MAX_KERNEL_SIZE];
+    (*env)->GetFloatArrayRegion(env, jWeights, 0, kernelSize, weights);
+    float shadowColor[4];
+    if (jShadowColor != NULL) {
+        if ((*env)->GetArrayLength(env, jShadowColor) < 4) {
+            return JNI_FALSE;
+        }
+        (*env)->GetFloatArrayRegion(env, jShadowColor, 0, 4, shadowColor);
+    }
+
+    bool done = [pCtx convolve:[srcTex getTexture] srcX:srcX srcY:srcY srcW:srcW srcH:srcH
+                        dstTex:[dstRTT getTexture] dstX:dstX dstY:dstY dstW:dstW dstH:dstH
+                       weights:weights kernelSize:kernelSize vertical:vertical
+                   shadowColor:(jShadowColor != NULL) ? shadowColor : NULL];
+    return done ? JNI_TRUE : JNI_FALSE;
+}
+
 /*
  * Class:     com_sun_prism_mtl_MTLContext
  * Method:    nSetCameraPosition
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,11 +43,24 @@
     NSMutableDictionary *phongPipelineStateMSAANoDepthDict;
     NSMutableDictionary *phongPipelineStateMSAADepthDict;
     id<MTLDepthStencilState> depthStencilState[2]; // [0] - disabled, [1] - enabled
-    id<MTLComputePipelineState> uyvy422ToRGBAState;
+    NSMutableDictionary *computePipelineStateDict;
+
+    // Pipeline states compiled on an earlier run, see loadBinaryArchive
+    id<MTLDevice> device;
+    id<MTLBinaryArchive> binaryArchive;
+    NSURL *archiveURL;
+    NSURL *archiveKeysURL;
+    NSMutableOrderedSet *archiveKeys; // descriptors of the states in the archive
+    NSMutableDictionary *prewarmedPipeStates;
+    NSLock *archiveLock;
+    bool archiveDirty;
+    bool archiveSaveScheduled;
 }
 
 - (void) init:(MetalContext*)ctx
-      libData:(dispatch_data_t)libData;
+      libData:(dispatch_data_t)libData
+archivePrefix:(NSString*)archivePrefix
+      prewarm:(bool)prewarm;
 - (id<MTLFunction>) getFunction:(NSString*)funcName;
 - (id<MTLRenderPipelineState>) getClearRttPipeState;
 - (id<MTLRenderPipelineState>) getPipeStateWithFragFunc:(id<MTLFunction>)fragFunc
@@ -58,6 +71,12 @@
 - (id<MTLDepthStencilState>) getDepthStencilState;
 - (void) setPipelineCompositeBlendMode:(MTLRenderPipelineDescriptor*)pipeDesc
                          compositeMode:(int)compositeMode;
+- (id<MTLRenderPipelineState>) newPipeStateWithDescriptor:(MTLRenderPipelineDescriptor*)pipeDesc
+                                            compositeMode:(int)compositeMode
+                                                    error:(NSError**)error;
+- (void) loadBinaryArchive:(NSString*)archivePrefix;
+- (void) prewarmPipeStates;
+- (void) saveBinaryArchive;
 - (void) dealloc;
 @end
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,12 +54,23 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
 #endif
 // ---------------------------- Debug helper for Developers -------------------------
 
+// Pipeline states are written to the archive this long after the first one
+// that was missing from it, so that the states created while the first
+// scene is shown end up in a single write.
+#define ARCHIVE_SAVE_DELAY_SEC 5
+
+// Composite mode recorded for a pipeline state without blending
+#define ARCHIVE_NO_BLENDING -1
+
 @implementation MetalPipelineManager
 
 - (void) init:(MetalContext*)ctx
       libData:(dispatch_data_t)libData
+archivePrefix:(NSString*)archivePrefix
+      prewarm:(bool)prewarm
 {
     context = ctx;
+    device = [[context getDevice] retain];
     NSError *error = nil;
     shaderLib = [[context getDevice] newLibraryWithData:libData error:&error];
 
@@ -75,7 +86,22 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
     phongPipelineStateNonMSAADepthDict = [[NSMutableDictionary alloc] init];
     phongPipelineStateMSAANoDepthDict = [[NSMutableDictionary alloc] init];
     phongPipelineStateMSAADepthDict = [[NSMutableDictionary alloc] init];
-    uyvy422ToRGBAState = nil;
+    computePipelineStateDict = [[NSMutableDictionary alloc] init];
+
+    binaryArchive = nil;
+    archiveURL = nil;
+    archiveKeysURL = nil;
+    archiveKeys = [[NSMutableOrderedSet alloc] init];
+    prewarmedPipeStates = [[NSMutableDictionary alloc] init];
+    archiveLock = [[NSLock alloc] init];
+    archiveDirty = false;
+    archiveSaveScheduled = false;
+    if (archivePrefix != nil && shaderLib != nil) {
+        [self loadBinaryArchive:archivePrefix];
+        if (prewarm && binaryArchive != nil) {
+            [self prewarmPipeStates];
+        }
+    }
 
     // Create and cache 2 possible depthStencilStates
     @autoreleasepool {
@@ -145,7 +171,9 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
         }
 
         NSError* error;
-        clearRttPipeState = [[context getDevice] newRenderPipelineStateWithDescriptor:pipeDesc error:&error];
+        clearRttPipeState = [self newPipeStateWithDescriptor:pipeDesc
+                                               compositeMode:ARCHIVE_NO_BLENDING
+                                                       error:&error];
         [pipeDesc release];
         pipeDesc = nil;
         NSAssert(clearRttPipeState, @"Failed to create clear pipeline state: %@", error);
@@ -182,7 +210,9 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
     [self setPipelineCompositeBlendMode:pipeDesc
                           compositeMode:compositeMode];
 
-    id<MTLRenderPipelineState> pipeState = [[context getDevice] newRenderPipelineStateWithDescriptor:pipeDesc error:&error];
+    id<MTLRenderPipelineState> pipeState = [self newPipeStateWithDescriptor:pipeDesc
+                                                              compositeMode:compositeMode
+                                                                      error:&error];
     [pipeDesc release];
     pipeDesc = nil;
     NSAssert(pipeState, @"Failed to create pipeline state to render to texture: %@", error);
@@ -192,15 +222,17 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
 
 - (id<MTLComputePipelineState>) getComputePipelineStateWithFunc:(NSString*)funcName
 {
-    if (uyvy422ToRGBAState == nil) {
+    id<MTLComputePipelineState> computeState = computePipelineStateDict[funcName];
+    if (computeState == nil) {
         NSError* error;
         id<MTLFunction> kernelFunction = [self getFunction:funcName];
-        uyvy422ToRGBAState = [[context getDevice] newComputePipelineStateWithFunction:kernelFunction
-                                                                       error:&error];
-        NSAssert(uyvy422ToRGBAState, @"Failed to create compute pipeline state: %@", error);
+        computeState = [[context getDevice] newComputePipelineStateWithFunction:kernelFunction
+                                                                          error:&error];
+        NSAssert(computeState, @"Failed to create compute pipeline state: %@", error);
+        [computePipelineStateDict setObject:computeState forKey:funcName];
     }
 
-    return uyvy422ToRGBAState;
+    return computeState;
 }
 
 - (id<MTLRenderPipelineState>) getPhongPipeStateWithNumLights:(int)numLights
@@ -246,8 +278,9 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
         }
         [self setPipelineCompositeBlendMode:pipeDesc
                 compositeMode:compositeMode];
-        pipeState = [[context getDevice]
-                newRenderPipelineStateWithDescriptor:pipeDesc error:&error];
+        pipeState = [self newPipeStateWithDescriptor:pipeDesc
+                                       compositeMode:compositeMode
+                                               error:&error];
         [pipeDesc release];
         pipeDesc = nil;
         [psDict setObject:pipeState forKey:keyCompMode];
@@ -315,6 +348,181 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
     pipeDesc.colorAttachments[0].destinationRGBBlendFactor = dstFactor;
 }
 
+// Returns the archive key of a pipeline state. The descriptor can be
+// recreated from the key, see newPipeDescriptorWithKey.
+static NSString* pipeStateKey(MTLRenderPipelineDescriptor *pipeDesc, int compositeMode)
+{
+    return [NSString stringWithFormat:@"%@|%@|%lu|%lu|%lu|%d",
+            pipeDesc.vertexFunction.name,
+            pipeDesc.fragmentFunction.name,
+            (unsigned long)pipeDesc.colorAttachments[0].pixelFormat,
+            (unsigned long)pipeDesc.sampleCount,
+            (unsigned long)pipeDesc.depthAttachmentPixelFormat,
+            compositeMode];
+}
+
+- (MTLRenderPipelineDescriptor*) newPipeDescriptorWithKey:(NSString*)key
+{
+    NSArray *fields = [key componentsSeparatedByString:@"|"];
+    if ([fields count] != 6) {
+        return nil;
+    }
+    id<MTLFunction> vertFunc = [self getFunction:fields[0]];
+    id<MTLFunction> fragFunc = [self getFunction:fields[1]];
+    MTLRenderPipelineDescriptor *pipeDesc = nil;
+    if (vertFunc != nil && fragFunc != nil) {
+        pipeDesc = [[MTLRenderPipelineDescriptor alloc] init];
+        pipeDesc.vertexFunction = vertFunc;
+        pipeDesc.fragmentFunction = fragFunc;
+        pipeDesc.colorAttachments[0].pixelFormat = (MTLPixelFormat)[fields[2] integerValue];
+        pipeDesc.sampleCount = [fields[3] integerValue];
+        pipeDesc.depthAttachmentPixelFormat = (MTLPixelFormat)[fields[4] integerValue];
+        int compositeMode = [fields[5] intValue];
+        if (compositeMode != ARCHIVE_NO_BLENDING) {
+            [self setPipelineCompositeBlendMode:pipeDesc
+                                  compositeMode:compositeMode];
+        }
+    }
+    [vertFunc release];
+    [fragFunc release];
+    return pipeDesc;
+}
+
+// Creates a render pipeline state. With an archive, a state that was built
+// on an earlier run is loaded from it instead of being compiled, and a
+// state that is not in the archive yet is added to it.
+- (id<MTLRenderPipelineState>) newPipeStateWithDescriptor:(MTLRenderPipelineDescriptor*)pipeDesc
+                                            compositeMode:(int)compositeMode
+                                                    error:(NSError**)error
+{
+    if (binaryArchive == nil) {
+        return [device newRenderPipelineStateWithDescriptor:pipeDesc error:error];
+    }
+
+    NSString *key = pipeStateKey(pipeDesc, compositeMode);
+    [archiveLock lock];
+    id<MTLRenderPipelineState> pipeState = [prewarmedPipeStates[key] retain];
+    if (pipeState != nil) {
+        [prewarmedPipeStates removeObjectForKey:key];
+    }
+    [archiveLock unlock];
+    if (pipeState != nil) {
+        return pipeState;
+    }
+
+    pipeDesc.binaryArchives = @[binaryArchive];
+    pipeState = [device newRenderPipelineStateWithDescriptor:pipeDesc
+                                                     options:MTLPipelineOptionFailOnBinaryArchiveMiss
+                                                  reflection:nil
+                                                       error:nil];
+    if (pipeState != nil) {
+        return pipeState;
+    }
+
+    [archiveLock lock];
+    NSError *archiveError = nil;
+    if ([binaryArchive addRenderPipelineFunctionsWithDescriptor:pipeDesc error:&archiveError]) {
+        [archiveKeys addObject:key];
+        archiveDirty = true;
+        if (!archiveSaveScheduled) {
+            archiveSaveScheduled = true;
+            // The block retains self, dealloc saves whatever is left
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, ARCHIVE_SAVE_DELAY_SEC * NSEC_PER_SEC),
+                           dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+                [self saveBinaryArchive];
+            });
+        }
+    } else {
+        NSLog(@"MetalPipelineManager: Failed to add pipeline state to archive: %@", archiveError);
+    }
+    [archiveLock unlock];
+
+    return [device newRenderPipelineStateWithDescriptor:pipeDesc error:error];
+}
+
+// Opens the archive of this device, or creates an empty one if there is
+// none or it cannot be read. An archive holds GPU specific code, so the
+// registry ID of the device is part of its name.
+- (void) loadBinaryArchive:(NSString*)archivePrefix
+{
+    NSString *path = [NSString stringWithFormat:@"%@-%llx.metallib",
+                      archivePrefix, [device registryID]];
+    archiveURL = [[NSURL fileURLWithPath:path] retain];
+    archiveKeysURL = [[archiveURL URLByAppendingPathExtension:@"plist"] retain];
+
+    NSError *error = nil;
+    MTLBinaryArchiveDescriptor *archiveDesc = [[MTLBinaryArchiveDescriptor alloc] init];
+    NSArray *keys = [NSArray arrayWithContentsOfURL:archiveKeysURL];
+    if (keys != nil && [[NSFileManager defaultManager] fileExistsAtPath:path]) {
+        archiveDesc.url = archiveURL;
+        binaryArchive = [device newBinaryArchiveWithDescriptor:archiveDesc error:&error];
+        if (binaryArchive != nil) {
+            [archiveKeys addObjectsFromArray:keys];
+        } else {
+            NSLog(@"MetalPipelineManager: Ignoring unreadable pipeline archive: %@", error);
+        }
+    }
+    if (binaryArchive == nil) {
+        archiveDesc.url = nil;
+        binaryArchive = [device newBinaryArchiveWithDescriptor:archiveDesc error:&error];
+        if (binaryArchive == nil) {
+            NSLog(@"MetalPipelineManager: Failed to create pipeline archive: %@", error);
+        }
+    }
+    [archiveDesc release];
+}
+
+// Loads the states recorded in the archive on a background queue. The
+// render thread takes them from prewarmedPipeStates instead of loading
+// them itself when they are first used.
+- (void) prewarmPipeStates
+{
+    NSArray *keys = [[archiveKeys array] copy];
+    // The block retains self, so the manager outlives a prewarm in progress
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        for (NSString *key in keys) {
+            @autoreleasepool {
+                MTLRenderPipelineDescriptor *pipeDesc = [self newPipeDescriptorWithKey:key];
+                if (pipeDesc == nil) {
+                    continue;
+                }
+                pipeDesc.binaryArchives = @[binaryArchive];
+                id<MTLRenderPipelineState> pipeState =
+                    [device newRenderPipelineStateWithDescriptor:pipeDesc
+                                                         options:MTLPipelineOptionFailOnBinaryArchiveMiss
+                                                      reflection:nil
+                                                           error:nil];
+                [pipeDesc release];
+                if (pipeState != nil) {
+                    [archiveLock lock];
+                    [prewarmedPipeStates setObject:pipeState forKey:key];
+                    [archiveLock unlock];
+                    [pipeState release];
+                }
+            }
+        }
+        [keys release];
+    });
+}
+
+- (void) saveBinaryArchive
+{
+    [archiveLock lock];
+    if (archiveDirty) {
+        NSError *error = nil;
+        // The keys are written last, an archive without them is not loaded
+        [[NSFileManager defaultManager] removeItemAtURL:archiveKeysURL error:nil];
+        if ([binaryArchive serializeToURL:archiveURL error:&error]) {
+            [[archiveKeys array] writeToURL:archiveKeysURL error:&error];
+        } else {
+            NSLog(@"MetalPipelineManager: Failed to save pipeline archive: %@", error);
+        }
+        archiveDirty = false;
+    }
+    archiveSaveScheduled = false;
+    [archiveLock unlock];
+}
+
 - (void) dealloc
 {
 #ifdef JFX_MTL_DEBUG_CAPTURE
@@ -330,9 +538,19 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
         shaderLib = nil;
     }
 
-    if (uyvy422ToRGBAState != nil) {
-        [uyvy422ToRGBAState release];
-        uyvy422ToRGBAState = nil;
+    if (binaryArchive != nil) {
+        [self saveBinaryArchive];
+        [binaryArchive release];
+        binaryArchive = nil;
+    }
+    [archiveURL release];
+    [archiveKeysURL release];
+    [archiveKeys release];
+    [prewarmedPipeStates release];
+    [archiveLock release];
+
+    for (NSString *keyPipeState in computePipelineStateDict) {
+        [computePipelineStateDict[keyPipeState] release];
     }
 
     for (NSNumber *keyPipeState in clearRttPipeStateNoDepthDict) {
@@ -360,6 +578,8 @@ NSString *GPUTraceFilename = @"file:///tmp/fx_metal.gputrace";
     [phongPipelineStateNonMSAADepthDict release];
     [phongPipelineStateMSAANoDepthDict release];
     [phongPipelineStateMSAADepthDict release];
+    [computePipelineStateDict release];
+    [device release];
     [super dealloc];
 }
 
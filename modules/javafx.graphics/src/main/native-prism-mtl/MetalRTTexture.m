@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,7 +53,7 @@
         @autoreleasepool {
             MTLTextureDescriptor *texDescriptor = [MTLTextureDescriptor new];
             texDescriptor.storageMode = MTLStorageModeManaged;
-            texDescriptor.usage  = MTLTextureUsageRenderTarget;
+            texDescriptor.usage  = MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead | MTLTextureUsageShaderWrite;
             texDescriptor.width  = width;
             texDescriptor.height = height;
             texDescriptor.textureType = MTLTextureType2D;
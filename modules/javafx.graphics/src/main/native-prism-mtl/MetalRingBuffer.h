@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,13 @@
 
 #define NUM_BUFFERS (3)
 
+// A ring buffer grows, up to MAX_GROWTH times its initial size, when a command
+// buffer reserved more than it holds, and goes back to its initial size once
+// no command buffer needed more than that for SHRINK_DELAY seconds.
+#define MAX_GROWTH (4)
+#define SHRINK_DELAY (10.0)
+#define GROWTH_GRANULARITY (1024 * 1024)
+
 // The alignment varies for different platforms.
 // The alignment value can/should be retrived from device capabilities and updated accordingly.
 //
@@ -46,11 +53,22 @@
 
 @interface MetalRingBuffer : NSObject
 {
+    id<MTLDevice> device;
     id<MTLBuffer> buffer[NUM_BUFFERS];
     unsigned int currentOffset;
     unsigned int numReservedBytes;
     unsigned int bufferSize;
     unsigned int bufferOffsetAlignment;
+
+    // adaptive sizing
+    unsigned int initialSize;
+    unsigned int targetSize;
+    unsigned int spilledBytes;
+    CFAbsoluteTime lastHighUsageTime;
+
+    // statistics
+    unsigned int highWaterMark;
+    unsigned int numSpills;
 }
 
 - (MetalRingBuffer*) init:(MetalContext*)ctx
@@ -60,6 +78,9 @@
 - (id<MTLBuffer>) getCurrentBuffer;
 - (int)  reserveBytes:(unsigned int)length;
 - (unsigned int) getNumReservedBytes;
+- (unsigned int) getBufferSize;
+- (unsigned int) getHighWaterMark;
+- (unsigned int) getNumSpills;
 - (void) dealloc;
 
 + (unsigned int)  getCurrentBufferIndex;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,13 @@ static unsigned int currentBufferIndex;
     self = [super init];
     if (self) {
         bufferSize = size;
+        initialSize = size;
+        targetSize = size;
+        spilledBytes = 0;
+        lastHighUsageTime = 0;
+        highWaterMark = 0;
+        numSpills = 0;
+        device = [ctx getDevice];
         currentOffset = 0;
         numReservedBytes = 0;
         currentBufferIndex = 0;
@@ -98,10 +105,49 @@ static unsigned int currentBufferIndex;
     isBufferInUse[index] = false;
 }
 
+// Called once the command buffer that used the previous buffer has been
+// committed and currentBufferIndex refers to a buffer no longer used by the GPU.
 - (void) resetOffsets
 {
+    [self updateTargetSize:(numReservedBytes + spilledBytes)];
     currentOffset = 0;
     numReservedBytes = 0;
+    spilledBytes = 0;
+
+    id<MTLBuffer> current = buffer[currentBufferIndex];
+    if (current.length != targetSize) {
+        // Command buffers retain the buffers they use, so this one can be
+        // released even if a committed command buffer still refers to it
+        [current release];
+        current = [device newBufferWithLength:targetSize
+                                      options:MTLResourceStorageModeShared];
+        current.label = [NSString stringWithFormat:@"JFX Ring Buffer"];
+        buffer[currentBufferIndex] = current;
+    }
+    bufferSize = (unsigned int)current.length;
+}
+
+- (void) updateTargetSize:(unsigned int)usedBytes
+{
+    if (usedBytes > highWaterMark) {
+        highWaterMark = usedBytes;
+    }
+
+    CFAbsoluteTime now = CFAbsoluteTimeGetCurrent();
+    if (usedBytes > initialSize) {
+        lastHighUsageTime = now;
+    }
+
+    unsigned int maxSize = initialSize * MAX_GROWTH;
+    if (usedBytes > targetSize && targetSize < maxSize) {
+        // leave a quarter of headroom so that slowly growing usage
+        // does not cause a reallocation on every command buffer
+        unsigned long long wanted = (unsigned long long)usedBytes + usedBytes / 4;
+        wanted = (wanted + GROWTH_GRANULARITY - 1) / GROWTH_GRANULARITY * GROWTH_GRANULARITY;
+        targetSize = (wanted < maxSize) ? (unsigned int)wanted : maxSize;
+    } else if (targetSize > initialSize && now - lastHighUsageTime > SHRINK_DELAY) {
+        targetSize = initialSize;
+    }
 }
 
 - (id<MTLBuffer>) getBuffer {
@@ -121,8 +167,11 @@ static unsigned int currentBufferIndex;
     }
 
     if (currentOffset > bufferSize || length > (bufferSize - currentOffset)) {
-        // RingBuffer overflows with requested length.
+        // RingBuffer overflows with requested length. The caller uses a
+        // transient buffer, which is taken into account when sizing the ring.
         currentOffset = prevOffset;
+        spilledBytes += length;
+        numSpills++;
         return -1;
     }
     numReservedBytes = currentOffset + length;
@@ -133,6 +182,18 @@ static unsigned int currentBufferIndex;
     return numReservedBytes;
 }
 
+- (unsigned int) getBufferSize {
+    return bufferSize;
+}
+
+- (unsigned int) getHighWaterMark {
+    return highWaterMark;
+}
+
+- (unsigned int) getNumSpills {
+    return numSpills;
+}
+
 - (void) dealloc {
     for (int i = 0; i < NUM_BUFFERS; i++) {
         [buffer[i] release];
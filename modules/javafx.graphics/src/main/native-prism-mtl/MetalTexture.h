@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -81,6 +81,10 @@ enum PFormat {
                       height:(int)h
                   scanStride:(int)scanStride;
 
+- (BOOL) updateTextureYUV422FromPixelBuffer:(CVPixelBufferRef)pixelBuffer
+                                      width:(int)w
+                                     height:(int)h;
+
 - (void) dealloc;
 
 @end
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -145,7 +145,7 @@ static NSMutableDictionary *copyPixelDataToRingBuffer(MetalContext* context, voi
     @autoreleasepool {
         id<MTLBlitCommandEncoder> blitEncoder = [commandBuffer blitCommandEncoder];
 
-        if (texture.usage == MTLTextureUsageRenderTarget) {
+        if ((texture.usage & MTLTextureUsageRenderTarget) != 0) {
             [blitEncoder synchronizeTexture:texture slice:0 level:0];
         }
 
@@ -195,7 +195,7 @@ static NSMutableDictionary *copyPixelDataToRingBuffer(MetalContext* context, voi
                    destinationLevel:(NSUInteger)0
                   destinationOrigin:MTLOriginMake(dstX, dstY, 0)];
 
-        if (texture.usage == MTLTextureUsageRenderTarget) {
+        if ((texture.usage & MTLTextureUsageRenderTarget) != 0) {
             [blitEncoder synchronizeTexture:texture slice:0 level:0];
         }
 
@@ -265,6 +265,81 @@ static NSMutableDictionary *copyPixelDataToRingBuffer(MetalContext* context, voi
     }
 }
 
+// Converts a '2vuy' video frame without copying it. The IOSurface of the
+// pixel buffer is wrapped in a texture of w/2 RGBA pixels, one for each
+// Cb Y'0 Cr Y'1 group, which the uyvy422_texture_to_rgba kernel reads.
+- (BOOL) updateTextureYUV422FromPixelBuffer:(CVPixelBufferRef)pixelBuffer
+                                      width:(int)w
+                                     height:(int)h
+{
+    CVMetalTextureCacheRef textureCache = [context getVideoTextureCache];
+    if (textureCache == NULL ||
+        CVPixelBufferGetIOSurface(pixelBuffer) == NULL ||
+        CVPixelBufferGetPixelFormatType(pixelBuffer) != kCVPixelFormatType_422YpCbCr8) {
+        return NO;
+    }
+
+    w = MIN(MIN(w, (int)CVPixelBufferGetWidth(pixelBuffer)), (int)width) & ~1;
+    h = MIN(MIN(h, (int)CVPixelBufferGetHeight(pixelBuffer)), (int)height);
+    if (w <= 0 || h <= 0) {
+        return NO;
+    }
+
+    CVMetalTextureRef cvTexture = NULL;
+    CVReturn cr = CVMetalTextureCacheCreateTextureFromImage(kCFAllocatorDefault,
+                        textureCache, pixelBuffer, NULL, MTLPixelFormatRGBA8Unorm,
+                        CVPixelBufferGetWidth(pixelBuffer) / 2,
+                        CVPixelBufferGetHeight(pixelBuffer), 0, &cvTexture);
+    if (cr != kCVReturnSuccess || cvTexture == NULL) {
+        return NO;
+    }
+    id<MTLTexture> yuvTex = CVMetalTextureGetTexture(cvTexture);
+    if (yuvTex == nil) {
+        CFRelease(cvTexture);
+        return NO;
+    }
+
+    [context endCurrentRenderEncoder];
+
+    MTLSize threadgroupSize = MTLSizeMake(2, 1, 1);
+
+    MTLSize threadgroupCount;
+    threadgroupCount.width  = w / threadgroupSize.width;
+    threadgroupCount.height = h / threadgroupSize.height;
+    threadgroupCount.depth  = 1;
+
+    id<MTLComputePipelineState> computePipelineState =
+        [[context getPipelineManager] getComputePipelineStateWithFunc:@"uyvy422_texture_to_rgba"];
+
+    id<MTLCommandBuffer> commandBuffer = [context getCurrentCommandBuffer];
+    @autoreleasepool {
+        id<MTLComputeCommandEncoder> computeEncoder = [commandBuffer computeCommandEncoder];
+
+        [computeEncoder setComputePipelineState:computePipelineState];
+
+        [computeEncoder setTexture:yuvTex
+                           atIndex:0];
+
+        [computeEncoder setTexture:[self getTexture]
+                           atIndex:1];
+
+        [computeEncoder dispatchThreadgroups:threadgroupCount
+                       threadsPerThreadgroup:threadgroupSize];
+
+        [computeEncoder endEncoding];
+    }
+
+    // The decoder must not recycle the frame until the GPU has read it
+    CVPixelBufferRetain(pixelBuffer);
+    [commandBuffer addCompletedHandler:^(id<MTLCommandBuffer> cb) {
+        CFRelease(cvTexture);
+        CVPixelBufferRelease(pixelBuffer);
+    }];
+
+    [context commitCurrentCommandBuffer];
+    return YES;
+}
+
 - (id<MTLTexture>) getTexture
 {
     return texture;
@@ -405,6 +480,23 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_mtl_MTLTexture_nUpdateInt
     return 0;
 }
 
+/*
+ * Class:     com_sun_prism_mtl_MTLTexture
+ * Method:    nUpdateYUV422FromPixelBuffer
+ * Signature: (JJII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_mtl_MTLTexture_nUpdateYUV422FromPixelBuffer
+    (JNIEnv *env, jclass jClass, jlong nTexturePtr, jlong nPixelBuffer, jint w, jint h)
+{
+    MetalTexture* mtlTex = (MetalTexture*)jlong_to_ptr(nTexturePtr);
+    CVPixelBufferRef pixelBuffer = (CVPixelBufferRef)jlong_to_ptr(nPixelBuffer);
+    if (mtlTex == nil || pixelBuffer == NULL) {
+        return JNI_FALSE;
+    }
+    return [mtlTex updateTextureYUV422FromPixelBuffer:pixelBuffer width:w height:h]
+        ? JNI_TRUE : JNI_FALSE;
+}
+
 /*
  * Class:     com_sun_prism_mtl_MTLTexture
  * Method:    nUpdateInt
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -99,3 +99,108 @@ using namespace metal;
     outTex.write(half4(r, g, b, 1.0), uint2(gid.x+1, gid.y));
     */
 }
+
+// Number of output pixels produced by one threadgroup of linear_convolve.
+// Must match CONVOLVE_TILE_SIZE in MetalContext.h
+#define CONVOLVE_TILE_SIZE 256
+// LinearConvolveRenderState.MAX_COMPILED_KERNEL_SIZE
+#define CONVOLVE_MAX_KERNEL_SIZE 128
+
+struct ConvolveParams {
+    int2 srcOrigin;     // content origin of the source texture
+    int2 srcSize;       // source pixels outside of this size read as transparent
+    int2 dstOrigin;     // content origin of the destination texture
+    int2 dstSize;
+    int2 dir;           // (1, 0) for a horizontal pass, (0, 1) for a vertical pass
+    int kernelSize;
+    int isShadow;
+    float4 shadowColor;
+};
+
+// Component of v along the axis selected by dir
+static inline int axis_component(int2 v, int2 dir)
+{
+    return v.x * dir.x + v.y * dir.y;
+}
+
+/*
+ * One pass of a separable convolution whose kernel is centered on each
+ * pixel, as described by LinearConvolveRenderState.PassType.HORIZONTAL_CENTERED
+ * and VERTICAL_CENTERED: destination pixel i along the pass direction is
+ * the weighted sum of source pixels i-(kernelSize-1) through i.
+ *
+ * Each threadgroup produces CONVOLVE_TILE_SIZE adjacent pixels of one row
+ * (or column).  The source pixels they share are read into threadgroup
+ * memory once, so every source pixel is fetched from the texture at most
+ * twice instead of kernelSize times.
+ */
+[[kernel]] void linear_convolve(texture2d<float, access::read> srcTex [[texture(0)]],
+                                texture2d<float, access::write> dstTex [[texture(1)]],
+                                constant ConvolveParams &params [[buffer(0)]],
+                                constant float *weights [[buffer(1)]],
+                                uint2 tgid [[threadgroup_position_in_grid]],
+                                uint lid [[thread_index_in_threadgroup]])
+{
+    threadgroup float4 cache[CONVOLVE_TILE_SIZE + CONVOLVE_MAX_KERNEL_SIZE - 1];
+
+    const int2 dir = params.dir;
+    const int2 across = int2(dir.y, dir.x);
+    const int ksize = params.kernelSize;
+    const int srcLen = axis_component(params.srcSize, dir);
+    const int srcRows = axis_component(params.srcSize, across);
+    const int row = (int) tgid.y;
+    const int tileStart = (int) tgid.x * CONVOLVE_TILE_SIZE;
+    const int firstSrc = tileStart - (ksize - 1);
+
+    for (int i = (int) lid; i < CONVOLVE_TILE_SIZE + ksize - 1; i += CONVOLVE_TILE_SIZE) {
+        int s = firstSrc + i;
+        float4 pixel = float4(0.0);
+        if (s >= 0 && s < srcLen && row < srcRows) {
+            pixel = srcTex.read(uint2(params.srcOrigin + dir * s + across * row));
+        }
+        cache[i] = pixel;
+    }
+    threadgroup_barrier(mem_flags::mem_threadgroup);
+
+    const int d = tileStart + (int) lid;
+    if (d >= axis_component(params.dstSize, dir)) {
+        return;
+    }
+
+    float4 result;
+    if (params.isShadow) {
+        float sum = 0.0;
+        for (int k = 0; k < ksize; k++) {
+            sum += weights[k] * cache[lid + k].a;
+        }
+        result = clamp(sum, 0.0, 1.0) * params.shadowColor;
+    } else {
+        result = float4(0.0);
+        for (int k = 0; k < ksize; k++) {
+            result += weights[k] * cache[lid + k];
+        }
+    }
+    dstTex.write(result, uint2(params.dstOrigin + dir * d + across * row));
+}
+
+/*
+ * Same conversion as uyvy422_to_rgba, for a frame that is wrapped in a
+ * texture with one RGBA pixel per Cb Y'0 Cr Y'1 group instead of being
+ * copied into a buffer. See MetalTexture.updateTextureYUV422FromPixelBuffer.
+ */
+[[kernel]] void uyvy422_texture_to_rgba(texture2d<half, access::read> yuvTex [[texture(0)]],
+                                        texture2d<half, access::write> outTex [[texture(1)]],
+                                        uint2 gid [[thread_position_in_grid]])
+{
+    half4 uyvy = yuvTex.read(uint2(gid.x / 2, gid.y));
+
+    half u = uyvy.r - 0.5h;
+    half v = uyvy.b - 0.5h;
+    half y = (gid.x % 2 == 0) ? uyvy.g : uyvy.a;
+
+    half r = clamp(y + (half)(1.402 * v), 0.0h, 1.0h);
+    half g = clamp(y - (half)(0.34414 * u + 0.71414 * v), 0.0h, 1.0h);
+    half b = clamp(y + (half)(1.772 * u), 0.0h, 1.0h);
+
+    outTex.write(half4(r, g, b, 1.0h), gid);
+}
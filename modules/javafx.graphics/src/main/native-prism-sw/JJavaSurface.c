@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,7 +23,7 @@
  * questions.
  */
 
-#include <JAbstractSurface.h>
+#include <JJavaSurface.h>
 
 #include <PiscesUtil.h>
 #include <PiscesSysutils.h>
@@ -43,12 +43,6 @@ static void surface_acquire(AbstractSurface* surface, JNIEnv* env, jobject surfa
 static void surface_release(AbstractSurface* surface, JNIEnv* env,  jobject surfaceHandle);
 static void surface_cleanup(AbstractSurface* surface);
 
-typedef struct _JavaSurface {
-    AbstractSurface super;
-    jfieldID javaArrayFieldID;
-    jobject dataHandle;
-} JavaSurface;
-
 /*
  * Class:     com_sun_pisces_JavaSurface
  * Method:    initialize
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,44 +23,15 @@
  * questions.
  */
 
-#include "config.h"
-#include "RunLoop.h"
+#ifndef JJAVA_SURFACE_H
+#define JJAVA_SURFACE_H
 
-namespace WTF {
+#include <JAbstractSurface.h>
 
-// JDK-8146878
-//XXX: implement these stubs?
+typedef struct _JavaSurface {
+    AbstractSurface super;
+    jfieldID javaArrayFieldID;
+    jobject dataHandle;
+} JavaSurface;
 
-RunLoop::RunLoop() {}
-RunLoop::~RunLoop() {}
-
-void RunLoop::TimerBase::fired() {}
-
-void RunLoop::run() {}
-void RunLoop::stop() {}
-void RunLoop::wakeUp() {}
-
-RunLoop::TimerBase::TimerBase(RunLoop& runLoop)
-    : m_runLoop(runLoop)
-{
-}
-
-RunLoop::TimerBase::~TimerBase()
-{
-    stop();
-}
-
-void RunLoop::TimerBase::start(double fireInterval, bool repeat)
-{
-}
-
-void RunLoop::TimerBase::stop()
-{
-}
-
-bool RunLoop::TimerBase::isActive() const
-{
-  return true;
-}
-
-} // namespace WTF
+#endif
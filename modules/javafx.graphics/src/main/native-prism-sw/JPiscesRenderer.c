@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,10 +26,12 @@
 #include <JNIUtil.h>
 
 #include <JAbstractSurface.h>
+#include <JJavaSurface.h>
 #include <JPiscesRenderer.h>
 #include <JTransform.h>
 
 #include <PiscesBlit.h>
+#include <PiscesSimd.h>
 #include <PiscesSysutils.h>
 
 #include <PiscesRenderer.inl>
@@ -91,6 +93,25 @@ Java_com_sun_pisces_PiscesRenderer_disposeNative(JNIEnv *env, jclass cls, jlong
     }
 }
 
+JNIEXPORT jstring JNICALL
+Java_com_sun_pisces_PiscesRenderer_selectInstructionSet(JNIEnv *env, jclass cls,
+        jstring requestedHandle)
+{
+    const char *requested = NULL;
+    const char *selected;
+    if (requestedHandle != NULL) {
+        requested = (*env)->GetStringUTFChars(env, requestedHandle, NULL);
+        if (requested == NULL) {
+            return NULL;
+        }
+    }
+    selected = piscesSelectSIMDLevel(requested);
+    if (requested != NULL) {
+        (*env)->ReleaseStringUTFChars(env, requestedHandle, requested);
+    }
+    return (*env)->NewStringUTF(env, selected);
+}
+
 JNIEXPORT void JNICALL
 Java_com_sun_pisces_PiscesRenderer_setClipImpl(JNIEnv* env, jobject objectHandle,
         jint minX, jint minY, jint width, jint height) {
@@ -167,6 +188,70 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_clearRectImpl(JNIEnv*
     }
 }
 
+/*
+ * The bands of a fill are rendered at the same time on several threads.
+ * Each band renders with its own copy of the renderer, clipped to the rows
+ * from bandMinY to bandMaxY, and acquires its own copy of the surface, so
+ * the shared renderer and surface are only read.
+ */
+static void
+beginBand(Renderer* band, JavaSurface* bandSurface, Renderer* rdr,
+    jint bandMinY, jint bandMaxY)
+{
+    *bandSurface = *(JavaSurface*)rdr->_surface;
+    *band = *rdr;
+
+    band->_surface = &bandSurface->super.super;
+    band->_paint = NULL;
+    band->_paint_length = 0;
+    band->_texture_free = JNI_FALSE;
+    band->_mask_free = JNI_FALSE;
+
+    band->_clip_bbMinY = MAX(band->_clip_bbMinY, bandMinY);
+    band->_clip_bbMaxY = MIN(band->_clip_bbMaxY, bandMaxY);
+}
+
+static void
+endBand(Renderer* band) {
+    my_free(band->_paint);
+}
+
+/*
+ * Class:     com_sun_pisces_PiscesRenderer
+ * Method:    clearRectBandImpl
+ * Signature: (IIIIII)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_clearRectBandImpl(JNIEnv* env, jobject objectHandle,
+        jint x, jint y, jint w, jint h, jint bandMinY, jint bandMaxY) {
+    Renderer* rdr;
+    Renderer band;
+    JavaSurface bandSurface;
+    Surface* surface;
+    jobject surfaceHandle;
+
+    rdr = (Renderer*)JLongToPointer(
+             (*env)->GetLongField(env, objectHandle,
+                                   fieldIds[RENDERER_NATIVE_PTR]));
+    beginBand(&band, &bandSurface, rdr, bandMinY, bandMaxY);
+
+    surface = band._surface;
+    surfaceHandle = (*env)->GetObjectField(env, objectHandle, fieldIds[RENDERER_SURFACE]);
+    ACQUIRE_SURFACE(surface, env, surfaceHandle);
+    INVALIDATE_RENDERER_SURFACE(&band);
+
+    band._imagePixelStride = 1;
+    band._imageScanlineStride = surface->width;
+    renderer_clearRect(&band, x, y, w, h);
+
+    RELEASE_SURFACE(surface, env, surfaceHandle);
+    endBand(&band);
+
+    if (JNI_TRUE == readAndClearMemErrorFlag()) {
+        JNI_ThrowNew(env, "java/lang/OutOfMemoryError",
+                     "Allocation of internal renderer buffer failed.");
+    }
+}
+
 /*
  * Class:     com_sun_pisces_PiscesRenderer
  * Method:    setLinearGradientImpl
@@ -455,7 +540,9 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
     if ((x_from <= x_to) && (y_from <= y_to)) {
         rows_to_render_by_loop = y_to - y_from + 1;
 
-        SURFACE_FROM_RENDERER(surface, env, surfaceHandle, this);
+        // The surface of this renderer, or the copy of it that a band acquires
+        surface = rdr->_surface;
+        surfaceHandle = (*env)->GetObjectField(env, this, fieldIds[RENDERER_SURFACE]);
         ACQUIRE_SURFACE(surface, env, surfaceHandle);
         INVALIDATE_RENDERER_SURFACE(rdr);
         VALIDATE_BLITTING(rdr);
@@ -559,6 +646,27 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_fillRectImpl
         IMAGE_FRAC_EDGE_KEEP, IMAGE_FRAC_EDGE_KEEP);
 }
 
+/*
+ * Class:     com_sun_pisces_PiscesRenderer
+ * Method:    fillRectBandImpl
+ * Signature: (IIIIII)V
+ * renders the rows of fillRectImpl from bandMinY to bandMaxY
+ */
+JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_fillRectBandImpl
+  (JNIEnv *env, jobject this, jint x, jint y, jint w, jint h, jint bandMinY, jint bandMaxY)
+{
+    Renderer* rdr;
+    Renderer band;
+    JavaSurface bandSurface;
+
+    rdr = (Renderer*)JLongToPointer((*env)->GetLongField(env, this, fieldIds[RENDERER_NATIVE_PTR]));
+    beginBand(&band, &bandSurface, rdr, bandMinY, bandMaxY);
+    fillRect(env, this, &band, x, y, w, h,
+        IMAGE_FRAC_EDGE_KEEP, IMAGE_FRAC_EDGE_KEEP,
+        IMAGE_FRAC_EDGE_KEEP, IMAGE_FRAC_EDGE_KEEP);
+    endBand(&band);
+}
+
 /*
  * Class:     com_sun_pisces_PiscesRenderer
  * Method:    emitAndClearAlphaRowImpl
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 
 #include <PiscesSysutils.h>
 #include <PiscesMath.h>
+#include <PiscesSimd.h>
 
 #include <limits.h>
 
@@ -37,6 +38,13 @@
 #define ALPHA_SHIFT 8
 #define HALF_1_SHIFT_23 (jint)(1L << 23)
 
+/*
+ * The source over blitters first compute the coverage of up to SPAN_CHUNK
+ * pixels, then blend those that the vector blenders of PiscesSimd.c can
+ * take and finally the rest one by one.
+ */
+#define SPAN_CHUNK 64
+
 static jfloat currentGamma = -1;
 static jint gammaArray[256];
 static jint invGammaArray[256];
@@ -573,8 +581,14 @@ blitSrcOver8888_pre(Renderer *rdr, jint height) {
     jint cred = rdr->_cred;
     jint cgreen = rdr->_cgreen;
     jint cblue = rdr->_cblue;
+    jint cval = 0xff000000 | (cred << 16) | (cgreen << 8) | cblue;
     jbyte *alphaMap = rdr->alphaMap;
 
+    jint cov[SPAN_CHUNK];
+    jint i, n, covered;
+    jboolean simd = (imagePixelStride == 1 &&
+                     piscesSIMDLevel() != PISCES_SIMD_SCALAR);
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -586,18 +600,33 @@ blitSrcOver8888_pre(Renderer *rdr, jint height) {
         a = alpha;
         am = a + w;
         while (a < am) {
-            aval_relative += *a;
-            *a++ = 0;
-            if (aval_relative) {
-                aval = alphaMap[aval_relative] & 0xff;
-                aval = ((aval+1) * calpha) >> 8;
-                if (aval == MAX_ALPHA) {
-                    intData[iidx] = 0xff000000 | (cred << 16) | (cgreen << 8) | cblue;
-                } else if (aval > 0) {
-                    blendSrcOver8888_pre(&intData[iidx], aval, cred, cgreen, cblue);
+            n = (am - a < SPAN_CHUNK) ? (jint) (am - a) : SPAN_CHUNK;
+            covered = 0;
+            for (i = 0; i < n; i++) {
+                aval_relative += a[i];
+                a[i] = 0;
+                if (aval_relative) {
+                    aval = alphaMap[aval_relative] & 0xff;
+                    cov[i] = ((aval+1) * calpha) >> 8;
+                } else {
+                    cov[i] = 0;
                 }
+                covered |= cov[i];
             }
-            iidx += imagePixelStride;
+            if (covered) {
+                i = simd ? simdBlendSrcOver8888_pre(&intData[iidx], cov, n, cval) : 0;
+                for (; i < n; i++) {
+                    aval = cov[i];
+                    if (aval == MAX_ALPHA) {
+                        intData[iidx + i * imagePixelStride] = cval;
+                    } else if (aval > 0) {
+                        blendSrcOver8888_pre(&intData[iidx + i * imagePixelStride],
+                                             aval, cred, cgreen, cblue);
+                    }
+                }
+            }
+            a += n;
+            iidx += n * imagePixelStride;
         }
 
         imageOffset += imageScanlineStride;
@@ -625,6 +654,12 @@ blitSrcOverMask8888_pre(Renderer *rdr, jint height) {
     jint cred = rdr->_cred;
     jint cgreen = rdr->_cgreen;
     jint cblue = rdr->_cblue;
+    jint cval = 0xff000000 | (cred << 16) | (cgreen << 8) | cblue;
+
+    jint cov[SPAN_CHUNK];
+    jint i, n, covered;
+    jboolean simd = (imagePixelStride == 1 &&
+                     piscesSIMDLevel() != PISCES_SIMD_SCALAR);
 
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
@@ -636,18 +671,32 @@ blitSrcOverMask8888_pre(Renderer *rdr, jint height) {
         a = alpha + alphaOffset;
         am = a + w;
         while (a < am) {
-            if (*a) {
-                aval = *a & 0xff;
-                // run in integers otherwise it overflows
-                aval = ((aval+1) * calpha) >> 8;
-                if (aval == MAX_ALPHA) {
-                    intData[iidx] = 0xff000000 | (cred << 16) | (cgreen << 8) | cblue;
-                } else if (aval > 0) {
-                    blendSrcOver8888_pre(&intData[iidx], aval, cred, cgreen, cblue);
+            n = (am - a < SPAN_CHUNK) ? (jint) (am - a) : SPAN_CHUNK;
+            covered = 0;
+            for (i = 0; i < n; i++) {
+                if (a[i]) {
+                    aval = a[i] & 0xff;
+                    // run in integers otherwise it overflows
+                    cov[i] = ((aval+1) * calpha) >> 8;
+                } else {
+                    cov[i] = 0;
                 }
+                covered |= cov[i];
             }
-            a++;
-            iidx += imagePixelStride;
+            if (covered) {
+                i = simd ? simdBlendSrcOver8888_pre(&intData[iidx], cov, n, cval) : 0;
+                for (; i < n; i++) {
+                    aval = cov[i];
+                    if (aval == MAX_ALPHA) {
+                        intData[iidx + i * imagePixelStride] = cval;
+                    } else if (aval > 0) {
+                        blendSrcOver8888_pre(&intData[iidx + i * imagePixelStride],
+                                             aval, cred, cgreen, cblue);
+                    }
+                }
+            }
+            a += n;
+            iidx += n * imagePixelStride;
         }
 
         imageOffset += imageScanlineStride;
@@ -727,7 +776,12 @@ blitPTSrcOver8888_pre(Renderer *rdr, jint height) {
     jbyte *alphaMap = rdr->alphaMap;
 
     jint* paint = rdr->_paint;
-    jint palpha, malpha;
+    jint palpha;
+
+    jint frac[SPAN_CHUNK];
+    jint i, n, covered;
+    jboolean simd = (imagePixelStride == 1 &&
+                     piscesSIMDLevel() != PISCES_SIMD_SCALAR);
 
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
@@ -741,26 +795,37 @@ blitPTSrcOver8888_pre(Renderer *rdr, jint height) {
         a = alpha;
         am = a + w;
         while (a < am) {
+            n = (am - a < SPAN_CHUNK) ? (jint) (am - a) : SPAN_CHUNK;
             assert(aidx >= 0);
-            assert(aidx < rdr->_paint_length);
-
-            cval = paint[aidx];
-            palpha = A(cval);
-
-            aval_relative += *a;
-            *a++ = 0;
-            if (aval_relative) {
-                malpha = alphaMap[aval_relative] & 0xff;
-                aval = ((malpha+1) * palpha) >> 8;
-
-                if (aval == MAX_ALPHA) {
-                    intData[iidx] = cval;
-                } else if (aval > 0) {
-                    blendSrcOver8888_pre_pre(&intData[iidx], malpha+1, palpha, R(cval), G(cval), B(cval));
+            assert(aidx + n <= rdr->_paint_length);
+
+            covered = 0;
+            for (i = 0; i < n; i++) {
+                aval_relative += a[i];
+                a[i] = 0;
+                frac[i] = aval_relative ? (alphaMap[aval_relative] & 0xff) + 1 : 0;
+                covered |= frac[i];
+            }
+            if (covered) {
+                i = simd ? simdBlendSrcOver8888_pre_pre(&intData[iidx], frac, &paint[aidx], n) : 0;
+                for (; i < n; i++) {
+                    if (frac[i]) {
+                        cval = paint[aidx + i];
+                        palpha = A(cval);
+                        aval = (frac[i] * palpha) >> 8;
+
+                        if (aval == MAX_ALPHA) {
+                            intData[iidx + i * imagePixelStride] = cval;
+                        } else if (aval > 0) {
+                            blendSrcOver8888_pre_pre(&intData[iidx + i * imagePixelStride],
+                                                     frac[i], palpha, R(cval), G(cval), B(cval));
+                        }
+                    }
                 }
             }
-            iidx += imagePixelStride;
-            ++aidx;
+            a += n;
+            iidx += n * imagePixelStride;
+            aidx += n;
         }
 
         imageOffset += imageScanlineStride;
@@ -783,7 +848,12 @@ blitPTSrcOverMask8888_pre(Renderer *rdr, jint height) {
     jbyte *a, *am;
 
     jint* paint = rdr->_paint;
-    jint palpha, malpha;
+    jint palpha;
+
+    jint frac[SPAN_CHUNK];
+    jint i, n, covered;
+    jboolean simd = (imagePixelStride == 1 &&
+                     piscesSIMDLevel() != PISCES_SIMD_SCALAR);
 
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
@@ -796,22 +866,32 @@ blitPTSrcOverMask8888_pre(Renderer *rdr, jint height) {
         a = alpha + alphaOffset;
         am = a + w;
         while (a < am) {
-            if (*a) {
-                cval = paint[aidx];
-                palpha = A(cval);
-
-                malpha = *a & 0xff;
-                aval = ((malpha+1) * palpha) >> 8;
-
-                if (aval == MAX_ALPHA) {
-                    intData[iidx] = cval;
-                } else if (aval > 0) {
-                    blendSrcOver8888_pre_pre(&intData[iidx], malpha+1, palpha, R(cval), G(cval), B(cval));
+            n = (am - a < SPAN_CHUNK) ? (jint) (am - a) : SPAN_CHUNK;
+            covered = 0;
+            for (i = 0; i < n; i++) {
+                frac[i] = a[i] ? (a[i] & 0xff) + 1 : 0;
+                covered |= frac[i];
+            }
+            if (covered) {
+                i = simd ? simdBlendSrcOver8888_pre_pre(&intData[iidx], frac, &paint[aidx], n) : 0;
+                for (; i < n; i++) {
+                    if (frac[i]) {
+                        cval = paint[aidx + i];
+                        palpha = A(cval);
+                        aval = (frac[i] * palpha) >> 8;
+
+                        if (aval == MAX_ALPHA) {
+                            intData[iidx + i * imagePixelStride] = cval;
+                        } else if (aval > 0) {
+                            blendSrcOver8888_pre_pre(&intData[iidx + i * imagePixelStride],
+                                                     frac[i], palpha, R(cval), G(cval), B(cval));
+                        }
+                    }
                 }
             }
-            a++;
-            iidx += imagePixelStride;
-            ++aidx;
+            a += n;
+            iidx += n * imagePixelStride;
+            aidx += n;
         }
 
         imageOffset += imageScanlineStride;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 
 #include <PiscesSysutils.h>
 #include <PiscesMath.h>
+#include <PiscesSimd.h>
 
 #include <limits.h>
 
@@ -120,7 +121,20 @@ genLinearGradientPaint(Renderer *rdr, jint height) {
         pidx = paintOffset;
 
         frac = x * mx + y * my + b;
-        for (i = 0; i < width; i++, pidx++) {
+        if (mx == 0) {
+            // Horizontal gradient lines, the whole row has one color
+            jint cval = colors[pad((jint)frac, cycleMethod) >> (16 - LG_GRADIENT_MAP_SIZE)];
+            for (i = 0; i < width; i++, pidx++) {
+                paint[pidx] = cval;
+            }
+            paintOffset += width;
+            continue;
+        }
+
+        i = simdLinearGradient(paint + pidx, width, frac, mx, cycleMethod, colors);
+        pidx += i;
+        frac += i * mx;
+        for (; i < width; i++, pidx++) {
             jint ifrac = pad((jint)frac, cycleMethod);
             ifrac >>= 16 - LG_GRADIENT_MAP_SIZE;
             paint[pidx] = colors[ifrac];
@@ -213,7 +227,11 @@ genRadialGradientPaint(Renderer *rdr, jint height) {
         dU  = (65536.0f * dU);
         dV  = (65536.0f * 65536.0f * dV);
         ddV = (65536.0f * 65536.0f * ddV);
-        for (i = 0; i < width; i++, pidx++) {
+
+        i = simdRadialGradient(paint + pidx, width, &U, &V, &dV, dU, ddV,
+                               cycleMethod, colors);
+        pidx += i;
+        for (; i < width; i++, pidx++) {
             if (V < 0) {
                 V = 0;
             }
@@ -0,0 +1,656 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <PiscesSimd.h>
+#include <PiscesRenderer.h>
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || \
+    ((defined(__i386__) || defined(_M_IX86)) && \
+     (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SIMD_ARM64
+#include <arm_neon.h>
+#endif
+
+/*
+ * SSE2 is part of the baseline of the x86 builds. The library is not built
+ * for AVX2, so the AVX2 blenders enable it per function and are only
+ * called when the processor has it. MSVC needs no option to use it.
+ */
+#ifdef _MSC_VER
+#define SIMD_TARGET(isa)
+#else
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+static const char *simdNames[] = { "scalar", "sse2", "avx2", "neon" };
+
+static jint simdLevel = -1;
+
+static jint detectSIMDLevel(void) {
+#if defined(SIMD_ARM64)
+    // Advanced SIMD is part of the aarch64 baseline
+    return PISCES_SIMD_NEON;
+#elif defined(SIMD_X86)
+    jboolean avx2;
+#ifdef _MSC_VER
+    int info[4];
+    int maxLeaf;
+    jboolean osAVX;
+    __cpuid(info, 0);
+    maxLeaf = info[0];
+    __cpuid(info, 1);
+    // AVX2 also needs the OS to save the YMM registers
+    osAVX = (info[2] & (1 << 27)) != 0 &&
+            (info[2] & (1 << 28)) != 0 &&
+            (_xgetbv(0) & 0x6) == 0x6;
+    avx2 = JNI_FALSE;
+    if (osAVX && maxLeaf >= 7) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    avx2 = __builtin_cpu_supports("avx2") ? JNI_TRUE : JNI_FALSE;
+#endif
+    return avx2 ? PISCES_SIMD_AVX2 : PISCES_SIMD_SSE2;
+#else
+    return PISCES_SIMD_SCALAR;
+#endif
+}
+
+const char *piscesSelectSIMDLevel(const char *requested) {
+    jint level = detectSIMDLevel();
+    jint i;
+    if (requested != NULL) {
+        for (i = PISCES_SIMD_SCALAR; i <= PISCES_SIMD_NEON; i++) {
+            if (strcmp(requested, simdNames[i]) == 0) {
+                // Only step down within the same family
+                if (i == PISCES_SIMD_SCALAR ||
+                    (i != PISCES_SIMD_NEON && level != PISCES_SIMD_NEON && i < level))
+                {
+                    level = i;
+                }
+                break;
+            }
+        }
+    }
+    simdLevel = level;
+    return simdNames[level];
+}
+
+jint piscesSIMDLevel(void) {
+    if (simdLevel < 0) {
+        simdLevel = detectSIMDLevel();
+    }
+    return simdLevel;
+}
+
+/*
+ * All blenders work on 16-bit lanes, one per channel, in memory order
+ * (blue, green, red, alpha). None of the products and sums below exceed
+ * 255 * 255 + 1, and div255(x) of PiscesBlit.c, (x*257 + 257) >> 16, is
+ * the high half of (x + 1) * 257.
+ */
+
+#ifdef SIMD_X86
+
+// Spreads the 4 coverage values at cov over the channels of 4 pixels
+static INLINE void spreadSSE2(const jint *cov, __m128i *lo, __m128i *hi) {
+    __m128i c = _mm_loadu_si128((const __m128i *) cov);
+    c = _mm_packs_epi32(c, c);
+    c = _mm_unpacklo_epi16(c, c);
+    *lo = _mm_unpacklo_epi32(c, c);
+    *hi = _mm_unpackhi_epi32(c, c);
+}
+
+// s * a + (255 - a) * d, divided by 255
+static INLINE __m128i srcOverSSE2(__m128i s, __m128i d, __m128i a) {
+    __m128i v255 = _mm_set1_epi16(255);
+    __m128i x = _mm_add_epi16(_mm_mullo_epi16(s, a),
+                              _mm_mullo_epi16(_mm_sub_epi16(v255, a), d));
+    x = _mm_add_epi16(x, _mm_set1_epi16(1));
+    return _mm_mulhi_epu16(x, _mm_set1_epi16(257));
+}
+
+// (s * frac) >> 8 + (255 - (sa * frac) >> 8) * d, divided by 255
+static INLINE __m128i srcOverPreSSE2(__m128i s, __m128i d, __m128i frac) {
+    __m128i t = _mm_srli_epi16(_mm_mullo_epi16(s, frac), 8);
+    __m128i ta = _mm_shufflehi_epi16(_mm_shufflelo_epi16(t, 0xff), 0xff);
+    __m128i x = _mm_mullo_epi16(_mm_sub_epi16(_mm_set1_epi16(255), ta), d);
+    x = _mm_add_epi16(x, _mm_set1_epi16(1));
+    return _mm_add_epi16(t, _mm_mulhi_epu16(x, _mm_set1_epi16(257)));
+}
+
+static jint blendSrcOverSSE2(jint *intData, const jint *aval, jint n, jint cval) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i s = _mm_unpacklo_epi8(_mm_set1_epi32(cval), zero);
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((__m128i *) (intData + i));
+        __m128i alo, ahi, lo, hi;
+        spreadSSE2(aval + i, &alo, &ahi);
+        lo = srcOverSSE2(s, _mm_unpacklo_epi8(d, zero), alo);
+        hi = srcOverSSE2(s, _mm_unpackhi_epi8(d, zero), ahi);
+        _mm_storeu_si128((__m128i *) (intData + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+static jint blendSrcOverPreSSE2(jint *intData, const jint *frac,
+                                const jint *paint, jint n)
+{
+    __m128i zero = _mm_setzero_si128();
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((__m128i *) (intData + i));
+        __m128i s = _mm_loadu_si128((const __m128i *) (paint + i));
+        __m128i flo, fhi, lo, hi;
+        spreadSSE2(frac + i, &flo, &fhi);
+        lo = srcOverPreSSE2(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), flo);
+        hi = srcOverPreSSE2(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), fhi);
+        _mm_storeu_si128((__m128i *) (intData + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+/*
+ * The AVX2 versions do 8 pixels at a time. The unpack and pack
+ * instructions work within each 128-bit half, so the pixels come back in
+ * the order they were loaded.
+ */
+
+SIMD_TARGET("avx2")
+static INLINE void spreadAVX2(const jint *cov, __m256i *lo, __m256i *hi) {
+    __m256i c = _mm256_loadu_si256((const __m256i *) cov);
+    c = _mm256_packs_epi32(c, c);
+    c = _mm256_unpacklo_epi16(c, c);
+    *lo = _mm256_unpacklo_epi32(c, c);
+    *hi = _mm256_unpackhi_epi32(c, c);
+}
+
+SIMD_TARGET("avx2")
+static INLINE __m256i srcOverAVX2(__m256i s, __m256i d, __m256i a) {
+    __m256i v255 = _mm256_set1_epi16(255);
+    __m256i x = _mm256_add_epi16(_mm256_mullo_epi16(s, a),
+                                 _mm256_mullo_epi16(_mm256_sub_epi16(v255, a), d));
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(1));
+    return _mm256_mulhi_epu16(x, _mm256_set1_epi16(257));
+}
+
+SIMD_TARGET("avx2")
+static INLINE __m256i srcOverPreAVX2(__m256i s, __m256i d, __m256i frac) {
+    __m256i t = _mm256_srli_epi16(_mm256_mullo_epi16(s, frac), 8);
+    __m256i ta = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(t, 0xff), 0xff);
+    __m256i x = _mm256_mullo_epi16(_mm256_sub_epi16(_mm256_set1_epi16(255), ta), d);
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(1));
+    return _mm256_add_epi16(t, _mm256_mulhi_epu16(x, _mm256_set1_epi16(257)));
+}
+
+SIMD_TARGET("avx2")
+static jint blendSrcOverAVX2(jint *intData, const jint *aval, jint n, jint cval) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i s = _mm256_unpacklo_epi8(_mm256_set1_epi32(cval), zero);
+    jint i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256((__m256i *) (intData + i));
+        __m256i alo, ahi, lo, hi;
+        spreadAVX2(aval + i, &alo, &ahi);
+        lo = srcOverAVX2(s, _mm256_unpacklo_epi8(d, zero), alo);
+        hi = srcOverAVX2(s, _mm256_unpackhi_epi8(d, zero), ahi);
+        _mm256_storeu_si256((__m256i *) (intData + i), _mm256_packus_epi16(lo, hi));
+    }
+    return i + blendSrcOverSSE2(intData + i, aval + i, n - i, cval);
+}
+
+SIMD_TARGET("avx2")
+static jint blendSrcOverPreAVX2(jint *intData, const jint *frac,
+                                const jint *paint, jint n)
+{
+    __m256i zero = _mm256_setzero_si256();
+    jint i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256((__m256i *) (intData + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *) (paint + i));
+        __m256i flo, fhi, lo, hi;
+        spreadAVX2(frac + i, &flo, &fhi);
+        lo = srcOverPreAVX2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), flo);
+        hi = srcOverPreAVX2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), fhi);
+        _mm256_storeu_si256((__m256i *) (intData + i), _mm256_packus_epi16(lo, hi));
+    }
+    return i + blendSrcOverPreSSE2(intData + i, frac + i, paint + i, n - i);
+}
+
+#endif /* SIMD_X86 */
+
+#ifdef SIMD_ARM64
+
+static INLINE uint16x8_t spreadNEON(const jint *cov) {
+    return vcombine_u16(vdup_n_u16((uint16_t) cov[0]),
+                        vdup_n_u16((uint16_t) cov[1]));
+}
+
+// div255 as ((x + 1) + ((x + 1) >> 8)) >> 8, which is the same value
+static INLINE uint16x8_t div255NEON(uint16x8_t x) {
+    x = vaddq_u16(x, vdupq_n_u16(1));
+    return vshrq_n_u16(vsraq_n_u16(x, x, 8), 8);
+}
+
+static INLINE uint16x8_t srcOverNEON(uint16x8_t s, uint16x8_t d, uint16x8_t a) {
+    uint16x8_t x = vmlaq_u16(vmulq_u16(s, a),
+                             vsubq_u16(vdupq_n_u16(255), a), d);
+    return div255NEON(x);
+}
+
+static INLINE uint16x8_t srcOverPreNEON(uint16x8_t s, uint16x8_t d, uint16x8_t frac) {
+    uint16x8_t t = vshrq_n_u16(vmulq_u16(s, frac), 8);
+    uint16x8_t ta = vcombine_u16(vdup_lane_u16(vget_low_u16(t), 3),
+                                 vdup_lane_u16(vget_high_u16(t), 3));
+    uint16x8_t x = vmulq_u16(vsubq_u16(vdupq_n_u16(255), ta), d);
+    return vaddq_u16(t, div255NEON(x));
+}
+
+static jint blendSrcOverNEON(jint *intData, const jint *aval, jint n, jint cval) {
+    uint16x8_t s = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32((uint32_t) cval)));
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        uint8x16_t d = vreinterpretq_u8_s32(vld1q_s32(intData + i));
+        uint16x8_t lo = srcOverNEON(s, vmovl_u8(vget_low_u8(d)), spreadNEON(aval + i));
+        uint16x8_t hi = srcOverNEON(s, vmovl_u8(vget_high_u8(d)), spreadNEON(aval + i + 2));
+        vst1q_s32(intData + i,
+                  vreinterpretq_s32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi))));
+    }
+    return i;
+}
+
+static jint blendSrcOverPreNEON(jint *intData, const jint *frac,
+                                const jint *paint, jint n)
+{
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        uint8x16_t d = vreinterpretq_u8_s32(vld1q_s32(intData + i));
+        uint8x16_t s = vreinterpretq_u8_s32(vld1q_s32(paint + i));
+        uint16x8_t lo = srcOverPreNEON(vmovl_u8(vget_low_u8(s)),
+                                       vmovl_u8(vget_low_u8(d)), spreadNEON(frac + i));
+        uint16x8_t hi = srcOverPreNEON(vmovl_u8(vget_high_u8(s)),
+                                       vmovl_u8(vget_high_u8(d)), spreadNEON(frac + i + 2));
+        vst1q_s32(intData + i,
+                  vreinterpretq_s32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi))));
+    }
+    return i;
+}
+
+#endif /* SIMD_ARM64 */
+
+/*
+ * The gradient generators compute the 16.16 positions of 4 or 8 pixels at
+ * a time, pad them like pad() of PiscesPaint.c and look the colors up in
+ * the gradient map.
+ */
+
+#define GRADIENT_SHIFT (16 - LG_GRADIENT_MAP_SIZE)
+
+#ifdef SIMD_X86
+
+static INLINE __m128i padSSE2(__m128i f, jint cycleMethod) {
+    __m128i vffff = _mm_set1_epi32(0xffff);
+    __m128i m;
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        f = _mm_and_si128(f, _mm_cmpgt_epi32(f, _mm_setzero_si128()));
+        m = _mm_cmpgt_epi32(f, vffff);
+        return _mm_or_si128(_mm_andnot_si128(m, f), _mm_and_si128(m, vffff));
+    case CYCLE_REPEAT:
+        return _mm_and_si128(f, vffff);
+    case CYCLE_REFLECT:
+        m = _mm_srai_epi32(f, 31);
+        f = _mm_sub_epi32(_mm_xor_si128(f, m), m);
+        f = _mm_and_si128(f, _mm_set1_epi32(0x1ffff));
+        // 0x1ffff - f is f ^ 0x1ffff for f from 0x10000 to 0x1ffff
+        m = _mm_cmpgt_epi32(f, vffff);
+        return _mm_xor_si128(f, _mm_and_si128(m, _mm_set1_epi32(0x1ffff)));
+    }
+    return f;
+}
+
+static INLINE void lookupSSE2(jint *paint, __m128i f, const jint *colors) {
+    jint idx[4];
+    _mm_storeu_si128((__m128i *) idx, _mm_srli_epi32(f, GRADIENT_SHIFT));
+    paint[0] = colors[idx[0]];
+    paint[1] = colors[idx[1]];
+    paint[2] = colors[idx[2]];
+    paint[3] = colors[idx[3]];
+}
+
+static jint linearGradientSSE2(jint *paint, jint n, jfloat frac, jfloat mx,
+                               jint cycleMethod, const jint *colors)
+{
+    __m128 vfrac = _mm_set1_ps(frac);
+    __m128 vmx = _mm_set1_ps(mx);
+    __m128i k = _mm_setr_epi32(0, 1, 2, 3);
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128 f = _mm_add_ps(vfrac, _mm_mul_ps(_mm_cvtepi32_ps(k), vmx));
+        lookupSSE2(paint + i, padSSE2(_mm_cvttps_epi32(f), cycleMethod), colors);
+        k = _mm_add_epi32(k, _mm_set1_epi32(4));
+    }
+    return i;
+}
+
+// (jint) (U + sqrt(V)) with the sum and the square root in double
+static INLINE __m128i radialFracSSE2(__m128 U, __m128 V) {
+    __m128d lo = _mm_add_pd(_mm_cvtps_pd(U), _mm_sqrt_pd(_mm_cvtps_pd(V)));
+    __m128d hi = _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(U, U)),
+                            _mm_sqrt_pd(_mm_cvtps_pd(_mm_movehl_ps(V, V))));
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+}
+
+static jint radialGradientSSE2(jint *paint, jint n, jfloat *lanes,
+                               jfloat dU, jfloat ddV,
+                               jint cycleMethod, const jint *colors)
+{
+    __m128 U = _mm_loadu_ps(lanes);
+    __m128 V = _mm_loadu_ps(lanes + 4);
+    __m128 dV = _mm_loadu_ps(lanes + 8);
+    __m128 stepU = _mm_set1_ps(4 * dU);
+    __m128 stepV = _mm_set1_ps(6 * ddV);
+    __m128 stepdV = _mm_set1_ps(4 * ddV);
+    __m128 four = _mm_set1_ps(4.0f);
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128 Vc = _mm_max_ps(V, _mm_setzero_ps());
+        lookupSSE2(paint + i, padSSE2(radialFracSSE2(U, Vc), cycleMethod), colors);
+        U = _mm_add_ps(U, stepU);
+        V = _mm_add_ps(V, _mm_add_ps(_mm_mul_ps(four, dV), stepV));
+        dV = _mm_add_ps(dV, stepdV);
+    }
+    _mm_storeu_ps(lanes, U);
+    _mm_storeu_ps(lanes + 4, V);
+    _mm_storeu_ps(lanes + 8, dV);
+    return i;
+}
+
+SIMD_TARGET("avx2")
+static INLINE __m256i padAVX2(__m256i f, jint cycleMethod) {
+    __m256i vffff = _mm256_set1_epi32(0xffff);
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        return _mm256_min_epi32(_mm256_max_epi32(f, _mm256_setzero_si256()), vffff);
+    case CYCLE_REPEAT:
+        return _mm256_and_si256(f, vffff);
+    case CYCLE_REFLECT:
+        f = _mm256_and_si256(_mm256_abs_epi32(f), _mm256_set1_epi32(0x1ffff));
+        return _mm256_xor_si256(f, _mm256_and_si256(_mm256_cmpgt_epi32(f, vffff),
+                                                    _mm256_set1_epi32(0x1ffff)));
+    }
+    return f;
+}
+
+SIMD_TARGET("avx2")
+static jint linearGradientAVX2(jint *paint, jint n, jfloat frac, jfloat mx,
+                               jint cycleMethod, const jint *colors)
+{
+    __m256 vfrac = _mm256_set1_ps(frac);
+    __m256 vmx = _mm256_set1_ps(mx);
+    __m256i k = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    jint i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256 f = _mm256_add_ps(vfrac, _mm256_mul_ps(_mm256_cvtepi32_ps(k), vmx));
+        __m256i fi = padAVX2(_mm256_cvttps_epi32(f), cycleMethod);
+        _mm256_storeu_si256((__m256i *) (paint + i),
+            _mm256_i32gather_epi32((const int *) colors,
+                                   _mm256_srli_epi32(fi, GRADIENT_SHIFT), 4));
+        k = _mm256_add_epi32(k, _mm256_set1_epi32(8));
+    }
+    return i;
+}
+
+SIMD_TARGET("avx2")
+static jint radialGradientAVX2(jint *paint, jint n, jfloat *lanes,
+                               jfloat dU, jfloat ddV,
+                               jint cycleMethod, const jint *colors)
+{
+    __m256 U = _mm256_loadu_ps(lanes);
+    __m256 V = _mm256_loadu_ps(lanes + 8);
+    __m256 dV = _mm256_loadu_ps(lanes + 16);
+    __m256 stepU = _mm256_set1_ps(8 * dU);
+    __m256 stepV = _mm256_set1_ps(28 * ddV);
+    __m256 stepdV = _mm256_set1_ps(8 * ddV);
+    __m256 eight = _mm256_set1_ps(8.0f);
+    jint i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256 Vc = _mm256_max_ps(V, _mm256_setzero_ps());
+        __m256d lo = _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(U)),
+                                   _mm256_sqrt_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(Vc))));
+        __m256d hi = _mm256_add_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(U, 1)),
+                                   _mm256_sqrt_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(Vc, 1))));
+        __m256i fi = _mm256_set_m128i(_mm256_cvttpd_epi32(hi), _mm256_cvttpd_epi32(lo));
+        fi = padAVX2(fi, cycleMethod);
+        _mm256_storeu_si256((__m256i *) (paint + i),
+            _mm256_i32gather_epi32((const int *) colors,
+                                   _mm256_srli_epi32(fi, GRADIENT_SHIFT), 4));
+        U = _mm256_add_ps(U, stepU);
+        V = _mm256_add_ps(V, _mm256_add_ps(_mm256_mul_ps(eight, dV), stepV));
+        dV = _mm256_add_ps(dV, stepdV);
+    }
+    _mm256_storeu_ps(lanes, U);
+    _mm256_storeu_ps(lanes + 8, V);
+    _mm256_storeu_ps(lanes + 16, dV);
+    return i;
+}
+
+#endif /* SIMD_X86 */
+
+#ifdef SIMD_ARM64
+
+static INLINE int32x4_t padNEON(int32x4_t f, jint cycleMethod) {
+    int32x4_t vffff = vdupq_n_s32(0xffff);
+    uint32x4_t m;
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        return vminq_s32(vmaxq_s32(f, vdupq_n_s32(0)), vffff);
+    case CYCLE_REPEAT:
+        return vandq_s32(f, vffff);
+    case CYCLE_REFLECT:
+        f = vandq_s32(vabsq_s32(f), vdupq_n_s32(0x1ffff));
+        m = vcgtq_s32(f, vffff);
+        return veorq_s32(f, vandq_s32(vreinterpretq_s32_u32(m), vdupq_n_s32(0x1ffff)));
+    }
+    return f;
+}
+
+static INLINE void lookupNEON(jint *paint, int32x4_t f, const jint *colors) {
+    jint idx[4];
+    vst1q_s32(idx, vshrq_n_s32(f, GRADIENT_SHIFT));
+    paint[0] = colors[idx[0]];
+    paint[1] = colors[idx[1]];
+    paint[2] = colors[idx[2]];
+    paint[3] = colors[idx[3]];
+}
+
+static jint linearGradientNEON(jint *paint, jint n, jfloat frac, jfloat mx,
+                               jint cycleMethod, const jint *colors)
+{
+    static const int32_t k0[4] = { 0, 1, 2, 3 };
+    float32x4_t vfrac = vdupq_n_f32(frac);
+    float32x4_t vmx = vdupq_n_f32(mx);
+    int32x4_t k = vld1q_s32(k0);
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        // No fused multiply-add, to round like the x86 versions
+        float32x4_t f = vaddq_f32(vfrac, vmulq_f32(vcvtq_f32_s32(k), vmx));
+        lookupNEON(paint + i, padNEON(vcvtq_s32_f32(f), cycleMethod), colors);
+        k = vaddq_s32(k, vdupq_n_s32(4));
+    }
+    return i;
+}
+
+static INLINE int32x2_t radialFracNEON(float32x2_t U, float32x2_t V) {
+    float64x2_t sum = vaddq_f64(vcvt_f64_f32(U), vsqrtq_f64(vcvt_f64_f32(V)));
+    return vqmovn_s64(vcvtq_s64_f64(sum));
+}
+
+static jint radialGradientNEON(jint *paint, jint n, jfloat *lanes,
+                               jfloat dU, jfloat ddV,
+                               jint cycleMethod, const jint *colors)
+{
+    float32x4_t U = vld1q_f32(lanes);
+    float32x4_t V = vld1q_f32(lanes + 4);
+    float32x4_t dV = vld1q_f32(lanes + 8);
+    float32x4_t stepU = vdupq_n_f32(4 * dU);
+    float32x4_t stepV = vdupq_n_f32(6 * ddV);
+    float32x4_t stepdV = vdupq_n_f32(4 * ddV);
+    float32x4_t four = vdupq_n_f32(4.0f);
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        float32x4_t Vc = vmaxq_f32(V, vdupq_n_f32(0.0f));
+        int32x4_t fi = vcombine_s32(radialFracNEON(vget_low_f32(U), vget_low_f32(Vc)),
+                                    radialFracNEON(vget_high_f32(U), vget_high_f32(Vc)));
+        lookupNEON(paint + i, padNEON(fi, cycleMethod), colors);
+        U = vaddq_f32(U, stepU);
+        V = vaddq_f32(V, vaddq_f32(vmulq_f32(four, dV), stepV));
+        dV = vaddq_f32(dV, stepdV);
+    }
+    vst1q_f32(lanes, U);
+    vst1q_f32(lanes + 4, V);
+    vst1q_f32(lanes + 8, dV);
+    return i;
+}
+
+#endif /* SIMD_ARM64 */
+
+jint simdLinearGradient(jint *paint, jint n, jfloat frac, jfloat mx,
+                        jint cycleMethod, const jint *colors)
+{
+    switch (piscesSIMDLevel()) {
+#ifdef SIMD_X86
+    case PISCES_SIMD_AVX2:
+        return linearGradientAVX2(paint, n, frac, mx, cycleMethod, colors);
+    case PISCES_SIMD_SSE2:
+        return linearGradientSSE2(paint, n, frac, mx, cycleMethod, colors);
+#endif
+#ifdef SIMD_ARM64
+    case PISCES_SIMD_NEON:
+        return linearGradientNEON(paint, n, frac, mx, cycleMethod, colors);
+#endif
+    default:
+        return 0;
+    }
+}
+
+jint simdRadialGradient(jint *paint, jint n, jfloat *U, jfloat *V, jfloat *dV,
+                        jfloat dU, jfloat ddV,
+                        jint cycleMethod, const jint *colors)
+{
+    // U, V and dV of 8 consecutive pixels, one pixel per lane
+    jfloat lanes[24];
+    jint level = piscesSIMDLevel();
+    jint width = (level == PISCES_SIMD_AVX2) ? 8 : 4;
+    jfloat u = *U, v = *V, dv = *dV;
+    jint i, done;
+
+    if (level == PISCES_SIMD_SCALAR || n < width) {
+        return 0;
+    }
+    // The first pixels are stepped like the scalar loop
+    for (i = 0; i < width; i++) {
+        if (v < 0) {
+            v = 0;
+        }
+        lanes[i] = u;
+        lanes[width + i] = v;
+        lanes[2 * width + i] = dv;
+        u += dU;
+        v += dv;
+        dv += ddV;
+    }
+    switch (level) {
+#ifdef SIMD_X86
+    case PISCES_SIMD_AVX2:
+        done = radialGradientAVX2(paint, n, lanes, dU, ddV, cycleMethod, colors);
+        break;
+    case PISCES_SIMD_SSE2:
+        done = radialGradientSSE2(paint, n, lanes, dU, ddV, cycleMethod, colors);
+        break;
+#endif
+#ifdef SIMD_ARM64
+    case PISCES_SIMD_NEON:
+        done = radialGradientNEON(paint, n, lanes, dU, ddV, cycleMethod, colors);
+        break;
+#endif
+    default:
+        return 0;
+    }
+    // The first lane has stepped to the first pixel that is left
+    *U = lanes[0];
+    *V = lanes[width];
+    *dV = lanes[2 * width];
+    return done;
+}
+
+jint simdBlendSrcOver8888_pre(jint *intData, const jint *aval, jint n,
+                              jint cval)
+{
+    switch (piscesSIMDLevel()) {
+#ifdef SIMD_X86
+    case PISCES_SIMD_AVX2:
+        return blendSrcOverAVX2(intData, aval, n, cval);
+    case PISCES_SIMD_SSE2:
+        return blendSrcOverSSE2(intData, aval, n, cval);
+#endif
+#ifdef SIMD_ARM64
+    case PISCES_SIMD_NEON:
+        return blendSrcOverNEON(intData, aval, n, cval);
+#endif
+    default:
+        return 0;
+    }
+}
+
+jint simdBlendSrcOver8888_pre_pre(jint *intData, const jint *frac,
+                                  const jint *paint, jint n)
+{
+    switch (piscesSIMDLevel()) {
+#ifdef SIMD_X86
+    case PISCES_SIMD_AVX2:
+        return blendSrcOverPreAVX2(intData, frac, paint, n);
+    case PISCES_SIMD_SSE2:
+        return blendSrcOverPreSSE2(intData, frac, paint, n);
+#endif
+#ifdef SIMD_ARM64
+    case PISCES_SIMD_NEON:
+        return blendSrcOverPreNEON(intData, frac, paint, n);
+#endif
+    default:
+        return 0;
+    }
+}
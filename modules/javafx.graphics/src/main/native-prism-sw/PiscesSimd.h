@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef PISCES_SIMD_H
+#define PISCES_SIMD_H
+
+#include <PiscesDefs.h>
+
+#define PISCES_SIMD_SCALAR 0
+#define PISCES_SIMD_SSE2   1
+#define PISCES_SIMD_AVX2   2
+#define PISCES_SIMD_NEON   3
+
+/*
+ * Selects the widest instruction set the processor supports for the span
+ * blenders, or the requested one ("scalar", "sse2", "avx2", "neon") if it
+ * is lower, and returns the name of the one in use. The processor is also
+ * checked on the first blit if this is never called.
+ */
+const char *piscesSelectSIMDLevel(const char *requested);
+
+jint piscesSIMDLevel(void);
+
+/*
+ * The blenders below produce the same pixels as blendSrcOver8888_pre and
+ * blendSrcOver8888_pre_pre in PiscesBlit.c, including the pixels with no
+ * coverage, which they leave unchanged. They blend the first pixels of
+ * the span in groups of 4 or 8 and return how many they blended, so the
+ * caller blends the rest, and all of them at the scalar level.
+ */
+
+/*
+ * Blends the opaque color cval (0xffRRGGBB) into the n pixels at intData,
+ * each with the coverage aval[i] from 0 to 255.
+ */
+jint simdBlendSrcOver8888_pre(jint *intData, const jint *aval, jint n,
+                              jint cval);
+
+/*
+ * Blends the premultiplied paint pixels into the n pixels at intData, each
+ * scaled by frac[i] from 0 (no coverage) to 256 (full coverage).
+ */
+jint simdBlendSrcOver8888_pre_pre(jint *intData, const jint *frac,
+                                  const jint *paint, jint n);
+
+
+/*
+ * Fills the n paint pixels with the colors of a linear gradient, pixel i
+ * at the 16.16 position frac + i * mx. The positions are computed per
+ * pixel instead of stepped, so they can differ by one map entry from the
+ * scalar loop.
+ */
+jint simdLinearGradient(jint *paint, jint n, jfloat frac, jfloat mx,
+                        jint cycleMethod, const jint *colors);
+
+/*
+ * Fills the n paint pixels with the colors of a radial gradient that
+ * genRadialGradientPaint steps with U, V and dV. On return these hold the
+ * values for the first pixel that is left.
+ */
+jint simdRadialGradient(jint *paint, jint n, jfloat *U, jfloat *V, jfloat *dV,
+                        jfloat dU, jfloat ddV,
+                        jint cycleMethod, const jint *colors);
+
+#endif
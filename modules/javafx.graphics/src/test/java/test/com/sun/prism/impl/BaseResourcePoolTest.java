@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.prism.impl;
+
+import com.sun.prism.impl.BaseResourcePool;
+import com.sun.prism.impl.ManagedResource;
+import com.sun.prism.impl.ResourcePool;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+public class BaseResourcePoolTest {
+
+    private static class TestPool extends BaseResourcePool<Long> {
+        TestPool(long target, long max) {
+            super(target, max);
+        }
+
+        @Override
+        public long size(Long resource) {
+            return resource;
+        }
+    }
+
+    private static class TestResource extends ManagedResource<Long> {
+        TestResource(long size, ResourcePool<Long> pool, int age) {
+            super(size, pool);
+            unlock();
+            for (int i = 0; i < age; i++) {
+                bumpAge(1024);
+            }
+        }
+    }
+
+    @Test
+    public void testLeastRecentlyUsedResourcesAreEvictedFirst() {
+        TestPool pool = new TestPool(100, 100);
+        TestResource oldest = new TestResource(20, pool, 30);
+        TestResource older = new TestResource(20, pool, 20);
+        TestResource old = new TestResource(20, pool, 15);
+        TestResource recent = new TestResource(20, pool, 5);
+
+        assertTrue(pool.prepareForAllocation(30));
+
+        // Freeing the oldest resource is enough to make room
+        assertFalse(oldest.isValid());
+        assertTrue(older.isValid());
+        assertTrue(old.isValid());
+        assertTrue(recent.isValid());
+        assertEquals(60, pool.used());
+    }
+
+    @Test
+    public void testStatistics() {
+        TestPool pool = new TestPool(100, 100);
+        new TestResource(40, pool, 50);
+        new TestResource(40, pool, 50);
+
+        assertTrue(pool.prepareForAllocation(30));
+        assertFalse(pool.prepareForAllocation(200));
+
+        ResourcePool.Statistics stats = pool.getStatistics();
+        assertEquals(2, stats.allocations());
+        assertEquals(80, stats.peakManaged());
+        assertEquals(100, stats.max());
+        assertTrue(stats.evictions() >= 1);
+        assertEquals(stats.evictions() * 40, stats.evictedSize());
+        assertEquals(1, stats.failedAllocations());
+        assertEquals(pool.managed(), stats.managed());
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -289,6 +289,11 @@ public class PrismMediaFrameHandler implements ResourceFactoryListener {
             }
             return new PrismFrameBuffer(newVDB);
         }
+
+        @Override
+        public long getNativeFrameHandle() {
+            return primary.getNativeFrameHandle();
+        }
     }
 
     private static class TextureMapEntry {
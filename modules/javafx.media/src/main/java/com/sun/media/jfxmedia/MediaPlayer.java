@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -344,6 +344,13 @@ public interface MediaPlayer {
      * @return the current player state.
      */
     public PlayerState getState();
+    /**
+     * Retrieves the playback counters of the player, such as the number of
+     * decoded and dropped video frames.
+     * @return a snapshot of the counters, or <code>null</code> if the platform
+     * does not collect them or the player has been disposed.
+     */
+    public MediaStatistics getStatistics();
     /**
      * Release any resources held by this player. The player will be unusable
      * after this method is invoked.
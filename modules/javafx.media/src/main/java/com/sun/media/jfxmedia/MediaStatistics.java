@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.media.jfxmedia;
+
+/**
+ * A snapshot of the playback counters of a {@link MediaPlayer}. Frame and
+ * read counters accumulate from the start of playback, queue levels are
+ * sampled when the snapshot is taken.
+ */
+public final class MediaStatistics {
+    // Indices into the native statistics array, must match CPipelineStatistics
+    public static final int FRAMES_DECODED = 0;
+    public static final int FRAMES_DROPPED = 1;
+    public static final int FRAMES_LATE = 2;
+    public static final int AUDIO_QUEUE_LEVEL = 3;
+    public static final int VIDEO_QUEUE_LEVEL = 4;
+    public static final int READS = 5;
+    public static final int READ_TIME = 6;
+    public static final int MAX_READ_TIME = 7;
+    public static final int NUM_STATISTICS = 8;
+
+    private final long[] values;
+
+    /**
+     * Creates a snapshot from the values indexed by the constants of this
+     * class.
+     *
+     * @param values the counters, at least {@link #NUM_STATISTICS} long.
+     * @throws IllegalArgumentException if <code>values</code> is too short.
+     */
+    public MediaStatistics(long[] values) {
+        if (values == null || values.length < NUM_STATISTICS) {
+            throw new IllegalArgumentException("values.length < " + NUM_STATISTICS);
+        }
+        this.values = values.clone();
+    }
+
+    /**
+     * @return the number of video frames delivered by the decoder.
+     */
+    public long getFramesDecoded() {
+        return values[FRAMES_DECODED];
+    }
+
+    /**
+     * @return the number of video frames dropped because they were too late
+     * to be shown.
+     */
+    public long getFramesDropped() {
+        return values[FRAMES_DROPPED];
+    }
+
+    /**
+     * @return the number of video frames shown after their presentation time.
+     */
+    public long getFramesLate() {
+        return values[FRAMES_LATE];
+    }
+
+    /**
+     * @return the number of buffers waiting to be decoded in the audio queue.
+     */
+    public long getAudioQueueLevel() {
+        return values[AUDIO_QUEUE_LEVEL];
+    }
+
+    /**
+     * @return the number of buffers waiting to be decoded in the video queue.
+     */
+    public long getVideoQueueLevel() {
+        return values[VIDEO_QUEUE_LEVEL];
+    }
+
+    /**
+     * @return the number of blocks read from the media source.
+     */
+    public long getReadCount() {
+        return values[READS];
+    }
+
+    /**
+     * @return the total time spent reading blocks, in microseconds.
+     */
+    public long getReadTime() {
+        return values[READ_TIME];
+    }
+
+    /**
+     * @return the longest time spent reading a single block, in microseconds.
+     */
+    public long getMaxReadTime() {
+        return values[MAX_READ_TIME];
+    }
+
+    @Override
+    public String toString() {
+        return "MediaStatistics[framesDecoded=" + getFramesDecoded()
+                + ", framesDropped=" + getFramesDropped()
+                + ", framesLate=" + getFramesLate()
+                + ", audioQueueLevel=" + getAudioQueueLevel()
+                + ", videoQueueLevel=" + getVideoQueueLevel()
+                + ", readCount=" + getReadCount()
+                + ", readTime=" + getReadTime()
+                + ", maxReadTime=" + getMaxReadTime() + "]";
+    }
+}
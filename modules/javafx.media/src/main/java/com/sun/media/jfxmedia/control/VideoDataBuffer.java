@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -133,6 +133,13 @@ public interface VideoDataBuffer {
      */
     public VideoDataBuffer convertToFormat(VideoFormat newFormat);
 
+    /**
+     * Returns the platform object holding the decoded image, for example the
+     * {@code CVPixelBufferRef} of a frame decoded by AVFoundation.
+     * @return the native frame handle, or zero if the platform has none
+     */
+    public long getNativeFrameHandle();
+
     /**
      * Flags a video buffer indicating the contents of the buffer have been
      * updated and any cached representations need to be updated.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,7 +45,9 @@ import java.util.Map;
  *
  */
 public abstract class ConnectionHolder {
-    private static int DEFAULT_BUFFER_SIZE = 4096;
+    // Each block costs a native upcall from the source element, so keep them
+    // reasonably large
+    private static int DEFAULT_BUFFER_SIZE = 65536;
 
     ReadableByteChannel channel;
     ByteBuffer          buffer = ByteBuffer.allocateDirect(DEFAULT_BUFFER_SIZE);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -65,7 +65,14 @@ final class HLSConnectionHolder extends ConnectionHolder {
     private final Object newPlaylistLock = new Object();
     private boolean isBitrateAdjustable = false;
     private boolean hasAudioExtStream = false;
-    private long readStartTime = -1;
+    // Time spent in network reads and bytes read for the current segment.
+    // Time the source spends blocked because the buffer is full is not
+    // counted, so the throughput estimate reflects the network only.
+    private long segmentReadTime = 0;
+    private long segmentReadBytes = 0;
+    // Smoothed throughput estimate in bits per second, -1 until the first
+    // segment has been downloaded.
+    private double bandwidthEstimate = -1;
     private boolean sendHeader = false;
     private boolean isInitialized = false;
     private int duration = -1;
@@ -73,6 +80,14 @@ final class HLSConnectionHolder extends ConnectionHolder {
     // Seek will set this value and HLS_PROP_SEGMENT_START_TIME
     // should return it if set.
     private int segmentStartTimeAfterSeek = -1;
+    // Weight of the latest segment in the smoothed throughput estimate
+    static final double BANDWIDTH_ESTIMATE_WEIGHT = 0.3;
+    // Fraction of the estimated throughput a variant may use
+    static final double BANDWIDTH_SAFETY_FACTOR = 0.8;
+    // When set, live streams start at the newest segment in the playlist
+    // instead of the oldest one, which keeps playback close to the live edge.
+    static final boolean HLS_LOW_LATENCY =
+            Boolean.getBoolean("jfxmedia.hls.lowlatency");
     static final long HLS_VALUE_FLOAT_MULTIPLIER = 1000;
     static final int HLS_PROP_GET_DURATION = 1;
     static final int HLS_PROP_GET_HLS_MODE = 2;
@@ -109,10 +124,6 @@ final class HLSConnectionHolder extends ConnectionHolder {
 
     @Override
     public int readNextBlock() throws IOException {
-        if (isBitrateAdjustable && readStartTime == -1) {
-            readStartTime = System.currentTimeMillis();
-        }
-
         if (headerChannel != null) {
             buffer.rewind();
             if (buffer.limit() < buffer.capacity()) {
@@ -126,11 +137,15 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
         }
 
+        long readStartTime = System.nanoTime();
         int read = super.readNextBlock();
+        segmentReadTime += System.nanoTime() - readStartTime;
+        if (read > 0) {
+            segmentReadBytes += read;
+        }
+
         if (isBitrateAdjustable && read == -1) {
-            long readTime = System.currentTimeMillis() - readStartTime;
-            readStartTime = -1;
-            adjustBitrate(readTime);
+            adjustBitrate();
         } else if (isAudioExtStream && read == -1) {
             adjustBitrateAudioExt();
         }
@@ -305,6 +320,10 @@ final class HLSConnectionHolder extends ConnectionHolder {
             currentPlaylist.setMediaFileIndex(0);
         }
 
+        if (HLS_LOW_LATENCY && currentPlaylist != null && currentPlaylist.isLive()) {
+            currentPlaylist.seekToLiveEdge();
+        }
+
         isInitialized = true;
 
         return true;
@@ -350,6 +369,8 @@ final class HLSConnectionHolder extends ConnectionHolder {
     // Returns negative size of segment if discontinuity.
     private int loadNextSegment() {
         resetConnection();
+        segmentReadTime = 0;
+        segmentReadBytes = 0;
 
         String mediaFile;
         int headerLength = 0;
@@ -402,8 +423,23 @@ final class HLSConnectionHolder extends ConnectionHolder {
         return Channels.newChannel(headerConnection.getInputStream());
     }
 
-    private void adjustBitrate(long readTime) {
-        int avgBitrate = (int) (((long) urlConnection.getContentLength() * 8 * 1000) / readTime);
+    private void adjustBitrate() {
+        if (segmentReadTime <= 0 || segmentReadBytes <= 0) {
+            return;
+        }
+
+        double segmentBitrate = (segmentReadBytes * 8 * 1.0e9) / segmentReadTime;
+        if (bandwidthEstimate < 0) {
+            bandwidthEstimate = segmentBitrate;
+        } else {
+            bandwidthEstimate = BANDWIDTH_ESTIMATE_WEIGHT * segmentBitrate
+                    + (1.0 - BANDWIDTH_ESTIMATE_WEIGHT) * bandwidthEstimate;
+        }
+
+        // Switch up only as fast as the smoothed estimate allows, but switch
+        // down as soon as a single segment shows the network can not keep up.
+        double bitrate = Math.min(bandwidthEstimate, segmentBitrate) * BANDWIDTH_SAFETY_FACTOR;
+        int avgBitrate = (int) Math.min(bitrate, Integer.MAX_VALUE);
 
         Playlist playlist = variantPlaylist.getPlaylistBasedOnBitrate(avgBitrate);
         if (playlist != null && playlist != currentPlaylist) {
@@ -1233,6 +1269,13 @@ final class HLSConnectionHolder extends ConnectionHolder {
             mediaFileIndex = value;
         }
 
+        // Makes the newest segment currently listed the next one to be read
+        void seekToLiveEdge() {
+            synchronized (lock) {
+                mediaFileIndex = Math.max(mediaFileIndex, mediaFiles.size() - 2);
+            }
+        }
+
         int getMediaFileIndex() {
             return mediaFileIndex;
         }
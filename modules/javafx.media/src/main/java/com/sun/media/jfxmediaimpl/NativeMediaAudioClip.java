@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,12 +26,14 @@
 package com.sun.media.jfxmediaimpl;
 
 import com.sun.media.jfxmedia.AudioClip;
+import com.sun.media.jfxmedia.MediaPlayer;
 import com.sun.media.jfxmedia.locator.Locator;
 import com.sun.media.jfxmedia.logging.Logger;
 import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.net.URI;
 import java.net.URISyntaxException;
+import java.util.concurrent.ConcurrentLinkedQueue;
 import java.util.concurrent.atomic.AtomicInteger;
 
 /**
@@ -42,6 +44,14 @@ final class NativeMediaAudioClip extends AudioClip {
     private Locator mediaLocator;
     private AtomicInteger playCount; // track current and scheduled play requests
 
+    // Players that finished playing this clip, paused at the start so the next
+    // play() does not have to build and preroll a new pipeline
+    private static final int MAX_IDLE_PLAYERS = 4;
+    private final ConcurrentLinkedQueue<MediaPlayer> idlePlayers = new ConcurrentLinkedQueue<>();
+    private final AtomicInteger idlePlayerCount = new AtomicInteger(0);
+
+    private static final IdlePlayerDisposer idlePlayerDisposer = new IdlePlayerDisposer();
+
     private NativeMediaAudioClip(URI source) throws URISyntaxException, FileNotFoundException, IOException  {
         sourceURI = source;
         playCount = new AtomicInteger(0);
@@ -53,12 +63,33 @@ final class NativeMediaAudioClip extends AudioClip {
         mediaLocator = new Locator(sourceURI);
         mediaLocator.init();
         mediaLocator.cacheMedia(); // load into memory
+
+        MediaDisposer.addResourceDisposer(this, idlePlayers, idlePlayerDisposer);
     }
 
     Locator getLocator() {
         return mediaLocator;
     }
 
+    // Returns a prerolled player for this clip, or null if none is idle
+    MediaPlayer takeIdlePlayer() {
+        MediaPlayer player = idlePlayers.poll();
+        if (null != player) {
+            idlePlayerCount.decrementAndGet();
+        }
+        return player;
+    }
+
+    // Keeps a finished player for reuse, returns false if enough are kept already
+    boolean recyclePlayer(MediaPlayer player) {
+        if (idlePlayerCount.incrementAndGet() > MAX_IDLE_PLAYERS) {
+            idlePlayerCount.decrementAndGet();
+            return false;
+        }
+        idlePlayers.offer(player);
+        return true;
+    }
+
     public static AudioClip load(URI source) throws URISyntaxException, FileNotFoundException, IOException {
         return new NativeMediaAudioClip(source);
     }
@@ -132,4 +163,17 @@ final class NativeMediaAudioClip extends AudioClip {
     void playFinished() {
         playCount.decrementAndGet();
     }
+
+    private static class IdlePlayerDisposer implements MediaDisposer.ResourceDisposer {
+        @Override
+        public void disposeResource(Object resource) {
+            // resource is the idle player queue of a collected clip
+            @SuppressWarnings("unchecked")
+            ConcurrentLinkedQueue<MediaPlayer> players = (ConcurrentLinkedQueue<MediaPlayer>) resource;
+            MediaPlayer player;
+            while ((player = players.poll()) != null) {
+                player.dispose();
+            }
+        }
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -316,9 +316,21 @@ final class NativeMediaAudioClipPlayer
             playCount = 0;
 
             if (null == mediaPlayer) {
-                mediaPlayer = MediaManager.getPlayer(source());
-                mediaPlayer.addMediaPlayerListener(this);
-                mediaPlayer.addMediaErrorListener(this);
+                mediaPlayer = sourceClip.takeIdlePlayer();
+                if (null != mediaPlayer) {
+                    // Already prerolled, start right away
+                    mediaPlayer.addMediaPlayerListener(this);
+                    mediaPlayer.addMediaErrorListener(this);
+                    ready = true;
+                    mediaPlayer.setVolume((float)volume);
+                    mediaPlayer.setBalance((float)balance);
+                    mediaPlayer.setRate((float)rate);
+                    mediaPlayer.play();
+                } else {
+                    mediaPlayer = MediaManager.getPlayer(source());
+                    mediaPlayer.addMediaPlayerListener(this);
+                    mediaPlayer.addMediaErrorListener(this);
+                }
             } else {
                 mediaPlayer.play();
             }
@@ -331,11 +343,18 @@ final class NativeMediaAudioClipPlayer
         invalidate();
     }
 
-    public synchronized void invalidate() {
+    public void invalidate() {
+        invalidate(false);
+    }
+
+    // Pass recycle = true only once the player has finished, then it is
+    // rewound and kept by the clip for the next play() instead of disposed
+    private synchronized void invalidate(boolean recycle) {
         playerStateLock.lock();
         playerListLock.lock();
 
         try {
+            recycle = recycle && ready;
             playing = false;
             playCount = 0;
             ready = false;
@@ -343,6 +362,16 @@ final class NativeMediaAudioClipPlayer
             activePlayers.remove(this);
             sourceClip.playFinished();
 
+            if (null != mediaPlayer && recycle) {
+                mediaPlayer.removeMediaPlayerListener(this);
+                mediaPlayer.removeMediaErrorListener(this);
+                mediaPlayer.pause();
+                mediaPlayer.seek(0);
+                if (sourceClip.recyclePlayer(mediaPlayer)) {
+                    mediaPlayer = null;
+                }
+            }
+
             if (null != mediaPlayer) {
                 mediaPlayer.removeMediaPlayerListener(this);
                 mediaPlayer.setMute(true);
@@ -405,7 +434,7 @@ final class NativeMediaAudioClipPlayer
                     if (playCount <= loopCount) {
                         mediaPlayer.seek(0); // restart
                     } else {
-                        invalidate();
+                        invalidate(true);
                     }
                 } else {
                     mediaPlayer.seek(0); // restart
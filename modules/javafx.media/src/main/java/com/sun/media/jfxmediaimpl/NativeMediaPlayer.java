@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@ import com.sun.media.jfxmedia.Media;
 import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
 import com.sun.media.jfxmedia.MediaPlayer;
+import com.sun.media.jfxmedia.MediaStatistics;
 import com.sun.media.jfxmedia.control.VideoRenderControl;
 import com.sun.media.jfxmedia.effects.AudioEqualizer;
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
@@ -57,6 +58,7 @@ import com.sun.media.jfxmedia.track.Track.Encoding;
 import com.sun.media.jfxmedia.track.VideoResolution;
 import com.sun.media.jfxmedia.track.VideoTrack;
 import java.lang.ref.WeakReference;
+import java.lang.reflect.InvocationTargetException;
 import java.util.*;
 import java.util.concurrent.BlockingQueue;
 import java.util.concurrent.LinkedBlockingQueue;
@@ -137,6 +139,21 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
     private boolean isDisposed = false;
     private Runnable onDispose;
 
+    // Players which have not been disposed yet, for periodic statistics events
+    private static final Set<NativeMediaPlayer> activePlayers =
+            Collections.newSetFromMap(new WeakHashMap<>());
+
+    static {
+        // Loading the JFR support reflectively, in case jdk.jfr isn't available
+        try {
+            Class<?> klass = Class.forName("com.sun.media.jfxmediaimpl.jfr.JFRMediaStatistics");
+            klass.getDeclaredMethod("register").invoke(null);
+        } catch (NoClassDefFoundError | ClassNotFoundException | NoSuchMethodException
+                | IllegalAccessException | InvocationTargetException e) {
+            // Ignore
+        }
+    }
+
     //**************************************************************************
     //***** Constructors
     //**************************************************************************
@@ -164,6 +181,20 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
     protected void init() {
         media.addMarkerStateListener(this);
         eventLoop.start();
+        synchronized (activePlayers) {
+            activePlayers.add(this);
+        }
+    }
+
+    /**
+     * Returns the players that have not been disposed yet.
+     *
+     * @return a copy of the set of active players.
+     */
+    public static List<NativeMediaPlayer> getActivePlayers() {
+        synchronized (activePlayers) {
+            return new ArrayList<>(activePlayers);
+        }
     }
 
     /**
@@ -1308,6 +1339,14 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
 
     protected abstract void playerDispose();
 
+    /**
+     * Retrieves the playback counters from the native player. Platforms
+     * which do not collect them return <code>null</code>.
+     */
+    protected MediaStatistics playerGetStatistics() throws MediaException {
+        return null;
+    }
+
     /**
      * Retrieves the current {@link PlayerState state} of the player.
      *
@@ -1318,6 +1357,22 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         return playerState;
     }
 
+    @Override
+    public MediaStatistics getStatistics() {
+        // Holding the lock keeps the native player alive while it is queried
+        disposeLock.lock();
+        try {
+            if (!isDisposed) {
+                return playerGetStatistics();
+            }
+        } catch (MediaException me) {
+            // Statistics are informational, report them as unavailable
+        } finally {
+            disposeLock.unlock();
+        }
+        return null;
+    }
+
     @Override
     final public void dispose() {
         disposeLock.lock();
@@ -1413,6 +1468,9 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
                 }
 
                 isDisposed = true;
+                synchronized (activePlayers) {
+                    activePlayers.remove(this);
+                }
             }
         } finally {
             disposeLock.unlock();
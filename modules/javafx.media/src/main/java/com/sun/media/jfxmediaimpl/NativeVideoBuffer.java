@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@ package com.sun.media.jfxmediaimpl;
 import com.sun.media.jfxmedia.control.VideoDataBuffer;
 import com.sun.media.jfxmedia.control.VideoFormat;
 import java.nio.ByteBuffer;
+import java.util.Arrays;
 import java.util.concurrent.atomic.AtomicInteger;
 
 /**
@@ -38,20 +39,29 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     private final AtomicInteger holdCount;
     private NativeVideoBuffer cachedBGRARep;
 
+    // Layout of the frame info array filled in by nativeGetFrameInfo
+    private static final int INFO_WIDTH = 0;
+    private static final int INFO_HEIGHT = 1;
+    private static final int INFO_ENCODED_WIDTH = 2;
+    private static final int INFO_ENCODED_HEIGHT = 3;
+    private static final int INFO_FORMAT = 4; // FORMAT_TYPE_XXX constant
+    private static final int INFO_HAS_ALPHA = 5;
+    private static final int INFO_PLANE_COUNT = 6;
+    private static final int INFO_STRIDES = 7; // up to four plane strides
+    private static final int INFO_SIZE = 11;
+
+    // Frames never change once created, so their description is fetched
+    // with a single native call the first time it is needed
+    private volatile int[] frameInfo;
+    private double timestamp;
+
     private static native void nativeDisposeBuffer(long handle);
 
-    private native double nativeGetTimestamp(long handle);
+    private native double nativeGetFrameInfo(long handle, int[] info);
     private native ByteBuffer nativeGetBufferForPlane(long handle, int plane);
-    private native int nativeGetWidth(long handle);
-    private native int nativeGetHeight(long handle);
-    private native int nativeGetEncodedWidth(long handle);
-    private native int nativeGetEncodedHeight(long handle);
-    private native int nativeGetFormat(long handle); // returns FORMAT_TYPE_XXX constant
-    private native boolean nativeHasAlpha(long handle);
-    private native int nativeGetPlaneCount(long handle);
-    private native int[] nativeGetPlaneStrides(long handle);
     private native long nativeConvertToFormat(long handle, int formatType);
     private native void nativeSetDirty(long handle);
+    private native long nativeGetNativeFrameHandle(long handle);
 
     // This causes methods to throw an NPE if the native handle is invalid
     private static final boolean DEBUG_DISPOSED_BUFFERS = false;
@@ -99,10 +109,20 @@ final class NativeVideoBuffer implements VideoDataBuffer {
         }
     }
 
+    private int[] getFrameInfo() {
+        if (null == frameInfo) {
+            int[] info = new int[INFO_SIZE];
+            timestamp = nativeGetFrameInfo(nativePeer, info);
+            frameInfo = info;
+        }
+        return frameInfo;
+    }
+
     @Override
     public double getTimestamp() {
         if (0 != nativePeer) {
-            return nativeGetTimestamp(nativePeer);
+            getFrameInfo();
+            return timestamp;
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -126,7 +146,7 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public int getWidth() {
         if (0 != nativePeer) {
-            return nativeGetWidth(nativePeer);
+            return getFrameInfo()[INFO_WIDTH];
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -136,7 +156,7 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public int getHeight() {
         if (0 != nativePeer) {
-            return nativeGetHeight(nativePeer);
+            return getFrameInfo()[INFO_HEIGHT];
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -146,7 +166,7 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public int getEncodedWidth() {
         if (0 != nativePeer) {
-            return nativeGetEncodedWidth(nativePeer);
+            return getFrameInfo()[INFO_ENCODED_WIDTH];
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -156,7 +176,7 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public int getEncodedHeight() {
         if (0 != nativePeer) {
-            return nativeGetEncodedHeight(nativePeer);
+            return getFrameInfo()[INFO_ENCODED_HEIGHT];
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -166,7 +186,7 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public VideoFormat getFormat() {
         if (0 != nativePeer) {
-            int formatType = nativeGetFormat(nativePeer);
+            int formatType = getFrameInfo()[INFO_FORMAT];
             return VideoFormat.formatForType(formatType);
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
@@ -177,7 +197,7 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public boolean hasAlpha() {
         if (0 != nativePeer) {
-            return nativeHasAlpha(nativePeer);
+            return getFrameInfo()[INFO_HAS_ALPHA] != 0;
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -187,7 +207,7 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public int getPlaneCount() {
         if (0 != nativePeer) {
-            return nativeGetPlaneCount(nativePeer);
+            return getFrameInfo()[INFO_PLANE_COUNT];
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -197,8 +217,11 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public int getStrideForPlane(int planeIndex) {
         if (0 != nativePeer) {
-            int[] strides = nativeGetPlaneStrides(nativePeer);
-            return strides[planeIndex];
+            int[] info = getFrameInfo();
+            if (planeIndex < 0 || planeIndex >= info[INFO_PLANE_COUNT]) {
+                throw new ArrayIndexOutOfBoundsException(planeIndex);
+            }
+            return info[INFO_STRIDES + planeIndex];
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -208,7 +231,12 @@ final class NativeVideoBuffer implements VideoDataBuffer {
     @Override
     public int[] getPlaneStrides() {
         if (0 != nativePeer) {
-            return nativeGetPlaneStrides(nativePeer);
+            int[] info = getFrameInfo();
+            int count = info[INFO_PLANE_COUNT];
+            if (count < 1) {
+                return null;
+            }
+            return Arrays.copyOfRange(info, INFO_STRIDES, INFO_STRIDES + count);
         } else if (DEBUG_DISPOSED_BUFFERS) {
             throw new NullPointerException("method called on disposed NativeVideoBuffer");
         }
@@ -241,6 +269,16 @@ final class NativeVideoBuffer implements VideoDataBuffer {
         return null;
     }
 
+    @Override
+    public long getNativeFrameHandle() {
+        if (0 != nativePeer) {
+            return nativeGetNativeFrameHandle(nativePeer);
+        } else if (DEBUG_DISPOSED_BUFFERS) {
+            throw new NullPointerException("method called on disposed NativeVideoBuffer");
+        }
+        return 0;
+    }
+
     @Override
     public void setDirty() {
         if (0 != nativePeer) {
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.media.jfxmediaimpl.jfr;
+
+import com.sun.media.jfxmedia.Media;
+import com.sun.media.jfxmedia.MediaStatistics;
+import com.sun.media.jfxmediaimpl.NativeMediaPlayer;
+
+import jdk.jfr.FlightRecorder;
+
+/**
+ * Emits the statistics of every active media player as periodic JFR events.
+ */
+public final class JFRMediaStatistics {
+    private JFRMediaStatistics() {}
+
+    public static void register() {
+        FlightRecorder.addPeriodicEvent(JFRMediaStatisticsEvent.class, JFRMediaStatistics::emit);
+    }
+
+    private static void emit() {
+        for (NativeMediaPlayer player : NativeMediaPlayer.getActivePlayers()) {
+            MediaStatistics statistics = player.getStatistics();
+            if (statistics == null) {
+                continue;
+            }
+
+            JFRMediaStatisticsEvent event = new JFRMediaStatisticsEvent();
+            Media media = player.getMedia();
+            if (media != null && media.getLocator() != null) {
+                event.location = media.getLocator().getStringLocation();
+            }
+            event.framesDecoded = statistics.getFramesDecoded();
+            event.framesDropped = statistics.getFramesDropped();
+            event.framesLate = statistics.getFramesLate();
+            event.audioQueueLevel = statistics.getAudioQueueLevel();
+            event.videoQueueLevel = statistics.getVideoQueueLevel();
+            event.readCount = statistics.getReadCount();
+            event.readTime = statistics.getReadTime();
+            event.maxReadTime = statistics.getMaxReadTime();
+            event.commit();
+        }
+    }
+}
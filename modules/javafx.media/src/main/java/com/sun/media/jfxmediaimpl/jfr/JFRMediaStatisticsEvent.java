@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.media.jfxmediaimpl.jfr;
+
+import jdk.jfr.Category;
+import jdk.jfr.Description;
+import jdk.jfr.Enabled;
+import jdk.jfr.Event;
+import jdk.jfr.Label;
+import jdk.jfr.Name;
+import jdk.jfr.Period;
+import jdk.jfr.StackTrace;
+import jdk.jfr.Timespan;
+
+@Name("javafx.MediaStatistics")
+@Label("JavaFX Media Statistics")
+@Category("JavaFX")
+@Description("Describes the playback counters of a media player")
+@StackTrace(false)
+@Enabled(false)
+@Period("1 s")
+public final class JFRMediaStatisticsEvent extends Event {
+    @Label("Location")
+    String location;
+
+    @Label("Frames Decoded")
+    long framesDecoded;
+
+    @Label("Frames Dropped")
+    long framesDropped;
+
+    @Label("Frames Late")
+    long framesLate;
+
+    @Label("Audio Queue Level")
+    long audioQueueLevel;
+
+    @Label("Video Queue Level")
+    long videoQueueLevel;
+
+    @Label("Reads")
+    long readCount;
+
+    @Timespan(Timespan.MICROSECONDS)
+    @Label("Read Time")
+    long readTime;
+
+    @Timespan(Timespan.MICROSECONDS)
+    @Label("Max Read Time")
+    long maxReadTime;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.media.jfxmediaimpl.platform.gstreamer;
 
 import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
+import com.sun.media.jfxmedia.MediaStatistics;
 import com.sun.media.jfxmedia.effects.AudioEqualizer;
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
 import com.sun.media.jfxmedia.locator.Locator;
@@ -271,6 +272,16 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
     protected void playerInit() throws MediaException {
     }
 
+    @Override
+    protected MediaStatistics playerGetStatistics() throws MediaException {
+        long[] statistics = new long[MediaStatistics.NUM_STATISTICS];
+        int rc = gstGetStatistics(gstMedia.getNativeMediaRef(), statistics);
+        if (0 != rc) {
+            throwMediaErrorException(rc, null);
+        }
+        return new MediaStatistics(statistics);
+    }
+
     @Override
     protected void playerDispose() {
         audioEqualizer = null;
@@ -297,4 +308,5 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
     private native int gstSetBalance(long refNativeMedia, float balance);
     private native int gstGetDuration(long refNativeMedia, double[] duration);
     private native int gstSeek(long refNativeMedia, double streamTime);
+    private native int gstGetStatistics(long refNativeMedia, long[] statistics);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -74,6 +74,30 @@ public final class GSTPlatform extends Platform {
         "resource"
     };
 
+    /**
+     * Maximum number of threads each video decoder may use, or 0 to let the
+     * decoder choose based on the number of CPUs. Bounding this keeps many
+     * simultaneous players from oversubscribing the machine.
+     */
+    private static final int DECODER_THREADS =
+            Math.max(0, Integer.getInteger("jfxmedia.decoder.threads", 0));
+
+    /**
+     * Whether audio sinks use a small ring buffer. This trades robustness
+     * against scheduling hiccups for a shorter delay between play() and the
+     * first audible sample, which matters for short UI sounds.
+     */
+    private static final boolean LOW_LATENCY_AUDIO =
+            Boolean.getBoolean("jfxmedia.audio.lowlatency");
+
+    /**
+     * Whether seeks snap to the nearest key frame instead of decoding forward
+     * from the previous key frame to the exact position. This makes scrubbing
+     * a timeline interactive at the cost of seek precision.
+     */
+    private static final boolean KEY_FRAME_SEEK =
+            Boolean.getBoolean("jfxmedia.seek.keyframe");
+
     private static GSTPlatform globalInstance = null;
 
     @Override
@@ -81,7 +105,7 @@ public final class GSTPlatform extends Platform {
         // Initialize GStreamer JNI and supporting native classes.
         MediaError ret;
         try {
-            ret = MediaError.getFromCode(gstInitPlatform());
+            ret = MediaError.getFromCode(gstInitPlatform(DECODER_THREADS, LOW_LATENCY_AUDIO, KEY_FRAME_SEEK));
         } catch (UnsatisfiedLinkError ule) {
             ret = MediaError.ERROR_MANAGER_ENGINEINIT_FAIL;
         }
@@ -188,7 +212,11 @@ public final class GSTPlatform extends Platform {
     /**
      * Initialize the native peer of this media manager.
      *
+     * @param decoderThreads maximum number of threads per video decoder, 0 for default
+     * @param lowLatencyAudio whether audio sinks should use a small buffer
+     * @param keyFrameSeek whether seeks snap to the nearest key frame
      * @return A status code.
      */
-    private static native int gstInitPlatform();
+    private static native int gstInitPlatform(int decoderThreads, boolean lowLatencyAudio,
+                                              boolean keyFrameSeek);
 }
@@ -425,6 +425,10 @@ gst_iir_equalizer_finalize (GObject * object)
 
   g_free (equ->bands);
   g_free (equ->history);
+#ifdef GSTREAMER_LITE
+  g_free (equ->coeffs);
+  g_free (equ->active_bands);
+#endif // GSTREAMER_LITE
 
   g_mutex_clear (&equ->bands_lock);
 
@@ -642,6 +646,40 @@ update_coefficients (GstIirEqualizer * equ)
       setup_high_shelf_filter (equ, equ->bands[i]);
   }
 
+#ifdef GSTREAMER_LITE
+  {
+    guint c, channels = GST_AUDIO_FILTER_CHANNELS (equ);
+    guint na = 0;
+
+    equ->coeffs = g_renew (gdouble, equ->coeffs, 5 * MAX (n, 1));
+    equ->active_bands = g_renew (guint, equ->active_bands, MAX (n, 1));
+
+    for (i = 0; i < n; i++) {
+      GstIirEqualizerBand *band = equ->bands[i];
+      gdouble *k = equ->coeffs + 5 * na;
+
+      /* A band with 0dB gain is an identity filter, skip it. Its history is
+       * cleared so it starts from silence once it is active again */
+      if (band->gain == 0.0) {
+        if (equ->history) {
+          for (c = 0; c < channels; c++)
+            memset ((guint8 *) equ->history + (c * n + i) * equ->history_size,
+                0, equ->history_size);
+        }
+        continue;
+      }
+
+      k[0] = band->a0;
+      k[1] = band->a1;
+      k[2] = band->a2;
+      k[3] = band->b1;
+      k[4] = band->b2;
+      equ->active_bands[na++] = i;
+    }
+    equ->active_band_count = na;
+  }
+#endif // GSTREAMER_LITE
+
   equ->need_new_coefficients = FALSE;
 }
 
@@ -746,6 +784,78 @@ gst_iir_equalizer_compute_frequencies (GstIirEqualizer * equ, guint new_count)
 
 /* start of code that is type specific */
 
+#ifdef GSTREAMER_LITE
+/* Frames are processed in blocks. Each channel of a block is copied into a
+ * contiguous buffer and run through one active band at a time, so the filter
+ * state and coefficients stay in registers for the whole block instead of
+ * being reloaded from the band objects for every sample */
+#define BLOCK_FRAMES 256
+
+#define STORE_gint16(v) ((gint16) floor (CLAMP ((v), -32768.0, 32767.0)))
+#define STORE_FLOAT(v)  (v)
+
+#define CREATE_BLOCK_FUNCTIONS(TYPE,BIG_TYPE,STORE)                     \
+typedef struct {                                                        \
+  BIG_TYPE x1, x2;          /* history of input values for a filter */  \
+  BIG_TYPE y1, y2;          /* history of output values for a filter */ \
+} SecondOrderHistory ## TYPE;                                           \
+                                                                        \
+static const guint                                                      \
+history_size_ ## TYPE = sizeof (SecondOrderHistory ## TYPE);            \
+                                                                        \
+static void                                                             \
+gst_iir_equ_process_ ## TYPE (GstIirEqualizer *equ, guint8 *data,       \
+guint size, guint channels)                                             \
+{                                                                       \
+  TYPE *samples = (TYPE *) data;                                        \
+  guint frames = size / channels / sizeof (TYPE);                       \
+  guint nf = equ->freq_band_count, na = equ->active_band_count;         \
+  guint start, len, i, c, n;                                            \
+  BIG_TYPE block[BLOCK_FRAMES];                                         \
+                                                                        \
+  for (start = 0; start < frames; start += len) {                       \
+    len = MIN (frames - start, BLOCK_FRAMES);                           \
+    for (c = 0; c < channels; c++) {                                    \
+      TYPE *in = samples + start * channels + c;                        \
+      SecondOrderHistory ## TYPE *history =                             \
+          (SecondOrderHistory ## TYPE *) equ->history + c * nf;         \
+                                                                        \
+      for (i = 0; i < len; i++)                                         \
+        block[i] = in[i * channels];                                    \
+                                                                        \
+      for (n = 0; n < na; n++) {                                        \
+        const gdouble *k = equ->coeffs + 5 * n;                         \
+        SecondOrderHistory ## TYPE *h = history + equ->active_bands[n]; \
+        const BIG_TYPE a0 = k[0], a1 = k[1], a2 = k[2];                 \
+        const BIG_TYPE b1 = k[3], b2 = k[4];                            \
+        BIG_TYPE x1 = h->x1, x2 = h->x2, y1 = h->y1, y2 = h->y2;        \
+                                                                        \
+        for (i = 0; i < len; i++) {                                     \
+          BIG_TYPE x0 = block[i];                                       \
+          BIG_TYPE y0 = a0 * x0 + a1 * x1 + a2 * x2 + b1 * y1 + b2 * y2; \
+          x2 = x1;                                                      \
+          x1 = x0;                                                      \
+          y2 = y1;                                                      \
+          y1 = y0;                                                      \
+          block[i] = y0;                                                \
+        }                                                               \
+                                                                        \
+        h->x1 = x1;                                                     \
+        h->x2 = x2;                                                     \
+        h->y1 = y1;                                                     \
+        h->y2 = y2;                                                     \
+      }                                                                 \
+                                                                        \
+      for (i = 0; i < len; i++)                                         \
+        in[i * channels] = (TYPE) STORE (block[i]);                     \
+    }                                                                   \
+  }                                                                     \
+}
+
+CREATE_BLOCK_FUNCTIONS (gint16, gfloat, STORE_gint16);
+CREATE_BLOCK_FUNCTIONS (gfloat, gfloat, STORE_FLOAT);
+CREATE_BLOCK_FUNCTIONS (gdouble, gdouble, STORE_FLOAT);
+#else // GSTREAMER_LITE
 #define CREATE_OPTIMIZED_FUNCTIONS_INT(TYPE,BIG_TYPE,MIN_VAL,MAX_VAL)   \
 typedef struct {                                                        \
   BIG_TYPE x1, x2;          /* history of input values for a filter */  \
@@ -848,6 +958,7 @@ guint size, guint channels)                                             \
 CREATE_OPTIMIZED_FUNCTIONS_INT (gint16, gfloat, -32768.0, 32767.0);
 CREATE_OPTIMIZED_FUNCTIONS (gfloat);
 CREATE_OPTIMIZED_FUNCTIONS (gdouble);
+#endif // GSTREAMER_LITE
 
 static GstFlowReturn
 gst_iir_equalizer_transform_ip (GstBaseTransform * btrans, GstBuffer * buf)
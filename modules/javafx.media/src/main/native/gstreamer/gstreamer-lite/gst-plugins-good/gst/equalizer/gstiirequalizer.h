@@ -67,6 +67,14 @@ struct _GstIirEqualizer
 
   gboolean need_new_coefficients;
 
+#ifdef GSTREAMER_LITE
+  /* coefficients of the bands that are not flat, copied out of the band
+   * objects by update_coefficients () for the processing loop */
+  gdouble *coeffs;              /* a0, a1, a2, b1, b2 for each active band */
+  guint *active_bands;          /* band index of each active band */
+  guint active_band_count;
+#endif // GSTREAMER_LITE
+
   ProcessFunc process;
 };
 
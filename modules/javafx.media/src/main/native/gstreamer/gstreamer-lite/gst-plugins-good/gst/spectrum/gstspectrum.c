@@ -258,6 +258,14 @@ gst_spectrum_alloc_channel_data (GstSpectrum * spectrum)
     cd->spect_magnitude = g_new0 (gfloat, bands);
     cd->spect_phase = g_new0 (gfloat, bands);
   }
+
+#ifdef GSTREAMER_LITE
+  /* gst_fft_f32_window() evaluates cos() for every sample of every FFT,
+   * the window only depends on nfft so compute it once */
+  spectrum->window = g_new (gfloat, nfft);
+  for (i = 0; i < nfft; i++)
+    spectrum->window[i] = (gfloat) (0.53836 - 0.46164 * cos (2.0 * G_PI * i / nfft));
+#endif // GSTREAMER_LITE
 }
 
 static void
@@ -283,6 +291,10 @@ gst_spectrum_free_channel_data (GstSpectrum * spectrum)
     g_free (spectrum->channel_data);
     spectrum->channel_data = NULL;
   }
+#ifdef GSTREAMER_LITE
+  g_free (spectrum->window);
+  spectrum->window = NULL;
+#endif // GSTREAMER_LITE
 }
 
 static void
@@ -773,6 +785,37 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
   gfloat *spect_phase = cd->spect_phase;
   GstFFTF32Complex *freqdata = cd->freqdata;
   GstFFTF32 *fft_ctx = cd->fft_ctx;
+#ifdef GSTREAMER_LITE
+  const gfloat *window = spectrum->window;
+  guint j;
+
+  /* Unroll the ring buffer and apply the window in one pass. Both loops are
+   * free of modulo and data dependent branches so the compiler can vectorize them */
+  for (i = 0; i < nfft - input_pos; i++)
+    input_tmp[i] = input[input_pos + i] * window[i];
+  for (j = 0; i < nfft; i++, j++)
+    input_tmp[i] = input[j] * window[i];
+
+  gst_fft_f32_fft (fft_ctx, input_tmp, freqdata);
+
+  if (spectrum->message_magnitude) {
+    const gfloat scale = 1.0f / ((gfloat) nfft * nfft);
+    const gfloat min_val = (gfloat) threshold;
+    gfloat val;
+    /* Calculate magnitude in db */
+    for (i = 0; i < bands; i++) {
+      val = freqdata[i].r * freqdata[i].r + freqdata[i].i * freqdata[i].i;
+      val = 10.0f * log10f (val * scale);
+      spect_magnitude[i] += (val < min_val) ? min_val : val;
+    }
+  }
+
+  if (spectrum->message_phase) {
+    /* Calculate phase */
+    for (i = 0; i < bands; i++)
+      spect_phase[i] += atan2f (freqdata[i].i, freqdata[i].r);
+  }
+#else // GSTREAMER_LITE
 
   for (i = 0; i < nfft; i++)
     input_tmp[i] = input[(input_pos + i) % nfft];
@@ -800,6 +843,7 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
     for (i = 0; i < bands; i++)
       spect_phase[i] += atan2 (freqdata[i].i, freqdata[i].r);
   }
+#endif // GSTREAMER_LITE
 }
 
 static void
@@ -82,6 +82,9 @@ struct _GstSpectrum
   /* <private> */
   GstSpectrumChannel *channel_data;
   guint num_channels;
+#ifdef GSTREAMER_LITE
+  gfloat *window;               /* Hamming window coefficients, nfft entries */
+#endif // GSTREAMER_LITE
 
   guint input_pos;
   guint64 error_per_interval;
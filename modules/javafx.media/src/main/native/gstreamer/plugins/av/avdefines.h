@@ -66,5 +66,15 @@
 // call av_free().
 #define USE_FREE_CONTEXT       (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(62,0,0))
 
+// Hardware accelerated decoding through AVCodecContext.hw_device_ctx and
+// avcodec_get_hw_config(). Available since 58.18, but we only use it together
+// with "avcodec_send_packet()" and "avcodec_receive_frame()".
+#define HW_DECODE              (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(59,0,0))
+
+// Allocate decoded pictures ourselves through AVCodecContext.get_buffer2 and
+// pass them downstream without copying. Needs reference counted frames and
+// AVBufferPool.
+#define ZERO_COPY_FRAMES       (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(57,0,0))
+
 #endif  /* AVDEFINES_H */
 
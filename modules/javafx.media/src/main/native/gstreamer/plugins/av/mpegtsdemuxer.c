@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -70,6 +70,7 @@ struct _MpegTSDemuxer
 
     gint64            adapter_limit_size;
     LimitType         adapter_limit_type;
+    guint             read_ahead;
 
     Stream            video;
     Stream            audio;
@@ -115,9 +116,15 @@ struct _MpegTSDemuxerClass
 
 /***********************************************************************************/
 
-#define BUFFER_SIZE   4096             // Bytes. Better take it from JavaSource.
-#define ADAPTER_LIMIT 40 * BUFFER_SIZE // Initial adapter limit. It grows if unlimited by adding LIMIT_STEP
-#define LIMIT_STEP    10 * BUFFER_SIZE
+#define BUFFER_SIZE   65536            // Bytes. Size of the libav read buffer.
+#define ADAPTER_LIMIT (8 * BUFFER_SIZE) // Default read-ahead. It grows if unlimited by adding LIMIT_STEP
+#define LIMIT_STEP    (2 * BUFFER_SIZE)
+
+enum
+{
+    PROP_0,
+    PROP_READ_AHEAD,
+};
 
 /***********************************************************************************
  * Debug category and pad templates
@@ -194,6 +201,8 @@ static gboolean             mpegts_demuxer_sink_query (GstPad *pad, GstObject *p
 static GstFlowReturn        mpegts_demuxer_chain(GstPad *pad, GstObject *parent, GstBuffer *buf);
 static gboolean             mpegts_demuxer_activatemode(GstPad *pad, GstObject *parent, GstPadMode mode, gboolean active);
 static void                 mpegts_demuxer_finalize(GObject *object);
+static void                 mpegts_demuxer_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
+static void                 mpegts_demuxer_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
 static gpointer             mpegts_demuxer_process_input(gpointer data);
 
 static gboolean             mpegts_demuxer_src_query (GstPad *pad, GstObject *parent, GstQuery *query);
@@ -209,6 +218,7 @@ static int64_t              mpegts_demuxer_seek(void *opaque, int64_t offset, in
 static void mpegts_demuxer_class_init(MpegTSDemuxerClass *g_class)
 {
     GstElementClass *gstelement_class = GST_ELEMENT_CLASS(g_class);
+    GObjectClass    *gobject_class = G_OBJECT_CLASS(g_class);
 
     g_class->audio_source_template = gst_static_pad_template_get (&audio_source_template);
     g_class->video_source_template = gst_static_pad_template_get (&video_source_template);
@@ -223,9 +233,15 @@ static void mpegts_demuxer_class_init(MpegTSDemuxerClass *g_class)
                 "Parses MPEG2 transport streams",
                 "Oracle Corporation");
 
-    G_OBJECT_CLASS (g_class)->finalize = GST_DEBUG_FUNCPTR(mpegts_demuxer_finalize);
+    gobject_class->finalize = GST_DEBUG_FUNCPTR(mpegts_demuxer_finalize);
+    gobject_class->set_property = mpegts_demuxer_set_property;
+    gobject_class->get_property = mpegts_demuxer_get_property;
     gstelement_class->change_state = mpegts_demuxer_change_state;
 
+    g_object_class_install_property (gobject_class, PROP_READ_AHEAD,
+        g_param_spec_uint ("read-ahead", "Read ahead", "Maximum number of bytes queued ahead of the demuxer thread",
+                           2 * BUFFER_SIZE, G_MAXINT, ADAPTER_LIMIT, G_PARAM_READWRITE));
+
 #if !NO_REGISTER_ALL
     av_register_all();
 #endif
@@ -248,6 +264,7 @@ static void mpegts_demuxer_init(MpegTSDemuxer *demuxer)
     demuxer->reader_thread = NULL;
     demuxer->numpads = 0;
     demuxer->base_pts = GST_CLOCK_TIME_NONE;
+    demuxer->read_ahead = ADAPTER_LIMIT;
 }
 
 static void mpegts_demuxer_finalize(GObject *object)
@@ -262,6 +279,41 @@ static void mpegts_demuxer_finalize(GObject *object)
     G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+static void mpegts_demuxer_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec)
+{
+    MpegTSDemuxer *demuxer = MPEGTS_DEMUXER(object);
+    switch (property_id)
+    {
+    case PROP_READ_AHEAD:
+        g_mutex_lock(&demuxer->lock);
+        demuxer->read_ahead = g_value_get_uint(value);
+        if (demuxer->adapter_limit_type == LIMITED && demuxer->adapter_limit_size < demuxer->read_ahead)
+        {
+            demuxer->adapter_limit_size = demuxer->read_ahead;
+            g_cond_signal(&demuxer->del_cond);
+        }
+        g_mutex_unlock(&demuxer->lock);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+        break;
+    }
+}
+
+static void mpegts_demuxer_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec)
+{
+    MpegTSDemuxer *demuxer = MPEGTS_DEMUXER(object);
+    switch (property_id)
+    {
+    case PROP_READ_AHEAD:
+        g_value_set_uint(value, demuxer->read_ahead);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+        break;
+    }
+}
+
 static inline void post_error(MpegTSDemuxer *demuxer, const char* description, int result, int code)
 {
     char* error_string = g_strdup_printf("%s: %d (%s)", description, result,
@@ -350,7 +402,9 @@ static GstFlowReturn mpegts_demuxer_chain(GstPad *pad, GstObject *parent, GstBuf
     g_mutex_lock(&demuxer->lock);
 
     GstFlowReturn result = get_locked_result(demuxer);
-    while (((gint64)gst_adapter_available(demuxer->sink_adapter) + gst_buffer_get_size(buf)) >= demuxer->adapter_limit_size &&
+    // An empty adapter always takes the buffer, otherwise a buffer larger than the limit would never be queued.
+    while (gst_adapter_available(demuxer->sink_adapter) > 0 &&
+           ((gint64)gst_adapter_available(demuxer->sink_adapter) + gst_buffer_get_size(buf)) >= demuxer->adapter_limit_size &&
            result == GST_FLOW_OK)
     {
         g_cond_wait(&demuxer->del_cond, &demuxer->lock);
@@ -981,7 +1035,7 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
                 demuxer->context->pb = io_context;
 
                 demuxer->adapter_limit_type = UNLIMITED;
-                demuxer->adapter_limit_size = ADAPTER_LIMIT;
+                demuxer->adapter_limit_size = demuxer->read_ahead;
 
                 AVInputFormat* iformat = av_find_input_format("mpegts");
 
@@ -1044,7 +1098,9 @@ static int mpegts_demuxer_read_packet(void *opaque, uint8_t *buffer, int size)
 
     g_mutex_lock(&demuxer->lock);
     gint available = gst_adapter_available(demuxer->sink_adapter);
-    while (available < demuxer->offset + size &&
+    // Return whatever is queued instead of waiting for a full buffer, so libav can
+    // start parsing while the rest of the read is still in flight.
+    while (available <= (gint)demuxer->offset &&
            !demuxer->is_eos && !demuxer->is_flushing && demuxer->is_reading)
     {
         if (demuxer->adapter_limit_type == UNLIMITED &&
@@ -1061,10 +1117,11 @@ static int mpegts_demuxer_read_packet(void *opaque, uint8_t *buffer, int size)
 
     if (demuxer->is_reading && !demuxer->is_flushing)
     {
-        if (demuxer->is_eos && available <= size) {
+        gint remaining = available - (gint)demuxer->offset;
+        if (demuxer->is_eos && remaining <= size)
             demuxer->is_last_buffer_send = TRUE; // Last buffer
-            size = available;
-        }
+        if (size > remaining)
+            size = remaining;
 
         if (size > 0)
         {
@@ -1216,7 +1273,7 @@ static void mpegts_demuxer_init_state(MpegTSDemuxer *demuxer)
     demuxer->update = FALSE;
 
     demuxer->adapter_limit_type = UNLIMITED;
-    demuxer->adapter_limit_size = ADAPTER_LIMIT;
+    demuxer->adapter_limit_size = demuxer->read_ahead;
 
     init_stream(&demuxer->video);
     init_stream(&demuxer->audio);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,26 @@
 #include <libavformat/avformat.h>
 #include <libavutil/pixfmt.h>
 
+#if HW_DECODE
+#include <libavutil/pixdesc.h>
+#endif // HW_DECODE
+
+#if ZERO_COPY_FRAMES
+#include <libavutil/buffer.h>
+#include <libavutil/imgutils.h>
+
+// Line alignment of pictures allocated by videodecoder_get_buffer2(). Large
+// enough for any SIMD code in libavcodec.
+#define FRAME_STRIDE_ALIGN 64
+#define FRAME_PADDING      (2 * FRAME_STRIDE_ALIGN)
+
+G_LOCK_DEFINE_STATIC(frame_pool_lock);
+#endif // ZERO_COPY_FRAMES
+
+// Number of consecutive late frames after which non-reference frames are
+// not decoded at all, until a frame is in time again.
+#define QOS_SKIP_THRESHOLD 4
+
 GST_DEBUG_CATEGORY_STATIC(videodecoder_debug);
 #define GST_CAT_DEFAULT videodecoder_debug
 
@@ -45,6 +65,7 @@ enum
     PROP_0,
     PROP_CODEC_ID,
     PROP_IS_SUPPORTED,
+    PROP_THREAD_COUNT,
 };
 
 /*
@@ -114,12 +135,14 @@ GType videodecoder_get_type (void)
  ***********************************************************************************/
 static GstStateChangeReturn videodecoder_change_state(GstElement* element, GstStateChange transition);
 static gboolean             videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent *event);
+static gboolean             videodecoder_src_event(GstPad *pad, GstObject *parent, GstEvent *event);
 static GstFlowReturn        videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf);
 
 static void                 videodecoder_init_state(VideoDecoder *decoder);
 static void                 videodecoder_state_reset(VideoDecoder *decoder);
 
 static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps);
+static void     videodecoder_init_context(BaseDecoder *base);
 
 static void videodecoder_dispose(GObject* object);
 static void videodecoder_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
@@ -147,6 +170,8 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     gobject_class->set_property = videodecoder_set_property;
     gobject_class->get_property = videodecoder_get_property;
 
+    BASEDECODER_CLASS(klass)->init_context = videodecoder_init_context;
+
     g_object_class_install_property (gobject_class, PROP_CODEC_ID,
         g_param_spec_int ("codec-id", "Codec ID", "Codec ID", -1, G_MAXINT, 0,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
@@ -154,6 +179,10 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     g_object_class_install_property (gobject_class, PROP_IS_SUPPORTED,
         g_param_spec_boolean ("is-supported", "Is supported", "Is codec ID supported", FALSE,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_THREAD_COUNT,
+        g_param_spec_int ("thread-count", "Thread count", "Number of decoding threads, 0 for automatic", 0, G_MAXINT, 0,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
 }
 
 static void videodecoder_init(VideoDecoder *decoder)
@@ -168,6 +197,7 @@ static void videodecoder_init(VideoDecoder *decoder)
 
     // Output.
     base->srcpad = gst_pad_new_from_static_template(&source_template, "src");
+    gst_pad_set_event_function(base->srcpad, GST_DEBUG_FUNCPTR(videodecoder_src_event));
     gst_pad_use_fixed_caps(base->srcpad);
     gst_element_add_pad(GST_ELEMENT(decoder), base->srcpad);
 }
@@ -201,6 +231,15 @@ static void videodecoder_dispose(GObject* object)
 
     basedecoder_close_decoder(BASEDECODER(decoder));
 
+#if ZERO_COPY_FRAMES
+    // Pictures still referenced downstream keep the pool alive until released.
+    G_LOCK(frame_pool_lock);
+    if (decoder->frame_pool)
+        av_buffer_pool_uninit(&decoder->frame_pool);
+    decoder->frame_pool_size = 0;
+    G_UNLOCK(frame_pool_lock);
+#endif // ZERO_COPY_FRAMES
+
     G_OBJECT_CLASS(parent_class)->dispose(object);
 }
 
@@ -234,6 +273,9 @@ static void videodecoder_set_property(GObject *object, guint property_id, const
     case PROP_CODEC_ID:
         decoder->codec_id = g_value_get_int(value);
         break;
+    case PROP_THREAD_COUNT:
+        decoder->thread_count = g_value_get_int(value);
+        break;
     default:
         break;
     }
@@ -249,6 +291,9 @@ static void videodecoder_get_property(GObject *object, guint property_id, GValue
         is_supported = videodecoder_is_decoder_by_codec_id_supported(decoder->codec_id);
         g_value_set_boolean(value, is_supported);
         break;
+    case PROP_THREAD_COUNT:
+        g_value_set_int(value, decoder->thread_count);
+        break;
     default:
         break;
     }
@@ -333,18 +378,18 @@ static gboolean videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent
             break;
         }
 
-#ifdef DEBUG_OUTPUT
         case GST_EVENT_SEGMENT:
         {
-            GstSegment segment;
-            gst_event_copy_segment(event, &segment);
+            gst_event_copy_segment(event, &decoder->segment);
 
+#ifdef DEBUG_OUTPUT
+            GstSegment *segment = &decoder->segment;
             g_print("videodecoder_sink_event: NEW_SEGMENT rate=%.1f, format=%d, start=%.3f, stop=%.3f, time=%.3f\n",
-                    segment.rate, segment.format, (double)segment.start/GST_SECOND, (double)segment.stop/GST_SECOND, (double)segment.time/GST_SECOND);
+                    segment->rate, segment->format, (double)segment->start/GST_SECOND, (double)segment->stop/GST_SECOND, (double)segment->time/GST_SECOND);
+#endif // DEBUG_OUTPUT
 
             break;
         }
-#endif // DEBUG_OUTPUT
 
         default:
             break;
@@ -356,18 +401,53 @@ static gboolean videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent
     return ret;
 }
 
+/***********************************************************************************
+ * Source event handler
+ ***********************************************************************************/
+static gboolean videodecoder_src_event(GstPad *pad, GstObject *parent, GstEvent *event)
+{
+    VideoDecoder *decoder = VIDEODECODER(parent);
+
+    if (GST_EVENT_TYPE(event) == GST_EVENT_QOS)
+    {
+        GstQOSType type;
+        gdouble proportion;
+        GstClockTimeDiff diff;
+        GstClockTime timestamp;
+
+        // The sink reports how late it rendered the frame at timestamp. Frames
+        // behind it by as much again are not going to be shown in time either.
+        gst_event_parse_qos(event, &type, &proportion, &diff, &timestamp);
+
+        GST_OBJECT_LOCK(decoder);
+        if (diff > 0)
+            decoder->earliest_time = timestamp + 2 * diff;
+        else if (timestamp > (GstClockTime)(-diff))
+            decoder->earliest_time = timestamp + diff;
+        else
+            decoder->earliest_time = 0;
+        GST_OBJECT_UNLOCK(decoder);
+    }
+
+    return gst_pad_event_default(pad, parent, event);
+}
+
 /***********************************************************************************
  * chain
  ***********************************************************************************/
 static void videodecoder_init_state(VideoDecoder *decoder)
 {
     decoder->width = decoder->height = 0;
+    decoder->y_blocksize = 0;
     decoder->u_offset = 0;
     decoder->v_offset = 0;
     decoder->uv_blocksize = 0;
     decoder->frame_size = 0;
     decoder->discont = FALSE;
     decoder->codec_id = JFX_CODEC_ID_UNKNOWN;
+    gst_segment_init(&decoder->segment, GST_FORMAT_TIME);
+    decoder->earliest_time = GST_CLOCK_TIME_NONE;
+    decoder->late_frames = 0;
 #if HEVC_SUPPORT
     decoder->sws_context = NULL;
     decoder->dest_frame = NULL;
@@ -376,6 +456,10 @@ static void videodecoder_init_state(VideoDecoder *decoder)
     decoder->sws_freeContext_func = NULL;
     decoder->sws_scale_func = NULL;
 #endif // HEVC_SUPPORT
+#if HW_DECODE
+    decoder->hw_pix_fmt = AV_PIX_FMT_NONE;
+    decoder->format = AV_PIX_FMT_NONE;
+#endif // HW_DECODE
 
     basedecoder_init_state(BASEDECODER(decoder));
 }
@@ -438,10 +522,291 @@ static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps
     return base->is_initialized;
 }
 
+#if HW_DECODE
+/*
+ * Picks the hardware surface format when libavcodec offers it. Returning a
+ * software format instead makes libavcodec fall back to software decoding,
+ * for example when the stream profile is not supported by the driver.
+ */
+static enum AVPixelFormat videodecoder_get_format(AVCodecContext *context, const enum AVPixelFormat *formats)
+{
+    VideoDecoder *decoder = (VideoDecoder*)context->opaque;
+    const enum AVPixelFormat *format;
+
+    for (format = formats; *format != AV_PIX_FMT_NONE; format++)
+    {
+        if (*format == decoder->hw_pix_fmt)
+            return *format;
+    }
+
+    for (format = formats; *format != AV_PIX_FMT_NONE; format++)
+    {
+        const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get(*format);
+        if (desc && !(desc->flags & AV_PIX_FMT_FLAG_HWACCEL))
+            return *format;
+    }
+
+    return AV_PIX_FMT_NONE;
+}
+
+/*
+ * Attaches a VA-API or VDPAU device to the codec context if the codec can
+ * decode into its surfaces. Decoding stays in software if no device can be
+ * opened.
+ */
+static void videodecoder_init_hw_device(BaseDecoder *base)
+{
+    static const enum AVHWDeviceType device_types[] = {
+        AV_HWDEVICE_TYPE_VAAPI,
+        AV_HWDEVICE_TYPE_VDPAU
+    };
+    VideoDecoder *decoder = VIDEODECODER(base);
+    void *swscale_module = NULL;
+    size_t i;
+
+    decoder->hw_pix_fmt = AV_PIX_FMT_NONE;
+
+    // Downloaded surfaces are NV12 or P010 and need libswscale to become I420.
+    swscale_module = dlopen("libswscale.so", RTLD_LAZY);
+    if (swscale_module == NULL)
+        return;
+    dlclose(swscale_module);
+
+    for (i = 0; i < G_N_ELEMENTS(device_types); i++)
+    {
+        enum AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
+        AVBufferRef *device_ctx = NULL;
+        int index;
+
+        for (index = 0;; index++)
+        {
+            const AVCodecHWConfig *config = avcodec_get_hw_config(base->codec, index);
+            if (config == NULL)
+                break;
+
+            if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) &&
+                    config->device_type == device_types[i])
+            {
+                pix_fmt = config->pix_fmt;
+                break;
+            }
+        }
+
+        if (pix_fmt == AV_PIX_FMT_NONE)
+            continue;
+
+        if (av_hwdevice_ctx_create(&device_ctx, device_types[i], NULL, NULL, 0) < 0)
+            continue;
+
+        // Codec context takes ownership of the device reference.
+        base->context->hw_device_ctx = device_ctx;
+        base->context->opaque = decoder;
+        base->context->get_format = videodecoder_get_format;
+        decoder->hw_pix_fmt = pix_fmt;
+
+        GST_DEBUG_OBJECT(decoder, "Using %s hardware decoding",
+                         av_hwdevice_get_type_name(device_types[i]));
+        break;
+    }
+}
+
+/*
+ * Downloads a decoded hardware surface into system memory, replacing the
+ * contents of base->frame. The result is usually NV12 or P010 and goes
+ * through the same libswscale conversion as any other non I420 frame.
+ */
+static gboolean videodecoder_download_frame(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+    AVFrame *sw_frame = av_frame_alloc();
+
+    if (sw_frame == NULL)
+        return FALSE;
+
+    if (av_hwframe_transfer_data(sw_frame, base->frame, 0) < 0 ||
+            av_frame_copy_props(sw_frame, base->frame) < 0)
+    {
+        av_frame_free(&sw_frame);
+        return FALSE;
+    }
+
+    av_frame_unref(base->frame);
+    av_frame_move_ref(base->frame, sw_frame);
+    av_frame_free(&sw_frame);
+
+    return TRUE;
+}
+#endif // HW_DECODE
+
+#if ZERO_COPY_FRAMES
+/*
+ * Allocates I420 pictures as a single pooled buffer with the planes laid
+ * out back to back, so a decoded frame can be wrapped into one GstBuffer
+ * instead of being copied plane by plane. Other formats, including
+ * hardware surfaces, use the default allocator.
+ */
+static int videodecoder_get_buffer2(AVCodecContext *context, AVFrame *frame, int flags)
+{
+    VideoDecoder *decoder = (VideoDecoder*)context->opaque;
+    int linesize_align[AV_NUM_DATA_POINTERS];
+    int linesize[4];
+    int width = frame->width;
+    int height = frame->height;
+    int y_size, uv_size, size, i;
+
+    if (frame->format != AV_PIX_FMT_YUV420P ||
+            !(context->codec->capabilities & AV_CODEC_CAP_DR1))
+        return avcodec_default_get_buffer2(context, frame, flags);
+
+    avcodec_align_dimensions2(context, &width, &height, linesize_align);
+    if (av_image_fill_linesizes(linesize, AV_PIX_FMT_YUV420P, width) < 0)
+        return avcodec_default_get_buffer2(context, frame, flags);
+
+    for (i = 0; i < 3; i++)
+        linesize[i] = (linesize[i] + FRAME_STRIDE_ALIGN - 1) & ~(FRAME_STRIDE_ALIGN - 1);
+
+    y_size = linesize[0] * height;
+    uv_size = linesize[1] * ((height + 1) / 2);
+    size = y_size + 2 * uv_size + FRAME_PADDING;
+
+    G_LOCK(frame_pool_lock);
+    if (decoder->frame_pool == NULL || decoder->frame_pool_size != size)
+    {
+        if (decoder->frame_pool)
+            av_buffer_pool_uninit(&decoder->frame_pool);
+        decoder->frame_pool = av_buffer_pool_init(size, av_buffer_alloc);
+        decoder->frame_pool_size = decoder->frame_pool ? size : 0;
+    }
+    frame->buf[0] = decoder->frame_pool ? av_buffer_pool_get(decoder->frame_pool) : NULL;
+    G_UNLOCK(frame_pool_lock);
+
+    if (frame->buf[0] == NULL)
+        return AVERROR(ENOMEM);
+
+    frame->data[0] = frame->buf[0]->data;
+    frame->data[1] = frame->data[0] + y_size;
+    frame->data[2] = frame->data[1] + uv_size;
+    for (i = 0; i < 3; i++)
+        frame->linesize[i] = linesize[i];
+    frame->extended_data = frame->data;
+
+    return 0;
+}
+
+/*
+ * Returns TRUE if the frame was allocated by videodecoder_get_buffer2().
+ */
+static gboolean videodecoder_is_contiguous(AVFrame *frame)
+{
+    return frame->format == AV_PIX_FMT_YUV420P &&
+           frame->buf[0] != NULL && frame->buf[1] == NULL &&
+           frame->data[1] > frame->data[0] && frame->data[2] > frame->data[1];
+}
+
+static void videodecoder_release_frame_buffer(gpointer data)
+{
+    AVBufferRef *buffer = (AVBufferRef*)data;
+    av_buffer_unref(&buffer);
+}
+
+/*
+ * Wraps the decoded picture into a GstBuffer which holds a reference to the
+ * picture memory. Returns NULL if the picture does not match the layout
+ * advertised on the source pad and has to be copied.
+ */
+static GstBuffer* videodecoder_wrap_frame(VideoDecoder *decoder)
+{
+    AVFrame *frame = BASEDECODER(decoder)->frame;
+    AVBufferRef *buffer;
+    gsize offset;
+
+    if (!videodecoder_is_contiguous(frame) ||
+            (unsigned int)(frame->data[1] - frame->data[0]) != decoder->u_offset ||
+            (unsigned int)(frame->data[2] - frame->data[0]) != decoder->v_offset)
+        return NULL;
+
+    offset = frame->data[0] - frame->buf[0]->data;
+    if (offset + decoder->frame_size > (gsize)frame->buf[0]->size)
+        return NULL;
+
+    buffer = av_buffer_ref(frame->buf[0]);
+    if (buffer == NULL)
+        return NULL;
+
+    return gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, buffer->data, buffer->size,
+                                       offset, decoder->frame_size,
+                                       buffer, videodecoder_release_frame_buffer);
+}
+#endif // ZERO_COPY_FRAMES
+
+static void videodecoder_init_context(BaseDecoder *base)
+{
+    VideoDecoder *decoder = VIDEODECODER(base);
+
+    BASEDECODER_CLASS(parent_class)->init_context(base);
+
+#if ZERO_COPY_FRAMES
+    base->context->opaque = decoder;
+    base->context->get_buffer2 = videodecoder_get_buffer2;
+#endif // ZERO_COPY_FRAMES
+
+    // Frame threading decodes several frames in parallel at the cost of
+    // one frame of latency per thread, slice threading helps streams with
+    // many slices per frame. Zero lets libavcodec pick the thread count
+    // from the number of CPUs.
+    base->context->thread_count = decoder->thread_count;
+    base->context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
+#if HW_DECODE
+    videodecoder_init_hw_device(base);
+#endif // HW_DECODE
+}
+
 static void videodecoder_state_reset(VideoDecoder *decoder)
 {
     decoder->frame_finished = 1;
     basedecoder_flush(BASEDECODER(decoder));
+
+    GST_OBJECT_LOCK(decoder);
+    decoder->earliest_time = GST_CLOCK_TIME_NONE;
+    GST_OBJECT_UNLOCK(decoder);
+    decoder->late_frames = 0;
+}
+
+/*
+ * Returns TRUE if a decoded frame with the given timestamp can no longer be
+ * shown in time according to the last QoS event. Such frames are dropped before
+ * they are copied or converted. The first frame after a discontinuity is always
+ * delivered.
+ */
+static gboolean videodecoder_is_late(VideoDecoder *decoder, int64_t pts, GstBuffer *buf)
+{
+    GstClockTime earliest_time;
+    GstClockTime running_time;
+
+    if (pts == AV_NOPTS_VALUE || decoder->discont || GST_BUFFER_IS_DISCONT(buf) ||
+            decoder->segment.format != GST_FORMAT_TIME)
+        return FALSE;
+
+    GST_OBJECT_LOCK(decoder);
+    earliest_time = decoder->earliest_time;
+    GST_OBJECT_UNLOCK(decoder);
+
+    if (!GST_CLOCK_TIME_IS_VALID(earliest_time))
+        return FALSE;
+
+    running_time = gst_segment_to_running_time(&decoder->segment, GST_FORMAT_TIME, (guint64)pts);
+    if (GST_CLOCK_TIME_IS_VALID(running_time) && GST_BUFFER_DURATION_IS_VALID(buf))
+        running_time += GST_BUFFER_DURATION(buf);
+
+    if (GST_CLOCK_TIME_IS_VALID(running_time) && running_time < earliest_time)
+    {
+        decoder->late_frames++;
+        return TRUE;
+    }
+
+    decoder->late_frames = 0;
+    return FALSE;
 }
 
 #if HEVC_SUPPORT
@@ -582,6 +947,17 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
     int height = base->context->height;
 #endif // NEW_CODEC_ID
 
+#if HW_DECODE
+    // libavcodec may switch between hardware and software decoding
+    // mid-stream, so the format can change without a resolution change.
+    if (decoder->format != base->frame->format)
+    {
+        decoder->format = base->frame->format;
+        decoder->width = 0;
+        decoder->height = 0;
+    }
+#endif // HW_DECODE
+
     if (caps == NULL ||
         decoder->width != width || decoder->height != height)
     {
@@ -630,11 +1006,24 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
             linesize2 = base->frame->linesize[2];
         }
 
-        decoder->u_offset = linesize0 * decoder->height;
+        decoder->y_blocksize = linesize0 * decoder->height;
         decoder->uv_blocksize = linesize1 * decoder->height / 2;
 
-        decoder->v_offset = decoder->u_offset + decoder->uv_blocksize;
-        decoder->frame_size = (linesize0 + linesize1) * decoder->height;
+#if ZERO_COPY_FRAMES
+        // Describe the layout of our own pictures, so they can be passed
+        // downstream as is. Copied frames use the same layout.
+        if (set_linesize && videodecoder_is_contiguous(base->frame))
+        {
+            decoder->u_offset = base->frame->data[1] - base->frame->data[0];
+            decoder->v_offset = base->frame->data[2] - base->frame->data[0];
+        }
+        else
+#endif // ZERO_COPY_FRAMES
+        {
+            decoder->u_offset = decoder->y_blocksize;
+            decoder->v_offset = decoder->u_offset + decoder->uv_blocksize;
+        }
+        decoder->frame_size = decoder->v_offset + decoder->uv_blocksize;
 
         GstCaps *src_caps = gst_caps_new_simple("video/x-raw-yuv",
                                                 "format", G_TYPE_STRING, "YV12",
@@ -710,6 +1099,9 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
 
     unmap_buf = TRUE;
 
+    // Under sustained overload stop decoding frames nothing else depends on.
+    base->context->skip_frame = (decoder->late_frames >= QOS_SKIP_THRESHOLD) ? AVDISCARD_NONREF : AVDISCARD_DEFAULT;
+
     if (!base->is_hls)
     {
         if (av_new_packet(&decoder->packet, info.size) == 0)
@@ -795,10 +1187,31 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
 
     if (decoder->frame_finished > 0)
     {
+#if HW_DECODE
+        if (base->frame->format == decoder->hw_pix_fmt &&
+                !videodecoder_download_frame(decoder))
+        {
+            gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                     GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                     g_strdup("Hardware video frame download failed"), NULL,
+                                     ("videodecoder.c"), ("videodecoder_chain"), 0);
+
+            result = GST_FLOW_ERROR;
+            goto _exit;
+        }
+#endif // HW_DECODE
+
         if (!videodecoder_configure_sourcepad(decoder))
             result = GST_FLOW_ERROR;
         else
         {
+#if NO_REORDERED_OPAQUE
+            if (videodecoder_is_late(decoder, base->frame->pts, buf))
+#else // NO_REORDERED_OPAQUE
+            if (videodecoder_is_late(decoder, base->frame->reordered_opaque, buf))
+#endif // NO_REORDERED_OPAQUE
+                goto _exit;
+
 #if HEVC_SUPPORT
             // Check to see if we need to convert frame to YUV420p
             if (base->frame->format != AV_PIX_FMT_YUV420P)
@@ -838,7 +1251,17 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
                 data2 = base->frame->data[2];
             }
 
-            GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
+            GstBuffer *outbuf = NULL;
+            gboolean wrapped = FALSE;
+#if ZERO_COPY_FRAMES
+            if (set_frame_values)
+            {
+                outbuf = videodecoder_wrap_frame(decoder);
+                wrapped = (outbuf != NULL);
+            }
+#endif // ZERO_COPY_FRAMES
+            if (outbuf == NULL)
+                outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
             if (outbuf == NULL)
             {
                 if (result != GST_FLOW_FLUSHING)
@@ -862,42 +1285,49 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
                     GST_BUFFER_DURATION(outbuf) = GST_BUFFER_DURATION(buf); // Duration for video usually same
                 }
 
-                if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
+                if (!wrapped)
                 {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
+                    if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
+                    {
+                        // INLINE - gst_buffer_unref()
+                        gst_buffer_unref(outbuf);
+                        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                         g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
+                        goto _exit;
+                    }
 
-                // Copy image by parts from different arrays.
-                if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
-                {
-                    gst_buffer_unmap(outbuf, &info2);
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
+                    // Copy image by parts from different arrays.
+                    if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
+                    {
+                        gst_buffer_unmap(outbuf, &info2);
+                        // INLINE - gst_buffer_unref()
+                        gst_buffer_unref(outbuf);
+                        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                         g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
+                        goto _exit;
+                    }
 
-                out_buf_size = decoder->frame_size;
-                if (out_buf_size >= decoder->u_offset)
-                {
-                    memcpy(info2.data, data0, decoder->u_offset);
-                    out_buf_size -= decoder->u_offset;
-                    if (out_buf_size >= decoder->uv_blocksize &&
-                        decoder->uv_blocksize <= decoder->frame_size &&
-                        decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
+                    out_buf_size = decoder->frame_size;
+                    if (out_buf_size >= decoder->u_offset)
                     {
-                        memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
-                        out_buf_size -= decoder->uv_blocksize;
+                        memcpy(info2.data, data0, decoder->y_blocksize);
+                        out_buf_size -= decoder->u_offset;
                         if (out_buf_size >= decoder->uv_blocksize &&
                             decoder->uv_blocksize <= decoder->frame_size &&
-                            decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
+                            decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
                         {
-                            memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
+                            memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
+                            out_buf_size -= decoder->uv_blocksize;
+                            if (out_buf_size >= decoder->uv_blocksize &&
+                                decoder->uv_blocksize <= decoder->frame_size &&
+                                decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
+                            {
+                                memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
+                            }
+                            else
+                            {
+                                copy_error = TRUE;
+                            }
                         }
                         else
                         {
@@ -908,21 +1338,17 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
                     {
                         copy_error = TRUE;
                     }
-                }
-                else
-                {
-                    copy_error = TRUE;
-                }
 
-                gst_buffer_unmap(outbuf, &info2);
+                    gst_buffer_unmap(outbuf, &info2);
 
-                if (copy_error)
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
+                    if (copy_error)
+                    {
+                        // INLINE - gst_buffer_unref()
+                        gst_buffer_unref(outbuf);
+                        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                         g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
+                        goto _exit;
+                    }
                 }
 
                 GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
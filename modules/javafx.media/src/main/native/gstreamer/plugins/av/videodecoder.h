@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,10 @@
 #include <dlfcn.h>
 #include <libswscale/swscale.h>
 
+#if HW_DECODE
+#include <libavutil/hwcontext.h>
+#endif // HW_DECODE
+
 G_BEGIN_DECLS
 
 #define TYPE_VIDEODECODER \
@@ -73,6 +77,7 @@ struct _VideoDecoder {
     gboolean     discont;
 
     unsigned int frame_size;     // in bytes
+    unsigned int y_blocksize;
     unsigned int u_offset;
     unsigned int v_offset;
     unsigned int uv_blocksize;
@@ -80,6 +85,11 @@ struct _VideoDecoder {
     AVPacket     packet;
 
     gint         codec_id;
+    gint         thread_count;   // libavcodec threads, 0 for automatic
+
+    GstSegment   segment;        // current segment, converts timestamps to running time
+    GstClockTime earliest_time;  // running time before which frames are late, from QoS events
+    gint         late_frames;    // consecutive late frames, non-reference frames are skipped above a threshold
 
 #if HEVC_SUPPORT
     struct SwsContext *sws_context;
@@ -91,6 +101,16 @@ struct _VideoDecoder {
     sws_freeContext_ptr sws_freeContext_func;
     sws_scale_ptr       sws_scale_func;
 #endif // HEVC_SUPPORT
+
+#if ZERO_COPY_FRAMES
+    AVBufferPool      *frame_pool;      // contiguous I420 pictures, see videodecoder_get_buffer2()
+    int                frame_pool_size;
+#endif // ZERO_COPY_FRAMES
+
+#if HW_DECODE
+    enum AVPixelFormat hw_pix_fmt;      // format of hardware surfaces or AV_PIX_FMT_NONE
+    int                format;          // pixel format the source pad is configured for
+#endif // HW_DECODE
 };
 
 struct _VideoDecoderClass
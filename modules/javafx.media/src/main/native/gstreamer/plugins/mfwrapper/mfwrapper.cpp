@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,7 @@
 
 #include <mfidl.h>
 #include <Wmcodecdsp.h>
+#include <d3d10.h>
 
 #include "fxplugins_common.h"
 
@@ -213,6 +214,10 @@ static void gst_mfwrapper_init(GstMFWrapper *decoder)
     if (bCallCoUninitialize)
         CoUninitialize();
 
+    decoder->pD3D11Device = NULL;
+    decoder->pDXGIDeviceManager = NULL;
+    decoder->uiResetToken = 0;
+
     decoder->pDecoder = NULL;
     decoder->pDecoderOutput = NULL;
     decoder->pDecoderBuffer = NULL;
@@ -258,6 +263,8 @@ static void gst_mfwrapper_dispose(GObject* object)
     // pDecoderOutput is released.
     decoder->pDecoderBuffer = NULL;
     SafeRelease(&decoder->pDecoder);
+    SafeRelease(&decoder->pDXGIDeviceManager);
+    SafeRelease(&decoder->pD3D11Device);
 
     for (int i = 0; i < MAX_COLOR_CONVERT; i++)
     {
@@ -334,6 +341,97 @@ static gboolean mfwrapper_is_decoder_by_codec_id_supported(GstMFWrapper *decoder
         return FALSE;
 }
 
+// Creates D3D11 device and DXGI device manager used for hardware decoding.
+// Returns S_OK if device manager is available.
+static HRESULT mfwrapper_init_d3d11(GstMFWrapper *decoder)
+{
+    HRESULT hr = S_OK;
+    ID3D10Multithread *pMultithread = NULL;
+    static const D3D_FEATURE_LEVEL featureLevels[] = {
+        D3D_FEATURE_LEVEL_11_1,
+        D3D_FEATURE_LEVEL_11_0,
+        D3D_FEATURE_LEVEL_10_1,
+        D3D_FEATURE_LEVEL_10_0,
+        D3D_FEATURE_LEVEL_9_3
+    };
+
+    if (decoder->pDXGIDeviceManager != NULL)
+        return S_OK;
+
+    hr = D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL,
+            D3D11_CREATE_DEVICE_VIDEO_SUPPORT, featureLevels,
+            ARRAYSIZE(featureLevels), D3D11_SDK_VERSION,
+            &decoder->pD3D11Device, NULL, NULL);
+
+    // Decoder and color converter can use device from different threads
+    if (SUCCEEDED(hr))
+        hr = decoder->pD3D11Device->QueryInterface(IID_PPV_ARGS(&pMultithread));
+
+    if (SUCCEEDED(hr))
+        pMultithread->SetMultithreadProtected(TRUE);
+
+    SafeRelease(&pMultithread);
+
+    if (SUCCEEDED(hr))
+        hr = MFCreateDXGIDeviceManager(&decoder->uiResetToken, &decoder->pDXGIDeviceManager);
+
+    if (SUCCEEDED(hr))
+        hr = decoder->pDXGIDeviceManager->ResetDevice(decoder->pD3D11Device, decoder->uiResetToken);
+
+    if (FAILED(hr))
+    {
+        SafeRelease(&decoder->pDXGIDeviceManager);
+        SafeRelease(&decoder->pD3D11Device);
+    }
+
+    return hr;
+}
+
+// Hands DXGI device manager to decoder, so it decodes using DXVA. Must be
+// called before media types are set. If decoder is not D3D11 aware or does not
+// accept device manager, decoder will stay in software mode.
+static void mfwrapper_set_d3d_manager(GstMFWrapper *decoder)
+{
+    HRESULT hr = S_OK;
+    IMFAttributes *pAttributes = NULL;
+    UINT32 unD3D11Aware = FALSE;
+
+    if (decoder->pDecoder == NULL)
+        return;
+
+    hr = decoder->pDecoder->GetAttributes(&pAttributes);
+    if (SUCCEEDED(hr))
+        hr = pAttributes->GetUINT32(MF_SA_D3D11_AWARE, &unD3D11Aware);
+    SafeRelease(&pAttributes);
+
+    if (FAILED(hr) || !unD3D11Aware)
+        return;
+
+    if (FAILED(mfwrapper_init_d3d11(decoder)))
+        return;
+
+    hr = decoder->pDecoder->ProcessMessage(MFT_MESSAGE_SET_D3D_MANAGER,
+            (ULONG_PTR)decoder->pDXGIDeviceManager);
+    if (FAILED(hr))
+    {
+        SafeRelease(&decoder->pDXGIDeviceManager);
+        SafeRelease(&decoder->pD3D11Device);
+    }
+}
+
+// Switches decoder back to software mode
+static void mfwrapper_release_d3d_manager(GstMFWrapper *decoder)
+{
+    if (decoder->pDXGIDeviceManager == NULL)
+        return;
+
+    if (decoder->pDecoder)
+        decoder->pDecoder->ProcessMessage(MFT_MESSAGE_SET_D3D_MANAGER, NULL);
+
+    SafeRelease(&decoder->pDXGIDeviceManager);
+    SafeRelease(&decoder->pD3D11Device);
+}
+
 static HRESULT mfwrapper_create_sample(IMFSample **ppSample, DWORD dwSize, CMFGSTBuffer **ppMFGSTBuffer)
 {
     if (ppSample == NULL || dwSize == 0 || ppMFGSTBuffer == NULL)
@@ -1205,7 +1303,9 @@ static HRESULT mfwrapper_configure_decoder_output_type(GstMFWrapper *decoder)
 
     // We should cache as much supported formats as possible.
     // Try them in order we prefered.
-    if (pOutputTypeIYUV)
+    // With hardware decoding output is in video memory and can be only read
+    // back via color converter, so do not use IYUV directly.
+    if (pOutputTypeIYUV && decoder->pDXGIDeviceManager == NULL)
         hr = mfwrapper_set_decoder_output_type(decoder, pOutputTypeIYUV, false);
 
     // Try only if previous one failed
@@ -1279,11 +1379,11 @@ static gboolean mfwrapper_convert_output_helper(GstMFWrapper *decoder,
     return FALSE;
 }
 
-static gboolean mfwrapper_convert_output(GstMFWrapper *decoder)
+static gboolean mfwrapper_convert_output(GstMFWrapper *decoder, IMFSample *pDecoderSample)
 {
     gboolean result = TRUE;
     // Sample to convert. Always start from decoder
-    IMFSample *pInputSample = decoder->pDecoderOutput;
+    IMFSample *pInputSample = pDecoderSample;
 
     if (decoder == NULL || pInputSample == NULL)
         return FALSE;
@@ -1397,7 +1497,7 @@ static gint mfwrapper_process_output(GstMFWrapper *decoder)
             if (decoder->pColorConvert[COLOR_CONVERT_IYUV] &&
                 decoder->pColorConvertOutput[COLOR_CONVERT_IYUV])
             {
-                if (mfwrapper_convert_output(decoder))
+                if (mfwrapper_convert_output(decoder, outputDataBuffer.pSample))
                 {
                     // Deliver from IYUV color converter
                     ret = mfwrapper_deliver_sample(decoder,
@@ -1421,6 +1521,10 @@ static gint mfwrapper_process_output(GstMFWrapper *decoder)
                 ("mfwrapper.c"), ("mfwrapper_process_output"), 0);
     }
 
+    // Release sample allocated by decoder (hardware decoding)
+    if (outputDataBuffer.pSample != decoder->pDecoderOutput)
+        SafeRelease(&outputDataBuffer.pSample);
+
     if (decoder->is_eos || decoder->is_flushing || ret != GST_FLOW_OK)
         return PO_FLUSHING;
     else if (SUCCEEDED(hr))
@@ -1505,6 +1609,13 @@ static gboolean mfwrapper_reload_decoder(GstMFWrapper *decoder)
     // Load decoder based on media types of current one
     hr = mfwrapper_load_decoder_media_types(decoder, majorType, subType);
 
+    // Keep decoding on GPU if old decoder did
+    if (SUCCEEDED(hr) && decoder->pDXGIDeviceManager != NULL)
+    {
+        hr = decoder->pDecoder->ProcessMessage(MFT_MESSAGE_SET_D3D_MANAGER,
+                (ULONG_PTR)decoder->pDXGIDeviceManager);
+    }
+
     // Copy input and output types and we should be good to go
     if (SUCCEEDED(hr))
         hr = decoder->pDecoder->SetInputType(0, pInputType, 0);
@@ -1896,12 +2007,25 @@ static gboolean mfwrapper_init_mf(GstMFWrapper *decoder, GstCaps *caps)
 
     if (!decoder->is_decoder_initialized)
     {
+        mfwrapper_set_d3d_manager(decoder);
+
         if (SUCCEEDED(hr))
             hr = mfwrapper_set_input_media_type(decoder, caps);
 
         if (SUCCEEDED(hr))
             hr = mfwrapper_set_output_media_type(decoder, caps);
 
+        // Hardware might not support this stream, try software decoding
+        if (FAILED(hr) && decoder->pDXGIDeviceManager != NULL)
+        {
+            mfwrapper_release_d3d_manager(decoder);
+
+            hr = mfwrapper_set_input_media_type(decoder, caps);
+
+            if (SUCCEEDED(hr))
+                hr = mfwrapper_set_output_media_type(decoder, caps);
+        }
+
         if (SUCCEEDED(hr))
             hr = decoder->pDecoder->GetInputStatus(0, &dwStatus);
 
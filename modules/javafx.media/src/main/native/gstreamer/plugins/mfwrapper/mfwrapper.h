@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@
 #include <mfapi.h>
 #include <mferror.h>
 #include <mftransform.h>
+#include <d3d11.h>
 
 G_BEGIN_DECLS
 
@@ -82,6 +83,12 @@ struct _GstMFWrapper
 
     HRESULT hr_mfstartup;
 
+    // Set when decoder runs on GPU (DXVA). Decoder allocates output samples
+    // in video memory in this case and pDecoderOutput is not used.
+    ID3D11Device *pD3D11Device;
+    IMFDXGIDeviceManager *pDXGIDeviceManager;
+    UINT uiResetToken;
+
     IMFTransform *pDecoder;
     IMFSample *pDecoderOutput;
     CMFGSTBuffer *pDecoderBuffer;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,9 +30,16 @@
 
 typedef struct _Cache Cache;
 
+// Default amount of cached data kept in memory before spilling to disk
+#define CACHE_DEFAULT_MEMORY_SIZE (8 * 1024 * 1024)
+
 void      cache_static_init(void); // Must be called only once from the ProgressBuffer class initializer
 
-Cache*    create_cache();
+/* Creates a cache that keeps up to memory_size bytes in memory. Data beyond that
+ * is stored in a temporary file. Implementations without a memory cache ignore
+ * memory_size.
+ */
+Cache*    create_cache(gsize memory_size);
 void      destroy_cache(Cache* instance);
 
 // Writes a buffer.
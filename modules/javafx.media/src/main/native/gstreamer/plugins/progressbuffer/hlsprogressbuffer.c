@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -177,7 +177,7 @@ static void hls_progress_buffer_init(HLSProgressBuffer *element)
 
     for (int i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
     {
-        element->cache[i] = create_cache();
+        element->cache[i] = create_cache(CACHE_DEFAULT_MEMORY_SIZE);
         element->cache_size[i] = 0;
         element->cache_write_ready[i] = TRUE;
         element->cache_discont[i] = FALSE;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,18 +28,29 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <string.h>
 
 #define DEFAULT_BUFFER_SIZE 4096
+#define CHUNK_SIZE          65536
 static const char *tempDir = NULL;
 
+/*
+ * The first memory_size bytes of the cache are kept in RAM, split in chunks
+ * that are allocated as data arrives. Anything past that spills to a temporary
+ * file which is only created once it is needed, so short media never touches
+ * the disk.
+ */
 struct _Cache
 {
-    char*   filename;
-    int     readHandle;
-    int     writeHandle;
+    guint8** chunks;
+    guint    chunk_count;
+    gint64   memory_size;
 
-    gint64  read_position;
-    gint64  write_position;
+    int      fileHandle;
+
+    gint64   read_position;
+    gint64   write_position;
+    gint64   data_size;      // highest position ever written
 };
 
 void cache_static_init(void)
@@ -47,46 +58,124 @@ void cache_static_init(void)
     tempDir = g_get_tmp_dir();
 }
 
-Cache* create_cache()
+Cache* create_cache(gsize memory_size)
 {
-    Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
+    Cache* result= (Cache*)g_try_malloc0(sizeof(Cache));
     if (result)
     {
-        result->filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
-        if (result->filename == NULL)
-            goto _error_exit;
-        else
+        result->chunk_count = memory_size / CHUNK_SIZE;
+        result->memory_size = (gint64)result->chunk_count * CHUNK_SIZE;
+        if (result->chunk_count > 0)
         {
-        result->writeHandle = g_mkstemp_full(result->filename, O_RDWR, S_IRUSR|S_IWUSR);
-            result->readHandle = open(result->filename, O_RDONLY, 0);
+            result->chunks = (guint8**)g_try_malloc0(result->chunk_count * sizeof(guint8*));
+            if (result->chunks == NULL)
+            {
+                g_free(result);
+                return NULL;
+            }
+        }
+
+        result->fileHandle = -1;
+        result->read_position = result->write_position = result->data_size = 0;
+    }
+    return result;
+}
+
+void destroy_cache(Cache* instance)
+{
+    guint i;
 
-            if(result->writeHandle < 0 || result->readHandle < 0)
-                goto _error_exit;
+    if (instance->fileHandle >= 0)
+        close(instance->fileHandle);
 
-        if (unlink(result->filename) < 0)
+    for (i = 0; i < instance->chunk_count; i++)
+        g_free(instance->chunks[i]);
+    g_free(instance->chunks);
+
+    g_free(instance);
+}
+
+static gboolean cache_open_file(Cache* cache)
+{
+    if (cache->fileHandle < 0)
+    {
+        char* filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
+        if (filename == NULL)
+            return FALSE;
+
+        cache->fileHandle = g_mkstemp_full(filename, O_RDWR, S_IRUSR|S_IWUSR);
+        if (cache->fileHandle >= 0 && unlink(filename) < 0)
         {
-            close (result->writeHandle);
-            close (result->readHandle);
-        goto _error_exit;
+            close(cache->fileHandle);
+            cache->fileHandle = -1;
         }
+        g_free(filename);
+    }
+    return cache->fileHandle >= 0;
+}
 
-            result->read_position = result->write_position = 0;
+static gsize cache_write_data(Cache* cache, gint64 position, const guint8* data, gsize size)
+{
+    gsize written = 0;
+
+    while (written < size && position < cache->memory_size)
+    {
+        guint  index = (guint)(position / CHUNK_SIZE);
+        gsize  offset = (gsize)(position % CHUNK_SIZE);
+        gsize  count = MIN(CHUNK_SIZE - offset, size - written);
+
+        if (cache->chunks[index] == NULL)
+        {
+            cache->chunks[index] = (guint8*)g_try_malloc0(CHUNK_SIZE);
+            if (cache->chunks[index] == NULL)
+                return written;
         }
+
+        memcpy(cache->chunks[index] + offset, data + written, count);
+        written += count;
+        position += count;
     }
-    return result;
 
-_error_exit:
-    g_free(result);
-    return NULL;
+    if (written < size && cache_open_file(cache))
+    {
+        ssize_t result = pwrite(cache->fileHandle, data + written, size - written, position - cache->memory_size);
+        if (result > 0)
+            written += result;
+    }
+
+    return written;
 }
 
-void destroy_cache(Cache* instance)
+static gsize cache_read_data(Cache* cache, gint64 position, guint8* data, gsize size)
 {
-    close(instance->writeHandle);
-    close(instance->readHandle);
-    g_free(instance->filename);
+    gsize read_bytes = 0;
 
-    g_free(instance);
+    if (position >= cache->data_size)
+        return 0;
+    size = MIN(size, (gsize)(cache->data_size - position));
+
+    while (read_bytes < size && position < cache->memory_size)
+    {
+        guint  index = (guint)(position / CHUNK_SIZE);
+        gsize  offset = (gsize)(position % CHUNK_SIZE);
+        gsize  count = MIN(CHUNK_SIZE - offset, size - read_bytes);
+
+        if (cache->chunks[index] != NULL)
+            memcpy(data + read_bytes, cache->chunks[index] + offset, count);
+        else
+            memset(data + read_bytes, 0, count); // never written
+        read_bytes += count;
+        position += count;
+    }
+
+    if (read_bytes < size && cache->fileHandle >= 0)
+    {
+        ssize_t result = pread(cache->fileHandle, data + read_bytes, size - read_bytes, position - cache->memory_size);
+        if (result > 0)
+            read_bytes += result;
+    }
+
+    return read_bytes;
 }
 
 void cache_write_buffer(Cache* cache, GstBuffer* buffer)
@@ -94,9 +183,13 @@ void cache_write_buffer(Cache* cache, GstBuffer* buffer)
     GstMapInfo info;
     if (gst_buffer_map(buffer, &info, GST_MAP_READ))
     {
-        ssize_t written = write(cache->writeHandle, info.data, info.size);
+        gsize written = cache_write_data(cache, cache->write_position, info.data, info.size);
         if (written > 0)
+        {
             cache->write_position += written;
+            if (cache->data_size < cache->write_position)
+                cache->data_size = cache->write_position;
+        }
         gst_buffer_unmap(buffer, &info);
     }
 }
@@ -108,14 +201,14 @@ gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
 
     if (data)
     {
-        ssize_t size = 0;
+        gsize size = 0;
         if ((cache->write_position - cache->read_position) > 0 &&
             (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
             size = cache->write_position - cache->read_position;
         else
             size = DEFAULT_BUFFER_SIZE;
 
-        ssize_t read_bytes = read(cache->readHandle, data, size);
+        gsize read_bytes = cache_read_data(cache, cache->read_position, data, size);
         if (read_bytes > 0)
         {
             *buffer = gst_buffer_new_wrapped_full(0, data, DEFAULT_BUFFER_SIZE, 0, read_bytes, data, g_free);
@@ -141,8 +234,8 @@ GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_positio
     {
         guint8 *data = (guint8*)g_try_malloc(size);
         if (data)
-    {
-        ssize_t read_bytes = read(cache->readHandle, data, size);
+        {
+            gsize read_bytes = cache_read_data(cache, cache->read_position, data, size);
             if (read_bytes == size)
             {
                 *buffer = gst_buffer_new_wrapped_full(0, data, size, 0, read_bytes, data, g_free);
@@ -153,41 +246,30 @@ GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_positio
                 }
             }
             else
-            g_free(data); // Wrong size, deleting buffer to avoid leaking.
+                g_free(data); // Wrong size, deleting buffer to avoid leaking.
 
             cache->read_position += read_bytes;
-    }
+        }
     }
     return result;
 }
 
-static inline gboolean cache_set_handler_position(int handle, guint64 position)
-{
-    return lseek(handle, position, SEEK_SET) >= 0;
-}
-
 gboolean cache_set_write_position(Cache* cache, gint64 position)
 {
-    gboolean result = (position == cache->write_position);
-    if (!result)
-    {
-        result = cache_set_handler_position(cache->writeHandle, position);
-        if (result)
-            cache->write_position = position;
-    }
-    return result;
+    if (position < 0)
+        return FALSE;
+
+    cache->write_position = position;
+    return TRUE;
 }
 
 gboolean cache_set_read_position(Cache* cache, gint64 position)
 {
-    gboolean result = (position == cache->read_position);
-    if (!result)
-    {
-        result = cache_set_handler_position(cache->readHandle, position);
-        if (result)
-            cache->read_position = position;
-    }
-    return result;
+    if (position < 0)
+        return FALSE;
+
+    cache->read_position = position;
+    return TRUE;
 }
 
 gboolean cache_has_enough_data(Cache* cache)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,7 +49,7 @@ void cache_static_init(void)
     }
 }
 
-Cache* create_cache()
+Cache* create_cache(gsize memory_size)
 {
     Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
     if (result)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,9 +29,13 @@
 #include "Locator.h"
 #include <stdint.h>
 
+class CPipelineStatistics;
+
 class CStreamCallbacks
 {
 public:
+    CStreamCallbacks() : m_pStatistics(NULL) {}
+
     /* NeedBuffer returns true if the pipeline needs progressbuffer, false otherwise.
     * This can be detected by analysing url schemes.
     */
@@ -74,6 +78,13 @@ public:
 
     /* Virtual destructor */
     virtual ~CStreamCallbacks() {}
+
+    /* Statistics of the pipeline reading from this stream, NULL until the pipeline is built. */
+    inline void SetStatistics(CPipelineStatistics *pStatistics) { m_pStatistics = pStatistics; }
+    inline CPipelineStatistics* GetStatistics() { return m_pStatistics; }
+
+private:
+    CPipelineStatistics *m_pStatistics;
 };
 
 class CLocatorStream : public CLocator
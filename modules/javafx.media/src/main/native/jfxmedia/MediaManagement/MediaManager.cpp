@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,7 +49,10 @@ const static ContentTypesList EMPTY_LIST;
 //********** class CMediaManager
 //*************************************************************************************************
 CMediaManager::CMediaManager()
-:   m_uInternalError(ERROR_NONE)
+:   m_uInternalError(ERROR_NONE),
+    m_iDecoderThreads(0),
+    m_bLowLatencyAudio(false),
+    m_bKeyFrameSeek(false)
 {}
 
 CMediaManager::~CMediaManager()
@@ -111,6 +114,43 @@ void CMediaManager::SetWarningListener(CMediaWarningListener* pWarningListener)
     m_pWarningListener = pWarningListener;
 }
 
+/**
+ * CMediaManager::SetDecoderThreads(int decoderThreads)
+ *
+ * Sets the maximum number of threads each video decoder may use.
+ * Applies to players created afterwards.
+ *
+ * @param   The number of threads or 0 for the decoder default.
+ */
+void CMediaManager::SetDecoderThreads(int decoderThreads)
+{
+    m_iDecoderThreads = decoderThreads;
+}
+
+/**
+ * CMediaManager::SetLowLatencyAudio(bool lowLatencyAudio)
+ *
+ * Selects small audio sink buffers for players created afterwards.
+ *
+ * @param   true to trade buffering for a shorter output latency.
+ */
+void CMediaManager::SetLowLatencyAudio(bool lowLatencyAudio)
+{
+    m_bLowLatencyAudio = lowLatencyAudio;
+}
+
+/**
+ * CMediaManager::SetKeyFrameSeek(bool keyFrameSeek)
+ *
+ * Makes seeks of players created afterwards snap to the nearest key frame.
+ *
+ * @param   true to trade seek precision for seek speed.
+ */
+void CMediaManager::SetKeyFrameSeek(bool keyFrameSeek)
+{
+    m_bKeyFrameSeek = keyFrameSeek;
+}
+
 /**
  * CMediaManager::CreatePlayer(CLocator locator)
  *
@@ -144,6 +184,10 @@ uint32_t CMediaManager::CreatePlayer(CLocator* pLocator, CPipelineOptions* pOpti
             return ERROR_MEMORY_ALLOCATION;
     }
 
+    pOptions->SetDecoderThreads(m_iDecoderThreads);
+    pOptions->SetLowLatencyAudio(m_bLowLatencyAudio);
+    pOptions->SetKeyFrameSeek(m_bKeyFrameSeek);
+
     //***** Try to create a pipeline
     uRetCode = pPipelineFactory->CreatePlayerPipeline(pLocator, pOptions, &pPipeline);
 
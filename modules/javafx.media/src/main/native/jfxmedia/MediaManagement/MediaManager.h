@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,6 +53,10 @@ public:
 
     void    SetWarningListener(CMediaWarningListener* pWarningListener);
 
+    void    SetDecoderThreads(int decoderThreads);
+    void    SetLowLatencyAudio(bool lowLatencyAudio);
+    void    SetKeyFrameSeek(bool keyFrameSeek);
+
     uint32_t    CreatePlayer(CLocator* pLocator, CPipelineOptions* pOptions, CMedia** ppMedia);
 
 protected:
@@ -68,6 +72,9 @@ private:
     static MMSingleton          s_Singleton;
     CMediaWarningListener*      m_pWarningListener;
     uint32_t                    m_uInternalError;
+    int                         m_iDecoderThreads;
+    bool                        m_bLowLatencyAudio;
+    bool                        m_bKeyFrameSeek;
 };
 
 #endif  //_MEDIA_MANAGER_H_
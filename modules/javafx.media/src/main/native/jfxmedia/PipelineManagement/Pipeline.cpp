@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -193,3 +193,19 @@ CAudioSpectrum* CPipeline::GetAudioSpectrum()
 {
     return NULL;
 }
+
+/**
+ * CPipeline::GetStatistics()
+ *
+ * Copies up to iCount playback counters, indexed by CPipelineStatistics::Statistic.
+ */
+uint32_t CPipeline::GetStatistics(int64_t* pllValues, int iCount)
+{
+    if (NULL == pllValues)
+        return ERROR_FUNCTION_PARAM_NULL;
+
+    for (int i = 0; i < iCount && i < CPipelineStatistics::Count; i++)
+        pllValues[i] = m_Statistics.Get((CPipelineStatistics::Statistic)i);
+
+    return ERROR_NONE;
+}
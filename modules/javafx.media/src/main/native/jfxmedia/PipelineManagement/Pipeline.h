@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 #include "PipelineOptions.h"
 #include "AudioEqualizer.h"
 #include "AudioSpectrum.h"
+#include "PipelineStatistics.h"
 #include <MediaManagement/MediaWarningListener.h>
 
 #define DEFAULT_AUDIO_TRACK_ID 0
@@ -92,6 +93,9 @@ public:
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
+    virtual uint32_t        GetStatistics(int64_t* pllValues, int iCount);
+    inline CPipelineStatistics* GetPipelineStatistics() { return &m_Statistics; }
+
     CPlayerEventDispatcher* m_pEventDispatcher;
 
 protected:
@@ -108,6 +112,7 @@ protected:
     bool                    m_bDynamicElementsReady;
     bool                    m_bAudioSinkReady;
     bool                    m_bVideoSinkReady;
+    CPipelineStatistics     m_Statistics;
 };
 
 #endif  //_PIPELINE_H_
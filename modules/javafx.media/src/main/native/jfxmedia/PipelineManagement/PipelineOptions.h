@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,7 +47,10 @@ public:
         m_StreamMimeType(-1),
         m_AudioStreamMimeType(-1),
         m_bHLSModeEnabled(false),
-        m_audioFlags(0)
+        m_audioFlags(0),
+        m_DecoderThreads(0),
+        m_bLowLatencyAudio(false),
+        m_bKeyFrameSeek(false)
     {}
 
     virtual ~CPipelineOptions() {}
@@ -73,6 +76,15 @@ public:
     inline void  SetAudioFlags(int audioFlags) { m_audioFlags = audioFlags; }
     inline int  GetAudioFlags() { return m_audioFlags; }
 
+    inline void SetDecoderThreads(int decoderThreads) { m_DecoderThreads = decoderThreads; }
+    inline int  GetDecoderThreads() { return m_DecoderThreads; }
+
+    inline void SetLowLatencyAudio(bool enabled) { m_bLowLatencyAudio = enabled; }
+    inline bool GetLowLatencyAudio() { return m_bLowLatencyAudio; }
+
+    inline void SetKeyFrameSeek(bool enabled) { m_bKeyFrameSeek = enabled; }
+    inline bool GetKeyFrameSeek() { return m_bKeyFrameSeek; }
+
     // Returns true if we need to force default track ID. For multi source streams
     // two demuxers (qtdemux in case of fMP4 HLS with EXT-X-MEDIA) will report same
     // ID, since two demuxers are not aware of each other and that we actually
@@ -109,6 +121,12 @@ private:
     int         m_AudioStreamMimeType;
     bool        m_bHLSModeEnabled;
     int         m_audioFlags;
+    // Maximum number of threads per video decoder, 0 for decoder default.
+    int         m_DecoderThreads;
+    // Use small audio sink buffers to reduce output latency.
+    bool        m_bLowLatencyAudio;
+    // Snap seeks to the nearest key frame instead of seeking accurately.
+    bool        m_bKeyFrameSeek;
 
     // Audio parser or demultiplexer for main stream
     string      m_StreamParser;
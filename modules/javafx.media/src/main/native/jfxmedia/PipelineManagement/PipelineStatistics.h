@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _PIPELINE_STATISTICS_H_
+#define _PIPELINE_STATISTICS_H_
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * class CPipelineStatistics
+ *
+ * Playback counters of a pipeline. They are updated from the streaming threads
+ * with relaxed atomic operations, so they are cheap enough to be always on, and
+ * read on demand through CPipeline::GetStatistics().
+ */
+class CPipelineStatistics
+{
+public:
+    // Indices into the statistics array, must match com.sun.media.jfxmedia.MediaStatistics
+    enum Statistic
+    {
+        FramesDecoded = 0,      // video frames delivered by the decoder
+        FramesDropped = 1,      // video frames dropped by the sink for being too late
+        FramesLate = 2,         // video frames delivered after their presentation time
+        AudioQueueLevel = 3,    // buffers waiting in the audio queue
+        VideoQueueLevel = 4,    // buffers waiting in the video queue
+        Reads = 5,              // blocks read from the source
+        ReadTime = 6,           // total time spent reading blocks, in microseconds
+        MaxReadTime = 7,        // longest time spent reading a block, in microseconds
+        Count = 8
+    };
+
+    CPipelineStatistics()
+    {
+        for (int i = 0; i < Count; i++)
+            m_Values[i].store(0, std::memory_order_relaxed);
+    }
+
+    inline void Add(Statistic stat, int64_t value)
+    {
+        m_Values[stat].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    inline void Set(Statistic stat, int64_t value)
+    {
+        m_Values[stat].store(value, std::memory_order_relaxed);
+    }
+
+    inline void Max(Statistic stat, int64_t value)
+    {
+        int64_t current = m_Values[stat].load(std::memory_order_relaxed);
+        while (value > current &&
+               !m_Values[stat].compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    inline int64_t Get(Statistic stat) const
+    {
+        return m_Values[stat].load(std::memory_order_relaxed);
+    }
+
+    inline void AddRead(int64_t llMicros)
+    {
+        Add(Reads, 1);
+        Add(ReadTime, llMicros);
+        Max(MaxReadTime, llMicros);
+    }
+
+private:
+    std::atomic<int64_t> m_Values[Count];
+};
+
+#endif  //_PIPELINE_STATISTICS_H_
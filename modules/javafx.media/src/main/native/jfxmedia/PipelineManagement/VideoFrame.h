@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,12 +69,15 @@ public:
 
     unsigned int        GetPlaneCount();
     void                SetPlaneCount(unsigned int count);
-    void*               GetDataForPlane(unsigned int planeIndex);
+    virtual void*       GetDataForPlane(unsigned int planeIndex);
     unsigned long       GetSizeForPlane(unsigned int planeIndex);
     unsigned int        GetStrideForPlane(unsigned int planeIndex);
 
     virtual CVideoFrame *ConvertToFormat(FrameType type);
 
+    // Platform object holding the decoded image (CVPixelBufferRef on macOS), or NULL
+    virtual void*       GetNativeFrameHandle() { return NULL; }
+
     bool                GetFrameDirty() { return m_FrameDirty; }
     void                SetFrameDirty(bool dirty) { m_FrameDirty = dirty; }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,12 @@
 #define ENABLE_SIMD_SSE2 0
 #endif
 
+#if !ENABLE_SIMD_SSE2 && defined(__aarch64__) && defined(__ARM_NEON)
+#define ENABLE_SIMD_NEON 1
+#else
+#define ENABLE_SIMD_NEON 0
+#endif
+
 // --- Begin macros
 #define TCLAMP_U8(val, dst) dst = pClip[val]
 
@@ -2352,6 +2358,261 @@ int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
 }
 // --- End SSE2 YCbCr420p conversion functions
 
+#elif ENABLE_SIMD_NEON
+
+#include <arm_neon.h>
+
+// --- Begin NEON YCbCr420p conversion functions
+/*
+ * Same fixed point math as the SSE2 code above. Samples are scaled by 256
+ * and multiplied by coefficients scaled by 8192, keeping the upper 16 bits,
+ * so channel values are scaled by 32 until the final saturating shift.
+ */
+#define NEON_C0     0x2543              /* 1.1644  * 8192 */
+#define NEON_C1     0x4097              /* 2.0184  * 8192 */
+#define NEON_C4     0x0c8b              /* abs( -0.3920 * 8192 ) */
+#define NEON_C5     0x1a06              /* abs( -0.8132 * 8192 ) */
+#define NEON_C8     0x3317              /* 1.5966  * 8192 */
+#define NEON_COFF0  ((int16_t)0xdd60)   /* -276.9856 * 32 */
+#define NEON_COFF1  ((int16_t)0x10f4)   /* 135.6352  * 32 */
+#define NEON_COFF2  ((int16_t)0xe420)   /* -222.9952 * 32 */
+
+static inline int16x8_t neon_mulhi(uint8x8_t x, uint16_t c)
+{
+    uint16x8_t x16 = vshll_n_u8(x, 8);
+    uint32x4_t lo = vmull_n_u16(vget_low_u16(x16), c);
+    uint32x4_t hi = vmull_high_n_u16(x16, c);
+    return vreinterpretq_s16_u16(vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16)));
+}
+
+static inline void neon_chroma(uint8x8_t u, uint8x8_t v,
+                               int16x8_t *r, int16x8_t *g, int16x8_t *b)
+{
+    *b = vaddq_s16(neon_mulhi(u, NEON_C1), vdupq_n_s16(NEON_COFF0));
+    *g = vsubq_s16(vdupq_n_s16(NEON_COFF1),
+                   vaddq_s16(neon_mulhi(u, NEON_C4), neon_mulhi(v, NEON_C5)));
+    *r = vaddq_s16(neon_mulhi(v, NEON_C8), vdupq_n_s16(NEON_COFF2));
+}
+
+static inline uint8x16_t neon_channel(int16x8_t y_lo, int16x8_t y_hi,
+                                      int16x8_t c_lo, int16x8_t c_hi)
+{
+    return vcombine_u8(vqshrun_n_s16(vaddq_s16(y_lo, c_lo), 5),
+                       vqshrun_n_s16(vaddq_s16(y_hi, c_hi), 5));
+}
+
+static inline uint8x16_t neon_premultiply(uint8x16_t c, uint8x16_t a)
+{
+    // (c * (a + 1)) >> 8, same as PREMULTIPLY_ALPHA
+    uint16x8_t lo = vaddw_u8(vmull_u8(vget_low_u8(c), vget_low_u8(a)), vget_low_u8(c));
+    uint16x8_t hi = vaddw_u8(vmull_high_u8(c, a), vget_high_u8(c));
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+/*
+ * Converts 16 pixels of one row. Chroma values are already duplicated for
+ * each pixel pair. If a is NULL the pixels are opaque, otherwise BGRA
+ * output is premultiplied like the SSE2 code.
+ */
+static inline void neon_store_16(uint8_t *d, const uint8_t *y, const uint8_t *a,
+                                 int16x8x2_t r, int16x8x2_t g, int16x8x2_t b, int argb)
+{
+    uint8x16_t y8 = vld1q_u8(y);
+    int16x8_t y_lo = neon_mulhi(vget_low_u8(y8), NEON_C0);
+    int16x8_t y_hi = neon_mulhi(vget_high_u8(y8), NEON_C0);
+    uint8x16_t a8 = a ? vld1q_u8(a) : vdupq_n_u8(0xff);
+    uint8x16x4_t px;
+
+    uint8x16_t r8 = neon_channel(y_lo, y_hi, r.val[0], r.val[1]);
+    uint8x16_t g8 = neon_channel(y_lo, y_hi, g.val[0], g.val[1]);
+    uint8x16_t b8 = neon_channel(y_lo, y_hi, b.val[0], b.val[1]);
+
+    if (argb) {
+        px.val[0] = a8;
+        px.val[1] = r8;
+        px.val[2] = g8;
+        px.val[3] = b8;
+    } else {
+        if (a) {
+            r8 = neon_premultiply(r8, a8);
+            g8 = neon_premultiply(g8, a8);
+            b8 = neon_premultiply(b8, a8);
+        }
+        px.val[0] = b8;
+        px.val[1] = g8;
+        px.val[2] = r8;
+        px.val[3] = a8;
+    }
+    vst4q_u8(d, px);
+}
+
+static inline uint8_t neon_clamp(int32_t v)
+{
+    v >>= 5;
+    return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+static inline void neon_store_pixel(uint8_t *d, int32_t yy, int32_t ir, int32_t ig, int32_t ib,
+                                    const uint8_t *a, int argb)
+{
+    int32_t a8 = a ? *a : 0xff;
+    int32_t r8 = neon_clamp(yy + ir);
+    int32_t g8 = neon_clamp(yy + ig);
+    int32_t b8 = neon_clamp(yy + ib);
+
+    if (argb) {
+        d[0] = (uint8_t)a8;
+        d[1] = (uint8_t)r8;
+        d[2] = (uint8_t)g8;
+        d[3] = (uint8_t)b8;
+    } else {
+        if (a) {
+            r8 = (r8 * (a8 + 1)) >> 8;
+            g8 = (g8 * (a8 + 1)) >> 8;
+            b8 = (b8 * (a8 + 1)) >> 8;
+        }
+        d[0] = (uint8_t)b8;
+        d[1] = (uint8_t)g8;
+        d[2] = (uint8_t)r8;
+        d[3] = (uint8_t)a8;
+    }
+}
+
+static int neon_convert_420(uint8_t *dst, int32_t dst_stride,
+                            int32_t width, int32_t height,
+                            const uint8_t *y, const uint8_t *v, const uint8_t *u, const uint8_t *a,
+                            int32_t y_stride, int32_t v_stride, int32_t u_stride, int32_t a_stride,
+                            int argb)
+{
+    int32_t i, j;
+
+    if (dst == NULL || y == NULL || u == NULL || v == NULL)
+        return 1;
+
+    if (width <= 0 || height <= 0)
+        return 1;
+
+    if ((width | height) & 1)
+        return 1;
+
+    for (j = 0; j < (height >> 1); j++) {
+        const uint8_t *y1 = y + 2 * j * y_stride;
+        const uint8_t *y2 = y1 + y_stride;
+        const uint8_t *a1 = a ? a + 2 * j * a_stride : NULL;
+        const uint8_t *a2 = a ? a1 + a_stride : NULL;
+        const uint8_t *pu = u + j * u_stride;
+        const uint8_t *pv = v + j * v_stride;
+        uint8_t *d1 = dst + 2 * j * dst_stride;
+        uint8_t *d2 = d1 + dst_stride;
+
+        for (i = 0; i <= width - 16; i += 16) {
+            int16x8_t r, g, b;
+
+            neon_chroma(vld1_u8(pu + (i >> 1)), vld1_u8(pv + (i >> 1)), &r, &g, &b);
+
+            int16x8x2_t rr = vzipq_s16(r, r);
+            int16x8x2_t gg = vzipq_s16(g, g);
+            int16x8x2_t bb = vzipq_s16(b, b);
+
+            neon_store_16(d1 + 4 * i, y1 + i, a1 ? a1 + i : NULL, rr, gg, bb, argb);
+            neon_store_16(d2 + 4 * i, y2 + i, a2 ? a2 + i : NULL, rr, gg, bb, argb);
+        }
+
+        for (; i < width; i += 2) {
+            int32_t iu = pu[i >> 1];
+            int32_t iv = pv[i >> 1];
+            int32_t ib = NEON_COFF0 + ((iu * NEON_C1) >> 8);
+            int32_t ig = NEON_COFF1 - (((iu * NEON_C4) >> 8) + ((iv * NEON_C5) >> 8));
+            int32_t ir = NEON_COFF2 + ((iv * NEON_C8) >> 8);
+
+            neon_store_pixel(d1 + 4 * i, (y1[i] * NEON_C0) >> 8, ir, ig, ib,
+                             a1 ? a1 + i : NULL, argb);
+            neon_store_pixel(d1 + 4 * i + 4, (y1[i + 1] * NEON_C0) >> 8, ir, ig, ib,
+                             a1 ? a1 + i + 1 : NULL, argb);
+            neon_store_pixel(d2 + 4 * i, (y2[i] * NEON_C0) >> 8, ir, ig, ib,
+                             a2 ? a2 + i : NULL, argb);
+            neon_store_pixel(d2 + 4 * i + 4, (y2[i + 1] * NEON_C0) >> 8, ir, ig, ib,
+                             a2 ? a2 + i + 1 : NULL, argb);
+        }
+    }
+
+    return 0;
+}
+
+int ColorConvert_YCbCr420p_to_ARGB32(
+                               uint8_t *argb,
+                               int32_t argb_stride,
+                               int32_t width,
+                               int32_t height,
+                               const uint8_t *y,
+                               const uint8_t *v,
+                               const uint8_t *u,
+                               const uint8_t *a,
+                               int32_t y_stride,
+                               int32_t v_stride,
+                               int32_t u_stride,
+                               int32_t a_stride)
+{
+    if (a == NULL)
+        return 1;
+
+    return neon_convert_420(argb, argb_stride, width, height, y, v, u, a,
+                            y_stride, v_stride, u_stride, a_stride, 1);
+}
+
+int ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
+                                     uint8_t *argb,
+                                     int32_t argb_stride,
+                                     int32_t width,
+                                     int32_t height,
+                                     const uint8_t *y,
+                                     const uint8_t *v,
+                                     const uint8_t *u,
+                                     int32_t y_stride,
+                                     int32_t v_stride,
+                                     int32_t u_stride)
+{
+    return neon_convert_420(argb, argb_stride, width, height, y, v, u, NULL,
+                            y_stride, v_stride, u_stride, 0, 1);
+}
+
+int ColorConvert_YCbCr420p_to_BGRA32(uint8_t *bgra,
+                                     int32_t bgra_stride,
+                                     int32_t width,
+                                     int32_t height,
+                                     const uint8_t *y,
+                                     const uint8_t *v,
+                                     const uint8_t *u,
+                                     const uint8_t *a,
+                                     int32_t y_stride,
+                                     int32_t v_stride,
+                                     int32_t u_stride,
+                                     int32_t a_stride)
+{
+    if (a == NULL)
+        return 1;
+
+    return neon_convert_420(bgra, bgra_stride, width, height, y, v, u, a,
+                            y_stride, v_stride, u_stride, a_stride, 0);
+}
+
+int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
+                                              uint8_t *bgra,
+                                              int32_t bgra_stride,
+                                              int32_t width,
+                                              int32_t height,
+                                              const uint8_t *y,
+                                              const uint8_t *v,
+                                              const uint8_t *u,
+                                              int32_t y_stride,
+                                              int32_t v_stride,
+                                              int32_t u_stride)
+{
+    return neon_convert_420(bgra, bgra_stride, width, height, y, v, u, NULL,
+                            y_stride, v_stride, u_stride, 0, 0);
+}
+// --- End NEON YCbCr420p conversion functions
+
 #else // Generic C implementation
 
 // --- Begin C YCbCr420p conversion functions
@@ -2592,11 +2853,70 @@ int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
     return 0;
 }
 // --- End C YCbCr420p conversion functions
-#endif // ENABLE_SIMD_SSE2
+#endif // ENABLE_SIMD_SSE2 / ENABLE_SIMD_NEON
 // --- End YCbCr420p conversion functions
 
 // --- Begin YCbCr422p conversion functions
 
+#if ENABLE_SIMD_NEON
+/*
+ * Converts packed 2vuy rows, i.e. u points to "U Y0 V Y1" quadruplets with
+ * y == u + 1 and v == u + 2.
+ */
+static void neon_convert_422_bgra(uint8_t *bgra, int32_t bgra_stride,
+                                  int32_t width, int32_t height,
+                                  const uint8_t *u, int32_t stride)
+{
+    int32_t i, j;
+
+    for (j = 0; j < height; j++) {
+        const uint8_t *s = u + j * stride;
+        uint8_t *d = bgra + j * bgra_stride;
+
+        for (i = 0; i <= width - 32; i += 32) {
+            uint8x16x4_t src = vld4q_u8(s + 2 * i);
+            int16x8_t r_lo, g_lo, b_lo, r_hi, g_hi, b_hi;
+            uint8x16x2_t r, g, b;
+            uint8x16x4_t px;
+
+            neon_chroma(vget_low_u8(src.val[0]), vget_low_u8(src.val[2]), &r_lo, &g_lo, &b_lo);
+            neon_chroma(vget_high_u8(src.val[0]), vget_high_u8(src.val[2]), &r_hi, &g_hi, &b_hi);
+
+            int16x8_t y0_lo = neon_mulhi(vget_low_u8(src.val[1]), NEON_C0);
+            int16x8_t y0_hi = neon_mulhi(vget_high_u8(src.val[1]), NEON_C0);
+            int16x8_t y1_lo = neon_mulhi(vget_low_u8(src.val[3]), NEON_C0);
+            int16x8_t y1_hi = neon_mulhi(vget_high_u8(src.val[3]), NEON_C0);
+
+            // Even and odd pixels share chroma, interleave them back
+            r = vzipq_u8(neon_channel(y0_lo, y0_hi, r_lo, r_hi), neon_channel(y1_lo, y1_hi, r_lo, r_hi));
+            g = vzipq_u8(neon_channel(y0_lo, y0_hi, g_lo, g_hi), neon_channel(y1_lo, y1_hi, g_lo, g_hi));
+            b = vzipq_u8(neon_channel(y0_lo, y0_hi, b_lo, b_hi), neon_channel(y1_lo, y1_hi, b_lo, b_hi));
+
+            px.val[3] = vdupq_n_u8(0xff);
+            px.val[0] = b.val[0];
+            px.val[1] = g.val[0];
+            px.val[2] = r.val[0];
+            vst4q_u8(d + 4 * i, px);
+            px.val[0] = b.val[1];
+            px.val[1] = g.val[1];
+            px.val[2] = r.val[1];
+            vst4q_u8(d + 4 * i + 64, px);
+        }
+
+        for (; i < width; i += 2) {
+            int32_t iu = s[2 * i];
+            int32_t iv = s[2 * i + 2];
+            int32_t ib = NEON_COFF0 + ((iu * NEON_C1) >> 8);
+            int32_t ig = NEON_COFF1 - (((iu * NEON_C4) >> 8) + ((iv * NEON_C5) >> 8));
+            int32_t ir = NEON_COFF2 + ((iv * NEON_C8) >> 8);
+
+            neon_store_pixel(d + 4 * i, (s[2 * i + 1] * NEON_C0) >> 8, ir, ig, ib, NULL, 0);
+            neon_store_pixel(d + 4 * i + 4, (s[2 * i + 3] * NEON_C0) >> 8, ir, ig, ib, NULL, 0);
+        }
+    }
+}
+#endif // ENABLE_SIMD_NEON
+
 int ColorConvert_YCbCr422p_to_ARGB32_no_alpha(uint8_t *argb,
                                               int32_t argb_stride,
                                               int32_t width,
@@ -2638,6 +2958,13 @@ int ColorConvert_YCbCr422p_to_BGRA32_no_alpha(uint8_t *bgra,
     if (width & 1)
         return 1;
 
+#if ENABLE_SIMD_NEON
+    if (y == u + 1 && v == u + 2) {
+        neon_convert_422_bgra(bgra, bgra_stride, width, height, u, y_stride);
+        return 0;
+    }
+#endif // ENABLE_SIMD_NEON
+
     sly1 = say1 = y;
     slu = sau = u;
     slv = sav = v;
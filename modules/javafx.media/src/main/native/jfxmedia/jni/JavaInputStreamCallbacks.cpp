@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,7 +42,9 @@ jmethodID CJavaInputStreamCallbacks::m_CloseConnectionMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_PropertyMID = 0;
 
 CJavaInputStreamCallbacks::CJavaInputStreamCallbacks()
-    : m_ConnectionHolder(0)
+    : m_ConnectionHolder(0),
+      m_Buffer(0),
+      m_pBufferData(NULL)
 {}
 
 CJavaInputStreamCallbacks::~CJavaInputStreamCallbacks()
@@ -161,6 +163,30 @@ bool CJavaInputStreamCallbacks::NeedBuffer()
     return result;
 }
 
+/*
+ * Caches the address of the buffer Java has just filled while we are still
+ * attached to the VM, so that CopyBlock() does not need another attach and
+ * field lookup for every block. The global reference keeps the buffer alive
+ * until Java replaces it with a different one.
+ */
+void CJavaInputStreamCallbacks::UpdateBuffer(JNIEnv *env, jobject connection)
+{
+    jobject buffer = env->GetObjectField(connection, m_BufferFID);
+    if (NULL == buffer) {
+        return;
+    }
+
+    if (NULL == m_Buffer || !env->IsSameObject(buffer, m_Buffer)) {
+        if (NULL != m_Buffer) {
+            env->DeleteGlobalRef(m_Buffer);
+        }
+        m_Buffer = env->NewGlobalRef(buffer);
+        m_pBufferData = (NULL != m_Buffer) ? env->GetDirectBufferAddress(m_Buffer) : NULL;
+    }
+
+    env->DeleteLocalRef(buffer);
+}
+
 int CJavaInputStreamCallbacks::ReadNextBlock()
 {
     int result = -1;
@@ -173,6 +199,8 @@ int CJavaInputStreamCallbacks::ReadNextBlock()
             result = pEnv->CallIntMethod(connection, m_ReadNextBlockMID);
             if (javaEnv.clearException()) {
                 result = -2;
+            } else if (result > 0) {
+                UpdateBuffer(pEnv, connection);
             }
             pEnv->DeleteLocalRef(connection);
         }
@@ -193,6 +221,8 @@ int CJavaInputStreamCallbacks::ReadBlock(int64_t position, int size)
             result = pEnv->CallIntMethod(connection, m_ReadBlockMID, position, size);
             if (javaEnv.clearException()) {
                 result = -2;
+            } else if (result > 0) {
+                UpdateBuffer(pEnv, connection);
             }
             pEnv->DeleteLocalRef(connection);
         }
@@ -203,20 +233,10 @@ int CJavaInputStreamCallbacks::ReadBlock(int64_t position, int size)
 
 void CJavaInputStreamCallbacks::CopyBlock(void* destination, int size)
 {
-    CJavaEnvironment javaEnv(m_jvm);
-    JNIEnv *pEnv = javaEnv.getEnvironment();
-    if (pEnv) {
-        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
-        if (connection) {
-            jobject buffer = pEnv->GetObjectField(connection, m_BufferFID);
-            void *data = pEnv->GetDirectBufferAddress(buffer);
-
-            memcpy(destination, data, size);
-            pEnv->DeleteLocalRef(buffer);
-            pEnv->DeleteLocalRef(connection);
-        }
+    if (NULL != m_pBufferData) {
+        memcpy(destination, m_pBufferData, size);
     }
- }
+}
 
 bool CJavaInputStreamCallbacks::IsSeekable()
 {
@@ -287,6 +307,12 @@ void CJavaInputStreamCallbacks::CloseConnection()
 
         pEnv->DeleteGlobalRef(m_ConnectionHolder);
         m_ConnectionHolder = NULL;
+
+        if (NULL != m_Buffer) {
+            pEnv->DeleteGlobalRef(m_Buffer);
+            m_Buffer = NULL;
+        }
+        m_pBufferData = NULL;
     }
 }
 
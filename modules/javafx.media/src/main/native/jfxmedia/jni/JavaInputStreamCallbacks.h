@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,7 +48,11 @@ virtual ~CJavaInputStreamCallbacks();
     int  Property(int prop, int value);
 
 private:
+    void UpdateBuffer(JNIEnv *env, jobject connection);
+
     jobject          m_ConnectionHolder;
+    jobject          m_Buffer;      // global ref to the last buffer filled by Java
+    void             *m_pBufferData;
 
     JavaVM           *m_jvm;
     static jfieldID  m_BufferFID;
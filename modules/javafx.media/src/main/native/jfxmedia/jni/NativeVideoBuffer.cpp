@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,14 +46,48 @@ JNIEXPORT void JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeD
 
 /*
  * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeGetTimestamp
- * Signature: (J)D
+ * Method:    nativeGetFrameInfo
+ * Signature: (J[I)D
+ *
+ * Fills info with the frame description, see NativeVideoBuffer.INFO_* for the
+ * layout, and returns the frame timestamp. Frames are immutable so the Java side
+ * only needs to call this once per frame.
  */
-JNIEXPORT jdouble JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetTimestamp
-    (JNIEnv *env, jobject obj, jlong nativeHandle)
+JNIEXPORT jdouble JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetFrameInfo
+    (JNIEnv *env, jobject obj, jlong nativeHandle, jintArray info)
 {
     CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
-    if (frame) {
+    if (frame && info) {
+        if (env->GetArrayLength(info) < com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_SIZE) {
+            return 0.0;
+        }
+
+        jint values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_SIZE] = { 0 };
+        unsigned int count = frame->GetPlaneCount();
+
+        // Sanity check plane count, never more than four
+        if (count > 4) {
+            count = 4;
+        }
+
+        values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_WIDTH] = (jint)frame->GetWidth();
+        values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_HEIGHT] = (jint)frame->GetHeight();
+        values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_ENCODED_WIDTH] = (jint)frame->GetEncodedWidth();
+        values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_ENCODED_HEIGHT] = (jint)frame->GetEncodedHeight();
+        // CVideoFrame types now match Java VideoFormat native types, so just pass it along
+        values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_FORMAT] = (jint)frame->GetType();
+        values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_HAS_ALPHA] = frame->HasAlpha() ? 1 : 0;
+        values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_PLANE_COUNT] = (jint)count;
+        for (unsigned int ii = 0; ii < count; ii++) {
+            values[com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_STRIDES + ii] = (jint)frame->GetStrideForPlane(ii);
+        }
+
+        env->SetIntArrayRegion(info, 0, com_sun_media_jfxmediaimpl_NativeVideoBuffer_INFO_SIZE, values);
+        if (env->ExceptionCheck()) {
+            env->ExceptionClear();
+            return 0.0;
+        }
+
         return frame->GetTime();
     }
     return 0.0;
@@ -72,7 +106,7 @@ JNIEXPORT jobject JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nati
     CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
     if (frame) {
         void *dataPtr = frame->GetDataForPlane((unsigned int)plane);
-        jlong capacity = (jlong)frame->GetSizeForPlane((unsigned int)plane);
+        jlong capacity = dataPtr ? (jlong)frame->GetSizeForPlane((unsigned int)plane) : 0;
         jobject buffer = env->NewDirectByteBuffer(dataPtr, capacity);
         if (env->ExceptionCheck()) {
             env->ExceptionClear();
@@ -85,178 +119,44 @@ JNIEXPORT jobject JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nati
 
 /*
  * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeGetWidth
- * Signature: (J)I
- */
-JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetWidth
-    (JNIEnv *env, jobject obj, jlong nativeHandle)
-{
-    CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
-    if (frame) {
-        return frame->GetWidth();
-    }
-    return 0;
-}
-
-/*
- * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeGetHeight
- * Signature: (J)I
- */
-JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetHeight
-    (JNIEnv *env, jobject obj, jlong nativeHandle)
-{
-    CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
-    if (frame) {
-        return frame->GetHeight();
-    }
-    return 0;
-}
-
-/*
- * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeGetEncodedWidth
- * Signature: (J)I
- */
-JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetEncodedWidth
-    (JNIEnv *env, jobject obj, jlong nativeHandle)
-{
-    CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
-    if (frame) {
-        return frame->GetEncodedWidth();
-    }
-    return 0;
-}
-
-/*
- * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeGetEncodedHeight
- * Signature: (J)I
- */
-JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetEncodedHeight
-    (JNIEnv *env, jobject obj, jlong nativeHandle)
-{
-    CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
-    if (frame) {
-        return frame->GetEncodedHeight();
-    }
-    return 0;
-}
-
-/*
- * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeGetFormat
- * Signature: (J)I
+ * Method:    nativeConvertToFormat
+ * Signature: (JI)J
  */
-JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetFormat
-    (JNIEnv *env, jobject obj, jlong nativeHandle)
+JNIEXPORT jlong JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeConvertToFormat
+    (JNIEnv *env, jobject obj, jlong nativeHandle, jint newFormat)
 {
     CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
     if (frame) {
-        // CVideoFrame types now match Java VideoFormat native types, so just pass it along
-        return (jint)frame->GetType();
+        return ptr_to_jlong(frame->ConvertToFormat((CVideoFrame::FrameType)newFormat));
     }
     return 0;
 }
 
 /*
  * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeHasAlpha
- * Signature: (J)Z
+ * Method:    nativeSetDirty
+ * Signature: (J)V
  */
-JNIEXPORT jboolean JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeHasAlpha
+JNIEXPORT void JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeSetDirty
     (JNIEnv *env, jobject obj, jlong nativeHandle)
 {
     CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
     if (frame) {
-        return frame->HasAlpha();
+        frame->SetFrameDirty(true);
     }
-    return JNI_FALSE;
 }
 
 /*
  * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeGetPlaneCount
- * Signature: (J)I
+ * Method:    nativeGetNativeFrameHandle
+ * Signature: (J)J
  */
-JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetPlaneCount
+JNIEXPORT jlong JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetNativeFrameHandle
     (JNIEnv *env, jobject obj, jlong nativeHandle)
 {
     CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
     if (frame) {
-        return frame->GetPlaneCount();
+        return ptr_to_jlong(frame->GetNativeFrameHandle());
     }
     return 0;
 }
-
-/*
- * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeGetPlaneStrides
- * Signature: (J)[I
- */
-JNIEXPORT jintArray JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetPlaneStrides
-    (JNIEnv *env, jobject obj, jlong nativeHandle)
-{
-    CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
-    if (frame) {
-        jint count = (jint)frame->GetPlaneCount();
-        // Sanity check plane count, never more than four or less than 1
-        if (count > 4 || count < 1) {
-            return NULL;
-        }
-
-        jintArray strides = env->NewIntArray(count);
-        if (strides == NULL) {
-            return NULL;
-        }
-
-        jint *strideArray = new (std::nothrow) jint[count];
-        if (strideArray == NULL) {
-            return NULL;
-        }
-
-        for (unsigned int ii=0; ii < count; ii++) {
-            strideArray[ii] = frame->GetStrideForPlane(ii);
-        }
-
-        env->SetIntArrayRegion(strides, 0, count, strideArray);
-        delete [] strideArray;
-
-        if (env->ExceptionCheck()) {
-            env->ExceptionClear();
-            return NULL;
-        }
-
-        return strides;
-    }
-    return NULL;
-}
-
-/*
- * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeConvertToFormat
- * Signature: (JI)J
- */
-JNIEXPORT jlong JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeConvertToFormat
-    (JNIEnv *env, jobject obj, jlong nativeHandle, jint newFormat)
-{
-    CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
-    if (frame) {
-        return ptr_to_jlong(frame->ConvertToFormat((CVideoFrame::FrameType)newFormat));
-    }
-    return 0;
-}
-
-/*
- * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
- * Method:    nativeSetDirty
- * Signature: (J)V
- */
-JNIEXPORT void JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeSetDirty
-    (JNIEnv *env, jobject obj, jlong nativeHandle)
-{
-    CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
-    if (frame) {
-        frame->SetFrameDirty(true);
-    }
-}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,9 @@
 #define MAX_SIZE_BUFFERS_LIMIT 25
 #define MAX_SIZE_BUFFERS_INC   5
 
+// Frames shown later than this after their presentation time are counted as late
+#define LATE_FRAME_THRESHOLD   (5 * GST_MSECOND)
+
 //*************************************************************************************************
 //********** class CGstAVPlaybackPipeline
 //*************************************************************************************************
@@ -309,6 +312,40 @@ void CGstAVPlaybackPipeline::SetEncodedVideoFrameRate(float frameRate)
     m_EncodedVideoFrameRate = frameRate;
 }
 
+/**
+ * CGstAVPlaybackPipeline::IsFrameLate()
+ *
+ * Checks whether a frame reaches the sink after its presentation time. The sink
+ * waits for frames that are early, so any frame behind the clock is late.
+ *
+ * @param   pElem       Sink element that received the frame
+ * @param   pSample     Sample holding the frame and its segment
+ * @param   pBuffer     Buffer of the frame, with its original timestamp
+ */
+bool CGstAVPlaybackPipeline::IsFrameLate(GstElement* pElem, GstSample* pSample, GstBuffer* pBuffer)
+{
+    bool bLate = false;
+
+    GstSegment* pSegment = gst_sample_get_segment(pSample);
+    if (NULL == pSegment || !GST_BUFFER_TIMESTAMP_IS_VALID(pBuffer))
+        return false;
+
+    GstClockTime runningTime = gst_segment_to_running_time(pSegment, GST_FORMAT_TIME, GST_BUFFER_TIMESTAMP(pBuffer));
+    if (!GST_CLOCK_TIME_IS_VALID(runningTime))
+        return false;
+
+    GstClock* pClock = gst_element_get_clock(pElem);
+    if (NULL != pClock)
+    {
+        GstClockTime now = gst_clock_get_time(pClock);
+        GstClockTime baseTime = gst_element_get_base_time(pElem);
+        bLate = now > baseTime && now - baseTime > runningTime + LATE_FRAME_THRESHOLD;
+        gst_object_unref(pClock);
+    }
+
+    return bLate;
+}
+
 /**
  * CGstAVPlaybackPipeline::OnAppSinkHaveFrame()
  *
@@ -336,6 +373,10 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
     if (pPipeline->m_SendFrameSizeEvent || GST_BUFFER_IS_DISCONT(pBuffer))
         OnAppSinkVideoFrameDiscont(pPipeline, pSample);
 
+    pPipeline->m_Statistics.Add(CPipelineStatistics::FramesDecoded, 1);
+    if (IsFrameLate(pElem, pSample, pBuffer))
+        pPipeline->m_Statistics.Add(CPipelineStatistics::FramesLate, 1);
+
     // Update PTS in pBuffer, so first buffer starts with 0. Our rendering
     // code expects PTS between 0 and duration and will not render anything
     // beyond duration. For fragmented MP4 PTS starts with N value (usually 10
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -611,7 +611,12 @@ uint32_t CGstAudioPlaybackPipeline::SeekPipeline(gint64 seek_time)
     if (m_fRate < -1.0F || m_fRate > 1.0F)
         seekFlags = (GstSeekFlags)(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_SKIP);
     else
-        seekFlags = (GstSeekFlags)(GST_SEEK_FLAG_FLUSH);// | GST_SEEK_FLAG_KEY_UNIT);
+        seekFlags = (GstSeekFlags)(GST_SEEK_FLAG_FLUSH);
+
+    // Demuxers with a sample index (qtdemux) resolve the key frame from it,
+    // so the decoder starts at the target instead of decoding up to it.
+    if (m_pOptions->GetKeyFrameSeek())
+        seekFlags = (GstSeekFlags)(seekFlags | GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_SNAP_NEAREST);
 
     if (m_pOptions->GetPipelineType() == CPipelineOptions::kAudioSourcePipeline)
     {
@@ -998,6 +1003,30 @@ CAudioSpectrum* CGstAudioPlaybackPipeline::GetAudioSpectrum()
     return m_pAudioSpectrum;
 }
 
+/**
+ * CGstAudioPlaybackPipeline::GetStatistics()
+ *
+ * Samples the queue levels and copies the playback counters.
+ */
+uint32_t CGstAudioPlaybackPipeline::GetStatistics(int64_t* pllValues, int iCount)
+{
+    guint current_level_buffers = 0;
+
+    if (NULL != m_Elements[AUDIO_QUEUE])
+    {
+        g_object_get(m_Elements[AUDIO_QUEUE], "current-level-buffers", &current_level_buffers, NULL);
+        m_Statistics.Set(CPipelineStatistics::AudioQueueLevel, current_level_buffers);
+    }
+
+    if (NULL != m_Elements[VIDEO_QUEUE])
+    {
+        g_object_get(m_Elements[VIDEO_QUEUE], "current-level-buffers", &current_level_buffers, NULL);
+        m_Statistics.Set(CPipelineStatistics::VideoQueueLevel, current_level_buffers);
+    }
+
+    return CPipeline::GetStatistics(pllValues, iCount);
+}
+
 bool CGstAudioPlaybackPipeline::IsCodecSupported(GstCaps *pCaps)
 {
 #if TARGET_OS_WIN32
@@ -1563,6 +1592,20 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
             gst_bin_recalculate_latency (GST_BIN(pPipeline->m_Elements[PIPELINE]));
             break;
 
+        case GST_MESSAGE_QOS:
+            // The video sink reports how many frames it has dropped so far
+            if (GST_MESSAGE_SRC(msg) == GST_OBJECT(pPipeline->m_Elements[VIDEO_SINK]))
+            {
+                GstFormat format;
+                guint64 processed = 0;
+                guint64 dropped = 0;
+
+                gst_message_parse_qos_stats(msg, &format, &processed, &dropped);
+                if (format == GST_FORMAT_BUFFERS && dropped != (guint64)-1)
+                    pPipeline->m_Statistics.Set(CPipelineStatistics::FramesDropped, (int64_t)dropped);
+            }
+            break;
+
         default:
             break;
     }
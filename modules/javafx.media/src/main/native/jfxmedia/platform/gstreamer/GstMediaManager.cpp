@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -195,9 +195,50 @@ uint32_t CGstMediaManager::Init()
     // Set the default Glib log handler.
     g_log_set_default_handler (GlibLogFunc, this);
 
+    //***** Warm up the element classes in the background
+    GThread *pPrewarmThread = g_thread_try_new("Prewarm", (GThreadFunc)prewarm, NULL, NULL);
+    if (NULL != pPrewarmThread)
+        g_thread_unref(pPrewarmThread);
+
     return uRetCode;
 }
 
+/**
+ * CGstMediaManager::prewarm().  Creates and releases one instance of each element
+ * the player pipelines are built from. This runs the class initialization, which
+ * for the decoders and demuxers includes registering the codec libraries, ahead of
+ * the first player so that its startup does not pay for it.
+ *
+ * @param   data    unused.
+ * @return  NULL.
+ */
+gpointer CGstMediaManager::prewarm(gpointer data)
+{
+    static const gchar* const elements[] = {
+        "javasource", "progressbuffer", "queue", "volume", "audiopanorama", "spectrum",
+        "equalizer-nbands", "appsink",
+#if TARGET_OS_WIN32
+        "dshowwrapper", "directsoundsink",
+#elif TARGET_OS_MAC
+        "qtdemux", "avaudiodecoder", "avvideodecoder", "osxaudiosink",
+#elif TARGET_OS_LINUX
+        "qtdemux", "avaudiodecoder", "avvideodecoder", "avmpegtsdemuxer", "alsasink",
+#endif
+        NULL
+    };
+
+    LOWLEVELPERF_EXECTIMESTART("prewarm()");
+    for (int i = 0; NULL != elements[i]; i++)
+    {
+        GstElement *element = gst_element_factory_make(elements[i], NULL);
+        if (NULL != element)
+            gst_object_unref(element);
+    }
+    LOWLEVELPERF_EXECTIMESTOP("prewarm()");
+
+    return NULL;
+}
+
 void CGstMediaManager::StartMainLoop()
 {
     if (m_bStartMainLoop)
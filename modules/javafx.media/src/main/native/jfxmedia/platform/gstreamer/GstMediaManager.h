@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,6 +49,7 @@ private:
                                 const gchar* message, gpointer user_data);
 
     static gpointer run_loop(CGstMediaManager* manager);
+    static gpointer prewarm(gpointer data);
 
     bool          m_bMainLoopCreateFailed;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -545,6 +545,42 @@ JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMed
     return iRet;
 }
 
+/**
+ * gstGetStatistics()
+ *
+ * Makes a synchronous call to get the playback counters of the media.
+ */
+JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMediaPlayer_gstGetStatistics
+(JNIEnv *env, jobject obj, jlong ref_media, jlongArray jrglStatistics)
+{
+    CMedia* pMedia = (CMedia*)jlong_to_ptr(ref_media);
+    if (NULL == pMedia)
+        return ERROR_MEDIA_NULL;
+
+    CPipeline* pPipeline = (CPipeline*)pMedia->GetPipeline();
+    if (NULL == pPipeline)
+        return ERROR_PIPELINE_NULL;
+
+    int64_t rgllStatistics[CPipelineStatistics::Count];
+    uint32_t uErrCode = pPipeline->GetStatistics(rgllStatistics, CPipelineStatistics::Count);
+    if (ERROR_NONE != uErrCode)
+        return uErrCode;
+
+    jlong jrglValues[CPipelineStatistics::Count];
+    jsize count = env->GetArrayLength(jrglStatistics);
+    if (count > CPipelineStatistics::Count)
+        count = CPipelineStatistics::Count;
+    for (jsize i = 0; i < count; i++)
+        jrglValues[i] = (jlong)rgllStatistics[i];
+    env->SetLongArrayRegion(jrglStatistics, 0, count, jrglValues);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return ERROR_JNI_UNEXPECTED;
+    }
+
+    return ERROR_NONE;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,13 @@
 #define HLS_VALUE_MIMETYPE_FMP4 3
 #define HLS_VALUE_MIMETYPE_AAC  4
 
+// Audio sink ring buffer size and segment size in low latency mode, in microseconds
+#define LOW_LATENCY_BUFFER_TIME  40000
+#define LOW_LATENCY_LATENCY_TIME 10000
+
+// Video frames later than this are dropped by the video sink, in nanoseconds
+#define VIDEO_SINK_MAX_LATENESS  (20 * GST_MSECOND)
+
 
 //*************************************************************************************************
 //********** class CGstPipelineFactory
@@ -136,6 +143,11 @@ uint32_t CGstPipelineFactory::CreatePlayerPipeline(CLocator* locator, CPipelineO
     if (NULL == *ppPipeline)
         return ERROR_PIPELINE_CREATION;
 
+    // Account the time spent reading the media to the new pipeline
+    callbacks->SetStatistics((*ppPipeline)->GetPipelineStatistics());
+    if (audioCallbacks != NULL)
+        audioCallbacks->SetStatistics((*ppPipeline)->GetPipelineStatistics());
+
     LOWLEVELPERF_EXECTIMESTOP("CGstPipelineFactory::CreatePlayerPipeline()");
 
     return uRetCode;
@@ -306,12 +318,22 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
 
 gint CGstPipelineFactory::SourceReadNextBlock(GstElement *src, gpointer data)
 {
-    return ((CStreamCallbacks*)data)->ReadNextBlock();
+    CStreamCallbacks* callbacks = (CStreamCallbacks*)data;
+    gint64 llStart = g_get_monotonic_time();
+    gint result = callbacks->ReadNextBlock();
+    if (NULL != callbacks->GetStatistics())
+        callbacks->GetStatistics()->AddRead(g_get_monotonic_time() - llStart);
+    return result;
 }
 
 gint CGstPipelineFactory::SourceReadBlock(GstElement *src, guint64 position, guint size, gpointer data)
 {
-    return ((CStreamCallbacks*)data)->ReadBlock(position, size);
+    CStreamCallbacks* callbacks = (CStreamCallbacks*)data;
+    gint64 llStart = g_get_monotonic_time();
+    gint result = callbacks->ReadBlock(position, size);
+    if (NULL != callbacks->GetStatistics())
+        callbacks->GetStatistics()->AddRead(g_get_monotonic_time() - llStart);
+    return result;
 }
 
 void CGstPipelineFactory::SourceCopyBlock(GstElement *src, gpointer buffer, int size, gpointer data)
@@ -361,6 +383,31 @@ GstElement* CGstPipelineFactory::CreateAudioSinkElement()
 #endif
 }
 
+/**
+    * void ConfigureAudioSink(GstElementContainer* pElements, CPipelineOptions* pOptions)
+    *
+    * Applies the audio output options to the audio sink, if there is one.
+    * In low latency mode the sink ring buffer holds LOW_LATENCY_BUFFER_TIME
+    * instead of the 200 ms default of GstAudioBaseSink.
+    *
+    * @param   pElements   The pipeline elements.
+    * @param   pOptions    The pipeline options.
+    */
+void CGstPipelineFactory::ConfigureAudioSink(GstElementContainer* pElements, CPipelineOptions* pOptions)
+{
+    GstElement *audiosink = (*pElements)[AUDIO_SINK];
+    if (!pOptions->GetLowLatencyAudio() || NULL == audiosink)
+        return;
+
+    GObjectClass *klass = G_OBJECT_GET_CLASS(audiosink);
+    if (NULL != g_object_class_find_property(klass, "buffer-time") &&
+        NULL != g_object_class_find_property(klass, "latency-time"))
+    {
+        g_object_set(audiosink, "buffer-time", (gint64)LOW_LATENCY_BUFFER_TIME,
+                                "latency-time", (gint64)LOW_LATENCY_LATENCY_TIME, NULL);
+    }
+}
+
 void CGstPipelineFactory::OnBufferPadAdded(GstElement* element, GstPad* pad, GstElement* peer)
 {
     uint32_t uErrorCode = ERROR_NONE;
@@ -695,6 +742,8 @@ uint32_t CGstPipelineFactory::CreateAudioPipeline(bool bConvertFormat, CPipeline
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
+    ConfigureAudioSink(pElements, pOptions);
+
     uRetCode = AttachToSource(GST_BIN (pipeline), source, NULL, audiobin);
     if (ERROR_NONE != uRetCode)
         return uRetCode;
@@ -783,6 +832,8 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
+    ConfigureAudioSink(pElements, pOptions);
+
     // Attach audio bin to audio source if we have one
     if (bAudioStream && audioDemuxer == NULL)
     {
@@ -811,6 +862,13 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
+    GstElement *videodec = (*pElements)[VIDEO_DECODER];
+    if (pOptions->GetDecoderThreads() > 0 && NULL != videodec &&
+        NULL != g_object_class_find_property(G_OBJECT_GET_CLASS(videodec), "thread-count"))
+    {
+        g_object_set(videodec, "thread-count", (gint)pOptions->GetDecoderThreads(), NULL);
+    }
+
     pElements->add(PIPELINE, pipeline);
     pElements->add(AV_DEMUXER, demuxer);
     if (audioDemuxer != NULL)
@@ -1043,7 +1101,9 @@ uint32_t CGstPipelineFactory::CreateVideoBin(const char* strDecoderName, GstElem
 
     // Switch off limiting of the videoqueue for bytes and buffers.
     g_object_set(videoqueue, "max-size-bytes", (guint)0, "max-size-buffers", (guint)10, "max-size-time", (guint64)0, NULL);
-    g_object_set(pVideoSink, "qos", TRUE, NULL);
+    // appsink does not drop late buffers by default. Use the GstVideoSink default
+    // so that frames the renderer can no longer show in time are not delivered.
+    g_object_set(pVideoSink, "qos", TRUE, "max-lateness", (gint64)VIDEO_SINK_MAX_LATENESS, NULL);
 
     return ERROR_NONE;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,10 +68,13 @@ extern "C" {
      *
      * Initializes the native engine.
      *
+     * @param decoderThreads Maximum number of threads per video decoder, 0 for default.
+     * @param lowLatencyAudio Whether audio sinks should use a small buffer.
+     * @param keyFrameSeek Whether seeks snap to the nearest key frame.
      * @return Zero on success, non-zero error code on failure.
      */
     JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTPlatform_gstInitPlatform
-    (JNIEnv *env, jclass klass)
+    (JNIEnv *env, jclass klass, jint decoderThreads, jboolean lowLatencyAudio, jboolean keyFrameSeek)
     {
         LOWLEVELPERF_EXECTIMESTART("gstInitPlatform()");
         LOWLEVELPERF_EXECTIMESTART("gstInitPlatformToVideoPreroll");
@@ -97,6 +100,9 @@ extern "C" {
             return ERROR_MEMORY_ALLOCATION;
 
         pManager->SetWarningListener(pWarningListener);
+        pManager->SetDecoderThreads(decoderThreads);
+        pManager->SetLowLatencyAudio(lowLatencyAudio == JNI_TRUE);
+        pManager->SetKeyFrameSeek(keyFrameSeek == JNI_TRUE);
 
         LOWLEVELPERF_EXECTIMESTOP("gstInitPlatform()");
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,36 +41,91 @@ static inline guint32 swap_uint32(guint32 x)
         ((x & 0xff000000U) >> 24);
 }
 
-static void free_aligned_buffer(gpointer ptr)
+// Converted frames are recycled through a small set of buffer pools keyed
+// on the output size, so that a playing video does not allocate and free a
+// full RGB frame for every picture. A buffer goes back to its pool as soon as
+// the last reference to it is dropped, which happens when the Java side
+// disposes of the NativeVideoBuffer holding the converted frame.
+#define FRAME_POOL_COUNT 4
+
+static GstBufferPool *frame_pools[FRAME_POOL_COUNT];
+static guint frame_pool_sizes[FRAME_POOL_COUNT];
+static guint frame_pool_next = 0;
+static GMutex frame_pool_lock;
+
+static GstBufferPool *create_frame_pool(guint size)
+{
+    GstBufferPool *pool = gst_buffer_pool_new();
+    GstStructure *config = gst_buffer_pool_get_config(pool);
+    GstAllocationParams params;
+
+    // 16 byte alignment is required by the SIMD color converters
+    gst_allocation_params_init(&params);
+    params.align = 15;
+
+    gst_buffer_pool_config_set_params(config, NULL, size, 0, 0);
+    gst_buffer_pool_config_set_allocator(config, NULL, &params);
+    if (!gst_buffer_pool_set_config(pool, config) ||
+        !gst_buffer_pool_set_active(pool, TRUE)) {
+        gst_object_unref(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+static GstBufferPool *get_frame_pool(guint size)
 {
-    if (ptr != NULL) {
-        g_free(ptr);
+    GstBufferPool *pool = NULL;
+    int ii;
+
+    for (ii = 0; ii < FRAME_POOL_COUNT; ii++) {
+        if (frame_pools[ii] != NULL && frame_pool_sizes[ii] == size) {
+            return (GstBufferPool*)gst_object_ref(frame_pools[ii]);
+        }
     }
+
+    pool = create_frame_pool(size);
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    // Replace the oldest pool. Buffers still in use keep a reference to it
+    // and are freed instead of recycled once they are released.
+    if (frame_pools[frame_pool_next] != NULL) {
+        gst_buffer_pool_set_active(frame_pools[frame_pool_next], FALSE);
+        gst_object_unref(frame_pools[frame_pool_next]);
+    }
+    frame_pools[frame_pool_next] = (GstBufferPool*)gst_object_ref(pool);
+    frame_pool_sizes[frame_pool_next] = size;
+    frame_pool_next = (frame_pool_next + 1) % FRAME_POOL_COUNT;
+
+    return pool;
 }
 
 static GstBuffer *alloc_aligned_buffer(guint size)
 {
-    // allocate a new GstBuffer of the given size plus some for padding and alignment
-    guint8 *newData;
-    guint8 *alignedData;
-    guint alignedSize;
-
-    // allocate a buffer large enough to accommodate 16 byte alignment
-    alignedSize = size;
-    if (size <= (G_MAXUINT - 16)) {
-        size += 16;
-    } else {
+    GstBufferPool *pool;
+    GstBuffer *buffer = NULL;
+
+    if (size == 0 || size > (G_MAXUINT - 16)) {
         return NULL;
     }
 
-    newData = (guint8*)g_try_malloc(size);
-    if (NULL == newData) {
+    g_mutex_lock(&frame_pool_lock);
+    pool = get_frame_pool(size);
+    g_mutex_unlock(&frame_pool_lock);
+
+    if (pool == NULL) {
         return NULL;
     }
 
-    alignedData = (guint8*)(((intptr_t)newData + 15) & ~15);
+    if (gst_buffer_pool_acquire_buffer(pool, &buffer, NULL) != GST_FLOW_OK) {
+        buffer = NULL;
+    }
+    gst_object_unref(pool);
 
-    return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, alignedSize, 0, alignedSize, newData, free_aligned_buffer);
+    return buffer;
 }
 
 GstCaps *create_RGB_caps(CVideoFrame::FrameType type, guint width, guint height, guint encodedWidth, guint encodedHeight, guint stride)
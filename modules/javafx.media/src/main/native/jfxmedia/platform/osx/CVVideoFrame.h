@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 #import <Foundation/Foundation.h>
 #import <CoreVideo/CoreVideo.h>
+#include <pthread.h>
 
 #import "PipelineManagement/VideoFrame.h"
 
@@ -39,11 +40,19 @@ public:
 
     virtual CVideoFrame *ConvertToFormat(FrameType type);
 
+    virtual void *GetNativeFrameHandle() { return m_pixelBuffer; }
+
+    // Locks the pixel buffer on first use, frames rendered from their IOSurface never lock it
+    virtual void *GetDataForPlane(unsigned int planeIndex);
+
 private:
     bool m_bDisposePixelBuffer;
+    bool m_bBaseAddressLocked;
+    pthread_mutex_t m_lockMutex;
     CVPixelBufferRef m_pixelBuffer;
     uint64_t m_frameHostTime;
 
     void PrepareChunky();
     void PreparePlanar();
+    bool LockBaseAddress();
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,8 +42,11 @@ bool CVVideoFrame::IsFormatSupported(OSType format) {
 CVVideoFrame::CVVideoFrame(CVPixelBufferRef pixelBuffer, double frameTime, uint64_t frameHostTime)
 :
   m_bDisposePixelBuffer(false),
+  m_bBaseAddressLocked(false),
   m_pixelBuffer(pixelBuffer)
 {
+    pthread_mutex_init(&m_lockMutex, NULL);
+
     // We can assume that buf is retained at least for the duration of this ctor
     // So postpone retaining it until we're absolutely sure we'll use it
 
@@ -113,6 +116,7 @@ CVVideoFrame::CVVideoFrame(CVPixelBufferRef pixelBuffer, double frameTime, uint6
 CVVideoFrame::~CVVideoFrame()
 {
     Dispose();
+    pthread_mutex_destroy(&m_lockMutex);
 }
 
 void CVVideoFrame::PrepareChunky()
@@ -122,14 +126,7 @@ void CVVideoFrame::PrepareChunky()
     m_uiHeight = (unsigned int)CVPixelBufferGetHeight(m_pixelBuffer);
     m_bHasAlpha = (m_typeFrame == BGRA_PRE);
 
-    // We MUST lock the base address during the lifetime of this object
-    // or else we could cause a crash
-    CVReturn cr = CVPixelBufferLockBaseAddress(m_pixelBuffer, kCVPixelBufferLock_ReadOnly);
-    if (kCVReturnSuccess != cr) {
-        throw "CVVideoFrame: Unable to lock PixelBuffer base address";
-    }
-
-    m_pvPlaneData[0] = CVPixelBufferGetBaseAddress(m_pixelBuffer);
+    // Plane data is filled in by LockBaseAddress()
     m_puiPlaneStrides[0] = (int)CVPixelBufferGetBytesPerRow(m_pixelBuffer);
 
     bool bValid = true; // CalcSize() requires bValid to be true when called
@@ -144,13 +141,7 @@ void CVVideoFrame::PreparePlanar()
     SetPlaneCount((unsigned int)CVPixelBufferGetPlaneCount(m_pixelBuffer));
     m_bHasAlpha = false;
 
-    // We MUST lock the base address during the lifetime of this object
-    // or else we could cause a crash
-    CVReturn cr = CVPixelBufferLockBaseAddress(m_pixelBuffer, kCVPixelBufferLock_ReadOnly);
-    if (kCVReturnSuccess != cr) {
-        throw "CVVideoFrame: Unable to lock PixelBuffer base address";
-    }
-
+    // Plane data is filled in by LockBaseAddress()
     bool bValid = true; // CalcSize() requires bValid to be true when called
     for (int index = 0; index < GetPlaneCount(); index++) {
         m_puiPlaneStrides[index] = (unsigned int)CVPixelBufferGetBytesPerRowOfPlane(m_pixelBuffer, index);
@@ -159,7 +150,6 @@ void CVVideoFrame::PreparePlanar()
         if (!bValid) {
             throw "CVVideoFrame: Invalid frame size";
         }
-        m_pvPlaneData[index] = CVPixelBufferGetBaseAddressOfPlane(m_pixelBuffer, index);
     }
 
     if (m_typeFrame == YCbCr_420p) {
@@ -168,10 +158,45 @@ void CVVideoFrame::PreparePlanar()
     }
 }
 
+bool CVVideoFrame::LockBaseAddress()
+{
+    pthread_mutex_lock(&m_lockMutex);
+    if (!m_bBaseAddressLocked && m_pixelBuffer) {
+        // The base address MUST stay locked while the plane data is in use
+        // or else we could cause a crash
+        if (kCVReturnSuccess == CVPixelBufferLockBaseAddress(m_pixelBuffer, kCVPixelBufferLock_ReadOnly)) {
+            m_bBaseAddressLocked = true;
+            if (CVPixelBufferIsPlanar(m_pixelBuffer)) {
+                for (unsigned int index = 0; index < GetPlaneCount(); index++) {
+                    // Cb/Cr planes were swapped by PreparePlanar()
+                    size_t cvIndex = (m_typeFrame == YCbCr_420p && index > 0) ? 3 - index : index;
+                    m_pvPlaneData[index] = CVPixelBufferGetBaseAddressOfPlane(m_pixelBuffer, cvIndex);
+                }
+            } else {
+                m_pvPlaneData[0] = CVPixelBufferGetBaseAddress(m_pixelBuffer);
+            }
+        }
+    }
+    bool locked = m_bBaseAddressLocked;
+    pthread_mutex_unlock(&m_lockMutex);
+    return locked;
+}
+
+void *CVVideoFrame::GetDataForPlane(unsigned int planeIndex)
+{
+    if (!LockBaseAddress()) {
+        return NULL;
+    }
+    return CVideoFrame::GetDataForPlane(planeIndex);
+}
+
 void CVVideoFrame::Dispose()
 {
     if (m_bDisposePixelBuffer) {
-        CVPixelBufferUnlockBaseAddress(m_pixelBuffer, kCVPixelBufferLock_ReadOnly);
+        if (m_bBaseAddressLocked) {
+            CVPixelBufferUnlockBaseAddress(m_pixelBuffer, kCVPixelBufferLock_ReadOnly);
+            m_bBaseAddressLocked = false;
+        }
         CVPixelBufferRelease(m_pixelBuffer);
         m_pixelBuffer = NULL;
         m_bDisposePixelBuffer = false;
@@ -180,7 +205,7 @@ void CVVideoFrame::Dispose()
 
 CVideoFrame *CVVideoFrame::ConvertToFormat(FrameType type)
 {
-    if (YCbCr_422 == m_typeFrame && BGRA_PRE == type) {
+    if (YCbCr_422 == m_typeFrame && BGRA_PRE == type && LockBaseAddress()) {
         CVPixelBufferRef destPixelBuffer = NULL;
         if (kCVReturnSuccess == CVPixelBufferCreate(NULL, m_uiEncodedWidth, m_uiEncodedHeight,
                                                    k32BGRAPixelFormat, NULL, &destPixelBuffer)) {
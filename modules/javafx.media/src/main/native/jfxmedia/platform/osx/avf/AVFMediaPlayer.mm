@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -58,9 +58,12 @@ static void *AVFMediaPlayerItemTracksContext = &AVFMediaPlayerItemTracksContext;
 // is in the list of prefered formats.
 // Uncomment to force list of supported formats by JavaFX.
 // Note: This array should match CVVideoFrame::IsFormatSupported().
+// Metal compatible (IOSurface backed) buffers let the Metal pipeline use the
+// frames as textures without copying them, see MetalTexture.m.
 #define VO_FORMATS @{(id)kCVPixelBufferPixelFormatTypeKey: @[@(kCVPixelFormatType_422YpCbCr8),\
                                                            @(kCVPixelFormatType_420YpCbCr8Planar),\
-                                                           @(kCVPixelFormatType_32BGRA)]}
+                                                           @(kCVPixelFormatType_32BGRA)],\
+                     (id)kCVPixelBufferMetalCompatibilityKey: @YES}
 // Uncomment to let AVFoundation decide the format...
 //#define VO_FORMATS @{}
 
@@ -253,7 +256,8 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
         LOGGER_DEBUGMSG(([[NSString stringWithFormat:@"Falling back on video format: %@", FourCCToNSString(FALLBACK_VO_FORMAT)] UTF8String]));
         AVPlayerItemVideoOutput *newOutput =
         [[AVPlayerItemVideoOutput alloc] initWithPixelBufferAttributes:
-         @{(id)kCVPixelBufferPixelFormatTypeKey: @(FALLBACK_VO_FORMAT)}];
+         @{(id)kCVPixelBufferPixelFormatTypeKey: @(FALLBACK_VO_FORMAT),
+           (id)kCVPixelBufferMetalCompatibilityKey: @YES}];
 
         if (newOutput) {
             newOutput.suppressesPlayerRendering = YES;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -193,6 +193,10 @@ public class JFXPanel extends JComponent {
     @SuppressWarnings("doclint:missing")
     private BufferedImage pixelsIm;
 
+    // Wraps the pixelsIm data, accessed on EDT only
+    @SuppressWarnings("doclint:missing")
+    private IntBuffer pixelsBuf;
+
     @SuppressWarnings("doclint:missing")
     private volatile float opacity = 1.0f;
 
@@ -795,6 +799,7 @@ public class JFXPanel extends JComponent {
         var hScenePeer = fx_scenePeer;
         if (hScenePeer == null || pWidth <= 0 || pHeight <= 0) {
             pixelsIm = null;
+            pixelsBuf = null;
         } else {
             BufferedImage oldIm = pixelsIm;
             int newPixelW = (int) Math.ceil(pWidth * newScaleFactorX);
@@ -816,6 +821,8 @@ public class JFXPanel extends JComponent {
                     g.dispose();
                 }
             }
+            DataBufferInt dataBuf = (DataBufferInt)pixelsIm.getRaster().getDataBuffer();
+            pixelsBuf = IntBuffer.wrap(dataBuf.getData());
         }
     }
 
@@ -877,10 +884,9 @@ public class JFXPanel extends JComponent {
                 return;
             }
         }
-        DataBufferInt dataBuf = (DataBufferInt)pixelsIm.getRaster().getDataBuffer();
-        int[] pixelsData = dataBuf.getData();
-        IntBuffer buf = IntBuffer.wrap(pixelsData);
-        if (!hScenePeer.getPixels(buf, pWidth, pHeight)) {
+        // The same buffer is passed on every paint, so the scene can skip
+        // the copy when it has not rendered a new frame since the last one.
+        if (!hScenePeer.getPixels(pixelsBuf, pWidth, pHeight)) {
             // In this case we just render what we have so far in the buffer.
         }
 
@@ -1045,6 +1051,7 @@ public class JFXPanel extends JComponent {
         });
 
         pixelsIm = null;
+        pixelsBuf = null;
         pWidth = 0;
         pHeight = 0;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,9 @@ import com.sun.prism.Graphics;
 import com.sun.webkit.WebPage;
 import com.sun.webkit.graphics.WCGraphicsContext;
 import com.sun.webkit.graphics.WCGraphicsManager;
+import com.sun.webkit.graphics.WCRenderQueue;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.atomic.AtomicReference;
 import javafx.scene.Node;
 
 public final class Printable extends AbstractNode {
@@ -60,11 +63,28 @@ public final class Printable extends AbstractNode {
     private final NGNode peer;
 
     public Printable(WebPage page, int pageIndex, float width) {
+        this(page, pageIndex, width, null);
+    }
+
+    /*
+     * Creates a printable for a page already recorded by
+     * WebPage.recordPrintPage(). The recording is played back on the
+     * first renderContent() call; further calls re-spool the page.
+     */
+    public Printable(WebPage page, int pageIndex, float width,
+            CompletableFuture<WCRenderQueue> recorded) {
         this.page = page;
-        peer = new Peer(pageIndex, width);
+        peer = new Peer(pageIndex, width, recorded);
         PrintableHelper.initHelper(this);
     }
 
+    /*
+     * Releases the recorded page if it has not been printed.
+     */
+    public void discard() {
+        ((Peer) peer).discard();
+    }
+
     private NGNode doCreatePeer() {
         return peer;
     }
@@ -86,16 +106,30 @@ public final class Printable extends AbstractNode {
     private final class Peer extends NGNode {
         private final int pageIndex;
         private final float width;
+        private final AtomicReference<CompletableFuture<WCRenderQueue>> recorded;
 
-        Peer(int pageIndex, float width) {
+        Peer(int pageIndex, float width, CompletableFuture<WCRenderQueue> recorded) {
             this.pageIndex = pageIndex;
             this.width = width;
+            this.recorded = new AtomicReference<>(recorded);
+        }
+
+        void discard() {
+            CompletableFuture<WCRenderQueue> f = recorded.getAndSet(null);
+            if (f != null) {
+                WebPage.disposePrintPage(f);
+            }
         }
 
         @Override protected void renderContent(Graphics g) {
             WCGraphicsContext gc = WCGraphicsManager.getGraphicsManager().
                     createGraphicsContext(g);
-            page.print(gc, pageIndex, width);
+            CompletableFuture<WCRenderQueue> f = recorded.getAndSet(null);
+            if (f != null) {
+                page.print(gc, f);
+            } else {
+                page.print(gc, pageIndex, width);
+            }
         }
 
         @Override protected boolean hasOverlappingContents() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -122,6 +122,22 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         return new RTImage(w, h, highestPixelScale);
     }
 
+    @Override
+    public WCImage renderToImage(WCRenderQueue rq, int w, int h) {
+        // The image is not scaled so its pixel buffer has exactly w x h pixels
+        RTImage image = new RTImage(w, h, 1f);
+        PrismInvoker.runOnRenderThread(() -> {
+            WCGraphicsContext gc = new WCBufferedContext(image);
+            try {
+                rq.decode(gc);
+                gc.flush();
+            } finally {
+                gc.dispose();
+            }
+        });
+        return image;
+    }
+
     @Override public WCImage getIconImage(String iconURL) {
         return null;
     }
@@ -143,6 +159,18 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         };
     }
 
+    @Override
+    protected WCGradient createLinearGradient(WCPoint p1, WCPoint p2) {
+        return new WCLinearGradient(p1, p2);
+    }
+
+    @Override
+    protected WCGradient createRadialGradient(WCPoint p1, float r1,
+                                              WCPoint p2, float r2)
+    {
+        return new WCRadialGradient(p1, r1, p2, r2);
+    }
+
     @Override
     protected WCTransform createTransform(double m00, double m10, double m01,
             double m11, double m02, double m12)
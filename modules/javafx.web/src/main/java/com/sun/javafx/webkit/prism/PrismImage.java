@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,6 +54,9 @@ abstract class PrismImage extends WCImage {
             int srcx1, int srcy1, int srcx2, int srcy2);
     abstract void dispose();
 
+    // Called on the render thread before a context draws into the image
+    void prepareForRendering() {}
+
     @Override
     public Object getPlatformImage() {
        return getImage();
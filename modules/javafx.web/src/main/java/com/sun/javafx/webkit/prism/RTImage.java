@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,11 +51,23 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
     private final int width, height;
     private WeakReference<ResourceFactory> registeredWithFactory = null;
     private ByteBuffer pixelBuffer;
+    // Set when the texture has been updated behind [pixelBuffer]'s back
+    private boolean pixelBufferStale;
     private float pixelScale;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(RTImage.class.getName());
 
+    // When set, [pixelBuffer] is the backing store shared with native code:
+    // putImageData writes stay there and are uploaded to the texture once,
+    // right before it is next drawn into or from, through a retained texture.
+    private static final boolean MAPPED_PIXELS =
+        Boolean.valueOf(System.getProperty("com.sun.webkit.mappedCanvasPixels", "false"));
+
+    // Written on the event thread, consumed on the render thread
+    private volatile boolean uploadPending;
+    private Texture uploadTexture;
+
     RTImage(int w, int h, float pixelScale) {
         if (Float.isNaN(pixelScale) || pixelScale <= 0 ||
                 Math.ceil(pixelScale) >= Integer.MAX_VALUE) {
@@ -90,6 +102,11 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
 
     @Override
     Graphics getGraphics() {
+        uploadPendingPixels();
+        return createGraphics();
+    }
+
+    private Graphics createGraphics() {
         RTTexture texture = getTexture();
         if (texture == null) {
             return null;
@@ -134,6 +151,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
             int dstx1, int dsty1, int dstx2, int dsty2,
             int srcx1, int srcy1, int srcx2, int srcy2)
     {
+        uploadPendingPixels();
         if (txt == null && g.getCompositeMode() == CompositeMode.SRC_OVER) {
             return;
         }
@@ -180,9 +198,15 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                 txt.dispose();
                 txt = null;
             }
+            disposeUploadTexture();
         });
     }
 
+    @Override
+    void prepareForRendering() {
+        uploadPendingPixels();
+    }
+
     @Override
     public int getWidth() {
         return width;
@@ -203,13 +227,14 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                 isNew = true;
             }
         }
-        if (isNew || isDirty()) {
+        if (isNew || pixelBufferStale || isDirty()) {
             PrismInvoker.runOnRenderThread(() -> {
                 final ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
                 if (f == null || f.isDisposed()) {
                     log.fine("RTImage::getPixelBuffer : skip because device disposed or not ready");
                     return;
                 }
+                uploadPendingPixels();
                 flushRQ();
                 if (txt != null && pixelBuffer != null) {
                     PixelFormat pf = txt.getPixelFormat();
@@ -239,35 +264,134 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                     if (t != txt) {
                         t.dispose();
                     }
+                    pixelBufferStale = false;
                 }
             });
         }
         return pixelBuffer;
     }
 
-    // This method is called from native [ImageBufferData::update]
-    // while lazy painting procedure
+    // This method is called from native [ImageBufferJavaBackend] to read
+    // back a small region without copying the whole texture
     @Override
-    protected void drawPixelBuffer() {
-        PrismInvoker.invokeOnRenderThread(new Runnable() {
-            @Override
-            public void run() {
-                //[g] field can be null if it is the first paint
-                //from synthetic ImageData or if the resource factory is disposed
-                Graphics g = getGraphics();
-                if (g != null && pixelBuffer != null) {
-                    pixelBuffer.rewind();//critical!
-                    Image img = Image.fromByteBgraPreData(
-                            pixelBuffer,
-                            width,
-                            height);
-                    Texture txt = g.getResourceFactory().createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                    g.clear();
-                    g.drawTexture(txt, 0, 0, width, height);
-                    txt.dispose();
+    public boolean readPixels(ByteBuffer pixels, int x, int y, int w, int h) {
+        if (pixelBuffer != null && !pixelBufferStale && !isDirty()) {
+            // The cached copy of the whole image is up to date
+            return false;
+        }
+        if (x < 0 || y < 0 || w <= 0 || h <= 0
+                || x > width - w || y > height - h
+                || pixels.capacity() < w * h * 4) {
+            return false;
+        }
+        final boolean[] result = new boolean[1];
+        PrismInvoker.runOnRenderThread(() -> {
+            final ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
+            if (f == null || f.isDisposed()) {
+                log.fine("RTImage::readPixels : skip because device disposed or not ready");
+                return;
+            }
+            uploadPendingPixels();
+            flushRQ();
+            if (pixelBuffer != null) {
+                pixelBufferStale = true;
+            }
+            pixels.order(ByteOrder.nativeOrder());
+            pixels.rewind();
+            if (txt == null) {
+                // Nothing has been drawn yet
+                for (int i = 0; i < w * h * 4; i++) {
+                    pixels.put(i, (byte) 0);
                 }
+                result[0] = true;
+                return;
+            }
+
+            RTTexture t = f.createRTTexture(w, h, Texture.WrapMode.CLAMP_NOT_NEEDED);
+            if (t == null) {
+                return;
+            }
+            Graphics g = t.createGraphics();
+            g.setCompositeMode(CompositeMode.SRC);
+            g.drawTexture(txt, 0, 0, w, h,
+                    x * pixelScale, y * pixelScale,
+                    (x + w) * pixelScale, (y + h) * pixelScale);
+            int[] data = t.getPixels();
+            if (data != null) {
+                pixels.asIntBuffer().put(data, 0, w * h);
+                result[0] = true;
+            } else {
+                result[0] = t.readPixels(pixels);
             }
+            t.dispose();
         });
+        return result[0];
+    }
+
+    // This method is called from native [ImageBufferJavaBackend::update]
+    // after the pixels have been written to [pixelBuffer]
+    @Override
+    protected void drawPixelBuffer() {
+        if (MAPPED_PIXELS) {
+            uploadPending = true;
+            return;
+        }
+        PrismInvoker.invokeOnRenderThread(() -> uploadPixelBuffer());
+    }
+
+    // should be called on render thread
+    private void uploadPendingPixels() {
+        if (uploadPending) {
+            uploadPending = false;
+            uploadPixelBuffer();
+        }
+    }
+
+    private void uploadPixelBuffer() {
+        //[g] field can be null if it is the first paint
+        //from synthetic ImageData or if the resource factory is disposed
+        Graphics g = createGraphics();
+        if (g == null || pixelBuffer == null) {
+            return;
+        }
+        pixelBuffer.rewind();//critical!
+        Image img = Image.fromByteBgraPreData(pixelBuffer, width, height);
+        ResourceFactory f = g.getResourceFactory();
+        Texture t;
+        if (MAPPED_PIXELS) {
+            if (uploadTexture != null) {
+                uploadTexture.lock();
+                if (uploadTexture.isSurfaceLost()) {
+                    disposeUploadTexture();
+                } else {
+                    uploadTexture.update(img);
+                }
+            }
+            if (uploadTexture == null) {
+                uploadTexture = f.createTexture(img, Texture.Usage.DYNAMIC, Texture.WrapMode.CLAMP_NOT_NEEDED);
+                if (uploadTexture == null) {
+                    return;
+                }
+                uploadTexture.contentsUseful();
+            }
+            t = uploadTexture;
+        } else {
+            t = f.createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
+        }
+        g.clear();
+        g.drawTexture(t, 0, 0, width, height);
+        if (t == uploadTexture) {
+            t.unlock();
+        } else {
+            t.dispose();
+        }
+    }
+
+    private void disposeUploadTexture() {
+        if (uploadTexture != null) {
+            uploadTexture.dispose();
+            uploadTexture = null;
+        }
     }
 
     @Override public void factoryReset() {
@@ -275,6 +399,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
             txt.dispose();
             txt = null;
         }
+        disposeUploadTexture();
     }
 
     @Override public void factoryReleased() {
@@ -282,6 +407,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
             txt.dispose();
             txt = null;
         }
+        disposeUploadTexture();
     }
 
     @Override
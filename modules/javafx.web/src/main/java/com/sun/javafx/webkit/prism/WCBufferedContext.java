@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -63,6 +63,8 @@ final class WCBufferedContext extends WCGraphicsPrismContext {
         init();
         if (baseGraphics == null) {
             baseGraphics = img.getGraphics();
+        } else {
+            img.prepareForRendering();
         }
         return super.getGraphics(checkClip);
     }
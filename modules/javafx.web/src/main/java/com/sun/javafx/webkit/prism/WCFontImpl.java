@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import com.sun.javafx.font.CharToGlyphMapper;
 import com.sun.javafx.font.FontFactory;
 import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrike;
+import com.sun.javafx.font.Metrics;
 import com.sun.javafx.font.PGFont;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.logging.PlatformLogger.Level;
@@ -39,6 +40,8 @@ import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
 import java.util.Arrays;
 import java.util.HashMap;
+import java.util.Map;
+import java.util.WeakHashMap;
 
 final class WCFontImpl extends WCFont {
     private final static PlatformLogger log =
@@ -115,10 +118,48 @@ final class WCFontImpl extends WCFont {
         return new float[]{bb[0], -bb[3], bb[2], bb[3] - bb[1]};
     }
 
+    @Override public float[] getGlyphWidths(int firstGlyph, int count) {
+        FontResource resource = getFontStrike().getFontResource();
+        float size = font.getSize();
+        float[] widths = new float[count];
+        for (int i = 0; i < count; i++) {
+            widths[i] = resource.getAdvance(firstGlyph + i, size);
+        }
+        return widths;
+    }
+
+    @Override public float[] getGlyphBoundingBoxes(int firstGlyph, int count) {
+        FontResource resource = getFontStrike().getFontResource();
+        float size = font.getSize();
+        float[] bb = new float[4];
+        float[] boxes = new float[count * 4];
+        for (int i = 0; i < count; i++) {
+            bb = resource.getGlyphBoundingBox(firstGlyph + i, size, bb);
+            boxes[i * 4] = bb[0];
+            boxes[i * 4 + 1] = -bb[3];
+            boxes[i * 4 + 2] = bb[2];
+            boxes[i * 4 + 3] = bb[3] - bb[1];
+        }
+        return boxes;
+    }
+
     @Override public float getXHeight() {
         return getFontStrike().getMetrics().getXHeight();
     }
 
+    private static final Map<FontResource, Integer> GLYPH_MAPPER_IDS = new WeakHashMap<>();
+    private static int lastGlyphMapperID = 0;
+
+    @Override public int getGlyphMapperID() {
+        FontResource resource = font.getFontResource();
+        if (resource == null) {
+            return 0;
+        }
+        synchronized (GLYPH_MAPPER_IDS) {
+            return GLYPH_MAPPER_IDS.computeIfAbsent(resource, r -> ++lastGlyphMapperID);
+        }
+    }
+
     private static boolean needsTextLayout(final int glyphs[]) {
         for (int g : glyphs) {
             if (g == 0) {
@@ -202,6 +243,18 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getMetrics().getCapHeight();
     }
 
+    @Override public float[] getFontMetrics() {
+        final Metrics metrics = getFontStrike().getMetrics();
+        final float[] res = new float[METRICS_COUNT];
+        res[METRICS_X_HEIGHT] = metrics.getXHeight();
+        res[METRICS_CAP_HEIGHT] = metrics.getCapHeight();
+        res[METRICS_ASCENT] = - metrics.getAscent();
+        res[METRICS_DESCENT] = metrics.getDescent();
+        res[METRICS_LINE_SPACING] = metrics.getLineHeight();
+        res[METRICS_LINE_GAP] = metrics.getLineGap();
+        return res;
+    }
+
     @Override
     public WCTextRun[] getTextRuns(final String str) {
         if (log.isLoggable(Level.FINE)) {
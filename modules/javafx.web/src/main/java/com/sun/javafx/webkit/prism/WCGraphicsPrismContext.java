@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -181,7 +181,8 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         saveStateInternal();
 
         // layer has the same bounds as clip, so we have to translate
-        Rectangle clip = state.getClipNoClone();
+        Rectangle clip = new Rectangle(layer.bounds);
+        state.setClip(clip);
 
         //left-side (post-) translate.
         //NB! an order of transforms is essential!
@@ -1081,8 +1082,9 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
     }
 
     @Override public void beginTransparencyLayer(float opacity) {
+        Graphics g = getGraphics(false);
         TransparencyLayer layer = new TransparencyLayer(
-                getGraphics(false), state.getClipNoClone(), opacity);
+                g, getLayerBounds(g), opacity);
 
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format("beginTransparencyLayer(%s)", layer));
@@ -1094,6 +1096,30 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         startNewLayer(layer);
     }
 
+    /*
+     * The part of the current clip that a transparency layer has to cover.
+     * The clip is limited to the surface that is drawn to, so a layer
+     * never gets a larger buffer than its target. Nothing can be drawn
+     * without graphics (e.g. inside a layer that has no buffer), so the
+     * bounds are empty then.
+     */
+    private Rectangle getLayerBounds(Graphics g) {
+        if (g == null) {
+            return new Rectangle();
+        }
+        Rectangle clip = state.getClipNoClone();
+        RenderTarget target = g.getRenderTarget();
+        if (target == null || g instanceof PrinterGraphics) {
+            return (clip != null) ? new Rectangle(clip) : new Rectangle();
+        }
+        Rectangle bounds = new Rectangle(0, 0,
+                target.getContentWidth(), target.getContentHeight());
+        if (clip != null) {
+            bounds.intersectWith(clip);
+        }
+        return bounds;
+    }
+
     @Override public void endTransparencyLayer() {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format("endTransparencyLayer(%s)", state.getLayerNoClone()));
@@ -1369,8 +1395,17 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         boolean permanent;
 
         Layer(Graphics g, Rectangle bounds, boolean permanent) {
+            this(g, bounds, permanent, true);
+        }
+
+        Layer(Graphics g, Rectangle bounds, boolean permanent, boolean visible) {
             this.bounds = new Rectangle(bounds);
             this.permanent = permanent;
+            if (!visible) {
+                // nothing drawn to the layer can be seen, so no buffer is
+                // allocated and drawing into the layer is skipped
+                return;
+            }
 
             // avoid creating zero-size drawable, see also JDK-8117714
             int w = Math.max(bounds.width, 1);
@@ -1423,7 +1458,7 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         private final float opacity;
 
         private TransparencyLayer(Graphics g, Rectangle bounds, float opacity) {
-            super(g, bounds, false);
+            super(g, bounds, false, opacity > 0f && !bounds.isEmpty());
             this.opacity = opacity;
         }
 
@@ -1432,6 +1467,9 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         }
 
         @Override void render(Graphics g) {
+            if (buffer == null) {
+                return;
+            }
             new Composite() {
                 @Override void doPaint(Graphics g) {
                     float op = g.getExtraAlpha();
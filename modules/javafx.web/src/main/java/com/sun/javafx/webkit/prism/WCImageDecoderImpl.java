@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,7 +40,7 @@ import com.sun.webkit.graphics.WCImageFrame;
 import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
-import java.util.Arrays;
+import java.nio.ByteBuffer;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
@@ -54,12 +54,12 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     private int imageHeight = 0;
     private ImageFrame[] frames;
     private int frameCount = 0; // keeps frame count when decoded frames are temporarily destroyed
-    private boolean fullDataReceived = false;
+    private volatile boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
     private PrismImage[] images;
     private volatile byte[] data;
     private volatile int dataSize = 0;
-    private String fileNameExtension;
+    private volatile String fileNameExtension;
 
     static {
         log = PlatformLogger.getLogger(WCImageDecoderImpl.class.getName());
@@ -90,18 +90,20 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    @Override protected void addImageData(ByteBuffer dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
+            int length = dataPortion.remaining();
             if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
+                data = new byte[length * 2];
+                dataPortion.get(data, 0, length);
+                dataSize = length;
             } else {
-                int newDataSize = dataSize + dataPortion.length;
+                int newDataSize = dataSize + length;
                 if (newDataSize > data.length) {
                     resizeDataArray(Math.max(newDataSize, data.length * 2));
                 }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
+                dataPortion.get(data, dataSize, length);
                 dataSize = newDataSize;
             }
             // Try to decode the partial data until we get image size.
@@ -258,16 +260,20 @@ final class WCImageDecoderImpl extends WCImageDecoder {
 
     @Override protected int getFrameCount() {
         // Initiate full decode to get frame count.
-        // NOTE: This method will be called just before
-        // rendering the given image, so there will not
-        // be any performance degrade while initiating a
-        // full decode.
-        if (fullDataReceived) {
+        // Only GIF images can have more than one frame, all other
+        // formats are decoded by getFrame(), which is called from
+        // the async image decoding thread when possible, so that
+        // large images are not decoded on the event thread.
+        if (fullDataReceived && mayHaveMultipleFrames()) {
             getImageFrame(0);
         }
         return frameCount;
     }
 
+    private boolean mayHaveMultipleFrames() {
+        return fileNameExtension == null || "gif".equalsIgnoreCase(fileNameExtension);
+    }
+
     // Avoid redundant decoding by async decoder threads, currently we don't
     // support per frame decoding.
     @Override protected synchronized WCImageFrame getFrame(int idx) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,7 @@ final class WCLinearGradient extends WCGradient<LinearGradient> {
     private final WCPoint p1;
     private final WCPoint p2;
     private final List<Stop> stops = new ArrayList<>();
+    private LinearGradient platformGradient;
 
     WCLinearGradient(WCPoint p1, WCPoint p2) {
         this.p1 = p1;
@@ -50,12 +51,16 @@ final class WCLinearGradient extends WCGradient<LinearGradient> {
     @Override
     protected void addStop(Color color, float offset) {
         this.stops.add(new Stop(color, offset));
+        this.platformGradient = null;
     }
 
     @Override
     public LinearGradient getPlatformGradient() {
+        if (this.platformGradient != null) {
+            return this.platformGradient;
+        }
         Collections.sort(this.stops, WCRadialGradient.COMPARATOR);
-        return new LinearGradient(
+        return this.platformGradient = new LinearGradient(
                 this.p1.getX(),
                 this.p1.getY(),
                 this.p2.getX(),
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.javafx.webkit.prism;
 
 import java.net.URI;
+import java.nio.ByteBuffer;
 import java.util.List;
 
 import com.sun.javafx.media.PrismMediaFrameHandler;
@@ -33,6 +34,7 @@ import com.sun.media.jfxmedia.Media;
 import com.sun.media.jfxmedia.MediaManager;
 import com.sun.media.jfxmedia.MediaPlayer;
 import com.sun.media.jfxmedia.control.VideoDataBuffer;
+import com.sun.media.jfxmedia.control.VideoFormat;
 import com.sun.media.jfxmedia.events.BufferListener;
 import com.sun.media.jfxmedia.events.BufferProgressEvent;
 import com.sun.media.jfxmedia.events.MediaErrorListener;
@@ -47,9 +49,11 @@ import com.sun.media.jfxmedia.track.AudioTrack;
 import com.sun.media.jfxmedia.track.Track;
 import com.sun.media.jfxmedia.track.VideoTrack;
 import com.sun.prism.Graphics;
+import com.sun.prism.Image;
 import com.sun.prism.Texture;
 import com.sun.prism.paint.Color;
 import com.sun.webkit.graphics.WCGraphicsContext;
+import com.sun.webkit.graphics.WCImage;
 import com.sun.webkit.graphics.WCMediaPlayer;
 
 
@@ -384,6 +388,12 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
         log.finer("<<(Prism)renderImpl");
     }
 
+    @Override
+    protected WCImage getCurrentFrameImage() {
+        VideoDataBuffer currentFrame = frameListener.getLatestFrame();
+        return currentFrame != null ? new FrameImage(currentFrame) : null;
+    }
+
     // PlayerStateListener
     @Override
     public void onReady(PlayerStateEvent pse) {
@@ -555,6 +565,113 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
         updateBufferingStatus();
     }
 
+    /* Image of a single video frame, as drawn by a canvas. It is drawn
+     * through the texture cache of the player, so a frame the video element
+     * has shown already, or the canvas has drawn before, is not uploaded
+     * again. Pixels are only read back for patterns, shadows and toDataURL.
+     */
+    private final class FrameImage extends PrismImage {
+        private final int width, height;
+        private VideoDataBuffer frame;
+        private Image image;
+
+        // takes over the hold the caller has on frame
+        FrameImage(VideoDataBuffer frame) {
+            this.frame = frame;
+            width = frame.getWidth();
+            height = frame.getHeight();
+        }
+
+        @Override
+        public int getWidth() {
+            return width;
+        }
+
+        @Override
+        public int getHeight() {
+            return height;
+        }
+
+        @Override
+        public float getPixelScale() {
+            return 1f;
+        }
+
+        @Override
+        Image getImage() {
+            synchronized (lock) {
+                if (image == null && frame != null) {
+                    image = readPixels(frame);
+                }
+                return image;
+            }
+        }
+
+        private Image readPixels(VideoDataBuffer frame) {
+            VideoDataBuffer bgra;
+            try {
+                bgra = frame.getFormat() == VideoFormat.BGRA_PRE
+                        ? frame : frame.convertToFormat(VideoFormat.BGRA_PRE);
+            } catch (UnsupportedOperationException e) {
+                log.fine("FrameImage: cannot convert frame to BGRA_PRE", e);
+                return null;
+            }
+            if (bgra == null) {
+                return null;
+            }
+            try {
+                // copied, the frame buffer goes away with the frame
+                ByteBuffer src = bgra.getBufferForPlane(VideoDataBuffer.PACKED_FORMAT_PLANE);
+                int stride = bgra.getStrideForPlane(VideoDataBuffer.PACKED_FORMAT_PLANE);
+                int rowBytes = width * 4;
+                byte[] pixels = new byte[rowBytes * height];
+                for (int y = 0; y < height; y++) {
+                    src.get(y * stride, pixels, y * rowBytes, rowBytes);
+                }
+                return Image.fromByteBgraPreData(pixels, width, height);
+            } finally {
+                if (bgra != frame) {
+                    bgra.releaseFrame();
+                }
+            }
+        }
+
+        @Override
+        Graphics getGraphics() {
+            return null;
+        }
+
+        @Override
+        void draw(Graphics g,
+                int dstx1, int dsty1, int dstx2, int dsty2,
+                int srcx1, int srcy1, int srcx2, int srcy2)
+        {
+            synchronized (lock) {
+                if (frame == null || frameHandler == null) {
+                    return;
+                }
+                Texture texture = frameHandler.getTexture(g, frame);
+                if (texture != null) {
+                    g.drawTexture(texture,
+                            dstx1, dsty1, dstx2, dsty2,
+                            srcx1, srcy1, srcx2, srcy2);
+                    texture.unlock();
+                }
+            }
+        }
+
+        @Override
+        void dispose() {
+            synchronized (lock) {
+                if (frame != null) {
+                    frame.releaseFrame();
+                    frame = null;
+                }
+                image = null;
+            }
+        }
+    }
+
     /* Inner class that will listen for new frames from the jfxmedia player and
      * manage our own texture cache to remove the dependency on
      * PrismMediaFrameHandler
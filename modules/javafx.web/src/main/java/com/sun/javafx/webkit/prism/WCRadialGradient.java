@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -58,6 +58,7 @@ final class WCRadialGradient extends WCGradient<RadialGradient> {
     private final float r1;
     private final float r2;
     private final List<Stop> stops = new ArrayList<>();
+    private RadialGradient platformGradient;
 
     WCRadialGradient(WCPoint p1, float r1, WCPoint p2, float r2) {
         this.reverse = r1 < r2;
@@ -77,14 +78,18 @@ final class WCRadialGradient extends WCGradient<RadialGradient> {
         }
         offset = 1.0f - offset + offset * this.r2 * this.r1over;
         this.stops.add(new Stop(color, offset));
+        this.platformGradient = null;
     }
 
     @Override
     public RadialGradient getPlatformGradient() {
+        if (this.platformGradient != null) {
+            return this.platformGradient;
+        }
         Collections.sort(this.stops, COMPARATOR);
         float dx = this.p2.getX() - this.p1.getX();
         float dy = this.p2.getY() - this.p1.getY();
-        return new RadialGradient(
+        return this.platformGradient = new RadialGradient(
                 this.p1.getX(),
                 this.p1.getY(),
                 (float) (Math.atan2(dy, dx) * 180 / Math.PI),
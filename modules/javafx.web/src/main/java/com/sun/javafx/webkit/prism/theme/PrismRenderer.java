@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,23 +25,124 @@
 
 package com.sun.javafx.webkit.prism.theme;
 
+import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.scene.NodeHelper;
 import com.sun.javafx.scene.SceneHelper;
 import com.sun.javafx.sg.prism.NGNode;
 import com.sun.prism.Graphics;
+import com.sun.prism.GraphicsPipeline;
+import com.sun.prism.PrinterGraphics;
+import com.sun.prism.RTTexture;
+import com.sun.prism.ResourceFactory;
+import com.sun.prism.Texture;
 import com.sun.webkit.graphics.WCGraphicsContext;
 import com.sun.javafx.webkit.theme.Renderer;
+import java.util.LinkedHashMap;
+import java.util.Map;
 import javafx.scene.control.Control;
 
 public final class PrismRenderer extends Renderer {
 
+    private static final int MAX_CACHED_IMAGES = 256;
+
+    /*
+     * Images of controls, most recently drawn last. An image is rendered
+     * at the device scale of the context it is first drawn to, and is only
+     * reused at the same scale.
+     */
+    private final Map<ImageKey, RTTexture> images =
+            new LinkedHashMap<>(16, 0.75f, true) {
+        @Override
+        protected boolean removeEldestEntry(Map.Entry<ImageKey, RTTexture> eldest) {
+            if (size() > MAX_CACHED_IMAGES) {
+                eldest.getValue().dispose();
+                return true;
+            }
+            return false;
+        }
+    };
+
+    private record ImageKey(Object key, double scale) {}
+
     @Override
     protected void render(Control control, WCGraphicsContext g) {
+        getPeer(control).render((Graphics)g.getPlatformGraphics());
+    }
+
+    @Override
+    protected void render(Control control, WCGraphicsContext g, Object imageKey) {
+        Graphics pg = (Graphics)g.getPlatformGraphics();
+        if (imageKey == null || pg == null || pg instanceof PrinterGraphics) {
+            render(control, g);
+            return;
+        }
+
+        // The image is only drawn where it maps to whole device pixels,
+        // so that it looks the same as the control rendered in place.
+        BaseTransform tx = pg.getTransformNoClone();
+        double scale = tx.getMxx();
+        double w = control.getWidth() * scale;
+        double h = control.getHeight() * scale;
+        if ((tx.getType() & ~(BaseTransform.TYPE_TRANSLATION | BaseTransform.TYPE_UNIFORM_SCALE)) != 0
+                || scale <= 0 || w < 1 || h < 1
+                || !isWhole(tx.getMxt()) || !isWhole(tx.getMyt())
+                || !isWhole(w) || !isWhole(h))
+        {
+            render(control, g);
+            return;
+        }
+
+        RTTexture texture;
+        synchronized (images) {
+            ImageKey key = new ImageKey(imageKey, scale);
+            texture = images.get(key);
+            if (texture != null && texture.isSurfaceLost()) {
+                images.remove(key);
+                texture.dispose();
+                texture = null;
+            }
+            if (texture == null) {
+                texture = renderToTexture(control, scale, (int)Math.rint(w), (int)Math.rint(h));
+                if (texture == null) {
+                    render(control, g);
+                    return;
+                }
+                images.put(key, texture);
+            }
+        }
+        pg.drawTexture(texture,
+                0, 0, (float)control.getWidth(), (float)control.getHeight(),
+                0, 0, texture.getContentWidth(), texture.getContentHeight());
+    }
+
+    private static RTTexture renderToTexture(Control control, double scale, int w, int h) {
+        ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
+        if (f == null || f.isDisposed()) {
+            return null;
+        }
+        RTTexture texture = f.createRTTexture(w, h, Texture.WrapMode.CLAMP_NOT_NEEDED);
+        if (texture == null) {
+            return null;
+        }
+        texture.contentsUseful();
+        texture.makePermanent();
+
+        Graphics tg = texture.createGraphics();
+        tg.clear();
+        tg.scale((float)scale, (float)scale);
+        getPeer(control).render(tg);
+        return texture;
+    }
+
+    private static NGNode getPeer(Control control) {
         SceneHelper.setAllowPGAccess(true);
         // The peer is not modified.
         NGNode peer = NodeHelper.getPeer(control);
         SceneHelper.setAllowPGAccess(false);
+        return peer;
+    }
 
-        peer.render((Graphics)g.getPlatformGraphics());
+    private static boolean isWhole(double v) {
+        return Math.abs(v - Math.rint(v)) < 1e-6;
     }
 }
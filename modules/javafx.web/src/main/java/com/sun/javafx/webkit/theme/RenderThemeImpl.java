@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -109,6 +109,18 @@ public final class RenderThemeImpl extends RenderTheme {
         // The {@code ids} map is kept in sync with the set of keys.
         private final Map<Long, WeakReference<T>> pool = new HashMap<>();
 
+        // The last appearance key of each pooled control, along with the
+        // updateContentCycleID at which the control got that appearance.
+        private final Map<Long, ImageKeyState> imageKeys = new HashMap<>();
+
+        // Changed when the controls may be styled differently, so that
+        // images rendered before are no longer used.
+        private int imageGeneration;
+
+        private record ImageKeyState(Object key, int updateContentCycleID) {}
+
+        private record ImageKey(int generation, Object key) {}
+
         private final Notifier<T> notifier;
         private final String type; // used for logging
 
@@ -162,6 +174,7 @@ public final class RenderThemeImpl extends RenderTheme {
                 // during the current update cycle.
                 if (cycleID != updateContentCycleID) {
                     ids.remove(_id);
+                    imageKeys.remove(_id);
                     T _control = pool.remove(_id).get();
                     if (_control != null) {
                         notifier.notifyRemoved(_control);
@@ -175,6 +188,28 @@ public final class RenderThemeImpl extends RenderTheme {
             pool.put(id, new WeakReference<>(control));
         }
 
+        /**
+         * Returns a key for the image of the control with the given ID,
+         * or {@code null} if the control has to be rendered. The control
+         * must have had the same appearance at an earlier update cycle,
+         * so that it has been styled, laid out and synced with its peer
+         * since the appearance changed.
+         */
+        Object getImageKey(long id, Object appearance, int updateContentCycleID) {
+            ImageKeyState last = imageKeys.get(id);
+            if (last != null && last.key().equals(appearance)) {
+                return (last.updateContentCycleID() != updateContentCycleID)
+                        ? new ImageKey(imageGeneration, appearance)
+                        : null;
+            }
+            imageKeys.put(id, new ImageKeyState(appearance, updateContentCycleID));
+            return null;
+        }
+
+        void invalidateImages() {
+            imageGeneration++;
+        }
+
         void clear() {
             if (log.isLoggable(Level.FINE)) {
                 log.fine("size: " + pool.size() + ", controls: " + pool.values());
@@ -183,6 +218,7 @@ public final class RenderThemeImpl extends RenderTheme {
                 return;
             }
             ids.clear();
+            imageKeys.clear();
             for (WeakReference<T> controlRef : pool.values()) {
                 T control = controlRef.get();
                 if (control != null) {
@@ -206,6 +242,7 @@ public final class RenderThemeImpl extends RenderTheme {
 
         @Override public void invalidated(Observable ov) {
             pool.clear(); // clear the pool when WebView changes
+            pool.invalidateImages(); // the new WebView may style controls differently
 
             // Add the LoadListenerClient when the page is available.
             if (accessor.getPage() != null && loadListener == null) {
@@ -224,6 +261,10 @@ public final class RenderThemeImpl extends RenderTheme {
                     public void dispatchResourceLoadEvent(long frame, int state, String url,
                                                           String contentType, double progress,
                                                           int errorCode) {}
+                    @Override
+                    public boolean wantsResourceLoadEvents() {
+                        return false;
+                    }
                 };
                 accessor.getPage().addLoadListenerClient(loadListener);
             }
@@ -305,6 +346,13 @@ public final class RenderThemeImpl extends RenderTheme {
             accessor.addChild(fc.asControl());
         }
 
+        // The ext params are only valid during this call
+        ByteBuffer params = null;
+        if (extParams != null) {
+            params = ByteBuffer.allocate(extParams.remaining());
+            params.put(extParams.duplicate()).flip();
+        }
+
         fc.setState(state);
         Control ctrl = fc.asControl();
         if (ctrl.getWidth() != w || ctrl.getHeight() != h) {
@@ -337,9 +385,21 @@ public final class RenderThemeImpl extends RenderTheme {
                 progress.setStyle(getMeterStyle(extParams.getInt()));
             }
         }
-        return new FormControlRef(fc);
+
+        // An indeterminate progress bar is animated by its skin
+        boolean animated = type == WidgetType.PROGRESSBAR
+                && ((ProgressBar)ctrl).isIndeterminate();
+        Object imageKey = animated ? null : pool.getImageKey(id,
+                new WidgetAppearance(type, state, w, h, bgColor, params,
+                                     Application.getUserAgentStylesheet()),
+                accessor.getPage().getUpdateContentCycleID());
+        return new FormControlRef(fc, imageKey);
     }
 
+    private record WidgetAppearance(WidgetType type, int state, int w, int h,
+                                    int bgColor, ByteBuffer params,
+                                    String userAgentStylesheet) {}
+
     private String getMeterStyle(int region) {
         // see GaugeRegion in HTMLMeterElement.h
         switch (region) {
@@ -366,7 +426,8 @@ public final class RenderThemeImpl extends RenderTheme {
             if (control != null) {
                 g.saveState();
                 g.translate(x, y);
-                Renderer.getRenderer().render(control, g);
+                Renderer.getRenderer().render(control, g,
+                        ((FormControlRef) widget).imageKey);
                 g.restoreState();
             }
         }
@@ -411,9 +472,11 @@ public final class RenderThemeImpl extends RenderTheme {
 
     private static final class FormControlRef extends Ref {
         private final WeakReference<FormControl> fcRef;
+        private final Object imageKey;
 
-        private FormControlRef(FormControl fc) {
+        private FormControlRef(FormControl fc, Object imageKey) {
             this.fcRef = new WeakReference<>(fc);
+            this.imageKey = imageKey;
         }
 
         private FormControl asFormControl() {
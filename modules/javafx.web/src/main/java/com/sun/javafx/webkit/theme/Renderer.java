@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,4 +41,14 @@ public abstract class Renderer {
     }
 
     protected abstract void render(Control c, WCGraphicsContext g);
+
+    /**
+     * Renders the control like {@link #render(Control, WCGraphicsContext)}.
+     * Controls given equal keys look the same, so an implementation may
+     * draw them from an image rendered earlier. A {@code null} key means
+     * the control has to be rendered.
+     */
+    protected void render(Control c, WCGraphicsContext g, Object imageKey) {
+        render(c, g);
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import java.lang.ref.WeakReference;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import javafx.application.Application;
 import javafx.beans.Observable;
 import javafx.geometry.Bounds;
 import javafx.geometry.Orientation;
@@ -57,9 +58,11 @@ public final class ScrollBarThemeImpl extends ScrollBarTheme {
 
     private static final class ScrollBarRef extends Ref {
         private final WeakReference<ScrollBarWidget> sbRef;
+        private final Object imageKey;
 
-        private ScrollBarRef(ScrollBarWidget sb) {
+        private ScrollBarRef(ScrollBarWidget sb, Object imageKey) {
             this.sbRef = new WeakReference<>(sb);
+            this.imageKey = imageKey;
         }
 
         private Control asControl() {
@@ -161,13 +164,22 @@ public final class ScrollBarThemeImpl extends ScrollBarTheme {
             accessor.addChild(sb);
         }
         adjustScrollBar(sb, w, h, orientation, value, visibleSize, totalSize);
-        return new ScrollBarRef(sb);
+        Object imageKey = pool.getImageKey(id,
+                new ScrollBarAppearance(w, h, orientation, value, visibleSize,
+                                        totalSize, Application.getUserAgentStylesheet()),
+                accessor.getPage().getUpdateContentCycleID());
+        return new ScrollBarRef(sb, imageKey);
     }
 
+    private record ScrollBarAppearance(int w, int h, int orientation, int value,
+                                       int visibleSize, int totalSize,
+                                       String userAgentStylesheet) {}
+
     @Override public void paint(WCGraphicsContext g, Ref sbRef,
                                 int x, int y, int pressedPart, int hoveredPart)
     {
-        ScrollBar sb = (ScrollBar)((ScrollBarRef)sbRef).asControl();
+        ScrollBarRef ref = (ScrollBarRef)sbRef;
+        ScrollBar sb = (ScrollBar)ref.asControl();
         if (sb == null) {
             return;
         }
@@ -179,7 +191,7 @@ public final class ScrollBarThemeImpl extends ScrollBarTheme {
         }
         g.saveState();
         g.translate(x, y);
-        Renderer.getRenderer().render(sb, g);
+        Renderer.getRenderer().render(sb, g, ref.imageKey);
         g.restoreState();
     }
 
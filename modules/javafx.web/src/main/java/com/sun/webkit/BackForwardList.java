@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -180,6 +180,10 @@ public final class BackForwardList {
                                                             double progress,
                                                             int errorCode)
             {}
+
+            @Override public boolean wantsResourceLoadEvents() {
+                return false;
+            }
         });
     }
 
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.webkit.graphics.WCRectangle;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * The dirty area of a page tracked on a grid of square tiles.
+ *
+ * Each tile keeps the bounds of the dirty rects that intersect it, so
+ * that distant repaints never grow into one large union and an
+ * invalidation is proportional to the number of tiles it touches.
+ * When the region is taken, horizontally adjacent tiles with the same
+ * vertical extent are merged back into spans to keep the number of
+ * paint passes low.
+ */
+public final class DirtyTileRegion {
+    public static final int DEFAULT_TILE_SIZE = 256;
+
+    private final int tileSize;
+    private final Map<Long, WCRectangle> tiles = new HashMap<>();
+
+    public DirtyTileRegion() {
+        this(DEFAULT_TILE_SIZE);
+    }
+
+    public DirtyTileRegion(int tileSize) {
+        if (tileSize <= 0) {
+            throw new IllegalArgumentException("tileSize: " + tileSize);
+        }
+        this.tileSize = tileSize;
+    }
+
+    public int getTileSize() {
+        return tileSize;
+    }
+
+    public boolean isEmpty() {
+        return tiles.isEmpty();
+    }
+
+    public void clear() {
+        tiles.clear();
+    }
+
+    public void add(WCRectangle r) {
+        if (r.getWidth() <= 0 || r.getHeight() <= 0) {
+            return;
+        }
+        int tx0 = Math.floorDiv((int) Math.floor(r.getX()), tileSize);
+        int ty0 = Math.floorDiv((int) Math.floor(r.getY()), tileSize);
+        int tx1 = Math.floorDiv((int) Math.ceil(r.getX() + r.getWidth()) - 1, tileSize);
+        int ty1 = Math.floorDiv((int) Math.ceil(r.getY() + r.getHeight()) - 1, tileSize);
+        for (int ty = ty0; ty <= ty1; ty++) {
+            for (int tx = tx0; tx <= tx1; tx++) {
+                WCRectangle part = r.intersection(new WCRectangle(
+                        tx * tileSize, ty * tileSize, tileSize, tileSize));
+                if (part.getWidth() <= 0 || part.getHeight() <= 0) {
+                    continue;
+                }
+                tiles.merge(key(tx, ty), part, WCRectangle::createUnion);
+            }
+        }
+    }
+
+    /**
+     * Moves the dirty areas that lie inside {@code scrollRect} by the
+     * given delta, as their content has been scrolled there.
+     */
+    public void translate(WCRectangle scrollRect, int dx, int dy) {
+        if (tiles.isEmpty() || (dx == 0 && dy == 0)) {
+            return;
+        }
+        List<WCRectangle> rects = new ArrayList<>(tiles.values());
+        tiles.clear();
+        for (WCRectangle r : rects) {
+            if (scrollRect.contains(r)) {
+                r.translate(dx, dy);
+            }
+            add(r);
+        }
+    }
+
+    /**
+     * Returns the rects to repaint and empties the region.
+     */
+    public List<WCRectangle> take() {
+        List<Long> keys = new ArrayList<>(tiles.keySet());
+        keys.sort((k1, k2) -> {
+            int c = Integer.compare(tileY(k1), tileY(k2));
+            return c != 0 ? c : Integer.compare(tileX(k1), tileX(k2));
+        });
+
+        List<WCRectangle> result = new ArrayList<>();
+        WCRectangle span = null;
+        for (Long k : keys) {
+            WCRectangle r = tiles.get(k);
+            if (span != null
+                    && span.getY() == r.getY()
+                    && span.getHeight() == r.getHeight()
+                    && span.getX() + span.getWidth() == r.getX())
+            {
+                span = span.createUnion(r);
+                continue;
+            }
+            if (span != null) {
+                result.add(span);
+            }
+            span = r;
+        }
+        if (span != null) {
+            result.add(span);
+        }
+        tiles.clear();
+        return result;
+    }
+
+    private static long key(int tx, int ty) {
+        return ((long) ty << 32) | (tx & 0xFFFFFFFFL);
+    }
+
+    private static int tileX(long key) {
+        return (int) key;
+    }
+
+    private static int tileY(long key) {
+        return (int) (key >> 32);
+    }
+
+    @Override
+    public String toString() {
+        return "DirtyTileRegion{tileSize=" + tileSize + ", tiles=" + tiles.values() + "}";
+    }
+}
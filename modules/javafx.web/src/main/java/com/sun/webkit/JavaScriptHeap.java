@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package com.sun.webkit;
+
+/**
+ * A collection of static methods for JavaScript heap monitoring.
+ * All pages share a single JavaScript virtual machine, hence a single heap.
+ */
+public final class JavaScriptHeap {
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private JavaScriptHeap() {
+        throw new AssertionError();
+    }
+
+    // Indices in the array returned by getStatistics()
+    public final static int HEAP_SIZE = 0;
+    public final static int HEAP_CAPACITY = 1;
+    public final static int EXTRA_MEMORY_SIZE = 2;
+    public final static int OBJECT_COUNT = 3;
+    public final static int GLOBAL_OBJECT_COUNT = 4;
+    public final static int PROTECTED_OBJECT_COUNT = 5;
+    public final static int FULL_COLLECTION_COUNT = 6;
+    public final static int EDEN_COLLECTION_COUNT = 7;
+    public final static int TOTAL_COLLECTION_NANOS = 8;
+    public final static int MAX_COLLECTION_NANOS = 9;
+
+    /**
+     * Returns the size and capacity of the heap in bytes, the live object
+     * counts, and the number and durations of the collections so far.
+     * Must be called on the Event thread.
+     * @param countObjects {@code true} to count the live and global objects,
+     *        which walks the whole heap. Otherwise both counts are -1.
+     */
+    public static long[] getStatistics(boolean countObjects) {
+        Invoker.getInvoker().checkEventThread();
+        WebPage.lockPage();
+        try {
+            return twkGetStatistics(countObjects);
+        } finally {
+            WebPage.unlockPage();
+        }
+    }
+
+    /**
+     * Runs a full garbage collection.
+     * Must be called on the Event thread.
+     * @param shrink {@code true} to also drop the compiled code and return
+     *        free memory to the system. This is done as soon as no
+     *        JavaScript is running.
+     */
+    public static void collectGarbage(boolean shrink) {
+        Invoker.getInvoker().checkEventThread();
+        WebPage.lockPage();
+        try {
+            twkCollectGarbage(shrink);
+        } finally {
+            WebPage.unlockPage();
+        }
+    }
+
+    private static native long[] twkGetStatistics(boolean countObjects);
+    private static native void twkCollectGarbage(boolean shrink);
+}
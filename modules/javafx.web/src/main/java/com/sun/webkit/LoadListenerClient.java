@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -106,4 +106,13 @@ public interface LoadListenerClient {
     public void dispatchResourceLoadEvent(long frame, int state,
                                           String url, String contentType,
                                           double progress, int errorCode);
+
+    /**
+     * Returns whether this client handles resource load events. The native
+     * code skips the per-resource upcalls altogether while no registered
+     * client does.
+     */
+    public default boolean wantsResourceLoadEvents() {
+        return true;
+    }
 }
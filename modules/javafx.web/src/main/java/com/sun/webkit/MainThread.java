@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,10 +25,19 @@
 
 package com.sun.webkit;
 
+import java.util.concurrent.ScheduledFuture;
+import java.util.concurrent.ScheduledThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+
 /**
  * The class reflects the native webkit module.
  */
-final class MainThread {
+public final class MainThread {
+
+    // Wakes up the event thread when the earliest native RunLoop timer is due
+    private static ScheduledThreadPoolExecutor wakeUpExecutor;
+    private static ScheduledFuture<?> pendingWakeUp;
+    private static long pendingWakeUpTime;
 
     private static void fwkScheduleDispatchFunctions() {
         Invoker.getInvoker().postOnEventThread(() -> {
@@ -36,6 +45,52 @@ final class MainThread {
         });
     }
 
+    /**
+     * Schedules a dispatch after the given delay. Only the earliest
+     * request is kept, the native side schedules the next one when
+     * the dispatch happens.
+     */
+    private static synchronized void fwkScheduleDispatchFunctionsAfter(long delayMillis) {
+        long wakeUpTime = System.nanoTime() + TimeUnit.MILLISECONDS.toNanos(delayMillis);
+        if (pendingWakeUp != null && !pendingWakeUp.isDone()) {
+            if (pendingWakeUpTime - wakeUpTime <= 0) {
+                return;
+            }
+            pendingWakeUp.cancel(false);
+        }
+        if (wakeUpExecutor == null) {
+            wakeUpExecutor = new ScheduledThreadPoolExecutor(1, r -> {
+                Thread t = new Thread(r, "WebPane-RunLoop-Timer");
+                t.setDaemon(true);
+                return t;
+            });
+            wakeUpExecutor.setRemoveOnCancelPolicy(true);
+        }
+        pendingWakeUp = wakeUpExecutor.schedule(MainThread::fwkScheduleDispatchFunctions,
+                Math.max(delayMillis, 0), TimeUnit.MILLISECONDS);
+        pendingWakeUpTime = wakeUpTime;
+    }
+
+    // Indices in the array returned by getDispatchCounters()
+    public final static int DISPATCH_REQUEST_COUNT = 0;
+    public final static int DISPATCH_UPCALL_COUNT = 1;
+    public final static int DISPATCH_COUNT = 2;
+    public final static int MAX_QUEUE_DEPTH = 3;
+    public final static int TOTAL_LATENCY_NANOS = 4;
+    public final static int MAX_LATENCY_NANOS = 5;
+
+    /**
+     * Returns the number of native requests to dispatch functions on the
+     * event thread, the number of those that posted a dispatch, and the
+     * number of dispatches run so far. Also returns the largest number of
+     * functions found queued by a dispatch and the total and largest delay
+     * between posting a dispatch and running it.
+     */
+    public static long[] getDispatchCounters() {
+        return twkGetDispatchCounters();
+    }
+
     private static native void twkScheduleDispatchFunctions();
+    private static native long[] twkGetDispatchCounters();
     static native void twkSetShutdown(boolean isShutdown);
 }
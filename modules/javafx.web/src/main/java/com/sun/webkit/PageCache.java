@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,6 +59,73 @@ public final class PageCache {
         twkSetCapacity(capacity);
     }
 
+    /**
+     * Returns the number of pages currently held in the page cache.
+     */
+    public static int getPageCount() {
+        return twkGetPageCount();
+    }
+
+    // Indices in the array returned by getCounters()
+    public final static int HISTORY_NAVIGATION_COUNT = 0;
+    public final static int RESTORED_PAGE_COUNT = 1;
+
+    /**
+     * Returns the number of back or forward navigations started so far
+     * and the number of those that were served from the page cache.
+     */
+    public static int[] getCounters() {
+        return twkGetCounters();
+    }
+
+    /**
+     * Evicts the cached pages and the decoded image data of the memory cache,
+     * and releases the other caches kept by WebCore.
+     * A non-critical release keeps the cached pages and the live resources.
+     * Must be called on the Event thread.
+     * @param critical {@code true} to release as much memory as possible.
+     */
+    public static void releaseMemory(boolean critical) {
+        Invoker.getInvoker().checkEventThread();
+        twkReleaseMemory(critical);
+    }
+
+    /**
+     * Releases memory if the Java heap or the native memory used by the
+     * process is above the threshold configured with the
+     * {@code com.sun.webkit.heapPressurePercent} (percentage of the maximum
+     * heap size) or {@code com.sun.webkit.nativePressureMB} (megabytes)
+     * system properties. Nothing is released when neither is set.
+     * Must be called on the Event thread.
+     * @return {@code true} if memory was released.
+     */
+    public static boolean releaseMemoryIfNeeded() {
+        final boolean heapPressure;
+        if (HEAP_PRESSURE_PERCENT != null) {
+            Runtime rt = Runtime.getRuntime();
+            long used = rt.totalMemory() - rt.freeMemory();
+            heapPressure = used * 100 >= rt.maxMemory() * HEAP_PRESSURE_PERCENT;
+        } else {
+            heapPressure = false;
+        }
+        final boolean nativePressure = NATIVE_PRESSURE_MB != null
+                && twkGetNativeMemoryFootprint() >= NATIVE_PRESSURE_MB * 1024L * 1024L;
+        if (!heapPressure && !nativePressure) {
+            return false;
+        }
+        releaseMemory(true);
+        return true;
+    }
+
+    private static final Integer HEAP_PRESSURE_PERCENT =
+            Integer.getInteger("com.sun.webkit.heapPressurePercent");
+    private static final Integer NATIVE_PRESSURE_MB =
+            Integer.getInteger("com.sun.webkit.nativePressureMB");
+
     native private static int twkGetCapacity();
     native private static void twkSetCapacity(int capacity);
+    native private static int twkGetPageCount();
+    native private static int[] twkGetCounters();
+    native private static long twkGetNativeMemoryFootprint();
+    native private static void twkReleaseMemory(boolean critical);
 }
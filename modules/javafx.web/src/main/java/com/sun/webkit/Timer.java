@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,11 +25,15 @@
 
 package com.sun.webkit;
 
+import java.util.concurrent.TimeUnit;
+
 public class Timer {
     private static Timer instance;
     private static Mode mode;
 
+    // The System.nanoTime() deadline, meaningful only while the timer is armed.
     long fireTime;
+    boolean armed;
 
     Timer() {
     }
@@ -55,7 +59,7 @@ public class Timer {
     }
 
     public synchronized void notifyTick() {
-        if (fireTime > 0 && fireTime <= System.currentTimeMillis()) {
+        if (armed && fireTime - System.nanoTime() <= 0) {
             fireTimerEvent(fireTime);
         }
     }
@@ -66,9 +70,9 @@ public class Timer {
             // The event is not fired if either:
             // - webkit has stopped the timer;
             // - webkit has updated the timer.
-            if (time == fireTime) {
+            if (armed && time == fireTime) {
                 needFire = true;
-                fireTime = 0;
+                armed = false;
             }
         }
         if (needFire) {
@@ -85,17 +89,22 @@ public class Timer {
 
     synchronized void setFireTime(long time) {
         fireTime = time;
+        armed = true;
+    }
+
+    synchronized void stop() {
+        armed = false;
     }
 
     /**
      * @param fireTime time to wait in seconds
      */
     private static void fwkSetFireTime(double fireTime) {
-        getTimer().setFireTime((long)Math.ceil(fireTime * 1000));
+        getTimer().setFireTime(System.nanoTime() + (long)Math.ceil(fireTime * 1e9));
     }
 
     private static void fwkStopTimer() {
-        getTimer().setFireTime(0);
+        getTimer().stop();
     }
 
     private static native void twkFireTimerEvent();
@@ -136,17 +145,23 @@ final class SeparateThreadTimer extends Timer implements Runnable {
         notifyAll();
     }
 
+    @Override
+    synchronized void stop() {
+        super.stop();
+        notifyAll();
+    }
+
     @Override
     public synchronized void run() {
         while (true) {
             try {
-                if (fireTime > 0) {
-                    long curTime = System.currentTimeMillis();
-                    while (fireTime > curTime) {
-                        wait(fireTime - curTime);
-                        curTime = System.currentTimeMillis();
+                if (armed) {
+                    long delay = fireTime - System.nanoTime();
+                    while (armed && delay > 0) {
+                        TimeUnit.NANOSECONDS.timedWait(this, delay);
+                        delay = fireTime - System.nanoTime();
                     }
-                    if (fireTime > 0) {
+                    if (armed) {
                         invoker.invokeOnEventThread(fireRunner.forTime(fireTime));
                     }
                 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,13 @@ public abstract class Utilities {
 
     private static Utilities instance;
 
+    // Read by the native JavaScript bridge: when set, numeric Java arrays
+    // passed to JavaScript arrive as typed array copies instead of live
+    // views of the Java array.
+    private static final boolean PRIMITIVE_ARRAYS_AS_TYPED_ARRAYS =
+            Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.primitiveArraysAsTypedArrays", "false"));
+
     public static synchronized void setUtilities(Utilities util) {
         instance = util;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,13 +39,22 @@ import com.sun.webkit.event.WCMouseEvent;
 import com.sun.webkit.event.WCMouseWheelEvent;
 import com.sun.webkit.graphics.*;
 import com.sun.webkit.network.CookieManager;
+import com.sun.webkit.perf.FrameTracer;
 import static com.sun.webkit.network.URLs.newURL;
+import java.io.File;
+import java.io.IOException;
 import java.net.CookieHandler;
 import java.net.MalformedURLException;
 import java.net.URL;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
+import java.nio.IntBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.StandardOpenOption;
 import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Comparator;
 import java.util.HashMap;
 import java.util.HashSet;
 import java.util.Iterator;
@@ -54,6 +63,8 @@ import java.util.List;
 import java.util.Map;
 import java.util.Queue;
 import java.util.Set;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.ExecutionException;
 import java.util.concurrent.FutureTask;
@@ -114,6 +125,55 @@ public final class WebPage {
     // - timer invocations (Event thread)
     private static final ReentrantLock PAGE_LOCK = new ReentrantLock();
 
+    // The number of pages kept in the back/forward page cache.
+    private static final Integer PAGE_CACHE_CAPACITY =
+            Integer.getInteger("com.sun.webkit.pageCacheCapacity");
+
+    // Whether DOM timers of pages whose view is hidden are aligned to
+    // coarse wake-ups.
+    private static final boolean THROTTLE_HIDDEN_PAGE_TIMERS =
+            Boolean.valueOf(System.getProperty("com.sun.webkit.throttleHiddenPageTimers", "false"));
+
+    // Whether the decoded images, cached history pages and compiled code
+    // of a page are released when its view becomes hidden.
+    private static final boolean PURGE_HIDDEN_PAGES =
+            Boolean.valueOf(System.getProperty("com.sun.webkit.purgeHiddenPages", "false"));
+
+    // Whether the view of this page is visible, as last told to WebCore.
+    // Accessed on: Event thread.
+    private boolean visible = true;
+
+    // The approximate number of bytes released by purging this page.
+    // Accessed on: Event thread.
+    private long purgedBytes;
+
+    // Whether IndexedDB databases are persisted in the user data directory.
+    private static final boolean PERSIST_INDEXED_DB =
+            Boolean.valueOf(System.getProperty("com.sun.webkit.persistIndexedDB", "false"));
+
+    // Whether visited links are persisted in the user data directory.
+    private static final boolean PERSIST_VISITED_LINKS =
+            Boolean.valueOf(System.getProperty("com.sun.webkit.persistVisitedLinks", "false"));
+
+    // The file of visited link hashes, or null if not persisted.
+    // Accessed on: Event thread.
+    private File visitedLinksFile;
+
+    // Whether the bytecode of external scripts is cached in the user data
+    // directory.
+    private static final boolean CACHE_SCRIPT_BYTECODE =
+            Boolean.valueOf(System.getProperty("com.sun.webkit.cacheScriptBytecode", "false"));
+
+    // The maximum size in bytes of the script bytecode cache.
+    private static final long SCRIPT_BYTECODE_CACHE_LIMIT =
+            Long.getLong("com.sun.webkit.scriptBytecodeCacheSize", 32L * 1024 * 1024);
+
+    // The directory of the script bytecode cache, or null if not set, and
+    // the total size of the files in it.
+    // Accessed on: Event thread.
+    private static File scriptBytecodeCacheDir;
+    private static long scriptBytecodeCacheSize;
+
     // The queue of render frames awaiting rendering.
     // Access to this object is synchronized on its monitor.
     // Accessed on: Event thread and Main thread.
@@ -121,7 +181,10 @@ public final class WebPage {
 
     // The current frame being generated.
     // Accessed on: Event thread only.
-    private RenderFrame currentFrame = new RenderFrame();
+    // The number of render frames created so far, used as frame ID.
+    // Accessed on: Event thread.
+    private long renderFrameCount;
+    private RenderFrame currentFrame = new RenderFrame(++renderFrameCount);
 
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
@@ -143,6 +206,12 @@ public final class WebPage {
                 "com.sun.webkit.useJIT", "true"));
         final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                 "com.sun.webkit.useDFGJIT", "false"));
+        // The FTL tier sits on top of the DFG and only kicks in for long
+        // running hot code. It keeps B3/Air intermediate code and larger
+        // machine code per compiled function, which typically adds a few
+        // MB of executable and heap memory on compute heavy pages.
+        final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useFTLJIT", "false"));
 
         // TODO: Enable CSS3D by default once it is stabilized.
         boolean useCSS3D = Boolean.valueOf(System.getProperty(
@@ -150,7 +219,25 @@ public final class WebPage {
         useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
         // Initialize WTF, WebCore and JavaScriptCore.
-        twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+        twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useCSS3D);
+
+        final Integer textRunCacheSize = Integer.getInteger(
+                "com.sun.webkit.textRunCacheSize");
+        if (textRunCacheSize != null) {
+            WCFont.setTextRunCacheCapacity(textRunCacheSize);
+        }
+
+        // The page cache is empty and disabled by default. A positive
+        // capacity also turns it on for every page.
+        if (PAGE_CACHE_CAPACITY != null && PAGE_CACHE_CAPACITY >= 0) {
+            PageCache.setCapacity(PAGE_CACHE_CAPACITY);
+        }
+
+        // The maximum size in bytes of the IndexedDB databases of an origin.
+        final Long indexedDBQuota = Long.getLong("com.sun.webkit.indexedDBQuota");
+        if (indexedDBQuota != null && indexedDBQuota > 0) {
+            twkSetIndexedDatabaseQuota(indexedDBQuota);
+        }
 
         // Inform the native webkit code when either the JVM or the
         // JavaFX runtime is being shutdown
@@ -201,6 +288,9 @@ public final class WebPage {
         pPage = twkCreatePage(editable);
 
         twkInit(pPage, false, WCGraphicsManager.getGraphicsManager().getDevicePixelScale());
+        if (PAGE_CACHE_CAPACITY != null && PAGE_CACHE_CAPACITY > 0) {
+            twkSetUsePageCache(pPage, true);
+        }
 
         if (pageClient != null && pageClient.isBackBufferSupported()) {
             backbuffer = pageClient.createBackBuffer();
@@ -237,34 +327,9 @@ public final class WebPage {
     // *************************************************************************
 
     private WCPageBackBuffer backbuffer;
-    private List<WCRectangle> dirtyRects = new LinkedList<>();
+    private final DirtyTileRegion dirtyRects = new DirtyTileRegion();
 
     private void addDirtyRect(WCRectangle toPaint) {
-        if (toPaint.getWidth() <= 0 || toPaint.getHeight() <= 0) {
-            return;
-        }
-        for (Iterator<WCRectangle> it = dirtyRects.iterator(); it.hasNext();) {
-            WCRectangle rect = it.next();
-            // if already covered
-            if (rect.contains(toPaint)) {
-                return;
-            }
-            // if covers an existing one
-            if (toPaint.contains(rect)) {
-                it.remove();
-                continue;
-            }
-            WCRectangle u = rect.createUnion(toPaint);
-            // if squre of union is less than summary of squares
-            if (u.getIntWidth() * u.getIntHeight() <
-                rect.getIntWidth() * rect.getIntHeight() +
-                toPaint.getIntWidth() * toPaint.getIntHeight())
-            {
-                it.remove();
-                toPaint = u; // replace both the rects with their union
-                continue;
-            }
-        }
         dirtyRects.add(toPaint);
     }
 
@@ -293,11 +358,11 @@ public final class WebPage {
         if (clip == null) {
             clip = new WCRectangle(0, 0, width, height);
         }
-        List<WCRectangle> oldDirtyRects = dirtyRects;
-        dirtyRects = new LinkedList<>();
+        List<WCRectangle> oldDirtyRects = dirtyRects.take();
+        long traceStart = FrameTracer.isEnabled() ? System.nanoTime() : 0;
         twkPrePaint(getPage());
-        while (!oldDirtyRects.isEmpty()) {
-            WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
+        for (WCRectangle dirtyRect : oldDirtyRects) {
+            WCRectangle r = dirtyRect.intersection(clip);
             if (r.getWidth() <= 0 || r.getHeight() <= 0) {
                 continue;
             }
@@ -316,6 +381,10 @@ public final class WebPage {
                          clip.getIntWidth(), clip.getIntHeight());
             currentFrame.addRenderQueue(rq);
         }
+        if (traceStart != 0) {
+            FrameTracer.complete("paint", System.identityHashCode(this),
+                    currentFrame.frameID, traceStart, currentFrame.getSize());
+        }
 
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Dirty rects processed, dirtyRects: {0}, currentFrame: {1}",
@@ -343,7 +412,7 @@ public final class WebPage {
                 }
 
                 frameQueue.add(currentFrame);
-                currentFrame = new RenderFrame();
+                currentFrame = new RenderFrame(++renderFrameCount);
 
                 if (frameQueue.size() > MAX_FRAME_QUEUE_SIZE) {
                     paintLog.finest("Frame queue exceeded maximum "
@@ -403,15 +472,10 @@ public final class WebPage {
             // Now we have to translate "old" dirty rects that fit to the frame's
             // content as the content is already scrolled at the moment by webkit.
             if (!dirtyRects.isEmpty()) {
-                WCRectangle scrollRect = new WCRectangle(x, y, w, h);
-                for (WCRectangle r: dirtyRects) {
-                    if (scrollRect.contains(r)) {
-                        if (paintLog.isLoggable(Level.FINEST)) {
-                            paintLog.finest("translating old dirty rect by the delta: " + r);
-                        }
-                        r.translate(dx, dy);
-                    }
+                if (paintLog.isLoggable(Level.FINEST)) {
+                    paintLog.finest("translating old dirty rects by the delta: " + dirtyRects);
                 }
+                dirtyRects.translate(new WCRectangle(x, y, w, h), dx, dy);
             }
         }
 
@@ -425,11 +489,25 @@ public final class WebPage {
     // Instances of this class may not be accessed and modified concurrently
     // by multiple threads
     private static final class RenderFrame {
+        private final long frameID;
         private final List<WCRenderQueue> rqList =
                 new LinkedList<>();
         private int scrollDx, scrollDy;
         private final WCRectangle enclosingRect = new WCRectangle();
 
+        private RenderFrame(long frameID) {
+            this.frameID = frameID;
+        }
+
+        // Called on: Event thread and Main thread
+        private long getSize() {
+            long size = 0;
+            for (WCRenderQueue rq : rqList) {
+                size += rq.getSize();
+            }
+            return size;
+        }
+
         // Called on: Event thread only
         private void addRenderQueue(WCRenderQueue rq) {
             if (rq.isEmpty()) {
@@ -487,6 +565,8 @@ public final class WebPage {
     private InputMethodClient imClient;
     private final List<LoadListenerClient> loadListenerClients =
         new LinkedList<>();
+    // Read by native code, see LoadListenerClient.wantsResourceLoadEvents()
+    private boolean hasResourceLoadListeners;
     private final InspectorClient inspectorClient;
     private final RenderTheme renderTheme;
     private final ScrollBarTheme scrollbarTheme;
@@ -513,6 +593,9 @@ public final class WebPage {
     public void addLoadListenerClient(LoadListenerClient l) {
         if (!loadListenerClients.contains(l)) {
             loadListenerClients.add(l);
+            if (l.wantsResourceLoadEvents()) {
+                hasResourceLoadListeners = true;
+            }
         }
     }
 
@@ -644,7 +727,13 @@ public final class WebPage {
                 return;
             }
             updateDirty(toPaint);
+            long traceStart = FrameTracer.isEnabled() ? System.nanoTime() : 0;
             updateRendering();
+            if (traceStart != 0) {
+                // The layout and style updates feed the next frame
+                FrameTracer.complete("layout", System.identityHashCode(this),
+                        currentFrame.frameID, traceStart, -1);
+            }
         } finally {
             unlockPage();
         }
@@ -699,6 +788,54 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Lays the page out at the given size and renders it into a new
+     * offscreen image, without a scene graph or a window. The pixels can
+     * be read with {@link WCImage#getPixelBuffer}. Returns {@code null}
+     * if the page has been disposed.
+     * Must not be called on the render thread.
+     */
+    public WCImage renderToImage(final int w, final int h) {
+        if (w <= 0 || h <= 0) {
+            throw new IllegalArgumentException("image size must be positive");
+        }
+        final WCRenderQueue rq = WCGraphicsManager.getGraphicsManager().
+                createRenderQueue(new WCRectangle(0, 0, w, h), true);
+        FutureTask<Boolean> f = new FutureTask<>(() -> {
+            lockPage();
+            try {
+                if (isDisposed) {
+                    log.warning("renderToImage() called for a disposed web page.");
+                    return false;
+                }
+                if (width != w || height != h) {
+                    setBounds(0, 0, w, h);
+                }
+                twkUpdateRendering(getPage());
+                twkUpdateContent(getPage(), rq, 0, 0, w, h);
+                return true;
+            } finally {
+                unlockPage();
+            }
+        });
+        Invoker.getInvoker().invokeOnEventThread(f);
+
+        try {
+            // block until job is complete
+            if (!f.get()) {
+                rq.dispose();
+                return null;
+            }
+        } catch (ExecutionException ex) {
+            rq.dispose();
+            throw new AssertionError(ex);
+        } catch (InterruptedException ex) {
+            rq.dispose();
+            return null;
+        }
+        return WCGraphicsManager.getGraphicsManager().renderToImage(rq, w, h);
+    }
+
     /*
      * Executed on the Render Thread.
      */
@@ -743,6 +880,9 @@ public final class WebPage {
 
         for (RenderFrame frame : framesToRender) {
             paintLog.finest("Rendering: {0}", frame);
+            long traceStart = FrameTracer.isEnabled() ? System.nanoTime() : 0;
+            // Decoding disposes the render queues
+            long traceBytes = traceStart != 0 ? frame.getSize() : 0;
             for (WCRenderQueue rq : frame.getRQList()) {
                 gc.saveState();
                 WCRectangle clip = rq.getClip();
@@ -758,6 +898,10 @@ public final class WebPage {
                 rq.decode(gc);
                 gc.restoreState();
             }
+            if (traceStart != 0) {
+                FrameTracer.complete("decode", System.identityHashCode(this),
+                        frame.frameID, traceStart, traceBytes);
+            }
         }
         paintLog.finest("Exiting");
     }
@@ -1038,6 +1182,7 @@ public final class WebPage {
         try {
             log.finer("dispose");
 
+            saveVisitedLinks();
             stop();
             dropRenderFrames();
             isDisposed = true;
@@ -1877,26 +2022,80 @@ public final class WebPage {
     }
 
     public void print(final WCGraphicsContext gc, final int pageNumber, final float width) {
-        lockPage();
-        try {
-            if (isDisposed) {
-                log.warning("print() called for a disposed web page.");
+        print(gc, recordPrintPage(pageNumber, width, false));
+    }
+
+    /**
+     * Spools the given page into a render queue on the event thread.
+     * The returned future completes with {@code null} if the page is
+     * disposed before the page is recorded. Cancelling the future before
+     * the recording starts skips the recording altogether.
+     */
+    public CompletableFuture<WCRenderQueue> recordPrintPage(final int pageNumber, final float width) {
+        return recordPrintPage(pageNumber, width, true);
+    }
+
+    private CompletableFuture<WCRenderQueue> recordPrintPage(final int pageNumber,
+            final float width, final boolean deferred)
+    {
+        final CompletableFuture<WCRenderQueue> f = new CompletableFuture<>();
+        final Runnable r = () -> {
+            if (f.isCancelled()) {
                 return;
             }
-            final WCRenderQueue rq = WCGraphicsManager.getGraphicsManager().
-                    createRenderQueue(null, true);
-            final CountDownLatch l = new CountDownLatch(1);
-            Invoker.getInvoker().invokeOnEventThread(() -> {
+            lockPage();
+            try {
+                if (isDisposed) {
+                    log.warning("print() called for a disposed web page.");
+                    f.complete(null);
+                    return;
+                }
+                final WCRenderQueue rq = WCGraphicsManager.getGraphicsManager().
+                        createRenderQueue(null, true);
                 try {
                     twkPrint(getPage(), rq, pageNumber, width);
-                } finally {
-                    l.countDown();
+                } catch (Throwable ex) {
+                    rq.dispose();
+                    f.completeExceptionally(ex);
+                    return;
                 }
-            });
+                if (!f.complete(rq)) {
+                    rq.dispose();
+                }
+            } finally {
+                unlockPage();
+            }
+        };
+        if (deferred) {
+            Invoker.getInvoker().postOnEventThread(r);
+        } else {
+            Invoker.getInvoker().invokeOnEventThread(r);
+        }
+        return f;
+    }
 
-            try {
-                l.await();
-            } catch (InterruptedException e) {
+    /**
+     * Plays back a page recorded by {@link #recordPrintPage} into
+     * the given graphics context.
+     */
+    public void print(final WCGraphicsContext gc, final CompletableFuture<WCRenderQueue> page) {
+        final WCRenderQueue rq;
+        try {
+            rq = page.get();
+        } catch (InterruptedException e) {
+            disposePrintPage(page);
+            return;
+        } catch (ExecutionException | CancellationException e) {
+            log.warning("Failed to record a printed page", e);
+            return;
+        }
+        if (rq == null) {
+            return;
+        }
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.warning("print() called for a disposed web page.");
                 rq.dispose();
                 return;
             }
@@ -1906,6 +2105,20 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Releases a page recorded by {@link #recordPrintPage} that is not
+     * going to be printed.
+     */
+    public static void disposePrintPage(final CompletableFuture<WCRenderQueue> page) {
+        if (!page.cancel(false)) {
+            page.thenAccept(rq -> {
+                if (rq != null) {
+                    rq.dispose();
+                }
+            });
+        }
+    }
+
     public int getPageHeight() {
         return getFrameHeight(getMainFrame());
     }
@@ -2062,6 +2275,47 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Tells WebCore whether the view of this page is visible. Hidden pages
+     * run their DOM timers on aligned wake-ups when the
+     * {@code com.sun.webkit.throttleHiddenPageTimers} property is set, and
+     * release the memory they can rebuild when shown again when the
+     * {@code com.sun.webkit.purgeHiddenPages} property is set.
+     */
+    public void setVisible(boolean visible) {
+        if ((!THROTTLE_HIDDEN_PAGE_TIMERS && !PURGE_HIDDEN_PAGES)
+                || this.visible == visible) {
+            return;
+        }
+        lockPage();
+        try {
+            if (isDisposed) {
+                return;
+            }
+            this.visible = visible;
+            if (THROTTLE_HIDDEN_PAGE_TIMERS) {
+                twkSetVisible(getPage(), visible);
+            }
+            if (PURGE_HIDDEN_PAGES && !visible) {
+                long bytes = twkPurgeMemory(getPage());
+                purgedBytes += bytes;
+                log.fine("Purged hidden page, released " + bytes + " bytes");
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns the approximate number of bytes released so far by purging
+     * this page while its view was hidden. The figure is the drop of the
+     * process memory footprint during each purge, so it includes compiled
+     * code, which all pages share.
+     */
+    public long getPurgedBytes() {
+        return purgedBytes;
+    }
+
     public void setLocalStorageDatabasePath(String path) {
         lockPage();
         try {
@@ -2071,6 +2325,174 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Stores the IndexedDB databases of all pages in {@code dir}. Only the
+     * first call before any database is opened takes effect, and nothing is
+     * done unless the {@code com.sun.webkit.persistIndexedDB} property is set.
+     */
+    public static void setIndexedDatabaseDirectory(File dir) {
+        if (!PERSIST_INDEXED_DB) {
+            return;
+        }
+        lockPage();
+        try {
+            twkSetIndexedDatabaseDirectoryPath(dir.getPath());
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Loads the visited links stored in {@code file} into this page and
+     * appends links visited afterwards to it. Does nothing unless the
+     * {@code com.sun.webkit.persistVisitedLinks} property is set.
+     */
+    public void setVisitedLinksFile(File file) {
+        if (!PERSIST_VISITED_LINKS) {
+            return;
+        }
+        int[] hashes = new int[0];
+        if (file.isFile()) {
+            try (FileChannel channel = FileChannel.open(file.toPath(),
+                    StandardOpenOption.READ)) {
+                IntBuffer buffer = channel
+                        .map(FileChannel.MapMode.READ_ONLY, 0, channel.size())
+                        .order(ByteOrder.LITTLE_ENDIAN).asIntBuffer();
+                hashes = new int[buffer.remaining()];
+                buffer.get(hashes);
+            } catch (IOException e) {
+                log.fine("Cannot read visited links from " + file, e);
+            }
+        }
+        lockPage();
+        try {
+            visitedLinksFile = file;
+            if (hashes.length > 0) {
+                twkAddVisitedLinkHashes(getPage(), hashes);
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
+    private void saveVisitedLinks() {
+        if (visitedLinksFile == null || isDisposed) {
+            return;
+        }
+        int[] hashes = twkTakeNewVisitedLinkHashes(getPage());
+        if (hashes.length == 0) {
+            return;
+        }
+        ByteBuffer buffer = ByteBuffer.allocate(hashes.length * Integer.BYTES)
+                .order(ByteOrder.LITTLE_ENDIAN);
+        buffer.asIntBuffer().put(hashes);
+        try (FileChannel channel = FileChannel.open(visitedLinksFile.toPath(),
+                StandardOpenOption.CREATE, StandardOpenOption.WRITE,
+                StandardOpenOption.APPEND)) {
+            while (buffer.hasRemaining()) {
+                channel.write(buffer);
+            }
+        } catch (IOException e) {
+            log.fine("Cannot write visited links to " + visitedLinksFile, e);
+        }
+    }
+
+    /**
+     * Stores the bytecode of the external scripts of all pages in {@code dir},
+     * so that later runs can skip compiling scripts that did not change. Only
+     * the first call takes effect, and nothing is done unless the
+     * {@code com.sun.webkit.cacheScriptBytecode} property is set.
+     */
+    public static void setScriptBytecodeCacheDirectory(File dir) {
+        if (!CACHE_SCRIPT_BYTECODE || scriptBytecodeCacheDir != null) {
+            return;
+        }
+        if (!dir.isDirectory() && !dir.mkdirs()) {
+            log.fine("Cannot create script bytecode cache " + dir);
+            return;
+        }
+        long size = 0;
+        File[] files = dir.listFiles();
+        if (files != null) {
+            for (File file : files) {
+                size += file.length();
+            }
+        }
+        lockPage();
+        try {
+            scriptBytecodeCacheDir = dir;
+            scriptBytecodeCacheSize = size;
+            twkSetScriptBytecodeCacheEnabled(true);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    // Script bytecode is kept in one file per script URL and source hash.
+    // Entries written by another JavaScriptCore version are rejected when
+    // they are decoded, and replaced once the script is compiled again.
+    private static File scriptBytecodeFile(String url, int sourceHash) {
+        return new File(scriptBytecodeCacheDir,
+                String.format("%08x-%08x", url.hashCode(), sourceHash));
+    }
+
+    private static byte[] fwkLoadScriptBytecode(String url, int sourceHash) {
+        File file = scriptBytecodeFile(url, sourceHash);
+        if (!file.isFile()) {
+            return null;
+        }
+        try {
+            byte[] data = Files.readAllBytes(file.toPath());
+            // Keeps recently used entries when the cache is trimmed
+            file.setLastModified(System.currentTimeMillis());
+            return data;
+        } catch (IOException e) {
+            log.fine("Cannot read script bytecode from " + file, e);
+            return null;
+        }
+    }
+
+    private static void fwkStoreScriptBytecode(String url, int sourceHash, byte[] data) {
+        if (data.length > SCRIPT_BYTECODE_CACHE_LIMIT) {
+            return;
+        }
+        File file = scriptBytecodeFile(url, sourceHash);
+        scriptBytecodeCacheSize -= file.length();
+        try {
+            Files.write(file.toPath(), data);
+            scriptBytecodeCacheSize += data.length;
+        } catch (IOException e) {
+            log.fine("Cannot write script bytecode to " + file, e);
+            file.delete();
+        }
+        if (scriptBytecodeCacheSize > SCRIPT_BYTECODE_CACHE_LIMIT) {
+            trimScriptBytecodeCache();
+        }
+    }
+
+    // Deletes the least recently used entries until the cache fits its limit.
+    private static void trimScriptBytecodeCache() {
+        File[] files = scriptBytecodeCacheDir.listFiles();
+        if (files == null) {
+            return;
+        }
+        Arrays.sort(files, Comparator.comparingLong(File::lastModified));
+        long size = 0;
+        for (File file : files) {
+            size += file.length();
+        }
+        for (File file : files) {
+            if (size <= SCRIPT_BYTECODE_CACHE_LIMIT) {
+                break;
+            }
+            long length = file.length();
+            if (file.delete()) {
+                size -= length;
+            }
+        }
+        scriptBytecodeCacheSize = size;
+    }
+
     public void setLocalStorageEnabled(boolean enabled) {
         lockPage();
         try {
@@ -2392,6 +2814,11 @@ public final class WebPage {
                 ", progress = " + progress + ", error = " + errorCode);
 
         fireLoadEvent(frameID, state, url, contentType, progress, errorCode);
+
+        if (state == LoadListenerClient.PAGE_FINISHED) {
+            PageCache.releaseMemoryIfNeeded();
+            saveVisitedLinks();
+        }
     }
 
     private void fwkFireResourceLoadEvent(long frameID, int state,
@@ -2594,7 +3021,7 @@ public final class WebPage {
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useFTLJIT, boolean useCSS3D);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2716,6 +3143,13 @@ public final class WebPage {
     private native void twkSetUserAgent(long page, String userAgent);
     private native void twkSetLocalStorageDatabasePath(long page, String path);
     private native void twkSetLocalStorageEnabled(long page, boolean enabled);
+    private native void twkSetVisible(long page, boolean visible);
+    private static native void twkSetIndexedDatabaseDirectoryPath(String path);
+    private static native void twkSetIndexedDatabaseQuota(long quota);
+    private static native void twkSetScriptBytecodeCacheEnabled(boolean enabled);
+    private native void twkAddVisitedLinkHashes(long page, int[] hashes);
+    private native long twkPurgeMemory(long page);
+    private native int[] twkTakeNewVisitedLinkHashes(long page);
 
     private native int twkGetUnloadEventListenersCount(long pFrame);
 
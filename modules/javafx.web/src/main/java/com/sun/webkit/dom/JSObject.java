@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,8 @@ package com.sun.webkit.dom;
 import com.sun.webkit.Disposer;
 import com.sun.webkit.DisposerRecord;
 import com.sun.webkit.Invoker;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.concurrent.atomic.AtomicInteger;
 import netscape.javascript.JSException;
 
@@ -44,6 +46,12 @@ class JSObject extends netscape.javascript.JSObject {
     // native WebKit code the same across different release families.
     private static final Object DUMMY_ACC = new Object();
 
+    // When set, ByteBuffers passed to JavaScript become ArrayBuffers that alias
+    // direct buffer memory, and ArrayBuffers and typed arrays passed to Java
+    // become direct ByteBuffers over the JavaScript memory. Read by native code.
+    private static final boolean SHARE_BUFFERS =
+            Boolean.getBoolean("com.sun.webkit.jsobject.shareBuffers");
+
     private final long peer;     // C++ peer - now it is the DOMObject instance
     private final int peer_type; // JS_XXXX const
 
@@ -162,6 +170,31 @@ class JSObject extends netscape.javascript.JSObject {
         return ex;
     }
 
+    // Called by native code for a direct buffer over the memory of a pinned
+    // JavaScript ArrayBuffer. The ArrayBuffer is released once the buffer,
+    // including any slice or duplicate of it, is no longer reachable.
+    private static ByteBuffer fwkShareBuffer(ByteBuffer buffer, long arrayBuffer) {
+        Disposer.addRecord(buffer, new BufferDisposer(arrayBuffer));
+        return buffer.order(ByteOrder.nativeOrder());
+    }
+
+    private static native void releaseBufferImpl(long arrayBuffer);
+
+    private static final class BufferDisposer implements DisposerRecord {
+        private long arrayBuffer;
+
+        private BufferDisposer(long arrayBuffer) {
+            this.arrayBuffer = arrayBuffer;
+        }
+
+        @Override public void dispose() {
+            if (arrayBuffer != 0) {
+                JSObject.releaseBufferImpl(arrayBuffer);
+                arrayBuffer = 0;
+            }
+        }
+    }
+
     private static final class SelfDisposer implements DisposerRecord {
         long peer;
         final int peer_type;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,10 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    @Native public final static int SETFILLCOLOR_C         = 57;
+    @Native public final static int SETSTROKECOLOR_C       = 58;
+    @Native public final static int FILLRECT_SSSSC         = 59;
+    @Native public final static int FILLRECT_SSSS          = 60;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
@@ -119,6 +123,22 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         getColor(buf));
                     break;
+                case FILLRECT_SSSS:
+                    gc.fillRect(
+                        buf.getShort(),
+                        buf.getShort(),
+                        buf.getShort(),
+                        buf.getShort(),
+                        null);
+                    break;
+                case FILLRECT_SSSSC:
+                    gc.fillRect(
+                        buf.getShort(),
+                        buf.getShort(),
+                        buf.getShort(),
+                        buf.getShort(),
+                        getPackedColor(buf));
+                    break;
                 case FILL_ROUNDED_RECT:
                     gc.fillRoundedRect(
                         // base rectangle
@@ -147,6 +167,9 @@ public final class GraphicsDecoder  {
                 case SETFILLCOLOR:
                     gc.setFillColor(getColor(buf));
                     break;
+                case SETFILLCOLOR_C:
+                    gc.setFillColor(getPackedColor(buf));
+                    break;
                 case SET_TEXT_MODE:
                     gc.setTextMode(getBoolean(buf), getBoolean(buf), getBoolean(buf));
                     break;
@@ -156,14 +179,17 @@ public final class GraphicsDecoder  {
                 case SETSTROKECOLOR:
                     gc.setStrokeColor(getColor(buf));
                     break;
+                case SETSTROKECOLOR_C:
+                    gc.setStrokeColor(getPackedColor(buf));
+                    break;
                 case SETSTROKEWIDTH:
                     gc.setStrokeWidth(buf.getFloat());
                     break;
                 case SET_FILL_GRADIENT:
-                    gc.setFillGradient(getGradient(gc, buf));
+                    gc.setFillGradient((WCGradient)gm.getRef(buf.getInt()));
                     break;
                 case SET_STROKE_GRADIENT:
-                    gc.setStrokeGradient(getGradient(gc, buf));
+                    gc.setStrokeGradient((WCGradient)gm.getRef(buf.getInt()));
                     break;
                 case SET_LINE_DASH:
                     gc.setLineDash(buf.getFloat(), getFloatArray(buf));
@@ -210,7 +236,9 @@ public final class GraphicsDecoder  {
                     drawPattern(gc,
                         gm.getRef(buf.getInt()),
                         getRectangle(buf),
-                        (WCTransform)gm.getRef(buf.getInt()),
+                        new WCTransform(
+                            buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                            buf.getFloat(), buf.getFloat(), buf.getFloat()),
                         getPoint(buf),
                         getRectangle(buf));
                     break;
@@ -485,27 +513,12 @@ public final class GraphicsDecoder  {
                          buf.getFloat());
     }
 
-    private static WCGradient getGradient(WCGraphicsContext gc, ByteBuffer buf) {
-        WCPoint p1 = getPoint(buf);
-        WCPoint p2 = getPoint(buf);
-        WCGradient gradient = getBoolean(buf)
-                ? gc.createRadialGradient(p1, buf.getFloat(), p2, buf.getFloat())
-                : gc.createLinearGradient(p1, p2);
-
-        boolean proportional = getBoolean(buf);
-        int spreadMethod = buf.getInt();
-        if (gradient != null) {
-            gradient.setProportional(proportional);
-            gradient.setSpreadMethod(spreadMethod);
-        }
-        int count = buf.getInt();
-        for (int i = 0; i < count; i++) {
-            Color color = getColor(buf);
-            float offset = buf.getFloat();
-            if (gradient != null) {
-                gradient.addStop(color, offset);
-            }
-        }
-        return gradient;
+    /* RGBA components packed into an int, 8 bits each */
+    private static Color getPackedColor(ByteBuffer buf) {
+        int rgba = buf.getInt();
+        return new Color(((rgba >>> 24) & 0xff) / 255f,
+                         ((rgba >>> 16) & 0xff) / 255f,
+                         ((rgba >>> 8) & 0xff) / 255f,
+                         (rgba & 0xff) / 255f);
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -58,4 +58,21 @@ public class Ref {
     public int getID() {
         return id;
     }
+
+    // Called from native code that keeps only the handle of this object
+    private synchronized int fwkAcquire() {
+        ref();
+        return id;
+    }
+
+    private static void fwkRelease(int id) {
+        Ref ref = WCGraphicsManager.getGraphicsManager().getRef(id);
+        if (ref != null) {
+            ref.deref();
+        }
+    }
+
+    private static Ref fwkGetRef(int id) {
+        return WCGraphicsManager.getGraphicsManager().getRef(id);
+    }
 }
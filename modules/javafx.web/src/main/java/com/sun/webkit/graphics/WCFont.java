@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,22 +25,142 @@
 
 package com.sun.webkit.graphics;
 
+import java.lang.annotation.Native;
+
 public abstract class WCFont extends Ref {
 
+    // Layout of the array returned by getPackedTextRuns()
+    @Native public final static int TEXT_RUN_HEADER_SIZE = 4;
+    @Native public final static int TEXT_RUN_GLYPH_SIZE  = 5;
+
+    // Indices in the array returned by getFontMetrics()
+    @Native public final static int METRICS_X_HEIGHT     = 0;
+    @Native public final static int METRICS_CAP_HEIGHT   = 1;
+    @Native public final static int METRICS_ASCENT       = 2;
+    @Native public final static int METRICS_DESCENT      = 3;
+    @Native public final static int METRICS_LINE_SPACING = 4;
+    @Native public final static int METRICS_LINE_GAP     = 5;
+    @Native public final static int METRICS_COUNT        = 6;
+
+    // Indices in the array returned by getTextRunCacheCounters()
+    public final static int TEXT_RUN_CACHE_HIT_COUNT  = 0;
+    public final static int TEXT_RUN_CACHE_MISS_COUNT = 1;
+    public final static int TEXT_RUN_CACHE_SIZE       = 2;
+
+    /**
+     * Returns the hit and miss counts of the native cache of shaped
+     * text runs and the number of bytes it currently holds.
+     */
+    public static long[] getTextRunCacheCounters() {
+        return twkGetTextRunCacheCounters();
+    }
+
+    /**
+     * Sets the memory cap of the native cache of shaped text runs,
+     * in bytes. Zero disables the cache.
+     */
+    public static void setTextRunCacheCapacity(int capacity) {
+        twkSetTextRunCacheCapacity(capacity);
+    }
+
+    private static native long[] twkGetTextRunCacheCounters();
+    private static native void twkSetTextRunCacheCapacity(int capacity);
+
     public abstract Object getPlatformFont();
 
     public abstract WCFont deriveFont(float size);
 
     public abstract WCTextRun[] getTextRuns(String str);
 
+    /**
+     * Returns the text runs of {@code str} packed in one array, so that
+     * the native side can read a whole layout with a single call.
+     * The array starts with the number of runs. Each run consists of
+     * {@link #TEXT_RUN_HEADER_SIZE} ints (left-to-right flag, start, end,
+     * glyph count), followed by {@link #TEXT_RUN_GLYPH_SIZE} ints per
+     * glyph (glyph code, char offset and the raw bits of the x position,
+     * y position and advance floats).
+     * NB: This method is called from native code!
+     *
+     * @return the packed runs, or {@code null} if there is no layout
+     */
+    public int[] getPackedTextRuns(String str) {
+        WCTextRun[] runs = getTextRuns(str);
+        if (runs == null) {
+            return null;
+        }
+        int size = 1;
+        for (WCTextRun run : runs) {
+            size += TEXT_RUN_HEADER_SIZE + run.getGlyphCount() * TEXT_RUN_GLYPH_SIZE;
+        }
+        int[] data = new int[size];
+        int pos = 0;
+        data[pos++] = runs.length;
+        for (WCTextRun run : runs) {
+            int glyphCount = run.getGlyphCount();
+            data[pos++] = run.isLeftToRight() ? 1 : 0;
+            data[pos++] = run.getStart();
+            data[pos++] = run.getEnd();
+            data[pos++] = glyphCount;
+            for (int i = 0; i < glyphCount; i++) {
+                float[] posAndAdvance = run.getGlyphPosAndAdvance(i);
+                data[pos++] = run.getGlyph(i);
+                data[pos++] = run.getCharOffset(i);
+                data[pos++] = Float.floatToRawIntBits(posAndAdvance[0]);
+                data[pos++] = Float.floatToRawIntBits(posAndAdvance[1]);
+                data[pos++] = Float.floatToRawIntBits(posAndAdvance[2]);
+            }
+        }
+        return data;
+    }
+
     public abstract int[] getGlyphCodes(char[] chars);
 
+    /**
+     * Returns an identifier shared by all fonts that map characters to
+     * the same glyph codes, such as the sizes derived from one font face,
+     * so that the native side can reuse the glyph pages it has already
+     * filled for that face. Identifiers are never reused.
+     * NB: This method is called from native code!
+     *
+     * @return a positive identifier, or 0 if the glyph codes of
+     *         this font must not be shared
+     */
+    public abstract int getGlyphMapperID();
+
     public abstract float getXHeight();
 
     public abstract double getGlyphWidth(int glyph);
 
     public abstract float[] getGlyphBoundingBox(int glyph);
 
+    /**
+     * Returns the advances of {@code count} consecutive glyphs
+     * starting with {@code firstGlyph}.
+     * NB: This method is called from native code!
+     */
+    public float[] getGlyphWidths(int firstGlyph, int count) {
+        float[] widths = new float[count];
+        for (int i = 0; i < count; i++) {
+            widths[i] = (float) getGlyphWidth(firstGlyph + i);
+        }
+        return widths;
+    }
+
+    /**
+     * Returns the bounding boxes of {@code count} consecutive glyphs
+     * starting with {@code firstGlyph}, packed as {@code x, y, width,
+     * height} for each glyph.
+     * NB: This method is called from native code!
+     */
+    public float[] getGlyphBoundingBoxes(int firstGlyph, int count) {
+        float[] boxes = new float[count * 4];
+        for (int i = 0; i < count; i++) {
+            System.arraycopy(getGlyphBoundingBox(firstGlyph + i), 0, boxes, i * 4, 4);
+        }
+        return boxes;
+    }
+
     /**
      * Returns a hash code value for the object.
      * NB: This method is called from native code!
@@ -88,4 +208,21 @@ public abstract class WCFont extends Ref {
     public abstract boolean hasUniformLineMetrics();
 
     public abstract float getCapHeight();
+
+    /**
+     * Returns the metrics of this font, indexed by the
+     * {@code METRICS_*} constants, so that the native side can
+     * initialize a font with a single call.
+     * NB: This method is called from native code!
+     */
+    public float[] getFontMetrics() {
+        float[] metrics = new float[METRICS_COUNT];
+        metrics[METRICS_X_HEIGHT] = getXHeight();
+        metrics[METRICS_CAP_HEIGHT] = getCapHeight();
+        metrics[METRICS_ASCENT] = getAscent();
+        metrics[METRICS_DESCENT] = getDescent();
+        metrics[METRICS_LINE_SPACING] = getLineSpacing();
+        metrics[METRICS_LINE_GAP] = getLineGap();
+        return metrics;
+    }
 }
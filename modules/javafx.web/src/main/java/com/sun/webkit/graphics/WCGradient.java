@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,7 +27,7 @@ package com.sun.webkit.graphics;
 
 import com.sun.prism.paint.Color;
 
-public abstract class WCGradient<G> {
+public abstract class WCGradient<G> extends Ref {
 
     /* The GradientSpreadMethod should be compliant with
      * WebCore/platform/graphics/GraphicsTypes.h
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.webkit.graphics;
 
 import com.sun.javafx.logging.PlatformLogger;
+import com.sun.prism.paint.Color;
 import com.sun.webkit.SharedBuffer;
 import com.sun.webkit.SimpleSharedBufferInputStream;
 import java.io.IOException;
@@ -90,10 +91,47 @@ public abstract class WCGraphicsManager {
 
     protected abstract WCPath createWCPath(WCPath path);
 
+    protected abstract WCGradient createLinearGradient(WCPoint p1, WCPoint p2);
+
+    protected abstract WCGradient createRadialGradient(WCPoint p1, float r1,
+                                                       WCPoint p2, float r2);
+
+    /*
+     * Creates the gradient that WebCore keeps for a Gradient between
+     * paints. Each stop takes five elements of the stops array: the
+     * r, g, b, a color components and the offset.
+     */
+    private WCGradient fwkCreateGradient(boolean radial,
+            float x1, float y1, float r1, float x2, float y2, float r2,
+            int spreadMethod, float[] stops)
+    {
+        WCPoint p1 = new WCPoint(x1, y1);
+        WCPoint p2 = new WCPoint(x2, y2);
+        WCGradient gradient = radial
+                ? createRadialGradient(p1, r1, p2, r2)
+                : createLinearGradient(p1, p2);
+        if (gradient != null) {
+            gradient.setProportional(false);
+            gradient.setSpreadMethod(spreadMethod);
+            for (int i = 0; i + 4 < stops.length; i += 5) {
+                gradient.addStop(new Color(stops[i], stops[i + 1],
+                                           stops[i + 2], stops[i + 3]),
+                                 stops[i + 4]);
+            }
+        }
+        return gradient;
+    }
+
     protected abstract WCImage createWCImage(int w, int h);
 
     protected abstract WCImage createRTImage(int w, int h);
 
+    /*
+     * Plays the render queue back into a new offscreen image of the given
+     * size. Blocks until the image has been rendered.
+     */
+    public abstract WCImage renderToImage(WCRenderQueue rq, int w, int h);
+
     public abstract WCImage getIconImage(String iconURL);
 
     public abstract Object toPlatformImage(WCImage image);
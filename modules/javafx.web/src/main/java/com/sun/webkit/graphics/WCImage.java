@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,6 +52,16 @@ public abstract class WCImage extends Ref {
 
     public ByteBuffer getPixelBuffer() {return null;}
 
+    /**
+     * Reads the given region of the image into {@code pixels} as
+     * premultiplied BGRA rows of {@code width * 4} bytes. Returns
+     * {@code false} if the region was not read, in which case the caller
+     * should use {@link #getPixelBuffer()}.
+     */
+    public boolean readPixels(ByteBuffer pixels, int x, int y, int width, int height) {
+        return false;
+    }
+
     protected void drawPixelBuffer() {}
 
     public synchronized void setRQ(WCRenderQueue rq) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.webkit.graphics;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.Invoker;
+import java.util.concurrent.atomic.AtomicBoolean;
 
 public abstract class WCMediaPlayer extends Ref {
 
@@ -72,6 +73,15 @@ public abstract class WCMediaPlayer extends Ref {
 
     protected abstract void renderCurrentFrame(WCGraphicsContext gc, int x, int y, int w, int h);
 
+    /**
+     * Returns an image of the current frame that stays valid when the
+     * player moves on, or {@code null} if there is no frame yet. The image
+     * holds on to the frame until it is disposed.
+     */
+    protected WCImage getCurrentFrameImage() {
+        return null;
+    }
+
     /**
      * Obtains current "preserves pitch" value.
      */
@@ -224,14 +234,21 @@ public abstract class WCMediaPlayer extends Ref {
         });
     }
 
+    // set while a new frame notification is queued to the event thread;
+    // frames arriving meanwhile are covered by that notification
+    private final AtomicBoolean newFramePending = new AtomicBoolean();
+
     private Runnable newFrameNotifier = () -> {
+        newFramePending.set(false);
         if (nPtr != 0) {
             notifyNewFrame(nPtr);
         }
     };
 
     protected void notifyNewFrame() {
-        Invoker.getInvoker().invokeOnEventThread(newFrameNotifier);
+        if (newFramePending.compareAndSet(false, true)) {
+            Invoker.getInvoker().invokeOnEventThread(newFrameNotifier);
+        }
     }
 
     /** {@code ranges} array contains pairs [start,end] of the buffered times */
@@ -333,6 +350,11 @@ public abstract class WCMediaPlayer extends Ref {
         this.preload = preload;
     }
 
+    private WCImage fwkGetCurrentFrameImage() {
+        log.finer("fwkGetCurrentFrameImage");
+        return getCurrentFrameImage();
+    }
+
     /* called from GraphicsDecoder */
     void render(WCGraphicsContext gc, int x, int y, int w, int h) {
         log.finer("render(x={0}, y={1}, w={2}, h={3}", new Object[]{x, y, w, h});
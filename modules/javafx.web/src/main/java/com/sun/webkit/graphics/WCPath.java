@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,6 +53,20 @@ public abstract class WCPath<P> extends Ref {
      */
     @Native public static final int RULE_EVENODD = 1;
 
+    /* The segment types of addSegments(), each followed by the number of
+     * coordinates it takes.
+     */
+    @Native public static final int SEGMENT_MOVE_TO = 0;         // 2
+    @Native public static final int SEGMENT_LINE_TO = 1;         // 2
+    @Native public static final int SEGMENT_QUAD_CURVE_TO = 2;   // 4
+    @Native public static final int SEGMENT_BEZIER_CURVE_TO = 3; // 6
+    @Native public static final int SEGMENT_ARC_TO = 4;          // 5
+    @Native public static final int SEGMENT_ARC = 5;             // 6, the last one is non-zero if anticlockwise
+    @Native public static final int SEGMENT_ELLIPSE = 6;         // 4
+    @Native public static final int SEGMENT_RECT = 7;            // 4
+    @Native public static final int SEGMENT_CLOSE_SUBPATH = 8;   // 0
+    @Native public static final int SEGMENT_TRANSFORM = 9;       // 6
+
     public abstract void addRect(double x, double y, double w, double h);
 
     public abstract void addEllipse(double x, double y, double w, double h);
@@ -98,6 +112,67 @@ public abstract class WCPath<P> extends Ref {
 
     public abstract WCPathIterator getPathIterator();
 
+    /**
+     * Appends the segments recorded by the native path since its last update.
+     */
+    public void addSegments(int[] types, double[] coords) {
+        int i = 0;
+        for (int type : types) {
+            switch (type) {
+                case SEGMENT_MOVE_TO:
+                    moveTo(coords[i], coords[i + 1]);
+                    i += 2;
+                    break;
+                case SEGMENT_LINE_TO:
+                    addLineTo(coords[i], coords[i + 1]);
+                    i += 2;
+                    break;
+                case SEGMENT_QUAD_CURVE_TO:
+                    addQuadCurveTo(coords[i], coords[i + 1],
+                                   coords[i + 2], coords[i + 3]);
+                    i += 4;
+                    break;
+                case SEGMENT_BEZIER_CURVE_TO:
+                    addBezierCurveTo(coords[i], coords[i + 1],
+                                     coords[i + 2], coords[i + 3],
+                                     coords[i + 4], coords[i + 5]);
+                    i += 6;
+                    break;
+                case SEGMENT_ARC_TO:
+                    addArcTo(coords[i], coords[i + 1],
+                             coords[i + 2], coords[i + 3], coords[i + 4]);
+                    i += 5;
+                    break;
+                case SEGMENT_ARC:
+                    addArc(coords[i], coords[i + 1], coords[i + 2],
+                           coords[i + 3], coords[i + 4], coords[i + 5] != 0);
+                    i += 6;
+                    break;
+                case SEGMENT_ELLIPSE:
+                    addEllipse(coords[i], coords[i + 1],
+                               coords[i + 2], coords[i + 3]);
+                    i += 4;
+                    break;
+                case SEGMENT_RECT:
+                    addRect(coords[i], coords[i + 1],
+                            coords[i + 2], coords[i + 3]);
+                    i += 4;
+                    break;
+                case SEGMENT_CLOSE_SUBPATH:
+                    closeSubpath();
+                    break;
+                case SEGMENT_TRANSFORM:
+                    transform(coords[i], coords[i + 1], coords[i + 2],
+                              coords[i + 3], coords[i + 4], coords[i + 5]);
+                    i += 6;
+                    break;
+                default:
+                    throw new IllegalArgumentException(
+                            "Unknown path segment type: " + type);
+            }
+        }
+    }
+
     public abstract boolean strokeContains(double x, double y,
                                            double thickness, double miterLimit,
                                            int cap, int join, double dashOffset,
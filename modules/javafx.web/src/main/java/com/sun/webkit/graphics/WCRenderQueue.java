@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,11 @@ public abstract class WCRenderQueue extends Ref {
             PlatformLogger.getLogger(WCRenderQueue.class.getName());
     @Native public final static int MAX_QUEUE_SIZE = 0x80000;
 
+    // Indices in the array returned by getBufferPoolCounters()
+    public final static int POOL_HIT_COUNT = 0;
+    public final static int POOL_MISS_COUNT = 1;
+    public final static int POOL_FREE_COUNT = 2;
+
     private final LinkedList<BufferData> buffers = new LinkedList<>();
     private BufferData currentBuffer = new BufferData();
     private final WCRectangle clip;
@@ -66,14 +71,28 @@ public abstract class WCRenderQueue extends Ref {
     }
 
     public synchronized void addBuffer(ByteBuffer buffer) {
+        addBuffers(new ByteBuffer[] { buffer });
+    }
+
+    /**
+     * Adds a chain of buffers recorded one after another. The buffers
+     * share the data referenced (see {@link #refString}) while they were
+     * being filled.
+     */
+    public synchronized void addBuffers(ByteBuffer[] bufs) {
         if (log.isLoggable(Level.FINE) && buffers.isEmpty()) {
             log.fine("'{'WCRenderQueue{0}[{1}]",
                     new Object[]{hashCode(), idCountObj.incrementAndGet()});
         }
-        currentBuffer.setBuffer(buffer);
-        buffers.addLast(currentBuffer);
+        for (int i = 0; i < bufs.length; i++) {
+            BufferData bdata = (i == bufs.length - 1)
+                    ? currentBuffer
+                    : currentBuffer.share();
+            bdata.setBuffer(bufs[i]);
+            buffers.addLast(bdata);
+            size += bufs[i].capacity();
+        }
         currentBuffer = new BufferData();
-        size += buffer.capacity();
         if (size > MAX_QUEUE_SIZE && gc!=null) {
             // It is isolated queue over the canvas image [image-gc!=null].
             // We need to flush the changes periodically
@@ -123,12 +142,11 @@ public abstract class WCRenderQueue extends Ref {
 
     protected abstract void flush();
 
-    private void fwkFlush() {
-        flush();
-    }
-
-    private void fwkAddBuffer(ByteBuffer buffer) {
-        addBuffer(buffer);
+    private void fwkAddBuffers(ByteBuffer[] bufs, boolean flush) {
+        addBuffers(bufs);
+        if (flush) {
+            flush();
+        }
     }
 
     public WCRectangle getClip() {
@@ -163,6 +181,19 @@ public abstract class WCRenderQueue extends Ref {
 
     private native void twkRelease(Object[] bufs);
 
+    /**
+     * Returns the counters of the native pool the released buffers
+     * are returned to: the number of buffer requests served from the pool,
+     * the number of requests that allocated a new buffer and the number of
+     * buffers currently kept in the pool.
+     * Must be called on the Event thread.
+     */
+    public static long[] getBufferPoolCounters() {
+        return twkGetBufferPoolCounters();
+    }
+
+    private static native long[] twkGetBufferPoolCounters();
+
     /*is called from native*/
     private int refString(String str) {
         return currentBuffer.addString(str);
@@ -193,16 +224,32 @@ public abstract class WCRenderQueue extends Ref {
 
 final class BufferData {
     /* For passing data that does not fit into the queue */
-    private final AtomicInteger idCount = new AtomicInteger(0);
-    private final HashMap<Integer,String> strMap =
-            new HashMap<>();
-    private final HashMap<Integer,int[]> intArrMap =
-            new HashMap<>();
-    private final HashMap<Integer,float[]> floatArrMap =
-            new HashMap<>();
+    private final AtomicInteger idCount;
+    private final HashMap<Integer,String> strMap;
+    private final HashMap<Integer,int[]> intArrMap;
+    private final HashMap<Integer,float[]> floatArrMap;
 
     private ByteBuffer buffer;
 
+    BufferData() {
+        idCount = new AtomicInteger(0);
+        strMap = new HashMap<>();
+        intArrMap = new HashMap<>();
+        floatArrMap = new HashMap<>();
+    }
+
+    private BufferData(BufferData other) {
+        idCount = other.idCount;
+        strMap = other.strMap;
+        intArrMap = other.intArrMap;
+        floatArrMap = other.floatArrMap;
+    }
+
+    /* Creates a BufferData with the same referenced data */
+    BufferData share() {
+        return new BufferData(this);
+    }
+
     private int createID() {
         return idCount.incrementAndGet();
     }
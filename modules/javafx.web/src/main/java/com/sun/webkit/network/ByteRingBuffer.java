@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.network;
+
+import java.nio.ByteBuffer;
+
+/**
+ * A fixed-size ring of bytes held in a direct buffer, filled by a single
+ * producer thread and drained by a single consumer thread.
+ *
+ * The consumer is handed slices of the backing buffer itself, so native
+ * code can read the bytes in place. A slice stays valid until the consumer
+ * returns from it. The producer blocks while the ring is full, and a drain
+ * is requested only when data arrives with no drain already pending, so a
+ * burst of writes costs one notification.
+ */
+final class ByteRingBuffer {
+
+    interface SliceConsumer {
+        void accept(ByteBuffer buffer, int offset, int length);
+    }
+
+    private final ByteBuffer buffer;
+    private final Runnable drainRequest;
+    private int readPosition;
+    private int count;
+    private boolean drainPending;
+    private boolean closed;
+
+    ByteRingBuffer(int capacity, Runnable drainRequest) {
+        if (capacity <= 0) {
+            throw new IllegalArgumentException("capacity: " + capacity);
+        }
+        this.buffer = ByteBuffer.allocateDirect(capacity);
+        this.drainRequest = drainRequest;
+    }
+
+    int capacity() {
+        return buffer.capacity();
+    }
+
+    synchronized int size() {
+        return count;
+    }
+
+    synchronized boolean isClosed() {
+        return closed;
+    }
+
+    /**
+     * Copies bytes into the ring, waiting for the consumer to make room
+     * as needed. Returns {@code false} if the ring was closed meanwhile,
+     * in which case the remaining bytes are discarded.
+     */
+    synchronized boolean write(byte[] src, int offset, int length)
+            throws InterruptedException
+    {
+        int capacity = buffer.capacity();
+        while (length > 0) {
+            while (count == capacity && !closed) {
+                wait();
+            }
+            if (closed) {
+                return false;
+            }
+            int writePosition = (readPosition + count) % capacity;
+            int n = Math.min(length, Math.min(capacity - count,
+                                              capacity - writePosition));
+            buffer.put(writePosition, src, offset, n);
+            count += n;
+            offset += n;
+            length -= n;
+            if (!drainPending) {
+                drainPending = true;
+                drainRequest.run();
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Hands all buffered bytes to {@code consumer}, at most two slices per
+     * turn of the ring, and releases each slice once it has been consumed.
+     */
+    void drain(SliceConsumer consumer) {
+        int capacity = buffer.capacity();
+        while (true) {
+            int offset;
+            int length;
+            synchronized (this) {
+                if (count == 0 || closed) {
+                    drainPending = false;
+                    return;
+                }
+                offset = readPosition;
+                length = Math.min(count, capacity - readPosition);
+            }
+            consumer.accept(buffer, offset, length);
+            synchronized (this) {
+                if (closed) {
+                    drainPending = false;
+                    return;
+                }
+                readPosition = (readPosition + length) % capacity;
+                count -= length;
+                notifyAll();
+            }
+        }
+    }
+
+    /**
+     * Discards the buffered bytes and wakes up a waiting producer.
+     */
+    synchronized void close() {
+        closed = true;
+        count = 0;
+        notifyAll();
+    }
+
+    @Override
+    public synchronized String toString() {
+        return "ByteRingBuffer{capacity=" + buffer.capacity()
+                + ", size=" + count + ", closed=" + closed + "}";
+    }
+}
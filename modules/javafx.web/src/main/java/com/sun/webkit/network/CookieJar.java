@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,11 +36,50 @@ import java.util.Map;
 
 final class CookieJar {
 
+    /**
+     * The cookie manager that keeps the native cookie cache up to date,
+     * if it is the default cookie handler.
+     */
+    private static CookieManager observedManager;
+
     private CookieJar() {
     }
 
+    /**
+     * Lets the native side cache cookie strings for as long as the default
+     * cookie handler is a {@code CookieManager}, which reports all of its
+     * changes. Caching is disabled for any other handler.
+     */
+    private static void observe(CookieHandler handler) {
+        CookieManager manager = handler instanceof CookieManager
+                ? (CookieManager) handler : null;
+        CookieManager previous;
+        synchronized (CookieJar.class) {
+            previous = observedManager;
+            if (previous == manager) {
+                return;
+            }
+            observedManager = manager;
+        }
+        if (previous != null) {
+            previous.setChangeListener(null);
+        }
+        if (manager != null) {
+            manager.setChangeListener(CookieJar::twkCookiesChanged);
+        } else {
+            twkCookiesChanged(0);
+        }
+    }
+
+    /**
+     * Invalidates the native cookie cache. Cookie strings may be cached
+     * until {@code validUntil}, the earliest time a stored cookie expires.
+     */
+    private static native void twkCookiesChanged(long validUntil);
+
     private static void fwkPut(String url, String cookie) {
         CookieHandler handler = CookieHandler.getDefault();
+        observe(handler);
         if (handler != null) {
             URI uri = null;
             try {
@@ -63,6 +102,7 @@ final class CookieJar {
 
     private static String fwkGet(String url, boolean includeHttpOnlyCookies) {
         CookieHandler handler = CookieHandler.getDefault();
+        observe(handler);
         if (handler != null) {
             URI uri = null;
             try {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,7 @@ import java.util.HashMap;
 import java.util.List;
 import java.util.ListIterator;
 import java.util.Map;
+import java.util.function.LongConsumer;
 
 /**
  * An RFC 6265-compliant cookie handler.
@@ -48,6 +49,12 @@ public final class CookieManager extends CookieHandler {
 
     private final CookieStore store = new CookieStore();
 
+    /**
+     * The listener notified whenever the stored cookies may have changed.
+     * It is passed the earliest expiry time of the stored cookies.
+     */
+    private volatile LongConsumer changeListener;
+
 
     /**
      * Creates a new {@code CookieManager}.
@@ -143,12 +150,14 @@ public final class CookieManager extends CookieHandler {
             throw new IllegalArgumentException("responseHeaders is null");
         }
 
+        boolean changed = false;
         for (Map.Entry<String,List<String>> entry : responseHeaders.entrySet())
         {
             String key = entry.getKey();
             if (!"Set-Cookie".equalsIgnoreCase(key)) {
                 continue;
             }
+            changed = true;
             ExtendedTime currentTime = ExtendedTime.currentTime();
             // JDK-8118580: Process the list of headers in reverse order,
             // effectively restoring the order in which the headers were
@@ -164,6 +173,29 @@ public final class CookieManager extends CookieHandler {
                 }
             }
         }
+        if (changed) {
+            notifyChangeListener();
+        }
+    }
+
+    /**
+     * Sets the listener notified whenever the stored cookies may have
+     * changed, and notifies it right away.
+     */
+    void setChangeListener(LongConsumer listener) {
+        changeListener = listener;
+        notifyChangeListener();
+    }
+
+    private void notifyChangeListener() {
+        LongConsumer listener = changeListener;
+        if (listener != null) {
+            long earliestExpiryTime;
+            synchronized (store) {
+                earliestExpiryTime = store.getEarliestExpiryTime();
+            }
+            listener.accept(earliestExpiryTime);
+        }
     }
 
     /**
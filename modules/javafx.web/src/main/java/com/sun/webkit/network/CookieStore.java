@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -223,6 +223,20 @@ final class CookieStore {
         }
     }
 
+    /**
+     * Returns the earliest expiry time of the stored cookies, or
+     * {@code Long.MAX_VALUE} if none of them expires.
+     */
+    long getEarliestExpiryTime() {
+        long result = Long.MAX_VALUE;
+        for (Map<Cookie,Cookie> bucket : buckets.values()) {
+            for (Cookie cookie : bucket.values()) {
+                result = Math.min(result, cookie.getExpiryTime());
+            }
+        }
+        return result;
+    }
+
     /**
      * Removes excess cookies from a given bucket.
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,7 @@ final class HTTP2Loader extends URLLoaderBase {
     private FormDataElement[] formDataElements;
     private final long data;
     private volatile boolean canceled = false;
+    private volatile HttpCache.Writer cacheWriter;
 
     private final CompletableFuture<Void> response;
     // Use singleton instance of HttpClient to get the maximum benefits
@@ -93,15 +94,6 @@ final class HTTP2Loader extends URLLoaderBase {
                 .connectTimeout(Duration.ofSeconds(30)) // FIXME: Add a property to control the timeout
                 .cookieHandler(CookieHandler.getDefault())
                 .build();
-    // Singleton instance of direct ByteBuffer to transfer downloaded bytes from
-    // Java to native
-    private static final int DEFAULT_BUFSIZE = 40 * 1024;
-    private final static ByteBuffer BUFFER;
-    static {
-       int bufSize  = Integer.valueOf(System.getProperty("jdk.httpclient.bufsize", Integer.toString(DEFAULT_BUFSIZE)));
-       BUFFER = ByteBuffer.allocateDirect(bufSize);
-    }
-
     /**
      * Creates a new {@code HTTP2Loader}.
      */
@@ -266,9 +258,11 @@ final class HTTP2Loader extends URLLoaderBase {
                     final byte[] buf = new byte[8 * 1024];
                     final int read = in.read(buf);
                     if (read < 0) {
+                        commitCacheEntry();
                         didFinishLoading();
                         break;
                     }
+                    writeCacheEntry(List.of(ByteBuffer.wrap(buf, 0, read)));
                     didReceiveData(buf, read);
                 }
             } catch (IOException ex) {
@@ -311,14 +305,18 @@ final class HTTP2Loader extends URLLoaderBase {
 
             @Override
             public void onComplete() {
+                commitCacheEntry();
                 didFinishLoading();
             }
 
             @Override
-            public void onError(Throwable th) {}
+            public void onError(Throwable th) {
+                abortCacheEntry();
+            }
 
             @Override
             public void onNext(final List<ByteBuffer> bytes) {
+                writeCacheEntry(bytes);
                 didReceiveData(bytes);
                 requestIfNotCancelled();
             }
@@ -375,17 +373,44 @@ final class HTTP2Loader extends URLLoaderBase {
             return;
         }
 
-        final var request = HttpRequest.newBuilder()
+        final HttpCache cache =
+                HttpCache.isCacheableRequest(method, formDataElements, headers)
+                ? HttpCache.getInstance() : null;
+        final HttpCache.Entry cached = cache != null ? cache.get(url) : null;
+        if (cached != null && cached.isFresh() && !HttpCache.requiresValidation(headers)) {
+            HttpCache.countHit();
+            this.response = CompletableFuture.runAsync(() -> didLoadFromCache(cached));
+            if (!asynchronous) {
+                waitForRequestToComplete();
+            }
+            return;
+        }
+
+        final var requestBuilder = HttpRequest.newBuilder()
                                .uri(uri)
                                .headers(getRequestHeaders()) // headers from WebCore
                                .headers(getCustomHeaders()) // headers set by us
                                .version(Version.HTTP_2)  // this is the default
-                               .method(method, getFormDataPublisher())
-                               .build();
+                               .method(method, getFormDataPublisher());
+        if (cached != null) {
+            cached.addValidators(requestBuilder);
+        }
+        final var request = requestBuilder.build();
 
         final BodyHandler<Void> bodyHandler = rsp -> {
+            if (cached != null && rsp.statusCode() == 304) {
+                HttpCache.countHit();
+                cache.refresh(cached, rsp.headers());
+                didLoadFromCache(cached);
+                return BodySubscribers.discarding();
+            }
             if(!handleRedirectionIfNeeded(rsp)) {
                 didReceiveResponse(rsp);
+                if (cache != null) {
+                    HttpCache.countMiss();
+                    cacheWriter = cache.newWriter(url, rsp.statusCode(),
+                            getContentType(rsp), getHeadersAsString(rsp), rsp.headers());
+                }
             }
             return getBodySubscriber(getContentEncoding(rsp));
         };
@@ -408,6 +433,7 @@ final class HTTP2Loader extends URLLoaderBase {
             logger.finest(String.format("data: [0x%016X]", data));
         }
         canceled = true;
+        abortCacheEntry();
     }
 
     private void callBackIfNotCanceled(final Runnable r) {
@@ -497,32 +523,66 @@ final class HTTP2Loader extends URLLoaderBase {
         });
     }
 
-    private ByteBuffer getDirectBuffer(int size) {
-        ByteBuffer dbb = BUFFER;
-        // Though the chance of reaching here is rare, handle the
-        // case by allocating a tmp direct buffer.
-        if (size > dbb.capacity()) {
-            dbb = ByteBuffer.allocateDirect(size);
+    private void didLoadFromCache(final HttpCache.Entry entry) {
+        final ByteBuffer body = entry.getBody();
+        callBackIfNotCanceled(() -> {
+            twkDidReceiveResponse(
+                    entry.getStatus(),
+                    entry.getContentType(),
+                    "",
+                    body.remaining(),
+                    entry.getHeaders(),
+                    this.url,
+                    data);
+            if (body.hasRemaining()) {
+                notifyDidReceiveData(twkAllocateDataSegment(body.remaining()).put(body).flip());
+            }
+            notifyDidFinishLoading();
+        });
+    }
+
+    private void writeCacheEntry(final List<ByteBuffer> bytes) {
+        final HttpCache.Writer writer = cacheWriter;
+        if (writer != null) {
+            writer.write(bytes);
         }
-        return dbb.clear();
     }
 
-    private ByteBuffer copyToDirectBuffer(final ByteBuffer bb) {
-        return getDirectBuffer(bb.limit()).put(bb).flip();
+    private void commitCacheEntry() {
+        final HttpCache.Writer writer = cacheWriter;
+        if (writer != null) {
+            writer.commit();
+        }
     }
 
+    private void abortCacheEntry() {
+        final HttpCache.Writer writer = cacheWriter;
+        if (writer != null) {
+            writer.abort();
+        }
+    }
+
+    // Downloaded bytes are written straight into a native data segment
+    // that WebCore adopts as is, so they are only copied once on their
+    // way from the HttpClient to the resource loader.
+
     // another variant to use from createZIPEncodedBodySubscriber
     private void didReceiveData(final byte[] bytes, int size) {
         callBackIfNotCanceled(() -> {
-            notifyDidReceiveData(getDirectBuffer(size).put(bytes, 0, size).flip());
+            notifyDidReceiveData(twkAllocateDataSegment(size).put(bytes, 0, size).flip());
         });
     }
 
     private void didReceiveData(final List<ByteBuffer> bytes) {
-        callBackIfNotCanceled(() -> bytes.stream()
-                                          .map(this::copyToDirectBuffer)
-                                          .forEach(this::notifyDidReceiveData)
-        );
+        callBackIfNotCanceled(() -> {
+            final int size = bytes.stream().mapToInt(ByteBuffer::remaining).sum();
+            if (size == 0) {
+                return;
+            }
+            final ByteBuffer segment = twkAllocateDataSegment(size);
+            bytes.forEach(segment::put);
+            notifyDidReceiveData(segment.flip());
+        });
     }
 
     private void notifyDidReceiveData(ByteBuffer byteBuffer) {
@@ -538,7 +598,7 @@ final class HTTP2Loader extends URLLoaderBase {
                     byteBuffer.remaining(),
                     data));
         }
-        twkDidReceiveData(byteBuffer, byteBuffer.position(), byteBuffer.remaining(), data);
+        twkDidReceiveDataSegment(byteBuffer, byteBuffer.remaining(), data);
     }
 
     private void didFinishLoading() {
@@ -555,6 +615,7 @@ final class HTTP2Loader extends URLLoaderBase {
 
 
     private Void didFail(final Throwable th) {
+        abortCacheEntry();
         callBackIfNotCanceled(() ->  {
             // FIXME: simply copied from URLLoader.java, it should be
             // retwritten using if..else rather than throw.
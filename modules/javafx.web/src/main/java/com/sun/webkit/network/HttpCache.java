@@ -0,0 +1,629 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.network;
+
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.logging.PlatformLogger.Level;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.net.http.HttpHeaders;
+import java.net.http.HttpRequest;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.DirectoryStream;
+import java.nio.file.Files;
+import java.nio.file.InvalidPathException;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.StandardOpenOption;
+import java.nio.file.attribute.FileTime;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.text.ParseException;
+import java.util.ArrayList;
+import java.util.HexFormat;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+/**
+ * An on-disk cache of HTTP responses.
+ *
+ * The cache is used by {@link HTTP2Loader} and is enabled by setting the
+ * {@code com.sun.webkit.httpCacheDir} system property to a writable
+ * directory; {@code com.sun.webkit.httpCacheSize} caps its size in bytes.
+ * Only successful responses to plain GET requests are stored. A stored
+ * response is served without a request while it is fresh per its
+ * {@code Cache-Control: max-age} or {@code Expires} header, and is
+ * revalidated with {@code If-None-Match} or {@code If-Modified-Since}
+ * afterwards. The least recently used entries are evicted once the
+ * cache grows past its cap.
+ *
+ * Every entry lives in a file of its own, the body of which is memory
+ * mapped when the entry is looked up.
+ */
+public final class HttpCache {
+
+    private static final PlatformLogger logger =
+            PlatformLogger.getLogger(HttpCache.class.getName());
+
+    private static final int MAGIC = 0x4A46_4843;
+    private static final int VERSION = 1;
+    // magic, version, expiration time, header length
+    private static final int PREFIX_SIZE = 4 + 4 + 8 + 4;
+    private static final int EXPIRES_OFFSET = 8;
+    private static final String ENTRY_SUFFIX = ".entry";
+    private static final String TEMP_SUFFIX = ".tmp";
+    private static final long DEFAULT_MAX_SIZE = 64L * 1024 * 1024;
+
+    private static final Pattern MAX_AGE_PATTERN =
+            Pattern.compile("(?:^|[,\\s])max-age\\s*=\\s*\"?(\\d+)");
+
+    private static final AtomicLong hitCount = new AtomicLong();
+    private static final AtomicLong missCount = new AtomicLong();
+
+    private static final HttpCache instance;
+    static {
+        HttpCache cache = null;
+        final String dir = System.getProperty("com.sun.webkit.httpCacheDir");
+        final long maxSize = Long.getLong("com.sun.webkit.httpCacheSize", DEFAULT_MAX_SIZE);
+        if (dir != null && !dir.isEmpty() && maxSize > 0) {
+            try {
+                cache = new HttpCache(Path.of(dir), maxSize);
+            } catch (IOException | InvalidPathException ex) {
+                logger.warning("Cannot use HTTP cache directory " + dir, ex);
+            }
+        }
+        instance = cache;
+    }
+
+    private final Path directory;
+    private final long maxSize;
+
+    /**
+     * The sizes of the entry files by name, in access order.
+     */
+    private final LinkedHashMap<String, Long> index =
+            new LinkedHashMap<>(16, 0.75f, true);
+
+    /**
+     * The total size of the entry files.
+     */
+    private long size;
+
+
+    HttpCache(Path directory, long maxSize) throws IOException {
+        this.directory = Files.createDirectories(directory);
+        this.maxSize = maxSize;
+        loadIndex();
+    }
+
+    /**
+     * Returns the cache configured for this process, or {@code null}
+     * if there is none.
+     */
+    static HttpCache getInstance() {
+        return instance;
+    }
+
+    /**
+     * Returns the number of requests answered from the cache, either
+     * directly or after the server confirmed the stored response.
+     */
+    public static long getHitCount() {
+        return hitCount.get();
+    }
+
+    /**
+     * Returns the number of cacheable requests that had to be loaded
+     * from the network.
+     */
+    public static long getMissCount() {
+        return missCount.get();
+    }
+
+    static void countHit() {
+        hitCount.incrementAndGet();
+    }
+
+    static void countMiss() {
+        missCount.incrementAndGet();
+    }
+
+    /**
+     * Returns whether a request may be answered from the cache and its
+     * response stored in it. Requests carrying validators of their own
+     * come from the memory cache of WebCore and are left to it.
+     */
+    static boolean isCacheableRequest(String method,
+                                      FormDataElement[] formDataElements,
+                                      String requestHeaders)
+    {
+        if (!"GET".equals(method) || formDataElements != null) {
+            return false;
+        }
+        final Map<String, String> headers = parseHeaders(requestHeaders);
+        return !headers.containsKey("if-none-match")
+                && !headers.containsKey("if-modified-since")
+                && !headers.containsKey("range")
+                && !headers.containsKey("authorization")
+                && !headers.getOrDefault("cache-control", "").contains("no-store");
+    }
+
+    /**
+     * Returns whether a request asks for a stored response to be
+     * revalidated even if it is still fresh, as a reload does.
+     */
+    static boolean requiresValidation(String requestHeaders) {
+        final Map<String, String> headers = parseHeaders(requestHeaders);
+        final String cacheControl = headers.getOrDefault("cache-control", "");
+        return cacheControl.contains("no-cache")
+                || maxAge(cacheControl) == 0
+                || headers.getOrDefault("pragma", "").contains("no-cache");
+    }
+
+    /**
+     * Returns the time until which a response with the given headers is
+     * fresh, or {@code 0} if it must be revalidated before every use.
+     */
+    static long expirationTime(HttpHeaders headers, long responseTime) {
+        final String cacheControl = getCacheControl(headers);
+        if (cacheControl.contains("no-cache") || cacheControl.contains("must-revalidate")) {
+            return 0;
+        }
+        final long maxAge = maxAge(cacheControl);
+        if (maxAge >= 0) {
+            return responseTime + maxAge * 1000;
+        }
+        final String expires = headers.firstValue("expires").orElse(null);
+        if (expires != null) {
+            try {
+                final long date = headers.firstValue("date").isPresent()
+                        ? DateParser.parse(headers.firstValue("date").get())
+                        : responseTime;
+                return Math.max(0, responseTime + DateParser.parse(expires) - date);
+            } catch (ParseException ex) {
+                // An invalid date means the response is already expired
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Looks up the stored response for a URL.
+     */
+    Entry get(String url) {
+        final String name = fileName(url);
+        synchronized (this) {
+            if (index.get(name) == null) {
+                return null;
+            }
+        }
+        final Path file = directory.resolve(name);
+        try (FileChannel channel = FileChannel.open(file, StandardOpenOption.READ)) {
+            final ByteBuffer prefix = read(channel, 0, PREFIX_SIZE);
+            if (prefix.getInt() != MAGIC || prefix.getInt() != VERSION) {
+                throw new IOException("Invalid cache entry");
+            }
+            final long expires = prefix.getLong();
+            final int headerLength = prefix.getInt();
+            final DataInputStream in = new DataInputStream(new ByteArrayInputStream(
+                    read(channel, PREFIX_SIZE, headerLength).array()));
+            final String entryURL = readString(in);
+            if (!url.equals(entryURL)) {
+                return null;
+            }
+            final int status = in.readInt();
+            final String contentType = readString(in);
+            final String responseHeaders = readString(in);
+            final String etag = readString(in);
+            final String lastModified = readString(in);
+            final long bodyOffset = PREFIX_SIZE + headerLength;
+            final ByteBuffer body = channel.map(FileChannel.MapMode.READ_ONLY,
+                    bodyOffset, channel.size() - bodyOffset);
+            Files.setLastModifiedTime(file, FileTime.fromMillis(System.currentTimeMillis()));
+            return new Entry(file, status, contentType, responseHeaders,
+                             etag, lastModified, expires, body);
+        } catch (IOException | RuntimeException ex) {
+            if (logger.isLoggable(Level.FINE)) {
+                logger.fine("Dropping HTTP cache entry for " + url, ex);
+            }
+            remove(name);
+            return null;
+        }
+    }
+
+    /**
+     * Creates a writer for the response to a cacheable request, or
+     * returns {@code null} if the response cannot be stored.
+     */
+    Writer newWriter(String url,
+                     int status,
+                     String contentType,
+                     String responseHeaders,
+                     HttpHeaders headers)
+    {
+        if (status != 200 || headers.firstValue("vary").isPresent()) {
+            return null;
+        }
+        final String cacheControl = getCacheControl(headers);
+        if (cacheControl.contains("no-store")) {
+            return null;
+        }
+        final long expires = expirationTime(headers, System.currentTimeMillis());
+        final String etag = headers.firstValue("etag").orElse("");
+        final String lastModified = headers.firstValue("last-modified").orElse("");
+        if (expires == 0 && etag.isEmpty() && lastModified.isEmpty()) {
+            return null;
+        }
+        final long limit = maxSize / 8;
+        if (headers.firstValueAsLong("content-length").orElse(0) > limit) {
+            return null;
+        }
+
+        Path temp = null;
+        try {
+            final ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+            final DataOutputStream out = new DataOutputStream(bytes);
+            writeString(out, url);
+            out.writeInt(status);
+            writeString(out, contentType);
+            writeString(out, responseHeaders);
+            writeString(out, etag);
+            writeString(out, lastModified);
+            out.flush();
+
+            final ByteBuffer prefix = ByteBuffer.allocate(PREFIX_SIZE)
+                    .putInt(MAGIC)
+                    .putInt(VERSION)
+                    .putLong(expires)
+                    .putInt(bytes.size())
+                    .flip();
+            temp = Files.createTempFile(directory, "entry", TEMP_SUFFIX);
+            final FileChannel channel = FileChannel.open(temp, StandardOpenOption.WRITE);
+            final Writer writer = new Writer(fileName(url), temp, channel, limit);
+            writer.write(prefix);
+            writer.write(ByteBuffer.wrap(bytes.toByteArray()));
+            return writer;
+        } catch (IOException ex) {
+            logger.fine("Cannot create HTTP cache entry for " + url, ex);
+            if (temp != null) {
+                try {
+                    Files.deleteIfExists(temp);
+                } catch (IOException ignore) {}
+            }
+            return null;
+        }
+    }
+
+    /**
+     * Updates the expiration time of a stored response from the headers
+     * of a {@code 304 Not Modified} response.
+     */
+    void refresh(Entry entry, HttpHeaders headers) {
+        final long expires = expirationTime(headers, System.currentTimeMillis());
+        try (FileChannel channel = FileChannel.open(entry.file, StandardOpenOption.WRITE)) {
+            channel.write(ByteBuffer.allocate(8).putLong(expires).flip(), EXPIRES_OFFSET);
+        } catch (IOException ex) {
+            logger.fine("Cannot refresh HTTP cache entry", ex);
+        }
+    }
+
+    private void loadIndex() throws IOException {
+        final List<Path> files = new ArrayList<>();
+        try (DirectoryStream<Path> stream = Files.newDirectoryStream(directory)) {
+            for (Path file : stream) {
+                final String name = file.getFileName().toString();
+                if (name.endsWith(ENTRY_SUFFIX)) {
+                    files.add(file);
+                } else if (name.endsWith(TEMP_SUFFIX)) {
+                    Files.deleteIfExists(file);
+                }
+            }
+        }
+        final Map<Path, FileTime> times = new LinkedHashMap<>();
+        for (Path file : files) {
+            times.put(file, Files.getLastModifiedTime(file));
+        }
+        files.sort((f1, f2) -> times.get(f1).compareTo(times.get(f2)));
+        synchronized (this) {
+            for (Path file : files) {
+                final long fileSize = Files.size(file);
+                index.put(file.getFileName().toString(), fileSize);
+                size += fileSize;
+            }
+            evict();
+        }
+    }
+
+    private synchronized void add(String name, long fileSize) {
+        final Long oldSize = index.put(name, fileSize);
+        size += fileSize - (oldSize != null ? oldSize : 0);
+        evict();
+    }
+
+    private synchronized void remove(String name) {
+        final Long oldSize = index.remove(name);
+        if (oldSize != null) {
+            size -= oldSize;
+        }
+        delete(directory.resolve(name));
+    }
+
+    private void evict() {
+        final Iterator<Map.Entry<String, Long>> it = index.entrySet().iterator();
+        while (size > maxSize && it.hasNext()) {
+            final Map.Entry<String, Long> eldest = it.next();
+            it.remove();
+            size -= eldest.getValue();
+            delete(directory.resolve(eldest.getKey()));
+        }
+    }
+
+    /**
+     * Returns the total size of the stored entries.
+     */
+    synchronized long size() {
+        return size;
+    }
+
+    private static void delete(Path file) {
+        try {
+            Files.deleteIfExists(file);
+        } catch (IOException ex) {
+            logger.fine("Cannot delete HTTP cache entry " + file, ex);
+        }
+    }
+
+    private static String fileName(String url) {
+        try {
+            final MessageDigest digest = MessageDigest.getInstance("SHA-256");
+            return HexFormat.of().formatHex(
+                    digest.digest(url.getBytes(StandardCharsets.UTF_8))) + ENTRY_SUFFIX;
+        } catch (NoSuchAlgorithmException ex) {
+            throw new AssertionError(ex);
+        }
+    }
+
+    private static String getCacheControl(HttpHeaders headers) {
+        return String.join(",", headers.allValues("cache-control")).toLowerCase(Locale.ROOT);
+    }
+
+    private static long maxAge(String cacheControl) {
+        final Matcher m = MAX_AGE_PATTERN.matcher(cacheControl);
+        if (!m.find()) {
+            return -1;
+        }
+        try {
+            return Long.parseLong(m.group(1));
+        } catch (NumberFormatException ex) {
+            return Long.MAX_VALUE / 1000 / 2;
+        }
+    }
+
+    /**
+     * Parses the request headers passed by WebCore, one
+     * {@code name: value} pair per line, into a map with lower case
+     * names and values.
+     */
+    private static Map<String, String> parseHeaders(String headers) {
+        final Map<String, String> result = new LinkedHashMap<>();
+        if (headers == null) {
+            return result;
+        }
+        for (String line : headers.split("\n")) {
+            final int colon = line.indexOf(':');
+            if (colon > 0) {
+                result.merge(line.substring(0, colon).trim().toLowerCase(Locale.ROOT),
+                             line.substring(colon + 1).trim().toLowerCase(Locale.ROOT),
+                             (v1, v2) -> v1 + "," + v2);
+            }
+        }
+        return result;
+    }
+
+    private static ByteBuffer read(FileChannel channel, long position, int length)
+            throws IOException
+    {
+        if (length < 0 || position + length > channel.size()) {
+            throw new IOException("Truncated cache entry");
+        }
+        final ByteBuffer buffer = ByteBuffer.allocate(length);
+        while (buffer.hasRemaining()) {
+            if (channel.read(buffer, position + buffer.position()) < 0) {
+                throw new IOException("Truncated cache entry");
+            }
+        }
+        return buffer.flip();
+    }
+
+    private static void writeString(DataOutputStream out, String s) throws IOException {
+        final byte[] bytes = s.getBytes(StandardCharsets.UTF_8);
+        out.writeInt(bytes.length);
+        out.write(bytes);
+    }
+
+    private static String readString(DataInputStream in) throws IOException {
+        final byte[] bytes = new byte[in.readInt()];
+        in.readFully(bytes);
+        return new String(bytes, StandardCharsets.UTF_8);
+    }
+
+    /**
+     * A stored response.
+     */
+    static final class Entry {
+        private final Path file;
+        private final int status;
+        private final String contentType;
+        private final String headers;
+        private final String etag;
+        private final String lastModified;
+        private final long expires;
+        private final ByteBuffer body;
+
+        private Entry(Path file, int status, String contentType, String headers,
+                      String etag, String lastModified, long expires, ByteBuffer body)
+        {
+            this.file = file;
+            this.status = status;
+            this.contentType = contentType;
+            this.headers = headers;
+            this.etag = etag;
+            this.lastModified = lastModified;
+            this.expires = expires;
+            this.body = body;
+        }
+
+        int getStatus() {
+            return status;
+        }
+
+        String getContentType() {
+            return contentType;
+        }
+
+        String getHeaders() {
+            return headers;
+        }
+
+        boolean isFresh() {
+            return System.currentTimeMillis() < expires;
+        }
+
+        /**
+         * Returns a new read-only view of the mapped body.
+         */
+        ByteBuffer getBody() {
+            return body.duplicate();
+        }
+
+        /**
+         * Adds the headers that let the server confirm this response
+         * with {@code 304 Not Modified}.
+         */
+        void addValidators(HttpRequest.Builder builder) {
+            if (!etag.isEmpty()) {
+                builder.header("If-None-Match", etag);
+            }
+            if (!lastModified.isEmpty()) {
+                builder.header("If-Modified-Since", lastModified);
+            }
+        }
+    }
+
+    /**
+     * Writes a response into a temporary file that replaces the stored
+     * entry on {@link #commit}.
+     */
+    final class Writer {
+        private final String name;
+        private final Path temp;
+        private final FileChannel channel;
+        private final long limit;
+        private long written;
+        private boolean closed;
+
+        private Writer(String name, Path temp, FileChannel channel, long limit) {
+            this.name = name;
+            this.temp = temp;
+            this.channel = channel;
+            this.limit = limit;
+        }
+
+        /**
+         * Appends the remaining bytes of a buffer without changing
+         * its position.
+         */
+        synchronized void write(ByteBuffer buffer) {
+            if (closed) {
+                return;
+            }
+            try {
+                written += buffer.remaining();
+                if (written > limit) {
+                    throw new IOException("Response too large to be cached");
+                }
+                final ByteBuffer bytes = buffer.duplicate();
+                while (bytes.hasRemaining()) {
+                    channel.write(bytes);
+                }
+            } catch (IOException ex) {
+                logger.fine("Cannot write HTTP cache entry", ex);
+                abort();
+            }
+        }
+
+        synchronized void write(List<ByteBuffer> buffers) {
+            for (ByteBuffer buffer : buffers) {
+                write(buffer);
+            }
+        }
+
+        /**
+         * Stores the response written so far in the cache.
+         */
+        synchronized void commit() {
+            if (closed) {
+                return;
+            }
+            closed = true;
+            try {
+                channel.close();
+                final Path file = directory.resolve(name);
+                Files.move(temp, file, StandardCopyOption.REPLACE_EXISTING,
+                           StandardCopyOption.ATOMIC_MOVE);
+                add(name, Files.size(file));
+            } catch (IOException ex) {
+                logger.fine("Cannot store HTTP cache entry", ex);
+                delete(temp);
+            }
+        }
+
+        /**
+         * Discards the response written so far.
+         */
+        synchronized void abort() {
+            if (closed) {
+                return;
+            }
+            closed = true;
+            try {
+                channel.close();
+            } catch (IOException ignore) {}
+            delete(temp);
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,7 +27,12 @@ package com.sun.webkit.network;
 
 import static com.sun.webkit.network.URLs.newURL;
 
+import java.net.InetAddress;
 import java.net.MalformedURLException;
+import java.net.Proxy;
+import java.net.ProxySelector;
+import java.net.URI;
+import java.net.UnknownHostException;
 import java.util.Arrays;
 import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.ThreadFactory;
@@ -75,6 +80,17 @@ final class NetworkContext {
      */
     private static final ThreadPoolExecutor threadPool;
 
+    /**
+     * The size of the thread pool for DNS prefetching. WebCore limits the
+     * number of prefetches in flight to the same value.
+     */
+    private static final int DNS_THREAD_POOL_SIZE = 8;
+
+    /**
+     * The thread pool used to resolve host names ahead of their use.
+     */
+    private static final ThreadPoolExecutor dnsThreadPool;
+
     /**
      * Can use HTTP2Loader
      */
@@ -86,9 +102,18 @@ final class NetworkContext {
                 THREAD_POOL_KEEP_ALIVE_TIME,
                 TimeUnit.MILLISECONDS,
                 new LinkedBlockingQueue<Runnable>(),
-                new URLLoaderThreadFactory());
+                new URLLoaderThreadFactory("URL-Loader-"));
         threadPool.allowCoreThreadTimeOut(true);
 
+        dnsThreadPool = new ThreadPoolExecutor(
+                DNS_THREAD_POOL_SIZE,
+                DNS_THREAD_POOL_SIZE,
+                THREAD_POOL_KEEP_ALIVE_TIME,
+                TimeUnit.MILLISECONDS,
+                new LinkedBlockingQueue<Runnable>(),
+                new URLLoaderThreadFactory("DNS-Prefetch-"));
+        dnsThreadPool.allowCoreThreadTimeOut(true);
+
         // Use HTTP2 by default on JDK 12 or later
         final var version = Runtime.Version.parse(System.getProperty("java.version"));
         final String defaultUseHTTP2 = version.feature() >= 12 ? "true" : "false";
@@ -219,20 +244,61 @@ final class NetworkContext {
         return propValue >= 0 ? propValue : DEFAULT_HTTP_MAX_CONNECTIONS;
     }
 
+    /**
+     * Resolves a host name on a background thread so that its addresses
+     * are in the {@code InetAddress} cache by the time a loader connects
+     * to it. Calls {@code twkDidPrefetchDNS} once done.
+     */
+    private static void fwkPrefetchDNS(String hostname) {
+        dnsThreadPool.execute(() -> {
+            try {
+                InetAddress.getAllByName(hostname);
+            } catch (UnknownHostException | SecurityException ex) {
+                if (logger.isLoggable(Level.FINE)) {
+                    logger.fine("Cannot prefetch " + hostname, ex);
+                }
+            } finally {
+                twkDidPrefetchDNS();
+            }
+        });
+    }
+
+    /**
+     * Returns whether HTTP requests go through a proxy, in which case
+     * the addresses resolved locally are of no use.
+     */
+    private static boolean fwkIsUsingProxy() {
+        final ProxySelector selector = ProxySelector.getDefault();
+        if (selector == null) {
+            return false;
+        }
+        try {
+            return selector.select(URI.create("http://www.example.com/"))
+                           .stream()
+                           .anyMatch(proxy -> proxy.type() != Proxy.Type.DIRECT);
+        } catch (RuntimeException ex) {
+            return true;
+        }
+    }
+
+    private static native void twkDidPrefetchDNS();
+
     /**
      * Thread factory for URL loader threads.
      */
     private static final class URLLoaderThreadFactory implements ThreadFactory {
         private final ThreadGroup group;
+        private final String namePrefix;
         private final AtomicInteger index = new AtomicInteger(1);
 
-        private URLLoaderThreadFactory() {
+        private URLLoaderThreadFactory(String namePrefix) {
             group = Thread.currentThread().getThreadGroup();
+            this.namePrefix = namePrefix;
         }
 
         @Override
         public Thread newThread(Runnable r) {
-            Thread t = new Thread(group, r, "URL-Loader-" + index.getAndIncrement());
+            Thread t = new Thread(group, r, namePrefix + index.getAndIncrement());
             t.setDaemon(true);
             if (t.getPriority() != Thread.NORM_PRIORITY) {
                 t.setPriority(Thread.NORM_PRIORITY);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,7 @@ import java.net.SocketException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.UnknownHostException;
+import java.nio.ByteBuffer;
 import java.util.List;
 import java.util.concurrent.SynchronousQueue;
 import java.util.concurrent.ThreadFactory;
@@ -64,6 +65,9 @@ final class SocketStreamHandle {
             10, TimeUnit.SECONDS,
             new SynchronousQueue<Runnable>(),
             new CustomThreadFactory());
+    private static final int READ_BUFFER_SIZE = 8192;
+    private static final int RECEIVE_BUFFER_SIZE = 256 * 1024;
+    private static final int SEND_BUFFER_SIZE = 64 * 1024;
 
     private enum State {ACTIVE, CLOSE_REQUESTED, DISPOSED}
 
@@ -72,6 +76,11 @@ final class SocketStreamHandle {
     private final boolean ssl;
     private final WebPage webPage;
     private final long data;
+    // Received bytes are handed to native code in place, one event thread
+    // notification per burst; sent bytes are copied by native code into
+    // a reused array.
+    private final ByteRingBuffer receiveBuffer;
+    private final byte[] sendBuffer = new byte[SEND_BUFFER_SIZE];
     private volatile Socket socket;
     private volatile State state = State.ACTIVE;
     private volatile boolean connected;
@@ -84,6 +93,8 @@ final class SocketStreamHandle {
         this.ssl = ssl;
         this.webPage = webPage;
         this.data = data;
+        this.receiveBuffer = new ByteRingBuffer(RECEIVE_BUFFER_SIZE,
+                this::didReceiveData);
     }
 
     private static SocketStreamHandle fwkCreate(String host, int port,
@@ -118,15 +129,18 @@ final class SocketStreamHandle {
             logger.finest("{0} connected", this);
             didOpen();
             InputStream is = socket.getInputStream();
+            byte[] buffer = new byte[READ_BUFFER_SIZE];
             while (true) {
-                byte[] buffer = new byte[8192];
                 int n = is.read(buffer);
                 if(n > 0) {
                     if (logger.isLoggable(Level.FINEST)) {
                         logger.finest(format("%s received len: [%d], data:%s",
                                 this, n, dump(buffer, n)));
                     }
-                    didReceiveData(buffer, n);
+                    if (!receiveBuffer.write(buffer, 0, n)) {
+                        logger.finest("{0} receive buffer closed", this);
+                        break;
+                    }
                 } else {
                     logger.finest("{0} connection closed by remote host", this);
                     break;
@@ -163,6 +177,8 @@ final class SocketStreamHandle {
         } catch (SecurityException ex) {
             error = ex;
             errorDescription = "Security error";
+        } catch (InterruptedException ex) {
+            logger.finest(format("%s interrupted", this), ex);
         } catch (Throwable th) {
             error = th;
         }
@@ -266,15 +282,19 @@ final class SocketStreamHandle {
         }
     }
 
-    private int fwkSend(byte[] buffer) {
+    private byte[] fwkGetSendBuffer() {
+        return sendBuffer;
+    }
+
+    private int fwkSend(int len) {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(format("%s sending len: [%d], data:%s",
-                    this, buffer.length, dump(buffer, buffer.length)));
+                    this, len, dump(sendBuffer, len)));
         }
         if (connected) {
             try {
-                socket.getOutputStream().write(buffer);
-                return buffer.length;
+                socket.getOutputStream().write(sendBuffer, 0, len);
+                return len;
             } catch (IOException ex) {
                 logger.finest(format("%s exception", this), ex);
                 didFail(0, "I/O error");
@@ -291,6 +311,7 @@ final class SocketStreamHandle {
         synchronized (this) {
             logger.finest("{0}", this);
             state = State.CLOSE_REQUESTED;
+            receiveBuffer.close();
             try {
                 if (socket != null) {
                     socket.close();
@@ -302,6 +323,7 @@ final class SocketStreamHandle {
     private void fwkNotifyDisposed() {
         logger.finest("{0}", this);
         state = State.DISPOSED;
+        receiveBuffer.close();
     }
 
     private void didOpen() {
@@ -312,11 +334,13 @@ final class SocketStreamHandle {
         });
     }
 
-    private void didReceiveData(final byte[] buffer, final int len) {
+    private void didReceiveData() {
         Invoker.getInvoker().postOnEventThread(() -> {
-            if (state == State.ACTIVE) {
-                notifyDidReceiveData(buffer, len);
-            }
+            receiveBuffer.drain((buffer, offset, len) -> {
+                if (state == State.ACTIVE) {
+                    notifyDidReceiveData(buffer, offset, len);
+                }
+            });
         });
     }
 
@@ -341,12 +365,12 @@ final class SocketStreamHandle {
         twkDidOpen(data);
     }
 
-    private void notifyDidReceiveData(byte[] buffer, int len) {
+    private void notifyDidReceiveData(ByteBuffer buffer, int offset, int len) {
         if (logger.isLoggable(Level.FINEST)) {
-            logger.finest(format("%s, len: [%d], data:%s",
-                    this, len, dump(buffer, len)));
+            logger.finest(format("%s, offset: [%d], len: [%d]",
+                    this, offset, len));
         }
-        twkDidReceiveData(buffer, len, data);
+        twkDidReceiveData(buffer, offset, len, data);
     }
 
     private void notifyDidFail(int errorCode, String errorDescription) {
@@ -364,7 +388,8 @@ final class SocketStreamHandle {
     }
 
     private static native void twkDidOpen(long data);
-    private static native void twkDidReceiveData(byte[] buffer, int len,
+    private static native void twkDidReceiveData(ByteBuffer buffer,
+                                                 int offset, int len,
                                                  long data);
     private static native void twkDidFail(int errorCode,
                                           String errorDescription, long data);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,6 +61,23 @@ abstract class URLLoaderBase {
                                                  int remaining,
                                                  long data);
 
+    /**
+     * Allocates a native data segment of the given capacity and returns
+     * a direct buffer over it. The segment must be handed over with
+     * {@link #twkDidReceiveDataSegment}, the buffer must not be used
+     * afterwards.
+     */
+    protected static native ByteBuffer twkAllocateDataSegment(int capacity);
+
+    /**
+     * Delivers the first {@code length} bytes of a segment allocated by
+     * {@link #twkAllocateDataSegment} and transfers its ownership to the
+     * native side without copying it.
+     */
+    protected static native void twkDidReceiveDataSegment(ByteBuffer segment,
+                                                        int length,
+                                                        long data);
+
     protected static native void twkDidFinishLoading(long data);
 
     protected static native void twkDidFail(int errorCode,
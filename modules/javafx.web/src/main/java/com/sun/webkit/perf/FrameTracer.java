@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package com.sun.webkit.perf;
+
+import com.sun.javafx.logging.PlatformLogger;
+import java.io.IOException;
+import java.io.Writer;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Paths;
+
+/**
+ * Writes the timing of the WebView rendering pipeline as Chrome trace events
+ * (JSON array format) to the file named by the
+ * {@code com.sun.webkit.frameTraceFile} system property. The output can be
+ * opened with chrome://tracing or Perfetto. The events can also be received
+ * in process with a {@link Listener}.
+ */
+public final class FrameTracer {
+    private static final PlatformLogger log =
+            PlatformLogger.getLogger(FrameTracer.class.getName());
+
+    private static final String TRACE_FILE =
+            System.getProperty("com.sun.webkit.frameTraceFile");
+
+    private static final long startTime = System.nanoTime();
+    private static Writer writer;
+    private static volatile boolean isFileEnabled = TRACE_FILE != null;
+    private static volatile Listener listener;
+
+    /**
+     * Receives the trace events as they complete, on the thread that ran
+     * the stage.
+     */
+    public interface Listener {
+        /**
+         * Called for each complete event, with the arguments of
+         * {@link FrameTracer#complete} and the end time of the stage.
+         */
+        void complete(String name, int page, long frame, long start, long end,
+                      long bytes);
+    }
+
+    private FrameTracer() {
+        throw new AssertionError();
+    }
+
+    public static boolean isEnabled() {
+        return isFileEnabled || listener != null;
+    }
+
+    /**
+     * Sets the listener that receives the events in addition to the trace
+     * file, or removes it if {@code l} is {@code null}. Tracing is enabled
+     * while there is a listener, even without a trace file.
+     */
+    public static synchronized void setListener(Listener l) {
+        listener = l;
+    }
+
+    /**
+     * Adds a complete event to the trace.
+     *
+     * @param name the pipeline stage
+     * @param page identifies the page
+     * @param frame identifies the render frame within the page
+     * @param start the start time in {@code System.nanoTime()} units
+     * @param bytes the amount of render queue data the stage handled,
+     *        or a negative value if not applicable
+     */
+    public static synchronized void complete(String name, int page, long frame,
+                                             long start, long bytes)
+    {
+        long end = System.nanoTime();
+        Listener l = listener;
+        if (l != null) {
+            l.complete(name, page, frame, start, end, bytes);
+        }
+        if (!isFileEnabled) {
+            return;
+        }
+        StringBuilder event = new StringBuilder(160);
+        event.append(writer == null ? "[\n" : ",\n")
+             .append("{\"name\":\"").append(name)
+             .append("\",\"cat\":\"webview\",\"ph\":\"X\",\"pid\":1,\"tid\":")
+             .append(Thread.currentThread().threadId())
+             .append(",\"ts\":").append((start - startTime) / 1000.0)
+             .append(",\"dur\":").append((end - start) / 1000.0)
+             .append(",\"args\":{\"page\":").append(page)
+             .append(",\"frame\":").append(frame);
+        if (bytes >= 0) {
+            event.append(",\"bytes\":").append(bytes);
+        }
+        event.append("}}");
+        try {
+            if (writer == null) {
+                writer = Files.newBufferedWriter(Paths.get(TRACE_FILE),
+                                                 StandardCharsets.UTF_8);
+                Runtime.getRuntime().addShutdownHook(
+                        new Thread(FrameTracer::close, "WebPane-FrameTracer"));
+            }
+            writer.append(event);
+        } catch (IOException e) {
+            log.warning("Cannot write frame trace to " + TRACE_FILE
+                    + ", frame tracing is disabled", e);
+            isFileEnabled = false;
+        }
+    }
+
+    private static synchronized void close() {
+        if (writer == null) {
+            return;
+        }
+        try {
+            writer.append("\n]\n");
+            writer.close();
+        } catch (IOException e) {
+            log.fine("Cannot close frame trace " + TRACE_FILE, e);
+        }
+        writer = null;
+        isFileEnabled = false;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -205,6 +205,19 @@ public final class PerfLogger {
         return stat;
     }
 
+    /**
+     * Returns the number of invocations of all probes since the last reset.
+     */
+    public synchronized int getTotalCount() {
+        int count = 0;
+        for (ProbeStat s: probes.values()) {
+            if (!"TOTALTIME".equals(s.probe)) {
+                count += s.count;
+            }
+        }
+        return count;
+    }
+
     public synchronized ProbeStat getProbeStat(String probe) {
         String p = probe.intern();
         ProbeStat s = probes.get(p);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -74,6 +74,14 @@ public final class WCFontPerfLogger extends WCFont {
         return runs;
     }
 
+    @Override
+    public int[] getPackedTextRuns(String str) {
+        logger.resumeCount("GETPACKEDTEXTRUNS");
+        final int[] res = fnt.getPackedTextRuns(str);
+        logger.suspendCount("GETPACKEDTEXTRUNS");
+        return res;
+    }
+
     @Override
     public int[] getGlyphCodes(char[] chars) {
         logger.resumeCount("GETGLYPHCODES");
@@ -82,6 +90,11 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    @Override
+    public int getGlyphMapperID() {
+        return fnt.getGlyphMapperID();
+    }
+
     @Override
     public float getXHeight() {
         logger.resumeCount("GETXHEIGHT");
@@ -106,6 +119,22 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    @Override
+    public float[] getGlyphWidths(int firstGlyph, int count) {
+        logger.resumeCount("GETGLYPHWIDTHS");
+        float[] res = fnt.getGlyphWidths(firstGlyph, count);
+        logger.suspendCount("GETGLYPHWIDTHS");
+        return res;
+    }
+
+    @Override
+    public float[] getGlyphBoundingBoxes(int firstGlyph, int count) {
+        logger.resumeCount("GETGLYPHBOUNDINGBOXES");
+        float[] res = fnt.getGlyphBoundingBoxes(firstGlyph, count);
+        logger.suspendCount("GETGLYPHBOUNDINGBOXES");
+        return res;
+    }
+
     @Override
     public int hashCode() {
         logger.resumeCount("HASH");
@@ -169,4 +198,12 @@ public final class WCFontPerfLogger extends WCFont {
         logger.suspendCount("GETCAPHEIGHT");
         return res;
     }
+
+    @Override
+    public float[] getFontMetrics() {
+        logger.resumeCount("GETFONTMETRICS");
+        float[] res = fnt.getFontMetrics();
+        logger.suspendCount("GETFONTMETRICS");
+        return res;
+    }
 }
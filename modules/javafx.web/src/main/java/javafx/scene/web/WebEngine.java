@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -66,8 +66,10 @@ import java.net.URLConnection;
 import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.attribute.PosixFilePermissions;
+import java.util.ArrayDeque;
 import java.util.ArrayList;
 import java.util.Base64;
+import java.util.Deque;
 import java.util.List;
 import java.util.Objects;
 
@@ -360,6 +362,22 @@ final public class WebEngine {
      */
     private static int instanceCount = 0;
 
+    /**
+     * The number of pages to create ahead of time for new engines. Creating
+     * the native page takes a noticeable time, so this keeps it off the
+     * path of opening a new WebView.
+     */
+    private static final int PREWARMED_PAGE_COUNT =
+            Integer.getInteger("com.sun.webkit.prewarmedPageCount", 0);
+
+    /**
+     * Pages created ahead of time and not yet adopted by an engine.
+     * Accessed on the FX Application Thread only.
+     */
+    private static final Deque<EnginePage> prewarmedPages = new ArrayDeque<>();
+
+    private static boolean pagePrewarmScheduled = false;
+
     /**
      * The node associated with this engine. There is a one-to-one correspondence
      * between the WebView and its WebEngine (although not all WebEngines have
@@ -848,15 +866,13 @@ final public class WebEngine {
 
     private WebEngine(String url, boolean callLoad) {
         checkThread();
-        Accessor accessor = new AccessorImpl(this);
-        page = new WebPage(
-            new WebPageClientImpl(accessor),
-            new UIClientImpl(accessor),
-            null,
-            new InspectorClientImpl(this),
-            new ThemeClientImpl(accessor),
-            false);
+        EnginePage enginePage = prewarmedPages.poll();
+        if (enginePage == null) {
+            enginePage = new EnginePage();
+        }
+        page = enginePage.bind(this);
         page.addLoadListenerClient(new PageLoadListener(this));
+        schedulePagePrewarm();
 
         history = new WebHistory(page);
 
@@ -1040,6 +1056,9 @@ final public class WebEngine {
 
                 page.setLocalStorageDatabasePath(localStorageDir.getPath());
                 page.setLocalStorageEnabled(true);
+                page.setVisitedLinksFile(new File(userDataDir, "visitedlinks"));
+                WebPage.setIndexedDatabaseDirectory(new File(userDataDir, "indexeddb"));
+                WebPage.setScriptBytecodeCacheDirectory(new File(userDataDir, "bytecodecache"));
 
                 logger.fine("User data directory [{0}] has "
                         + "been applied successfully", displayString);
@@ -1136,15 +1155,63 @@ final public class WebEngine {
         }
     }
 
+    /**
+     * A page and the clients that refer back to its engine. The clients
+     * start unbound, so that the page can be created before the engine that
+     * adopts it.
+     */
+    private static final class EnginePage {
+        private final AccessorImpl accessor = new AccessorImpl();
+        private final InspectorClientImpl inspectorClient = new InspectorClientImpl();
+        private final WebPage page = new WebPage(
+            new WebPageClientImpl(accessor),
+            new UIClientImpl(accessor),
+            null,
+            inspectorClient,
+            new ThemeClientImpl(accessor),
+            false);
+
+        private WebPage bind(WebEngine w) {
+            accessor.bind(w);
+            inspectorClient.engine = new WeakReference<>(w);
+            return page;
+        }
+    }
+
+    /**
+     * Tops up the pool of prewarmed pages, one page per event so that no
+     * single event holds up the FX Application Thread for long.
+     */
+    private static void schedulePagePrewarm() {
+        if (pagePrewarmScheduled || prewarmedPages.size() >= PREWARMED_PAGE_COUNT) {
+            return;
+        }
+        pagePrewarmScheduled = true;
+        Platform.runLater(() -> {
+            pagePrewarmScheduled = false;
+            prewarmedPages.add(new EnginePage());
+            schedulePagePrewarm();
+        });
+    }
+
     private static final class AccessorImpl extends Accessor {
-        private final WeakReference<WebEngine> engine;
+        private WeakReference<WebEngine> engine;
 
-        private AccessorImpl(WebEngine w) {
-            this.engine = new WeakReference<>(w);
+        // View listeners added before the accessor is bound to an engine
+        private List<InvalidationListener> pendingViewListeners;
+
+        private void bind(WebEngine w) {
+            engine = new WeakReference<>(w);
+            if (pendingViewListeners != null) {
+                for (InvalidationListener l : pendingViewListeners) {
+                    w.view.addListener(l);
+                }
+                pendingViewListeners = null;
+            }
         }
 
         @Override public WebEngine getEngine() {
-            return engine.get();
+            return engine == null ? null : engine.get();
         }
 
         @Override public WebPage getPage() {
@@ -1175,6 +1242,11 @@ final public class WebEngine {
             WebEngine w = getEngine();
             if (w != null) {
                 w.view.addListener(l);
+            } else if (engine == null) {
+                if (pendingViewListeners == null) {
+                    pendingViewListeners = new ArrayList<>();
+                }
+                pendingViewListeners.add(l);
             }
         }
     }
@@ -1249,6 +1321,10 @@ final public class WebEngine {
                 int errorCode)
         {
         }
+
+        @Override public boolean wantsResourceLoadEvents() {
+            return false;
+        }
     }
 
 
@@ -1562,17 +1638,12 @@ final public class WebEngine {
      */
     private static final class InspectorClientImpl implements InspectorClient {
 
-        private final WeakReference<WebEngine> engine;
-
-
-        private InspectorClientImpl(WebEngine engine) {
-            this.engine = new WeakReference<>(engine);
-        }
+        private WeakReference<WebEngine> engine;
 
         @Override
         public boolean sendMessageToFrontend(final String message) {
             boolean result = false;
-            WebEngine webEngine = engine.get();
+            WebEngine webEngine = engine == null ? null : engine.get();
             if (webEngine != null) {
                 final Callback<String,Void> messageCallback =
                         webEngine.debugger.messageCallback;
@@ -1595,6 +1666,10 @@ final public class WebEngine {
         }
     }
 
+    private Printable recordPrintable(int pageIndex, float width) {
+        return new Printable(page, pageIndex, width, page.recordPrintPage(pageIndex, width));
+    }
+
     /**
      * Prints the current Web page using the given printer job.
      * <p>This method does not modify the state of the job, nor does it call
@@ -1613,25 +1688,33 @@ final public class WebEngine {
         float height = (float) pl.getPrintableHeight();
         int pageCount = page.beginPrinting(width, height);
 
+        List<Integer> pages = new ArrayList<>();
         JobSettings jobSettings = job.getJobSettings();
         if (jobSettings.getPageRanges() != null) {
             PageRange[] pageRanges = jobSettings.getPageRanges();
             for (PageRange p : pageRanges) {
                 for (int i = p.getStartPage(); i <= p.getEndPage() && i <= pageCount; ++i) {
-                    if (printStatusOK(job)) {
-                        Node printable = new Printable(page, i - 1, width);
-                        job.printPage(printable);
-                    }
+                    pages.add(i - 1);
                 }
             }
         } else {
             for (int i = 0; i < pageCount; i++) {
-                if (printStatusOK(job)) {
-                    Node printable = new Printable(page, i, width);
-                    job.printPage(printable);
-                }
+                pages.add(i);
             }
         }
+
+        // Spool the next page on the event thread while the printer job
+        // is busy rendering the current one.
+        Printable next = pages.isEmpty() ? null : recordPrintable(pages.get(0), width);
+        for (int n = 0; n < pages.size() && printStatusOK(job); n++) {
+            Printable printable = next;
+            next = n + 1 < pages.size() ? recordPrintable(pages.get(n + 1), width) : null;
+            job.printPage(printable);
+            printable.discard();
+        }
+        if (next != null) {
+            next.discard();
+        }
         page.endPrinting();
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1040,6 +1040,7 @@ final public class WebView extends Parent {
         if (page == null) return;
 
         boolean reallyVisible = isTreeReallyVisible();
+        page.setVisible(reallyVisible);
 
         if (reallyVisible) {
             if (page.isDirty()) {
@@ -77,6 +77,7 @@ WTF_EXPORT_PRIVATE bool isMainThreadOrGCThread();
 void initializeMainThreadPlatform();
 #if PLATFORM(JAVA)
 void scheduleDispatchFunctionsOnMainThread();
+void scheduleDispatchFunctionsOnMainThreadAfter(Seconds delay);
 #endif
 
 // To be used with WTF_REQUIRES_CAPABILITY(mainThread). Symbol is undefined.
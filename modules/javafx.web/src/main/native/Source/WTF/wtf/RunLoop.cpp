@@ -231,8 +231,18 @@ void RunLoop::threadWillExit()
 #if PLATFORM(JAVA)
 void RunLoop::dispatchFunctionsFromMainThread()
 {
+#if USE(GENERIC_EVENT_LOOP)
+    fireExpiredTimers();
+#endif
     performWork();
 }
+
+size_t RunLoop::pendingFunctionCount()
+{
+    Locker locker { m_nextIterationLock };
+    return m_nextIteration.size();
+}
+
 void RunLoop::registerTimer(TimerBase& timer)
 {
     Locker locker { m_registeredTimerLock };
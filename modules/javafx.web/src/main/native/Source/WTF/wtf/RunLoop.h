@@ -105,6 +105,7 @@ public:
 #endif
 #if PLATFORM(JAVA)
     WTF_EXPORT_PRIVATE void dispatchFunctionsFromMainThread();
+    WTF_EXPORT_PRIVATE size_t pendingFunctionCount();
 #endif
 
     WTF_EXPORT_PRIVATE static void run();
@@ -308,6 +309,11 @@ private:
     };
     void runImpl(RunMode);
     bool populateTasks(RunMode, Status&, Deque<Ref<TimerBase::ScheduledTask>>&);
+#if PLATFORM(JAVA)
+    // The main loop is driven by the java event thread rather than runImpl().
+    void fireExpiredTimers();
+    void scheduleMainThreadWakeUpWithLock() WTF_REQUIRES_LOCK(m_loopLock);
+#endif
 
     friend class TimerBase;
 
@@ -28,6 +28,9 @@
 #include <wtf/RunLoop.h>
 
 #include <wtf/DataLog.h>
+#if PLATFORM(JAVA)
+#include <wtf/MainThread.h>
+#endif
 #include <wtf/NeverDestroyed.h>
 #include <wtf/ProcessID.h>
 
@@ -258,8 +261,57 @@ void RunLoop::stop()
     }
 }
 
+#if PLATFORM(JAVA)
+// The main RunLoop never runs runImpl() as its thread is the java event
+// thread. Expired timers are fired from dispatchFunctionsFromMainThread()
+// and java is asked to call it back when the earliest timer is due, so
+// all the timers expiring by then are coalesced into a single dispatch.
+void RunLoop::fireExpiredTimers()
+{
+    Deque<Ref<TimerBase::ScheduledTask>> firedTimers;
+    {
+        Locker locker { m_loopLock };
+        MonotonicTime now = MonotonicTime::now();
+        while (!m_schedules.isEmpty()) {
+            auto task = m_schedules.first();
+            if (task->scheduledTimePoint() > now)
+                break;
+            unscheduleWithLock(*task);
+            firedTimers.append(Ref(*task));
+        }
+    }
+
+    while (!firedTimers.isEmpty()) {
+        auto task = firedTimers.takeFirst();
+        task->fired();
+
+        Locker locker { m_loopLock };
+        if (task->isActive() && !task->isScheduled())
+            scheduleWithLock(task.get());
+    }
+
+    Locker locker { m_loopLock };
+    scheduleMainThreadWakeUpWithLock();
+}
+
+void RunLoop::scheduleMainThreadWakeUpWithLock()
+{
+    if (m_schedules.isEmpty())
+        return;
+
+    Seconds delay = m_schedules.first()->scheduledTimePoint() - MonotonicTime::now();
+    scheduleDispatchFunctionsOnMainThreadAfter(std::max(delay, 0_s));
+}
+#endif
+
 void RunLoop::wakeUpWithLock()
 {
+#if PLATFORM(JAVA)
+    if (this == &RunLoop::mainSingleton()) {
+        scheduleMainThreadWakeUpWithLock();
+        return;
+    }
+#endif
     m_pendingTasks = true;
     m_readyToRun.notifyOne();
 
@@ -269,6 +321,12 @@ void RunLoop::wakeUpWithLock()
 
 void RunLoop::wakeUp()
 {
+#if PLATFORM(JAVA)
+    if (this == &RunLoop::mainSingleton()) {
+        scheduleDispatchFunctionsOnMainThread();
+        return;
+    }
+#endif
     Locker locker { m_loopLock };
     wakeUpWithLock();
 }
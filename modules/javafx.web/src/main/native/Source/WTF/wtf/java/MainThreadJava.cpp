@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,7 +28,10 @@
 #include <wtf/java/JavaEnv.h>
 #include <wtf/java/JavaRef.h>
 #include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/RunLoop.h>
+#include <atomic>
+#include <cmath>
 
 #if OS(UNIX)
 #include <pthread.h>
@@ -37,6 +40,7 @@
 namespace WTF {
 static JGClass jMainThreadCls;
 static jmethodID fwkScheduleDispatchFunctions;
+static jmethodID fwkScheduleDispatchFunctionsAfter;
 
 #if OS(UNIX)
 static pthread_t s_mainThread;
@@ -44,12 +48,56 @@ static pthread_t s_mainThread;
 static ThreadIdentifier s_mainThread { 0 };
 #endif
 
+// Set while a dispatch is posted to the event thread and has not started yet.
+// Requests made in that window are served by the posted dispatch, so only the
+// first request after a drain crosses into Java.
+static std::atomic<bool> s_dispatchPending { false };
+static std::atomic<int64_t> s_dispatchRequestTime { 0 };
+
+// Indices in the array returned by twkGetDispatchCounters
+enum {
+    DispatchRequestCount,
+    DispatchUpcallCount,
+    DispatchCount,
+    DispatchMaxQueueDepth,
+    DispatchTotalLatency,
+    DispatchMaxLatency,
+    DispatchCounterCount
+};
+static std::atomic<int64_t> s_dispatchCounters[DispatchCounterCount];
+
+static int64_t monotonicNanoseconds()
+{
+    return static_cast<int64_t>(MonotonicTime::now().secondsSinceEpoch().nanoseconds());
+}
+
 void scheduleDispatchFunctionsOnMainThread()
+{
+    ++s_dispatchCounters[DispatchRequestCount];
+    if (s_dispatchPending.exchange(true))
+        return;
+
+    s_dispatchRequestTime = monotonicNanoseconds();
+    ++s_dispatchCounters[DispatchUpcallCount];
+
+    AttachThreadAsNonDaemonToJavaEnv autoAttach;
+    JNIEnv* env = autoAttach.env();
+    if (!env) {
+        s_dispatchPending = false;
+        return;
+    }
+    env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctions);
+    if (WTF::CheckAndClearException(env))
+        s_dispatchPending = false;
+}
+
+void scheduleDispatchFunctionsOnMainThreadAfter(Seconds delay)
 {
     AttachThreadAsNonDaemonToJavaEnv autoAttach;
     JNIEnv* env = autoAttach.env();
     if (env) {
-        env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctions);
+        env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctionsAfter,
+                static_cast<jlong>(std::ceil(delay.milliseconds())));
         WTF::CheckAndClearException(env);
     }
 }
@@ -88,6 +136,13 @@ void initializeMainThreadPlatform()
 
     ASSERT(fwkScheduleDispatchFunctions);
 
+    fwkScheduleDispatchFunctionsAfter = env->GetStaticMethodID(
+            jMainThreadCls,
+            "fwkScheduleDispatchFunctionsAfter",
+            "(J)V");
+
+    ASSERT(fwkScheduleDispatchFunctionsAfter);
+
 #if OS(UNIX)
     s_mainThread = pthread_self();
 #elif OS(WINDOWS)
@@ -117,7 +172,40 @@ extern "C" {
 JNIEXPORT void JNICALL Java_com_sun_webkit_MainThread_twkScheduleDispatchFunctions
   (JNIEnv*, jobject)
 {
-    RunLoop::mainSingleton().dispatchFunctionsFromMainThread();
+    // Clear the flag first, functions posted while dispatching need another
+    // dispatch.
+    if (s_dispatchPending.exchange(false)) {
+        int64_t latency = monotonicNanoseconds() - s_dispatchRequestTime;
+        s_dispatchCounters[DispatchTotalLatency] += latency;
+        if (latency > s_dispatchCounters[DispatchMaxLatency])
+            s_dispatchCounters[DispatchMaxLatency] = latency;
+    }
+
+    auto& runLoop = RunLoop::mainSingleton();
+    int64_t queueDepth = runLoop.pendingFunctionCount();
+    if (queueDepth > s_dispatchCounters[DispatchMaxQueueDepth])
+        s_dispatchCounters[DispatchMaxQueueDepth] = queueDepth;
+    ++s_dispatchCounters[DispatchCount];
+
+    runLoop.dispatchFunctionsFromMainThread();
+}
+
+/*
+ * Class:     com_sun_webkit_MainThread
+ * Method:    twkGetDispatchCounters
+ * Signature: ()[J
+ */
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_MainThread_twkGetDispatchCounters
+  (JNIEnv* env, jclass)
+{
+    jlong counters[DispatchCounterCount];
+    for (int i = 0; i < DispatchCounterCount; ++i)
+        counters[i] = s_dispatchCounters[i];
+
+    jlongArray result = env->NewLongArray(DispatchCounterCount);
+    if (result)
+        env->SetLongArrayRegion(result, 0, DispatchCounterCount, counters);
+    return result;
 }
 
 /*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,10 +26,16 @@
 #include "config.h"
 
 #include <wtf/Vector.h>
+#include <wtf/text/ASCIIFastPath.h>
 #include <wtf/text/WTFString.h>
 
+#include <cstring>
+
 namespace WTF {
 
+// Strings up to this length are converted without a heap allocation.
+static constexpr size_t inlineConversionCapacity = 256;
+
 // String conversions
 String::String(JNIEnv* env, const JLString &s)
 {
@@ -43,7 +49,16 @@ String::String(JNIEnv* env, const JLString &s)
             const jchar* str = env->GetStringCritical(s, NULL);
             if (str) {
                 std::span<const UChar> createSpan(reinterpret_cast<const UChar*>(str), len);
-                m_impl = StringImpl::create(createSpan);
+                if (charactersAreAllLatin1(createSpan)) {
+                    // Most strings crossing the bridge are Latin-1. Keep them
+                    // 8-bit so that they take half the memory and the 8-bit
+                    // code paths of WebCore and JSC apply.
+                    std::span<LChar> data;
+                    m_impl = StringImpl::createUninitialized(len, data);
+                    StringImpl::copyCharacters(data, createSpan);
+                } else {
+                    m_impl = StringImpl::create(createSpan);
+                }
                 env->ReleaseStringCritical(s, str);
             } else {
                 std::span<const UChar> createSpan(reinterpret_cast<const UChar*>(str), 3);
@@ -60,12 +75,19 @@ JLString String::toJavaString(JNIEnv *env) const
     } else {
         const unsigned len = length();
         if (is8Bit()) {
-            // Convert latin1 chars to unicode.
-            Vector<jchar> jchars(len);
-            for (unsigned i = 0; i < len; i++) {
-                jchars[i] = characterAt(i);
+            std::span<const LChar> characters = span8();
+            if (charactersAreAllASCII(characters) && !std::memchr(characters.data(), 0, len)) {
+                // ASCII without NUL is its own modified UTF-8, from which the
+                // VM creates a compact Latin-1 string without inflating it.
+                Vector<char, inlineConversionCapacity> utf(len + 1);
+                std::memcpy(utf.mutableSpan().data(), characters.data(), len);
+                utf[len] = '\0';
+                return env->NewStringUTF(utf.span().data());
             }
-            return env->NewString(jchars.span().data(), len);
+            // Convert latin1 chars to unicode.
+            Vector<UChar, inlineConversionCapacity> jchars(len);
+            StringImpl::copyCharacters(jchars.mutableSpan(), characters);
+            return env->NewString(reinterpret_cast<const jchar*>(jchars.span().data()), len);
         } else {
               //return env->NewString((jchar*)characters16(), len);
               std::span<const UChar> span = span16();
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <wtf/SIMDHelpers.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/text/ASCIIFastPath.h>
 
@@ -75,4 +76,16 @@ inline void copyASCIIMachineWord(std::span<char16_t> destination, std::span<cons
     UCharByteFiller<sizeof(WTF::MachineWord)>::copy(destination, source);
 }
 
+// Returns the length of the run of ASCII bytes at the start of source.
+inline size_t countLeadingASCII(std::span<const uint8_t> source)
+{
+    auto vectorMatch = [&](auto input) ALWAYS_INLINE_LAMBDA {
+        return SIMD::findFirstNonZeroIndex(SIMD::greaterThanOrEqual(input, SIMD::splat8(0x80)));
+    };
+    auto scalarMatch = [&](auto byte) ALWAYS_INLINE_LAMBDA {
+        return !isASCII(byte);
+    };
+    return SIMD::find(source, vectorMatch, scalarMatch) - source.data();
+}
+
 } // namespace PAL
@@ -27,6 +27,7 @@
 #include "TextCodecCJK.h"
 
 #include "EncodingTables.h"
+#include "TextCodecASCIIFastPath.h"
 #include <mutex>
 #include <ranges>
 #include <wtf/TZoneMallocInlines.h>
@@ -196,7 +197,17 @@ String TextCodecCJK::decodeCommon(std::span<const uint8_t> bytes, bool flush, bo
             return result.toString();
         }
     }
-    for (auto byte : bytes) {
+    while (!bytes.empty()) {
+        // Outside of a multi-byte sequence every decoder maps ASCII to itself.
+        if (!m_lead && !m_prependedByte && !m_gb18030First && !m_gb18030Second && !m_gb18030Third) {
+            if (size_t asciiLength = countLeadingASCII(bytes)) {
+                result.append(bytes.first(asciiLength));
+                skip(bytes, asciiLength);
+                continue;
+            }
+        }
+        auto byte = bytes[0];
+        skip(bytes, 1);
         if (byteParser(byte, result) == SawError::Yes) {
             sawError = true;
             result.append(replacementCharacter);
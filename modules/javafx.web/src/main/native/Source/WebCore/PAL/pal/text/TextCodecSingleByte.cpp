@@ -27,6 +27,7 @@
 #include "TextCodecSingleByte.h"
 
 #include "EncodingTables.h"
+#include "TextCodecASCIIFastPath.h"
 #include <array>
 #include <mutex>
 #include <wtf/IteratorRange.h>
@@ -288,15 +289,17 @@ static String decode(const SingleByteDecodeTable& table, std::span<const uint8_t
             sawError = true;
         result.append(codePoint);
     };
-    if (stopOnError) {
-        for (auto byte : bytes) {
-            parseByte(byte);
-            if (sawError)
-                return result.toString();
+    while (!bytes.empty()) {
+        // Legacy encoded documents are mostly ASCII markup, which maps to itself.
+        if (size_t asciiLength = countLeadingASCII(bytes)) {
+            result.append(bytes.first(asciiLength));
+            skip(bytes, asciiLength);
+            continue;
         }
-    } else {
-        for (auto byte : bytes)
-            parseByte(byte);
+        parseByte(bytes[0]);
+        skip(bytes, 1);
+        if (stopOnError && sawError)
+            return result.toString();
     }
     return result.toString();
 }
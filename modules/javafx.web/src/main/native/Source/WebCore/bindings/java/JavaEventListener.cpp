@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 #include "config.h"
 
+#include "EventNames.h"
+#include "EventTarget.h"
 #include "JavaDOMUtils.h"
 #include <wtf/java/JavaEnv.h>
 #include "JavaEventListener.h"
@@ -50,8 +52,91 @@ bool JavaEventListener::operator==(const EventListener& other) const
     return this == jother;
 }
 
+static bool isCoalescableEventType(const AtomString& type)
+{
+    // Events that fire at a high rate and whose latest occurrence supersedes
+    // the previous ones. Delivery is deferred, so preventDefault() called
+    // by the Java listener has no effect on them.
+    const auto& names = eventNames();
+    return type == names.mousemoveEvent
+        || type == names.pointermoveEvent
+        || type == names.scrollEvent
+        || type == names.resizeEvent
+        || type == names.inputEvent;
+}
+
+bool JavaEventListener::coalesceEvent(Event& event)
+{
+    if (!m_coalesceEvents || !isCoalescableEventType(event.type()))
+        return false;
+
+    auto index = m_coalescedEvents.findIf([&](auto& pending) {
+        return pending->type() == event.type();
+    });
+    if (index != notFound)
+        m_coalescedEvents[index] = Ref { event };
+    else
+        m_coalescedEvents.append(Ref { event });
+
+    if (!m_flushTimer.isActive())
+        m_flushTimer.startOneShot(0_s);
+    return true;
+}
+
+void JavaEventListener::flushCoalescedEvents()
+{
+    m_flushTimer.stop();
+    auto events = std::exchange(m_coalescedEvents, { });
+    if (events.isEmpty())
+        return;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID midFwkHandleEvents(env->GetMethodID(
+        JLClass(env->FindClass("com/sun/webkit/dom/EventListenerImpl")),
+        "fwkHandleEvents",
+        "([J)V"));
+    ASSERT(midFwkHandleEvents);
+
+    JLocalRef<jlongArray> eventPeers(env->NewLongArray(events.size()));
+    if (!eventPeers) {
+        WTF::CheckAndClearException(env);
+        return;
+    }
+    Vector<jlong> peers;
+    peers.reserveInitialCapacity(events.size());
+    for (auto& event : events) {
+        event->ref(); //deref is in EventImpl disposer
+        peers.append(ptr_to_jlong(event.ptr()));
+    }
+    env->SetLongArrayRegion(eventPeers, 0, peers.size(), peers.span().data());
+
+    RefPtr target = events.last()->target();
+    ScriptExecutionContext* context = target ? target->scriptExecutionContext() : nullptr;
+    if (context)
+        sm_vScriptExecutionContexts.append(context);
+
+    env->CallVoidMethod(
+        EventListenerManager::get_instance().getListenerJObject(this),
+        midFwkHandleEvents,
+        (jlongArray)eventPeers);
+
+    if (context)
+        sm_vScriptExecutionContexts.removeLast();
+    WTF::CheckAndClearException(env);
+}
+
 void JavaEventListener::handleEvent(ScriptExecutionContext& context, Event& event)
 {
+    if (coalesceEvent(event))
+        return;
+
+    // Keep the order of delivery with the events that are still pending.
+    if (!m_coalescedEvents.isEmpty()) {
+        Ref protectedThis { *this };
+        flushCoalescedEvents();
+    }
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     //we need to store context for cascade JS EL execution.
@@ -93,9 +178,9 @@ JavaEventListener::~JavaEventListener()
 extern "C" {
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_EventListenerImpl_twkCreatePeer
-    (JNIEnv*, jobject self)
+    (JNIEnv*, jobject self, jboolean coalesceEvents)
 {
-    return ptr_to_jlong(new JavaEventListener(JLObject(self, true)));
+    return ptr_to_jlong(new JavaEventListener(JLObject(self, true), jbool_to_bool(coalesceEvents)));
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_EventListenerImpl_twkDisposeJSPeer
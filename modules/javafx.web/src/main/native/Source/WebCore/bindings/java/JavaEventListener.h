@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include "EventListener.h"
 #include "EventListenerManager.h"
 #include "Node.h"
+#include "Timer.h"
 
 #include <wtf/Vector.h>
 #include <wtf/java/JavaRef.h>
@@ -37,8 +38,10 @@ namespace WebCore {
 
 class JavaEventListener final : public EventListener {
 public:
-    JavaEventListener(const JLObject &listener)
+    JavaEventListener(const JLObject &listener, bool coalesceEvents = false)
         : EventListener(NativeEventListenerType)
+        , m_coalesceEvents(coalesceEvents)
+        , m_flushTimer(*this, &JavaEventListener::flushCoalescedEvents)
     {
         relaxAdoptionRequirement();
         EventListenerManager::get_instance().registerListener(this, listener);
@@ -51,7 +54,16 @@ public:
     static ScriptExecutionContext* scriptExecutionContext();
     bool isJavaEventListener() const override { return true; }
 private:
+    bool coalesceEvent(Event&);
+    void flushCoalescedEvents();
+
     static Vector<ScriptExecutionContext*> sm_vScriptExecutionContexts;
+
+    // When coalescing, only the latest event of each high-frequency type
+    // is kept and they are delivered together in a single upcall.
+    bool m_coalesceEvents;
+    Vector<Ref<Event>> m_coalescedEvents;
+    Timer m_flushTimer;
 };
 
 }; // namespace WebCore
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "CharacterData.h"
+#include "Element.h"
+#include "JSExecState.h"
+#include "JavaDOMUtils.h"
+#include "MutationCallback.h"
+#include "MutationObserver.h"
+#include "MutationRecord.h"
+#include "Node.h"
+#include "NodeList.h"
+#include "ScriptExecutionContext.h"
+#include <wtf/HashMap.h>
+#include <wtf/java/JavaEnv.h>
+
+#include "com_sun_webkit_dom_MutationObserverImpl.h"
+
+namespace WebCore {
+
+// Hands the records of a MutationObserver to its Java MutationObserverImpl.
+// WebCore delivers them once per task, at the microtask checkpoint, so the
+// Java side gets one upcall per task however many mutations there were.
+class JavaMutationCallback final : public MutationCallback {
+public:
+    static Ref<JavaMutationCallback> create(ScriptExecutionContext* context)
+    {
+        return adoptRef(*new JavaMutationCallback(context));
+    }
+
+    // The Java observer is only referenced while it observes something, so
+    // that it can be collected after disconnect().
+    void setObserver(jobject observer) { m_observer = JLObject(observer, true); }
+    void clearObserver() { m_observer.clear(); }
+
+    bool hasCallback() const final { return !!static_cast<jobject>(m_observer); }
+
+    CallbackResult<void> invoke(MutationObserver&, const Vector<Ref<MutationRecord>>&, MutationObserver&) final;
+    CallbackResult<void> invokeRethrowingException(MutationObserver& observer, const Vector<Ref<MutationRecord>>& records, MutationObserver& thisObserver) final
+    {
+        return invoke(observer, records, thisObserver);
+    }
+
+private:
+    explicit JavaMutationCallback(ScriptExecutionContext* context)
+        : MutationCallback(context)
+    {
+    }
+
+    void contextDestroyed() final
+    {
+        clearObserver();
+        MutationCallback::contextDestroyed();
+    }
+
+    JGObject m_observer;
+};
+
+// Record types and layout shared with MutationObserverImpl.java
+enum JavaMutationType {
+    JavaChildList = 1,
+    JavaAttributes = 2,
+    JavaCharacterData = 3
+};
+static const int intsPerRecord = 5;    // type, added, removed, text offset, removed text length
+static const int stringsPerRecord = 4; // attribute name, attribute namespace, old value, value
+
+static JavaMutationType javaMutationType(MutationRecord& record)
+{
+    const auto& type = record.type();
+    if (type == "attributes"_s)
+        return JavaAttributes;
+    if (type == "characterData"_s)
+        return JavaCharacterData;
+    return JavaChildList;
+}
+
+CallbackResult<void> JavaMutationCallback::invoke(MutationObserver&, const Vector<Ref<MutationRecord>>& records, MutationObserver&)
+{
+    if (!hasCallback())
+        return { };
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    Vector<jint> ints(records.size() * intsPerRecord, 0);
+    Vector<RefPtr<Node>> nodes;
+    Vector<String> strings(records.size() * stringsPerRecord);
+
+    // The text of a character data record is sent as the change from its
+    // old value to the value the next record of the same node starts from,
+    // or the current one, so that the deltas of a batch apply in order.
+    HashMap<Node*, String> textAfter;
+
+    for (size_t i = records.size(); i--; ) {
+        auto& record = records[i].get();
+        RefPtr target = record.target();
+        jint* recordInts = ints.mutableSpan().subspan(i * intsPerRecord).data();
+        String* recordStrings = strings.mutableSpan().subspan(i * stringsPerRecord).data();
+
+        recordInts[0] = javaMutationType(record);
+        switch (recordInts[0]) {
+        case JavaAttributes:
+            recordStrings[0] = record.attributeName();
+            recordStrings[1] = record.attributeNamespace();
+            recordStrings[2] = record.oldValue();
+            if (auto* element = dynamicDowncast<Element>(target.get()))
+                recordStrings[3] = element->getAttributeNS(record.attributeNamespace(), record.attributeName());
+            break;
+        case JavaCharacterData: {
+            auto* characterData = dynamicDowncast<CharacterData>(target.get());
+            if (!characterData)
+                break;
+            auto it = textAfter.find(characterData);
+            String after = it != textAfter.end() ? it->value : characterData->data();
+            String before = record.oldValue();
+            if (before.isNull()) {
+                // Without the old value only the whole text can be sent
+                recordInts[4] = -1;
+                recordStrings[3] = after;
+            } else {
+                unsigned prefix = 0;
+                unsigned common = std::min(before.length(), after.length());
+                while (prefix < common && before[prefix] == after[prefix])
+                    prefix++;
+                unsigned suffix = 0;
+                while (suffix < common - prefix
+                    && before[before.length() - suffix - 1] == after[after.length() - suffix - 1])
+                    suffix++;
+                recordInts[3] = prefix;
+                recordInts[4] = before.length() - prefix - suffix;
+                recordStrings[3] = after.substring(prefix, after.length() - prefix - suffix);
+            }
+            if (!before.isNull())
+                textAfter.set(characterData, before);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // Nodes are written in record order: the target, the siblings, then
+    // the added and the removed nodes.
+    for (size_t i = 0; i < records.size(); ++i) {
+        auto& record = records[i].get();
+        nodes.append(record.target());
+        nodes.append(record.previousSibling());
+        nodes.append(record.nextSibling());
+        if (auto* added = record.addedNodes()) {
+            ints[i * intsPerRecord + 1] = added->length();
+            for (unsigned j = 0; j < added->length(); ++j)
+                nodes.append(added->item(j));
+        }
+        if (auto* removed = record.removedNodes()) {
+            ints[i * intsPerRecord + 2] = removed->length();
+            for (unsigned j = 0; j < removed->length(); ++j)
+                nodes.append(removed->item(j));
+        }
+    }
+
+    JLocalRef<jintArray> intArray(env->NewIntArray(ints.size()));
+    JLocalRef<jlongArray> nodeArray(env->NewLongArray(nodes.size()));
+    JLObjectArray stringArray(env->NewObjectArray(strings.size(), JLClass(env->FindClass("java/lang/String")), nullptr));
+    if (!intArray || !nodeArray || !stringArray) {
+        WTF::CheckAndClearException(env);
+        return CallbackResultType::UnableToExecute;
+    }
+    env->SetIntArrayRegion(intArray, 0, ints.size(), ints.span().data());
+    for (size_t i = 0; i < strings.size(); ++i) {
+        if (!strings[i].isNull())
+            env->SetObjectArrayElement(stringArray, i, (jstring)strings[i].toJavaString(env));
+    }
+    // Each node peer holds a reference, which the Java wrapper releases
+    Vector<jlong> peers;
+    peers.reserveInitialCapacity(nodes.size());
+    for (auto& node : nodes)
+        peers.append(ptr_to_jlong(node.leakRef()));
+    env->SetLongArrayRegion(nodeArray, 0, peers.size(), peers.span().data());
+
+    static jmethodID midFwkHandleMutations(env->GetMethodID(
+        JLClass(env->FindClass("com/sun/webkit/dom/MutationObserverImpl")),
+        "fwkHandleMutations",
+        "([I[J[Ljava/lang/String;)V"));
+    ASSERT(midFwkHandleMutations);
+
+    Ref protectedThis { *this };
+    env->CallVoidMethod(
+        m_observer,
+        midFwkHandleMutations,
+        (jintArray)intArray,
+        (jlongArray)nodeArray,
+        (jobjectArray)stringArray);
+    if (WTF::CheckAndClearException(env))
+        return CallbackResultType::ExceptionThrown;
+    return { };
+}
+
+} // namespace WebCore
+
+using namespace WebCore;
+
+extern "C" {
+
+#define IMPL (static_cast<MutationObserver*>(jlong_to_ptr(peer)))
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_MutationObserverImpl_twkCreatePeer
+    (JNIEnv*, jclass, jlong nodePeer)
+{
+    WebCore::JSMainThreadNullState state;
+    auto callback = JavaMutationCallback::create(jlong_to_Nodeptr(nodePeer)->scriptExecutionContext());
+    return ptr_to_jlong(&MutationObserver::create(WTFMove(callback)).leakRef());
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_MutationObserverImpl_twkObserve
+    (JNIEnv* env, jclass, jlong peer, jobject self, jlong nodePeer, jint options, jobjectArray attributeFilter)
+{
+    WebCore::JSMainThreadNullState state;
+    MutationObserver::Init init {
+        !!(options & static_cast<jint>(MutationObserverOptionType::ChildList)),
+        std::nullopt,
+        std::nullopt,
+        !!(options & static_cast<jint>(MutationObserverOptionType::Subtree)),
+        std::nullopt,
+        std::nullopt,
+        std::nullopt
+    };
+    if (options & static_cast<jint>(MutationObserverOptionType::Attributes))
+        init.attributes = true;
+    if (options & static_cast<jint>(MutationObserverOptionType::CharacterData))
+        init.characterData = true;
+    if (options & static_cast<jint>(MutationObserverOptionType::AttributeOldValue))
+        init.attributeOldValue = true;
+    if (options & static_cast<jint>(MutationObserverOptionType::CharacterDataOldValue))
+        init.characterDataOldValue = true;
+    if (attributeFilter) {
+        Vector<AtomString> names;
+        for (jsize i = 0, n = env->GetArrayLength(attributeFilter); i < n; ++i) {
+            JLString name(static_cast<jstring>(env->GetObjectArrayElement(attributeFilter, i)));
+            names.append(AtomString { String(env, name) });
+        }
+        init.attributeFilter = WTFMove(names);
+    }
+
+    auto result = IMPL->observe(*jlong_to_Nodeptr(nodePeer), init);
+    if (!result.hasException())
+        static_cast<JavaMutationCallback&>(IMPL->callback()).setObserver(self);
+    raiseOnDOMError(env, WTFMove(result));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_MutationObserverImpl_twkDisconnect
+    (JNIEnv*, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    IMPL->disconnect();
+    static_cast<JavaMutationCallback&>(IMPL->callback()).clearObserver();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_MutationObserverImpl_twkDispose
+    (JNIEnv*, jclass, jlong peer)
+{
+    IMPL->deref();
+}
+
+#undef IMPL
+
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1264,6 +1264,47 @@ public class ElementImpl extends NodeImpl implements Element {
         , String selectors);
 
 
+// Bulk queries
+    /**
+     * Returns the elements matching {@code selectors}, like
+     * {@link #querySelectorAll}, but fetched in a single native call
+     * rather than one call per {@code NodeList.item}.
+     */
+    public Element[] querySelectorAllElements(String selectors) throws DOMException
+    {
+        long[] peers = querySelectorAllPeersImpl(getPeer()
+            , selectors);
+        if (peers == null) return new Element[0];
+        Element[] result = new Element[peers.length];
+        for (int i = 0; i < peers.length; i++) {
+            result[i] = ElementImpl.getImpl(peers[i]);
+        }
+        return result;
+    }
+    native static long[] querySelectorAllPeersImpl(long peer
+        , String selectors);
+
+
+    /**
+     * Returns the values of the named attributes of every element matching
+     * {@code selectors}, without creating wrappers for the elements.
+     * The values are packed row by row: the value of
+     * {@code attributeNames[j]} on the {@code i}-th match is at index
+     * {@code i * attributeNames.length + j}, and is {@code null} when the
+     * element does not have that attribute.
+     */
+    public String[] querySelectorAllAttributes(String selectors, String... attributeNames) throws DOMException
+    {
+        String[] result = querySelectorAllAttributesImpl(getPeer()
+            , selectors
+            , attributeNames);
+        return result == null ? new String[0] : result;
+    }
+    native static String[] querySelectorAllAttributesImpl(long peer
+        , String selectors
+        , String[] attributeNames);
+
+
 
 //stubs
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,12 @@ import org.w3c.dom.events.EventListener;
 //navive code driven life circle.
 //single time peer usage
 final class EventListenerImpl implements EventListener {
+    // When true, high-frequency events (mousemove, pointermove, scroll,
+    // resize, input) are delivered to Java listeners once per batch with
+    // only the latest event of each type, instead of one call per event.
+    private static final boolean COALESCE_EVENTS = Boolean.valueOf(
+            System.getProperty("com.sun.webkit.coalesceDOMEvents", "false"));
+
     private static final Map<EventListener, Long> EL2peer =
             new WeakHashMap<EventListener, Long>();
     private static final Map<Long, WeakReference<EventListener>> peer2EL =
@@ -71,13 +77,13 @@ final class EventListenerImpl implements EventListener {
 
         //[eventListener] is the Java EventListener.
         EventListenerImpl eli = new EventListenerImpl(eventListener, 0L);
-        peer = eli.twkCreatePeer();
+        peer = eli.twkCreatePeer(COALESCE_EVENTS);
         EL2peer.put(eventListener, peer);
         peer2EL.put(peer, new WeakReference<EventListener>(eventListener));
 
         return peer;
     }
-    private native long twkCreatePeer();
+    private native long twkCreatePeer(boolean coalesceEvents);
 
     private static EventListener getELfromPeer(long peer) {
         WeakReference<EventListener> wr = peer2EL.get(peer);
@@ -131,4 +137,10 @@ final class EventListenerImpl implements EventListener {
     private void fwkHandleEvent(long eventPeer) {
         eventListener.handleEvent(EventImpl.getImpl(eventPeer));
     }
+
+    private void fwkHandleEvents(long[] eventPeers) {
+        for (long eventPeer : eventPeers) {
+            eventListener.handleEvent(EventImpl.getImpl(eventPeer));
+        }
+    }
 }
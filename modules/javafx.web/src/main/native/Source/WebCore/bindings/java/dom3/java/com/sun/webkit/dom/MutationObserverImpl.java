@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.dom;
+
+import com.sun.webkit.Disposer;
+import com.sun.webkit.DisposerRecord;
+import java.util.ArrayList;
+import java.util.List;
+import org.w3c.dom.Node;
+
+/**
+ * Streams the changes of a DOM subtree to Java through a WebCore
+ * MutationObserver. The mutations made during a task are delivered in one
+ * batch when the task ends, so a copy of a document can be kept up to date
+ * without traversing it again. Like the other DOM classes, it is used on the
+ * JavaFX application thread.
+ */
+public final class MutationObserverImpl {
+
+    // The options of observe(), which have the values of WebCore's
+    // MutationObserverOptionType
+    public static final int CHILD_LIST = 1 << 0;
+    public static final int ATTRIBUTES = 1 << 1;
+    public static final int CHARACTER_DATA = 1 << 2;
+    public static final int SUBTREE = 1 << 3;
+    public static final int ATTRIBUTE_OLD_VALUE = 1 << 5;
+    public static final int CHARACTER_DATA_OLD_VALUE = 1 << 6;
+
+    public enum Type {
+        CHILD_LIST,
+        ATTRIBUTES,
+        CHARACTER_DATA
+    }
+
+    private static final Type[] TYPES = Type.values();
+
+    /**
+     * A mutation. An attribute record has the current value of the
+     * attribute as its value. A character data record has the change of the
+     * text: textRemoved characters at textOffset were replaced by value. If
+     * the old value was not observed, textRemoved is -1 and value is the
+     * whole text. Applying the records of a batch in order brings a copy of
+     * the text up to date.
+     */
+    public record Record(Type type, Node target, Node previousSibling, Node nextSibling,
+                         List<Node> addedNodes, List<Node> removedNodes,
+                         String attributeName, String attributeNamespace,
+                         String oldValue, String value, int textOffset, int textRemoved) {
+    }
+
+    @FunctionalInterface
+    public interface Listener {
+        void mutated(List<Record> records);
+    }
+
+    private static final class SelfDisposer implements DisposerRecord {
+        private final long peer;
+        private SelfDisposer(long peer) {
+            this.peer = peer;
+        }
+
+        @Override
+        public void dispose() {
+            twkDispose(peer);
+        }
+    }
+
+    private final Listener listener;
+    private long peer;
+
+    public MutationObserverImpl(Listener listener) {
+        if (listener == null) {
+            throw new NullPointerException("listener");
+        }
+        this.listener = listener;
+    }
+
+    /**
+     * Starts observing target with the given options, or changes the
+     * options target is observed with.
+     *
+     * @throws org.w3c.dom.DOMException if the options are not valid
+     */
+    public void observe(Node target, int options, String... attributeFilter) {
+        if (target == null) {
+            throw new NullPointerException("target");
+        }
+        if (peer == 0L) {
+            peer = twkCreatePeer(NodeImpl.getPeer(target));
+            Disposer.addRecord(this, new SelfDisposer(peer));
+        }
+        twkObserve(peer, this, NodeImpl.getPeer(target), options,
+                attributeFilter.length > 0 ? attributeFilter : null);
+    }
+
+    /**
+     * Stops observing all nodes. Pending mutations are dropped.
+     */
+    public void disconnect() {
+        if (peer != 0L) {
+            twkDisconnect(peer);
+        }
+    }
+
+    // Each record has five ints (type, added and removed node counts, text
+    // offset, removed text length), its target, siblings, added and removed
+    // nodes, and four strings (attribute name and namespace, old value, value)
+    private void fwkHandleMutations(int[] ints, long[] nodes, String[] strings) {
+        List<Record> records = new ArrayList<>(ints.length / 5);
+        int n = 0;
+        for (int i = 0, s = 0; i < ints.length; i += 5, s += 4) {
+            Node target = NodeImpl.getImpl(nodes[n++]);
+            Node previousSibling = NodeImpl.getImpl(nodes[n++]);
+            Node nextSibling = NodeImpl.getImpl(nodes[n++]);
+            Node[] added = new Node[ints[i + 1]];
+            for (int j = 0; j < added.length; j++) {
+                added[j] = NodeImpl.getImpl(nodes[n++]);
+            }
+            Node[] removed = new Node[ints[i + 2]];
+            for (int j = 0; j < removed.length; j++) {
+                removed[j] = NodeImpl.getImpl(nodes[n++]);
+            }
+            records.add(new Record(TYPES[ints[i] - 1], target, previousSibling, nextSibling,
+                    List.of(added), List.of(removed),
+                    strings[s], strings[s + 1], strings[s + 2], strings[s + 3],
+                    ints[i + 3], ints[i + 4]));
+        }
+        listener.mutated(records);
+    }
+
+    private static native long twkCreatePeer(long nodePeer);
+    private static native void twkObserve(long peer, MutationObserverImpl self, long nodePeer,
+                                          int options, String[] attributeFilter);
+    private static native void twkDisconnect(long peer);
+    private static native void twkDispose(long peer);
+}
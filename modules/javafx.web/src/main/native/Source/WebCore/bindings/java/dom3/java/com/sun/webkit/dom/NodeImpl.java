@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,9 +42,20 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
     // because the latter requires 2 extra objects for each entry:
     // a Long for the key plus a Map.Entry.  Since we have a 'next'
     // field already in the SelfDisposer, we can use it as the entry.
-    private static SelfDisposer[] hashTable = new SelfDisposer[64];
+    private static final int MIN_TABLE_SIZE = 64;
+    private static SelfDisposer[] hashTable = new SelfDisposer[MIN_TABLE_SIZE];
     private static int hashCount;
 
+    // Indices in the array returned by getPeerCacheCounters()
+    public static final int PEER_CREATED_COUNT = 0;
+    public static final int PEER_REUSED_COUNT = 1;
+    public static final int PEER_DISPOSED_COUNT = 2;
+    public static final int PEER_LIVE_COUNT = 3;
+
+    private static long createdCount;
+    private static long reusedCount;
+    private static long disposedCount;
+
     private static int hashPeer(long peer) {
         return (int) (~peer ^ (peer >> 7)) & (hashTable.length-1);
     }
@@ -62,12 +73,18 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
                 if (node != null) {
                     // the peer need to be deref'ed!
                     NodeImpl.dispose(peer);
+                    reusedCount++;
                     return node;
                 }
+                // The wrapper has been collected but not disposed yet,
+                // its disposer will release its own reference to the peer.
                 if (prev != null)
                     prev.next = next;
                 else
                     hashTable[hash] = next;
+                if (head == disposer)
+                    head = next;
+                hashCount--;
                 break;
             }
             prev = disposer;
@@ -79,8 +96,9 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
         disposer.next = head;
         hashTable[hash] = disposer;
         if (3 * hashCount >= 2 * hashTable.length)
-            rehash();
+            rehash(2 * hashTable.length);
         hashCount++;
+        createdCount++;
         return node;
     }
 
@@ -88,10 +106,22 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
         return hashCount;
     }
 
-    private static void rehash() {
+    /**
+     * Returns the counters of the cache that maps native nodes to their
+     * Java wrappers: the number of wrappers created, the number of lookups
+     * that returned an existing wrapper, the number of wrappers disposed
+     * after having been garbage collected and the number of wrappers
+     * currently in the cache.
+     * Must be called on the Event thread.
+     */
+    public static long[] getPeerCacheCounters() {
+        return new long[] { createdCount, reusedCount, disposedCount, hashCount };
+    }
+
+    private static void rehash(int newLength) {
         SelfDisposer[] oldTable = hashTable;
         int oldLength = oldTable.length;
-        SelfDisposer[] newTable = new SelfDisposer[2*oldLength];
+        SelfDisposer[] newTable = new SelfDisposer[newLength];
         hashTable = newTable;
         for (int i = oldLength; --i >= 0; ) {
             for (SelfDisposer disposer = oldTable[i];
@@ -120,7 +150,7 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
             SelfDisposer prev = null;
             for (SelfDisposer disposer = head; disposer != null;) {
                 SelfDisposer next = disposer.next;
-                if (disposer.peer == peer) {
+                if (disposer == this) {
                     disposer.clear();
                     if (prev != null)
                         prev.next = next;
@@ -132,6 +162,10 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
                 prev = disposer;
                 disposer = next;
             }
+            // Give the memory back once a large traversal has been collected.
+            if (hashTable.length > MIN_TABLE_SIZE && 8 * hashCount < hashTable.length)
+                rehash(hashTable.length / 2);
+            disposedCount++;
             NodeImpl.dispose(peer);
         }
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,6 +52,8 @@
 #include <JavaScriptCore/OpaqueJSString.h>
 #include <JavaScriptCore/JSBase.h>
 #include <JavaScriptCore/JSStringRef.h>
+#include <JavaScriptCore/JSTypedArray.h>
+#include <JavaScriptCore/ArrayBuffer.h>
 
 #include "com_sun_webkit_dom_JSObject.h"
 
@@ -106,6 +108,11 @@ static jclass getStringClass (JNIEnv *env)
     FIND_CACHE_CLASS(env, "java/lang/String");
 }
 
+static jclass getByteBufferClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "java/nio/ByteBuffer");
+}
+
 static jclass getNullPointerExceptionClass (JNIEnv *env)
 {
     FIND_CACHE_CLASS(env, "java/lang/NullPointerException");
@@ -134,6 +141,52 @@ JSStringRef asJSStringRef(JNIEnv *env, jstring str)
     return name;
 }
 
+static void releaseSharedByteBuffer(void*, void* globalRef)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (env)
+        env->DeleteGlobalRef(static_cast<jobject>(globalRef));
+}
+
+/*
+ * Returns an ArrayBuffer with the remaining bytes of a ByteBuffer. A writable
+ * direct buffer is aliased and kept reachable until the ArrayBuffer is
+ * collected, any other buffer is copied.
+ */
+static JSValueRef ByteBuffer_to_JSValue(JNIEnv *env, JSContextRef ctx, jobject val)
+{
+    jint position = JSC::Bindings::callJNIMethod<jint>(val, "position", "()I");
+    jint limit = JSC::Bindings::callJNIMethod<jint>(val, "limit", "()I");
+    jboolean readOnly = JSC::Bindings::callJNIMethod<jboolean>(val, "isReadOnly", "()Z");
+    size_t length = limit > position ? limit - position : 0;
+
+    uint8_t* address = static_cast<uint8_t*>(env->GetDirectBufferAddress(val));
+    if (address && !readOnly) {
+        jobject globalRef = env->NewGlobalRef(val);
+        if (!globalRef)
+            return JSValueMakeNull(ctx);
+        return JSObjectMakeArrayBufferWithBytesNoCopy(ctx, address + position, length,
+            releaseSharedByteBuffer, globalRef, nullptr);
+    }
+
+    void* bytes = fastMalloc(length ? length : 1);
+    if (address) {
+        memcpy(bytes, address + position, length);
+    } else {
+        JLocalRef<jbyteArray> array(env->NewByteArray(length));
+        if (!array) {
+            fastFree(bytes);
+            return JSValueMakeNull(ctx);
+        }
+        // Absolute bulk get, so the position of the buffer is left alone.
+        JLObject self(JSC::Bindings::callJNIMethod<jobject>(val, "get", "(I[BII)Ljava/nio/ByteBuffer;",
+            position, (jbyteArray)array, 0, (jint)length));
+        env->GetByteArrayRegion(array, 0, length, static_cast<jbyte*>(bytes));
+    }
+    return JSObjectMakeArrayBufferWithBytesNoCopy(ctx, bytes, length,
+        [](void* bytes, void*) { fastFree(bytes); }, nullptr, nullptr);
+}
+
 JSValueRef Java_Object_to_JSValue(
     JNIEnv *env,
     JSContextRef ctx,
@@ -189,6 +242,9 @@ JSValueRef Java_Object_to_JSValue(
         jdouble value = env->CallDoubleMethod(val, doubleValueMethod);
         return JSValueMakeNumber(ctx, value);
     }
+    if (env->IsInstanceOf(val, getByteBufferClass(env)) && JSC::Bindings::isBufferSharingEnabled(env)) {
+        return ByteBuffer_to_JSValue(env, ctx, val);
+    }
 
     JLObject valClass(JSC::Bindings::callJNIMethod<jobject>(val, "getClass", "()Ljava/lang/Class;"));
     if (JSC::Bindings::callJNIMethod<jboolean>(valClass, "isArray", "()Z")) {
@@ -490,6 +546,19 @@ JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_JSObject_callImpl
     return WebCore::JSValue_to_Java_Object(result, env, ctx, rootObject.get());
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_releaseBufferImpl
+(JNIEnv*, jclass, jlong arrayBuffer)
+{
+    JSC::ArrayBuffer* buffer = static_cast<JSC::ArrayBuffer*>(jlong_to_ptr(arrayBuffer));
+    if (!buffer) {
+        return;
+    }
+
+    // Pinned and referenced in convertArrayBufferToByteBuffer
+    buffer->unpin();
+    buffer->deref();
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_unprotectImpl
 (JNIEnv*, jclass, jlong peer, jint peer_type)
 {
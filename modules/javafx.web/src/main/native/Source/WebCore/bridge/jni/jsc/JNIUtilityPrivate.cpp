@@ -34,7 +34,10 @@
 #include "runtime_object.h"
 #include "runtime_root.h"
 #include <JavaScriptCore/JSArray.h>
+#include <JavaScriptCore/JSArrayBuffer.h>
+#include <JavaScriptCore/JSArrayBufferViewInlines.h>
 #include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/JSTypedArrays.h>
 
 #include "JavaArrayJSC.h"
 #include "JavaInstanceJSC.h"
@@ -61,6 +64,144 @@ static jchar toJCharValue(const JSValue& value, JSGlobalObject* globalObject)
     return (jchar)value.toNumber(globalObject);
 }
 
+// Builds a new Java primitive array from a JS typed array or array. A typed
+// array with the same element layout is copied with a single JNI call; any
+// other array is converted element by element into native memory first, so
+// that the Java array is still filled with one call.
+template<typename ViewClass, typename JArray, typename JType, typename Convert>
+static JArray toJavaPrimitiveArray(JSGlobalObject* globalObject, JSObject* object,
+    JArray (JNIEnv::*newArray)(jsize), void (JNIEnv::*setRegion)(JArray, jsize, jsize, const JType*), Convert&& convert)
+{
+    static_assert(sizeof(typename ViewClass::ElementType) == sizeof(JType));
+
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    JNIEnv* env = getJNIEnv();
+
+    if (auto* view = jsDynamicCast<ViewClass*>(object)) {
+        if (view->isOutOfBounds() || view->length() > static_cast<size_t>(std::numeric_limits<jsize>::max()))
+            return nullptr;
+        jsize length = view->length();
+        JArray array = (env->*newArray)(length);
+        if (!array)
+            return nullptr;
+        (env->*setRegion)(array, 0, length, reinterpret_cast<const JType*>(view->typedVector()));
+        return array;
+    }
+
+    size_t length;
+    if (auto* view = jsDynamicCast<JSArrayBufferView*>(object))
+        length = view->length();
+    else if (auto* jsArray = jsDynamicCast<JSArray*>(object))
+        length = jsArray->length();
+    else
+        return nullptr;
+    if (length > static_cast<size_t>(std::numeric_limits<jsize>::max()))
+        return nullptr;
+
+    Vector<JType> elements(length);
+    for (size_t i = 0; i < length; i++) {
+        JSValue element = object->get(globalObject, static_cast<unsigned>(i));
+        RETURN_IF_EXCEPTION(scope, nullptr);
+        elements[i] = convert(element);
+        RETURN_IF_EXCEPTION(scope, nullptr);
+    }
+    JArray array = (env->*newArray)(length);
+    if (!array)
+        return nullptr;
+    (env->*setRegion)(array, 0, length, elements.data());
+    return array;
+}
+
+bool isBufferSharingEnabled(JNIEnv* env)
+{
+    static JGClass jsObjectClass(env->FindClass(JSOBJECT_CLASSNAME));
+    static jfieldID shareBuffersID = env->GetStaticFieldID(jsObjectClass, "SHARE_BUFFERS", "Z");
+    return shareBuffersID && env->GetStaticBooleanField(jsObjectClass, shareBuffersID);
+}
+
+// Returns a direct ByteBuffer over the memory of a JS ArrayBuffer, typed
+// array or DataView, or null if the object is none of these or its memory
+// can move. The ArrayBuffer is pinned so that it cannot be detached or
+// transferred while Java holds the buffer; JSObject.releaseBufferImpl undoes
+// that once the buffer is collected.
+static jobject convertArrayBufferToByteBuffer(JSObject* object)
+{
+    RefPtr<ArrayBuffer> buffer;
+    size_t byteOffset = 0;
+    size_t byteLength = 0;
+    if (auto* jsBuffer = jsDynamicCast<JSArrayBuffer*>(object)) {
+        buffer = jsBuffer->impl();
+        if (buffer)
+            byteLength = buffer->byteLength();
+    } else if (auto* view = jsDynamicCast<JSArrayBufferView*>(object)) {
+        if (view->isDetached() || view->isOutOfBounds() || view->isResizableOrGrowableShared())
+            return nullptr;
+        buffer = view->possiblySharedBuffer();
+        byteOffset = view->byteOffset();
+        byteLength = view->byteLength();
+    }
+    if (!buffer || buffer->isDetached() || buffer->isResizableOrGrowableShared()
+        || byteLength > static_cast<size_t>(std::numeric_limits<jlong>::max()))
+        return nullptr;
+
+    JNIEnv* env = getJNIEnv();
+    JLObject byteBuffer(env->NewDirectByteBuffer(static_cast<uint8_t*>(buffer->data()) + byteOffset, byteLength));
+    if (!byteBuffer)
+        return nullptr;
+
+    static JGClass jsObjectClass(env->FindClass(JSOBJECT_CLASSNAME));
+    static jmethodID shareBufferID = env->GetStaticMethodID(jsObjectClass, "fwkShareBuffer",
+        "(Ljava/nio/ByteBuffer;J)Ljava/nio/ByteBuffer;");
+    if (!shareBufferID)
+        return nullptr;
+
+    buffer->pin();
+    ArrayBuffer* peer = buffer.leakRef(); // deref is in JSObject.BufferDisposer
+    jobject result = env->CallStaticObjectMethod(jsObjectClass, shareBufferID, (jobject)byteBuffer, ptr_to_jlong(peer));
+    if (!result) {
+        peer->unpin();
+        peer->deref();
+    }
+    return result;
+}
+
+static jarray convertObjectToJavaPrimitiveArray(JSGlobalObject* globalObject, JSObject* object, const char* javaClassName)
+{
+    // Only one-dimensional primitive arrays, i.e. "[D", "[I" and so on.
+    if (!javaClassName || javaClassName[0] != '[' || !javaClassName[1] || javaClassName[2])
+        return nullptr;
+
+    switch (javaClassName[1]) {
+    case 'Z':
+        return toJavaPrimitiveArray<JSUint8Array>(globalObject, object, &JNIEnv::NewBooleanArray, &JNIEnv::SetBooleanArrayRegion,
+            [&](JSValue v) { return (jboolean)v.toNumber(globalObject); });
+    case 'B':
+        return toJavaPrimitiveArray<JSInt8Array>(globalObject, object, &JNIEnv::NewByteArray, &JNIEnv::SetByteArrayRegion,
+            [&](JSValue v) { return (jbyte)v.toNumber(globalObject); });
+    case 'C':
+        return toJavaPrimitiveArray<JSUint16Array>(globalObject, object, &JNIEnv::NewCharArray, &JNIEnv::SetCharArrayRegion,
+            [&](JSValue v) { return toJCharValue(v, globalObject); });
+    case 'S':
+        return toJavaPrimitiveArray<JSInt16Array>(globalObject, object, &JNIEnv::NewShortArray, &JNIEnv::SetShortArrayRegion,
+            [&](JSValue v) { return (jshort)v.toNumber(globalObject); });
+    case 'I':
+        return toJavaPrimitiveArray<JSInt32Array>(globalObject, object, &JNIEnv::NewIntArray, &JNIEnv::SetIntArrayRegion,
+            [&](JSValue v) { return (jint)v.toNumber(globalObject); });
+    case 'J':
+        return toJavaPrimitiveArray<JSBigInt64Array>(globalObject, object, &JNIEnv::NewLongArray, &JNIEnv::SetLongArrayRegion,
+            [&](JSValue v) { return (jlong)v.toNumber(globalObject); });
+    case 'F':
+        return toJavaPrimitiveArray<JSFloat32Array>(globalObject, object, &JNIEnv::NewFloatArray, &JNIEnv::SetFloatArrayRegion,
+            [&](JSValue v) { return (jfloat)v.toNumber(globalObject); });
+    case 'D':
+        return toJavaPrimitiveArray<JSFloat64Array>(globalObject, object, &JNIEnv::NewDoubleArray, &JNIEnv::SetDoubleArrayRegion,
+            [&](JSValue v) { return (jdouble)v.toNumber(globalObject); });
+    default:
+        return nullptr;
+    }
+}
+
 jobject convertUndefinedToJObject()
 {
     static JGObject jgoUndefined;
@@ -115,6 +256,14 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                         return result;
                     }
                     result.l = array->javaArray();
+                } else if ((!strcmp(javaClassName, "java.nio.ByteBuffer") || !strcmp(javaClassName, "java.lang.Object"))
+                           && (object->inherits(JSArrayBuffer::info()) || object->inherits(JSArrayBufferView::info()))
+                           && isBufferSharingEnabled(getJNIEnv())) {
+                    // Share the memory of an ArrayBuffer or typed array as a direct buffer
+                    result.l = convertArrayBufferToByteBuffer(object);
+                } else if (javaType == JavaTypeArray) {
+                    // A JS typed array or array passed where Java expects a primitive array
+                    result.l = convertObjectToJavaPrimitiveArray(globalObject, object, javaClassName);
                 } else if ((!result.l && (!strcmp(javaClassName, "java.lang.Object")))
                            || (!strcmp(javaClassName, "netscape.javascript.JSObject"))) {
                     // Wrap objects in JSObject instances.
@@ -304,7 +453,7 @@ jobject jvalueToJObject(jvalue value, JavaType jtype) {
     }
 }
 
-jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
+jthrowable dispatchJNICall(int count, RootObject* rootObject, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
 
     // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
     JLObject jlinstance(obj, true);
@@ -315,18 +464,32 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
-    jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
-    for (int i = 0;  i < count; i++)
-      env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
+    JLClass objClass(env->GetObjectClass(obj));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, isStatic));
+    return dispatchJNICall(count, rootObject, obj, rmethod, returnType, args, result, accessControlContext);
+}
+
+jthrowable dispatchJNICall(int count, RootObject*, jobject obj, jobject rmethod, JavaType returnType, jobject* args, jvalue& result, jobject accessControlContext) {
+
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+
+    if (!jlinstance || !rmethod) {
+        LOG_ERROR("Could not get javaInstance for %p in JNIUtilityPrivate::dispatchJNICall", (jobject)jlinstance);
+        return NULL;
+    }
+
+    JNIEnv* env = getJNIEnv();
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    static jmethodID invokeMethod =
         env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
                                "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+    JLObjectArray argsArray(env->NewObjectArray(count, objectCls, NULL));
+    for (int i = 0;  i < count; i++)
+      env->SetObjectArrayElement(argsArray, i, args[i]);
     jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
+                                            rmethod, obj, (jobjectArray)argsArray,
                                             accessControlContext);
 
     jthrowable ex = env->ExceptionOccurred();
@@ -345,33 +508,54 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
         result.l = r;
         break;
 
-    case JavaTypeBoolean:
-        result.z = callJNIMethod<jboolean>(r, "booleanValue", "()Z");
+    case JavaTypeBoolean: {
+        static JGClass clsZ(env->FindClass("java/lang/Boolean"));
+        static jmethodID booleanValue = env->GetMethodID(clsZ, "booleanValue", "()Z");
+        result.z = r ? env->CallBooleanMethod(r, booleanValue) : 0;
         break;
+    }
 
-    case JavaTypeByte:
-        result.b = callJNIMethod<jbyte>(r, "byteValue", "()B");
+    case JavaTypeByte: {
+        static JGClass clsB(env->FindClass("java/lang/Byte"));
+        static jmethodID byteValue = env->GetMethodID(clsB, "byteValue", "()B");
+        result.b = r ? env->CallByteMethod(r, byteValue) : 0;
         break;
+    }
 
-    case JavaTypeShort:
-        result.s = callJNIMethod<jshort>(r, "shortValue", "()S");
+    case JavaTypeShort: {
+        static JGClass clsS(env->FindClass("java/lang/Short"));
+        static jmethodID shortValue = env->GetMethodID(clsS, "shortValue", "()S");
+        result.s = r ? env->CallShortMethod(r, shortValue) : 0;
         break;
+    }
 
-    case JavaTypeInt:
-        result.i = callJNIMethod<jint>(r, "intValue", "()I");
+    case JavaTypeInt: {
+        static JGClass clsI(env->FindClass("java/lang/Integer"));
+        static jmethodID intValue = env->GetMethodID(clsI, "intValue", "()I");
+        result.i = r ? env->CallIntMethod(r, intValue) : 0;
         break;
+    }
 
-    case JavaTypeLong:
-        result.j = callJNIMethod<jlong>(r, "longValue", "()J");
+    case JavaTypeLong: {
+        static JGClass clsJ(env->FindClass("java/lang/Long"));
+        static jmethodID longValue = env->GetMethodID(clsJ, "longValue", "()J");
+        result.j = r ? env->CallLongMethod(r, longValue) : 0;
         break;
+    }
 
-    case JavaTypeFloat:
-        result.f = callJNIMethod<jfloat>(r, "floatValue", "()F");
+    case JavaTypeFloat: {
+        static JGClass clsF(env->FindClass("java/lang/Float"));
+        static jmethodID floatValue = env->GetMethodID(clsF, "floatValue", "()F");
+        result.f = r ? env->CallFloatMethod(r, floatValue) : 0;
         break;
+    }
 
-    case JavaTypeDouble:
-        result.d = callJNIMethod<jdouble>(r, "doubleValue", "()D");
+    case JavaTypeDouble: {
+        static JGClass clsD(env->FindClass("java/lang/Double"));
+        static jmethodID doubleValue = env->GetMethodID(clsD, "doubleValue", "()D");
+        result.d = r ? env->CallDoubleMethod(r, doubleValue) : 0;
         break;
+    }
 
     case JavaTypeInvalid:
         /* Nothing to do */
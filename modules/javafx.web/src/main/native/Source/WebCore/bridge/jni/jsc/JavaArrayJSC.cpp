@@ -36,6 +36,8 @@
 #include "runtime_object.h"
 #include "runtime_root.h"
 #include <JavaScriptCore/Error.h>
+#include <JavaScriptCore/JSGlobalObjectInlines.h>
+#include <JavaScriptCore/JSTypedArrays.h>
 
 #include "Logging.h"
 
@@ -43,11 +45,80 @@ using namespace JSC;
 using namespace JSC::Bindings;
 using namespace WebCore;
 
+// Set with the com.sun.webkit.primitiveArraysAsTypedArrays property.
+static bool primitiveArraysAsTypedArrays()
+{
+    static const bool enabled = [] {
+        JNIEnv* env = getJNIEnv();
+        JLClass utilitiesClass(env->FindClass("com/sun/webkit/Utilities"));
+        if (!utilitiesClass) {
+            env->ExceptionClear();
+            return false;
+        }
+        jfieldID fid = env->GetStaticFieldID(utilitiesClass, "PRIMITIVE_ARRAYS_AS_TYPED_ARRAYS", "Z");
+        if (!fid) {
+            env->ExceptionClear();
+            return false;
+        }
+        return static_cast<bool>(env->GetStaticBooleanField(utilitiesClass, fid));
+    }();
+    return enabled;
+}
+
+template<typename ViewClass, typename JArray, typename JType>
+static JSValue toTypedArrayCopy(JSGlobalObject* globalObject, jobject anObject, void (JNIEnv::*getRegion)(JArray, jsize, jsize, JType*))
+{
+    static_assert(sizeof(typename ViewClass::ElementType) == sizeof(JType));
+
+    JNIEnv* env = getJNIEnv();
+    JArray array = static_cast<JArray>(anObject);
+    jsize length = env->GetArrayLength(array);
+    auto* view = ViewClass::createUninitialized(globalObject,
+        globalObject->typedArrayStructure(ViewClass::TypedArrayStorageType, false), length);
+    if (!view)
+        return { };
+    if (length)
+        (env->*getRegion)(array, 0, length, reinterpret_cast<JType*>(view->typedVector()));
+    return view;
+}
+
+// Copies a one-dimensional numeric Java array into a new typed array with a
+// single JNI call. boolean[] and long[] are left alone, as neither maps onto
+// a typed array holding the same JS values.
+static JSValue convertJObjectToTypedArray(JSGlobalObject* globalObject, jobject anObject, const char* type)
+{
+    if (!type[1] || type[2])
+        return { };
+
+    switch (type[1]) {
+    case 'B':
+        return toTypedArrayCopy<JSInt8Array>(globalObject, anObject, &JNIEnv::GetByteArrayRegion);
+    case 'C':
+        return toTypedArrayCopy<JSUint16Array>(globalObject, anObject, &JNIEnv::GetCharArrayRegion);
+    case 'S':
+        return toTypedArrayCopy<JSInt16Array>(globalObject, anObject, &JNIEnv::GetShortArrayRegion);
+    case 'I':
+        return toTypedArrayCopy<JSInt32Array>(globalObject, anObject, &JNIEnv::GetIntArrayRegion);
+    case 'F':
+        return toTypedArrayCopy<JSFloat32Array>(globalObject, anObject, &JNIEnv::GetFloatArrayRegion);
+    case 'D':
+        return toTypedArrayCopy<JSFloat64Array>(globalObject, anObject, &JNIEnv::GetDoubleArrayRegion);
+    default:
+        return { };
+    }
+}
+
 JSValue JavaArray::convertJObjectToArray(JSGlobalObject* globalObject, jobject anObject, const char* type, RefPtr<RootObject>&& rootObject, jobject accessControlContext)
 {
     if (type[0] != '[')
         return jsUndefined();
 
+    if (primitiveArraysAsTypedArrays()) {
+        JSValue typedArray = convertJObjectToTypedArray(globalObject, anObject, type);
+        if (typedArray)
+            return typedArray;
+    }
+
     return RuntimeArray::create(globalObject, new JavaArray(anObject, type, WTFMove(rootObject), accessControlContext));
 }
 
@@ -66,6 +66,8 @@ JavaMethod::JavaMethod(JNIEnv* env, jobject aMethod)
             if (!parameterName)
                 parameterName = env->NewStringUTF("<Unknown>");
             m_parameters.append(JavaString(env, parameterName).impl());
+            m_parameterClassNames.append(m_parameters.last().utf8());
+            m_parameterTypes.append(javaTypeFromClassName(m_parameterClassNames.last().data()));
             env->DeleteLocalRef(aParameter);
             env->DeleteLocalRef(parameterName);
         }
@@ -111,14 +113,14 @@ const char* JavaMethod::signature() const
         StringBuilder signatureBuilder;
         signatureBuilder.append('(');
         for (unsigned int i = 0; i < m_parameters.size(); i++) {
-            CString javaClassName = parameterAt(i).utf8();
-            JavaType type = javaTypeFromClassName(javaClassName.data());
+            const char* javaClassName = parameterClassNameAt(i);
+            JavaType type = parameterTypeAt(i);
             if (type == JavaTypeArray)
-                appendClassName(signatureBuilder, javaClassName.data());
+                appendClassName(signatureBuilder, javaClassName);
             else {
                 signatureBuilder.append(ASCIILiteral::fromLiteralUnsafe(signatureFromJavaType(type)));
                 if (type == JavaTypeObject) {
-                    appendClassName(signatureBuilder, javaClassName.data());
+                    appendClassName(signatureBuilder, javaClassName);
                     signatureBuilder.append(';');
                 }
             }
@@ -143,4 +145,20 @@ const char* JavaMethod::signature() const
     return m_signature;
 }
 
+// The method belongs to the JavaClass of a single instance, so the method
+// resolved against the first receiver is the one for every later call.
+jobject JavaMethod::reflectedMethod(jobject obj) const
+{
+    if (!m_reflectedMethod) {
+        JNIEnv* env = getJNIEnv();
+        jmethodID methodId = getMethodID(obj, m_name.utf8(), signature());
+        if (!methodId)
+            return nullptr;
+
+        JLClass objClass(env->GetObjectClass(obj));
+        m_reflectedMethod = JLObject(env->ToReflectedMethod(objClass, methodId, m_isStatic));
+    }
+    return m_reflectedMethod;
+}
+
 #endif // ENABLE(JAVA_BRIDGE)
@@ -47,20 +47,29 @@ public:
     const String name() const { return m_name.impl(); }
     RuntimeType returnTypeClassName() const { return m_returnTypeClassName.utf8(); }
     const String parameterAt(int i) const { return m_parameters[i]; }
+    JavaType parameterTypeAt(int i) const { return m_parameterTypes[i]; }
+    const char* parameterClassNameAt(int i) const { return m_parameterClassNames[i].data(); }
     const char* signature() const;
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
+    jobject reflectedMethod(jobject) const;
 
     // Method implementation
     int numParameters() const { return m_parameters.size(); }
 
 private:
     Vector<WTF::String> m_parameters;
+    // Resolved once so that a call does not have to derive the argument
+    // conversions from the parameter class names again.
+    Vector<JavaType> m_parameterTypes;
+    Vector<CString> m_parameterClassNames;
     JavaString m_name;
     mutable char* m_signature;
     JavaString m_returnTypeClassName;
     JavaType m_returnType;
     bool m_isStatic;
+    // Created lazily on the first call.
+    mutable JGObject m_reflectedMethod;
 };
 
 } // namespace Bindings
@@ -1881,7 +1881,7 @@ ExceptionOr<void> CanvasRenderingContext2DBase::drawImage(HTMLVideoElement& vide
 
     bool repaintEntireCanvas = rectContainsCanvas(normalizedDstRect);
 
-#if USE(CG)
+#if USE(CG) || PLATFORM(JAVA)
     if (c->hasPlatformContext() && video.shouldGetNativeImageForCanvasDrawing()) {
     if (auto image = video.nativeImageForCurrentTime()) {
             c->drawNativeImage(*image, normalizedDstRect, normalizedSrcRect);
@@ -2294,7 +2294,7 @@ ExceptionOr<RefPtr<CanvasPattern>> CanvasRenderingContext2DBase::createPattern(H
     checkOrigin(&videoElement);
     bool originClean = canvasBase().originClean();
 
-#if USE(CG)
+#if USE(CG) || PLATFORM(JAVA)
     if (auto nativeImage = videoElement.nativeImageForCurrentTime())
         return RefPtr<CanvasPattern> { CanvasPattern::create({ nativeImage.releaseNonNull() }, repeatX, repeatY, originClean) };
 #endif
@@ -100,9 +100,9 @@ public:
         }
 
 #if PLATFORM(JAVA)
-        static Ref<ComplexTextRun> create(JLObject jRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
+        static Ref<ComplexTextRun> create(std::span<const jint> packedRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
         {
-            return adoptRef(*new ComplexTextRun(jRun, font, characters, stringLocation, stringLength));
+            return adoptRef(*new ComplexTextRun(packedRun, font, characters, stringLocation, stringLength));
         }
 #endif
 
@@ -140,7 +140,7 @@ public:
         ComplexTextRun(CTRunRef, const Font&, std::span<const char16_t> characters, unsigned stringLocation, unsigned indexBegin, unsigned indexEnd);
         ComplexTextRun(hb_buffer_t*, const Font&, std::span<const char16_t> characters, unsigned stringLocation, unsigned indexBegin, unsigned indexEnd);
 #if PLATFORM(JAVA)
-        ComplexTextRun(JLObject, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength);
+        ComplexTextRun(std::span<const jint> packedRun, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength);
 #endif
         ComplexTextRun(const Font&, std::span<const char16_t> characters, unsigned stringLocation, unsigned indexBegin, unsigned indexEnd, bool ltr);
         WEBCORE_EXPORT ComplexTextRun(const Vector<FloatSize>& advances, const Vector<FloatPoint>& origins, const Vector<Glyph>& glyphs, const Vector<unsigned>& stringIndices, FloatSize initialAdvance, const Font&, std::span<const char16_t> characters, unsigned stringLocation, unsigned indexBegin, unsigned indexEnd, bool ltr);
@@ -394,6 +394,7 @@ public:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> nativeFontData() const { return m_jFont; }
+    int glyphMapperID() const;
 #endif
 
     unsigned hash() const;
@@ -488,6 +489,7 @@ private:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> m_jFont;
+    mutable std::optional<int> m_glyphMapperID;
 #endif
 
     float m_size { 0 };
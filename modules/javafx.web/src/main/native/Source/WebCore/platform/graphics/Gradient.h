@@ -51,6 +51,11 @@ typedef struct CGContext* CGContextRef;
 typedef struct _cairo_pattern cairo_pattern_t;
 #endif
 
+#if PLATFORM(JAVA)
+#include "AffineTransform.h"
+#include "RQRef.h"
+#endif
+
 namespace WTF {
 class TextStream;
 }
@@ -115,6 +120,13 @@ public:
     sk_sp<SkShader> shader(float globalAlpha, const AffineTransform&);
 #endif
 
+#if PLATFORM(JAVA)
+    // Returns the Java WCGradient for the given gradient space transform.
+    // It is kept between paints and recreated when the stops or the
+    // transform change.
+    RefPtr<RQRef> platformGradient(const AffineTransform&);
+#endif
+
 private:
     Gradient(Data&&, ColorInterpolationMethod, GradientSpreadMethod, GradientColorStops&&, std::optional<RenderingResourceIdentifier>);
 
@@ -132,6 +144,11 @@ private:
     std::optional<GradientRendererCG> m_platformRenderer;
 #endif
 
+#if PLATFORM(JAVA)
+    RefPtr<RQRef> m_platformGradient;
+    AffineTransform m_platformGradientSpaceTransform;
+#endif
+
 };
 
 WEBCORE_EXPORT WTF::TextStream& operator<<(WTF::TextStream&, const Gradient&);
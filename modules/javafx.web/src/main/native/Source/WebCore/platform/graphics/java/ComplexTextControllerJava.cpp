@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,141 +30,153 @@
 #include "FontCascade.h"
 
 #include "PlatformJavaClasses.h"
+#include "com_sun_webkit_graphics_WCFont.h"
+#include <bit>
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/text/MakeString.h>
 
 namespace WebCore {
 
 namespace {
 
-jclass PG_GetTextRun(JNIEnv* env)
-{
-    static JGClass textRunCls(
-        env->FindClass("com/sun/webkit/graphics/WCTextRun"));
-    ASSERT(textRunCls);
-    return textRunCls;
-}
+// Accessors for the runs packed by WCFont.getPackedTextRuns().
+enum PackedRunField { IsLTR, Start, End, GlyphCount };
+enum PackedGlyphField { GlyphCode, CharOffset, PosX, PosY, Advance };
 
-bool jIsLTR(jobject jRun)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "isLeftToRight",
-        "()Z");
-    ASSERT(mID);
-
-    return env->CallBooleanMethod(jRun, mID) == JNI_TRUE;
-}
+static_assert(com_sun_webkit_graphics_WCFont_TEXT_RUN_HEADER_SIZE == GlyphCount + 1);
+static_assert(com_sun_webkit_graphics_WCFont_TEXT_RUN_GLYPH_SIZE == Advance + 1);
 
-unsigned jGetGlyphCount(jobject jRun)
+unsigned packedRunSize(std::span<const jint> packedRun)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyphCount",
-        "()I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID);
+    return com_sun_webkit_graphics_WCFont_TEXT_RUN_HEADER_SIZE
+        + packedRun[GlyphCount] * com_sun_webkit_graphics_WCFont_TEXT_RUN_GLYPH_SIZE;
 }
 
-unsigned jGetStart(jobject jRun)
+jint packedGlyphField(std::span<const jint> packedRun, unsigned glyphIndex, PackedGlyphField field)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getStart",
-        "()I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID);
+    return packedRun[com_sun_webkit_graphics_WCFont_TEXT_RUN_HEADER_SIZE
+        + glyphIndex * com_sun_webkit_graphics_WCFont_TEXT_RUN_GLYPH_SIZE + field];
 }
 
-unsigned jGetEnd(jobject jRun)
+float packedGlyphFloat(std::span<const jint> packedRun, unsigned glyphIndex, PackedGlyphField field)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getEnd",
-        "()I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID);
+    return std::bit_cast<float>(packedGlyphField(packedRun, glyphIndex, field));
 }
 
-unsigned jGetCharOffset(jobject jRun, unsigned glyphIndex)
-{
-    if (!jGetGlyphCount(jRun)) {
-        // Return same value as TextRun.getCharOffset() when there is
-        // no glyph information available.
-        return glyphIndex;
+// Shaped runs of short strings, such as repeated labels and table cells,
+// keyed by the Java font and the text, so that painting the same string
+// again does not go through the Java text layout.
+class TextRunCache {
+public:
+    static constexpr size_t defaultCapacity = 2 * MB;
+    static constexpr unsigned maxTextLength = 128;
+
+    static TextRunCache& singleton()
+    {
+        static NeverDestroyed<TextRunCache> cache;
+        return cache;
     }
 
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getCharOffset",
-        "(I)I");
-    ASSERT(mID);
+    std::optional<Vector<jint>> find(const RefPtr<RQRef>& font, const String& text)
+    {
+        Locker locker { m_lock };
+        auto it = m_entries.find(Key { font.get(), text });
+        if (it == m_entries.end()) {
+            ++m_missCount;
+            return std::nullopt;
+        }
+        ++m_hitCount;
+        m_lru.appendOrMoveToLast(it->key);
+        return it->value.packedRuns;
+    }
 
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
+    void add(const RefPtr<RQRef>& font, const String& text, const Vector<jint>& packedRuns)
+    {
+        Locker locker { m_lock };
+        size_t cost = entryCost(text, packedRuns);
+        if (cost > m_capacity)
+            return;
+
+        Key key { font.get(), text };
+        auto result = m_entries.add(key, Entry { font, packedRuns });
+        if (!result.isNewEntry)
+            return;
+        m_lru.appendOrMoveToLast(key);
+        m_size += cost;
+        pruneWithLock(m_capacity);
+    }
 
-CGGlyph jGetGlyph(jobject jRun, unsigned glyphIndex)
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyph",
-        "(I)I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
+    void setCapacity(size_t capacity)
+    {
+        Locker locker { m_lock };
+        m_capacity = capacity;
+        pruneWithLock(capacity);
+    }
 
-FloatRect jGetGlyphPosAndAdvance(jobject jRun, unsigned glyphIndex)
-{
-    if (!jGetGlyphCount(jRun)) {
-        return { };
+    jlong hitCount() const { return m_hitCount; }
+    jlong missCount() const { return m_missCount; }
+    jlong size()
+    {
+        Locker locker { m_lock };
+        return m_size;
     }
 
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getGlyphPosAndAdvance",
-        "(I)[F");
-    ASSERT(mID);
-
-    JLocalRef<jfloatArray> jpos = static_cast<jfloatArray> (env->CallObjectMethod(
-                                                              jRun, mID, glyphIndex));
-    WTF::CheckAndClearException(env);
-
-    jfloat* pos = static_cast<float*>(env->GetPrimitiveArrayCritical(jpos, 0));
-    FloatRect rect = { pos[0], pos[1], pos[2], pos[3] };
-    env->ReleasePrimitiveArrayCritical(jpos, pos, 0);
-    return rect;
-}
+private:
+    using Key = std::pair<RQRef*, String>;
+    struct Entry {
+        RefPtr<RQRef> font; // keeps the key pointer from being reused
+        Vector<jint> packedRuns;
+    };
+
+    static size_t entryCost(const String& text, const Vector<jint>& packedRuns)
+    {
+        return sizeof(Entry) + text.sizeInBytes() + packedRuns.size() * sizeof(jint);
+    }
 
-FloatSize jGetInitialAdvance(JLObject jRun)
+    void pruneWithLock(size_t capacity) WTF_REQUIRES_LOCK(m_lock)
+    {
+        while (m_size > capacity && !m_lru.isEmpty()) {
+            auto key = m_lru.takeFirst();
+            auto entry = m_entries.take(key);
+            m_size -= entryCost(key.second, entry.packedRuns);
+        }
+    }
+
+    Lock m_lock;
+    HashMap<Key, Entry> m_entries WTF_GUARDED_BY_LOCK(m_lock);
+    ListHashSet<Key> m_lru WTF_GUARDED_BY_LOCK(m_lock);
+    size_t m_size WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    size_t m_capacity WTF_GUARDED_BY_LOCK(m_lock) { defaultCapacity };
+    std::atomic<jlong> m_hitCount { 0 };
+    std::atomic<jlong> m_missCount { 0 };
+};
+
+FloatSize initialAdvance(std::span<const jint> packedRun)
 {
+    if (!packedRun[GlyphCount])
+        return { };
+
     // FIXME(arajkumar): There is no way to get initial advance from Prism Font implementation.
     // With trial and error I found that glyph 0's x,y position can be used as an alternative
     // for initial advance.
-    return jGetGlyphPosAndAdvance(jRun, 0).location() - FloatPoint();
+    return { packedGlyphFloat(packedRun, 0, PosX), packedGlyphFloat(packedRun, 0, PosY) };
 }
 
 }
 
-ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
-    : m_initialAdvance(jGetInitialAdvance(jRun))
+ComplexTextController::ComplexTextRun::ComplexTextRun(std::span<const jint> packedRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
+    : m_initialAdvance(initialAdvance(packedRun))
     , m_font(font)
     , m_characters(characters, stringLength)
     , m_stringLength(stringLength)
-    , m_indexBegin(jGetStart(jRun))
-    , m_indexEnd(jGetEnd(jRun))
-    , m_glyphCount(jGetGlyphCount(jobject(jRun)))
+    , m_indexBegin(packedRun[Start])
+    , m_indexEnd(packedRun[End])
+    , m_glyphCount(packedRun[GlyphCount])
     , m_stringLocation(stringLocation)
-    , m_isLTR(jIsLTR(jobject(jRun)))
+    , m_isLTR(packedRun[IsLTR])
 {
     // Handle empty string runs (line breaks, etc.)
     if (m_stringLength == 0) {
@@ -195,16 +207,16 @@ ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font&
         // java TextRun will have indicies relative to it's text. So it has to
         // be converted to absolute index w.r.t WebCore String.
         // Refer {CTGlyphLayout, DWGlyphLayout, PangoGlyphLayout}.layout()
-        m_coreTextIndices[i] = m_indexBegin + jGetCharOffset(jRun, i);
+        m_coreTextIndices[i] = m_indexBegin + packedGlyphField(packedRun, i, CharOffset);
 
-        m_glyphs[i]= jGetGlyph(jRun, i);
+        m_glyphs[i] = packedGlyphField(packedRun, i, GlyphCode);
         if (m_font->isZeroWidthSpaceGlyph(m_glyphs[i])) {
             m_baseAdvances[i] = { };
             continue;
         }
 
-        auto glyphBox = jGetGlyphPosAndAdvance(jRun, i);
-        m_baseAdvances[i] = glyphBox.size();
+        // FIXME: We don't yet support Y advance from prism.
+        m_baseAdvances[i] = { packedGlyphFloat(packedRun, i, Advance), 0 };
     }
 }
 
@@ -217,29 +229,72 @@ void ComplexTextController::collectComplexTextRunsForCharacters(std::span<const
         return;
     }
 
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID getTextRuns_mID = env->GetMethodID(
-        PG_GetFontClass(env),
-        "getTextRuns",
-        "(Ljava/lang/String;)[Lcom/sun/webkit/graphics/WCTextRun;");
-    ASSERT(getTextRuns_mID);
-
-    JLocalRef<jobjectArray> jRuns = static_cast<jobjectArray> (env->CallObjectMethod(
-                                                                  *jFont,
-                                                                  getTextRuns_mID,
-                                                                  jstring(makeString(characters, characters.size()).toJavaString(env))));
-    WTF::CheckAndClearException(env);
+    String text = makeString(characters, characters.size());
+    bool isCacheable = characters.size() <= TextRunCache::maxTextLength;
+
+    Vector<jint> packedRuns;
+    if (auto cached = isCacheable ? TextRunCache::singleton().find(jFont, text) : std::nullopt)
+        packedRuns = WTFMove(*cached);
+    else {
+        JNIEnv* env = WTF::GetJavaEnv();
+        static jmethodID getPackedTextRuns_mID = env->GetMethodID(
+            PG_GetFontClass(env),
+            "getPackedTextRuns",
+            "(Ljava/lang/String;)[I");
+        ASSERT(getPackedTextRuns_mID);
+
+        JLocalRef<jintArray> jRuns = static_cast<jintArray> (env->CallObjectMethod(
+                                                                *jFont,
+                                                                getPackedTextRuns_mID,
+                                                                jstring(text.toJavaString(env))));
+        WTF::CheckAndClearException(env);
+
+        if (jRuns) {
+            packedRuns.grow(env->GetArrayLength(jRuns));
+            env->GetIntArrayRegion(jRuns, 0, packedRuns.size(), packedRuns.data());
+            if (WTF::CheckAndClearException(env))
+                packedRuns.clear();
+        }
+        if (isCacheable && !packedRuns.isEmpty())
+            TextRunCache::singleton().add(jFont, text, packedRuns);
+    }
 
-    if (!jRuns) {
+    if (packedRuns.isEmpty()) {
         // Create a run of missing glyphs from the primary font.
         m_complexTextRuns.append(ComplexTextRun::create(m_fontCascade->primaryFont(), std::span<const UChar>(characters.data(), characters.size()), stringLocation, 0, characters.size(), m_run->ltr()));
         return;
     }
 
-    for (auto i = 0; i < env->GetArrayLength(jobjectArray(jRuns)); i++) {
-        auto jRun = env->GetObjectArrayElement(jobjectArray(jRuns), i);
-        m_complexTextRuns.append(ComplexTextRun::create(jRun, *font, characters.data(), stringLocation, characters.size()));
+    auto remaining = packedRuns.span().subspan(1);
+    for (jint i = 0; i < packedRuns[0]; i++) {
+        if (remaining.size() < com_sun_webkit_graphics_WCFont_TEXT_RUN_HEADER_SIZE)
+            break;
+        unsigned runSize = packedRunSize(remaining);
+        if (remaining.size() < runSize)
+            break;
+        m_complexTextRuns.append(ComplexTextRun::create(remaining.first(runSize), *font, characters.data(), stringLocation, characters.size()));
+        remaining = remaining.subspan(runSize);
     }
 }
 
 }  // namespace WebCore
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_graphics_WCFont_twkGetTextRunCacheCounters
+    (JNIEnv* env, jclass)
+{
+    using namespace WebCore;
+    TextRunCache& cache = TextRunCache::singleton();
+    jlong counters[] = { cache.hitCount(), cache.missCount(), cache.size() };
+    jlongArray result = env->NewLongArray(3);
+    if (result) {
+        env->SetLongArrayRegion(result, 0, 3, counters);
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCFont_twkSetTextRunCacheCapacity
+    (JNIEnv*, jclass, jint capacity)
+{
+    using namespace WebCore;
+    TextRunCache::singleton().setCapacity(std::max(capacity, 0));
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,7 +33,9 @@
 #include "FontSelector.h"
 #include "GraphicsContextJava.h"
 #include "NotImplemented.h"
+#include "com_sun_webkit_graphics_WCFont.h"
 
+#include <array>
 #include <wtf/Assertions.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/text/CString.h>
@@ -48,43 +50,26 @@ void Font::platformInit()
     if (!jFont)
         return;
 
-    static jmethodID getXHeight_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getXHeight", "()F");
-    ASSERT(getXHeight_mID);
-    m_fontMetrics.setXHeight(env->CallFloatMethod(*jFont, getXHeight_mID));
-    WTF::CheckAndClearException(env);
-
-    static jmethodID getCapHeight_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getCapHeight", "()F");
-    ASSERT(getCapHeight_mID);
-    m_fontMetrics.setCapHeight(env->CallFloatMethod(*jFont, getCapHeight_mID));
-    WTF::CheckAndClearException(env);
-
-    static jmethodID getAscent_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getAscent", "()F");
-    ASSERT(getAscent_mID);
-    m_fontMetrics.setAscent(env->CallFloatMethod(*jFont, getAscent_mID));
-    WTF::CheckAndClearException(env);
+    static jmethodID getFontMetrics_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getFontMetrics", "()[F");
+    ASSERT(getFontMetrics_mID);
+    JLocalRef<jfloatArray> jMetrics(static_cast<jfloatArray>(
+        env->CallObjectMethod(*jFont, getFontMetrics_mID)));
+    if (WTF::CheckAndClearException(env) || !jMetrics)
+        return;
 
-    static jmethodID getDescent_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getDescent", "()F");
-    ASSERT(getDescent_mID);
-    m_fontMetrics.setDescent(env->CallFloatMethod(*jFont, getDescent_mID));
-    WTF::CheckAndClearException(env);
+    std::array<jfloat, com_sun_webkit_graphics_WCFont_METRICS_COUNT> metrics { };
+    env->GetFloatArrayRegion(jMetrics, 0, metrics.size(), metrics.data());
+    if (WTF::CheckAndClearException(env))
+        return;
 
-    static jmethodID getLineSpacing_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getLineSpacing", "()F");
-    ASSERT(getLineSpacing_mID);
+    m_fontMetrics.setXHeight(metrics[com_sun_webkit_graphics_WCFont_METRICS_X_HEIGHT]);
+    m_fontMetrics.setCapHeight(metrics[com_sun_webkit_graphics_WCFont_METRICS_CAP_HEIGHT]);
+    m_fontMetrics.setAscent(metrics[com_sun_webkit_graphics_WCFont_METRICS_ASCENT]);
+    m_fontMetrics.setDescent(metrics[com_sun_webkit_graphics_WCFont_METRICS_DESCENT]);
     // Match CoreGraphics metrics.
-    m_fontMetrics.setLineSpacing(lroundf(
-        env->CallFloatMethod(*jFont, getLineSpacing_mID)));
-    WTF::CheckAndClearException(env);
-
-    static jmethodID getLineGap_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getLineGap", "()F");
-    ASSERT(getLineGap_mID);
-    m_fontMetrics.setLineGap(env->CallFloatMethod(*jFont, getLineGap_mID));
-    WTF::CheckAndClearException(env);
+    m_fontMetrics.setLineSpacing(lroundf(metrics[com_sun_webkit_graphics_WCFont_METRICS_LINE_SPACING]));
+    m_fontMetrics.setLineGap(metrics[com_sun_webkit_graphics_WCFont_METRICS_LINE_GAP]);
 }
 
 void Font::determinePitch()
@@ -122,6 +107,12 @@ RefPtr<Font> Font::platformCreateScaledFont(const FontDescription&, float scaleF
     return Font::create(*m_platformData.derive(scaleFactor), origin(), IsInterstitial::No);
 }
 
+// Glyph metrics are fetched for an aligned block of glyphs at a time and
+// the neighbours of the requested glyph are stored in the metrics maps of
+// the font, so that laying out text does not cross JNI for every glyph.
+static constexpr unsigned glyphWidthBatchSize = 64;
+static constexpr unsigned glyphBoundsBatchSize = 16;
+
 float Font::platformWidthForGlyph(Glyph c) const
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -130,14 +121,36 @@ float Font::platformWidthForGlyph(Glyph c) const
     if (!jFont)
         return 0.0f;
 
-    static jmethodID getGlyphWidth_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getGlyphWidth", "(I)D");
-    ASSERT(getGlyphWidth_mID);
+    static jmethodID getGlyphWidths_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphWidths", "(II)[F");
+    ASSERT(getGlyphWidths_mID);
 
-    float res = env->CallDoubleMethod(*jFont, getGlyphWidth_mID, (jint)c);
-    WTF::CheckAndClearException(env);
+    Glyph first = c - (c % glyphWidthBatchSize);
+    JLocalRef<jfloatArray> jwidths(static_cast<jfloatArray>(env->CallObjectMethod(
+        *jFont, getGlyphWidths_mID, (jint)first, (jint)glyphWidthBatchSize)));
+    if (WTF::CheckAndClearException(env) || !jwidths)
+        return 0.0f;
+
+    std::array<jfloat, glyphWidthBatchSize> widths;
+    env->GetFloatArrayRegion(jwidths, 0, glyphWidthBatchSize, widths.data());
+    if (WTF::CheckAndClearException(env))
+        return 0.0f;
 
-    return res;
+#if ENABLE(OPENTYPE_VERTICAL)
+    // Vertical fonts keep advance heights in the width map.
+    bool canFillNeighbours = !m_verticalData;
+#else
+    bool canFillNeighbours = true;
+#endif
+    if (canFillNeighbours) {
+        for (unsigned i = 0; i < glyphWidthBatchSize; ++i) {
+            Glyph glyph = first + i;
+            if (glyph != c && m_glyphToWidthMap.metricsForGlyph(glyph) == cGlyphSizeUnknown)
+                m_glyphToWidthMap.setMetricsForGlyph(glyph, widths[i]);
+        }
+    }
+
+    return widths[c - first];
 }
 
 FloatRect Font::platformBoundsForGlyph(Glyph c) const
@@ -149,15 +162,34 @@ FloatRect Font::platformBoundsForGlyph(Glyph c) const
         return {};
     }
 
-    static jmethodID getGlyphBoundingBox_mID = env->GetMethodID(PG_GetFontClass(env), "getGlyphBoundingBox", "(I)[F");
-    ASSERT(getGlyphBoundingBox_mID);
+    static jmethodID getGlyphBoundingBoxes_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphBoundingBoxes", "(II)[F");
+    ASSERT(getGlyphBoundingBoxes_mID);
 
-    jfloatArray boundingBox = (jfloatArray)env->CallObjectMethod(*jFont, getGlyphBoundingBox_mID, (jint)c);
-    jfloat *bBox = env->GetFloatArrayElements(boundingBox,0);
-    auto bb = FloatRect { bBox[0], bBox[1], bBox[2], bBox[3] };
-    env->ReleaseFloatArrayElements(boundingBox, bBox, 0);
-    WTF::CheckAndClearException(env);
-    return bb;
+    Glyph first = c - (c % glyphBoundsBatchSize);
+    JLocalRef<jfloatArray> jboxes(static_cast<jfloatArray>(env->CallObjectMethod(
+        *jFont, getGlyphBoundingBoxes_mID, (jint)first, (jint)glyphBoundsBatchSize)));
+    if (WTF::CheckAndClearException(env) || !jboxes)
+        return {};
+
+    std::array<jfloat, glyphBoundsBatchSize * 4> boxes;
+    env->GetFloatArrayRegion(jboxes, 0, glyphBoundsBatchSize * 4, boxes.data());
+    if (WTF::CheckAndClearException(env))
+        return {};
+
+    auto boundsAt = [&boxes](unsigned i) {
+        return FloatRect { boxes[i * 4], boxes[i * 4 + 1], boxes[i * 4 + 2], boxes[i * 4 + 3] };
+    };
+
+    if (!m_glyphToBoundsMap)
+        m_glyphToBoundsMap = makeUnique<GlyphMetricsMap<FloatRect>>();
+    for (unsigned i = 0; i < glyphBoundsBatchSize; ++i) {
+        Glyph glyph = first + i;
+        if (glyph != c && m_glyphToBoundsMap->metricsForGlyph(glyph).width() == cGlyphSizeUnknown)
+            m_glyphToBoundsMap->setMetricsForGlyph(glyph, boundsAt(i));
+    }
+
+    return boundsAt(c - first);
 }
 
 Path Font::platformPathForGlyph(Glyph) const
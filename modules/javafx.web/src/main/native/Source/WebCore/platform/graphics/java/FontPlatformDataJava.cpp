@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,18 +31,70 @@
 #include "GraphicsContextJava.h"
 #include "NotImplemented.h"
 
+#include <bit>
 #include <wtf/Assertions.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/text/CString.h>
+#include <wtf/text/MakeString.h>
 #include <wtf/text/WTFString.h>
 
 namespace WebCore {
 
 namespace {
 
+// Process-wide memo of the Java fonts created for a family and style.
+// FontCache drops its platform data on purges and every WebView starts
+// with an empty one, so without this each of them would go through the
+// font lookup in GraphicsManager again. Entries hold global references
+// only, every caller wraps them in a RQRef of its own.
+class JavaFontCache {
+    WTF_MAKE_NONCOPYABLE(JavaFontCache);
+public:
+    static constexpr unsigned maxSize = 256;
+
+    JavaFontCache() = default;
+
+    static JavaFontCache& singleton()
+    {
+        static NeverDestroyed<JavaFontCache> cache;
+        return cache;
+    }
+
+    static String key(const String& family, float size, bool italic, bool bold)
+    {
+        return makeString(std::bit_cast<uint32_t>(size), italic ? 'i' : '-', bold ? 'b' : '-', family);
+    }
+
+    JLObject get(const String& key)
+    {
+        Locker locker { m_lock };
+        auto it = m_fonts.find(key);
+        return it == m_fonts.end() ? JLObject() : JLObject(it->value);
+    }
+
+    void add(const String& key, const JLObject& font)
+    {
+        Locker locker { m_lock };
+        if (m_fonts.size() >= maxSize)
+            m_fonts.clear();
+        m_fonts.set(key, JGObject(font));
+    }
+
+private:
+    Lock m_lock;
+    HashMap<String, JGObject> m_fonts WTF_GUARDED_BY_LOCK(m_lock);
+};
+
 RefPtr<RQRef> getJavaFont(const String& family, float size, bool italic, bool bold)
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
+    String cacheKey = JavaFontCache::key(family, size, italic, bold);
+    if (JLObject cachedFont = JavaFontCache::singleton().get(cacheKey))
+        return RQRef::create(cachedFont);
+
     static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
         "getWCFont", "(Ljava/lang/String;ZZF)Lcom/sun/webkit/graphics/WCFont;");
     ASSERT(mid);
@@ -53,8 +105,10 @@ RefPtr<RQRef> getJavaFont(const String& family, float size, bool italic, bool bo
         bool_to_jbool(italic),
         jfloat(size)));
 
-    WTF::CheckAndClearException(env);
+    if (WTF::CheckAndClearException(env) || !wcFont)
+        return nullptr;
 
+    JavaFontCache::singleton().add(cacheKey, wcFont);
     return RQRef::create(wcFont);
 }
 }
@@ -131,6 +185,29 @@ unsigned FontPlatformData::hash() const
     return res;
 }
 
+int FontPlatformData::glyphMapperID() const
+{
+    if (m_glyphMapperID)
+        return *m_glyphMapperID;
+
+    if (!m_jFont || isHashTableDeletedValue())
+        return 0;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env)
+        return 0;
+
+    static jmethodID mid = env->GetMethodID(PG_GetFontClass(env), "getGlyphMapperID", "()I");
+    ASSERT(mid);
+
+    jint res = env->CallIntMethod(*m_jFont, mid);
+    if (WTF::CheckAndClearException(env))
+        res = 0;
+
+    m_glyphMapperID = res;
+    return res;
+}
+
 #ifndef NDEBUG
 String FontPlatformData::description() const
 {
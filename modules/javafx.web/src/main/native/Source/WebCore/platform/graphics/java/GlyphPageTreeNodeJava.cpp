@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,16 +29,67 @@
 #include "GraphicsContextJava.h"
 #include "Font.h"
 
+#include <array>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <unicode/utf16.h>
+
 namespace WebCore {
 
-bool GlyphPage::fill(std::span<const UChar> characterBuffer)
+namespace {
+
+// Glyph codes depend on the font face only, so the pages filled for one
+// size of a face are reused for all the other sizes without calling
+// into Java. The cache is keyed by the glyph mapper id of the face and
+// the first code point of the page.
+class GlyphPageCache {
+public:
+    using Glyphs = std::array<Glyph, GlyphPage::size>;
+
+    static GlyphPageCache& shared()
+    {
+        static NeverDestroyed<GlyphPageCache> cache;
+        return cache;
+    }
+
+    std::optional<Glyphs> get(int mapperID, char32_t firstCodePoint)
+    {
+        Locker locker { m_lock };
+        auto it = m_pages.find(key(mapperID, firstCodePoint));
+        if (it == m_pages.end())
+            return std::nullopt;
+        return *it->value;
+    }
+
+    void add(int mapperID, char32_t firstCodePoint, const Glyphs& glyphs)
+    {
+        Locker locker { m_lock };
+        if (m_pages.size() >= maxPageCount)
+            m_pages.clear();
+        m_pages.set(key(mapperID, firstCodePoint), makeUnique<Glyphs>(glyphs));
+    }
+
+private:
+    static constexpr unsigned maxPageCount = 4096;
+
+    static uint64_t key(int mapperID, char32_t firstCodePoint)
+    {
+        // Zero is the empty value of the hash table, and code points
+        // never occupy the top bit.
+        return (static_cast<uint64_t>(mapperID) << 32) | firstCodePoint | (1ULL << 31);
+    }
+
+    Lock m_lock;
+    HashMap<uint64_t, std::unique_ptr<Glyphs>> m_pages WTF_GUARDED_BY_LOCK(m_lock);
+};
+
+} // namespace
+
+static bool fetchGlyphs(const RefPtr<RQRef>& jFont, std::span<const UChar> characterBuffer, GlyphPageCache::Glyphs& result)
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
-    RefPtr<RQRef> jFont = this->font().platformData().nativeFontData();
-    if (!jFont)
-        return false;
-
     JLocalRef<jcharArray> jchars(env->NewCharArray(characterBuffer.size()));
     WTF::CheckAndClearException(env); // OOME
     ASSERT(jchars);
@@ -68,18 +119,46 @@ bool GlyphPage::fill(std::span<const UChar> characterBuffer)
         step = 2;
     } else {
         ASSERT_NOT_REACHED();
+        step = 1;
+    }
+
+    for (unsigned i = 0; i < GlyphPage::size; i++)
+        result[i] = glyphs[i * step];
+    env->ReleasePrimitiveArrayCritical(jglyphs, glyphs, JNI_ABORT);
+
+    return true;
+}
+
+bool GlyphPage::fill(std::span<const UChar> characterBuffer)
+{
+    RefPtr<RQRef> jFont = this->font().platformData().nativeFontData();
+    if (!jFont || characterBuffer.empty())
+        return false;
+
+    int mapperID = this->font().platformData().glyphMapperID();
+    char32_t firstCodePoint = U16_IS_LEAD(characterBuffer[0]) && characterBuffer.size() > 1
+        ? U16_GET_SUPPLEMENTARY(characterBuffer[0], characterBuffer[1])
+        : characterBuffer[0];
+
+    GlyphPageCache::Glyphs glyphs;
+    if (auto cached = mapperID > 0 ? GlyphPageCache::shared().get(mapperID, firstCodePoint) : std::nullopt)
+        glyphs = *cached;
+    else {
+        if (!fetchGlyphs(jFont, characterBuffer, glyphs))
+            return false;
+        if (mapperID > 0)
+            GlyphPageCache::shared().add(mapperID, firstCodePoint, glyphs);
     }
 
     bool haveGlyphs = false;
     for (unsigned i = 0; i < GlyphPage::size; i++) {
-        Glyph glyph = glyphs[i * step];
+        Glyph glyph = glyphs[i];
         if (glyph) {
             haveGlyphs = true;
             setGlyphForIndex(i, glyph,ColorGlyphType::Outline);
         } else
             setGlyphForIndex(i, 0, this->font().colorGlyphType(glyph));
     }
-    env->ReleasePrimitiveArrayCritical(jglyphs, glyphs, JNI_ABORT);
 
     return haveGlyphs;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 #include "config.h"
 
+#include <limits>
 #include <math.h>
 #include <stdio.h>
 #include <wtf/MathExtras.h>
@@ -64,60 +65,82 @@
 
 namespace WebCore {
 
-static void setGradient(Gradient &gradient,
-    const AffineTransform& gradientSpaceTransformation, PlatformGraphicsContext* context, jint id)
+// Colors that are exactly representable with 8-bit sRGB components are
+// written as a single packed RGBA int instead of four floats.
+static std::optional<jint> packedColor(const Color& color)
 {
-    const Vector<GradientColorStop, 2> stops = gradient.stops().stops();
-    int nStops = stops.size();
+    auto bytes = color.tryGetAsSRGBABytes();
+    if (!bytes) {
+        return std::nullopt;
+    }
+    auto [r, g, b, a] = bytes->resolved();
+    return static_cast<jint>((static_cast<uint32_t>(r) << 24)
+        | (static_cast<uint32_t>(g) << 16)
+        | (static_cast<uint32_t>(b) << 8)
+        | static_cast<uint32_t>(a));
+}
 
-    FloatPoint p0, p1;
-    float startRadius, endRadius;
-    bool isRadialGradient = true;
-    WTF::switchOn(gradient.data(),
-            [&] (const Gradient::LinearData& data) -> void {
-                isRadialGradient = false;
-                p0 = data.point0;
-                p1 = data.point1;
-            },
-            [&] (const Gradient::RadialData& data) -> void {
-                p0 = data.point0;
-                p1 = data.point1;
-                startRadius = data.startRadius;
-                endRadius = data.endRadius;
-            },
-            [&] (const Gradient::ConicData&) -> void {
-                notImplemented();
-            }
-    );
+static bool isShortValue(float value)
+{
+    return value >= std::numeric_limits<jshort>::min()
+        && value <= std::numeric_limits<jshort>::max()
+        && value == static_cast<float>(static_cast<jshort>(value));
+}
 
-    p0 = gradientSpaceTransformation.mapPoint(p0);
-    p1 = gradientSpaceTransformation.mapPoint(p1);
+// Rectangles with integral coordinates fitting into 16 bits are written
+// as shorts, which is lossless.
+static bool isShortRect(const FloatRect& rect)
+{
+    return isShortValue(rect.x()) && isShortValue(rect.y())
+        && isShortValue(rect.width()) && isShortValue(rect.height());
+}
 
-    context->rq().freeSpace(4 * 11 + 20 * nStops)
-    << id
-    << (jfloat)p0.x()
-    << (jfloat)p0.y()
-    << (jfloat)p1.x()
-    << (jfloat)p1.y()
-    << (jint)isRadialGradient;
-
-    if (isRadialGradient) {
-        context->rq()
-        << (jfloat)(gradientSpaceTransformation.xScale() * startRadius)
-        << (jfloat)(gradientSpaceTransformation.xScale() * endRadius);
+static void writeColor(PlatformGraphicsContext* context, jint floatOp, jint packedOp, const Color& color)
+{
+    if (auto packed = packedColor(color)) {
+        context->rq().freeSpace(8)
+        << packedOp
+        << *packed;
+        return;
     }
-    context->rq()
-    << (jint)0 //is not proportional
-    << (jint)gradient.spreadMethod()
-    << (jint)nStops;
-
-    for (const auto& cs : stops) {
-        auto [r, g, b, a] = cs.color.toColorTypeLossy<SRGBA<float>>().resolved();
-        context->rq()
-        << r << g << b << a << (jfloat)cs.offset;
+    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    context->rq().freeSpace(20)
+    << floatOp
+    << r << g << b << a;
+}
+
+static void writeShadow(PlatformGraphicsContext* context, const std::array<float, 7>& shadow)
+{
+    if (!PlatformStateShadow::update(context->stateShadow().shadow, shadow))
+        return;
+
+    context->rq().freeSpace(32)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW;
+    for (float value : shadow) {
+        context->rq() << value;
     }
 }
 
+static void setGradient(Gradient &gradient,
+    const AffineTransform& gradientSpaceTransformation, PlatformGraphicsContext* context, jint id)
+{
+    RefPtr<RQRef> platformGradient = gradient.platformGradient(gradientSpaceTransformation);
+    if (!platformGradient) {
+        return;
+    }
+
+    // The gradient replaces the paint the shadowed color was set to.
+    if (id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT) {
+        context->stateShadow().fillColor = std::nullopt;
+    } else {
+        context->stateShadow().strokeColor = std::nullopt;
+    }
+
+    context->rq().freeSpace(8)
+    << id
+    << platformGradient;
+}
+
 static void flushImageRQ(PlatformGraphicsContext* context, const PlatformImagePtr& image)
 {
     if (!image || !image->getRenderingQueue())
@@ -163,6 +186,7 @@ void GraphicsContextJava::savePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    platformContext()->saveStateShadow();
 }
 
 void GraphicsContextJava::restore(GraphicsContextState::Purpose) {
@@ -177,6 +201,7 @@ void GraphicsContextJava::restorePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+    platformContext()->restoreStateShadow();
 }
 
 // Draws a filled rectangle with a stroked border.
@@ -230,6 +255,16 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
     if (paintingDisabled())
         return;
 
+    auto packed = packedColor(color);
+    if (packed && isShortRect(rect)) {
+        platformContext()->rq().freeSpace(16)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_SSSSC
+        << (jshort)rect.x() << (jshort)rect.y()
+        << (jshort)rect.width() << (jshort)rect.height()
+        << *packed;
+        return;
+    }
+
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
     platformContext()->rq().freeSpace(36)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
@@ -261,10 +296,17 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, RequiresClipToRect req
                 com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT);
         }
 
-        platformContext()->rq().freeSpace(20)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFF
-        << rect.x() << rect.y()
-        << rect.width() << rect.height();
+        if (isShortRect(rect)) {
+            platformContext()->rq().freeSpace(12)
+            << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_SSSS
+            << (jshort)rect.x() << (jshort)rect.y()
+            << (jshort)rect.width() << (jshort)rect.height();
+        } else {
+            platformContext()->rq().freeSpace(20)
+            << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFF
+            << rect.x() << rect.y()
+            << rect.width() << rect.height();
+        }
     }
 }
 
@@ -506,9 +548,13 @@ void GraphicsContextJava::setPlatformFillColor(const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(20)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
-    << r << g << b << a;
+    if (!PlatformStateShadow::update(platformContext()->stateShadow().fillColor, { r, g, b, a }))
+        return;
+
+    writeColor(platformContext(),
+        com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR,
+        com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR_C,
+        color);
 }
 
 void GraphicsContextJava::setPlatformTextDrawingMode(TextDrawingModeFlags mode)
@@ -516,6 +562,10 @@ void GraphicsContextJava::setPlatformTextDrawingMode(TextDrawingModeFlags mode)
     if (paintingDisabled())
         return;
 
+    std::array<jint, 2> textMode { mode.contains(TextDrawingMode::Fill), mode.contains(TextDrawingMode::Stroke) };
+    if (!PlatformStateShadow::update(platformContext()->stateShadow().textMode, textMode))
+        return;
+
     platformContext()->rq().freeSpace(16)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_TEXT_MODE
     << (jint)(mode.contains(TextDrawingMode::Fill))
@@ -530,6 +580,9 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
     if (paintingDisabled())
         return;
 
+    if (!PlatformStateShadow::update(platformContext()->stateShadow().strokeStyle, (jint)style))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
     << (jint)style;
@@ -541,9 +594,13 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(20)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
-    << r << g << b << a;
+    if (!PlatformStateShadow::update(platformContext()->stateShadow().strokeColor, { r, g, b, a }))
+        return;
+
+    writeColor(platformContext(),
+        com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR,
+        com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR_C,
+        color);
 }
 
 void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
@@ -551,6 +608,9 @@ void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
     if (paintingDisabled())
         return;
 
+    if (!PlatformStateShadow::update(platformContext()->stateShadow().strokeThickness, strokeThickness))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
     << strokeThickness;
@@ -611,9 +671,7 @@ void GraphicsContextJava::setPlatformShadow(const FloatSize& s, float blur, cons
 #endif
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(32)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW
-    << width << height << blur << r << g << b << a;;
+    writeShadow(platformContext(), { width, height, blur, r, g, b, a });
 }
 
 void GraphicsContextJava::beginTransparencyLayer(float opacity)
@@ -727,6 +785,9 @@ void GraphicsContextJava::setMiterLimit(float limit)
 
 void GraphicsContextJava::setPlatformAlpha(float alpha)
 {
+    if (!PlatformStateShadow::update(platformContext()->stateShadow().alpha, alpha))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETALPHA
     << alpha;
@@ -737,6 +798,9 @@ void GraphicsContextJava::setPlatformCompositeOperation(CompositeOperator op, Bl
     if (paintingDisabled())
         return;
 
+    if (!PlatformStateShadow::update(platformContext()->stateShadow().compositeOperation, (jint)op))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETCOMPOSITE
     << (jint)op;
@@ -842,30 +906,21 @@ void GraphicsContextJava::drawPlatformPattern(const PlatformImagePtr& image, con
     if (paintingDisabled() || !patternTransform.isInvertible())
         return;
 
-    JNIEnv* env = WTF::GetJavaEnv();
-
     if (tileRect.isEmpty()) {
         return;
     }
 
     flushImageRQ(platformContext(), image);
 
-    TransformationMatrix tm = patternTransform.toTransformationMatrix();
-
-    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
-                "createTransform",
-                "(DDDDDD)Lcom/sun/webkit/graphics/WCTransform;");
-    ASSERT(mid);
-    JLObject transform(env->CallObjectMethod(PL_GetGraphicsManager(env), mid,
-                tm.a(), tm.b(), tm.c(), tm.d(), tm.e(), tm.f()));
-    ASSERT(transform);
-    WTF::CheckAndClearException(env);
-
-    platformContext()->rq().freeSpace(13 * 4)
+    // The pattern transform is written inline, like concatCTM, so that no
+    // WCTransform has to be created through JNI for every pattern draw.
+    platformContext()->rq().freeSpace(18 * 4)
         << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWPATTERN
         << image->getImage()
         << tileRect.x() << tileRect.y() << tileRect.width() << tileRect.height()
-        << RQRef::create(transform)
+        << (float)patternTransform.a() << (float)patternTransform.b()
+        << (float)patternTransform.c() << (float)patternTransform.d()
+        << (float)patternTransform.e() << (float)patternTransform.f()
         << phase.x() << phase.y()
         << destRect.x() << destRect.y() << destRect.width() << destRect.height();
 }
@@ -1032,10 +1087,7 @@ void GraphicsContextJava::didUpdateState(GraphicsContextState& state)
             const auto& dropShadow = dropShadowOpt.value();
             setPlatformShadow(dropShadow.offset,dropShadow.radius, dropShadow.color);
         } else {
-            float clr = 0.0f;
-            platformContext()->rq().freeSpace(32)
-            << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW
-            << clr << clr << clr << clr << clr << clr << clr;
+            writeShadow(platformContext(), { });
         }
     }
 
@@ -1076,8 +1128,80 @@ void GraphicsContextJava::setCTM(const AffineTransform& tm)
     << (float)tm.a() << (float)tm.b() << (float)tm.c() << (float)tm.d() << (float)tm.e() << (float)tm.f();
 }
 
+RefPtr<RQRef> Gradient::platformGradient(const AffineTransform& gradientSpaceTransformation)
+{
+    if (m_platformGradient && m_platformGradientSpaceTransform == gradientSpaceTransformation) {
+        return m_platformGradient;
+    }
+
+    FloatPoint p0, p1;
+    float startRadius = 0;
+    float endRadius = 0;
+    bool isRadialGradient = true;
+    WTF::switchOn(m_data,
+            [&] (const LinearData& data) -> void {
+                isRadialGradient = false;
+                p0 = data.point0;
+                p1 = data.point1;
+            },
+            [&] (const RadialData& data) -> void {
+                p0 = data.point0;
+                p1 = data.point1;
+                startRadius = data.startRadius;
+                endRadius = data.endRadius;
+            },
+            [&] (const ConicData&) -> void {
+                notImplemented();
+            }
+    );
+
+    p0 = gradientSpaceTransformation.mapPoint(p0);
+    p1 = gradientSpaceTransformation.mapPoint(p1);
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    // Each stop is written as r, g, b, a and offset.
+    const auto& stops = m_stops.stops();
+    JLocalRef<jfloatArray> jStops(env->NewFloatArray(5 * stops.size()));
+    WTF::CheckAndClearException(env);
+    ASSERT(jStops);
+    {
+        jfloat* bufArray = env->GetFloatArrayElements(jStops, NULL);
+        ASSERT(bufArray);
+        jfloat* p = bufArray;
+        for (const auto& cs : stops) {
+            auto [r, g, b, a] = cs.color.toColorTypeLossy<SRGBA<float>>().resolved();
+            *p++ = r;
+            *p++ = g;
+            *p++ = b;
+            *p++ = a;
+            *p++ = static_cast<jfloat>(cs.offset);
+        }
+        env->ReleaseFloatArrayElements(jStops, bufArray, 0);
+    }
+
+    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
+                "fwkCreateGradient",
+                "(ZFFFFFFI[F)Lcom/sun/webkit/graphics/WCGradient;");
+    ASSERT(mid);
+    JLObject jGradient(env->CallObjectMethod(PL_GetGraphicsManager(env), mid,
+                bool_to_jbool(isRadialGradient),
+                (jfloat)p0.x(), (jfloat)p0.y(),
+                (jfloat)(gradientSpaceTransformation.xScale() * startRadius),
+                (jfloat)p1.x(), (jfloat)p1.y(),
+                (jfloat)(gradientSpaceTransformation.xScale() * endRadius),
+                (jint)m_spreadMethod,
+                (jfloatArray)jStops));
+    WTF::CheckAndClearException(env);
+
+    m_platformGradient = RQRef::createHandle(jGradient);
+    m_platformGradientSpaceTransform = gradientSpaceTransformation;
+    return m_platformGradient;
+}
+
 void Gradient::stopsChanged()
 {
+    m_platformGradient = nullptr;
 }
 
 void Gradient::fill(GraphicsContext& gc, const FloatRect& rect)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,7 +45,7 @@ using namespace WebCore;
 namespace WebCore {
 
 Icon::Icon(const JLObject &jicon)
-    : m_jicon(RQRef::create(jicon))
+    : m_jicon(RQRef::createHandle(jicon))
 {
 }
 
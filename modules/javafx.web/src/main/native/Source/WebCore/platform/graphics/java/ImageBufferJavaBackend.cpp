@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,10 +32,15 @@
 #include "ImageData.h"
 #include "ImageBuffer.h"
 #include "MIMETypeRegistry.h"
+#include "PixelBufferConversion.h"
 #include "PlatformContextJava.h"
 #include "GraphicsContextJava.h"
 namespace WebCore {
 
+// getImageData on a rect up to this fraction of the canvas reads back just
+// that rect from the render target instead of the whole surface.
+static constexpr unsigned smallRectAreaDivisor = 4;
+
 std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
     const Parameters& parameters, const ImageBufferCreationContext&)
 {
@@ -203,6 +208,9 @@ RefPtr<NativeImage> ImageBufferJavaBackend::createNativeImageReference()
 
 void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, PixelBuffer& destination) //overide method
 {
+    if (getPixelBufferForSmallRect(srcRect, destination))
+        return;
+
     auto [data, size] = getDataAndSize();
     if (!data || size == 0)
         return;
@@ -216,6 +224,62 @@ void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, std::span<co
     return ImageBufferBackend::getPixelBuffer(srcRect, data,destination);
 }
 
+bool ImageBufferJavaBackend::getPixelBufferForSmallRect(const IntRect& srcRect, PixelBuffer& destination)
+{
+    IntRect backendRect { { }, size() };
+    auto srcRectClipped = intersection(backendRect, srcRect);
+    if (srcRectClipped.isEmpty()
+        || srcRectClipped.area() * smallRectAreaDivisor > backendRect.area())
+        return false;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    context().platformContext()->rq().flushBuffer();
+
+    static jmethodID midReadPixels = env->GetMethodID(
+        PG_GetImageClass(env),
+        "readPixels",
+        "(Ljava/nio/ByteBuffer;IIII)Z");
+    ASSERT(midReadPixels);
+
+    unsigned sourceBytesPerRow = 4u * srcRectClipped.width();
+    Vector<uint8_t> pixels(sourceBytesPerRow * srcRectClipped.height());
+    JLObject byteBuffer(env->NewDirectByteBuffer(pixels.data(), pixels.size()));
+    if (WTF::CheckAndClearException(env) || !byteBuffer)
+        return false;
+
+    jboolean read = env->CallBooleanMethod(getWCImage(), midReadPixels,
+        (jobject) byteBuffer,
+        srcRectClipped.x(), srcRectClipped.y(),
+        srcRectClipped.width(), srcRectClipped.height());
+    // The Java side declines when its cached copy of the whole surface is
+    // current, in which case the regular path is just as cheap.
+    if (WTF::CheckAndClearException(env) || !read)
+        return false;
+
+    IntRect destinationRect { IntPoint::zero(), srcRectClipped.size() };
+    if (srcRect.x() < 0)
+        destinationRect.setX(-srcRect.x());
+    if (srcRect.y() < 0)
+        destinationRect.setY(-srcRect.y());
+    if (destinationRect.size() != srcRect.size())
+        destination.zeroFill();
+
+    ConstPixelBufferConversionView source {
+        { AlphaPremultiplication::Premultiplied, convertToPixelFormat(pixelFormat()), colorSpace() },
+        sourceBytesPerRow,
+        pixels.span()
+    };
+    unsigned destinationBytesPerRow = 4u * srcRect.width();
+    PixelBufferConversionView destinationView {
+        destination.format(),
+        destinationBytesPerRow,
+        destination.bytes().subspan(destinationRect.y() * destinationBytesPerRow + destinationRect.x() * 4)
+    };
+    convertImagePixels(source, destinationView, destinationRect.size());
+    return true;
+}
+
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBufferSourceView& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat, std::span<uint8_t> destination)
 {
     ImageBufferBackend::putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, destination);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -107,17 +107,19 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
     static jmethodID midAddImageData = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "addImageData",
-        "([B)V");
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(midAddImageData);
 
+    // The decoder copies the bytes out of the buffer before returning,
+    // so a direct view over the segment is enough and saves the
+    // intermediate Java array.
     while (m_receivedDataSize < data.size()) {
         const auto& someData = data.getSomeData(m_receivedDataSize);
         unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
+        JLObject jBuffer(env->NewDirectByteBuffer(const_cast<void*>(static_cast<const void*>(someData.span().data())), length));
+        if (jBuffer && !WTF::CheckAndClearException(env)) {
             // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.span().data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)jBuffer);
             WTF::CheckAndClearException(env);
         }
         m_receivedDataSize += length;
@@ -178,7 +180,10 @@ size_t ImageDecoderJava::frameCount() const
 
 PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
+    // Asynchronous decoding requests are served on an ImageFrameWorkQueue
+    // thread, which is not necessarily attached to the JVM.
+    WTF::AttachThreadAsDaemonToJavaEnv autoAttach;
+    JNIEnv* env = autoAttach.env();
     if (!env || !m_nativeDecoder) {
         return { };
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,8 @@
 #include "config.h"
 
 #include "GraphicsContext.h"
+#include "ImageJava.h"
+#include "NativeImage.h"
 #include "PlatformJavaClasses.h"
 #include "MediaPlayerPrivateJava.h"
 #include "NotImplemented.h"
@@ -263,6 +265,7 @@ MediaPlayerPrivate::MediaPlayerPrivate(MediaPlayer *player)
     , m_networkState(MediaPlayer::NetworkState::Empty)
     , m_readyState(MediaPlayer::ReadyState::HaveNothing)
     , m_isVisible(false)
+    , m_repaintPending(false)
     , m_hasVideo(false)
     , m_hasAudio(false)
     , m_paused(true)
@@ -411,6 +414,9 @@ void MediaPlayerPrivate::setPageIsVisible(bool visible)
     if (m_isVisible != visible) {
         PLOG_TRACE2("MediaPlayerPrivate setPageIsVisible: %d => %d\n", m_isVisible ? 1 : 0, visible ? 1 : 0);
         m_isVisible = visible;
+        if (visible && m_repaintPending) {
+            m_player->repaint();
+        }
     }
 }
 
@@ -590,6 +596,7 @@ void MediaPlayerPrivate::paint(GraphicsContext& gc, const FloatRect& r)
         PLOG_TRACE0("<<MediaPlayerPrivate paint (!visible)\n");
         return;
     }
+    m_repaintPending = false;
 
     gc.platformContext()->rq().freeSpace(24)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_RENDERMEDIAPLAYER
@@ -601,6 +608,33 @@ void MediaPlayerPrivate::paint(GraphicsContext& gc, const FloatRect& r)
 
 //void MediaPlayerPrivate::paintCurrentFrameInContext(GraphicsContext* c, const IntRect& r) { paint(c, r); }
 
+RefPtr<NativeImage> MediaPlayerPrivate::nativeImageForCurrentTime()
+{
+    if (!m_hasVideo || m_readyState < MediaPlayer::ReadyState::HaveCurrentData)
+        return nullptr;
+
+    // A canvas drawing the video on every animation frame mostly draws a
+    // frame it has drawn before; it gets the same image, whose texture is
+    // shared with the video element and uploaded once per frame.
+    if (m_currentFrameImage)
+        return m_currentFrameImage;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID s_mID
+        = env->GetMethodID(PG_GetMediaPlayerClass(env), "fwkGetCurrentFrameImage", "()Lcom/sun/webkit/graphics/WCImage;");
+    ASSERT(s_mID);
+
+    JLObject frameImage(env->CallObjectMethod(*m_jPlayer, s_mID));
+    if (WTF::CheckAndClearException(env) || !frameImage)
+        return nullptr;
+
+    // The image holds on to the video frame until it is released, so it is
+    // referenced right away rather than when first drawn.
+    m_currentFrameImage = NativeImage::create(ImageJava::create(RQRef::createHandle(frameImage), nullptr,
+        m_naturalSize.width(), m_naturalSize.height()));
+    return m_currentFrameImage;
+}
+
 void MediaPlayerPrivate::setPreload(MediaPlayer::Preload preload)
 {
     // enum Preload { None, MetaData, Auto };
@@ -771,7 +805,19 @@ void MediaPlayerPrivate::notifySizeChanged(int width, int height)
 void MediaPlayerPrivate::notifyNewFrame()
 {
     PLOG_TRACE0(">>MediaPlayerPrivate notifyNewFrame\n");
-    m_player->repaint();
+    // Lets the player reuse the buffer of the frame the image was made of.
+    m_currentFrameImage = nullptr;
+    // Frames that arrive before the previous one was painted only replace
+    // the latest frame; the pending repaint already covers them. While the
+    // page is hidden nothing is painted, the repaint is issued once the
+    // page is shown again.
+    if (m_repaintPending) {
+        return;
+    }
+    m_repaintPending = true;
+    if (m_isVisible) {
+        m_player->repaint();
+    }
     //PLOG_TRACE0("<<MediaPlayerPrivate notifyNewFrame\n");
 }
 
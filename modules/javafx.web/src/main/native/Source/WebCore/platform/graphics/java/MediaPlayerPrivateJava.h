@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -113,6 +113,7 @@ namespace WebCore {
         virtual void paint(GraphicsContext&, const FloatRect&) override;
 
         //virtual void paintCurrentFrameInContext(GraphicsContext* c, const IntRect& r) { paint(c, r); }
+        virtual RefPtr<NativeImage> nativeImageForCurrentTime() override;
         virtual DestinationColorSpace colorSpace() override;
 
         virtual void setPreload(MediaPlayer::Preload) override;
@@ -160,6 +161,7 @@ namespace WebCore {
         volatile MediaPlayer::ReadyState m_readyState;
 
         bool m_isVisible;
+        bool m_repaintPending;  // a frame repaint was requested and has not been painted yet
         bool m_hasVideo;
         bool m_hasAudio;
         FloatSize m_naturalSize;
@@ -172,6 +174,8 @@ namespace WebCore {
         mutable bool m_didLoadingProgress;  // mutable because didLoadingProgress() is declared const
 
         RefPtr<RQRef> m_jPlayer;
+        // image of the latest frame, dropped when a new frame arrives
+        RefPtr<NativeImage> m_currentFrameImage;
 
         void setNetworkState(MediaPlayer::NetworkState networkState);
         void setReadyState(MediaPlayer::ReadyState readyState);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,9 +36,11 @@
 #include "ImageBuffer.h"
 #include "PathStream.h"
 
+#include <numbers>
 #include <wtf/text/WTFString.h>
 #include <wtf/java/JavaRef.h>
 
+#include "com_sun_webkit_graphics_WCPath.h"
 #include "com_sun_webkit_graphics_WCPathIterator.h"
 
 namespace WebCore {
@@ -83,6 +85,12 @@ RefPtr<RQRef> createEmptyPath()
     return RQRef::create(ref);
 }
 
+static bool boundsContain(const FloatRect& bounds, const FloatPoint& point)
+{
+    return point.x() >= bounds.x() && point.x() <= bounds.maxX()
+        && point.y() >= bounds.y() && point.y() <= bounds.maxY();
+}
+
 static GraphicsContext& scratchContext()
 {
     static auto img = ImageBuffer::create(FloatSize(1.f, 1.f), RenderingMode::Unaccelerated, RenderingPurpose::Unspecified, 1, DestinationColorSpace::SRGB(), ImageBufferPixelFormat::BGRA8);
@@ -115,32 +123,83 @@ Ref<PathJava> PathJava::create(RefPtr<RQRef>&& platformPath, RefPtr<PathStream>&
 }
 
 PathJava::PathJava()
-    : m_platformPath(createEmptyPath())
-    , m_elementsStream(PathStream::create())
+    : m_elementsStream(PathStream::create())
 {
 }
 
 PathJava::PathJava(RefPtr<RQRef>&& platformPath, RefPtr<PathStream>&& elementsStream)
     : m_platformPath(WTFMove(platformPath))
     , m_elementsStream(WTFMove(elementsStream))
+    , m_stateIsKnown(false)
+    , m_boundsAreKnown(false)
 {
     ASSERT(m_platformPath);
 }
 
 Ref<PathImpl> PathJava::copy() const
 {
-    RefPtr<RQRef> platformPathCopy(copyPath(platformPath()));
-
     auto elementsStream = m_elementsStream ? RefPtr<PathImpl> { m_elementsStream->copy() } : nullptr;
 
-    return PathJava::create(WTFMove(platformPathCopy), downcast<PathStream>(WTFMove(elementsStream)));
+    Ref<PathJava> pathCopy = m_platformPath
+        ? PathJava::create(copyPath(m_platformPath), downcast<PathStream>(WTFMove(elementsStream)))
+        : adoptRef(*new PathJava);
+    pathCopy->m_pendingVerbs = m_pendingVerbs;
+    pathCopy->m_pendingCoords = m_pendingCoords;
+    pathCopy->m_stateIsKnown = m_stateIsKnown;
+    pathCopy->m_isEmpty = m_isEmpty;
+    pathCopy->m_boundsAreKnown = m_boundsAreKnown;
+    pathCopy->m_boundsAreExact = m_boundsAreExact;
+    pathCopy->m_bounds = m_bounds;
+    return pathCopy;
 }
 
 PlatformPathPtr PathJava::platformPath() const
 {
+    flushSegments();
     return m_platformPath.get();
 }
 
+void PathJava::flushSegments() const
+{
+    if (!m_platformPath)
+        m_platformPath = createEmptyPath();
+    if (m_pendingVerbs.isEmpty())
+        return;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addSegments",
+        "([I[D)V");
+    ASSERT(mid);
+
+    JLocalRef<jintArray> verbs(env->NewIntArray(m_pendingVerbs.size()));
+    env->SetIntArrayRegion(verbs, 0, m_pendingVerbs.size(), m_pendingVerbs.span().data());
+    JLocalRef<jdoubleArray> coords(env->NewDoubleArray(m_pendingCoords.size()));
+    env->SetDoubleArrayRegion(coords, 0, m_pendingCoords.size(), m_pendingCoords.span().data());
+
+    env->CallVoidMethod(*m_platformPath, mid, (jintArray)verbs, (jdoubleArray)coords);
+    WTF::CheckAndClearException(env);
+
+    m_pendingVerbs.clear();
+    m_pendingCoords.clear();
+}
+
+void PathJava::appendSegment(int verb, std::initializer_list<double> coords)
+{
+    m_pendingVerbs.append(verb);
+    m_pendingCoords.append(std::span { coords.begin(), coords.size() });
+}
+
+void PathJava::includeInBounds(const FloatRect& rect, bool exact)
+{
+    m_isEmpty = false;
+    m_boundsAreExact = m_boundsAreExact && exact;
+    if (m_bounds)
+        m_bounds->uniteEvenIfEmpty(rect);
+    else
+        m_bounds = rect;
+}
+
 bool PathJava::definitelyEqual(const PathImpl& otherImpl) const
 {
     RefPtr otherAsPathJava = dynamicDowncast<PathJava>(otherImpl);
@@ -149,7 +208,8 @@ bool PathJava::definitelyEqual(const PathImpl& otherImpl) const
     }
     if (otherAsPathJava.get() == this)
         return true;
-    return m_platformPath == otherAsPathJava->m_platformPath;
+    return m_platformPath && m_pendingVerbs.isEmpty() && otherAsPathJava->m_pendingVerbs.isEmpty()
+        && m_platformPath == otherAsPathJava->m_platformPath;
 }
 void PathJava::add(PathContinuousRoundedRect continuousRoundedRect)
 {
@@ -158,61 +218,36 @@ void PathJava::add(PathContinuousRoundedRect continuousRoundedRect)
 
 void PathJava::add(PathMoveTo moveto)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)moveto.point.x(), (jdouble)moveto.point.y());
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_MOVE_TO, { moveto.point.x(), moveto.point.y() });
+    includeInBounds(FloatRect(moveto.point, FloatSize()));
 }
 
 void PathJava::add(PathLineTo lineTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)lineTo.point.x(), (jdouble)lineTo.point.y());
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_LINE_TO, { lineTo.point.x(), lineTo.point.y() });
+    includeInBounds(FloatRect(lineTo.point, FloatSize()));
 }
 
 void PathJava::add(PathQuadCurveTo quadTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)quadTo.controlPoint.x(), (jdouble)quadTo.controlPoint.y(), (jdouble)quadTo.endPoint.x(), (jdouble)quadTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_QUAD_CURVE_TO, {
+        quadTo.controlPoint.x(), quadTo.controlPoint.y(),
+        quadTo.endPoint.x(), quadTo.endPoint.y() });
+    FloatRect bounds(quadTo.controlPoint, FloatSize());
+    bounds.extend(quadTo.endPoint);
+    includeInBounds(bounds);
 }
 
 void PathJava::add(PathBezierCurveTo bezierTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)bezierTo.controlPoint1.x(), (jdouble)bezierTo.controlPoint1.y(),
-                        (jdouble)bezierTo.controlPoint2.x(), (jdouble)bezierTo.controlPoint2.y(),
-                        (jdouble)bezierTo.endPoint.x(), (jdouble)bezierTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_BEZIER_CURVE_TO, {
+        bezierTo.controlPoint1.x(), bezierTo.controlPoint1.y(),
+        bezierTo.controlPoint2.x(), bezierTo.controlPoint2.y(),
+        bezierTo.endPoint.x(), bezierTo.endPoint.y() });
+    FloatRect bounds(bezierTo.controlPoint1, FloatSize());
+    bounds.extend(bezierTo.controlPoint2);
+    bounds.extend(bezierTo.endPoint);
+    includeInBounds(bounds);
 }
 
 static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
@@ -222,23 +257,17 @@ static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const Flo
 
 void PathJava::add(PathArcTo arcTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)arcTo.controlPoint1.x(), (jdouble)arcTo.controlPoint1.y(),
-                        (jdouble)arcTo.controlPoint2.x(), (jdouble)arcTo.controlPoint2.y(), (jdouble)arcTo.radius);
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_ARC_TO, {
+        arcTo.controlPoint1.x(), arcTo.controlPoint1.y(),
+        arcTo.controlPoint2.x(), arcTo.controlPoint2.y(), arcTo.radius });
+    // The tangent points depend on the current point and may lie beyond
+    // the control points, only the java path knows the bounds from now on.
+    m_isEmpty = false;
+    m_boundsAreKnown = false;
 }
 
 void PathJava::add(PathArc arc)
 {
-    ASSERT(m_platformPath);
     bool clockwise = false;
     const RotationDirection direction = arc.direction;
     if (direction == RotationDirection::Counterclockwise) {
@@ -247,16 +276,12 @@ void PathJava::add(PathArc arc)
         clockwise = false;
     }
 
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)arc.center.x(), (jdouble)arc.center.y(),
-        (jdouble)arc.radius, (jdouble)arc.startAngle, (jdouble)arc.endAngle,
-        bool_to_jbool(clockwise));
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_ARC, {
+        arc.center.x(), arc.center.y(), arc.radius,
+        arc.startAngle, arc.endAngle, clockwise ? 1.0 : 0.0 });
+    // The arc lies within its circle.
+    includeInBounds(FloatRect(arc.center.x() - arc.radius, arc.center.y() - arc.radius,
+        2 * arc.radius, 2 * arc.radius), false);
 }
 void PathJava::add(PathClosedArc closedArc)
 {
@@ -270,32 +295,17 @@ void PathJava::add(PathEllipse ellipse)
 
 void PathJava::add(PathEllipseInRect ellipseInRect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)ellipseInRect.rect.x(), (jdouble)ellipseInRect.rect.y(),
-                        (jdouble)ellipseInRect.rect.width(), (jdouble)ellipseInRect.rect.height());
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_ELLIPSE, {
+        ellipseInRect.rect.x(), ellipseInRect.rect.y(),
+        ellipseInRect.rect.width(), ellipseInRect.rect.height() });
+    includeInBounds(ellipseInRect.rect);
 }
 
 void PathJava::add(PathRect rect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)rect.rect.x(), (jdouble)rect.rect.y(),
-                              (jdouble)rect.rect.width(), (jdouble)rect.rect.height());
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_RECT, {
+        rect.rect.x(), rect.rect.y(), rect.rect.width(), rect.rect.height() });
+    includeInBounds(rect.rect);
 }
 
 void PathJava::add(PathRoundedRect roundedRect)
@@ -306,16 +316,7 @@ void PathJava::add(PathRoundedRect roundedRect)
 
 void PathJava::add(PathCloseSubpath)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_CLOSE_SUBPATH, { });
 }
 
 void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
@@ -358,7 +359,10 @@ bool PathJava::applyElements(const PathElementApplier& applier) const
 
 bool PathJava::isEmpty() const
 {
-    ASSERT(m_platformPath);
+    if (m_stateIsKnown)
+        return m_isEmpty;
+
+    flushSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -381,19 +385,14 @@ FloatPoint PathJava::currentPoint() const
 
 bool PathJava::transform(const AffineTransform& transform)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "transform", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)transform.a(), (jdouble)transform.b(),
-                        (jdouble)transform.c(), (jdouble)transform.d(),
-                        (jdouble)transform.e(), (jdouble)transform.f());
-    WTF::CheckAndClearException(env);
+    appendSegment(com_sun_webkit_graphics_WCPath_SEGMENT_TRANSFORM, {
+        transform.a(), transform.b(), transform.c(),
+        transform.d(), transform.e(), transform.f() });
+    if (m_bounds) {
+        // Without rotation or skew the transformed bounds stay exact.
+        m_boundsAreExact = m_boundsAreExact && !transform.b() && !transform.c();
+        m_bounds = transform.mapRect(*m_bounds);
+    }
     return true;
 }
 
@@ -402,7 +401,11 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
     if (isEmpty() || !std::isfinite(point.x()) || !std::isfinite(point.y()))
         return false;
 
-    ASSERT(m_platformPath);
+    // The filled area lies within the points of the path.
+    if (m_boundsAreKnown && m_bounds && !boundsContain(*m_bounds, point))
+        return false;
+
+    flushSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -419,7 +422,6 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
 
 bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
     ASSERT(strokeStyleApplier);
 
     GraphicsContext& gc = scratchContext();
@@ -440,6 +442,17 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
     gc.restore();
 
+    if (m_boundsAreKnown && m_bounds) {
+        // Joins extend up to the miter length, square caps up to half the
+        // diagonal of the pen.
+        FloatRect strokeBounds = *m_bounds;
+        strokeBounds.inflate(thickness / 2 * std::max(miterLimit, std::numbers::sqrt2_v<float>));
+        if (!boundsContain(strokeBounds, p))
+            return false;
+    }
+
+    flushSegments();
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "strokeContains",
@@ -462,6 +475,8 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
 FloatRect PathJava::fastBoundingRect() const
 {
+    if (m_boundsAreKnown)
+        return m_bounds.value_or(FloatRect());
     return boundingRect();
 }
 
@@ -470,9 +485,28 @@ FloatRect PathJava::boundingRect() const
     return strokeBoundingRect(nullptr);
 }
 
+static void inflateByStrokeThickness(FloatRect& bounds, const Function<void(GraphicsContext&)>& strokeStyleApplier)
+{
+    if (!strokeStyleApplier)
+        return;
+    GraphicsContext& gc = scratchContext();
+    gc.save();
+    strokeStyleApplier(gc);
+    float thickness = gc.strokeThickness();
+    gc.restore();
+    bounds.inflate(thickness / 2);
+}
+
 FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
+    if (m_boundsAreKnown && m_boundsAreExact) {
+        FloatRect bounds = m_bounds.value_or(FloatRect());
+        if (m_bounds)
+            inflateByStrokeThickness(bounds, strokeStyleApplier);
+        return bounds;
+    }
+
+    flushSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -499,15 +533,7 @@ FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& s
             float(env->GetFloatField(rect, recthFID)));
         WTF::CheckAndClearException(env);
 
-        float thickness;
-        if (strokeStyleApplier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            strokeStyleApplier(gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
-        }
+        inflateByStrokeThickness(bounds, strokeStyleApplier);
         return bounds;
     } else {
         return FloatRect();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -85,8 +85,25 @@ private:
     FloatRect fastBoundingRect() const final;
     FloatRect boundingRect() const final;
 
-    RefPtr<RQRef> m_platformPath;
+    void appendSegment(int verb, std::initializer_list<double> coords);
+    void includeInBounds(const FloatRect&, bool exact = true);
+    void flushSegments() const;
+
+    // The java path is created and updated lazily, the segments added since
+    // the last update are kept in m_pendingVerbs and m_pendingCoords.
+    mutable RefPtr<RQRef> m_platformPath;
+    mutable Vector<int> m_pendingVerbs;
+    mutable Vector<double> m_pendingCoords;
     RefPtr<PathStream> m_elementsStream;
+
+    // Native copy of the path state, so that the common queries do not need
+    // the java path. m_bounds encloses all the points of the path, it is
+    // the java control point bounds if m_boundsAreExact is set.
+    bool m_stateIsKnown { true };
+    bool m_isEmpty { true };
+    bool m_boundsAreKnown { true };
+    bool m_boundsAreExact { true };
+    std::optional<FloatRect> m_bounds;
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,13 +29,40 @@
 #include "Path.h"
 #include "RenderingQueue.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
+#include <array>
 #include <jni.h>
+#include <optional>
 #include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
     RefPtr<RQRef> copyPath(RefPtr<RQRef> p);
 
+    // The state values last written to the rendering queue. Used to drop
+    // state commands that would not change the java graphics context.
+    struct PlatformStateShadow {
+        std::optional<std::array<float, 4>> fillColor;
+        std::optional<std::array<float, 4>> strokeColor;
+        std::optional<float> strokeThickness;
+        std::optional<jint> strokeStyle;
+        std::optional<std::array<jint, 2>> textMode;
+        std::optional<jint> compositeOperation;
+        std::optional<float> alpha;
+        std::optional<std::array<float, 7>> shadow;
+
+        // Records the value and returns true if it differs from the shadowed one.
+        template<typename T>
+        static bool update(std::optional<T>& shadowed, const T& value)
+        {
+            if (shadowed && *shadowed == value) {
+                return false;
+            }
+            shadowed = value;
+            return true;
+        }
+    };
+
     class PlatformContextJava {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
     public:
@@ -119,6 +146,26 @@ namespace WebCore {
         void setMiterLimit(float miterLimit) {
             m_miterLimit = miterLimit;
         }
+
+        // The shadow is only trusted until the recorded buffers are handed
+        // off to java, the java context may be reset or replaced afterwards.
+        PlatformStateShadow& stateShadow() {
+            if (m_stateShadowHandOffCount != m_rq->handOffCount()) {
+                m_stateShadow = { };
+                m_stateShadowStack.clear();
+                m_stateShadowHandOffCount = m_rq->handOffCount();
+            }
+            return m_stateShadow;
+        }
+
+        void saveStateShadow() {
+            m_stateShadowStack.append(stateShadow());
+        }
+
+        void restoreStateShadow() {
+            PlatformStateShadow& shadow = stateShadow();
+            shadow = m_stateShadowStack.isEmpty() ? PlatformStateShadow { } : m_stateShadowStack.takeLast();
+        }
     private:
         RefPtr<RenderingQueue> m_rq;
         RefPtr<RQRef> m_jRenderTheme;
@@ -130,5 +177,8 @@ namespace WebCore {
         LineCap m_lineCap { };
         LineJoin m_lineJoin { };
         float m_miterLimit { };
+        PlatformStateShadow m_stateShadow;
+        Vector<PlatformStateShadow> m_stateShadowStack;
+        unsigned m_stateShadowHandOffCount { 0 };
     };
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,22 @@
 
 namespace WebCore {
 
+RefPtr<RQRef> RQRef::createHandle(const JLObject &obj)
+{
+    if (!obj)
+        return nullptr;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetRefClass(env), "fwkAcquire", "()I");
+    ASSERT(mid);
+    jint refID = env->CallIntMethod(obj, mid);
+    if (WTF::CheckAndClearException(env))
+        return nullptr;
+
+    return adoptRef(new RQRef(refID));
+}
+
 RQRef::~RQRef()
 {
     if (-1 != m_refID) {
@@ -36,15 +52,48 @@ RQRef::~RQRef()
 
         if (env) {
             //do it if JVM is here.
-            static jmethodID mid = env->GetMethodID(PG_GetRefClass(env), "deref", "()V");
-            ASSERT(mid);
-            env->CallVoidMethod(m_ref, mid);
+            if (m_ref) {
+                static jmethodID mid = env->GetMethodID(PG_GetRefClass(env), "deref", "()V");
+                ASSERT(mid);
+                env->CallVoidMethod(m_ref, mid);
+            } else {
+                static jmethodID mid = env->GetStaticMethodID(PG_GetRefClass(env), "fwkRelease", "(I)V");
+                ASSERT(mid);
+                env->CallStaticVoidMethod(PG_GetRefClass(env), mid, m_refID);
+            }
 
             WTF::CheckAndClearException(env);
         }
     }
 }
 
+JLObject RQRef::lookup() const
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(PG_GetRefClass(env), "fwkGetRef",
+        "(I)Lcom/sun/webkit/graphics/Ref;");
+    ASSERT(mid);
+    JLObject obj(env->CallStaticObjectMethod(PG_GetRefClass(env), mid, m_refID));
+    WTF::CheckAndClearException(env);
+    return obj;
+}
+
+RQRef::operator jobject()
+{
+    // A handle-only ref is resolved once and then held like any other.
+    if (!m_ref && -1 != m_refID)
+        m_ref = lookup();
+    return m_ref;
+}
+
+JLObject RQRef::cloneLocalCopy() const
+{
+    if (!m_ref && -1 != m_refID)
+        return lookup();
+    return m_ref;
+}
+
 RQRef::operator jint() {
     if (-1 == m_refID) {
         JNIEnv* env = WTF::GetJavaEnv();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,11 +38,13 @@ public:
     {
         return obj ? adoptRef(new RQRef(obj)) : nullptr;
     }
+    // Registers obj in the Java ref table right away and keeps only its
+    // handle. Meant for objects native code merely passes to the rendering
+    // queue, which then cost no JNI global reference.
+    static RefPtr<RQRef> createHandle(const JLObject &obj);
     operator jint();
-    operator jobject() {return m_ref;}
-    JLObject cloneLocalCopy() const {
-        return m_ref;
-    }
+    operator jobject();
+    JLObject cloneLocalCopy() const;
     ~RQRef();
 
 private:
@@ -50,6 +52,11 @@ private:
         : m_ref(obj)
         , m_refID(-1)
     {}
+    explicit RQRef(jint refID)
+        : m_refID(refID)
+    {}
+
+    JLObject lookup() const;
 
     JGObject m_ref;
     jint m_refID;
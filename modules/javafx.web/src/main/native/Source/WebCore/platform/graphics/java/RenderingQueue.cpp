@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,48 @@ static Addr2ByteBuffer& getAddr2ByteBuffer()
     return container.get();
 }
 
+/*static*/
+ByteBufferPool& ByteBufferPool::shared()
+{
+    static NeverDestroyed<ByteBufferPool> pool;
+    return pool.get();
+}
+
+RefPtr<ByteBuffer> ByteBufferPool::acquire(int capacity)
+{
+    auto it = m_freeBuffers.find(capacity);
+    if (it != m_freeBuffers.end() && !it->value.isEmpty()) {
+        ++m_hitCount;
+        return it->value.takeLast();
+    }
+    ++m_missCount;
+    return ByteBuffer::create(capacity);
+}
+
+void ByteBufferPool::recycle(RefPtr<ByteBuffer>&& buffer)
+{
+    // The buffer may still be referenced (e.g. by a queue of a canvas
+    // that has not been drawn yet), let the last owner free it then.
+    if (!buffer || !buffer->hasOneRef()) {
+        return;
+    }
+    auto& freeBuffers = m_freeBuffers.add(buffer->capacity(), Vector<RefPtr<ByteBuffer>>()).iterator->value;
+    if (freeBuffers.size() >= MAX_POOLED_BUFFER_COUNT) {
+        return;
+    }
+    buffer->reset();
+    freeBuffers.append(WTFMove(buffer));
+}
+
+jlong ByteBufferPool::pooledCount() const
+{
+    jlong count = 0;
+    for (auto& freeBuffers : m_freeBuffers.values()) {
+        count += freeBuffers.size();
+    }
+    return count;
+}
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
@@ -59,28 +101,21 @@ RefPtr<RenderingQueue> RenderingQueue::create(
 
 RenderingQueue& RenderingQueue::freeSpace(int size) {
     if (m_buffer && !m_buffer->hasFreeSpace(size)) {
-        flushBuffer();
+        // The filled buffer is chained to the pending ones, java gets
+        // the whole chain in one upcall when it is flushed or full.
+        m_pendingBuffers.append(WTFMove(m_buffer));
         if (m_autoFlush) {
-            flush();
+            handOffBuffers(true);
+        } else if (m_pendingBuffers.size() >= MAX_BUFFER_COUNT) {
+            handOffBuffers(false);
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = ByteBufferPool::shared().acquire(std::max(m_capacity, size));
     }
     return *this;
 }
 
-void RenderingQueue::flush() {
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID midFwkFlush = env->GetMethodID(
-            PG_GetRenderQueueClass(env), "fwkFlush", "()V");
-    ASSERT(midFwkFlush);
-
-    env->CallVoidMethod(getWCRenderingQueue(), midFwkFlush);
-    WTF::CheckAndClearException(env);
-}
-
 void RenderingQueue::disposeGraphics() {
     JNIEnv* env = WTF::GetJavaEnv();
     // The method is called from the dtor which potentially can be called after VM detach.
@@ -103,24 +138,52 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     if (isEmpty()) {
         return *this;
     }
+    if (m_buffer && !m_buffer->isEmpty()) {
+        m_pendingBuffers.append(WTFMove(m_buffer));
+    }
+    m_buffer = nullptr;
+    handOffBuffers(false);
+
+    return *this;
+}
+
+/*
+ * Passes all the pending buffers (and optionally the flush request)
+ * to java with a single upcall.
+ */
+void RenderingQueue::handOffBuffers(bool flush) {
+    if (m_pendingBuffers.isEmpty()) {
+        return;
+    }
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
-    ASSERT(midFwkAddBuffer);
+    static jmethodID midFwkAddBuffers = env->GetMethodID(PG_GetRenderQueueClass(env),
+        "fwkAddBuffers", "([Ljava/nio/ByteBuffer;Z)V");
+    ASSERT(midFwkAddBuffers);
+
+    static JGClass byteBufferCls(env->FindClass("java/nio/ByteBuffer"));
+    ASSERT(byteBufferCls);
+
+    JLObjectArray jbufs(env->NewObjectArray(m_pendingBuffers.size(), byteBufferCls, nullptr));
+    if (!jbufs || WTF::CheckAndClearException(env)) {
+        return;
+    }
 
     Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
-    a2bb.set(m_buffer->bufferAddress(), m_buffer);
+    for (size_t i = 0; i < m_pendingBuffers.size(); ++i) {
+        auto& buffer = m_pendingBuffers[i];
+        a2bb.set(buffer->bufferAddress(), buffer);
+        env->SetObjectArrayElement(jbufs, i, (jobject)(buffer->createDirectByteBuffer(env)));
+    }
+    m_pendingBuffers.clear();
+    ++m_handOffCount;
+
     env->CallVoidMethod(
         getWCRenderingQueue(),
-        midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        midFwkAddBuffers,
+        (jobjectArray)jbufs,
+        bool_to_jbool(flush));
     WTF::CheckAndClearException(env);
-
-    m_buffer = nullptr;
-
-    return *this;
-}
 }
 
 
@@ -139,7 +202,20 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
         char *key = (char *)env->GetDirectBufferAddress(
             JLObject(env->GetObjectArrayElement(bufs, i)));
         if (key != 0) {
-            a2bb.remove(key);
+            ByteBufferPool::shared().recycle(a2bb.take(key));
         }
     }
 }
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkGetBufferPoolCounters
+    (JNIEnv* env, jclass)
+{
+    using namespace WebCore;
+    ByteBufferPool& pool = ByteBufferPool::shared();
+    jlong counters[] = { pool.hitCount(), pool.missCount(), pool.pooledCount() };
+    jlongArray result = env->NewLongArray(3);
+    if (result) {
+        env->SetLongArrayRegion(result, 0, 3, counters);
+    }
+    return result;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 #include <jni.h>
 #include <wtf/Vector.h>
 #include <wtf/RefCounted.h>
+#include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
 #include <wtf/java/DbgUtils.h>
 
@@ -66,6 +67,12 @@ public:
         m_position += sizeof(jint);
     }
 
+    void putShort(jshort s) {
+        ASSERT(m_position + sizeof(jshort) <= m_capacity);
+        memcpy((m_buffer + m_position), &s, sizeof(jshort));
+        m_position += sizeof(jshort);
+    }
+
     void putFloat(jfloat f) {
         ASSERT(m_position + sizeof(jfloat) <= m_capacity);
         memcpy((m_buffer + m_position), &f, sizeof(jfloat));
@@ -76,6 +83,16 @@ public:
 
     bool isEmpty() { return m_position == 0; }
 
+    int capacity() { return m_capacity; }
+
+    // Prepares the buffer for reuse: the resources referenced by the
+    // previous content and the NIO wrapper are released, the memory is kept.
+    void reset() {
+        m_refList.clear();
+        m_nio_holder.clear();
+        m_position = 0;
+    }
+
     ~ByteBuffer() {
         delete[] m_buffer;
     }
@@ -94,6 +111,31 @@ private:
     Vector< RefPtr<RQRef> > m_refList;
 };
 
+/*
+ * A pool of ByteBuffers returned by Java's WCRenderQueue after decoding.
+ * Buffers are kept per capacity so that steady-state painting does not
+ * allocate. Both acquire and recycle happen on the Event thread, so no
+ * locking is needed.
+ */
+class ByteBufferPool {
+public:
+    static const size_t MAX_POOLED_BUFFER_COUNT = 32;
+
+    static ByteBufferPool& shared();
+
+    RefPtr<ByteBuffer> acquire(int capacity);
+    void recycle(RefPtr<ByteBuffer>&& buffer);
+
+    jlong hitCount() const { return m_hitCount; }
+    jlong missCount() const { return m_missCount; }
+    jlong pooledCount() const;
+
+private:
+    HashMap<int, Vector<RefPtr<ByteBuffer>>> m_freeBuffers;
+    jlong m_hitCount { 0 };
+    jlong m_missCount { 0 };
+};
+
 /*
  * A lifecycle of an instance of RenderingQueue (RQ) used to draw to ImageBufferJava
  * may continue after the RQ is flushed to java (e.g. when it's used for html5 canvas).
@@ -126,6 +168,11 @@ public:
         return *this;
     }
 
+    RenderingQueue& operator << (jshort s) {
+        m_buffer->putShort(s);
+        return *this;
+    }
+
     RenderingQueue& operator << (jfloat f) {
         m_buffer->putFloat(f);
         return *this;
@@ -134,8 +181,11 @@ public:
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
+    // Incremented each time the recorded buffers are passed to java
+    unsigned handOffCount() const { return m_handOffCount; }
+
     bool isEmpty() {
-        return m_buffer == nullptr || m_buffer->isEmpty();
+        return m_pendingBuffers.isEmpty() && (m_buffer == nullptr || m_buffer->isEmpty());
     }
 
     JLObject getWCRenderingQueue() {
@@ -160,8 +210,8 @@ private:
         m_buffer(nullptr)
     {}
 
-    void flush();
     void disposeGraphics();
+    void handOffBuffers(bool flush);
 
     //we need to have RQRef here due to [deref]
     //callback in destructor. Texture need to be released.
@@ -170,6 +220,10 @@ private:
     int m_capacity;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
+    // Filled buffers not yet passed to java. They are handed off
+    // in a single upcall (at most MAX_BUFFER_COUNT at a time).
+    Vector<RefPtr<ByteBuffer>, MAX_BUFFER_COUNT> m_pendingBuffers;
+    unsigned m_handOffCount { 0 };
 
 };
 } // namespace WebCore
@@ -107,14 +107,16 @@ BitmapTexture::BitmapTexture(const IntSize& size, OptionSet<Flags> flags)
     }
 #endif
 
+#if PLATFORM(JAVA)
+    allocateTexture();
+#else
     GLint boundTexture = 0;
-    #if !PLATFORM(JAVA)
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &boundTexture);
 
     allocateTexture();
 
     glBindTexture(GL_TEXTURE_2D, boundTexture);
-    #endif
+#endif
 }
 
 void BitmapTexture::createTexture()
@@ -132,10 +134,13 @@ void BitmapTexture::createTexture()
 
 void BitmapTexture::allocateTexture()
 {
+#if PLATFORM(JAVA)
+    m_imageBuffer = ImageBuffer::create(m_size, RenderingMode::Accelerated, RenderingPurpose::LayerBacking, 1,
+        DestinationColorSpace::SRGB(), ImageBufferPixelFormat::BGRA8);
+#else
     createTexture();
-    #if !PLATFORM(JAVA)
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_size.width(), m_size.height(), 0, textureFormat, s_pixelDataType, nullptr);
-    #endif
+#endif
 }
 
 #if USE(GBM)
@@ -183,6 +188,9 @@ void BitmapTexture::swapTexture(BitmapTexture& other)
 #endif
     std::swap(m_flags, other.m_flags);
     std::swap(m_id, other.m_id);
+#if PLATFORM(JAVA)
+    std::swap(m_imageBuffer, other.m_imageBuffer);
+#endif
 
     // This texture needs to be in the same pixel format as the 'other'
     // texture, before the reset above. The 'other' texture should be
@@ -197,7 +205,18 @@ void BitmapTexture::reset(const IntSize& size, OptionSet<Flags> flags)
     // We don't support switching from dmabuf backing to regular textures -- there is no use-case for that scenario.
     RELEASE_ASSERT(m_flags.contains(Flags::BackedByDMABuf) == flags.contains(Flags::BackedByDMABuf));
 #endif
-#if !PLATFORM(JAVA)
+#if PLATFORM(JAVA)
+    m_flags = flags;
+    m_filterOperation = nullptr;
+
+    // Pooled textures keep their render target when the size matches.
+    if (m_size == size && m_imageBuffer) {
+        m_imageBuffer->context().clearRect(FloatRect({ }, m_size));
+        return;
+    }
+    m_size = size;
+    allocateTexture();
+#else
     m_flags = flags;
     m_shouldClear = true;
     m_pixelFormat = PixelFormat::RGBA8;
@@ -333,6 +352,16 @@ void BitmapTexture::updateContents(NativeImage* frameImage, const IntRect& targe
     if (!frameImage)
         return;
 
+#if PLATFORM(JAVA)
+    if (!m_imageBuffer)
+        return;
+
+    GraphicsContext& context = m_imageBuffer->context();
+    context.clearRect(targetRect);
+    context.drawNativeImage(*frameImage, FloatRect(targetRect), FloatRect(offset, targetRect.size()), { CompositeOperator::Copy });
+    return;
+#endif
+
 #if USE(CAIRO)
     cairo_surface_t* surface = frameImage->platformImage().get();
     const uint8_t* imageData = cairo_image_surface_get_data(surface);
@@ -353,6 +382,27 @@ void BitmapTexture::updateContents(NativeImage* frameImage, const IntRect& targe
 
 void BitmapTexture::updateContents(GraphicsLayer* sourceLayer, const IntRect& targetRect, const IntPoint& offset, float scale)
 {
+#if PLATFORM(JAVA)
+    // Paint straight into the render target; only the dirty part of the
+    // layer is rasterized, and the result is reused until it changes again.
+    if (!m_imageBuffer)
+        return;
+
+    GraphicsContext& context = m_imageBuffer->context();
+    GraphicsContextStateSaver stateSaver(context);
+    context.clip(targetRect);
+    context.clearRect(targetRect);
+    context.setTextDrawingMode(TextDrawingMode::Fill);
+
+    IntRect sourceRect(targetRect);
+    sourceRect.setLocation(offset);
+    sourceRect.scale(1 / scale);
+    context.translate(targetRect.x(), targetRect.y());
+    context.applyDeviceScaleFactor(scale);
+    context.translate(-sourceRect.x(), -sourceRect.y());
+
+    sourceLayer->paintGraphicsLayerContents(context, sourceRect);
+#else
     // Making an unconditionally unaccelerated buffer here is OK because this code
     // isn't used by any platforms that respect the accelerated bit.
     auto imageBuffer = ImageBuffer::create(targetRect.size(), RenderingMode::Unaccelerated, RenderingPurpose::Unspecified, 1, DestinationColorSpace::SRGB(), ImageBufferPixelFormat::BGRA8);
@@ -375,6 +425,7 @@ void BitmapTexture::updateContents(GraphicsLayer* sourceLayer, const IntRect& ta
         return;
 
     updateContents(image.get(), targetRect, IntPoint());
+#endif
 }
 
 void BitmapTexture::initializeStencil()
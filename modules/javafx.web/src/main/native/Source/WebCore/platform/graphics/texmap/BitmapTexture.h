@@ -46,6 +46,9 @@ typedef void *EGLImage;
 namespace WebCore {
 
 class GraphicsLayer;
+#if PLATFORM(JAVA)
+class ImageBuffer;
+#endif
 class NativeImage;
 class TextureMapper;
 enum class TextureMapperFlags : uint16_t;
@@ -106,6 +109,12 @@ public:
     MemoryMappedGPUBuffer* memoryMappedGPUBuffer() const { return m_memoryMappedGPUBuffer.get(); }
 #endif
 
+#if PLATFORM(JAVA)
+    // The texture is a Prism render target; layer contents are painted
+    // into it and it is composited by drawing it with the layer transform.
+    ImageBuffer* imageBuffer() const { return m_imageBuffer.get(); }
+#endif
+
 private:
     BitmapTexture(const IntSize&, OptionSet<Flags>);
 #if USE(GBM)
@@ -136,6 +145,9 @@ private:
 #if USE(GBM)
     std::unique_ptr<MemoryMappedGPUBuffer> m_memoryMappedGPUBuffer;
 #endif
+#if PLATFORM(JAVA)
+    RefPtr<ImageBuffer> m_imageBuffer;
+#endif
 };
 
 } // namespace WebCore
@@ -600,7 +600,13 @@ bool GraphicsLayerTextureMapper::filtersCanBeComposited(const FilterOperations&
     if (!filters.size())
         return false;
 
+#if PLATFORM(JAVA)
+    // Layer textures are drawn by Prism, which has no filter passes, so
+    // filters stay part of the painted layer contents.
+    return false;
+#else
     return !filters.hasReferenceFilter();
+#endif
 }
 
 bool GraphicsLayerTextureMapper::addAnimation(const KeyframeValueList& valueList, const FloatSize& boxSize, const Animation* anim, const String& keyframesName, double timeOffset)
@@ -39,6 +39,10 @@
 #include "LengthFunctions.h"
 #include "TextureMapperFlags.h"
 #include "TextureMapperShaderProgram.h"
+#if PLATFORM(JAVA)
+#include "PlatformContextJava.h"
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
+#endif
 #include <wtf/HashMap.h>
 #include <wtf/MathExtras.h>
 #include <wtf/NeverDestroyed.h>
@@ -275,6 +279,10 @@ void TextureMapper::beginPainting(FlipY flipY, BitmapTexture* surface)
     glGetIntegerv(GL_FRAMEBUFFER_BINDING, &data().targetFrameBuffer);
     data().flipY = flipY;
     bindSurface(surface);
+#else
+    UNUSED_PARAM(flipY);
+    m_clipContexts.clear();
+    bindSurface(surface);
 #endif
 }
 
@@ -299,9 +307,37 @@ void TextureMapper::endPainting()
         glEnable(GL_DEPTH_TEST);
     else
         glDisable(GL_DEPTH_TEST);
+#else
+    ASSERT(m_clipContexts.isEmpty());
+    m_currentSurface = nullptr;
 #endif
 }
 
+#if PLATFORM(JAVA)
+GraphicsContext* TextureMapper::currentContext() const
+{
+    if (m_currentSurface)
+        return m_currentSurface->imageBuffer() ? &m_currentSurface->imageBuffer()->context() : nullptr;
+    return m_graphicsContext;
+}
+
+// Prism applies the full layer transform, including its 3D part, when
+// the quad is drawn, so nothing is rasterized again for a transform or
+// opacity change.
+static void setPerspectiveTransform(GraphicsContext& context, const TransformationMatrix& matrix)
+{
+    auto* platformContext = context.platformContext();
+    if (!platformContext)
+        return;
+    platformContext->rq().freeSpace(68)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM
+        << (float)matrix.m11() << (float)matrix.m12() << (float)matrix.m13() << (float)matrix.m14()
+        << (float)matrix.m21() << (float)matrix.m22() << (float)matrix.m23() << (float)matrix.m24()
+        << (float)matrix.m31() << (float)matrix.m32() << (float)matrix.m33() << (float)matrix.m34()
+        << (float)matrix.m41() << (float)matrix.m42() << (float)matrix.m43() << (float)matrix.m44();
+}
+#endif
+
 void TextureMapper::drawBorder(const Color& color, float width, const FloatRect& targetRect, const TransformationMatrix& modelViewMatrix)
 {
 #if !PLATFORM(JAVA)
@@ -316,6 +352,15 @@ void TextureMapper::drawBorder(const Color& color, float width, const FloatRect&
     glLineWidth(width);
 
     draw(targetRect, modelViewMatrix, program.get(), GL_LINE_LOOP, !color.isOpaque() ? TextureMapperFlags::ShouldBlend : OptionSet<TextureMapperFlags> { });
+#else
+    GraphicsContext* context = currentContext();
+    if (!context)
+        return;
+
+    GraphicsContextStateSaver stateSaver(*context);
+    setPerspectiveTransform(*context, modelViewMatrix);
+    context->setStrokeColor(color);
+    context->strokeRect(targetRect, width);
 #endif
 }
 
@@ -528,6 +573,19 @@ void TextureMapper::drawTexture(const BitmapTexture& texture, const FloatRect& t
     SetForScope filterOperation(data().filterOperation, texture.filterOperation());
 
     drawTexture(texture.id(), texture.colorConvertFlags() | (texture.isOpaque() ? OptionSet<TextureMapperFlags> { } : TextureMapperFlags::ShouldBlend), targetRect, matrix, opacity, allEdgesExposed);
+#else
+    UNUSED_PARAM(allEdgesExposed);
+    GraphicsContext* context = currentContext();
+    if (!context || !texture.imageBuffer() || &texture == m_currentSurface.get())
+        return;
+
+    GraphicsContextStateSaver stateSaver(*context);
+    context->setAlpha(opacity);
+    // A mask keeps the surface it is drawn into where the mask is opaque.
+    if (isInMaskMode())
+        context->setCompositeOperation(CompositeOperator::DestinationIn);
+    setPerspectiveTransform(*context, matrix);
+    context->drawImageBuffer(*texture.imageBuffer(), targetRect);
 #endif
 }
 
@@ -822,6 +880,16 @@ void TextureMapper::drawSolidColor(const FloatRect& rect, const TransformationMa
         flags.add(TextureMapperFlags::ShouldBlend);
 
     draw(rect, matrix, program.get(), GL_TRIANGLE_FAN, flags);
+#else
+    GraphicsContext* context = currentContext();
+    if (!context)
+        return;
+
+    GraphicsContextStateSaver stateSaver(*context);
+    if (!isBlendingAllowed)
+        context->setCompositeOperation(CompositeOperator::Copy);
+    setPerspectiveTransform(*context, matrix);
+    context->fillRect(rect, color);
 #endif
 }
 
@@ -831,6 +899,14 @@ void TextureMapper::clearColor(const Color& color)
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
     glClearColor(r, g, b, a);
     glClear(GL_COLOR_BUFFER_BIT);
+#else
+    GraphicsContext* context = currentContext();
+    if (!context)
+        return;
+
+    GraphicsContextStateSaver stateSaver(*context);
+    context->setCompositeOperation(CompositeOperator::Copy);
+    context->fillRect(context->clipBounds(), color);
 #endif
 }
 
@@ -1343,6 +1419,10 @@ void TextureMapper::bindDefaultSurface()
 
 void TextureMapper::bindSurface(BitmapTexture *surface)
 {
+#if PLATFORM(JAVA)
+    m_currentSurface = surface;
+    return;
+#endif
     if (!surface) {
         bindDefaultSurface();
         return;
@@ -1355,7 +1435,11 @@ void TextureMapper::bindSurface(BitmapTexture *surface)
 
 BitmapTexture* TextureMapper::currentSurface()
 {
+#if PLATFORM(JAVA)
+    return m_currentSurface.get();
+#else
     return data().currentSurface.get();
+#endif
 }
 
 bool TextureMapper::beginScissorClip(const TransformationMatrix& modelViewMatrix, const FloatRect& targetRect)
@@ -1461,6 +1545,22 @@ void TextureMapper::beginClip(const TransformationMatrix& modelViewMatrix, const
     // Increase stencilIndex and apply stencil testing.
     clipStack().setStencilIndex(stencilIndex * 2);
     clipStack().applyIfNeeded();
+#else
+    GraphicsContext* context = currentContext();
+    m_clipContexts.append(context);
+    if (!context)
+        return;
+
+    // Prism clips in device space, so the clip is applied through the
+    // affine part of the transform only.
+    auto previousTransform = context->getCTM();
+    context->save();
+    context->concatCTM(modelViewMatrix.toAffineTransform());
+    if (targetRect.isRounded())
+        context->clipRoundedRect(targetRect);
+    else
+        context->clip(targetRect.rect());
+    context->setCTM(previousTransform);
 #endif
 }
 
@@ -1524,46 +1624,86 @@ void TextureMapper::beginClip(const TransformationMatrix& modelViewMatrix, const
     // Increase stencilIndex and apply stencil testing.
     clipStack().setStencilIndex(stencilIndex * 2);
     clipStack().applyIfNeeded();
+#else
+    beginClip(modelViewMatrix, FloatRoundedRect(clipPath.bounds()));
 #endif
 }
 
 void TextureMapper::beginClipWithoutApplying(const TransformationMatrix& modelViewMatrix, const FloatRect& targetRect)
 {
+#if PLATFORM(JAVA)
+    beginClip(modelViewMatrix, FloatRoundedRect(targetRect));
+#else
     clipStack().push();
     clipStack().intersect(enclosingIntRect(modelViewMatrix.mapRect(targetRect)));
+#endif
 }
 
 void TextureMapper::endClip()
 {
+#if PLATFORM(JAVA)
+    ASSERT(!m_clipContexts.isEmpty());
+    if (m_clipContexts.isEmpty())
+        return;
+    if (GraphicsContext* context = m_clipContexts.takeLast())
+        context->restore();
+#else
     clipStack().pop();
     clipStack().applyIfNeeded();
+#endif
 }
 
 void TextureMapper::endClipWithoutApplying()
 {
+#if PLATFORM(JAVA)
+    endClip();
+#else
     clipStack().pop();
+#endif
 }
 
 IntRect TextureMapper::clipBounds()
 {
+#if PLATFORM(JAVA)
+    if (GraphicsContext* context = currentContext())
+        return context->clipBounds();
+    return { };
+#else
     return clipStack().current().scissorBox;
+#endif
 }
 
+#if PLATFORM(JAVA)
+static const int s_maxTextureSize = 2048;
+#endif
+
 IntSize TextureMapper::maxTextureSize() const
 {
+#if PLATFORM(JAVA)
+    return IntSize(s_maxTextureSize, s_maxTextureSize);
+#else
     return IntSize(data().maxTextureSize(), data().maxTextureSize());
+#endif
 }
 
 void TextureMapper::setDepthRange(double zNear, double zFar)
 {
+#if PLATFORM(JAVA)
+    m_depthRange = { zNear, zFar };
+#else
     data().zNear = zNear;
     data().zFar = zFar;
     updateProjectionMatrix();
+#endif
 }
 
 std::pair<double, double> TextureMapper::depthRange() const
 {
+#if PLATFORM(JAVA)
+    return m_depthRange;
+#else
     return { data().zNear, data().zFar };
+#endif
 }
 
 void TextureMapper::updateProjectionMatrix()
@@ -44,6 +44,9 @@ typedef void *EGLImage;
 namespace WebCore {
 
 class ClipPath;
+#if PLATFORM(JAVA)
+class GraphicsContext;
+#endif
 class TextureMapperGLData;
 class TextureMapperGPUBuffer;
 class TextureMapperShaderProgram;
@@ -123,6 +126,13 @@ public:
     const std::optional<Damage>& damage() const { return m_damage; }
 #endif
 
+#if PLATFORM(JAVA)
+    // The page context that the composited layers are drawn into. Layer
+    // textures are Prism render targets, and each one is drawn with its
+    // layer transform handed to Prism as a perspective transform.
+    void setGraphicsContext(GraphicsContext* context) { m_graphicsContext = context; }
+#endif
+
 private:
     bool isInMaskMode() const { return m_isMaskMode; }
     const TransformationMatrix& patternTransform() const { return m_patternTransform; }
@@ -150,6 +160,10 @@ private:
 
     void updateProjectionMatrix();
 
+#if PLATFORM(JAVA)
+    GraphicsContext* currentContext() const;
+#endif
+
     BitmapTexturePool m_texturePool;
     bool m_isMaskMode { false };
     TransformationMatrix m_patternTransform;
@@ -159,6 +173,12 @@ private:
 #if ENABLE(DAMAGE_TRACKING)
     std::optional<Damage> m_damage;
 #endif
+#if PLATFORM(JAVA)
+    GraphicsContext* m_graphicsContext { nullptr };
+    RefPtr<BitmapTexture> m_currentSurface;
+    Vector<GraphicsContext*> m_clipContexts;
+    std::pair<double, double> m_depthRange { 0, 0 };
+#endif
 };
 
 } // namespace WebCore
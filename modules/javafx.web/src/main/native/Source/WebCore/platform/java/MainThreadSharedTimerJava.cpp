@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,18 +30,33 @@
 
 #include <wtf/Assertions.h>
 #include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
 
 namespace WebCore {
 
-// The fire time is relative to the classic POSIX epoch of January 1, 1970,
-// as the result of currentTime() is.
+// The fire interval is relative to the current time, the java timer turns it
+// into a System.nanoTime() deadline.
 #define MINIMAL_INTERVAL 1e-9 //1ns
+
+// The deadline of the java timer, or zero if the timer is not armed.
+// Accessed on the main thread only.
+static MonotonicTime s_fireTime;
+
 void MainThreadSharedTimer::setFireInterval(Seconds timeout)
 {
     auto fireTime = timeout.value();
     if (fireTime < MINIMAL_INTERVAL) {
         fireTime = MINIMAL_INTERVAL;
     }
+
+    // A timer that fires too early is harmless, ThreadTimers reschedules it
+    // for the next pending timer. Only a deadline that moves earlier needs
+    // to reach java.
+    MonotonicTime deadline = MonotonicTime::now() + Seconds(fireTime);
+    if (s_fireTime && deadline >= s_fireTime)
+        return;
+    s_fireTime = deadline;
+
     WC_GETJAVAENV_CHKRET(env);
 
     static jmethodID mid = env->GetStaticMethodID(getTimerClass(env),
@@ -54,6 +69,10 @@ void MainThreadSharedTimer::setFireInterval(Seconds timeout)
 
 void MainThreadSharedTimer::stop()
 {
+    if (!s_fireTime)
+        return;
+    s_fireTime = MonotonicTime { };
+
     WC_GETJAVAENV_CHKRET(env);
 
     static jmethodID mid = env->GetStaticMethodID(getTimerClass(env),
@@ -76,6 +95,7 @@ extern "C" {
 JNIEXPORT void JNICALL Java_com_sun_webkit_Timer_twkFireTimerEvent
     (JNIEnv*, jclass)
 {
+    WebCore::s_fireTime = MonotonicTime { };
     WebCore::MainThreadSharedTimer::singleton().fired();
 }
 
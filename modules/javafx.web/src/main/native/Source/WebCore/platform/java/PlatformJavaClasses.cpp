@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -220,4 +220,32 @@ JLObject PG_GetRenderThemeObjectFromPage(JNIEnv* env, JLObject page)
     return jRenderTheme;
 }
 
+/*
+ * Resolves all the classes above in one go. Each lookup loads its class
+ * on first use, which would otherwise be spread over the first page load
+ * and paint.
+ */
+void PG_ResolveClasses(JNIEnv* env)
+{
+    PG_GetFontClass(env);
+    PG_GetFontCustomPlatformDataClass(env);
+    PG_GetGraphicsImageDecoderClass(env);
+    PG_GetGraphicsContextClass(env);
+    PG_GetGraphicsManagerClass(env);
+    PG_GetImageClass(env);
+    PG_GetImageFrameClass(env);
+    PG_GetMediaPlayerClass(env);
+    PG_GetPathClass(env);
+    PG_GetPathIteratorClass(env);
+    PG_GetRectangleClass(env);
+    PG_GetRefClass(env);
+    PG_GetRenderQueueClass(env);
+    PG_GetTransformClass(env);
+    PG_GetWebPageClass(env);
+    PG_GetColorChooserClass(env);
+    PG_GetRenderThemeClass(env);
+    getTimerClass(env);
+    WTF::CheckAndClearException(env);
+}
+
 } // namespace
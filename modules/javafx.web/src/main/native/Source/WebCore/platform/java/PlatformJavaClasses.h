@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -50,5 +50,6 @@ JLObject PL_GetGraphicsManager(JNIEnv* env);
 jclass getTimerClass(JNIEnv* env);
 jclass PG_GetRenderThemeClass(JNIEnv* env);
 JLObject PG_GetRenderThemeObjectFromPage(JNIEnv* env, JLObject page);
+void PG_ResolveClasses(JNIEnv* env);
 
 } // namespace
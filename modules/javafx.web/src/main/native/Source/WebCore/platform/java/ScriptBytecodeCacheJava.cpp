@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "CachedScriptSourceProvider.h"
+#include "PlatformJavaClasses.h"
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/JSCInlines.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <wtf/java/JavaEnv.h>
+
+#include "com_sun_webkit_WebPage.h"
+
+namespace WebCore {
+
+// The bytecode of external scripts is only looked up once WebPage has a
+// directory to keep it in, which saves an upcall per compiled script.
+static bool scriptBytecodeCacheEnabled;
+
+static bool canCacheBytecode(JSC::SourceProviderSourceType sourceType)
+{
+    return scriptBytecodeCacheEnabled
+        && (sourceType == JSC::SourceProviderSourceType::Program || sourceType == JSC::SourceProviderSourceType::Module);
+}
+
+RefPtr<JSC::CachedBytecode> CachedScriptSourceProvider::cachedBytecode() const
+{
+    if (m_cachedBytecode || !canCacheBytecode(sourceType()))
+        return m_cachedBytecode;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+        PG_GetWebPageClass(env),
+        "fwkLoadScriptBytecode",
+        "(Ljava/lang/String;I)[B");
+    ASSERT(mid);
+
+    JLByteArray data(static_cast<jbyteArray>(env->CallStaticObjectMethod(
+        PG_GetWebPageClass(env),
+        mid,
+        (jstring)sourceURL().toJavaString(env),
+        static_cast<jint>(hash()))));
+    if (WTF::CheckAndClearException(env) || !data)
+        return nullptr;
+
+    jsize size = env->GetArrayLength(data);
+    if (!size)
+        return nullptr;
+
+    auto buffer = MallocSpan<uint8_t, JSC::VMMalloc>::malloc(size);
+    env->GetByteArrayRegion(data, 0, size, reinterpret_cast<jbyte*>(buffer.mutableSpan().data()));
+    m_cachedBytecode = JSC::CachedBytecode::create(WTFMove(buffer), { });
+    return m_cachedBytecode;
+}
+
+void CachedScriptSourceProvider::cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const
+{
+    if (!canCacheBytecode(sourceType()))
+        return;
+
+    // The script was compiled because nothing usable was stored for it, so
+    // any loaded bytecode is stale and is replaced rather than updated.
+    m_cachedBytecode = JSC::CachedBytecode::create();
+    if (auto update = generator())
+        m_cachedBytecode->addGlobalUpdate(*update);
+}
+
+void CachedScriptSourceProvider::updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const
+{
+    if (!m_cachedBytecode)
+        return;
+
+    JSC::BytecodeCacheError error;
+    RefPtr<JSC::CachedBytecode> cachedBytecode = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
+    if (cachedBytecode && !error.isValid())
+        m_cachedBytecode->addFunctionUpdate(executable, kind, *cachedBytecode);
+}
+
+void CachedScriptSourceProvider::commitCachedBytecode() const
+{
+    if (!m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+        return;
+
+    Vector<uint8_t> data(m_cachedBytecode->sizeForUpdate());
+    memcpySpan(data.mutableSpan(), m_cachedBytecode->span());
+    m_cachedBytecode->commitUpdates([&] (off_t offset, std::span<const uint8_t> update) {
+        memcpySpan(data.mutableSpan().subspan(offset), update);
+    });
+    m_cachedBytecode = nullptr;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+        PG_GetWebPageClass(env),
+        "fwkStoreScriptBytecode",
+        "(Ljava/lang/String;I[B)V");
+    ASSERT(mid);
+
+    JLByteArray array(env->NewByteArray(data.size()));
+    if (!array) {
+        WTF::CheckAndClearException(env);
+        return;
+    }
+    env->SetByteArrayRegion(array, 0, data.size(), reinterpret_cast<const jbyte*>(data.span().data()));
+    env->CallStaticVoidMethod(
+        PG_GetWebPageClass(env),
+        mid,
+        (jstring)sourceURL().toJavaString(env),
+        static_cast<jint>(hash()),
+        (jbyteArray)array);
+    WTF::CheckAndClearException(env);
+}
+
+} // namespace WebCore
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetScriptBytecodeCacheEnabled
+  (JNIEnv*, jclass, jboolean enabled)
+{
+    ASSERT(isMainThread());
+    WebCore::scriptBytecodeCacheEnabled = jbool_to_bool(enabled);
+}
+
+}
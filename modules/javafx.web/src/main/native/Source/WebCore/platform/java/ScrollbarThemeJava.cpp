@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -160,7 +160,7 @@ bool ScrollbarThemeJava::paint(Scrollbar& scrollbar, GraphicsContext& gc, const
         "(JIIIIII)Lcom/sun/webkit/graphics/Ref;");
     ASSERT(mid);
 
-    RefPtr<RQRef> widgetRef = RQRef::create( env->CallObjectMethod(
+    RefPtr<RQRef> widgetRef = RQRef::createHandle( env->CallObjectMethod(
         jtheme,
         mid,
         ptr_to_jlong(&scrollbar),
@@ -181,7 +181,7 @@ bool ScrollbarThemeJava::paint(Scrollbar& scrollbar, GraphicsContext& gc, const
     // widgetRef will go into rq's inner refs vector.
     gc.platformContext()->rq().freeSpace(28)
         << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWSCROLLBAR
-        << RQRef::create(jtheme)
+        << RQRef::createHandle(jtheme)
         << widgetRef
         << (jint)scrollbar.x()
         << (jint)scrollbar.y()
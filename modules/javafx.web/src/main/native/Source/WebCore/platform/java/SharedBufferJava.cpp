@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,16 +26,53 @@
 #include "config.h"
 
 #include "SharedBuffer.h"
-#include "NotImplemented.h"
 #include "com_sun_webkit_SharedBuffer.h"
+#include <wtf/FileSystem.h>
+#include <wtf/MappedFileData.h>
+
+#if HAVE(MMAP)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <wtf/Mmap.h>
+#endif
 
 namespace WebCore {
 
-// JDK-8146959
-RefPtr<SharedBuffer> SharedBuffer::createFromReadingFile(const String&)
+// Regular files are mapped read-only so that their pages are shared with
+// the page cache and never copied into the heap. Returns null for anything
+// that is not a readable regular file.
+RefPtr<SharedBuffer> SharedBuffer::createFromReadingFile(const String& filePath)
 {
-  notImplemented();
-  return {};
+    if (filePath.isEmpty())
+        return nullptr;
+
+#if HAVE(MMAP)
+    int fd = open(filePath.utf8().data(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) || !S_ISREG(fileStat.st_mode)) {
+        close(fd);
+        return nullptr;
+    }
+    if (!fileStat.st_size) {
+        close(fd);
+        return SharedBuffer::create();
+    }
+
+    auto span = MallocSpan<uint8_t, Mmap>::mmap(fileStat.st_size, PROT_READ, MAP_PRIVATE, fd);
+    close(fd);
+    if (!span)
+        return nullptr;
+    return SharedBuffer::create(FileSystem::MappedFileData(WTFMove(span)));
+#else
+    auto contents = FileSystem::readEntireFile(filePath);
+    if (!contents)
+        return nullptr;
+    return SharedBuffer::create(WTFMove(*contents));
+#endif
 }
 
 extern "C" {
@@ -29,17 +29,62 @@
 #if PLATFORM(JAVA)
 
 #include "NotImplemented.h"
+#include "PlatformJavaClasses.h"
+#include "com_sun_webkit_network_NetworkContext.h"
+
+namespace DNSResolveQueueJavaInternal {
+
+static JGClass networkContextClass;
+static jmethodID prefetchDNSMethod;
+static jmethodID isUsingProxyMethod;
+
+static void initRefs(JNIEnv* env)
+{
+    if (!networkContextClass) {
+        networkContextClass = JLClass(env->FindClass(
+                "com/sun/webkit/network/NetworkContext"));
+        ASSERT(networkContextClass);
+
+        prefetchDNSMethod = env->GetStaticMethodID(
+                networkContextClass,
+                "fwkPrefetchDNS",
+                "(Ljava/lang/String;)V");
+        ASSERT(prefetchDNSMethod);
+
+        isUsingProxyMethod = env->GetStaticMethodID(
+                networkContextClass,
+                "fwkIsUsingProxy",
+                "()Z");
+        ASSERT(isUsingProxyMethod);
+    }
+}
+}
 
 namespace WebCore {
 
 void DNSResolveQueueJava::updateIsUsingProxy()
 {
-    notImplemented();
+    using namespace DNSResolveQueueJavaInternal;
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    bool isUsingProxy = jbool_to_bool(env->CallStaticBooleanMethod(
+            networkContextClass, isUsingProxyMethod));
+    m_isUsingProxy = WTF::CheckAndClearException(env) || isUsingProxy;
 }
 
-void DNSResolveQueueJava::platformResolve(const String& /* hostname */)
+void DNSResolveQueueJava::platformResolve(const String& hostname)
 {
-    notImplemented();
+    using namespace DNSResolveQueueJavaInternal;
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    // The Java side resolves the name asynchronously and reports back
+    // through twkDidPrefetchDNS, which releases the request slot.
+    env->CallStaticVoidMethod(networkContextClass, prefetchDNSMethod,
+            (jstring)hostname.toJavaString(env));
+    if (WTF::CheckAndClearException(env))
+        decrementRequestCount();
 }
 
 void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
@@ -54,4 +99,14 @@ void DNSResolveQueueJava::stopResolve(uint64_t /* identifier */)
 
 }
 
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_NetworkContext_twkDidPrefetchDNS
+  (JNIEnv*, jclass)
+{
+    WebCore::DNSResolveQueue::singleton().decrementRequestCount();
+}
+
+}
+
 #endif
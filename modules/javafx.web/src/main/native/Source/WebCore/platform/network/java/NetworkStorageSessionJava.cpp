@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,10 +33,15 @@
 #include "NotImplemented.h"
 #include "ResourceHandle.h"
 
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
 #include <wtf/MainThread.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/URL.h>
+#include <wtf/WallTime.h>
+#include <wtf/text/MakeString.h>
 #include "PlatformJavaClasses.h"
+#include "com_sun_webkit_network_CookieJar.h"
 
 namespace WebCore {
 
@@ -67,9 +72,90 @@ static void initRefs(JNIEnv* env)
     }
 }
 
+// Cookie strings by URL, kept while the Java cookie manager reports no
+// change, so that scripts polling document.cookie do not call into Java.
+// Entries are also dropped when the earliest stored cookie expires, and
+// after a second in any case, as the default cookie handler may be
+// replaced without notice.
+class CookieCache {
+    WTF_MAKE_NONCOPYABLE(CookieCache);
+public:
+    static constexpr unsigned maxSize = 256;
+    static constexpr Seconds maxAge = 1_s;
+
+    CookieCache() = default;
+
+    static CookieCache& singleton()
+    {
+        static NeverDestroyed<CookieCache> cache;
+        return cache;
+    }
+
+    static String key(const URL& url, bool includeHttpOnlyCookies)
+    {
+        return makeString(includeHttpOnlyCookies ? 'h' : '-', url.viewWithoutQueryOrFragmentIdentifier());
+    }
+
+    std::optional<String> get(const String& key)
+    {
+        Locker locker { m_lock };
+        auto it = m_cookies.find(key);
+        if (it == m_cookies.end())
+            return std::nullopt;
+        if (WallTime::now() >= std::min(m_validUntil, it->value.time + maxAge)) {
+            m_cookies.remove(it);
+            return std::nullopt;
+        }
+        return it->value.cookies;
+    }
+
+    uint64_t generation()
+    {
+        Locker locker { m_lock };
+        return m_generation;
+    }
+
+    // Drops the result of a lookup that raced with a change.
+    void add(const String& key, const String& cookies, uint64_t generation)
+    {
+        Locker locker { m_lock };
+        auto now = WallTime::now();
+        if (generation != m_generation || now >= m_validUntil)
+            return;
+        if (m_cookies.size() >= maxSize)
+            m_cookies.clear();
+        m_cookies.set(key, Entry { cookies, now });
+    }
+
+    void invalidate(WallTime validUntil)
+    {
+        Locker locker { m_lock };
+        ++m_generation;
+        m_validUntil = validUntil;
+        m_cookies.clear();
+    }
+
+private:
+    struct Entry {
+        String cookies;
+        WallTime time;
+    };
+
+    Lock m_lock;
+    HashMap<String, Entry> m_cookies WTF_GUARDED_BY_LOCK(m_lock);
+    uint64_t m_generation WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    WallTime m_validUntil WTF_GUARDED_BY_LOCK(m_lock);
+};
+
 static String getCookies(const URL& url, bool includeHttpOnlyCookies)
 {
     using namespace CookieInternalJava;
+    auto& cache = CookieCache::singleton();
+    String cacheKey = CookieCache::key(url, includeHttpOnlyCookies);
+    if (auto cookies = cache.get(cacheKey))
+        return *cookies;
+    uint64_t generation = cache.generation();
+
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
@@ -78,9 +164,12 @@ static String getCookies(const URL& url, bool includeHttpOnlyCookies)
             getMethod,
             (jstring) url.string().toJavaString(env),
             bool_to_jbool(includeHttpOnlyCookies)));
-    WTF::CheckAndClearException(env);
+    if (WTF::CheckAndClearException(env))
+        return emptyString();
 
-    return result ? String(env, result) : emptyString();
+    String cookies = result ? String(env, result) : emptyString();
+    cache.add(cacheKey, cookies, generation);
+    return cookies;
 }
 }
 
@@ -183,3 +272,15 @@ Vector<Cookie> NetworkStorageSession::getCookies(const URL&)
 
 } // namespace WebCore
 
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_CookieJar_twkCookiesChanged
+  (JNIEnv*, jclass, jlong validUntil)
+{
+    using namespace WebCore;
+    CookieInternalJava::CookieCache::singleton().invalidate(
+            WallTime::fromRawSeconds(Seconds::fromMilliseconds(validUntil).seconds()));
+}
+
+}
+
@@ -71,6 +71,8 @@ private:
 
     RefPtr<const StorageSessionProvider> m_storageSessionProvider;
     JGObject m_ref;
+    JGObject m_sendBuffer;
+    jsize m_sendBufferSize { 0 };
     StreamBuffer<uint8_t, 1024 * 1024> m_buffer;
     static const unsigned maxBufferSize = 100 * 1024 * 1024;
 };
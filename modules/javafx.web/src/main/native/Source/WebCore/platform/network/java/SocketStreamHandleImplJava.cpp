@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -89,24 +89,47 @@ std::optional<size_t> SocketStreamHandleImpl::platformSendInternal(const uint8_t
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
-    JLByteArray byteArray = env->NewByteArray(len);
-    env->SetByteArrayRegion(
-            (jbyteArray) byteArray,
-            (jsize) 0,
-            (jsize) len,
-            (const jbyte*) data);
+    // Frames are copied into an array the Java handle keeps for the whole
+    // connection rather than into a fresh array per send.
+    if (!m_sendBuffer) {
+        static jmethodID getSendBufferMID = env->GetMethodID(
+                GetSocketStreamHandleClass(env),
+                "fwkGetSendBuffer",
+                "()[B");
+        ASSERT(getSendBufferMID);
+
+        m_sendBuffer = JLObject(env->CallObjectMethod(m_ref, getSendBufferMID));
+        if (WTF::CheckAndClearException(env) || !m_sendBuffer) {
+            return { };
+        }
+        m_sendBufferSize = env->GetArrayLength((jbyteArray) (jobject) m_sendBuffer);
+    }
 
     static jmethodID mid = env->GetMethodID(
             GetSocketStreamHandleClass(env),
             "fwkSend",
-            "([B)I");
+            "(I)I");
     ASSERT(mid);
 
-    jint res = env->CallIntMethod(m_ref, mid, (jbyteArray) byteArray);
-    if (WTF::CheckAndClearException(env)) {
-        return { };
+    size_t sent = 0;
+    while (sent < len) {
+        jsize chunk = static_cast<jsize>(std::min<size_t>(len - sent, m_sendBufferSize));
+        env->SetByteArrayRegion(
+                (jbyteArray) (jobject) m_sendBuffer,
+                (jsize) 0,
+                chunk,
+                (const jbyte*) (data + sent));
+
+        jint res = env->CallIntMethod(m_ref, mid, chunk);
+        if (WTF::CheckAndClearException(env)) {
+            return { };
+        }
+        sent += static_cast<size_t>(res);
+        if (res < chunk) {
+            break;
+        }
     }
-    return { static_cast<size_t>(res) };
+    return { sent };
 }
 
 void SocketStreamHandleImpl::platformClose()
@@ -171,15 +194,18 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidOpen
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidReceiveData
-  (JNIEnv* env, jclass, jbyteArray buffer, jint len, jlong data)
+  (JNIEnv* env, jclass, jobject buffer, jint offset, jint len, jlong data)
 {
     using namespace WebCore;
     SocketStreamHandleImpl* handle =
             static_cast<SocketStreamHandleImpl*>(jlong_to_ptr(data));
     ASSERT(handle);
-    jbyte* p = env->GetByteArrayElements(buffer, NULL);
-    handle->didReceiveData((const uint8_t*) p, len);
-    env->ReleaseByteArrayElements(buffer, p, JNI_ABORT);
+    // The slice belongs to the Java receive ring and stays untouched until
+    // this call returns, so it is read in place.
+    const uint8_t* address = static_cast<const uint8_t*>(env->GetDirectBufferAddress(buffer));
+    ASSERT(address);
+    ASSERT(offset >= 0 && len >= 0 && offset + len <= env->GetDirectBufferCapacity(buffer));
+    handle->didReceiveData(address + offset, len);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidFail
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,9 @@
 #include "com_sun_webkit_LoadListenerClient.h"
 #include "com_sun_webkit_network_URLLoaderBase.h"
 #include <wtf/CompletionHandler.h>
+#include <wtf/MainThread.h>
+#include <wtf/MallocSpan.h>
+#include <wtf/RefCounted.h>
 
 namespace WebCore {
 class Page;
@@ -112,6 +115,21 @@ static void initRefs(JNIEnv* env)
 
 }
 
+// Tracks a local file delivery scheduled on the main thread, so that it
+// can be abandoned when the loader is canceled before it runs.
+class URLLoader::LocalFileLoad : public RefCounted<LocalFileLoad> {
+public:
+    static Ref<LocalFileLoad> create() { return adoptRef(*new LocalFileLoad()); }
+
+    bool isCanceled() const { return m_canceled; }
+    void cancel() { m_canceled = true; }
+
+private:
+    LocalFileLoad() = default;
+
+    bool m_canceled { false };
+};
+
 URLLoader::URLLoader()
 {
 }
@@ -127,6 +145,10 @@ std::unique_ptr<URLLoader> URLLoader::loadAsynchronously(NetworkingContext* cont
 {
     std::unique_ptr<URLLoader> result = std::unique_ptr<URLLoader>(new URLLoader());
     result->m_target = std::unique_ptr<AsynchronousTarget>(new AsynchronousTarget(handle));
+    if (auto data = mapLocalFile(request)) {
+        result->loadLocalFile(handle, request, data.releaseNonNull());
+        return result;
+    }
     result->m_ref = load(
             true,
             context,
@@ -135,9 +157,64 @@ std::unique_ptr<URLLoader> URLLoader::loadAsynchronously(NetworkingContext* cont
     return result;
 }
 
+// Plain GET requests for local regular files are served from a memory
+// mapping of the file instead of being streamed in chunks by a Java
+// loader thread. Anything else, including directory listings, missing
+// files and remote file: hosts, is left to the Java loader.
+RefPtr<SharedBuffer> URLLoader::mapLocalFile(const ResourceRequest& request)
+{
+#if HAVE(MMAP)
+    const URL& url = request.url();
+    if (!url.protocolIsFile() || request.httpMethod() != "GET"_s || request.httpBody())
+        return nullptr;
+    if (!url.host().isEmpty() && url.host() != "localhost"_s)
+        return nullptr;
+
+    String path = url.fileSystemPath();
+    if (path.isEmpty() || path.endsWith('/'))
+        return nullptr;
+    return SharedBuffer::createFromReadingFile(path);
+#else
+    UNUSED_PARAM(request);
+    return nullptr;
+#endif
+}
+
+void URLLoader::loadLocalFile(ResourceHandle* handle,
+                              const ResourceRequest& request,
+                              Ref<SharedBuffer>&& data)
+{
+    const URL& url = request.url();
+    ResourceResponse response(url,
+            MIMETypeRegistry::mimeTypeForPath(url.fileSystemPath()),
+            static_cast<long long>(data->size()), String());
+
+    // Deliver asynchronously, as the Java loader would, so that the client
+    // is never called back from within ResourceHandle::start(). The handle
+    // is protected since the client may cancel, and with it destroy this
+    // loader, from any of the callbacks.
+    m_localFileLoad = LocalFileLoad::create();
+    callOnMainThread([handle = Ref { *handle }, localFileLoad = Ref { *m_localFileLoad },
+            response = WTFMove(response), data = WTFMove(data)]() mutable {
+        auto client = [&]() -> ResourceHandleClient* {
+            return localFileLoad->isCanceled() ? nullptr : handle->client();
+        };
+        if (auto* c = client())
+            c->didReceiveResponseAsync(handle.ptr(), WTFMove(response), [] () {});
+        if (auto* c = client(); c && data->size())
+            c->didReceiveData(handle.ptr(), data, data->size());
+        if (auto* c = client())
+            c->didFinishLoading(handle.ptr(), { });
+    });
+}
+
 void URLLoader::cancel()
 {
     using namespace URLLoaderJavaInternal;
+    if (m_localFileLoad) {
+        m_localFileLoad->cancel();
+        m_localFileLoad = nullptr;
+    }
     if (m_ref) {
         JNIEnv* env = WTF::GetJavaEnv();
         initRefs(env);
@@ -508,9 +585,42 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDa
     ASSERT(target);
     const uint8_t* address =
             static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<SharedBuffer> tmp_buf = SharedBuffer::create(std::span<const uint8_t>(address, remaining));
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    Ref<SharedBuffer> buffer = SharedBuffer::create(std::span<const uint8_t>(address + position, remaining));
+    target->didReceiveData(buffer.ptr(), remaining);
+}
+
+JNIEXPORT jobject JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkAllocateDataSegment
+  (JNIEnv* env, jclass, jint capacity)
+{
+    ASSERT(capacity > 0);
+    // Owned by the Java buffer until it is passed back to twkDidReceiveDataSegment.
+    void* address = fastMalloc(capacity);
+    jobject byteBuffer = env->NewDirectByteBuffer(address, capacity);
+    if (WTF::CheckAndClearException(env) || !byteBuffer) {
+        fastFree(address);
+        return nullptr;
+    }
+    return byteBuffer;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDataSegment
+  (JNIEnv* env, jclass, jobject segment, jint length, jlong data)
+{
+    using namespace WebCore;
+    URLLoader::Target* target =
+            static_cast<URLLoader::Target*>(jlong_to_ptr(data));
+    ASSERT(target);
+    auto* address = static_cast<uint8_t*>(env->GetDirectBufferAddress(segment));
+    size_t capacity = env->GetDirectBufferCapacity(segment);
+    ASSERT(address && length >= 0 && static_cast<size_t>(length) <= capacity);
+    // Adopt the memory the Java side has written into, no copy is made.
+    auto ownedSegment = adoptMallocSpan<uint8_t, FastMalloc>(std::span { address, capacity });
+    Ref<SharedBuffer> buffer = SharedBuffer::create(DataSegment::Provider {
+        [ownedSegment = WTFMove(ownedSegment), length] {
+            return ownedSegment.span().first(length);
+        }
+    });
+    target->didReceiveData(buffer.ptr(), length);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
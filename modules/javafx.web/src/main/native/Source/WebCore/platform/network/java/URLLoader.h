@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <wtf/java/JavaRef.h>
+#include <wtf/RefPtr.h>
 #include <wtf/Vector.h>
 #include <wtf/text/WTFString.h>
 
@@ -37,6 +38,7 @@ class ResourceError;
 class ResourceHandle;
 class ResourceRequest;
 class ResourceResponse;
+class SharedBuffer;
 
 class URLLoader {
 public:
@@ -71,6 +73,12 @@ private:
                          const ResourceRequest& request,
                          Target* target);
     static JLObjectArray toJava(const FormData* formData);
+    static RefPtr<SharedBuffer> mapLocalFile(const ResourceRequest& request);
+    void loadLocalFile(ResourceHandle* handle,
+                       const ResourceRequest& request,
+                       Ref<SharedBuffer>&& data);
+
+    class LocalFileLoad;
 
     class AsynchronousTarget : public Target {
     public:
@@ -108,6 +116,7 @@ private:
 
     JGObject m_ref;
     std::unique_ptr<AsynchronousTarget> m_target;
+    RefPtr<LocalFileLoad> m_localFileLoad;
 };
 
 } // namespace WebCore
@@ -137,6 +137,12 @@ Ref<Thread> WorkerThread::createThread()
 
     // WorkerOrWorkletThread::workerOrWorkletThread destroys the worker and expects a single reference to this.
     SUPPRESS_UNCOUNTED_LAMBDA_CAPTURE return Thread::create(threadName(), [this] {
+#if PLATFORM(JAVA)
+        // Keep the worker attached to the JVM for its whole lifetime so that
+        // every upcall (networking, timers, main thread dispatch) does not
+        // attach and detach the thread again.
+        WTF::AttachThreadAsDaemonToJavaEnv autoAttach;
+#endif
         workerOrWorkletThread();
     }, ThreadType::JavaScript);
 }
@@ -40,8 +40,21 @@
 #include <wtf/WorkQueue.h>
 #include <wtf/threads/BinarySemaphore.h>
 
+#if PLATFORM(JAVA)
+#include <wtf/java/JavaEnv.h>
+#endif
+
 using namespace WebCore;
 
+#if PLATFORM(JAVA)
+static std::atomic<uint64_t> perOriginQuota;
+
+void InProcessIDBServer::setPerOriginQuota(uint64_t quota)
+{
+    perOriginQuota = quota;
+}
+#endif
+
 Ref<InProcessIDBServer> InProcessIDBServer::create(PAL::SessionID sessionID)
 {
     ASSERT(sessionID.isEphemeral());
@@ -76,11 +89,26 @@ InProcessIDBServer::InProcessIDBServer(PAL::SessionID sessionID, const String& d
     ASSERT(isMainThread());
     m_connectionToServer = IDBClient::IDBConnectionToServer::create(*this, sessionID);
     dispatchTask([this, protectedThis = Ref { *this }, directory = databaseDirectoryPath.isolatedCopy()] () mutable {
+#if PLATFORM(JAVA)
+        // The backing store reaches the file system through JNI. The queue
+        // keeps its thread for the lifetime of the server, so attach it once.
+        JNIEnv* env;
+        WTF::jvm->AttachCurrentThreadAsDaemon(reinterpret_cast<void**>(&env), nullptr);
+#endif
         Ref connectionToClient = IDBServer::IDBConnectionToClient::create(*this);
         m_connectionToClient = connectionToClient.copyRef();
 
         Locker locker { m_serverLock };
-        m_server = makeUnique<IDBServer::IDBServer>(directory, [](const ClientOrigin&, uint64_t) {
+        m_server = makeUnique<IDBServer::IDBServer>(directory, [directory](const ClientOrigin& origin, uint64_t spaceRequested) {
+#if PLATFORM(JAVA)
+            uint64_t quota = perOriginQuota;
+            if (quota && !directory.isEmpty())
+                return IDBServer::IDBServer::diskUsage(directory, origin) + spaceRequested <= quota;
+#else
+            UNUSED_VARIABLE(directory);
+            UNUSED_PARAM(origin);
+            UNUSED_PARAM(spaceRequested);
+#endif
             return true;
         }, m_serverLock);
         m_server->registerConnection(connectionToClient);
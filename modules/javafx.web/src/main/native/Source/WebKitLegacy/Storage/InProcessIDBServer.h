@@ -61,6 +61,10 @@ class InProcessIDBServer final : public WebCore::IDBClient::IDBConnectionToServe
 public:
     static Ref<InProcessIDBServer> create(PAL::SessionID);
     static Ref<InProcessIDBServer> create(PAL::SessionID, const String& databaseDirectoryPath);
+#if PLATFORM(JAVA)
+    // Limits the on-disk size of the databases of each origin; zero means unlimited.
+    static void setPerOriginQuota(uint64_t);
+#endif
 
     virtual ~InProcessIDBServer();
 
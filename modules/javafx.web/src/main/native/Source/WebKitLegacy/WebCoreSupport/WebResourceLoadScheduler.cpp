@@ -29,6 +29,7 @@
 #include "PingHandle.h"
 #include <WebCore/ArchiveResource.h>
 #include <WebCore/CachedResource.h>
+#include <WebCore/DNS.h>
 #include <WebCore/Document.h>
 #include <WebCore/DocumentLoader.h>
 #include <WebCore/FetchOptions.h>
@@ -417,9 +418,20 @@ void WebResourceLoadScheduler::addOnlineStateChangeListener(WTF::Function<void(b
     NetworkStateNotifier::singleton().addListener(WTFMove(listener));
 }
 
+#if PLATFORM(JAVA)
+void WebResourceLoadScheduler::preconnectTo(FrameLoader&, ResourceRequest&& request, StoredCredentialsPolicy, ShouldPreconnectAsFirstParty, PreconnectCompletionHandler&& completionHandler)
+{
+    // The Java network stack has no way to open a connection ahead of
+    // a request, so warm up the name resolution of the origin instead.
+    prefetchDNS(request.url().host().toString());
+    if (completionHandler)
+        completionHandler({ });
+}
+#else
 void WebResourceLoadScheduler::preconnectTo(FrameLoader&, ResourceRequest&&, StoredCredentialsPolicy, ShouldPreconnectAsFirstParty, PreconnectCompletionHandler&&)
 {
 }
+#endif
 
 #if PLATFORM(JAVA)
 
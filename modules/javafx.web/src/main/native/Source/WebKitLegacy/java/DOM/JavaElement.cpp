@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1392,4 +1392,67 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_querySelectorAllImpl
 }
 
 
+// Bulk queries
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_dom_ElementImpl_querySelectorAllPeersImpl(JNIEnv* env, jclass, jlong peer
+    , jstring selectors)
+{
+    WebCore::JSMainThreadNullState state;
+    RefPtr<NodeList> list = raiseOnDOMError(env, IMPL->querySelectorAll(AtomString {String(env, selectors)}));
+    if (!list)
+        return nullptr;
+
+    unsigned length = list->length();
+    jlongArray result = env->NewLongArray(length);
+    if (!result)
+        return nullptr;
+
+    Vector<jlong> peers;
+    peers.reserveInitialCapacity(length);
+    for (unsigned i = 0; i < length; ++i) {
+        //paired deref() calls are in dispose Java method.
+        peers.append(ptr_to_jlong(RefPtr<Node> { list->item(i) }.leakRef()));
+    }
+    env->SetLongArrayRegion(result, 0, length, peers.span().data());
+    return result;
+}
+
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_dom_ElementImpl_querySelectorAllAttributesImpl(JNIEnv* env, jclass, jlong peer
+    , jstring selectors
+    , jobjectArray attributeNames)
+{
+    WebCore::JSMainThreadNullState state;
+    RefPtr<NodeList> list = raiseOnDOMError(env, IMPL->querySelectorAll(AtomString {String(env, selectors)}));
+    if (!list)
+        return nullptr;
+
+    jsize nameCount = attributeNames ? env->GetArrayLength(attributeNames) : 0;
+    Vector<AtomString> names;
+    names.reserveInitialCapacity(nameCount);
+    for (jsize i = 0; i < nameCount; ++i) {
+        JLString name(static_cast<jstring>(env->GetObjectArrayElement(attributeNames, i)));
+        names.append(name ? AtomString { String(env, name) } : nullAtom());
+    }
+
+    unsigned length = list->length();
+    JLClass stringClass(env->FindClass("java/lang/String"));
+    jobjectArray result = env->NewObjectArray(length * nameCount, stringClass, nullptr);
+    if (!result)
+        return nullptr;
+
+    for (unsigned i = 0; i < length; ++i) {
+        auto& element = downcast<Element>(*list->item(i));
+        for (jsize j = 0; j < nameCount; ++j) {
+            if (names[j].isNull())
+                continue;
+            const AtomString& value = element.getAttribute(names[j]);
+            if (value.isNull())
+                continue;
+            env->SetObjectArrayElement(result, i * nameCount + j, value.string().toJavaString(env));
+        }
+    }
+    return result;
+}
+
+
 }
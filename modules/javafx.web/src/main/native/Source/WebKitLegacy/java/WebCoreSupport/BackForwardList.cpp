@@ -37,6 +37,7 @@
 #include <WebCore/SerializedScriptValue.h>
 
 #include "BackForwardList.h"
+#include "PageCacheJava.h"
 #include "WebPage.h"
 #include "PlatformJavaClasses.h"
 
@@ -371,6 +372,7 @@ void  BackForwardList::setChildItem(WebCore::BackForwardFrameItemIdentifier pare
 
 void  BackForwardList::goToProvisionalItem(const WebCore::HistoryItem& item)
 {
+    PageCacheJava::didStartHistoryNavigation();
     m_provisional = m_current;
     goToItem(const_cast<HistoryItem&>(item));
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 
 #include "FrameLoaderClientJava.h"
 #include "FrameNetworkingContextJava.h"
+#include "PageCacheJava.h"
 #include "WebPage.h"
 
 #include <JavaScriptCore/APICast.h>
@@ -61,6 +62,8 @@ namespace FrameLoaderClientJavaInternal {
 static JGClass webPageClass;
 static JGClass networkContextClass;
 
+static jfieldID hasResourceLoadListenersFID;
+
 static jmethodID setRequestURLMID;
 static jmethodID removeRequestURLMID;
 
@@ -87,6 +90,9 @@ static void initRefs(JNIEnv* env)
             "com/sun/webkit/WebPage"));
         ASSERT(webPageClass);
 
+        hasResourceLoadListenersFID = env->GetFieldID(webPageClass, "hasResourceLoadListeners", "Z");
+        ASSERT(hasResourceLoadListenersFID);
+
         setRequestURLMID = env->GetMethodID(webPageClass, "fwkSetRequestURL", "(JILjava/lang/String;)V");
         ASSERT(setRequestURLMID);
         removeRequestURLMID = env->GetMethodID(webPageClass, "fwkRemoveRequestURL", "(JI)V");
@@ -140,6 +146,14 @@ static void initRefs(JNIEnv* env)
         ASSERT(canHandleURLMID);
     }
 }
+
+// The request URLs only serve resource load events, so when no listener
+// handles those the whole per-resource bookkeeping is skipped.
+static bool hasResourceLoadListeners(JNIEnv* env, jobject webPage)
+{
+    return jbool_to_bool(env->GetBooleanField(webPage, hasResourceLoadListenersFID));
+}
+
 // This was copied from file "WebKit/Source/WebKit/mac/Misc/WebKitErrors.h".
 enum
 {
@@ -250,6 +264,9 @@ void FrameLoaderClientJava::setRequestURL(Frame* f,ResourceLoaderIdentifier  ide
     using namespace FrameLoaderClientJavaInternal;
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
+    if (!hasResourceLoadListeners(env, m_webPage)) {
+        return;
+    }
 
     JLString urlJavaString(url.toJavaString(env));
     env->CallVoidMethod(m_webPage, setRequestURLMID, ptr_to_jlong(f), identifier, (jstring)urlJavaString);
@@ -261,6 +278,9 @@ void FrameLoaderClientJava::removeRequestURL(Frame* f, ResourceLoaderIdentifier
     using namespace FrameLoaderClientJavaInternal;
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
+    if (!hasResourceLoadListeners(env, m_webPage)) {
+        return;
+    }
 
     env->CallVoidMethod(m_webPage, removeRequestURLMID, ptr_to_jlong(f), identifier);
     WTF::CheckAndClearException(env);
@@ -304,6 +324,9 @@ void FrameLoaderClientJava::postResourceLoadEvent(Frame* f, int state,
     using namespace FrameLoaderClientJavaInternal;
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
+    if (!hasResourceLoadListeners(env, m_webPage)) {
+        return;
+    }
 
     JLString contentTypeJavaString(contentType.toJavaString(env));
     // notification for resource event listeners
@@ -1005,7 +1028,7 @@ bool FrameLoaderClientJava::shouldFallBack(const ResourceError& error) const
 
 void FrameLoaderClientJava::didRestoreFromBackForwardCache()
 {
-    // FIXME: openjfx2.26 Raise Bug to track fwd / back cache
+    PageCacheJava::didRestorePage();
 }
 
 bool FrameLoaderClientJava::canCachePage() const
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "JavaScriptHeapJava.h"
+
+#include <JavaScriptCore/HeapObserver.h>
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/VM.h>
+#include <WebCore/CommonVM.h>
+#include <WebCore/GCController.h>
+#include <mutex>
+#include <wtf/NeverDestroyed.h>
+
+#include "com_sun_webkit_JavaScriptHeap.h"
+
+namespace {
+
+// The observer may be called on the collector thread.
+class CollectionCounter final : public JSC::HeapObserver {
+public:
+    void willGarbageCollect() final { }
+
+    void didGarbageCollect(JSC::CollectionScope scope) final
+    {
+        auto& heap = WebCore::commonVM().heap;
+        Seconds length;
+        if (scope == JSC::CollectionScope::Full) {
+            ++fullCollectionCount;
+            length = heap.lastFullGCLength();
+        } else {
+            ++edenCollectionCount;
+            length = heap.lastEdenGCLength();
+        }
+        int64_t nanoseconds = static_cast<int64_t>(length.nanoseconds());
+        totalCollectionTime += nanoseconds;
+        if (nanoseconds > maxCollectionTime)
+            maxCollectionTime = nanoseconds;
+    }
+
+    std::atomic<int64_t> fullCollectionCount { 0 };
+    std::atomic<int64_t> edenCollectionCount { 0 };
+    std::atomic<int64_t> totalCollectionTime { 0 };
+    std::atomic<int64_t> maxCollectionTime { 0 };
+};
+
+CollectionCounter& collectionCounter()
+{
+    static NeverDestroyed<CollectionCounter> counter;
+    return counter;
+}
+
+}
+
+void JavaScriptHeapJava::initialize()
+{
+    static std::once_flag onceFlag;
+    std::call_once(onceFlag, [] {
+        WebCore::commonVM().heap.addObserver(&collectionCounter());
+    });
+}
+
+extern "C" {
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_JavaScriptHeap_twkGetStatistics
+  (JNIEnv* env, jclass, jboolean countObjects)
+{
+    auto& vm = WebCore::commonVM();
+    JSC::JSLockHolder lock(vm);
+    auto& counter = collectionCounter();
+
+    jlong statistics[] = {
+        static_cast<jlong>(vm.heap.size()),
+        static_cast<jlong>(vm.heap.capacity()),
+        static_cast<jlong>(vm.heap.extraMemorySize()),
+        // Counting the cells walks the whole heap.
+        countObjects ? static_cast<jlong>(vm.heap.objectCount()) : -1,
+        countObjects ? static_cast<jlong>(vm.heap.globalObjectCount()) : -1,
+        static_cast<jlong>(vm.heap.protectedObjectCount()),
+        counter.fullCollectionCount,
+        counter.edenCollectionCount,
+        counter.totalCollectionTime,
+        counter.maxCollectionTime
+    };
+    jlongArray result = env->NewLongArray(std::size(statistics));
+    if (result)
+        env->SetLongArrayRegion(result, 0, std::size(statistics), statistics);
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_JavaScriptHeap_twkCollectGarbage
+  (JNIEnv*, jclass, jboolean shrink)
+{
+    if (!shrink) {
+        WebCore::GCController::singleton().garbageCollectNow();
+        return;
+    }
+    // Drops the compiled code, runs a full collection and returns the free
+    // malloc memory to the system, once JavaScript is no longer running.
+    auto& vm = WebCore::commonVM();
+    JSC::JSLockHolder lock(vm);
+    vm.shrinkFootprintWhenIdle();
+}
+
+}
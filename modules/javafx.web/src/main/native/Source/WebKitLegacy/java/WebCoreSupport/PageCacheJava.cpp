@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,11 +24,28 @@
  */
 
 
+#include "PageCacheJava.h"
+
 #include <WebCore/BackForwardCache.h>
+#include <WebCore/MemoryRelease.h>
 #include <WebCore/PlatformJavaClasses.h>
+#include <wtf/MemoryFootprint.h>
 // FIXME: Openjfx2.26 rename pagecache to backforwardcache
 #include "com_sun_webkit_PageCache.h"
 
+static unsigned s_historyNavigationCount = 0;
+static unsigned s_restoredPageCount = 0;
+
+void PageCacheJava::didStartHistoryNavigation()
+{
+    ++s_historyNavigationCount;
+}
+
+void PageCacheJava::didRestorePage()
+{
+    ++s_restoredPageCount;
+}
+
 extern "C" {
 
 JNIEXPORT jint JNICALL Java_com_sun_webkit_PageCache_twkGetCapacity
@@ -44,4 +61,35 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_PageCache_twkSetCapacity
     WebCore::BackForwardCache::singleton().setMaxSize(capacity);
 }
 
+JNIEXPORT jint JNICALL Java_com_sun_webkit_PageCache_twkGetPageCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().pageCount();
+}
+
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_PageCache_twkGetCounters
+  (JNIEnv* env, jclass)
+{
+    jint counters[] = {
+        static_cast<jint>(s_historyNavigationCount),
+        static_cast<jint>(s_restoredPageCount)
+    };
+    jintArray result = env->NewIntArray(std::size(counters));
+    if (result)
+        env->SetIntArrayRegion(result, 0, std::size(counters), counters);
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_PageCache_twkGetNativeMemoryFootprint
+  (JNIEnv *, jclass)
+{
+    return static_cast<jlong>(WTF::memoryFootprint());
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_PageCache_twkReleaseMemory
+  (JNIEnv *, jclass, jboolean critical)
+{
+    WebCore::releaseMemory(critical ? WTF::Critical::Yes : WTF::Critical::No, WTF::Synchronous::Yes);
+}
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,6 +78,26 @@ void VisitedLinkStoreJava::addVisitedLink(const String& urlString)
     addVisitedLinkHash(computeSharedStringHash(urlString));
 }
 
+void VisitedLinkStoreJava::addVisitedLinkHashes(std::span<const SharedStringHash> linkHashes)
+{
+    m_recordNewVisitedLinks = true;
+    if (!s_shouldTrackVisitedLinks)
+        return;
+
+    bool added = false;
+    for (auto linkHash : linkHashes)
+        added |= m_visitedLinkHashes.add(linkHash).isNewEntry;
+
+    // One style invalidation for the whole batch rather than one per link.
+    if (added)
+        invalidateStylesForAllLinks();
+}
+
+Vector<SharedStringHash> VisitedLinkStoreJava::takeNewVisitedLinkHashes()
+{
+    return std::exchange(m_newVisitedLinkHashes, { });
+}
+
 bool VisitedLinkStoreJava::isLinkVisited(Page& page, SharedStringHash linkHash, const URL&, const AtomString&)
 {
     populateVisitedLinksIfNeeded(page);
@@ -104,7 +124,10 @@ void VisitedLinkStoreJava::populateVisitedLinksIfNeeded(Page&)
 void VisitedLinkStoreJava::addVisitedLinkHash(SharedStringHash linkHash)
 {
     ASSERT(s_shouldTrackVisitedLinks);
-    m_visitedLinkHashes.add(linkHash);
+    if (!m_visitedLinkHashes.add(linkHash).isNewEntry)
+        return;
+    if (m_recordNewVisitedLinks)
+        m_newVisitedLinkHashes.append(linkHash);
 
     invalidateStylesForLink(linkHash);
 }
@@ -112,6 +135,7 @@ void VisitedLinkStoreJava::addVisitedLinkHash(SharedStringHash linkHash)
 void VisitedLinkStoreJava::removeVisitedLinkHashes()
 {
     m_visitedLinksPopulated = false;
+    m_newVisitedLinkHashes.clear();
     if (m_visitedLinkHashes.isEmpty())
         return;
     m_visitedLinkHashes.clear();
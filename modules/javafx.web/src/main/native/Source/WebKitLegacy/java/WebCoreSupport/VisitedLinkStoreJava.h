@@ -38,6 +38,11 @@ public:
 
     void addVisitedLink(const String& urlString);
 
+    // Persistence support: the hashes loaded from disk are added in bulk,
+    // after which every newly visited link is recorded until it is taken.
+    void addVisitedLinkHashes(std::span<const WebCore::SharedStringHash>);
+    Vector<WebCore::SharedStringHash> takeNewVisitedLinkHashes();
+
 private:
     VisitedLinkStoreJava();
 
@@ -49,6 +54,8 @@ private:
     void removeVisitedLinkHashes();
 
     HashSet<WebCore::SharedStringHash, WebCore::SharedStringHashHash> m_visitedLinkHashes;
+    Vector<WebCore::SharedStringHash> m_newVisitedLinkHashes;
     bool m_visitedLinksPopulated;
+    bool m_recordNewVisitedLinks { false };
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,6 +38,7 @@
 #include "EditorClientJava.h"
 #include "FrameLoaderClientJava.h"
 #include "InspectorClientJava.h"
+#include "JavaScriptHeapJava.h"
 #include "PageStorageSessionProvider.h"
 #include "PlatformStrategiesJava.h"
 #include "ProgressTrackerClientJava.h"
@@ -53,8 +54,11 @@
 #include <JavaScriptCore/JSContextRefPrivate.h>
 #include <JavaScriptCore/JSStringRef.h>
 #include <JavaScriptCore/Options.h>
+#include <WebCore/BackForwardCache.h>
 #include <WebCore/BackForwardController.h>
 #include <WebCore/BridgeUtils.h>
+#include <WebCore/CachedImage.h>
+#include <WebCore/CachedResourceLoader.h>
 #include <WebCore/CharacterData.h>
 #include <WebCore/Chrome.h>
 #include <WebCore/ColorTypes.h>
@@ -102,11 +106,13 @@
 #include <WebCore/SecurityPolicy.h>
 #include <WebCore/Settings.h>
 #include <WebCore/StorageNamespaceProvider.h>
+#include <WebCore/StyleScope.h>
 #include <WebCore/TextIterator.h>
-#include <WebCore/TextureMapperJava.h>
+#include <WebCore/TextureMapper.h>
 #include <WebCore/TextureMapperLayer.h>
 #include <WebCore/WorkerThread.h>
 #include <WebCore/platform/graphics/java/GraphicsContextJava.h>
+#include <wtf/MemoryFootprint.h>
 #include <wtf/Ref.h>
 #include <wtf/RunLoop.h>
 #include <wtf/java/JavaRef.h>
@@ -382,7 +388,7 @@ void WebPage::setRootChildLayer(GraphicsLayer* layer)
         m_rootLayer->setNeedsDisplay();
         m_rootLayer->addChild(*layer);
 
-        m_textureMapper = std::make_unique<TextureMapperJavaAdapter>();
+        m_textureMapper = TextureMapper::create();
     } else {
         m_rootLayer = nullptr;
         m_textureMapper.reset();
@@ -443,8 +449,7 @@ void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& cl
 
     TextureMapperLayer& rootTextureMapperLayer = downcast<GraphicsLayerTextureMapper>(*m_rootLayer).layer();
 
-    if (m_textureMapper)
-        static_cast<TextureMapperJavaAdapter*>(m_textureMapper.get())->setGraphicsContext(&context);
+    m_textureMapper->setGraphicsContext(&context);
 
     TransformationMatrix matrix;
     m_textureMapper->beginPainting();
@@ -454,6 +459,7 @@ void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& cl
     rootTextureMapperLayer.paint(*m_textureMapper);
     m_textureMapper->endClip();
     m_textureMapper->endPainting();
+    m_textureMapper->setGraphicsContext(nullptr);
 }
 
 void WebPage::notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/)
@@ -875,6 +881,7 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
 bool s_useCSS3D;
 
 }  // namespace
@@ -882,10 +889,15 @@ bool s_useCSS3D;
 extern "C" {
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT, jboolean useCSS3D) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
     s_useCSS3D = useCSS3D;
+
+    // Called once from the WebPage static initializer, well before the
+    // first page is created, so resolve the platform classes now.
+    PG_ResolveClasses(env);
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
@@ -908,12 +920,15 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
     logChannels().initializeLogChannelsIfNecessary();
 #endif
     WebCore::PlatformStrategiesJava::initialize();
+    JavaScriptHeapJava::initialize();
 
     static std::once_flag initializeJSCOptions;
     std::call_once(initializeJSCOptions, [] {
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+        // FTL tiers up from DFG, and is a no-op in builds without it.
+        JSC::Options::useFTLJIT() = s_useJIT && s_useDFGJIT && s_useFTLJIT;
     });
 
     JLObject jlself(self, true);
@@ -984,6 +999,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
     page->setDeviceScaleFactor(devicePixelScale);
 
     settings.setLinkPrefetchEnabled(true);
+    settings.setLinkPreconnectEnabled(true);
 
         Frame* mainFrame = (Frame*)&page->mainFrame();
     auto* frame = dynamicDowncast<LocalFrame>(mainFrame);
@@ -2509,6 +2525,66 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageDatabasePat
         ->setLocalStorageDatabasePath(settings.localStorageDatabasePath());
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetVisible
+  (JNIEnv*, jobject, jlong pPage, jboolean visible)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    // Hidden pages align their DOM timers to DOMTimer::hiddenPageAlignmentInterval().
+    page->settings().setHiddenPageDOMTimerThrottlingEnabled(true);
+    page->setIsVisible(jbool_to_bool(visible));
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkPurgeMemory
+  (JNIEnv*, jobject, jlong pPage)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    size_t footprint = WTF::memoryFootprint();
+
+    BackForwardCache::singleton().removeAllItemsForPage(*page);
+    page->forEachDocument([](Document& document) {
+        // Images are decoded again when the page is painted.
+        for (auto& resource : document.cachedResourceLoader().allCachedResources().values()) {
+            if (auto* image = dynamicDowncast<CachedImage>(resource.get()))
+                image->destroyDecodedData();
+        }
+        document.styleScope().releaseMemory();
+    });
+    // Compiled code is shared by all pages and is compiled again when needed.
+    GCController::singleton().deleteAllCode(JSC::DeleteAllCodeIfNotCollecting);
+
+    size_t reclaimed = footprint - std::min(footprint, WTF::memoryFootprint());
+    return static_cast<jlong>(reclaimed);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkAddVisitedLinkHashes
+  (JNIEnv* env, jobject, jlong pPage, jintArray hashes)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    jsize length = env->GetArrayLength(hashes);
+    Vector<SharedStringHash> linkHashes(length);
+    env->GetIntArrayRegion(hashes, 0, length, reinterpret_cast<jint*>(linkHashes.mutableSpan().data()));
+    static_cast<VisitedLinkStoreJava&>(page->visitedLinkStore()).addVisitedLinkHashes(linkHashes.span());
+}
+
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkTakeNewVisitedLinkHashes
+  (JNIEnv* env, jobject, jlong pPage)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    auto linkHashes = static_cast<VisitedLinkStoreJava&>(page->visitedLinkStore()).takeNewVisitedLinkHashes();
+    jintArray result = env->NewIntArray(linkHashes.size());
+    if (result)
+        env->SetIntArrayRegion(result, 0, linkHashes.size(), reinterpret_cast<const jint*>(linkHashes.span().data()));
+    return result;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageEnabled
   (JNIEnv*, jobject, jlong pPage, jboolean enabled)
 {
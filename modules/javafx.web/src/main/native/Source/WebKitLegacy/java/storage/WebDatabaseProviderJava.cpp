@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,39 @@
 
 #include "WebDatabaseProvider.h"
 
+#include "InProcessIDBServer.h"
+#include <wtf/NeverDestroyed.h>
+#include <wtf/java/JavaEnv.h>
+
+#include "com_sun_webkit_WebPage.h"
+
+// IndexedDB databases are kept in memory unless a directory is set before
+// the first database of the default session is opened.
+static String& databaseDirectoryPath()
+{
+    static NeverDestroyed<String> path;
+    return path;
+}
+
 String WebDatabaseProvider::indexedDatabaseDirectoryPath()
 {
-    return ""_s;
+    return databaseDirectoryPath();
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetIndexedDatabaseDirectoryPath
+  (JNIEnv* env, jclass, jstring path)
+{
+    ASSERT(isMainThread());
+    databaseDirectoryPath() = String(env, path);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetIndexedDatabaseQuota
+  (JNIEnv*, jclass, jlong quota)
+{
+    ASSERT(quota >= 0);
+    InProcessIDBServer::setPerOriginQuota(quota);
+}
+
 }
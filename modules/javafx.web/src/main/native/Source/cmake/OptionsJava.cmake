@@ -101,15 +101,27 @@ WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_REMOTE_INSPECTOR PRIVATE OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEB_AUDIO PRIVATE OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_PUBLIC_SUFFIX_LIST PRIVATE OFF)
 
-WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC OFF)
-WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE OFF)
+# FTL is built wherever the platform defaults allow it (64-bit Linux and
+# macOS); it is only used at runtime when com.sun.webkit.useFTLJIT is set.
+WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC ${ENABLE_FTL_DEFAULT})
+# WebAssembly is built wherever the LLInt is (not with the C loop). The
+# BBQ/OMG tiers depend on FTL; without them, or with com.sun.webkit.useJIT
+# set to false, Wasm code runs in the Wasm interpreter tier.
+WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE ${ENABLE_WEBASSEMBLY_DEFAULT})
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_MODERN_MEDIA_CONTROLS PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_MEDIA_CONTROLS_CONTEXT_MENUS PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_AVIF PRIVATE OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_LCMS PRIVATE OFF)
 
+# bmalloc (backed by libpas, with IsoHeaps and the Gigacage on 64-bit) is
+# used on macOS and on 64-bit Linux wherever the platform defaults allow it.
+# It can be turned off at runtime by setting the Malloc=1 environment
+# variable, which makes bmalloc forward every allocation to the system
+# allocator.
 if (APPLE)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PRIVATE OFF)
+elseif (WTF_OS_LINUX)
+WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PRIVATE ${USE_SYSTEM_MALLOC_DEFAULT})
 else()
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PRIVATE ON)
 endif()
@@ -122,14 +134,9 @@ if (WIN32)
     # Set linker flags for x86 architecture
     WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_JIT PUBLIC OFF)
     endif ()
-endif ()
-
-#platform Java
-if (WIN32)
-    # Disable 64-bit JIT on Windows , temp fix
-    if (${WTF_CPU_X86_64})
-        WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_JIT PUBLIC OFF)
-    endif ()
+    # FTL and WebAssembly have not been qualified with the clang-cl build yet.
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC OFF)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE OFF)
 endif ()
 
 # Finalize the value for all options. Do not attempt to use an option before
@@ -147,6 +154,7 @@ add_definitions(-DDATA_DIR="${CMAKE_INSTALL_DATADIR}")
 set(FORWARDING_HEADERS_DIR ${DERIVED_SOURCES_DIR}/ForwardingHeaders)
 
 
+set(bmalloc_LIBRARY_TYPE STATIC)
 set(WTF_LIBRARY_TYPE STATIC)
 set(JavaScriptCore_LIBRARY_TYPE STATIC)
 set(WebCore_LIBRARY_TYPE STATIC)
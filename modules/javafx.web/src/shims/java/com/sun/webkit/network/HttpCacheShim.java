@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.sun.webkit.network;
+
+import java.io.IOException;
+import java.net.http.HttpHeaders;
+import java.nio.ByteBuffer;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.Map;
+
+public class HttpCacheShim {
+
+    private final HttpCache cache;
+
+    public HttpCacheShim(Path directory, long maxSize) throws IOException {
+        cache = new HttpCache(directory, maxSize);
+    }
+
+    public boolean put(String url, Map<String, List<String>> headers, byte[] body) {
+        final HttpCache.Writer writer = cache.newWriter(url, 200, "text/plain", "",
+                HttpHeaders.of(headers, (k, v) -> true));
+        if (writer == null) {
+            return false;
+        }
+        writer.write(ByteBuffer.wrap(body));
+        writer.commit();
+        return true;
+    }
+
+    /**
+     * Returns the stored body for a URL, or {@code null}.
+     */
+    public byte[] getBody(String url) {
+        final HttpCache.Entry entry = cache.get(url);
+        if (entry == null) {
+            return null;
+        }
+        final ByteBuffer body = entry.getBody();
+        final byte[] bytes = new byte[body.remaining()];
+        body.get(bytes);
+        return bytes;
+    }
+
+    public Boolean isFresh(String url) {
+        final HttpCache.Entry entry = cache.get(url);
+        return entry != null ? entry.isFresh() : null;
+    }
+
+    public long size() {
+        return cache.size();
+    }
+
+    public static boolean isCacheableRequest(String method, String requestHeaders) {
+        return HttpCache.isCacheableRequest(method, null, requestHeaders);
+    }
+
+    public static boolean requiresValidation(String requestHeaders) {
+        return HttpCache.requiresValidation(requestHeaders);
+    }
+
+    public static long expirationTime(Map<String, List<String>> headers, long responseTime) {
+        return HttpCache.expirationTime(HttpHeaders.of(headers, (k, v) -> true), responseTime);
+    }
+}
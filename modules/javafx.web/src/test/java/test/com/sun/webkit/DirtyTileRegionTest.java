@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit;
+
+import com.sun.webkit.DirtyTileRegion;
+import com.sun.webkit.graphics.WCRectangle;
+import java.util.List;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class DirtyTileRegionTest {
+
+    private static void assertRect(float x, float y, float w, float h, WCRectangle r) {
+        assertEquals(x, r.getX(), "x");
+        assertEquals(y, r.getY(), "y");
+        assertEquals(w, r.getWidth(), "width");
+        assertEquals(h, r.getHeight(), "height");
+    }
+
+    @Test
+    public void testEmptyRectIsIgnored() {
+        DirtyTileRegion region = new DirtyTileRegion(100);
+        region.add(new WCRectangle(10, 10, 0, 5));
+        assertTrue(region.isEmpty());
+        assertTrue(region.take().isEmpty());
+    }
+
+    @Test
+    public void testInvalidTileSize() {
+        assertThrows(IllegalArgumentException.class, () -> new DirtyTileRegion(0));
+    }
+
+    @Test
+    public void testDistantRectsAreNotUnited() {
+        DirtyTileRegion region = new DirtyTileRegion(100);
+        region.add(new WCRectangle(10, 10, 5, 5));
+        region.add(new WCRectangle(510, 510, 5, 5));
+        List<WCRectangle> rects = region.take();
+        assertEquals(2, rects.size());
+        assertRect(10, 10, 5, 5, rects.get(0));
+        assertRect(510, 510, 5, 5, rects.get(1));
+        assertTrue(region.isEmpty());
+    }
+
+    @Test
+    public void testRectsInOneTileAreUnited() {
+        DirtyTileRegion region = new DirtyTileRegion(100);
+        region.add(new WCRectangle(10, 10, 5, 5));
+        region.add(new WCRectangle(50, 60, 10, 10));
+        List<WCRectangle> rects = region.take();
+        assertEquals(1, rects.size());
+        assertRect(10, 10, 50, 60, rects.get(0));
+    }
+
+    @Test
+    public void testFullTilesAreMergedIntoRows() {
+        DirtyTileRegion region = new DirtyTileRegion(100);
+        region.add(new WCRectangle(0, 0, 300, 200));
+        List<WCRectangle> rects = region.take();
+        assertEquals(2, rects.size());
+        assertRect(0, 0, 300, 100, rects.get(0));
+        assertRect(0, 100, 300, 100, rects.get(1));
+    }
+
+    @Test
+    public void testTranslate() {
+        DirtyTileRegion region = new DirtyTileRegion(100);
+        region.add(new WCRectangle(10, 10, 5, 5));
+        region.add(new WCRectangle(500, 500, 5, 5));
+        region.translate(new WCRectangle(0, 0, 200, 200), 0, 150);
+        assertFalse(region.isEmpty());
+        List<WCRectangle> rects = region.take();
+        assertEquals(2, rects.size());
+        assertRect(10, 160, 5, 5, rects.get(0));
+        assertRect(500, 500, 5, 5, rects.get(1));
+    }
+}
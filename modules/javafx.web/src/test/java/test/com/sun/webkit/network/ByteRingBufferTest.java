@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit.network;
+
+import com.sun.webkit.network.ByteRingBufferShim;
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+/**
+ * A test for the {@code ByteRingBuffer} class.
+ */
+public class ByteRingBufferTest {
+
+    private static byte[] bytes(int from, int length) {
+        byte[] result = new byte[length];
+        for (int i = 0; i < length; i++) {
+            result[i] = (byte) (from + i);
+        }
+        return result;
+    }
+
+    /**
+     * Tests that a burst of writes requests a single drain.
+     */
+    @Test
+    public void testWritesAreBatched() throws InterruptedException {
+        ByteRingBufferShim ring = new ByteRingBufferShim(64);
+        assertTrue(ring.write(bytes(0, 10)));
+        assertTrue(ring.write(bytes(10, 10)));
+        assertEquals(1, ring.getDrainRequestCount());
+
+        List<byte[]> slices = ring.drain();
+        assertEquals(1, slices.size());
+        assertArrayEquals(bytes(0, 20), slices.get(0));
+        assertEquals(0, ring.size());
+
+        assertTrue(ring.write(bytes(20, 1)));
+        assertEquals(2, ring.getDrainRequestCount());
+    }
+
+    /**
+     * Tests that data wrapping around the end of the ring is delivered
+     * in order.
+     */
+    @Test
+    public void testWrapAround() throws InterruptedException {
+        ByteRingBufferShim ring = new ByteRingBufferShim(16);
+        assertTrue(ring.write(bytes(0, 12)));
+        ring.drain();
+        assertTrue(ring.write(bytes(12, 10)));
+
+        List<byte[]> slices = ring.drain();
+        assertEquals(2, slices.size());
+        assertArrayEquals(bytes(12, 4), slices.get(0));
+        assertArrayEquals(bytes(16, 6), slices.get(1));
+    }
+
+    /**
+     * Tests that a write larger than the ring waits for the consumer.
+     */
+    @Test
+    public void testWriterWaitsForConsumer() throws Exception {
+        ByteRingBufferShim ring = new ByteRingBufferShim(8);
+        byte[] data = bytes(0, 20);
+        Thread writer = new Thread(() -> {
+            try {
+                ring.write(data);
+            } catch (InterruptedException ignore) {}
+        });
+        writer.start();
+
+        byte[] received = new byte[data.length];
+        int n = 0;
+        long deadline = System.nanoTime() + TimeUnit.SECONDS.toNanos(10);
+        while (n < data.length && System.nanoTime() < deadline) {
+            for (byte[] slice : ring.drain()) {
+                System.arraycopy(slice, 0, received, n, slice.length);
+                n += slice.length;
+            }
+            Thread.yield();
+        }
+        writer.join(TimeUnit.SECONDS.toMillis(10));
+        assertFalse(writer.isAlive());
+        assertArrayEquals(data, received);
+    }
+
+    /**
+     * Tests that closing the ring releases a waiting writer.
+     */
+    @Test
+    public void testCloseReleasesWriter() throws Exception {
+        ByteRingBufferShim ring = new ByteRingBufferShim(4);
+        boolean[] result = { true };
+        Thread writer = new Thread(() -> {
+            try {
+                result[0] = ring.write(bytes(0, 10));
+            } catch (InterruptedException ignore) {}
+        });
+        writer.start();
+        while (ring.size() < 4) {
+            Thread.yield();
+        }
+        ring.close();
+        writer.join(TimeUnit.SECONDS.toMillis(10));
+        assertFalse(writer.isAlive());
+        assertFalse(result[0]);
+        assertEquals(0, ring.drain().size());
+    }
+}
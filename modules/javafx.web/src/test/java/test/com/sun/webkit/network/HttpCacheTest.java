@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit.network;
+
+import com.sun.webkit.network.HttpCacheShim;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.Map;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+/**
+ * A test for the {@code HttpCache} class.
+ */
+public class HttpCacheTest {
+
+    private static final String URL = "https://example.com/script.js";
+
+    @TempDir
+    Path directory;
+
+    /**
+     * Tests that a stored response survives a new cache instance.
+     */
+    @Test
+    public void testStoredResponseIsPersistent() throws IOException {
+        byte[] body = "alert(1);".getBytes(StandardCharsets.UTF_8);
+        HttpCacheShim cache = new HttpCacheShim(directory, 1024 * 1024);
+        assertTrue(cache.put(URL, Map.of("cache-control", List.of("max-age=3600")), body));
+
+        HttpCacheShim reopened = new HttpCacheShim(directory, 1024 * 1024);
+        assertArrayEquals(body, reopened.getBody(URL));
+        assertTrue(reopened.isFresh(URL));
+        assertNull(reopened.getBody("https://example.com/other.js"));
+    }
+
+    /**
+     * Tests that responses only carrying validators are stored stale.
+     */
+    @Test
+    public void testValidatedResponseIsStale() throws IOException {
+        HttpCacheShim cache = new HttpCacheShim(directory, 1024 * 1024);
+        assertTrue(cache.put(URL, Map.of("etag", List.of("\"1\"")), new byte[10]));
+        assertFalse(cache.isFresh(URL));
+    }
+
+    /**
+     * Tests that uncacheable responses are not stored.
+     */
+    @Test
+    public void testUncacheableResponses() throws IOException {
+        HttpCacheShim cache = new HttpCacheShim(directory, 1024 * 1024);
+        assertFalse(cache.put(URL, Map.of("cache-control", List.of("no-store, max-age=60")), new byte[1]));
+        assertFalse(cache.put(URL, Map.of("cache-control", List.of("max-age=60"),
+                                          "vary", List.of("Accept-Language")), new byte[1]));
+        assertFalse(cache.put(URL, Map.of(), new byte[1]));
+        assertNull(cache.getBody(URL));
+    }
+
+    /**
+     * Tests that the least recently used entries are evicted first.
+     */
+    @Test
+    public void testEviction() throws IOException {
+        HttpCacheShim cache = new HttpCacheShim(directory, 16 * 1024);
+        Map<String, List<String>> headers = Map.of("cache-control", List.of("max-age=60"));
+        for (int i = 0; i < 16; i++) {
+            assertTrue(cache.put(URL + i, headers, new byte[1024]));
+            // Keep the first entry in use
+            cache.getBody(URL + 0);
+        }
+        assertTrue(cache.size() <= 16 * 1024);
+        assertArrayEquals(new byte[1024], cache.getBody(URL + 0));
+        assertNull(cache.getBody(URL + 1));
+        assertArrayEquals(new byte[1024], cache.getBody(URL + 15));
+    }
+
+    /**
+     * Tests the freshness lifetime computation.
+     */
+    @Test
+    public void testExpirationTime() {
+        assertEquals(1000 + 60_000, HttpCacheShim.expirationTime(
+                Map.of("cache-control", List.of("public, max-age=60")), 1000));
+        assertEquals(0, HttpCacheShim.expirationTime(
+                Map.of("cache-control", List.of("no-cache, max-age=60")), 1000));
+        assertEquals(1000 + 3_600_000, HttpCacheShim.expirationTime(
+                Map.of("date", List.of("Wed, 28 Sep 2011 09:00:00 GMT"),
+                       "expires", List.of("Wed, 28 Sep 2011 10:00:00 GMT")), 1000));
+        assertEquals(0, HttpCacheShim.expirationTime(
+                Map.of("expires", List.of("0")), 1000));
+    }
+
+    /**
+     * Tests which requests may use the cache.
+     */
+    @Test
+    public void testRequests() {
+        assertTrue(HttpCacheShim.isCacheableRequest("GET", "Accept: */*\n"));
+        assertFalse(HttpCacheShim.isCacheableRequest("POST", "Accept: */*\n"));
+        assertFalse(HttpCacheShim.isCacheableRequest("GET", "If-None-Match: \"1\"\n"));
+        assertFalse(HttpCacheShim.isCacheableRequest("GET", "Cache-Control: no-store\n"));
+
+        assertFalse(HttpCacheShim.requiresValidation("Accept: */*\n"));
+        assertTrue(HttpCacheShim.requiresValidation("Cache-Control: max-age=0\n"));
+        assertTrue(HttpCacheShim.requiresValidation("Pragma: no-cache\n"));
+    }
+}
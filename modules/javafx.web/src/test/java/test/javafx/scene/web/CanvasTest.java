@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@ import java.io.PrintStream;
 import java.util.Base64;
 import javax.imageio.ImageIO;
 
+import com.sun.webkit.graphics.WCRenderQueue;
 import netscape.javascript.JSObject;
 import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.Test;
@@ -119,6 +120,32 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasPathHitTesting() {
+        final String htmlCanvasPath =
+                "<canvas id='canvas' width='300' height='300'></canvas> <script>" +
+                        "var ctx = document.getElementById('canvas').getContext('2d');" +
+                        "var path = new Path2D();" +
+                        "path.moveTo(10, 10);" +
+                        "path.lineTo(110, 10);" +
+                        "path.quadraticCurveTo(150, 60, 110, 110);" +
+                        "path.lineTo(10, 110);" +
+                        "path.closePath();" +
+                        "path.arc(200, 200, 50, 0, 2 * Math.PI, false);" +
+                        "ctx.lineWidth = 10;" +
+                        "</script>";
+
+        loadContent(htmlCanvasPath);
+        submit(() -> {
+            assertEquals(Boolean.TRUE, getEngine().executeScript("ctx.isPointInPath(path, 60, 60)"), "Inside the polygon");
+            assertEquals(Boolean.TRUE, getEngine().executeScript("ctx.isPointInPath(path, 130, 60)"), "Inside the curve");
+            assertEquals(Boolean.FALSE, getEngine().executeScript("ctx.isPointInPath(path, 145, 20)"), "Outside the curve");
+            assertEquals(Boolean.TRUE, getEngine().executeScript("ctx.isPointInPath(path, 200, 200)"), "Inside the arc");
+            assertEquals(Boolean.FALSE, getEngine().executeScript("ctx.isPointInPath(path, 290, 10)"), "Outside the bounds");
+            assertEquals(Boolean.TRUE, getEngine().executeScript("ctx.isPointInStroke(path, 60, 7)"), "On the stroke");
+            assertEquals(Boolean.FALSE, getEngine().executeScript("ctx.isPointInStroke(path, 60, 60)"), "Not on the stroke");
+        });
+    }
+
     // JDK-8234471
     @Test public void testCanvasPattern() throws Exception {
         final String htmlCanvasContent = "\n"
@@ -162,6 +189,84 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasGradientReuse() {
+        final String html =
+                "<canvas id='canvas' width='200' height='100'></canvas> <script>" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "var gradient = ctx.createLinearGradient(0, 0, 100, 0);" +
+                "gradient.addColorStop(0, 'red');" +
+                "gradient.addColorStop(1, 'red');" +
+                "ctx.fillStyle = gradient;" +
+                "ctx.fillRect(0, 0, 100, 100);" +
+                "</script>";
+
+        loadContent(html);
+        submit(() -> {
+            assertEquals(255, (int) getEngine().executeScript(
+                    "ctx.getImageData(50, 50, 1, 1).data[0]"), "Red before the stop is added");
+
+            // A stop added after the gradient was painted must be used by the next fill
+            getEngine().executeScript(
+                    "gradient.addColorStop(0.5, 'blue');" +
+                    "ctx.fillRect(0, 0, 100, 100);");
+            assertTrue((int) getEngine().executeScript(
+                    "ctx.getImageData(50, 50, 1, 1).data[2]") > 200, "Blue after the stop is added");
+
+            // The same gradient painted with another transform must follow it
+            getEngine().executeScript(
+                    "ctx.translate(100, 0);" +
+                    "ctx.fillRect(0, 0, 100, 100);");
+            assertTrue((int) getEngine().executeScript(
+                    "ctx.getImageData(150, 50, 1, 1).data[2]") > 200, "Blue in the translated fill");
+            assertTrue((int) getEngine().executeScript(
+                    "ctx.getImageData(101, 50, 1, 1).data[0]") > 200, "Red at the start of the translated fill");
+        });
+    }
+
+    @Test public void testCanvasGetImageDataSmallRegionAfterFullRead() {
+        final String html =
+                "<canvas id='canvas' width='200' height='200'></canvas> <script>" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "ctx.fillStyle = 'red';" +
+                "ctx.fillRect(0, 0, 200, 200);" +
+                "</script>";
+
+        loadContent(html);
+        submit(() -> {
+            // Full read caches the surface, the small reads below must not see it
+            assertEquals(255, (int) getEngine().executeScript(
+                    "ctx.getImageData(0, 0, 200, 200).data[4 * (200 * 50 + 50)]"), "Red from full read");
+            getEngine().executeScript("ctx.fillStyle = 'blue'; ctx.fillRect(40, 40, 20, 20);");
+            assertEquals(255, (int) getEngine().executeScript(
+                    "ctx.getImageData(50, 50, 1, 1).data[2]"), "Blue from small read");
+            getEngine().executeScript("ctx.fillStyle = 'lime'; ctx.fillRect(90, 90, 20, 20);");
+            assertEquals(255, (int) getEngine().executeScript(
+                    "ctx.getImageData(100, 100, 2, 2).data[1]"), "Green from small read");
+            assertEquals(255, (int) getEngine().executeScript(
+                    "ctx.getImageData(0, 0, 200, 200).data[4 * (200 * 50 + 50) + 2]"), "Blue from full read");
+            assertEquals(255, (int) getEngine().executeScript(
+                    "ctx.getImageData(0, 0, 200, 200).data[4 * (200 * 100 + 100) + 1]"), "Green from full read");
+        });
+    }
+
+    @Test public void testCanvasGetImageDataSmallRegionOutside() {
+        final String html =
+                "<canvas id='canvas' width='100' height='100'></canvas> <script>" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "ctx.fillStyle = 'red';" +
+                "ctx.fillRect(0, 0, 100, 100);" +
+                "</script>";
+
+        loadContent(html);
+        submit(() -> {
+            // 2x2 rect whose top-left pixel lies outside of the canvas
+            assertEquals(0, (int) getEngine().executeScript(
+                    "ctx.getImageData(-1, -1, 2, 2).data[3]"), "Outside pixel is transparent");
+            assertEquals(255, (int) getEngine().executeScript(
+                    "ctx.getImageData(-1, -1, 2, 2).data[12]"), "Inside pixel is red");
+        });
+    }
+
     private BufferedImage htmlCanvasToBufferedImage(final String mime) throws Exception {
         ByteArrayOutputStream errStream = new ByteArrayOutputStream();
         System.setErr(new PrintStream(errStream));
@@ -254,6 +359,28 @@ public class CanvasTest extends TestBase {
         assertTrue(isColorsSimilar(Color.BLACK, pixelAt75x25, 1), "Color should be transparent black:" + pixelAt75x25);
     }
 
+    @Test
+    public void testRenderQueueBufferPoolCounters() {
+        final String htmlCanvasContent = "\n"
+            + "<canvas id='canvas' width='100' height='100'></canvas>\n"
+            + "<script>\n"
+            + "var ctx = document.getElementById('canvas').getContext('2d');\n"
+            + "for (var i = 0; i < 10000; i++) {\n"
+            + "    ctx.fillStyle = (i % 2) ? 'red' : 'blue';\n"
+            + "    ctx.fillRect(i % 100, i % 100, 10, 10);\n"
+            + "}\n"
+            + "</script>\n";
+
+        loadContent(htmlCanvasContent);
+        submit(() -> {
+            final long[] counters = WCRenderQueue.getBufferPoolCounters();
+            assertEquals(3, counters.length);
+            assertTrue(counters[WCRenderQueue.POOL_HIT_COUNT] >= 0, "Pool hit count must not be negative");
+            assertTrue(counters[WCRenderQueue.POOL_MISS_COUNT] > 0, "Buffers must have been requested from the pool");
+            assertTrue(counters[WCRenderQueue.POOL_FREE_COUNT] >= 0, "Pool size must not be negative");
+        });
+    }
+
     @AfterEach
     public void resetSystemErr() {
         System.setErr(ERR);
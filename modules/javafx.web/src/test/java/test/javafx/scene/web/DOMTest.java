@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,13 +25,17 @@
 
 package test.javafx.scene.web;
 
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
 import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertNull;
 import static org.junit.jupiter.api.Assertions.assertNotNull;
 import static org.junit.jupiter.api.Assertions.assertSame;
+import static org.junit.jupiter.api.Assertions.assertThrows;
 import static org.junit.jupiter.api.Assertions.assertTrue;
 import static org.junit.jupiter.api.Assertions.fail;
 
+import java.util.ArrayList;
+import java.util.List;
 import javafx.scene.web.WebEngine;
 
 import org.junit.jupiter.api.Test;
@@ -71,6 +75,88 @@ public class DOMTest extends TestBase {
         });
     }
 
+    @Test public void testBulkQuerySelectorAll() {
+        final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
+        submit(() -> {
+            ElementImpl root = (ElementImpl) doc.getDocumentElement();
+            NodeList list = root.querySelectorAll("option");
+            Element[] options = root.querySelectorAllElements("option");
+            assertEquals(5, options.length);
+            for (int i = 0; i < options.length; i++) {
+                assertSame(list.item(i), options[i]);
+            }
+            assertTrue(options[0] instanceof HTMLOptionElement);
+            assertEquals(0, root.querySelectorAllElements("table").length);
+
+            String[] values = root.querySelectorAllAttributes("p[id^=p]", "id", "class");
+            assertArrayEquals(new String[] {"p1", null, "p2", null, "p3", "head2"}, values);
+            assertEquals(0, root.querySelectorAllAttributes("p", new String[0]).length);
+
+            assertThrows(DOMException.class, () -> root.querySelectorAllElements("p["));
+        });
+    }
+
+    @Test public void testPeerCacheCounters() {
+        final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
+        submit(() -> {
+            Element p1 = doc.getElementById("p1");
+            long[] before = NodeImpl.getPeerCacheCounters();
+            for (int i = 0; i < 10; i++) {
+                assertSame(p1, doc.getElementById("p1"));
+            }
+            long[] after = NodeImpl.getPeerCacheCounters();
+            assertEquals(before[NodeImpl.PEER_CREATED_COUNT], after[NodeImpl.PEER_CREATED_COUNT]);
+            assertEquals(before[NodeImpl.PEER_REUSED_COUNT] + 10, after[NodeImpl.PEER_REUSED_COUNT]);
+            assertTrue(after[NodeImpl.PEER_LIVE_COUNT] > 0);
+        });
+    }
+
+    @Test public void testMutationObserver() {
+        final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
+        submit(() -> {
+            List<MutationObserverImpl.Record> records = new ArrayList<>();
+            MutationObserverImpl observer = new MutationObserverImpl(records::addAll);
+            observer.observe(doc.getDocumentElement(), MutationObserverImpl.CHILD_LIST
+                    | MutationObserverImpl.ATTRIBUTES | MutationObserverImpl.CHARACTER_DATA
+                    | MutationObserverImpl.SUBTREE | MutationObserverImpl.CHARACTER_DATA_OLD_VALUE);
+
+            // The records of a script are delivered together when it returns
+            getEngine().executeScript(
+                    "var p = document.getElementById('p1');"
+                    + "p.setAttribute('title', 'a');"
+                    + "var t = document.createTextNode('hello world');"
+                    + "p.appendChild(t);"
+                    + "t.data = 'hello there world';");
+            Element p1 = doc.getElementById("p1");
+            assertEquals(3, records.size());
+
+            MutationObserverImpl.Record attribute = records.get(0);
+            assertEquals(MutationObserverImpl.Type.ATTRIBUTES, attribute.type());
+            assertSame(p1, attribute.target());
+            assertEquals("title", attribute.attributeName());
+            assertEquals("a", attribute.value());
+
+            MutationObserverImpl.Record child = records.get(1);
+            assertEquals(MutationObserverImpl.Type.CHILD_LIST, child.type());
+            assertSame(p1, child.target());
+            assertEquals(1, child.addedNodes().size());
+            assertSame(p1.getLastChild(), child.addedNodes().get(0));
+            assertTrue(child.removedNodes().isEmpty());
+
+            MutationObserverImpl.Record text = records.get(2);
+            assertEquals(MutationObserverImpl.Type.CHARACTER_DATA, text.type());
+            assertSame(p1.getLastChild(), text.target());
+            assertEquals(6, text.textOffset());
+            assertEquals(0, text.textRemoved());
+            assertEquals("there ", text.value());
+
+            records.clear();
+            observer.disconnect();
+            getEngine().executeScript("document.getElementById('p1').setAttribute('title', 'b');");
+            assertTrue(records.isEmpty());
+        });
+    }
+
     @Test public void testEmptyTextContent() {
         final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
         submit(() -> {
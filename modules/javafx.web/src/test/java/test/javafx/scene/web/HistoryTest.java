@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package test.javafx.scene.web;
 
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.io.File;
+import com.sun.webkit.PageCache;
 import javafx.beans.value.ObservableValue;
 import javafx.scene.web.WebHistory;
 import javafx.beans.value.ChangeListener;
@@ -284,6 +285,27 @@ public class HistoryTest extends TestBase {
         */
     }
 
+    @Test public void testPageCacheCounters() {
+        load(new File("src/test/resources/test/html/h1.html"));
+        load(new File("src/test/resources/test/html/h2.html"));
+
+        final int[] before = submit(PageCache::getCounters);
+        submit(() -> {
+            history.go(-1);
+        });
+        waitLoadFinished();
+        final int[] after = submit(PageCache::getCounters);
+        assertEquals(before[PageCache.HISTORY_NAVIGATION_COUNT] + 1,
+                after[PageCache.HISTORY_NAVIGATION_COUNT], "history navigation count is wrong");
+        assertTrue(after[PageCache.RESTORED_PAGE_COUNT] >= before[PageCache.RESTORED_PAGE_COUNT],
+                "restored page count is wrong");
+
+        submit(() -> {
+            PageCache.releaseMemory(true);
+            assertEquals(0, PageCache.getPageCount(), "page cache is not empty after release");
+        });
+    }
+
     void ensureValueChanged(AtomicBoolean value, String errMsg) {
         if (!value.compareAndSet(true, false)) {
             fail(errMsg);
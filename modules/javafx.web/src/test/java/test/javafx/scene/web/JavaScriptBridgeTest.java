@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -666,6 +666,70 @@ public class JavaScriptBridgeTest extends TestBase {
          });
     }
 
+    public static class PrimitiveArrays {
+        public double sumDoubles(double[] values) {
+            double sum = 0;
+            for (double v : values) {
+                sum += v;
+            }
+            return sum;
+        }
+
+        public int sumInts(int[] values) {
+            int sum = 0;
+            for (int v : values) {
+                sum += v;
+            }
+            return sum;
+        }
+
+        public int byteAt(byte[] values, int index) {
+            return values[index];
+        }
+
+        public boolean isNull(double[] values) {
+            return values == null;
+        }
+    }
+
+    public @Test void testTypedArrayToJavaPrimitiveArray() {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            bind("arrays", new PrimitiveArrays());
+            assertEquals(6.5, web.executeScript("arrays.sumDoubles(new Float64Array([1, 2, 3.5]))"));
+            assertEquals(6, web.executeScript("arrays.sumInts(new Int32Array([1, 2, 3]))"));
+            // Element types that differ from the Java array are converted one by one
+            assertEquals(6, web.executeScript("arrays.sumDoubles(new Int32Array([1, 2, 3]))"));
+            assertEquals(-56, web.executeScript("arrays.byteAt(new Uint8Array([1, 200]), 1)"));
+            assertEquals(7, web.executeScript("arrays.sumDoubles([3, 4])"));
+            assertEquals(0, web.executeScript("arrays.sumDoubles(new Float64Array(0))"));
+            assertEquals(Boolean.TRUE, web.executeScript("arrays.isNull({ length: 2 })"));
+        });
+    }
+
+    public @Test void testBridgeRepeatedCalls() {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            StringBuilder sb1 = new StringBuilder();
+            StringBuilder sb2 = new StringBuilder("x");
+            bind("sb1", sb1);
+            bind("sb2", sb2);
+            assertEquals(65, web.executeScript(
+                    "var n = 0;"
+                    + "for (var i = 0; i < 10; i++) {"
+                    + "  sb1['append(int)'](i);"
+                    + "  sb1['append(java.lang.String)']('-');"
+                    + "  sb2.append(i);"
+                    + "  n += sb2.length();"
+                    + "}"
+                    + "n"));
+            assertEquals("0-1-2-3-4-5-6-7-8-9-", sb1.toString());
+            assertEquals("x0123456789", sb2.toString());
+        });
+    }
+
     public @Test void testBridgeBadOverloading() {
         final WebEngine web = getEngine();
 
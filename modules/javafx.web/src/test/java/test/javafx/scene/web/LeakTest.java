@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package test.javafx.scene.web;
 
 import static javafx.concurrent.Worker.State.SUCCEEDED;
+import com.sun.webkit.JavaScriptHeap;
 import com.sun.webkit.dom.JSObjectShim;
 import com.sun.webkit.dom.NodeImplShim;
 import java.io.File;
@@ -214,4 +215,23 @@ public class LeakTest extends TestBase {
 
         JMemoryBuddy.assertCollectable(willGC);
     }
+
+    @Test public void testJavaScriptHeapStatistics() {
+        loadContent("<html><body></body></html>");
+        submit(() -> {
+            getEngine().executeScript(
+                    "var garbage = []; for (var i = 0; i < 10000; i++) garbage.push({ i: i }); garbage = null;");
+            final long[] before = JavaScriptHeap.getStatistics(true);
+            assertTrue(before[JavaScriptHeap.HEAP_SIZE] > 0, "heap size is not positive");
+            assertTrue(before[JavaScriptHeap.OBJECT_COUNT] > 0, "object count is not positive");
+            assertTrue(before[JavaScriptHeap.GLOBAL_OBJECT_COUNT] > 0, "global object count is not positive");
+
+            JavaScriptHeap.collectGarbage(false);
+            final long[] after = JavaScriptHeap.getStatistics(false);
+            assertTrue(after[JavaScriptHeap.FULL_COLLECTION_COUNT] > before[JavaScriptHeap.FULL_COLLECTION_COUNT],
+                    "full collection is not counted");
+            assertTrue(after[JavaScriptHeap.MAX_COLLECTION_NANOS] > 0, "collection duration is not recorded");
+            assertEquals(-1, after[JavaScriptHeap.OBJECT_COUNT], "objects are counted");
+        });
+    }
 }
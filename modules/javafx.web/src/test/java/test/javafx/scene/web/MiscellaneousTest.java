@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 package test.javafx.scene.web;
 
+import com.sun.webkit.graphics.WCFont;
 import java.io.BufferedReader;
 import java.io.File;
 import java.io.FileInputStream;
@@ -510,4 +511,25 @@ public class MiscellaneousTest extends TestBase {
             }
         });
     }
+
+    @Test public void testTextRunCacheIsHitForRepeatedComplexText() {
+        final StringBuilder html = new StringBuilder("<table>");
+        for (int i = 0; i < 20; i++) {
+            html.append("<tr><td>\u0645\u0631\u062d\u0628\u0627</td></tr>");
+        }
+        html.append("</table>");
+
+        final long[] before = submit(WCFont::getTextRunCacheCounters);
+        loadContent(html.toString());
+        submit(() -> {
+            getEngine().executeScript("document.body.offsetHeight");
+            final long[] after = WCFont.getTextRunCacheCounters();
+            assertEquals(3, after.length);
+            assertTrue(after[WCFont.TEXT_RUN_CACHE_MISS_COUNT] > before[WCFont.TEXT_RUN_CACHE_MISS_COUNT],
+                    "Shaping the first cell must miss the cache");
+            assertTrue(after[WCFont.TEXT_RUN_CACHE_HIT_COUNT] > before[WCFont.TEXT_RUN_CACHE_HIT_COUNT],
+                    "Shaping the repeated cells must hit the cache");
+            assertTrue(after[WCFont.TEXT_RUN_CACHE_SIZE] > 0, "Cache must hold the shaped runs");
+        });
+    }
 }
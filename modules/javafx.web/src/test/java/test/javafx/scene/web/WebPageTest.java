@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,9 +27,12 @@ package test.javafx.scene.web;
 
 import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageShim;
+import com.sun.webkit.graphics.WCImage;
+import java.nio.ByteBuffer;
 import javafx.scene.web.WebEngineShim;
 
 import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
 import static org.junit.jupiter.api.Assertions.assertNull;
 import static org.junit.jupiter.api.Assertions.assertThrows;
 import org.junit.jupiter.api.Test;
@@ -105,4 +108,23 @@ public class WebPageTest extends TestBase {
             page.getClientLocationOffset(0, 0);
         });
     }
+
+    @Test
+    public void testRenderToImage() {
+        WebPage page = WebEngineShim.getPage(getEngine());
+        loadContent("<html><body style='margin:0; background-color:#ff0000'></body></html>");
+
+        WCImage image = page.renderToImage(64, 32);
+        assertNotNull(image);
+        assertEquals(64, image.getWidth());
+        assertEquals(32, image.getHeight());
+
+        // Premultiplied BGRA
+        ByteBuffer pixels = image.getPixelBuffer();
+        int offset = (16 * 64 + 32) * 4;
+        assertEquals(0, pixels.get(offset) & 0xff, "blue");
+        assertEquals(0, pixels.get(offset + 1) & 0xff, "green");
+        assertEquals(255, pixels.get(offset + 2) & 0xff, "red");
+        assertEquals(255, pixels.get(offset + 3) & 0xff, "alpha");
+    }
 }
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures the time and resident memory taken by a page that repeatedly
+ * builds and tears down a large DOM subtree.
+ *
+ * Run it once as is and once with the Malloc=1 environment variable set
+ * to compare bmalloc against the system allocator. The resident set size
+ * is only reported on Linux.
+ */
+public class DOMChurnMemory extends Application {
+
+    private static final int ROUNDS = 200;
+    private static final int NODES = 5000;
+
+    private static final String CHURN_SCRIPT =
+            "(function() {" +
+            "  var root = document.getElementById('root');" +
+            "  for (var n = 0; n < " + NODES + "; n++) {" +
+            "    var div = document.createElement('div');" +
+            "    div.className = 'item' + (n % 7);" +
+            "    div.textContent = 'item ' + n + ' ' + Math.random();" +
+            "    root.appendChild(div);" +
+            "  }" +
+            "  root.offsetHeight;" +
+            "  root.innerHTML = '';" +
+            "})()";
+
+    private int round;
+    private long startNanos;
+
+    @Override
+    public void start(Stage stage) {
+        WebView webView = new WebView();
+        WebEngine engine = webView.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED) {
+                System.out.println("before: " + residentSize());
+                startNanos = System.nanoTime();
+                Platform.runLater(() -> churn(engine));
+            }
+        });
+        engine.loadContent("<html><body><div id='root'></div></body></html>");
+
+        stage.setTitle("DOMChurnMemory");
+        stage.setScene(new Scene(webView, 800, 600));
+        stage.show();
+    }
+
+    private void churn(WebEngine engine) {
+        engine.executeScript(CHURN_SCRIPT);
+        if (++round % 50 == 0) {
+            System.out.println("round " + round + ": " + residentSize());
+        }
+        if (round < ROUNDS) {
+            Platform.runLater(() -> churn(engine));
+            return;
+        }
+        long millis = (System.nanoTime() - startNanos) / 1_000_000;
+        System.out.println(ROUNDS + " rounds of " + NODES + " nodes took " + millis + " ms");
+        System.out.println("after: " + residentSize());
+        Platform.exit();
+    }
+
+    private static String residentSize() {
+        try {
+            for (String line : Files.readAllLines(Path.of("/proc/self/status"))) {
+                if (line.startsWith("VmRSS:")) {
+                    return line.substring(6).trim();
+                }
+            }
+        } catch (IOException e) {
+            // not available on this platform
+        }
+        return "n/a";
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package renderperf;
+
+package effectbench;
+
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.function.Supplier;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.SnapshotParameters;
+import javafx.scene.effect.BoxBlur;
+import javafx.scene.effect.DropShadow;
+import javafx.scene.effect.Effect;
+import javafx.scene.effect.GaussianBlur;
+import javafx.scene.effect.InnerShadow;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.shape.Circle;
+import javafx.scene.shape.Rectangle;
+import javafx.scene.text.Font;
+import javafx.scene.text.Text;
+import javafx.stage.Stage;
+
+/**
+ * {@link EffectBenchmark} measures the speed of the software effect
+ * filters by taking snapshots of a node with a blur or shadow effect.
+ *
+ * It must be run with the software pipeline so that the effects are
+ * filtered by the native SSE peers of Decora. Each effect is snapshotted
+ * once to warm up and then for a fixed number of timed iterations; the
+ * median time per effect is printed and the application exits. To compare
+ * with the scalar loops, run it once as is and once with the vector loops
+ * disabled:
+ *
+ * <pre>
+ *   java -Dprism.order=sw -Ddecora.verbose=true --module-path $SDK/lib --add-modules javafx.graphics effectbench.EffectBenchmark
+ *   java -Dprism.order=sw -Ddecora.sse.isa=scalar --module-path $SDK/lib --add-modules javafx.graphics effectbench.EffectBenchmark
+ * </pre>
+ *
+ * On x86 processors with AVX2, {@code -Ddecora.sse.isa=sse4.1} selects the
+ * narrower vector loops.
+ * The passes are split into bands that are filtered by several threads;
+ * {@code -Ddecora.sse.threads=1} filters them on one thread.
+ *
+ * Options:
+ * <ul>
+ * <li>{@code -i <n>} number of timed iterations (default 20)</li>
+ * <li>{@code -s <w>x<h>} size of the snapshotted node (default 1024x768)</li>
+ * <li>{@code -e <name>} run only the named effect</li>
+ * </ul>
+ */
+public class EffectBenchmark extends Application {
+
+    private static int iterations = 20;
+    private static int width = 1024;
+    private static int height = 768;
+    private static String onlyEffect;
+
+    public static void main(String[] args) {
+        for (int i = 0; i < args.length; i++) {
+            switch (args[i]) {
+                case "-i" -> iterations = Integer.parseInt(args[++i]);
+                case "-s" -> {
+                    String[] size = args[++i].split("x");
+                    width = Integer.parseInt(size[0]);
+                    height = Integer.parseInt(size[1]);
+                }
+                case "-e" -> onlyEffect = args[++i];
+                default -> {
+                    System.err.println("Usage: EffectBenchmark [-i <iterations>] [-s <w>x<h>] [-e <effect>]");
+                    System.exit(1);
+                }
+            }
+        }
+        launch(args);
+    }
+
+    private static Map<String, Supplier<Effect>> effects() {
+        Map<String, Supplier<Effect>> effects = new LinkedHashMap<>();
+        effects.put("boxBlur", () -> new BoxBlur(15, 15, 1));
+        effects.put("boxBlur3", () -> new BoxBlur(15, 15, 3));
+        effects.put("gaussian", () -> new GaussianBlur(31));
+        effects.put("dropShadow", () -> new DropShadow(20, 5, 5, Color.BLACK));
+        effects.put("colorShadow", () -> new DropShadow(20, 5, 5, Color.CORNFLOWERBLUE));
+        effects.put("innerShadow", () -> new InnerShadow(20, Color.DARKRED));
+        return effects;
+    }
+
+    private static Group createContent() {
+        Group group = new Group(new Rectangle(width, height, Color.TRANSPARENT));
+        for (int i = 0; i < 40; i++) {
+            double x = (i * 97) % width;
+            double y = (i * 61) % height;
+            Color color = Color.hsb(i * 37 % 360, 0.8, 0.9, 0.5 + (i % 5) / 10.0);
+            group.getChildren().add(new Circle(x, y, 20 + i % 7 * 10, color));
+        }
+        Text text = new Text(40, height / 2.0, "EffectBenchmark");
+        text.setFont(Font.font(96));
+        group.getChildren().add(text);
+        return group;
+    }
+
+    @Override
+    public void start(Stage stage) {
+        stage.setScene(new Scene(new Group(), 320, 240));
+        stage.setTitle("EffectBenchmark");
+        stage.show();
+        Platform.runLater(this::run);
+    }
+
+    private void run() {
+        System.out.println("prism.order=" + System.getProperty("prism.order", "default")
+                + ", decora.sse.isa=" + System.getProperty("decora.sse.isa", "default")
+                + ", size=" + width + "x" + height
+                + ", iterations=" + iterations);
+        Group content = createContent();
+        SnapshotParameters params = new SnapshotParameters();
+        params.setFill(Color.TRANSPARENT);
+        double total = 0;
+        for (Map.Entry<String, Supplier<Effect>> entry : effects().entrySet()) {
+            String name = entry.getKey();
+            if (onlyEffect != null && !onlyEffect.equals(name)) {
+                continue;
+            }
+            content.setEffect(entry.getValue().get());
+            WritableImage image = content.snapshot(params, null);
+            List<Double> times = new ArrayList<>();
+            for (int i = 0; i < iterations; i++) {
+                long start = System.nanoTime();
+                content.snapshot(params, image);
+                times.add((System.nanoTime() - start) / 1e6);
+            }
+            times.sort(null);
+            double median = times.get(times.size() / 2);
+            total += median;
+            System.out.println(String.format(Locale.ROOT, "%-12s %10.2f ms", name, median));
+        }
+        System.out.println(String.format(Locale.ROOT, "%-12s %10.2f ms", "total", total));
+        Platform.exit();
+    }
+}
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package mediabench;
+
+import com.sun.media.jfxmedia.MediaStatistics;
+import java.io.IOException;
+import java.lang.management.ManagementFactory;
+import java.lang.reflect.Method;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Locale;
+import java.util.stream.Stream;
+import javafx.animation.KeyFrame;
+import javafx.animation.Timeline;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Scene;
+import javafx.scene.layout.TilePane;
+import javafx.scene.media.Media;
+import javafx.scene.media.MediaPlayer;
+import javafx.scene.media.MediaView;
+import javafx.stage.Stage;
+import javafx.util.Duration;
+
+/**
+ * {@link MediaBenchmark} plays a set of media with 1, 4 and 16 players at
+ * a time and reports how well playback keeps up, to find throughput
+ * regressions of the media stack and to soak it over long runs.
+ *
+ * The media are the files and URLs named on the command line, or the files
+ * found in the directories named there; HTTP Live Streaming is tested with
+ * the URL of a playlist. A codec, resolution and container matrix can be
+ * made with, for instance:
+ *
+ * <pre>
+ *   ffmpeg -i source.mp4 -t 60 -vf scale=-2:1080 -c:v libx264 -c:a aac h264-aac-1080p.mp4
+ *   ffmpeg -i source.mp4 -t 60 -vf scale=-2:1080 -c:v libx265 -tag:v hvc1 -c:a aac h265-aac-1080p.mp4
+ *   ffmpeg -i source.mp4 -t 60 -vf scale=-2:720 -c:v libx264 -c:a mp3 h264-mp3-720p.ts
+ *   ffmpeg -i source.mp4 -t 60 -c:v libx264 -c:a aac -f hls -hls_time 4 hls/index.m3u8
+ * </pre>
+ *
+ * Each medium is played in a loop by every number of players for the given
+ * duration, and the following is printed per run:
+ * <ul>
+ * <li>{@code fps}: the mean rate at which a player decoded frames</li>
+ * <li>{@code dropped}, {@code late}: the frames of all players that were
+ * dropped, or shown after their presentation time</li>
+ * <li>{@code drift}: the largest difference, in milliseconds, between the
+ * media time of a player and the time since it started playing</li>
+ * <li>{@code cpu}: the process CPU time, in percent of one core</li>
+ * <li>{@code cpu/frame}: the process CPU time per decoded frame, which
+ * stands for the decode and color conversion time of a frame</li>
+ * <li>{@code rss}: the resident set size at the end of the run and how
+ * much it grew per minute, where the operating system reports it</li>
+ * </ul>
+ * The color conversion kernels are timed on their own by the
+ * {@code media} benchmarks of {@code tests/performance/native/NativeBenchmark}.
+ *
+ * The frame counters come from the internal player, so it must be open:
+ *
+ * <pre>
+ *   java --module-path $SDK/lib --add-modules javafx.media \
+ *        --add-opens javafx.media/javafx.scene.media=ALL-UNNAMED \
+ *        --add-exports javafx.media/com.sun.media.jfxmedia=ALL-UNNAMED \
+ *        mediabench.MediaBenchmark [options] medium or directory...
+ * </pre>
+ *
+ * Options:
+ * <ul>
+ * <li>{@code -d <seconds>} duration of each run (default 30)</li>
+ * <li>{@code -p <n,n,...>} numbers of simultaneous players (default 1,4,16)</li>
+ * <li>{@code -v} also print a sample line every second, for soak runs</li>
+ * </ul>
+ */
+public class MediaBenchmark extends Application {
+
+    private static int duration = 30;
+    private static int[] playerCounts = { 1, 4, 16 };
+    private static boolean verbose;
+    private static final List<String> media = new ArrayList<>();
+
+    public static void main(String[] args) throws IOException {
+        for (int i = 0; i < args.length; i++) {
+            switch (args[i]) {
+                case "-d" -> duration = Integer.parseInt(args[++i]);
+                case "-p" -> playerCounts = Stream.of(args[++i].split(","))
+                        .mapToInt(Integer::parseInt).toArray();
+                case "-v" -> verbose = true;
+                default -> {
+                    if (args[i].startsWith("-")) {
+                        usage();
+                    }
+                    addMedia(args[i]);
+                }
+            }
+        }
+        if (media.isEmpty()) {
+            usage();
+        }
+        launch(args);
+    }
+
+    private static void usage() {
+        System.err.println("Usage: MediaBenchmark [-d <seconds>] [-p <n,n,...>] [-v] medium or directory...");
+        System.exit(1);
+    }
+
+    private static void addMedia(String arg) throws IOException {
+        if (arg.contains("://")) {
+            media.add(arg);
+            return;
+        }
+        Path path = Path.of(arg);
+        if (!Files.isDirectory(path)) {
+            media.add(path.toAbsolutePath().toUri().toString());
+            return;
+        }
+        try (Stream<Path> files = Files.walk(path)) {
+            files.filter(Files::isRegularFile).sorted()
+                 .forEach(p -> media.add(p.toAbsolutePath().toUri().toString()));
+        }
+    }
+
+    /**
+     * A player of a run, when it started playing and its largest drift.
+     */
+    private static final class Player {
+        final MediaPlayer player;
+        long playStart;
+        double maxDrift;
+
+        Player(MediaPlayer player) {
+            this.player = player;
+        }
+    }
+
+    private static Method retrieveJfxPlayer;
+
+    private static MediaStatistics getStatistics(MediaPlayer player) {
+        try {
+            if (retrieveJfxPlayer == null) {
+                retrieveJfxPlayer = MediaPlayer.class.getDeclaredMethod("retrieveJfxPlayer");
+                retrieveJfxPlayer.setAccessible(true);
+            }
+            com.sun.media.jfxmedia.MediaPlayer jfxPlayer =
+                    (com.sun.media.jfxmedia.MediaPlayer) retrieveJfxPlayer.invoke(player);
+            return jfxPlayer != null ? jfxPlayer.getStatistics() : null;
+        } catch (ReflectiveOperationException e) {
+            throw new IllegalStateException("javafx.scene.media must be opened to the benchmark", e);
+        }
+    }
+
+    private static long getProcessCpuTime() {
+        if (ManagementFactory.getOperatingSystemMXBean()
+                instanceof com.sun.management.OperatingSystemMXBean os) {
+            return os.getProcessCpuTime();
+        }
+        return -1;
+    }
+
+    // The resident set size in kilobytes, or -1 where it is not known
+    private static long getResidentSetSize() {
+        try (Stream<String> lines = Files.lines(Path.of("/proc/self/status"))) {
+            return lines.filter(l -> l.startsWith("VmRSS:"))
+                        .mapToLong(l -> Long.parseLong(l.replaceAll("[^0-9]", "")))
+                        .findFirst().orElse(-1);
+        } catch (IOException | RuntimeException e) {
+            return -1;
+        }
+    }
+
+    private final TilePane pane = new TilePane();
+    private final List<Player> players = new ArrayList<>();
+    private int mediumIndex;
+    private int countIndex;
+    private int ready;
+    private long runStart;
+    private long cpuStart;
+    private long rssStart;
+    private Timeline sampler;
+
+    @Override
+    public void start(Stage stage) {
+        stage.setScene(new Scene(pane, 1280, 720));
+        stage.setTitle("MediaBenchmark");
+        stage.show();
+
+        System.out.println(String.format(Locale.ROOT, "%-32s %7s %8s %8s %8s %8s %6s %10s %9s %9s",
+                "medium", "players", "fps", "dropped", "late", "drift", "cpu", "cpu/frame", "rss", "rss/min"));
+        startRun();
+    }
+
+    private String mediumName() {
+        String uri = media.get(mediumIndex);
+        return uri.substring(uri.lastIndexOf('/', uri.length() - 2) + 1);
+    }
+
+    private void startRun() {
+        int count = playerCounts[countIndex];
+        Media medium = new Media(media.get(mediumIndex));
+        ready = 0;
+        for (int i = 0; i < count; i++) {
+            MediaPlayer player = new MediaPlayer(medium);
+            Player p = new Player(player);
+            player.setMute(true);
+            player.setCycleCount(MediaPlayer.INDEFINITE);
+            player.setOnReady(() -> {
+                if (++ready == count) {
+                    play();
+                }
+            });
+            player.setOnPlaying(() -> {
+                if (p.playStart == 0) {
+                    p.playStart = System.nanoTime();
+                }
+            });
+            player.setOnError(() -> {
+                if (!players.contains(p)) {
+                    return;
+                }
+                System.out.println(String.format(Locale.ROOT, "%-32s %7d %s",
+                        mediumName(), count, player.getError().getMessage()));
+                endRun(false);
+            });
+            MediaView view = new MediaView(player);
+            view.setFitWidth(1280 / Math.ceil(Math.sqrt(count)));
+            view.setPreserveRatio(true);
+            pane.getChildren().add(view);
+            players.add(p);
+        }
+    }
+
+    private void play() {
+        for (Player p : players) {
+            p.player.play();
+        }
+        runStart = System.nanoTime();
+        cpuStart = getProcessCpuTime();
+        rssStart = getResidentSetSize();
+        sampler = new Timeline(new KeyFrame(Duration.seconds(1), e -> sample()));
+        sampler.setCycleCount(duration);
+        sampler.setOnFinished(e -> endRun(true));
+        sampler.play();
+    }
+
+    private void sample() {
+        long now = System.nanoTime();
+        for (Player p : players) {
+            MediaPlayer player = p.player;
+            if (p.playStart == 0 || player.getStatus() != MediaPlayer.Status.PLAYING) {
+                continue;
+            }
+            double mediaTime = player.getCurrentCount() * player.getCycleDuration().toMillis()
+                    + player.getCurrentTime().toMillis() - player.getStartTime().toMillis();
+            double drift = mediaTime - (now - p.playStart) / 1e6;
+            if (Math.abs(drift) > Math.abs(p.maxDrift)) {
+                p.maxDrift = drift;
+            }
+        }
+        if (verbose) {
+            long frames = 0;
+            for (Player p : players) {
+                MediaStatistics statistics = getStatistics(p.player);
+                frames += statistics != null ? statistics.getFramesDecoded() : 0;
+            }
+            System.out.println(String.format(Locale.ROOT, "  %6.0f s  %d frames, %d kB",
+                    (now - runStart) / 1e9, frames, getResidentSetSize()));
+        }
+    }
+
+    private void endRun(boolean completed) {
+        if (sampler != null) {
+            sampler.stop();
+            sampler = null;
+        }
+        if (players.isEmpty()) {
+            return;
+        }
+        if (completed) {
+            printRun();
+        }
+        for (Player p : players) {
+            p.player.dispose();
+        }
+        players.clear();
+        pane.getChildren().clear();
+
+        if (++countIndex == playerCounts.length) {
+            countIndex = 0;
+            if (++mediumIndex == media.size()) {
+                Platform.exit();
+                return;
+            }
+        }
+        // Let the disposed players release their resources first
+        Platform.runLater(this::startRun);
+    }
+
+    private void printRun() {
+        double seconds = (System.nanoTime() - runStart) / 1e9;
+        long cpu = getProcessCpuTime() - cpuStart;
+        long rss = getResidentSetSize();
+        long decoded = 0;
+        long dropped = 0;
+        long late = 0;
+        double drift = 0;
+        for (Player p : players) {
+            MediaStatistics statistics = getStatistics(p.player);
+            if (statistics != null) {
+                decoded += statistics.getFramesDecoded();
+                dropped += statistics.getFramesDropped();
+                late += statistics.getFramesLate();
+            }
+            if (Math.abs(p.maxDrift) > Math.abs(drift)) {
+                drift = p.maxDrift;
+            }
+        }
+        System.out.println(String.format(Locale.ROOT,
+                "%-32s %7d %8.1f %8d %8d %8.0f %5.0f%% %7.2f ms %6d MB %6.1f MB",
+                mediumName(), players.size(), decoded / seconds / players.size(), dropped, late, drift,
+                cpuStart < 0 ? Double.NaN : cpu / 1e7 / seconds,
+                cpuStart < 0 || decoded == 0 ? Double.NaN : cpu / 1e6 / decoded,
+                rss < 0 ? -1 : rss / 1024, rss < 0 ? Double.NaN : (rss - rssStart) / 1024.0 / (seconds / 60)));
+    }
+}
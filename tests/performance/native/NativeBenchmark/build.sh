@@ -0,0 +1,86 @@
+#!/bin/sh
+#
+# Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+# DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+#
+# This code is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License version 2 only, as
+# published by the Free Software Foundation.
+#
+# This code is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+# version 2 for more details (a copy is included in the LICENSE file that
+# accompanied this code).
+#
+# You should have received a copy of the GNU General Public License version
+# 2 along with this work; if not, write to the Free Software Foundation,
+# Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+#
+# Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+# or visit www.oracle.com if you need additional information or have any
+# questions.
+#
+
+# Builds nativebench into build/ with the compiler flags of the Linux build.
+# The JNI headers are taken from JAVA_HOME, and the headers that javac
+# generates for the natives from the graphics module build, so the SDK must
+# have been built first. Both can be overridden, as can CC and CXX:
+#
+#   JAVA_HOME=/path/to/jdk sh build.sh
+#   GRAPHICS_HEADERS=/path/to/headers sh build.sh
+
+set -e
+
+BENCH_DIR=$(cd "$(dirname "$0")" && pwd)
+RT_DIR=$(cd "$BENCH_DIR/../../../.." && pwd)
+MODULES="$RT_DIR/modules"
+GRAPHICS="$MODULES/javafx.graphics/src/main"
+MEDIA="$MODULES/javafx.media/src/main/native/jfxmedia"
+
+: "${JAVA_HOME:?JAVA_HOME must point to the JDK}"
+: "${GRAPHICS_HEADERS:=$MODULES/javafx.graphics/build/gensrc/headers/javafx.graphics}"
+: "${CC:=gcc}"
+: "${CXX:=g++}"
+
+OS=$(uname -s | tr '[:upper:]' '[:lower:]')
+FLAGS="-O2 -DNDEBUG -fno-strict-aliasing -Wall -Wno-unused -Wno-parentheses \
+    -I$JAVA_HOME/include -I$JAVA_HOME/include/$OS -I$GRAPHICS_HEADERS"
+FREETYPE_FLAGS=$(pkg-config --cflags freetype2)
+FREETYPE_LIBS=$(pkg-config --libs freetype2)
+
+OUT="$BENCH_DIR/build"
+rm -rf "$OUT"
+mkdir -p "$OUT"
+
+cc() {
+    $CC $FLAGS "$@" -c -o "$OUT/$(basename "$1").o"
+}
+
+cxx() {
+    $CXX $FLAGS "$@" -c -o "$OUT/$(basename "$1").o"
+}
+
+for f in NativeBenchmark.c FakeJNIEnv.c; do
+    cc "$BENCH_DIR/src/$f"
+done
+
+cc "$BENCH_DIR/src/PiscesBenchmarks.c" -DINLINE=inline -I"$GRAPHICS/native-prism-sw"
+for f in PiscesBlit.c PiscesPaint.c PiscesSimd.c PiscesTransform.c PiscesUtil.c \
+         PiscesMath.c PiscesSysutils.c; do
+    cc "$GRAPHICS/native-prism-sw/$f" -DINLINE=inline -I"$GRAPHICS/native-prism-sw"
+done
+
+cxx "$BENCH_DIR/src/DecoraBenchmarks.cc" -I"$GRAPHICS/native-decora"
+for f in SSEBoxBlurPeer.cc SSEBoxShadowPeer.cc SSESimd.cc SSEUtils.cc; do
+    cxx "$GRAPHICS/native-decora/$f" -ffast-math
+done
+
+cc "$BENCH_DIR/src/MediaBenchmarks.c" -DLINUX -I"$MEDIA"
+cc "$MEDIA/Utils/ColorConverter.c" -DLINUX -I"$MEDIA"
+
+cc "$BENCH_DIR/src/FontBenchmarks.c" $FREETYPE_FLAGS
+cc "$GRAPHICS/native-font/freetype.c" -D_ENABLE_HARFBUZZ $FREETYPE_FLAGS
+
+$CXX -o "$OUT/nativebench" "$OUT"/*.o $FREETYPE_LIBS -ldl -lm
+echo "Built $OUT/nativebench"
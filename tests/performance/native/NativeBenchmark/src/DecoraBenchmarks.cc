@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * The horizontal and vertical passes of the SSE box blur and box shadow
+ * peers, each run over the whole image as one band, with the growth that
+ * a 9 pixel box blurred three times gives.
+ */
+
+#include "NativeBenchmark.h"
+#include "FakeJNIEnv.h"
+
+#include <SSESimd.h>
+#include "com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer.h"
+#include "com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BOX_INC 8
+#define ITERATIONS 3
+#define GROWTH ((BOX_INC * ITERATIONS + 1) & ~1)
+
+enum { BLUR_H, BLUR_V, SHADOW_H, SHADOW_V };
+
+struct DecoraArgs {
+    const char *name;
+    int pass;
+};
+
+static const DecoraArgs decoraArgs[] = {
+    { "boxblur/h",   BLUR_H   },
+    { "boxblur/v",   BLUR_V   },
+    { "boxshadow/h", SHADOW_H },
+    { "boxshadow/v", SHADOW_V },
+};
+
+static const jint sizes[][2] = { { 64, 64 }, { 512, 512 } };
+
+struct DecoraSetUpArgs {
+    const DecoraArgs *args;
+    jint width;
+    jint height;
+};
+
+static DecoraSetUpArgs setUpArgs[sizeof(decoraArgs) / sizeof(decoraArgs[0])]
+                                [sizeof(sizes) / sizeof(sizes[0])];
+
+struct DecoraState {
+    const DecoraArgs *args;
+    jint srcw, srch, dstw, dsth;
+    jint *srcPixels;
+    jint *dstPixels;
+    jarray src;
+    jarray dst;
+    jfloat shadowColor[4];
+    jarray shadow;
+};
+
+static bool isHorizontal(int pass)
+{
+    return pass == BLUR_H || pass == SHADOW_H;
+}
+
+static void *decoraSetUp(const void *arg)
+{
+    const DecoraSetUpArgs *a = (const DecoraSetUpArgs *)arg;
+    DecoraState *s = (DecoraState *)calloc(1, sizeof(DecoraState));
+    bool horizontal = isHorizontal(a->args->pass);
+
+    s->args = a->args;
+    s->srcw = a->width;
+    s->srch = a->height;
+    s->dstw = horizontal ? a->width + GROWTH : a->width;
+    s->dsth = horizontal ? a->height : a->height + GROWTH;
+    s->srcPixels = (jint *)calloc((size_t)s->srcw * s->srch, sizeof(jint));
+    s->dstPixels = (jint *)calloc((size_t)s->dstw * s->dsth, sizeof(jint));
+    // An antialiased disc on a transparent background
+    for (jint y = 0; y < s->srch; y++) {
+        for (jint x = 0; x < s->srcw; x++) {
+            jint dx = 2 * x - s->srcw;
+            jint dy = 2 * y - s->srch;
+            jint d = s->srcw * s->srcw - dx * dx - dy * dy;
+            jint alpha = d <= 0 ? 0 : (d >= 4 * s->srcw ? 255 : d * 255 / (4 * s->srcw));
+            s->srcPixels[y * s->srcw + x] = (alpha << 24) | ((alpha * 3 / 4) << 16) | (alpha / 2);
+        }
+    }
+    s->src = fakeJNIArray(s->srcPixels, s->srcw * s->srch);
+    s->dst = fakeJNIArray(s->dstPixels, s->dstw * s->dsth);
+    s->shadowColor[3] = 1.0f;
+    s->shadow = fakeJNIArray(s->shadowColor, 4);
+    return s;
+}
+
+static void decoraRun(void *state)
+{
+    DecoraState *s = (DecoraState *)state;
+    JNIEnv *env = fakeJNIEnv();
+
+    switch (s->args->pass) {
+    case BLUR_H:
+        Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontalBand(
+            env, NULL, (jintArray)s->dst, s->dstw, s->dsth, s->dstw,
+            (jintArray)s->src, s->srcw, s->srch, s->srcw, BOX_INC, 0, s->dsth);
+        break;
+    case BLUR_V:
+        Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVerticalBand(
+            env, NULL, (jintArray)s->dst, s->dstw, s->dsth, s->dstw,
+            (jintArray)s->src, s->srcw, s->srch, s->srcw, BOX_INC, 0, s->dstw);
+        break;
+    case SHADOW_H:
+        Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBand(
+            env, NULL, (jintArray)s->dst, s->dstw, s->dsth, s->dstw,
+            (jintArray)s->src, s->srcw, s->srch, s->srcw, BOX_INC, ITERATIONS, 0.0f,
+            0, s->dsth);
+        break;
+    case SHADOW_V:
+        Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBand(
+            env, NULL, (jintArray)s->dst, s->dstw, s->dsth, s->dstw,
+            (jintArray)s->src, s->srcw, s->srch, s->srcw, BOX_INC, ITERATIONS, 0.0f,
+            (jfloatArray)s->shadow, 0, s->dstw);
+        break;
+    }
+}
+
+static void decoraTearDown(void *state)
+{
+    DecoraState *s = (DecoraState *)state;
+    fakeJNIFreeArray(s->src);
+    fakeJNIFreeArray(s->dst);
+    fakeJNIFreeArray(s->shadow);
+    free(s->srcPixels);
+    free(s->dstPixels);
+    free(s);
+}
+
+void registerDecoraBenchmarks(const char *simd)
+{
+    printf("# decora: %s\n", selectSIMDLevel(simd));
+    for (size_t i = 0; i < sizeof(decoraArgs) / sizeof(decoraArgs[0]); i++) {
+        for (size_t j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+            DecoraSetUpArgs *a = &setUpArgs[i][j];
+            a->args = &decoraArgs[i];
+            a->width = sizes[j][0];
+            a->height = sizes[j][1];
+            bool horizontal = isHorizontal(a->args->pass);
+            long pixels = (long)(a->width + (horizontal ? GROWTH : 0)) *
+                          (a->height + (horizontal ? 0 : GROWTH));
+            addBenchmark(decoraSetUp, decoraRun, decoraTearDown, a, pixels, "px",
+                         "decora/%s/%dx%d", a->args->name, a->width, a->height);
+        }
+    }
+}
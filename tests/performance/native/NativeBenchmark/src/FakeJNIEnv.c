@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "FakeJNIEnv.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct _FakeArray {
+    void *data;
+    jsize length;
+    struct _FakeArray *nextLocal;
+} FakeArray;
+
+static FakeArray *locals;
+static char dummy;
+
+jarray fakeJNIArray(void *data, jsize length)
+{
+    FakeArray *array = (FakeArray *)calloc(1, sizeof(FakeArray));
+    array->data = data;
+    array->length = length;
+    return (jarray)array;
+}
+
+void fakeJNIFreeArray(jarray array)
+{
+    free(array);
+}
+
+void fakeJNIFreeLocals(void)
+{
+    while (locals != NULL) {
+        FakeArray *next = locals->nextLocal;
+        free(locals);
+        locals = next;
+    }
+}
+
+static jarray newArray(jsize length, size_t size)
+{
+    // The elements follow the header, so that one free releases both
+    FakeArray *array = (FakeArray *)malloc(sizeof(FakeArray) + length * size);
+    if (array == NULL) {
+        return NULL;
+    }
+    array->data = array + 1;
+    array->length = length;
+    array->nextLocal = locals;
+    locals = array;
+    return (jarray)array;
+}
+
+static void *JNICALL GetPrimitiveArrayCritical(JNIEnv *env, jarray array, jboolean *isCopy)
+{
+    if (isCopy != NULL) {
+        *isCopy = JNI_FALSE;
+    }
+    return ((FakeArray *)array)->data;
+}
+
+static void JNICALL ReleasePrimitiveArrayCritical(JNIEnv *env, jarray array, void *carray, jint mode)
+{
+}
+
+static jsize JNICALL GetArrayLength(JNIEnv *env, jarray array)
+{
+    return ((FakeArray *)array)->length;
+}
+
+static void JNICALL GetFloatArrayRegion(JNIEnv *env, jfloatArray array, jsize start, jsize len, jfloat *buf)
+{
+    memcpy(buf, (jfloat *)((FakeArray *)array)->data + start, len * sizeof(jfloat));
+}
+
+static void JNICALL SetFloatArrayRegion(JNIEnv *env, jfloatArray array, jsize start, jsize len, const jfloat *buf)
+{
+    memcpy((jfloat *)((FakeArray *)array)->data + start, buf, len * sizeof(jfloat));
+}
+
+static void JNICALL SetByteArrayRegion(JNIEnv *env, jbyteArray array, jsize start, jsize len, const jbyte *buf)
+{
+    memcpy((jbyte *)((FakeArray *)array)->data + start, buf, len);
+}
+
+static jbyteArray JNICALL NewByteArray(JNIEnv *env, jsize len)
+{
+    return (jbyteArray)newArray(len, sizeof(jbyte));
+}
+
+static jfloatArray JNICALL NewFloatArray(JNIEnv *env, jsize len)
+{
+    return (jfloatArray)newArray(len, sizeof(jfloat));
+}
+
+static jclass JNICALL FindClass(JNIEnv *env, const char *name)
+{
+    return (jclass)&dummy;
+}
+
+static jobject JNICALL NewGlobalRef(JNIEnv *env, jobject obj)
+{
+    return obj;
+}
+
+static jmethodID JNICALL GetMethodID(JNIEnv *env, jclass clazz, const char *name, const char *sig)
+{
+    return (jmethodID)&dummy;
+}
+
+static jthrowable JNICALL ExceptionOccurred(JNIEnv *env)
+{
+    return NULL;
+}
+
+static void JNICALL ExceptionClear(JNIEnv *env)
+{
+}
+
+static jobject JNICALL NewObject(JNIEnv *env, jclass clazz, jmethodID methodID, ...)
+{
+    return (jobject)&dummy;
+}
+
+static const struct JNINativeInterface_ fakeFunctions = {
+    .GetPrimitiveArrayCritical = GetPrimitiveArrayCritical,
+    .ReleasePrimitiveArrayCritical = ReleasePrimitiveArrayCritical,
+    .GetArrayLength = GetArrayLength,
+    .GetFloatArrayRegion = GetFloatArrayRegion,
+    .SetFloatArrayRegion = SetFloatArrayRegion,
+    .SetByteArrayRegion = SetByteArrayRegion,
+    .NewByteArray = NewByteArray,
+    .NewFloatArray = NewFloatArray,
+    .FindClass = FindClass,
+    .NewGlobalRef = NewGlobalRef,
+    .GetMethodID = GetMethodID,
+    .ExceptionOccurred = ExceptionOccurred,
+    .ExceptionClear = ExceptionClear,
+    .NewObject = NewObject,
+};
+
+static const struct JNINativeInterface_ *fakeEnv = &fakeFunctions;
+
+JNIEnv *fakeJNIEnv(void)
+{
+    // In C++ JNIEnv is a struct that holds the function table pointer
+    // first, so a pointer to the table pointer serves both languages.
+    return (JNIEnv *)&fakeEnv;
+}
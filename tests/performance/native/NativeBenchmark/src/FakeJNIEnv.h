@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef FAKE_JNI_ENV_H
+#define FAKE_JNI_ENV_H
+
+#include <jni.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A JNIEnv with just enough functions for the JNI entry points that are
+ * benchmarked. Arrays are plain buffers, classes, methods and objects are
+ * dummies, and no exception is ever pending.
+ */
+JNIEnv *fakeJNIEnv(void);
+
+/* Wraps length elements at data as a Java array, without copying them */
+jarray fakeJNIArray(void *data, jsize length);
+void fakeJNIFreeArray(jarray array);
+
+/*
+ * Frees the arrays that the entry points created since the last call, as
+ * the garbage collector would.
+ */
+void fakeJNIFreeLocals(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAKE_JNI_ENV_H */
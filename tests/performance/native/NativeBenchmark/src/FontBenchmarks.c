@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * The outline decomposition of the Freetype glyphs, which turns the
+ * loaded outline of a glyph into the types and coordinates of a Path2D.
+ */
+
+#include "NativeBenchmark.h"
+#include "FakeJNIEnv.h"
+
+#include <com_sun_javafx_font_freetype_OSFreetype.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// The size that outlines are loaded at for shapes and large text
+#define GLYPH_SIZE 48
+
+static const char *defaultFonts[] = {
+    "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+    "/usr/share/fonts/liberation/LiberationSans-Regular.ttf",
+};
+
+static const char glyphs[] = { 'o', 'g', '&', '@' };
+
+static FT_Library library;
+static FT_Face face;
+
+static void *fontSetUp(const void *arg)
+{
+    FT_UInt index = FT_Get_Char_Index(face, *(const char *)arg);
+    if (FT_Load_Glyph(face, index, FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING) != 0) {
+        return NULL;
+    }
+    return face;
+}
+
+static void fontRun(void *state)
+{
+    Java_com_sun_javafx_font_freetype_OSFreetype_FT_1Outline_1Decompose(
+        fakeJNIEnv(), NULL, (jlong)(intptr_t)state);
+    fakeJNIFreeLocals();
+}
+
+static void fontTearDown(void *state)
+{
+}
+
+void registerFontBenchmarks(const char *simd, const char *fontFile)
+{
+    size_t i;
+
+    if (FT_Init_FreeType(&library) != 0) {
+        return;
+    }
+    for (i = 0; fontFile == NULL && i < sizeof(defaultFonts) / sizeof(defaultFonts[0]); i++) {
+        if (FT_New_Face(library, defaultFonts[i], 0, &face) == 0) {
+            fontFile = defaultFonts[i];
+        }
+    }
+    if (face == NULL && (fontFile == NULL || FT_New_Face(library, fontFile, 0, &face) != 0)) {
+        printf("# font: none found, pass one with --font\n");
+        return;
+    }
+    printf("# font: %s\n", fontFile);
+    FT_Set_Pixel_Sizes(face, 0, GLYPH_SIZE);
+
+    for (i = 0; i < sizeof(glyphs); i++) {
+        if (fontSetUp(&glyphs[i]) != NULL) {
+            addBenchmark(fontSetUp, fontRun, fontTearDown, &glyphs[i],
+                         face->glyph->outline.n_points, "pt",
+                         "font/outline/%c/%dpx", glyphs[i], GLYPH_SIZE);
+        }
+    }
+}
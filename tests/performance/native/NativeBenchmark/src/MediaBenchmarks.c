@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * The YCbCr to RGB converters of jfxmedia, called on frames laid out as
+ * GstVideoFrame passes them: planar 4:2:0 and packed 4:2:2 (UYVY).
+ */
+
+#include "NativeBenchmark.h"
+
+#include <Common/ProductFlags.h>
+#include <Utils/ColorConverter.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define I420_BGRA       0
+#define I420_ARGB       1
+#define I420_ALPHA_BGRA 2
+#define UYVY_BGRA       3
+
+typedef struct {
+    const char *name;
+    int format;
+} MediaArgs;
+
+static const MediaArgs mediaArgs[] = {
+    { "i420-bgra",       I420_BGRA       },
+    { "i420-argb",       I420_ARGB       },
+    { "i420-alpha-bgra", I420_ALPHA_BGRA },
+    { "uyvy-bgra",       UYVY_BGRA       },
+};
+
+static const int sizes[][2] = { { 640, 360 }, { 1920, 1080 } };
+
+typedef struct {
+    const MediaArgs *args;
+    int width;
+    int height;
+} MediaSetUpArgs;
+
+static MediaSetUpArgs setUpArgs[sizeof(mediaArgs) / sizeof(mediaArgs[0])]
+                               [sizeof(sizes) / sizeof(sizes[0])];
+
+typedef struct {
+    const MediaArgs *args;
+    int width;
+    int height;
+    // Luma and alpha planes, or the packed frame
+    uint8_t *y;
+    uint8_t *a;
+    uint8_t *u;
+    uint8_t *v;
+    int yStride;
+    int uvStride;
+    uint8_t *dst;
+} MediaState;
+
+static uint8_t *newPlane(int stride, int rows, int seed)
+{
+    uint8_t *plane = (uint8_t *)malloc((size_t)stride * rows);
+    int i;
+    for (i = 0; i < stride * rows; i++) {
+        plane[i] = (uint8_t)(16 + (i * seed + i / stride) % 220);
+    }
+    return plane;
+}
+
+static void *mediaSetUp(const void *arg)
+{
+    const MediaSetUpArgs *a = (const MediaSetUpArgs *)arg;
+    MediaState *s = (MediaState *)calloc(1, sizeof(MediaState));
+
+    s->args = a->args;
+    s->width = a->width;
+    s->height = a->height;
+    if (a->args->format == UYVY_BGRA) {
+        s->yStride = a->width * 2;
+        s->uvStride = s->yStride;
+        s->y = newPlane(s->yStride, a->height, 7);
+    } else {
+        s->yStride = a->width;
+        s->uvStride = a->width / 2;
+        s->y = newPlane(s->yStride, a->height, 7);
+        s->u = newPlane(s->uvStride, a->height / 2, 3);
+        s->v = newPlane(s->uvStride, a->height / 2, 5);
+        if (a->args->format == I420_ALPHA_BGRA) {
+            s->a = newPlane(s->yStride, a->height, 11);
+        }
+    }
+    s->dst = (uint8_t *)malloc((size_t)a->width * 4 * a->height);
+    return s;
+}
+
+static void mediaRun(void *state)
+{
+    MediaState *s = (MediaState *)state;
+    int stride = s->width * 4;
+
+    switch (s->args->format) {
+    case I420_BGRA:
+        ColorConvert_YCbCr420p_to_BGRA32_no_alpha(s->dst, stride, s->width, s->height,
+                                                  s->y, s->v, s->u,
+                                                  s->yStride, s->uvStride, s->uvStride);
+        break;
+    case I420_ARGB:
+        ColorConvert_YCbCr420p_to_ARGB32_no_alpha(s->dst, stride, s->width, s->height,
+                                                  s->y, s->v, s->u,
+                                                  s->yStride, s->uvStride, s->uvStride);
+        break;
+    case I420_ALPHA_BGRA:
+        ColorConvert_YCbCr420p_to_BGRA32(s->dst, stride, s->width, s->height,
+                                         s->y, s->v, s->u, s->a,
+                                         s->yStride, s->uvStride, s->uvStride, s->yStride);
+        break;
+    case UYVY_BGRA:
+        ColorConvert_YCbCr422p_to_BGRA32_no_alpha(s->dst, stride, s->width, s->height,
+                                                  s->y + 1, s->y + 2, s->y,
+                                                  s->yStride, s->uvStride);
+        break;
+    }
+}
+
+static void mediaTearDown(void *state)
+{
+    MediaState *s = (MediaState *)state;
+    free(s->y);
+    free(s->a);
+    free(s->u);
+    free(s->v);
+    free(s->dst);
+    free(s);
+}
+
+void registerMediaBenchmarks(const char *simd)
+{
+    size_t i, j;
+
+    // The converters are vectorized at compile time
+    for (i = 0; i < sizeof(mediaArgs) / sizeof(mediaArgs[0]); i++) {
+        for (j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+            MediaSetUpArgs *a = &setUpArgs[i][j];
+            a->args = &mediaArgs[i];
+            a->width = sizes[j][0];
+            a->height = sizes[j][1];
+            addBenchmark(mediaSetUp, mediaRun, mediaTearDown, a,
+                         (long)a->width * a->height, "px",
+                         "media/%s/%dx%d", a->args->name, a->width, a->height);
+        }
+    }
+}
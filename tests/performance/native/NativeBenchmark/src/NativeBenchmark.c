@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * NativeBenchmark measures the native pixel kernels of JavaFX without a
+ * JVM: the Pisces blitters and gradient generators, the SSE box blur and
+ * box shadow peers of Decora, the YCbCr to RGB converters of jfxmedia and
+ * the Freetype outline decomposition. The kernels are compiled from the
+ * module sources and called the way their JNI entry points call them, the
+ * JNI ones with the FakeJNIEnv of this directory.
+ *
+ * Every benchmark works on data of a fixed size. It is called until it has
+ * run for a while to warm up, then timed for a number of samples, and the
+ * median time per call and per pixel (or outline point) is printed, so the
+ * numbers of two builds or instruction sets can be compared directly.
+ *
+ * Build it with build.sh after building the SDK, then run:
+ *
+ *   nativebench [--simd=scalar|sse2|sse4.1|avx2|neon] [--font=file.ttf]
+ *               [--samples=n] [--list] [filter...]
+ *
+ * Only the benchmarks whose name contains one of the filters are run. The
+ * --simd level is passed to the Pisces and Decora kernels, which keep their
+ * best one if they do not know it or the processor lacks it; the media
+ * converters pick theirs at compile time.
+ */
+
+#include "NativeBenchmark.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_BENCHMARKS 256
+#define MAX_SAMPLES 99
+// Each sample runs for at least this long
+#define SAMPLE_NANOS 20000000LL
+#define WARMUP_NANOS 200000000LL
+
+typedef struct {
+    char name[64];
+    BenchmarkSetUp setUp;
+    BenchmarkRun run;
+    BenchmarkTearDown tearDown;
+    const void *arg;
+    long units;
+    const char *unit;
+} Benchmark;
+
+static Benchmark benchmarks[MAX_BENCHMARKS];
+static int numBenchmarks;
+
+void addBenchmark(BenchmarkSetUp setUp, BenchmarkRun run,
+                  BenchmarkTearDown tearDown, const void *arg,
+                  long units, const char *unit, const char *nameFormat, ...)
+{
+    Benchmark *b;
+    va_list args;
+
+    if (numBenchmarks == MAX_BENCHMARKS) {
+        fprintf(stderr, "Too many benchmarks\n");
+        exit(1);
+    }
+    b = &benchmarks[numBenchmarks++];
+    va_start(args, nameFormat);
+    vsnprintf(b->name, sizeof(b->name), nameFormat, args);
+    va_end(args);
+    b->setUp = setUp;
+    b->run = run;
+    b->tearDown = tearDown;
+    b->arg = arg;
+    b->units = units;
+    b->unit = unit;
+}
+
+static long long nanoTime(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static long long timeCalls(Benchmark *b, void *state, long calls)
+{
+    long long start = nanoTime();
+    long i;
+    for (i = 0; i < calls; i++) {
+        b->run(state);
+    }
+    return nanoTime() - start;
+}
+
+static int compareTimes(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void runBenchmark(Benchmark *b, int samples)
+{
+    double times[MAX_SAMPLES];
+    void *state = b->setUp(b->arg);
+    long calls = 1;
+    long long elapsed;
+    double median;
+    int i;
+
+    if (state == NULL) {
+        printf("%-44s skipped\n", b->name);
+        return;
+    }
+
+    // Warm up and find how many calls make a sample
+    elapsed = timeCalls(b, state, calls);
+    for (long long warm = elapsed; warm < WARMUP_NANOS || elapsed < SAMPLE_NANOS; warm += elapsed) {
+        if (elapsed < SAMPLE_NANOS) {
+            calls *= 2;
+        }
+        elapsed = timeCalls(b, state, calls);
+    }
+
+    for (i = 0; i < samples; i++) {
+        times[i] = (double)timeCalls(b, state, calls) / calls;
+    }
+    qsort(times, samples, sizeof(double), compareTimes);
+    median = times[samples / 2];
+
+    printf("%-44s %12.2f us %10.3f ns/%s\n", b->name,
+           median / 1000.0, median / b->units, b->unit);
+    fflush(stdout);
+
+    b->tearDown(state);
+}
+
+static int matches(const char *name, int numFilters, char **filters)
+{
+    int i;
+    if (numFilters == 0) {
+        return 1;
+    }
+    for (i = 0; i < numFilters; i++) {
+        if (strstr(name, filters[i]) != NULL) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *simd = NULL;
+    const char *fontFile = NULL;
+    int samples = 9;
+    int list = 0;
+    int numFilters = 0;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--simd=", 7) == 0) {
+            simd = argv[i] + 7;
+        } else if (strncmp(argv[i], "--font=", 7) == 0) {
+            fontFile = argv[i] + 7;
+        } else if (strncmp(argv[i], "--samples=", 10) == 0) {
+            samples = atoi(argv[i] + 10);
+            if (samples < 1 || samples > MAX_SAMPLES) {
+                fprintf(stderr, "The number of samples must be 1 to %d\n", MAX_SAMPLES);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--list") == 0) {
+            list = 1;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        } else {
+            argv[numFilters++] = argv[i];
+        }
+    }
+
+    registerPiscesBenchmarks(simd);
+    registerDecoraBenchmarks(simd);
+    registerMediaBenchmarks(simd);
+    registerFontBenchmarks(simd, fontFile);
+
+    for (i = 0; i < numBenchmarks; i++) {
+        if (matches(benchmarks[i].name, numFilters, argv)) {
+            if (list) {
+                printf("%s\n", benchmarks[i].name);
+            } else {
+                runBenchmark(&benchmarks[i], samples);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef NATIVE_BENCHMARK_H
+#define NATIVE_BENCHMARK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A benchmark runs one kernel on fixed size data. setUp allocates and
+ * fills the data from arg and returns it as the state that run and
+ * tearDown get. Each call of run processes the given number of units
+ * (pixels or outline points), which the cost is reported per.
+ */
+typedef void *(*BenchmarkSetUp)(const void *arg);
+typedef void (*BenchmarkRun)(void *state);
+typedef void (*BenchmarkTearDown)(void *state);
+
+void addBenchmark(BenchmarkSetUp setUp, BenchmarkRun run,
+                  BenchmarkTearDown tearDown, const void *arg,
+                  long units, const char *unit, const char *nameFormat, ...);
+
+/*
+ * Each group registers its benchmarks, after selecting the requested
+ * instruction set (NULL for the best one) where its kernels allow it.
+ */
+void registerPiscesBenchmarks(const char *simd);
+void registerDecoraBenchmarks(const char *simd);
+void registerMediaBenchmarks(const char *simd);
+void registerFontBenchmarks(const char *simd, const char *fontFile);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_BENCHMARK_H */
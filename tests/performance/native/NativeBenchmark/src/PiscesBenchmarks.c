@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * The Pisces span blitters and gradient generators, fed one row of
+ * coverage at a time as emitAndClearAlphaRowImpl in JPiscesRenderer.c
+ * feeds them.
+ */
+
+#include "NativeBenchmark.h"
+
+#include <PiscesRenderer.inl>
+#include <PiscesSimd.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// The coverage of a pixel with 8x8 subpixel positions
+#define MAX_COVERAGE 64
+
+#define FLAT_COLOR 0
+#define LINEAR_GRADIENT 1
+#define RADIAL_GRADIENT 2
+#define CLEAR 3
+
+typedef struct {
+    const char *name;
+    jint paint;
+    jint alpha;
+    jint coverage;
+} PiscesArgs;
+
+static const PiscesArgs piscesArgs[] = {
+    { "fill/opaque",      FLAT_COLOR,      255, MAX_COVERAGE     },
+    { "fill/translucent", FLAT_COLOR,      128, MAX_COVERAGE     },
+    { "fill/aa",          FLAT_COLOR,      255, MAX_COVERAGE / 2 },
+    { "linear",           LINEAR_GRADIENT, 255, MAX_COVERAGE     },
+    { "linear/aa",        LINEAR_GRADIENT, 255, MAX_COVERAGE / 2 },
+    { "radial",           RADIAL_GRADIENT, 255, MAX_COVERAGE     },
+    { "clear",            CLEAR,           0,   0                },
+};
+
+static const jint sizes[][2] = { { 32, 32 }, { 512, 512 } };
+
+typedef struct {
+    const PiscesArgs *args;
+    Surface surface;
+    Renderer *rdr;
+    jint *alphaRow;
+    jbyte alphaMap[MAX_COVERAGE + 1];
+} PiscesState;
+
+typedef struct {
+    const PiscesArgs *args;
+    jint width;
+    jint height;
+} PiscesSetUpArgs;
+
+static PiscesSetUpArgs setUpArgs[sizeof(piscesArgs) / sizeof(piscesArgs[0])]
+                                [sizeof(sizes) / sizeof(sizes[0])];
+
+static void *piscesSetUp(const void *arg)
+{
+    const PiscesSetUpArgs *a = (const PiscesSetUpArgs *)arg;
+    PiscesState *s = (PiscesState *)calloc(1, sizeof(PiscesState));
+    Transform6 identity = { 65536, 0, 0, 65536, 0, 0 };
+    jint ramp[GRADIENT_MAP_SIZE];
+    jint w = a->width;
+    jint h = a->height;
+    jint i;
+
+    s->args = a->args;
+    s->surface.width = w;
+    s->surface.height = h;
+    s->surface.scanlineStride = w;
+    s->surface.pixelStride = 1;
+    s->surface.imageType = TYPE_INT_ARGB_PRE;
+    s->surface.data = calloc((size_t)w * h, sizeof(jint));
+    s->alphaRow = (jint *)calloc(w + 2, sizeof(jint));
+    for (i = 0; i <= MAX_COVERAGE; i++) {
+        s->alphaMap[i] = (jbyte)(i * 255 / MAX_COVERAGE);
+    }
+    for (i = 0; i < GRADIENT_MAP_SIZE; i++) {
+        ramp[i] = 0xff000000 | (i << 16) | ((255 - i) << 8) | 0x80;
+    }
+
+    s->rdr = renderer_create(&s->surface);
+    renderer_setColor(s->rdr, 0x20, 0x80, 0xc0, a->args->alpha);
+    s->rdr->_gradient_cycleMethod = CYCLE_REFLECT;
+    if (a->args->paint == LINEAR_GRADIENT) {
+        renderer_setLinearGradient(s->rdr, 0, 0, (w / 2) << 16, (h / 4) << 16,
+                                   ramp, &identity);
+    } else if (a->args->paint == RADIAL_GRADIENT) {
+        renderer_setRadialGradient(s->rdr, (w / 2) << 16, (h / 2) << 16,
+                                   (w / 3) << 16, (h / 3) << 16, (w / 2) << 16,
+                                   ramp, &identity);
+    }
+    return s;
+}
+
+static void piscesRun(void *state)
+{
+    PiscesState *s = (PiscesState *)state;
+    Renderer *rdr = s->rdr;
+    jint w = s->surface.width;
+    jint y;
+
+    if (s->args->paint == CLEAR) {
+        INVALIDATE_RENDERER_SURFACE(rdr);
+        rdr->_imagePixelStride = 1;
+        rdr->_imageScanlineStride = w;
+        renderer_clearRect(rdr, 0, 0, w, s->surface.height);
+        return;
+    }
+
+    for (y = 0; y < s->surface.height; y++) {
+        INVALIDATE_RENDERER_SURFACE(rdr);
+        VALIDATE_BLITTING(rdr);
+
+        // A span over the whole row, the blitters clear the deltas
+        s->alphaRow[0] = s->args->coverage;
+
+        rdr->_minTouched = 0;
+        rdr->_maxTouched = w - 1;
+        rdr->_currX = 0;
+        rdr->_currY = y;
+        rdr->_rowNum = y;
+        rdr->alphaMap = s->alphaMap;
+        rdr->_rowAAInt = s->alphaRow;
+        rdr->_alphaWidth = w;
+        rdr->_currImageOffset = y * w;
+        rdr->_imageScanlineStride = w;
+        rdr->_imagePixelStride = 1;
+
+        if (rdr->_genPaint) {
+            ALLOC3(rdr->_paint, jint, w);
+            rdr->_genPaint(rdr, 1);
+        }
+        rdr->_emitRows(rdr, 1);
+        rdr->_rowAAInt = NULL;
+    }
+}
+
+static void piscesTearDown(void *state)
+{
+    PiscesState *s = (PiscesState *)state;
+    renderer_dispose(s->rdr);
+    free(s->surface.data);
+    free(s->alphaRow);
+    free(s);
+}
+
+void registerPiscesBenchmarks(const char *simd)
+{
+    size_t i, j;
+
+    printf("# pisces: %s\n", piscesSelectSIMDLevel(simd));
+    for (i = 0; i < sizeof(piscesArgs) / sizeof(piscesArgs[0]); i++) {
+        for (j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+            PiscesSetUpArgs *a = &setUpArgs[i][j];
+            a->args = &piscesArgs[i];
+            a->width = sizes[j][0];
+            a->height = sizes[j][1];
+            addBenchmark(piscesSetUp, piscesRun, piscesTearDown, a,
+                         (long)a->width * a->height, "px",
+                         "pisces/%s/%dx%d", a->args->name, a->width, a->height);
+        }
+    }
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package piscesbench;
+
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.function.IntFunction;
+import java.util.function.Supplier;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Node;
+import javafx.scene.Scene;
+import javafx.scene.SnapshotParameters;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.CycleMethod;
+import javafx.scene.paint.LinearGradient;
+import javafx.scene.paint.Paint;
+import javafx.scene.paint.RadialGradient;
+import javafx.scene.paint.Stop;
+import javafx.scene.shape.Circle;
+import javafx.scene.shape.Rectangle;
+import javafx.scene.text.Font;
+import javafx.scene.text.Text;
+import javafx.stage.Stage;
+
+/**
+ * {@link PiscesBenchmark} measures the speed of the Pisces software
+ * rasterizer by taking snapshots of scenes made of many antialiased shapes.
+ *
+ * It must be run with the software pipeline. Each scene is snapshotted
+ * once to warm up and then for a fixed number of timed iterations; the
+ * median time per scene is printed and the application exits. To compare
+ * with the scalar span blenders, run it once as is and once with the
+ * vector blenders disabled:
+ *
+ * <pre>
+ *   java -Dprism.order=sw -Dprism.verbose=true --module-path $SDK/lib --add-modules javafx.graphics piscesbench.PiscesBenchmark
+ *   java -Dprism.order=sw -Dprism.sw.isa=scalar --module-path $SDK/lib --add-modules javafx.graphics piscesbench.PiscesBenchmark
+ * </pre>
+ *
+ * On x86 processors with AVX2, {@code -Dprism.sw.isa=sse2} selects the
+ * narrower vector blenders.
+ *
+ * Large axis-aligned fills are split into bands rendered on
+ * {@code prism.sw.threads} threads. The {@code fills} scene measures how
+ * that scales with the number of cores, e.g. at 4K:
+ *
+ * <pre>
+ *   for t in 1 2 4 8 12 16; do
+ *     java -Dprism.order=sw -Dprism.sw.threads=$t --module-path $SDK/lib --add-modules javafx.graphics piscesbench.PiscesBenchmark -s 3840x2160 -t fills
+ *   done
+ * </pre>
+ *
+ * Options:
+ * <ul>
+ * <li>{@code -i <n>} number of timed iterations (default 20)</li>
+ * <li>{@code -s <w>x<h>} size of the snapshotted scene (default 1920x1080)</li>
+ * <li>{@code -c <n>} number of shapes per scene (default 2000)</li>
+ * <li>{@code -t <name>} run only the named scene</li>
+ * </ul>
+ */
+public class PiscesBenchmark extends Application {
+
+    private static int iterations = 20;
+    private static int width = 1920;
+    private static int height = 1080;
+    private static int count = 2000;
+    private static String onlyScene;
+
+    public static void main(String[] args) {
+        for (int i = 0; i < args.length; i++) {
+            switch (args[i]) {
+                case "-i" -> iterations = Integer.parseInt(args[++i]);
+                case "-s" -> {
+                    String[] size = args[++i].split("x");
+                    width = Integer.parseInt(size[0]);
+                    height = Integer.parseInt(size[1]);
+                }
+                case "-c" -> count = Integer.parseInt(args[++i]);
+                case "-t" -> onlyScene = args[++i];
+                default -> {
+                    System.err.println("Usage: PiscesBenchmark [-i <iterations>] [-s <w>x<h>] [-c <shapes>] [-t <scene>]");
+                    System.exit(1);
+                }
+            }
+        }
+        launch(args);
+    }
+
+    private static Map<String, Supplier<Node>> scenes() {
+        Map<String, Supplier<Node>> scenes = new LinkedHashMap<>();
+        scenes.put("solidRects", () -> shapes(false, i -> translucent(i)));
+        scenes.put("solidCircles", () -> shapes(true, i -> translucent(i)));
+        scenes.put("linear", () -> shapes(false, i -> new LinearGradient(0, 0, 1, 1, true,
+                CycleMethod.NO_CYCLE, new Stop(0, translucent(i)), new Stop(1, translucent(i + 1)))));
+        scenes.put("radial", () -> shapes(true, i -> new RadialGradient(0, 0, 0.5, 0.5, 0.5, true,
+                CycleMethod.REFLECT, new Stop(0, translucent(i)), new Stop(1, translucent(i + 3)))));
+        scenes.put("text", PiscesBenchmark::text);
+        scenes.put("fills", PiscesBenchmark::fills);
+        return scenes;
+    }
+
+    private static Color translucent(int i) {
+        return Color.hsb(i * 37 % 360, 0.8, 0.9, 0.3 + (i % 7) / 10.0);
+    }
+
+    private static Group shapes(boolean circles, IntFunction<Paint> paints) {
+        Group group = new Group(new Rectangle(width, height, Color.WHITE));
+        for (int i = 0; i < count; i++) {
+            double x = (i * 97.3) % width;
+            double y = (i * 61.7) % height;
+            double size = 10 + i % 13 * 12;
+            if (circles) {
+                group.getChildren().add(new Circle(x, y, size / 2, paints.apply(i)));
+            } else {
+                Rectangle rect = new Rectangle(x + 0.3, y + 0.6, size, size * 0.7);
+                rect.setRotate(i % 45);
+                rect.setFill(paints.apply(i));
+                group.getChildren().add(rect);
+            }
+        }
+        return group;
+    }
+
+    private static Group fills() {
+        Group group = new Group(new Rectangle(width, height, Color.WHITE));
+        for (int i = 0; i < Math.max(count / 100, 1); i++) {
+            double inset = i % 5 * 8.5;
+            Rectangle rect = new Rectangle(inset, inset, width - 2 * inset, height - 2 * inset);
+            rect.setFill((i % 2 == 0) ? translucent(i) : new LinearGradient(0, 0, 0, 1, true,
+                    CycleMethod.NO_CYCLE, new Stop(0, translucent(i)), new Stop(1, translucent(i + 1))));
+            group.getChildren().add(rect);
+        }
+        return group;
+    }
+
+    private static Group text() {
+        Group group = new Group(new Rectangle(width, height, Color.WHITE));
+        Font font = Font.font(14);
+        for (double y = 16; y < height; y += 18) {
+            Text text = new Text(4, y, "The quick brown fox jumps over the lazy dog. ".repeat(width / 240 + 1));
+            text.setFont(font);
+            text.setFill(translucent((int) y));
+            group.getChildren().add(text);
+        }
+        return group;
+    }
+
+    @Override
+    public void start(Stage stage) {
+        stage.setScene(new Scene(new Group(), 320, 240));
+        stage.setTitle("PiscesBenchmark");
+        stage.show();
+        Platform.runLater(this::run);
+    }
+
+    private void run() {
+        System.out.println("prism.order=" + System.getProperty("prism.order", "default")
+                + ", prism.sw.isa=" + System.getProperty("prism.sw.isa", "default")
+                + ", prism.sw.threads=" + System.getProperty("prism.sw.threads", "default")
+                + ", size=" + width + "x" + height
+                + ", shapes=" + count
+                + ", iterations=" + iterations);
+        SnapshotParameters params = new SnapshotParameters();
+        double total = 0;
+        for (Map.Entry<String, Supplier<Node>> entry : scenes().entrySet()) {
+            String name = entry.getKey();
+            if (onlyScene != null && !onlyScene.equals(name)) {
+                continue;
+            }
+            Node content = entry.getValue().get();
+            WritableImage image = content.snapshot(params, null);
+            List<Double> times = new ArrayList<>();
+            for (int i = 0; i < iterations; i++) {
+                long start = System.nanoTime();
+                content.snapshot(params, image);
+                times.add((System.nanoTime() - start) / 1e6);
+            }
+            times.sort(null);
+            double median = times.get(times.size() / 2);
+            total += median;
+            System.out.println(String.format(Locale.ROOT, "%-12s %10.2f ms", name, median));
+        }
+        System.out.println(String.format(Locale.ROOT, "%-12s %10.2f ms", "total", total));
+        Platform.exit();
+    }
+}
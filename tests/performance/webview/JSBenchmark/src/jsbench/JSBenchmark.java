@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jsbench;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Locale;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * {@link JSBenchmark} measures the JavaScript execution speed of WebView
+ * with a set of CPU-bound kernels, to compare the JavaScriptCore tiers
+ * that a build and its runtime options enable.
+ *
+ * Each kernel runs once to warm up and then for a fixed number of timed
+ * iterations; the median time per kernel is printed and the application
+ * exits. To compare with the interpreter, run it once as is and once
+ * with the JIT disabled:
+ *
+ * <pre>
+ *   java --module-path $SDK/lib --add-modules javafx.web jsbench.JSBenchmark
+ *   java -Dcom.sun.webkit.useJIT=false --module-path $SDK/lib --add-modules javafx.web jsbench.JSBenchmark
+ * </pre>
+ *
+ * The optimizing tiers are enabled with {@code -Dcom.sun.webkit.useDFGJIT=true}
+ * and, on top of that, {@code -Dcom.sun.webkit.useFTLJIT=true}; use a larger
+ * iteration count for those so that the hot kernels reach the upper tiers.
+ *
+ * When WebAssembly is available, the {@code fib} and {@code sieve} kernels
+ * are also run as {@code wasmFib} and {@code wasmSieve} from an embedded
+ * module, so the two can be compared directly.
+ *
+ * Options:
+ * <ul>
+ * <li>{@code -i <n>} number of timed iterations (default 10)</li>
+ * <li>{@code -k <name>} run only the named kernel</li>
+ * </ul>
+ */
+public class JSBenchmark extends Application {
+
+    private static final String KERNELS = """
+        var kernels = {
+            fib: function () {
+                function fib(n) { return n < 2 ? n : fib(n - 1) + fib(n - 2); }
+                return fib(27);
+            },
+            sieve: function () {
+                var n = 2000000, flags = new Uint8Array(n + 1), count = 0;
+                for (var i = 2; i <= n; i++) {
+                    if (!flags[i]) {
+                        count++;
+                        for (var j = i * 2; j <= n; j += i) flags[j] = 1;
+                    }
+                }
+                return count;
+            },
+            matrix: function () {
+                var n = 120, a = new Float64Array(n * n), b = new Float64Array(n * n), c = new Float64Array(n * n);
+                for (var i = 0; i < n * n; i++) { a[i] = i % 7; b[i] = i % 11; }
+                for (var i = 0; i < n; i++)
+                    for (var k = 0; k < n; k++) {
+                        var aik = a[i * n + k];
+                        for (var j = 0; j < n; j++) c[i * n + j] += aik * b[k * n + j];
+                    }
+                return c[n * n - 1];
+            },
+            objects: function () {
+                var points = [];
+                for (var i = 0; i < 300000; i++) points.push({ x: i, y: i * 2, label: "p" + (i % 100) });
+                var sum = 0;
+                points.sort(function (p, q) { return q.y - p.y; });
+                for (var i = 0; i < points.length; i++) sum += points[i].x + points[i].label.length;
+                return sum;
+            },
+            strings: function () {
+                var parts = [];
+                for (var i = 0; i < 100000; i++) parts.push("item-" + i.toString(16));
+                var joined = parts.join(","), total = 0;
+                var fields = joined.split(",");
+                for (var i = 0; i < fields.length; i++) total += fields[i].charCodeAt(fields[i].length - 1);
+                return total + JSON.parse(JSON.stringify(fields)).length;
+            }
+        };
+        // fib and sieve from above, compiled to WebAssembly (with memory.fill).
+        var wasmModule = "AGFzbQEAAAABBgFgAX8BfwMDAgAABQMBACAHGAMDZmliAAAFc2lldmUAAQZtZW1vcnkCAAp/AhwAIABBAkgEfyAABSAAQQFrEAAgAEECaxAAagsLYAEDf0EAQQAgAEEBavwLAEECIQECQANAIAEgAEoNASABLQAARQRAIANBAWohAyABQQF0IQICQANAIAIgAEoNASACQQE6AAAgAiABaiECDAALCwsgAUEBaiEBDAALCyADCw==";
+        if (typeof WebAssembly === "object") {
+            var bytes = Uint8Array.from(atob(wasmModule), function (ch) { return ch.charCodeAt(0); });
+            var wasm = new WebAssembly.Instance(new WebAssembly.Module(bytes)).exports;
+            kernels.wasmFib = function () { return wasm.fib(27); };
+            kernels.wasmSieve = function () { return wasm.sieve(2000000); };
+        }
+        function runKernel(name) {
+            var start = performance.now();
+            kernels[name]();
+            return performance.now() - start;
+        }
+        """;
+
+    private static int iterations = 10;
+    private static String onlyKernel;
+
+    public static void main(String[] args) {
+        for (int i = 0; i < args.length; i++) {
+            switch (args[i]) {
+                case "-i" -> iterations = Integer.parseInt(args[++i]);
+                case "-k" -> onlyKernel = args[++i];
+                default -> {
+                    System.err.println("Usage: JSBenchmark [-i <iterations>] [-k <kernel>]");
+                    System.exit(1);
+                }
+            }
+        }
+        launch(args);
+    }
+
+    @Override
+    public void start(Stage stage) {
+        WebView webView = new WebView();
+        WebEngine engine = webView.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((obs, oldState, newState) -> {
+            if (newState == Worker.State.SUCCEEDED) {
+                // Let the page settle before timing anything.
+                Platform.runLater(() -> run(engine));
+            }
+        });
+        engine.loadContent("<html><body><script>" + KERNELS + "</script></body></html>");
+        stage.setScene(new Scene(webView, 320, 240));
+        stage.setTitle("JSBenchmark");
+        stage.show();
+    }
+
+    private void run(WebEngine engine) {
+        System.out.println("useJIT=" + System.getProperty("com.sun.webkit.useJIT", "true")
+                + ", useDFGJIT=" + System.getProperty("com.sun.webkit.useDFGJIT", "false")
+                + ", useFTLJIT=" + System.getProperty("com.sun.webkit.useFTLJIT", "false")
+                + ", iterations=" + iterations
+                + ", wasm=" + engine.executeScript("typeof WebAssembly === 'object'"));
+        Object names = engine.executeScript("Object.keys(kernels).join(',')");
+        double total = 0;
+        for (String name : ((String) names).split(",")) {
+            if (onlyKernel != null && !onlyKernel.equals(name)) {
+                continue;
+            }
+            engine.executeScript("runKernel('" + name + "')");
+            List<Double> times = new ArrayList<>();
+            for (int i = 0; i < iterations; i++) {
+                times.add(((Number) engine.executeScript("runKernel('" + name + "')")).doubleValue());
+            }
+            times.sort(null);
+            double median = times.get(times.size() / 2);
+            total += median;
+            System.out.println(String.format(Locale.ROOT, "%-10s %10.2f ms", name, median));
+        }
+        System.out.println(String.format(Locale.ROOT, "%-10s %10.2f ms", "total", total));
+        Platform.exit();
+    }
+}
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webbench;
+
+import com.sun.webkit.perf.FrameTracer;
+import com.sun.webkit.perf.PerfLogger;
+import java.io.IOException;
+import java.net.URI;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Locale;
+import java.util.logging.Level;
+import java.util.logging.Logger;
+import java.util.stream.Stream;
+import javafx.animation.AnimationTimer;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * {@link PageLoadBenchmark} measures how fast WebView loads and scrolls a
+ * corpus of pages, to quantify changes to the WebView rendering pipeline.
+ *
+ * The pages are the HTML files named on the command line, or found in the
+ * directories named there; pages recorded with "Save Page As" of a desktop
+ * browser load without the network. Without arguments a few generated pages
+ * are used. Each page is loaded a fixed number of times and the median of
+ * the following is printed, in milliseconds from the call to load:
+ * <ul>
+ * <li>{@code parse}: until the document was parsed (domInteractive)</li>
+ * <li>{@code dcl}: until DOMContentLoaded was handled</li>
+ * <li>{@code load}: until the load worker succeeded</li>
+ * <li>{@code paint1}: until the first web frame was recorded</li>
+ * <li>{@code layout}: the time spent in style, layout and rendering updates</li>
+ * <li>{@code paint}: the time spent recording web frames</li>
+ * </ul>
+ * The page is then scrolled by a fixed step on every pulse, and the mean
+ * and 95th percentile frame time, the mean time to record and to decode a
+ * frame, the rendering queue bytes per frame and, with {@code -u}, the font
+ * upcalls per frame are printed.
+ *
+ * The stage times come from the frame trace of WebPage, so the internal
+ * package must be exported:
+ *
+ * <pre>
+ *   java --module-path $SDK/lib --add-modules javafx.web \
+ *        --add-exports javafx.web/com.sun.webkit.perf=ALL-UNNAMED \
+ *        webbench.PageLoadBenchmark [options] [page or directory...]
+ * </pre>
+ *
+ * JavaScript speed is measured by {@code jsbench.JSBenchmark}. A local copy
+ * of a JavaScript suite can be loaded as a page here, but its score is not
+ * read.
+ *
+ * Options:
+ * <ul>
+ * <li>{@code -i <n>} number of timed loads per page (default 5)</li>
+ * <li>{@code -s <n>} number of scrolled frames per page (default 300)</li>
+ * <li>{@code -u} count the font upcalls of WebCore (slows down text)</li>
+ * </ul>
+ */
+public class PageLoadBenchmark extends Application {
+
+    private static final int SCROLL_STEP = 20;
+
+    private static int iterations = 5;
+    private static int scrollFrames = 300;
+    private static PerfLogger upcalls;
+    // Keeps the level of the upcall logger
+    private static Logger upcallLogger;
+    private static final List<URI> pages = new ArrayList<>();
+
+    public static void main(String[] args) throws IOException {
+        for (int i = 0; i < args.length; i++) {
+            switch (args[i]) {
+                case "-i" -> iterations = Integer.parseInt(args[++i]);
+                case "-s" -> scrollFrames = Integer.parseInt(args[++i]);
+                case "-u" -> {
+                    // The font upcalls are counted if this is loggable
+                    // when the first font is created
+                    upcallLogger = Logger.getLogger("com.sun.webkit.perf.WCFontPerfLogger");
+                    upcallLogger.setLevel(Level.FINE);
+                    upcalls = PerfLogger.getLogger("WCFontPerfLogger");
+                }
+                default -> {
+                    if (args[i].startsWith("-")) {
+                        System.err.println("Usage: PageLoadBenchmark [-i <iterations>] [-s <frames>] [-u]"
+                                + " [page or directory...]");
+                        System.exit(1);
+                    }
+                    addPages(Path.of(args[i]));
+                }
+            }
+        }
+        if (pages.isEmpty()) {
+            addGeneratedPages();
+        }
+        launch(args);
+    }
+
+    private static void addPages(Path path) throws IOException {
+        if (!Files.isDirectory(path)) {
+            pages.add(path.toAbsolutePath().toUri());
+            return;
+        }
+        try (Stream<Path> files = Files.walk(path)) {
+            files.filter(p -> {
+                String name = p.getFileName().toString().toLowerCase(Locale.ROOT);
+                return name.endsWith(".html") || name.endsWith(".htm");
+            }).sorted().forEach(p -> pages.add(p.toAbsolutePath().toUri()));
+        }
+    }
+
+    private static void addGeneratedPages() throws IOException {
+        Path dir = Files.createTempDirectory("webbench");
+        dir.toFile().deleteOnExit();
+        StringBuilder article = new StringBuilder("<html><body style='font-family:serif;margin:40px'>");
+        for (int i = 0; i < 200; i++) {
+            article.append("<h2>Section ").append(i).append("</h2><p>");
+            for (int j = 0; j < 12; j++) {
+                article.append("Lorem ipsum dolor sit amet, <em>consectetur</em> adipiscing elit, sed do ")
+                       .append("eiusmod tempor <a href='#'>incididunt</a> ut labore et dolore magna aliqua. ");
+            }
+            article.append("</p>");
+        }
+        StringBuilder table = new StringBuilder("<html><body><table border=1 style='border-collapse:collapse'>");
+        for (int i = 0; i < 2000; i++) {
+            table.append("<tr>");
+            for (int j = 0; j < 8; j++) {
+                table.append("<td>").append(i * 8 + j).append("</td>");
+            }
+            table.append("</tr>");
+        }
+        StringBuilder cards = new StringBuilder("""
+            <html><head><style>
+            body { display: flex; flex-wrap: wrap; gap: 16px; margin: 16px; }
+            .card { width: 180px; height: 120px; border-radius: 12px; padding: 8px;
+                    background: linear-gradient(135deg, #fdfbfb, #a6c1ee);
+                    box-shadow: 0 4px 12px rgba(0, 0, 0, 0.3); font: 14px sans-serif; }
+            </style></head><body>""");
+        for (int i = 0; i < 600; i++) {
+            cards.append("<div class='card'><b>Card ").append(i).append("</b><br>Some text</div>");
+        }
+        for (String[] page : new String[][] {
+                { "article.html", article.toString() },
+                { "table.html", table.toString() },
+                { "cards.html", cards.toString() } }) {
+            Path file = dir.resolve(page[0]);
+            Files.writeString(file, page[1]);
+            file.toFile().deleteOnExit();
+            pages.add(file.toUri());
+        }
+    }
+
+    /**
+     * Sums up the stages of the web frames recorded and decoded while
+     * a page loads or scrolls.
+     */
+    private static final class Trace implements FrameTracer.Listener {
+        private long firstPaintEnd;
+        private long layoutNanos;
+        private long paintNanos;
+        private long decodeNanos;
+        private long paintBytes;
+        private int paints;
+        private int decodes;
+
+        synchronized void reset() {
+            firstPaintEnd = layoutNanos = paintNanos = decodeNanos = paintBytes = 0;
+            paints = decodes = 0;
+        }
+
+        @Override
+        public synchronized void complete(String name, int page, long frame,
+                                          long start, long end, long bytes)
+        {
+            switch (name) {
+                case "layout" -> layoutNanos += end - start;
+                case "paint" -> {
+                    if (paints++ == 0) {
+                        firstPaintEnd = end;
+                    }
+                    paintNanos += end - start;
+                    paintBytes += Math.max(bytes, 0);
+                }
+                case "decode" -> {
+                    decodes++;
+                    decodeNanos += end - start;
+                }
+                default -> { }
+            }
+        }
+    }
+
+    private final Trace trace = new Trace();
+    private WebEngine engine;
+    private int pageIndex;
+    private int iteration;
+    private long loadStart;
+    private final List<double[]> loads = new ArrayList<>();
+
+    @Override
+    public void start(Stage stage) {
+        FrameTracer.setListener(trace);
+        WebView webView = new WebView();
+        engine = webView.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((obs, oldState, newState) -> {
+            if (newState == Worker.State.SUCCEEDED) {
+                long loadEnd = System.nanoTime();
+                Platform.runLater(() -> loaded(loadEnd));
+            } else if (newState == Worker.State.FAILED) {
+                System.out.println(pageName() + ": failed to load");
+                nextPage();
+            }
+        });
+        stage.setScene(new Scene(webView, 1024, 768));
+        stage.setTitle("PageLoadBenchmark");
+        stage.show();
+
+        System.out.println(String.format(Locale.ROOT, "%-24s %8s %8s %8s %8s %8s %8s",
+                "page (ms)", "parse", "dcl", "load", "paint1", "layout", "paint"));
+        load();
+    }
+
+    private String pageName() {
+        String path = pages.get(pageIndex).getPath();
+        return path.substring(path.lastIndexOf('/') + 1);
+    }
+
+    private void load() {
+        trace.reset();
+        loadStart = System.nanoTime();
+        engine.load(pages.get(pageIndex).toString());
+    }
+
+    private void loaded(long loadEnd) {
+        // The navigation timing is relative to the start of the navigation,
+        // which is close enough to the call to load to add it up.
+        String timing = (String) engine.executeScript(
+                "var t = performance.timing; (t.domInteractive - t.navigationStart) + ','"
+                + " + (t.domContentLoadedEventEnd - t.navigationStart)");
+        String[] parts = timing.split(",");
+        synchronized (trace) {
+            loads.add(new double[] {
+                Double.parseDouble(parts[0]),
+                Double.parseDouble(parts[1]),
+                (loadEnd - loadStart) / 1e6,
+                trace.paints > 0 ? (trace.firstPaintEnd - loadStart) / 1e6 : Double.NaN,
+                trace.layoutNanos / 1e6,
+                trace.paintNanos / 1e6 });
+        }
+        // The first load warms up the caches and the JIT
+        if (iteration++ == 0) {
+            loads.clear();
+        }
+        if (iteration <= iterations) {
+            load();
+            return;
+        }
+
+        StringBuilder line = new StringBuilder(String.format(Locale.ROOT, "%-24s", pageName()));
+        for (int i = 0; i < 6; i++) {
+            final int column = i;
+            line.append(String.format(Locale.ROOT, " %8.1f",
+                    median(loads.stream().mapToDouble(l -> l[column]).toArray())));
+        }
+        System.out.println(line);
+        scroll();
+    }
+
+    private void scroll() {
+        engine.executeScript("window.scrollTo(0, 0)");
+        List<Double> frameTimes = new ArrayList<>();
+        new AnimationTimer() {
+            private long last;
+
+            @Override
+            public void handle(long now) {
+                if (last == 0) {
+                    trace.reset();
+                    if (upcalls != null) {
+                        upcalls.reset();
+                    }
+                } else {
+                    frameTimes.add((now - last) / 1e6);
+                }
+                last = now;
+                if (frameTimes.size() == scrollFrames) {
+                    stop();
+                    scrolled(frameTimes);
+                    return;
+                }
+                engine.executeScript("window.scrollBy(0, " + SCROLL_STEP + ");"
+                        + " if (window.innerHeight + window.scrollY >= document.documentElement.scrollHeight)"
+                        + " window.scrollTo(0, 0);");
+            }
+        }.start();
+    }
+
+    private void scrolled(List<Double> frameTimes) {
+        double[] times = frameTimes.stream().mapToDouble(Double::doubleValue).sorted().toArray();
+        double mean = 0;
+        for (double t : times) {
+            mean += t;
+        }
+        mean /= times.length;
+        synchronized (trace) {
+            int paints = Math.max(trace.paints, 1);
+            StringBuilder line = new StringBuilder(String.format(Locale.ROOT,
+                    "%-24s frame %.2f ms (p95 %.2f), record %.2f ms, decode %.2f ms, %.1f KB",
+                    "  scroll", mean, times[(int) (times.length * 0.95)],
+                    trace.paintNanos / 1e6 / paints,
+                    trace.decodeNanos / 1e6 / Math.max(trace.decodes, 1),
+                    trace.paintBytes / 1024.0 / paints));
+            if (upcalls != null) {
+                line.append(String.format(Locale.ROOT, ", %d upcalls",
+                        upcalls.getTotalCount() / paints));
+            }
+            System.out.println(line.append(" per frame"));
+        }
+        nextPage();
+    }
+
+    private void nextPage() {
+        iteration = 0;
+        loads.clear();
+        if (++pageIndex == pages.size()) {
+            Platform.exit();
+            return;
+        }
+        load();
+    }
+
+    private static double median(double[] values) {
+        double[] sorted = values.clone();
+        Arrays.sort(sorted);
+        return sorted[sorted.length / 2];
+    }
+}